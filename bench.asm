@@ -0,0 +1,3058 @@
+
+_bench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsc>:
+char buf[4096];
+char *argv0;
+
+static inline u64
+rdtsc(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  u64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+       6:	0f 31                	rdtsc
+       8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+       b:	89 55 fc             	mov    %edx,-0x4(%ebp)
+  return t;
+       e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+      11:	8b 55 fc             	mov    -0x4(%ebp),%edx
+}
+      14:	c9                   	leave
+      15:	c3                   	ret
+
+00000016 <div64>:
+
+// a/b without libgcc's 64-bit division.
+uint
+div64(u64 a, uint b)
+{
+      16:	55                   	push   %ebp
+      17:	89 e5                	mov    %esp,%ebp
+      19:	57                   	push   %edi
+      1a:	56                   	push   %esi
+      1b:	53                   	push   %ebx
+      1c:	83 ec 3c             	sub    $0x3c,%esp
+      1f:	8b 45 08             	mov    0x8(%ebp),%eax
+      22:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      25:	8b 45 0c             	mov    0xc(%ebp),%eax
+      28:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  u64 q, r;
+  int i;
+
+  q = r = 0;
+      2b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+      32:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+      39:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      3c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      3f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      42:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  for(i = 63; i >= 0; i--){
+      45:	c7 45 dc 3f 00 00 00 	movl   $0x3f,-0x24(%ebp)
+      4c:	e9 89 00 00 00       	jmp    da <div64+0xc4>
+    r = r << 1 | ((a >> i) & 1);
+      51:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      54:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      57:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+      5b:	01 c0                	add    %eax,%eax
+      5d:	89 c6                	mov    %eax,%esi
+      5f:	89 d7                	mov    %edx,%edi
+      61:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      64:	8b 45 c8             	mov    -0x38(%ebp),%eax
+      67:	8b 55 cc             	mov    -0x34(%ebp),%edx
+      6a:	0f ad d0             	shrd   %cl,%edx,%eax
+      6d:	d3 ea                	shr    %cl,%edx
+      6f:	f6 c1 20             	test   $0x20,%cl
+      72:	74 04                	je     78 <div64+0x62>
+      74:	89 d0                	mov    %edx,%eax
+      76:	31 d2                	xor    %edx,%edx
+      78:	83 e0 01             	and    $0x1,%eax
+      7b:	89 45 c0             	mov    %eax,-0x40(%ebp)
+      7e:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+      85:	89 f0                	mov    %esi,%eax
+      87:	89 fa                	mov    %edi,%edx
+      89:	0b 45 c0             	or     -0x40(%ebp),%eax
+      8c:	0b 55 c4             	or     -0x3c(%ebp),%edx
+      8f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      92:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    if(r >= b){
+      95:	8b 45 10             	mov    0x10(%ebp),%eax
+      98:	ba 00 00 00 00       	mov    $0x0,%edx
+      9d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+      a0:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+      a3:	19 d1                	sbb    %edx,%ecx
+      a5:	72 2f                	jb     d6 <div64+0xc0>
+      r -= b;
+      a7:	8b 45 10             	mov    0x10(%ebp),%eax
+      aa:	ba 00 00 00 00       	mov    $0x0,%edx
+      af:	29 45 e0             	sub    %eax,-0x20(%ebp)
+      b2:	19 55 e4             	sbb    %edx,-0x1c(%ebp)
+      q |= (u64)1 << i;
+      b5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      b8:	b8 01 00 00 00       	mov    $0x1,%eax
+      bd:	ba 00 00 00 00       	mov    $0x0,%edx
+      c2:	0f a5 c2             	shld   %cl,%eax,%edx
+      c5:	d3 e0                	shl    %cl,%eax
+      c7:	f6 c1 20             	test   $0x20,%cl
+      ca:	74 04                	je     d0 <div64+0xba>
+      cc:	89 c2                	mov    %eax,%edx
+      ce:	31 c0                	xor    %eax,%eax
+      d0:	09 45 e8             	or     %eax,-0x18(%ebp)
+      d3:	09 55 ec             	or     %edx,-0x14(%ebp)
+  for(i = 63; i >= 0; i--){
+      d6:	83 6d dc 01          	subl   $0x1,-0x24(%ebp)
+      da:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+      de:	0f 89 6d ff ff ff    	jns    51 <div64+0x3b>
+    }
+  }
+  return q > 0xffffffff ? 0xffffffff : q;
+      e4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      e7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+      ea:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+      ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+      f4:	39 c1                	cmp    %eax,%ecx
+      f6:	89 de                	mov    %ebx,%esi
+      f8:	19 d6                	sbb    %edx,%esi
+      fa:	89 cf                	mov    %ecx,%edi
+      fc:	0f 43 f8             	cmovae %eax,%edi
+      ff:	89 7d b8             	mov    %edi,-0x48(%ebp)
+     102:	0f 43 da             	cmovae %edx,%ebx
+     105:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+     108:	8b 45 b8             	mov    -0x48(%ebp),%eax
+}
+     10b:	83 c4 3c             	add    $0x3c,%esp
+     10e:	5b                   	pop    %ebx
+     10f:	5e                   	pop    %esi
+     110:	5f                   	pop    %edi
+     111:	5d                   	pop    %ebp
+     112:	c3                   	ret
+
+00000113 <report>:
+
+void
+report(char *name, int n, u64 t, char *unit)
+{
+     113:	55                   	push   %ebp
+     114:	89 e5                	mov    %esp,%ebp
+     116:	83 ec 18             	sub    $0x18,%esp
+     119:	8b 45 10             	mov    0x10(%ebp),%eax
+     11c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     11f:	8b 45 14             	mov    0x14(%ebp),%eax
+     122:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  printf(1, "bench %s %d %d %s\n", name, n, div64(t, n), unit);
+     125:	8b 45 0c             	mov    0xc(%ebp),%eax
+     128:	83 ec 04             	sub    $0x4,%esp
+     12b:	50                   	push   %eax
+     12c:	ff 75 f4             	push   -0xc(%ebp)
+     12f:	ff 75 f0             	push   -0x10(%ebp)
+     132:	e8 df fe ff ff       	call   16 <div64>
+     137:	83 c4 10             	add    $0x10,%esp
+     13a:	83 ec 08             	sub    $0x8,%esp
+     13d:	ff 75 18             	push   0x18(%ebp)
+     140:	50                   	push   %eax
+     141:	ff 75 0c             	push   0xc(%ebp)
+     144:	ff 75 08             	push   0x8(%ebp)
+     147:	68 22 19 00 00       	push   $0x1922
+     14c:	6a 01                	push   $0x1
+     14e:	e8 18 14 00 00       	call   156b <printf>
+     153:	83 c4 20             	add    $0x20,%esp
+}
+     156:	90                   	nop
+     157:	c9                   	leave
+     158:	c3                   	ret
+
+00000159 <fail>:
+
+// Give up on this benchmark.  main runs each one in a process
+// of its own, so the rest still run.
+void
+fail(char *name, char *what)
+{
+     159:	55                   	push   %ebp
+     15a:	89 e5                	mov    %esp,%ebp
+     15c:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "bench %s: %s failed\n", name, what);
+     15f:	ff 75 0c             	push   0xc(%ebp)
+     162:	ff 75 08             	push   0x8(%ebp)
+     165:	68 35 19 00 00       	push   $0x1935
+     16a:	6a 01                	push   $0x1
+     16c:	e8 fa 13 00 00       	call   156b <printf>
+     171:	83 c4 10             	add    $0x10,%esp
+  exit();
+     174:	e8 f6 11 00 00       	call   136f <exit>
+
+00000179 <rnd>:
+
+uint seed = 1;
+
+int
+rnd(int n)
+{
+     179:	55                   	push   %ebp
+     17a:	89 e5                	mov    %esp,%ebp
+  seed = seed * 1103515245 + 12345;
+     17c:	a1 20 20 00 00       	mov    0x2020,%eax
+     181:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+     187:	05 39 30 00 00       	add    $0x3039,%eax
+     18c:	a3 20 20 00 00       	mov    %eax,0x2020
+  return (seed >> 16) % n;
+     191:	a1 20 20 00 00       	mov    0x2020,%eax
+     196:	c1 e8 10             	shr    $0x10,%eax
+     199:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     19c:	ba 00 00 00 00       	mov    $0x0,%edx
+     1a1:	f7 f1                	div    %ecx
+     1a3:	89 d0                	mov    %edx,%eax
+}
+     1a5:	5d                   	pop    %ebp
+     1a6:	c3                   	ret
+
+000001a7 <tsc>:
+
+void
+tsc(char *name)
+{
+     1a7:	55                   	push   %ebp
+     1a8:	89 e5                	mov    %esp,%ebp
+     1aa:	83 ec 18             	sub    $0x18,%esp
+  uint t0;
+  u64 c;
+  int n;
+
+  n = 10;
+     1ad:	c7 45 f4 0a 00 00 00 	movl   $0xa,-0xc(%ebp)
+  t0 = uptime();
+     1b4:	e8 4e 12 00 00       	call   1407 <uptime>
+     1b9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(uptime() == t0)
+     1bc:	90                   	nop
+     1bd:	e8 45 12 00 00       	call   1407 <uptime>
+     1c2:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     1c5:	74 f6                	je     1bd <tsc+0x16>
+    ;
+  c = rdtsc();
+     1c7:	e8 34 fe ff ff       	call   0 <rdtsc>
+     1cc:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     1cf:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  t0 = uptime();
+     1d2:	e8 30 12 00 00       	call   1407 <uptime>
+     1d7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(uptime() - t0 < n)
+     1da:	90                   	nop
+     1db:	e8 27 12 00 00       	call   1407 <uptime>
+     1e0:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     1e3:	89 c2                	mov    %eax,%edx
+     1e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     1e8:	39 c2                	cmp    %eax,%edx
+     1ea:	72 ef                	jb     1db <tsc+0x34>
+    ;
+  report(name, n, rdtsc() - c, "tick");
+     1ec:	e8 0f fe ff ff       	call   0 <rdtsc>
+     1f1:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     1f4:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     1f7:	83 ec 0c             	sub    $0xc,%esp
+     1fa:	68 4a 19 00 00       	push   $0x194a
+     1ff:	52                   	push   %edx
+     200:	50                   	push   %eax
+     201:	ff 75 f4             	push   -0xc(%ebp)
+     204:	ff 75 08             	push   0x8(%ebp)
+     207:	e8 07 ff ff ff       	call   113 <report>
+     20c:	83 c4 20             	add    $0x20,%esp
+}
+     20f:	90                   	nop
+     210:	c9                   	leave
+     211:	c3                   	ret
+
+00000212 <nullsys>:
+
+void
+nullsys(char *name)
+{
+     212:	55                   	push   %ebp
+     213:	89 e5                	mov    %esp,%ebp
+     215:	83 ec 18             	sub    $0x18,%esp
+  u64 t;
+  int i, n;
+
+  n = 10000;
+     218:	c7 45 f0 10 27 00 00 	movl   $0x2710,-0x10(%ebp)
+  t = rdtsc();
+     21f:	e8 dc fd ff ff       	call   0 <rdtsc>
+     224:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     227:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  for(i = 0; i < n; i++)
+     22a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     231:	eb 09                	jmp    23c <nullsys+0x2a>
+    getpid();
+     233:	e8 b7 11 00 00       	call   13ef <getpid>
+  for(i = 0; i < n; i++)
+     238:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     23c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     23f:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     242:	7c ef                	jl     233 <nullsys+0x21>
+  report(name, n, rdtsc() - t, "call");
+     244:	e8 b7 fd ff ff       	call   0 <rdtsc>
+     249:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     24c:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     24f:	83 ec 0c             	sub    $0xc,%esp
+     252:	68 4f 19 00 00       	push   $0x194f
+     257:	52                   	push   %edx
+     258:	50                   	push   %eax
+     259:	ff 75 f0             	push   -0x10(%ebp)
+     25c:	ff 75 08             	push   0x8(%ebp)
+     25f:	e8 af fe ff ff       	call   113 <report>
+     264:	83 c4 20             	add    $0x20,%esp
+}
+     267:	90                   	nop
+     268:	c9                   	leave
+     269:	c3                   	ret
+
+0000026a <forkexit>:
+
+void
+forkexit(char *name)
+{
+     26a:	55                   	push   %ebp
+     26b:	89 e5                	mov    %esp,%ebp
+     26d:	83 ec 28             	sub    $0x28,%esp
+  u64 t;
+  int i, n, pid;
+
+  n = 200;
+     270:	c7 45 f0 c8 00 00 00 	movl   $0xc8,-0x10(%ebp)
+  t = rdtsc();
+     277:	e8 84 fd ff ff       	call   0 <rdtsc>
+     27c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     27f:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  for(i = 0; i < n; i++){
+     282:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     289:	eb 35                	jmp    2c0 <forkexit+0x56>
+    if((pid = fork()) < 0)
+     28b:	e8 d7 10 00 00       	call   1367 <fork>
+     290:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     293:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     297:	79 13                	jns    2ac <forkexit+0x42>
+      fail(name, "fork");
+     299:	83 ec 08             	sub    $0x8,%esp
+     29c:	68 54 19 00 00       	push   $0x1954
+     2a1:	ff 75 08             	push   0x8(%ebp)
+     2a4:	e8 b0 fe ff ff       	call   159 <fail>
+     2a9:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+     2ac:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     2b0:	75 05                	jne    2b7 <forkexit+0x4d>
+      exit();
+     2b2:	e8 b8 10 00 00       	call   136f <exit>
+    wait();
+     2b7:	e8 bb 10 00 00       	call   1377 <wait>
+  for(i = 0; i < n; i++){
+     2bc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     2c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     2c3:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     2c6:	7c c3                	jl     28b <forkexit+0x21>
+  }
+  report(name, n, rdtsc() - t, "fork");
+     2c8:	e8 33 fd ff ff       	call   0 <rdtsc>
+     2cd:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     2d0:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     2d3:	83 ec 0c             	sub    $0xc,%esp
+     2d6:	68 54 19 00 00       	push   $0x1954
+     2db:	52                   	push   %edx
+     2dc:	50                   	push   %eax
+     2dd:	ff 75 f0             	push   -0x10(%ebp)
+     2e0:	ff 75 08             	push   0x8(%ebp)
+     2e3:	e8 2b fe ff ff       	call   113 <report>
+     2e8:	83 c4 20             	add    $0x20,%esp
+}
+     2eb:	90                   	nop
+     2ec:	c9                   	leave
+     2ed:	c3                   	ret
+
+000002ee <forkexec>:
+
+void
+forkexec(char *name)
+{
+     2ee:	55                   	push   %ebp
+     2ef:	89 e5                	mov    %esp,%ebp
+     2f1:	83 ec 28             	sub    $0x28,%esp
+  u64 t;
+  int i, n, pid;
+  char *args[3];
+
+  n = 50;
+     2f4:	c7 45 f0 32 00 00 00 	movl   $0x32,-0x10(%ebp)
+  t = rdtsc();
+     2fb:	e8 00 fd ff ff       	call   0 <rdtsc>
+     300:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     303:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  for(i = 0; i < n; i++){
+     306:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     30d:	eb 6e                	jmp    37d <forkexec+0x8f>
+    if((pid = fork()) < 0)
+     30f:	e8 53 10 00 00       	call   1367 <fork>
+     314:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     317:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     31b:	79 13                	jns    330 <forkexec+0x42>
+      fail(name, "fork");
+     31d:	83 ec 08             	sub    $0x8,%esp
+     320:	68 54 19 00 00       	push   $0x1954
+     325:	ff 75 08             	push   0x8(%ebp)
+     328:	e8 2c fe ff ff       	call   159 <fail>
+     32d:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0){
+     330:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     334:	75 3e                	jne    374 <forkexec+0x86>
+      args[0] = argv0;
+     336:	a1 e0 30 00 00       	mov    0x30e0,%eax
+     33b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+      args[1] = "-exit";
+     33e:	c7 45 dc 59 19 00 00 	movl   $0x1959,-0x24(%ebp)
+      args[2] = 0;
+     345:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+      exec(argv0, args);
+     34c:	a1 e0 30 00 00       	mov    0x30e0,%eax
+     351:	83 ec 08             	sub    $0x8,%esp
+     354:	8d 55 d8             	lea    -0x28(%ebp),%edx
+     357:	52                   	push   %edx
+     358:	50                   	push   %eax
+     359:	e8 49 10 00 00       	call   13a7 <exec>
+     35e:	83 c4 10             	add    $0x10,%esp
+      fail(name, "exec");
+     361:	83 ec 08             	sub    $0x8,%esp
+     364:	68 5f 19 00 00       	push   $0x195f
+     369:	ff 75 08             	push   0x8(%ebp)
+     36c:	e8 e8 fd ff ff       	call   159 <fail>
+     371:	83 c4 10             	add    $0x10,%esp
+    }
+    wait();
+     374:	e8 fe 0f 00 00       	call   1377 <wait>
+  for(i = 0; i < n; i++){
+     379:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     37d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     380:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     383:	7c 8a                	jl     30f <forkexec+0x21>
+  }
+  report(name, n, rdtsc() - t, "exec");
+     385:	e8 76 fc ff ff       	call   0 <rdtsc>
+     38a:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     38d:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     390:	83 ec 0c             	sub    $0xc,%esp
+     393:	68 5f 19 00 00       	push   $0x195f
+     398:	52                   	push   %edx
+     399:	50                   	push   %eax
+     39a:	ff 75 f0             	push   -0x10(%ebp)
+     39d:	ff 75 08             	push   0x8(%ebp)
+     3a0:	e8 6e fd ff ff       	call   113 <report>
+     3a5:	83 c4 20             	add    $0x20,%esp
+}
+     3a8:	90                   	nop
+     3a9:	c9                   	leave
+     3aa:	c3                   	ret
+
+000003ab <pipebw>:
+
+void
+pipebw(char *name)
+{
+     3ab:	55                   	push   %ebp
+     3ac:	89 e5                	mov    %esp,%ebp
+     3ae:	83 ec 28             	sub    $0x28,%esp
+  u64 t;
+  int fds[2], n, total, m;
+
+  total = 1024*1024;
+     3b1:	c7 45 f0 00 00 10 00 	movl   $0x100000,-0x10(%ebp)
+  if(pipe(fds) < 0)
+     3b8:	83 ec 0c             	sub    $0xc,%esp
+     3bb:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     3be:	50                   	push   %eax
+     3bf:	e8 bb 0f 00 00       	call   137f <pipe>
+     3c4:	83 c4 10             	add    $0x10,%esp
+     3c7:	85 c0                	test   %eax,%eax
+     3c9:	79 13                	jns    3de <pipebw+0x33>
+    fail(name, "pipe");
+     3cb:	83 ec 08             	sub    $0x8,%esp
+     3ce:	68 64 19 00 00       	push   $0x1964
+     3d3:	ff 75 08             	push   0x8(%ebp)
+     3d6:	e8 7e fd ff ff       	call   159 <fail>
+     3db:	83 c4 10             	add    $0x10,%esp
+  t = rdtsc();
+     3de:	e8 1d fc ff ff       	call   0 <rdtsc>
+     3e3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     3e6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  if(fork() == 0){
+     3e9:	e8 79 0f 00 00       	call   1367 <fork>
+     3ee:	85 c0                	test   %eax,%eax
+     3f0:	75 49                	jne    43b <pipebw+0x90>
+    close(fds[0]);
+     3f2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     3f5:	83 ec 0c             	sub    $0xc,%esp
+     3f8:	50                   	push   %eax
+     3f9:	e8 99 0f 00 00       	call   1397 <close>
+     3fe:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < total; n += sizeof(buf))
+     401:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     408:	eb 24                	jmp    42e <pipebw+0x83>
+      write(fds[1], buf, sizeof(buf));
+     40a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     40d:	83 ec 04             	sub    $0x4,%esp
+     410:	68 00 10 00 00       	push   $0x1000
+     415:	68 e0 20 00 00       	push   $0x20e0
+     41a:	50                   	push   %eax
+     41b:	e8 6f 0f 00 00       	call   138f <write>
+     420:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < total; n += sizeof(buf))
+     423:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     426:	05 00 10 00 00       	add    $0x1000,%eax
+     42b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     42e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     431:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     434:	7c d4                	jl     40a <pipebw+0x5f>
+    exit();
+     436:	e8 34 0f 00 00       	call   136f <exit>
+  }
+  close(fds[1]);
+     43b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     43e:	83 ec 0c             	sub    $0xc,%esp
+     441:	50                   	push   %eax
+     442:	e8 50 0f 00 00       	call   1397 <close>
+     447:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < total; n += m)
+     44a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     451:	eb 3b                	jmp    48e <pipebw+0xe3>
+    if((m = read(fds[0], buf, sizeof(buf))) <= 0)
+     453:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     456:	83 ec 04             	sub    $0x4,%esp
+     459:	68 00 10 00 00       	push   $0x1000
+     45e:	68 e0 20 00 00       	push   $0x20e0
+     463:	50                   	push   %eax
+     464:	e8 1e 0f 00 00       	call   1387 <read>
+     469:	83 c4 10             	add    $0x10,%esp
+     46c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     46f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     473:	7f 13                	jg     488 <pipebw+0xdd>
+      fail(name, "read");
+     475:	83 ec 08             	sub    $0x8,%esp
+     478:	68 69 19 00 00       	push   $0x1969
+     47d:	ff 75 08             	push   0x8(%ebp)
+     480:	e8 d4 fc ff ff       	call   159 <fail>
+     485:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < total; n += m)
+     488:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     48b:	01 45 f4             	add    %eax,-0xc(%ebp)
+     48e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     491:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     494:	7c bd                	jl     453 <pipebw+0xa8>
+  t = rdtsc() - t;
+     496:	e8 65 fb ff ff       	call   0 <rdtsc>
+     49b:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     49e:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     4a1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     4a4:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  close(fds[0]);
+     4a7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     4aa:	83 ec 0c             	sub    $0xc,%esp
+     4ad:	50                   	push   %eax
+     4ae:	e8 e4 0e 00 00       	call   1397 <close>
+     4b3:	83 c4 10             	add    $0x10,%esp
+  wait();
+     4b6:	e8 bc 0e 00 00       	call   1377 <wait>
+  report(name, total/1024, t, "KB");
+     4bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     4be:	8d 90 ff 03 00 00    	lea    0x3ff(%eax),%edx
+     4c4:	85 c0                	test   %eax,%eax
+     4c6:	0f 48 c2             	cmovs  %edx,%eax
+     4c9:	c1 f8 0a             	sar    $0xa,%eax
+     4cc:	83 ec 0c             	sub    $0xc,%esp
+     4cf:	68 6e 19 00 00       	push   $0x196e
+     4d4:	ff 75 ec             	push   -0x14(%ebp)
+     4d7:	ff 75 e8             	push   -0x18(%ebp)
+     4da:	50                   	push   %eax
+     4db:	ff 75 08             	push   0x8(%ebp)
+     4de:	e8 30 fc ff ff       	call   113 <report>
+     4e3:	83 c4 20             	add    $0x20,%esp
+}
+     4e6:	90                   	nop
+     4e7:	c9                   	leave
+     4e8:	c3                   	ret
+
+000004e9 <ring>:
+// The pipes are made one hop at a time and every process
+// keeps only the two ends it uses, so no process holds more
+// than a few descriptors however long the ring.
+u64
+ring(char *name, int nproc, int n)
+{
+     4e9:	55                   	push   %ebp
+     4ea:	89 e5                	mov    %esp,%ebp
+     4ec:	83 ec 38             	sub    $0x38,%esp
+  int first[2], fds[2], in, i, j;
+  u64 t;
+  char c;
+
+  if(pipe(first) < 0)
+     4ef:	83 ec 0c             	sub    $0xc,%esp
+     4f2:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     4f5:	50                   	push   %eax
+     4f6:	e8 84 0e 00 00       	call   137f <pipe>
+     4fb:	83 c4 10             	add    $0x10,%esp
+     4fe:	85 c0                	test   %eax,%eax
+     500:	79 13                	jns    515 <ring+0x2c>
+    fail(name, "pipe");
+     502:	83 ec 08             	sub    $0x8,%esp
+     505:	68 64 19 00 00       	push   $0x1964
+     50a:	ff 75 08             	push   0x8(%ebp)
+     50d:	e8 47 fc ff ff       	call   159 <fail>
+     512:	83 c4 10             	add    $0x10,%esp
+  in = first[0];
+     515:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     518:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 1; i < nproc; i++){
+     51b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+     522:	e9 bf 00 00 00       	jmp    5e6 <ring+0xfd>
+    if(pipe(fds) < 0)
+     527:	83 ec 0c             	sub    $0xc,%esp
+     52a:	8d 45 d0             	lea    -0x30(%ebp),%eax
+     52d:	50                   	push   %eax
+     52e:	e8 4c 0e 00 00       	call   137f <pipe>
+     533:	83 c4 10             	add    $0x10,%esp
+     536:	85 c0                	test   %eax,%eax
+     538:	79 13                	jns    54d <ring+0x64>
+      fail(name, "pipe");
+     53a:	83 ec 08             	sub    $0x8,%esp
+     53d:	68 64 19 00 00       	push   $0x1964
+     542:	ff 75 08             	push   0x8(%ebp)
+     545:	e8 0f fc ff ff       	call   159 <fail>
+     54a:	83 c4 10             	add    $0x10,%esp
+    if(fork() == 0){
+     54d:	e8 15 0e 00 00       	call   1367 <fork>
+     552:	85 c0                	test   %eax,%eax
+     554:	75 69                	jne    5bf <ring+0xd6>
+      close(first[1]);
+     556:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     559:	83 ec 0c             	sub    $0xc,%esp
+     55c:	50                   	push   %eax
+     55d:	e8 35 0e 00 00       	call   1397 <close>
+     562:	83 c4 10             	add    $0x10,%esp
+      close(fds[0]);
+     565:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     568:	83 ec 0c             	sub    $0xc,%esp
+     56b:	50                   	push   %eax
+     56c:	e8 26 0e 00 00       	call   1397 <close>
+     571:	83 c4 10             	add    $0x10,%esp
+      for(j = 0; j < n; j++){
+     574:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     57b:	eb 32                	jmp    5af <ring+0xc6>
+        if(read(in, &c, 1) != 1)
+     57d:	83 ec 04             	sub    $0x4,%esp
+     580:	6a 01                	push   $0x1
+     582:	8d 45 cf             	lea    -0x31(%ebp),%eax
+     585:	50                   	push   %eax
+     586:	ff 75 f4             	push   -0xc(%ebp)
+     589:	e8 f9 0d 00 00       	call   1387 <read>
+     58e:	83 c4 10             	add    $0x10,%esp
+     591:	83 f8 01             	cmp    $0x1,%eax
+     594:	75 23                	jne    5b9 <ring+0xd0>
+          break;
+        write(fds[1], &c, 1);
+     596:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     599:	83 ec 04             	sub    $0x4,%esp
+     59c:	6a 01                	push   $0x1
+     59e:	8d 55 cf             	lea    -0x31(%ebp),%edx
+     5a1:	52                   	push   %edx
+     5a2:	50                   	push   %eax
+     5a3:	e8 e7 0d 00 00       	call   138f <write>
+     5a8:	83 c4 10             	add    $0x10,%esp
+      for(j = 0; j < n; j++){
+     5ab:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     5af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     5b2:	3b 45 10             	cmp    0x10(%ebp),%eax
+     5b5:	7c c6                	jl     57d <ring+0x94>
+     5b7:	eb 01                	jmp    5ba <ring+0xd1>
+          break;
+     5b9:	90                   	nop
+      }
+      exit();
+     5ba:	e8 b0 0d 00 00       	call   136f <exit>
+    }
+    close(in);
+     5bf:	83 ec 0c             	sub    $0xc,%esp
+     5c2:	ff 75 f4             	push   -0xc(%ebp)
+     5c5:	e8 cd 0d 00 00       	call   1397 <close>
+     5ca:	83 c4 10             	add    $0x10,%esp
+    close(fds[1]);
+     5cd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     5d0:	83 ec 0c             	sub    $0xc,%esp
+     5d3:	50                   	push   %eax
+     5d4:	e8 be 0d 00 00       	call   1397 <close>
+     5d9:	83 c4 10             	add    $0x10,%esp
+    in = fds[0];
+     5dc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     5df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 1; i < nproc; i++){
+     5e2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     5e6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     5e9:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     5ec:	0f 8c 35 ff ff ff    	jl     527 <ring+0x3e>
+  }
+  t = rdtsc();
+     5f2:	e8 09 fa ff ff       	call   0 <rdtsc>
+     5f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     5fa:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(j = 0; j < n; j++){
+     5fd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     604:	eb 45                	jmp    64b <ring+0x162>
+    write(first[1], &c, 1);
+     606:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     609:	83 ec 04             	sub    $0x4,%esp
+     60c:	6a 01                	push   $0x1
+     60e:	8d 55 cf             	lea    -0x31(%ebp),%edx
+     611:	52                   	push   %edx
+     612:	50                   	push   %eax
+     613:	e8 77 0d 00 00       	call   138f <write>
+     618:	83 c4 10             	add    $0x10,%esp
+    if(read(in, &c, 1) != 1)
+     61b:	83 ec 04             	sub    $0x4,%esp
+     61e:	6a 01                	push   $0x1
+     620:	8d 45 cf             	lea    -0x31(%ebp),%eax
+     623:	50                   	push   %eax
+     624:	ff 75 f4             	push   -0xc(%ebp)
+     627:	e8 5b 0d 00 00       	call   1387 <read>
+     62c:	83 c4 10             	add    $0x10,%esp
+     62f:	83 f8 01             	cmp    $0x1,%eax
+     632:	74 13                	je     647 <ring+0x15e>
+      fail(name, "read");
+     634:	83 ec 08             	sub    $0x8,%esp
+     637:	68 69 19 00 00       	push   $0x1969
+     63c:	ff 75 08             	push   0x8(%ebp)
+     63f:	e8 15 fb ff ff       	call   159 <fail>
+     644:	83 c4 10             	add    $0x10,%esp
+  for(j = 0; j < n; j++){
+     647:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     64b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     64e:	3b 45 10             	cmp    0x10(%ebp),%eax
+     651:	7c b3                	jl     606 <ring+0x11d>
+  }
+  t = rdtsc() - t;
+     653:	e8 a8 f9 ff ff       	call   0 <rdtsc>
+     658:	2b 45 e0             	sub    -0x20(%ebp),%eax
+     65b:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+     65e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     661:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  close(first[1]);
+     664:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     667:	83 ec 0c             	sub    $0xc,%esp
+     66a:	50                   	push   %eax
+     66b:	e8 27 0d 00 00       	call   1397 <close>
+     670:	83 c4 10             	add    $0x10,%esp
+  close(in);
+     673:	83 ec 0c             	sub    $0xc,%esp
+     676:	ff 75 f4             	push   -0xc(%ebp)
+     679:	e8 19 0d 00 00       	call   1397 <close>
+     67e:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < nproc; i++)
+     681:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+     688:	eb 09                	jmp    693 <ring+0x1aa>
+    wait();
+     68a:	e8 e8 0c 00 00       	call   1377 <wait>
+  for(i = 1; i < nproc; i++)
+     68f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     693:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     696:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     699:	7c ef                	jl     68a <ring+0x1a1>
+  return t;
+     69b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     69e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+     6a1:	c9                   	leave
+     6a2:	c3                   	ret
+
+000006a3 <pipelat>:
+
+void
+pipelat(char *name)
+{
+     6a3:	55                   	push   %ebp
+     6a4:	89 e5                	mov    %esp,%ebp
+     6a6:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  n = 1000;
+     6a9:	c7 45 f4 e8 03 00 00 	movl   $0x3e8,-0xc(%ebp)
+  report(name, n, ring(name, 2, n), "roundtrip");
+     6b0:	83 ec 04             	sub    $0x4,%esp
+     6b3:	ff 75 f4             	push   -0xc(%ebp)
+     6b6:	6a 02                	push   $0x2
+     6b8:	ff 75 08             	push   0x8(%ebp)
+     6bb:	e8 29 fe ff ff       	call   4e9 <ring>
+     6c0:	83 c4 10             	add    $0x10,%esp
+     6c3:	83 ec 0c             	sub    $0xc,%esp
+     6c6:	68 71 19 00 00       	push   $0x1971
+     6cb:	52                   	push   %edx
+     6cc:	50                   	push   %eax
+     6cd:	ff 75 f4             	push   -0xc(%ebp)
+     6d0:	ff 75 08             	push   0x8(%ebp)
+     6d3:	e8 3b fa ff ff       	call   113 <report>
+     6d8:	83 c4 20             	add    $0x20,%esp
+}
+     6db:	90                   	nop
+     6dc:	c9                   	leave
+     6dd:	c3                   	ret
+
+000006de <ctxsw>:
+
+void
+ctxsw(char *name)
+{
+     6de:	55                   	push   %ebp
+     6df:	89 e5                	mov    %esp,%ebp
+     6e1:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  n = 200;
+     6e4:	c7 45 f4 c8 00 00 00 	movl   $0xc8,-0xc(%ebp)
+  report(name, n*8, ring(name, 8, n), "switch");
+     6eb:	83 ec 04             	sub    $0x4,%esp
+     6ee:	ff 75 f4             	push   -0xc(%ebp)
+     6f1:	6a 08                	push   $0x8
+     6f3:	ff 75 08             	push   0x8(%ebp)
+     6f6:	e8 ee fd ff ff       	call   4e9 <ring>
+     6fb:	83 c4 10             	add    $0x10,%esp
+     6fe:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     701:	c1 e1 03             	shl    $0x3,%ecx
+     704:	83 ec 0c             	sub    $0xc,%esp
+     707:	68 7b 19 00 00       	push   $0x197b
+     70c:	52                   	push   %edx
+     70d:	50                   	push   %eax
+     70e:	51                   	push   %ecx
+     70f:	ff 75 08             	push   0x8(%ebp)
+     712:	e8 fc f9 ff ff       	call   113 <report>
+     717:	83 c4 20             	add    $0x20,%esp
+}
+     71a:	90                   	nop
+     71b:	c9                   	leave
+     71c:	c3                   	ret
+
+0000071d <seqwrite>:
+
+void
+seqwrite(char *name)
+{
+     71d:	55                   	push   %ebp
+     71e:	89 e5                	mov    %esp,%ebp
+     720:	83 ec 28             	sub    $0x28,%esp
+  int fd, n;
+  u64 t;
+
+  unlink(FILE);
+     723:	83 ec 0c             	sub    $0xc,%esp
+     726:	68 82 19 00 00       	push   $0x1982
+     72b:	e8 8f 0c 00 00       	call   13bf <unlink>
+     730:	83 c4 10             	add    $0x10,%esp
+  t = rdtsc();
+     733:	e8 c8 f8 ff ff       	call   0 <rdtsc>
+     738:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     73b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  if((fd = open(FILE, O_CREATE|O_RDWR)) < 0)
+     73e:	83 ec 08             	sub    $0x8,%esp
+     741:	68 02 02 00 00       	push   $0x202
+     746:	68 82 19 00 00       	push   $0x1982
+     74b:	e8 5f 0c 00 00       	call   13af <open>
+     750:	83 c4 10             	add    $0x10,%esp
+     753:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     756:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     75a:	79 13                	jns    76f <seqwrite+0x52>
+    fail(name, "create");
+     75c:	83 ec 08             	sub    $0x8,%esp
+     75f:	68 8c 19 00 00       	push   $0x198c
+     764:	ff 75 08             	push   0x8(%ebp)
+     767:	e8 ed f9 ff ff       	call   159 <fail>
+     76c:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < FILESIZE; n += sizeof(buf))
+     76f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     776:	eb 3d                	jmp    7b5 <seqwrite+0x98>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+     778:	83 ec 04             	sub    $0x4,%esp
+     77b:	68 00 10 00 00       	push   $0x1000
+     780:	68 e0 20 00 00       	push   $0x20e0
+     785:	ff 75 e4             	push   -0x1c(%ebp)
+     788:	e8 02 0c 00 00       	call   138f <write>
+     78d:	83 c4 10             	add    $0x10,%esp
+     790:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     795:	74 13                	je     7aa <seqwrite+0x8d>
+      fail(name, "write");
+     797:	83 ec 08             	sub    $0x8,%esp
+     79a:	68 93 19 00 00       	push   $0x1993
+     79f:	ff 75 08             	push   0x8(%ebp)
+     7a2:	e8 b2 f9 ff ff       	call   159 <fail>
+     7a7:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < FILESIZE; n += sizeof(buf))
+     7aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7ad:	05 00 10 00 00       	add    $0x1000,%eax
+     7b2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     7b5:	81 7d f4 ff ff 00 00 	cmpl   $0xffff,-0xc(%ebp)
+     7bc:	7e ba                	jle    778 <seqwrite+0x5b>
+  close(fd);
+     7be:	83 ec 0c             	sub    $0xc,%esp
+     7c1:	ff 75 e4             	push   -0x1c(%ebp)
+     7c4:	e8 ce 0b 00 00       	call   1397 <close>
+     7c9:	83 c4 10             	add    $0x10,%esp
+  report(name, FILESIZE/1024, rdtsc() - t, "KB");
+     7cc:	e8 2f f8 ff ff       	call   0 <rdtsc>
+     7d1:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     7d4:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     7d7:	83 ec 0c             	sub    $0xc,%esp
+     7da:	68 6e 19 00 00       	push   $0x196e
+     7df:	52                   	push   %edx
+     7e0:	50                   	push   %eax
+     7e1:	6a 40                	push   $0x40
+     7e3:	ff 75 08             	push   0x8(%ebp)
+     7e6:	e8 28 f9 ff ff       	call   113 <report>
+     7eb:	83 c4 20             	add    $0x20,%esp
+}
+     7ee:	90                   	nop
+     7ef:	c9                   	leave
+     7f0:	c3                   	ret
+
+000007f1 <needfile>:
+
+// Make sure FILE exists for the read benchmarks when
+// seqwrite was not asked for.
+void
+needfile(char *name)
+{
+     7f1:	55                   	push   %ebp
+     7f2:	89 e5                	mov    %esp,%ebp
+     7f4:	83 ec 28             	sub    $0x28,%esp
+  struct stat st;
+  int fd, n;
+
+  if(stat(FILE, &st) == 0 && st.size >= FILESIZE)
+     7f7:	83 ec 08             	sub    $0x8,%esp
+     7fa:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     7fd:	50                   	push   %eax
+     7fe:	68 82 19 00 00       	push   $0x1982
+     803:	e8 4a 0a 00 00       	call   1252 <stat>
+     808:	83 c4 10             	add    $0x10,%esp
+     80b:	85 c0                	test   %eax,%eax
+     80d:	75 0e                	jne    81d <needfile+0x2c>
+     80f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     812:	3d ff ff 00 00       	cmp    $0xffff,%eax
+     817:	0f 87 90 00 00 00    	ja     8ad <needfile+0xbc>
+    return;
+  if((fd = open(FILE, O_CREATE|O_RDWR)) < 0)
+     81d:	83 ec 08             	sub    $0x8,%esp
+     820:	68 02 02 00 00       	push   $0x202
+     825:	68 82 19 00 00       	push   $0x1982
+     82a:	e8 80 0b 00 00       	call   13af <open>
+     82f:	83 c4 10             	add    $0x10,%esp
+     832:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     835:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     839:	79 13                	jns    84e <needfile+0x5d>
+    fail(name, "create");
+     83b:	83 ec 08             	sub    $0x8,%esp
+     83e:	68 8c 19 00 00       	push   $0x198c
+     843:	ff 75 08             	push   0x8(%ebp)
+     846:	e8 0e f9 ff ff       	call   159 <fail>
+     84b:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < FILESIZE; n += sizeof(buf))
+     84e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     855:	eb 3d                	jmp    894 <needfile+0xa3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+     857:	83 ec 04             	sub    $0x4,%esp
+     85a:	68 00 10 00 00       	push   $0x1000
+     85f:	68 e0 20 00 00       	push   $0x20e0
+     864:	ff 75 f0             	push   -0x10(%ebp)
+     867:	e8 23 0b 00 00       	call   138f <write>
+     86c:	83 c4 10             	add    $0x10,%esp
+     86f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     874:	74 13                	je     889 <needfile+0x98>
+      fail(name, "write");
+     876:	83 ec 08             	sub    $0x8,%esp
+     879:	68 93 19 00 00       	push   $0x1993
+     87e:	ff 75 08             	push   0x8(%ebp)
+     881:	e8 d3 f8 ff ff       	call   159 <fail>
+     886:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < FILESIZE; n += sizeof(buf))
+     889:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     88c:	05 00 10 00 00       	add    $0x1000,%eax
+     891:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     894:	81 7d f4 ff ff 00 00 	cmpl   $0xffff,-0xc(%ebp)
+     89b:	7e ba                	jle    857 <needfile+0x66>
+  close(fd);
+     89d:	83 ec 0c             	sub    $0xc,%esp
+     8a0:	ff 75 f0             	push   -0x10(%ebp)
+     8a3:	e8 ef 0a 00 00       	call   1397 <close>
+     8a8:	83 c4 10             	add    $0x10,%esp
+     8ab:	eb 01                	jmp    8ae <needfile+0xbd>
+    return;
+     8ad:	90                   	nop
+}
+     8ae:	c9                   	leave
+     8af:	c3                   	ret
+
+000008b0 <seqread>:
+
+void
+seqread(char *name)
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	83 ec 28             	sub    $0x28,%esp
+  int fd, n, m;
+  u64 t;
+
+  needfile(name);
+     8b6:	83 ec 0c             	sub    $0xc,%esp
+     8b9:	ff 75 08             	push   0x8(%ebp)
+     8bc:	e8 30 ff ff ff       	call   7f1 <needfile>
+     8c1:	83 c4 10             	add    $0x10,%esp
+  t = rdtsc();
+     8c4:	e8 37 f7 ff ff       	call   0 <rdtsc>
+     8c9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     8cc:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  if((fd = open(FILE, O_RDONLY)) < 0)
+     8cf:	83 ec 08             	sub    $0x8,%esp
+     8d2:	6a 00                	push   $0x0
+     8d4:	68 82 19 00 00       	push   $0x1982
+     8d9:	e8 d1 0a 00 00       	call   13af <open>
+     8de:	83 c4 10             	add    $0x10,%esp
+     8e1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     8e4:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+     8e8:	79 13                	jns    8fd <seqread+0x4d>
+    fail(name, "open");
+     8ea:	83 ec 08             	sub    $0x8,%esp
+     8ed:	68 99 19 00 00       	push   $0x1999
+     8f2:	ff 75 08             	push   0x8(%ebp)
+     8f5:	e8 5f f8 ff ff       	call   159 <fail>
+     8fa:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < FILESIZE; n += m)
+     8fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     904:	eb 3a                	jmp    940 <seqread+0x90>
+    if((m = read(fd, buf, sizeof(buf))) <= 0)
+     906:	83 ec 04             	sub    $0x4,%esp
+     909:	68 00 10 00 00       	push   $0x1000
+     90e:	68 e0 20 00 00       	push   $0x20e0
+     913:	ff 75 e4             	push   -0x1c(%ebp)
+     916:	e8 6c 0a 00 00       	call   1387 <read>
+     91b:	83 c4 10             	add    $0x10,%esp
+     91e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     921:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     925:	7f 13                	jg     93a <seqread+0x8a>
+      fail(name, "read");
+     927:	83 ec 08             	sub    $0x8,%esp
+     92a:	68 69 19 00 00       	push   $0x1969
+     92f:	ff 75 08             	push   0x8(%ebp)
+     932:	e8 22 f8 ff ff       	call   159 <fail>
+     937:	83 c4 10             	add    $0x10,%esp
+  for(n = 0; n < FILESIZE; n += m)
+     93a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     93d:	01 45 f4             	add    %eax,-0xc(%ebp)
+     940:	81 7d f4 ff ff 00 00 	cmpl   $0xffff,-0xc(%ebp)
+     947:	7e bd                	jle    906 <seqread+0x56>
+  close(fd);
+     949:	83 ec 0c             	sub    $0xc,%esp
+     94c:	ff 75 e4             	push   -0x1c(%ebp)
+     94f:	e8 43 0a 00 00       	call   1397 <close>
+     954:	83 c4 10             	add    $0x10,%esp
+  report(name, FILESIZE/1024, rdtsc() - t, "KB");
+     957:	e8 a4 f6 ff ff       	call   0 <rdtsc>
+     95c:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     95f:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     962:	83 ec 0c             	sub    $0xc,%esp
+     965:	68 6e 19 00 00       	push   $0x196e
+     96a:	52                   	push   %edx
+     96b:	50                   	push   %eax
+     96c:	6a 40                	push   $0x40
+     96e:	ff 75 08             	push   0x8(%ebp)
+     971:	e8 9d f7 ff ff       	call   113 <report>
+     976:	83 c4 20             	add    $0x20,%esp
+}
+     979:	90                   	nop
+     97a:	c9                   	leave
+     97b:	c3                   	ret
+
+0000097c <randread>:
+
+void
+randread(char *name)
+{
+     97c:	55                   	push   %ebp
+     97d:	89 e5                	mov    %esp,%ebp
+     97f:	83 ec 28             	sub    $0x28,%esp
+  int fd, i, n;
+  u64 t;
+
+  n = 256;
+     982:	c7 45 f0 00 01 00 00 	movl   $0x100,-0x10(%ebp)
+  needfile(name);
+     989:	83 ec 0c             	sub    $0xc,%esp
+     98c:	ff 75 08             	push   0x8(%ebp)
+     98f:	e8 5d fe ff ff       	call   7f1 <needfile>
+     994:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(FILE, O_RDONLY)) < 0)
+     997:	83 ec 08             	sub    $0x8,%esp
+     99a:	6a 00                	push   $0x0
+     99c:	68 82 19 00 00       	push   $0x1982
+     9a1:	e8 09 0a 00 00       	call   13af <open>
+     9a6:	83 c4 10             	add    $0x10,%esp
+     9a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     9ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     9b0:	79 13                	jns    9c5 <randread+0x49>
+    fail(name, "open");
+     9b2:	83 ec 08             	sub    $0x8,%esp
+     9b5:	68 99 19 00 00       	push   $0x1999
+     9ba:	ff 75 08             	push   0x8(%ebp)
+     9bd:	e8 97 f7 ff ff       	call   159 <fail>
+     9c2:	83 c4 10             	add    $0x10,%esp
+  t = rdtsc();
+     9c5:	e8 36 f6 ff ff       	call   0 <rdtsc>
+     9ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     9cd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(i = 0; i < n; i++)
+     9d0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     9d7:	eb 47                	jmp    a20 <randread+0xa4>
+    if(pread(fd, buf, 512, rnd(FILESIZE/512)*512) != 512)
+     9d9:	83 ec 0c             	sub    $0xc,%esp
+     9dc:	68 80 00 00 00       	push   $0x80
+     9e1:	e8 93 f7 ff ff       	call   179 <rnd>
+     9e6:	83 c4 10             	add    $0x10,%esp
+     9e9:	c1 e0 09             	shl    $0x9,%eax
+     9ec:	50                   	push   %eax
+     9ed:	68 00 02 00 00       	push   $0x200
+     9f2:	68 e0 20 00 00       	push   $0x20e0
+     9f7:	ff 75 ec             	push   -0x14(%ebp)
+     9fa:	e8 30 0a 00 00       	call   142f <pread>
+     9ff:	83 c4 10             	add    $0x10,%esp
+     a02:	3d 00 02 00 00       	cmp    $0x200,%eax
+     a07:	74 13                	je     a1c <randread+0xa0>
+      fail(name, "pread");
+     a09:	83 ec 08             	sub    $0x8,%esp
+     a0c:	68 9e 19 00 00       	push   $0x199e
+     a11:	ff 75 08             	push   0x8(%ebp)
+     a14:	e8 40 f7 ff ff       	call   159 <fail>
+     a19:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+     a1c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     a20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a23:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     a26:	7c b1                	jl     9d9 <randread+0x5d>
+  t = rdtsc() - t;
+     a28:	e8 d3 f5 ff ff       	call   0 <rdtsc>
+     a2d:	2b 45 e0             	sub    -0x20(%ebp),%eax
+     a30:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+     a33:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     a36:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  close(fd);
+     a39:	83 ec 0c             	sub    $0xc,%esp
+     a3c:	ff 75 ec             	push   -0x14(%ebp)
+     a3f:	e8 53 09 00 00       	call   1397 <close>
+     a44:	83 c4 10             	add    $0x10,%esp
+  report(name, n, t, "block");
+     a47:	83 ec 0c             	sub    $0xc,%esp
+     a4a:	68 a4 19 00 00       	push   $0x19a4
+     a4f:	ff 75 e4             	push   -0x1c(%ebp)
+     a52:	ff 75 e0             	push   -0x20(%ebp)
+     a55:	ff 75 f0             	push   -0x10(%ebp)
+     a58:	ff 75 08             	push   0x8(%ebp)
+     a5b:	e8 b3 f6 ff ff       	call   113 <report>
+     a60:	83 c4 20             	add    $0x20,%esp
+}
+     a63:	90                   	nop
+     a64:	c9                   	leave
+     a65:	c3                   	ret
+
+00000a66 <randwrite>:
+
+void
+randwrite(char *name)
+{
+     a66:	55                   	push   %ebp
+     a67:	89 e5                	mov    %esp,%ebp
+     a69:	83 ec 28             	sub    $0x28,%esp
+  int fd, i, n;
+  u64 t;
+
+  n = 256;
+     a6c:	c7 45 f0 00 01 00 00 	movl   $0x100,-0x10(%ebp)
+  needfile(name);
+     a73:	83 ec 0c             	sub    $0xc,%esp
+     a76:	ff 75 08             	push   0x8(%ebp)
+     a79:	e8 73 fd ff ff       	call   7f1 <needfile>
+     a7e:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(FILE, O_RDWR)) < 0)
+     a81:	83 ec 08             	sub    $0x8,%esp
+     a84:	6a 02                	push   $0x2
+     a86:	68 82 19 00 00       	push   $0x1982
+     a8b:	e8 1f 09 00 00       	call   13af <open>
+     a90:	83 c4 10             	add    $0x10,%esp
+     a93:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     a96:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     a9a:	79 13                	jns    aaf <randwrite+0x49>
+    fail(name, "open");
+     a9c:	83 ec 08             	sub    $0x8,%esp
+     a9f:	68 99 19 00 00       	push   $0x1999
+     aa4:	ff 75 08             	push   0x8(%ebp)
+     aa7:	e8 ad f6 ff ff       	call   159 <fail>
+     aac:	83 c4 10             	add    $0x10,%esp
+  t = rdtsc();
+     aaf:	e8 4c f5 ff ff       	call   0 <rdtsc>
+     ab4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     ab7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  for(i = 0; i < n; i++)
+     aba:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ac1:	eb 47                	jmp    b0a <randwrite+0xa4>
+    if(pwrite(fd, buf, 512, rnd(FILESIZE/512)*512) != 512)
+     ac3:	83 ec 0c             	sub    $0xc,%esp
+     ac6:	68 80 00 00 00       	push   $0x80
+     acb:	e8 a9 f6 ff ff       	call   179 <rnd>
+     ad0:	83 c4 10             	add    $0x10,%esp
+     ad3:	c1 e0 09             	shl    $0x9,%eax
+     ad6:	50                   	push   %eax
+     ad7:	68 00 02 00 00       	push   $0x200
+     adc:	68 e0 20 00 00       	push   $0x20e0
+     ae1:	ff 75 ec             	push   -0x14(%ebp)
+     ae4:	e8 8e 09 00 00       	call   1477 <pwrite>
+     ae9:	83 c4 10             	add    $0x10,%esp
+     aec:	3d 00 02 00 00       	cmp    $0x200,%eax
+     af1:	74 13                	je     b06 <randwrite+0xa0>
+      fail(name, "pwrite");
+     af3:	83 ec 08             	sub    $0x8,%esp
+     af6:	68 aa 19 00 00       	push   $0x19aa
+     afb:	ff 75 08             	push   0x8(%ebp)
+     afe:	e8 56 f6 ff ff       	call   159 <fail>
+     b03:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+     b06:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     b0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b0d:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     b10:	7c b1                	jl     ac3 <randwrite+0x5d>
+  t = rdtsc() - t;
+     b12:	e8 e9 f4 ff ff       	call   0 <rdtsc>
+     b17:	2b 45 e0             	sub    -0x20(%ebp),%eax
+     b1a:	1b 55 e4             	sbb    -0x1c(%ebp),%edx
+     b1d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     b20:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  close(fd);
+     b23:	83 ec 0c             	sub    $0xc,%esp
+     b26:	ff 75 ec             	push   -0x14(%ebp)
+     b29:	e8 69 08 00 00       	call   1397 <close>
+     b2e:	83 c4 10             	add    $0x10,%esp
+  report(name, n, t, "block");
+     b31:	83 ec 0c             	sub    $0xc,%esp
+     b34:	68 a4 19 00 00       	push   $0x19a4
+     b39:	ff 75 e4             	push   -0x1c(%ebp)
+     b3c:	ff 75 e0             	push   -0x20(%ebp)
+     b3f:	ff 75 f0             	push   -0x10(%ebp)
+     b42:	ff 75 08             	push   0x8(%ebp)
+     b45:	e8 c9 f5 ff ff       	call   113 <report>
+     b4a:	83 c4 20             	add    $0x20,%esp
+}
+     b4d:	90                   	nop
+     b4e:	c9                   	leave
+     b4f:	c3                   	ret
+
+00000b50 <copyrange>:
+
+// Copy FILE in the kernel: at offset 0 its blocks are shared,
+// at offset 1 they are copied.
+void
+copyrange(char *name, int off)
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	83 ec 18             	sub    $0x18,%esp
+  int in, out;
+  u64 t;
+
+  needfile(name);
+     b56:	83 ec 0c             	sub    $0xc,%esp
+     b59:	ff 75 08             	push   0x8(%ebp)
+     b5c:	e8 90 fc ff ff       	call   7f1 <needfile>
+     b61:	83 c4 10             	add    $0x10,%esp
+  unlink("benchcopy");
+     b64:	83 ec 0c             	sub    $0xc,%esp
+     b67:	68 b1 19 00 00       	push   $0x19b1
+     b6c:	e8 4e 08 00 00       	call   13bf <unlink>
+     b71:	83 c4 10             	add    $0x10,%esp
+  if((in = open(FILE, O_RDONLY)) < 0 || (out = open("benchcopy", O_CREATE|O_RDWR)) < 0)
+     b74:	83 ec 08             	sub    $0x8,%esp
+     b77:	6a 00                	push   $0x0
+     b79:	68 82 19 00 00       	push   $0x1982
+     b7e:	e8 2c 08 00 00       	call   13af <open>
+     b83:	83 c4 10             	add    $0x10,%esp
+     b86:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     b89:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     b8d:	78 1e                	js     bad <copyrange+0x5d>
+     b8f:	83 ec 08             	sub    $0x8,%esp
+     b92:	68 02 02 00 00       	push   $0x202
+     b97:	68 b1 19 00 00       	push   $0x19b1
+     b9c:	e8 0e 08 00 00       	call   13af <open>
+     ba1:	83 c4 10             	add    $0x10,%esp
+     ba4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ba7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     bab:	79 13                	jns    bc0 <copyrange+0x70>
+    fail(name, "open");
+     bad:	83 ec 08             	sub    $0x8,%esp
+     bb0:	68 99 19 00 00       	push   $0x1999
+     bb5:	ff 75 08             	push   0x8(%ebp)
+     bb8:	e8 9c f5 ff ff       	call   159 <fail>
+     bbd:	83 c4 10             	add    $0x10,%esp
+  t = rdtsc();
+     bc0:	e8 3b f4 ff ff       	call   0 <rdtsc>
+     bc5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     bc8:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  if(copyfilerange(in, 0, out, off, FILESIZE) != FILESIZE)
+     bcb:	83 ec 0c             	sub    $0xc,%esp
+     bce:	68 00 00 01 00       	push   $0x10000
+     bd3:	ff 75 0c             	push   0xc(%ebp)
+     bd6:	ff 75 f4             	push   -0xc(%ebp)
+     bd9:	6a 00                	push   $0x0
+     bdb:	ff 75 f0             	push   -0x10(%ebp)
+     bde:	e8 a4 08 00 00       	call   1487 <copyfilerange>
+     be3:	83 c4 20             	add    $0x20,%esp
+     be6:	3d 00 00 01 00       	cmp    $0x10000,%eax
+     beb:	74 13                	je     c00 <copyrange+0xb0>
+    fail(name, "copyfilerange");
+     bed:	83 ec 08             	sub    $0x8,%esp
+     bf0:	68 bb 19 00 00       	push   $0x19bb
+     bf5:	ff 75 08             	push   0x8(%ebp)
+     bf8:	e8 5c f5 ff ff       	call   159 <fail>
+     bfd:	83 c4 10             	add    $0x10,%esp
+  t = rdtsc() - t;
+     c00:	e8 fb f3 ff ff       	call   0 <rdtsc>
+     c05:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     c08:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     c0b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     c0e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  close(in);
+     c11:	83 ec 0c             	sub    $0xc,%esp
+     c14:	ff 75 f0             	push   -0x10(%ebp)
+     c17:	e8 7b 07 00 00       	call   1397 <close>
+     c1c:	83 c4 10             	add    $0x10,%esp
+  close(out);
+     c1f:	83 ec 0c             	sub    $0xc,%esp
+     c22:	ff 75 f4             	push   -0xc(%ebp)
+     c25:	e8 6d 07 00 00       	call   1397 <close>
+     c2a:	83 c4 10             	add    $0x10,%esp
+  unlink("benchcopy");
+     c2d:	83 ec 0c             	sub    $0xc,%esp
+     c30:	68 b1 19 00 00       	push   $0x19b1
+     c35:	e8 85 07 00 00       	call   13bf <unlink>
+     c3a:	83 c4 10             	add    $0x10,%esp
+  report(name, FILESIZE/1024, t, "KB");
+     c3d:	83 ec 0c             	sub    $0xc,%esp
+     c40:	68 6e 19 00 00       	push   $0x196e
+     c45:	ff 75 ec             	push   -0x14(%ebp)
+     c48:	ff 75 e8             	push   -0x18(%ebp)
+     c4b:	6a 40                	push   $0x40
+     c4d:	ff 75 08             	push   0x8(%ebp)
+     c50:	e8 be f4 ff ff       	call   113 <report>
+     c55:	83 c4 20             	add    $0x20,%esp
+}
+     c58:	90                   	nop
+     c59:	c9                   	leave
+     c5a:	c3                   	ret
+
+00000c5b <clone>:
+
+void
+clone(char *name)
+{
+     c5b:	55                   	push   %ebp
+     c5c:	89 e5                	mov    %esp,%ebp
+     c5e:	83 ec 08             	sub    $0x8,%esp
+  copyrange(name, 0);
+     c61:	83 ec 08             	sub    $0x8,%esp
+     c64:	6a 00                	push   $0x0
+     c66:	ff 75 08             	push   0x8(%ebp)
+     c69:	e8 e2 fe ff ff       	call   b50 <copyrange>
+     c6e:	83 c4 10             	add    $0x10,%esp
+}
+     c71:	90                   	nop
+     c72:	c9                   	leave
+     c73:	c3                   	ret
+
+00000c74 <copy>:
+
+void
+copy(char *name)
+{
+     c74:	55                   	push   %ebp
+     c75:	89 e5                	mov    %esp,%ebp
+     c77:	83 ec 08             	sub    $0x8,%esp
+  copyrange(name, 1);
+     c7a:	83 ec 08             	sub    $0x8,%esp
+     c7d:	6a 01                	push   $0x1
+     c7f:	ff 75 08             	push   0x8(%ebp)
+     c82:	e8 c9 fe ff ff       	call   b50 <copyrange>
+     c87:	83 c4 10             	add    $0x10,%esp
+}
+     c8a:	90                   	nop
+     c8b:	c9                   	leave
+     c8c:	c3                   	ret
+
+00000c8d <zread>:
+
+// seqread of FILE compressed.  FILE is left compressed, so it
+// is removed for the benchmarks after.
+void
+zread(char *name)
+{
+     c8d:	55                   	push   %ebp
+     c8e:	89 e5                	mov    %esp,%ebp
+     c90:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  needfile(name);
+     c93:	83 ec 0c             	sub    $0xc,%esp
+     c96:	ff 75 08             	push   0x8(%ebp)
+     c99:	e8 53 fb ff ff       	call   7f1 <needfile>
+     c9e:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(FILE, O_RDWR)) < 0 || fsctl(fd, FS_COMPRESS, 0) < 0)
+     ca1:	83 ec 08             	sub    $0x8,%esp
+     ca4:	6a 02                	push   $0x2
+     ca6:	68 82 19 00 00       	push   $0x1982
+     cab:	e8 ff 06 00 00       	call   13af <open>
+     cb0:	83 c4 10             	add    $0x10,%esp
+     cb3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     cb6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     cba:	78 16                	js     cd2 <zread+0x45>
+     cbc:	83 ec 04             	sub    $0x4,%esp
+     cbf:	6a 00                	push   $0x0
+     cc1:	6a 03                	push   $0x3
+     cc3:	ff 75 f4             	push   -0xc(%ebp)
+     cc6:	e8 c4 07 00 00       	call   148f <fsctl>
+     ccb:	83 c4 10             	add    $0x10,%esp
+     cce:	85 c0                	test   %eax,%eax
+     cd0:	79 13                	jns    ce5 <zread+0x58>
+    fail(name, "compress");
+     cd2:	83 ec 08             	sub    $0x8,%esp
+     cd5:	68 c9 19 00 00       	push   $0x19c9
+     cda:	ff 75 08             	push   0x8(%ebp)
+     cdd:	e8 77 f4 ff ff       	call   159 <fail>
+     ce2:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     ce5:	83 ec 0c             	sub    $0xc,%esp
+     ce8:	ff 75 f4             	push   -0xc(%ebp)
+     ceb:	e8 a7 06 00 00       	call   1397 <close>
+     cf0:	83 c4 10             	add    $0x10,%esp
+  seqread(name);
+     cf3:	83 ec 0c             	sub    $0xc,%esp
+     cf6:	ff 75 08             	push   0x8(%ebp)
+     cf9:	e8 b2 fb ff ff       	call   8b0 <seqread>
+     cfe:	83 c4 10             	add    $0x10,%esp
+  unlink(FILE);
+     d01:	83 ec 0c             	sub    $0xc,%esp
+     d04:	68 82 19 00 00       	push   $0x1982
+     d09:	e8 b1 06 00 00       	call   13bf <unlink>
+     d0e:	83 c4 10             	add    $0x10,%esp
+}
+     d11:	90                   	nop
+     d12:	c9                   	leave
+     d13:	c3                   	ret
+
+00000d14 <createunlink>:
+
+void
+createunlink(char *name)
+{
+     d14:	55                   	push   %ebp
+     d15:	89 e5                	mov    %esp,%ebp
+     d17:	83 ec 48             	sub    $0x48,%esp
+  char file[8];
+  int i, n, fd;
+  u64 t, c, u;
+
+  n = 100;
+     d1a:	c7 45 dc 64 00 00 00 	movl   $0x64,-0x24(%ebp)
+  file[0] = 'b';
+     d21:	c6 45 c4 62          	movb   $0x62,-0x3c(%ebp)
+  file[3] = 0;
+     d25:	c6 45 c7 00          	movb   $0x0,-0x39(%ebp)
+  c = u = 0;
+     d29:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     d30:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     d37:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     d3a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     d3d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     d40:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  for(i = 0; i < n; i++){
+     d43:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d4a:	e9 a7 00 00 00       	jmp    df6 <createunlink+0xe2>
+    file[1] = '0' + i/10;
+     d4f:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     d52:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     d57:	89 c8                	mov    %ecx,%eax
+     d59:	f7 ea                	imul   %edx
+     d5b:	c1 fa 02             	sar    $0x2,%edx
+     d5e:	89 c8                	mov    %ecx,%eax
+     d60:	c1 f8 1f             	sar    $0x1f,%eax
+     d63:	29 c2                	sub    %eax,%edx
+     d65:	89 d0                	mov    %edx,%eax
+     d67:	83 c0 30             	add    $0x30,%eax
+     d6a:	88 45 c5             	mov    %al,-0x3b(%ebp)
+    file[2] = '0' + i%10;
+     d6d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     d70:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     d75:	89 c8                	mov    %ecx,%eax
+     d77:	f7 ea                	imul   %edx
+     d79:	c1 fa 02             	sar    $0x2,%edx
+     d7c:	89 c8                	mov    %ecx,%eax
+     d7e:	c1 f8 1f             	sar    $0x1f,%eax
+     d81:	29 c2                	sub    %eax,%edx
+     d83:	89 d0                	mov    %edx,%eax
+     d85:	c1 e0 02             	shl    $0x2,%eax
+     d88:	01 d0                	add    %edx,%eax
+     d8a:	01 c0                	add    %eax,%eax
+     d8c:	29 c1                	sub    %eax,%ecx
+     d8e:	89 ca                	mov    %ecx,%edx
+     d90:	89 d0                	mov    %edx,%eax
+     d92:	83 c0 30             	add    $0x30,%eax
+     d95:	88 45 c6             	mov    %al,-0x3a(%ebp)
+    t = rdtsc();
+     d98:	e8 63 f2 ff ff       	call   0 <rdtsc>
+     d9d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     da0:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    if((fd = open(file, O_CREATE|O_RDWR)) < 0)
+     da3:	83 ec 08             	sub    $0x8,%esp
+     da6:	68 02 02 00 00       	push   $0x202
+     dab:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     dae:	50                   	push   %eax
+     daf:	e8 fb 05 00 00       	call   13af <open>
+     db4:	83 c4 10             	add    $0x10,%esp
+     db7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+     dba:	83 7d cc 00          	cmpl   $0x0,-0x34(%ebp)
+     dbe:	79 13                	jns    dd3 <createunlink+0xbf>
+      fail(name, "create");
+     dc0:	83 ec 08             	sub    $0x8,%esp
+     dc3:	68 8c 19 00 00       	push   $0x198c
+     dc8:	ff 75 08             	push   0x8(%ebp)
+     dcb:	e8 89 f3 ff ff       	call   159 <fail>
+     dd0:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     dd3:	83 ec 0c             	sub    $0xc,%esp
+     dd6:	ff 75 cc             	push   -0x34(%ebp)
+     dd9:	e8 b9 05 00 00       	call   1397 <close>
+     dde:	83 c4 10             	add    $0x10,%esp
+    c += rdtsc() - t;
+     de1:	e8 1a f2 ff ff       	call   0 <rdtsc>
+     de6:	2b 45 d0             	sub    -0x30(%ebp),%eax
+     de9:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+     dec:	01 45 e8             	add    %eax,-0x18(%ebp)
+     def:	11 55 ec             	adc    %edx,-0x14(%ebp)
+  for(i = 0; i < n; i++){
+     df2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     df6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     df9:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+     dfc:	0f 8c 4d ff ff ff    	jl     d4f <createunlink+0x3b>
+  }
+  for(i = 0; i < n; i++){
+     e02:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     e09:	e9 8f 00 00 00       	jmp    e9d <createunlink+0x189>
+    file[1] = '0' + i/10;
+     e0e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     e11:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     e16:	89 c8                	mov    %ecx,%eax
+     e18:	f7 ea                	imul   %edx
+     e1a:	c1 fa 02             	sar    $0x2,%edx
+     e1d:	89 c8                	mov    %ecx,%eax
+     e1f:	c1 f8 1f             	sar    $0x1f,%eax
+     e22:	29 c2                	sub    %eax,%edx
+     e24:	89 d0                	mov    %edx,%eax
+     e26:	83 c0 30             	add    $0x30,%eax
+     e29:	88 45 c5             	mov    %al,-0x3b(%ebp)
+    file[2] = '0' + i%10;
+     e2c:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     e2f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     e34:	89 c8                	mov    %ecx,%eax
+     e36:	f7 ea                	imul   %edx
+     e38:	c1 fa 02             	sar    $0x2,%edx
+     e3b:	89 c8                	mov    %ecx,%eax
+     e3d:	c1 f8 1f             	sar    $0x1f,%eax
+     e40:	29 c2                	sub    %eax,%edx
+     e42:	89 d0                	mov    %edx,%eax
+     e44:	c1 e0 02             	shl    $0x2,%eax
+     e47:	01 d0                	add    %edx,%eax
+     e49:	01 c0                	add    %eax,%eax
+     e4b:	29 c1                	sub    %eax,%ecx
+     e4d:	89 ca                	mov    %ecx,%edx
+     e4f:	89 d0                	mov    %edx,%eax
+     e51:	83 c0 30             	add    $0x30,%eax
+     e54:	88 45 c6             	mov    %al,-0x3a(%ebp)
+    t = rdtsc();
+     e57:	e8 a4 f1 ff ff       	call   0 <rdtsc>
+     e5c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     e5f:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    if(unlink(file) < 0)
+     e62:	83 ec 0c             	sub    $0xc,%esp
+     e65:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     e68:	50                   	push   %eax
+     e69:	e8 51 05 00 00       	call   13bf <unlink>
+     e6e:	83 c4 10             	add    $0x10,%esp
+     e71:	85 c0                	test   %eax,%eax
+     e73:	79 13                	jns    e88 <createunlink+0x174>
+      fail(name, "unlink");
+     e75:	83 ec 08             	sub    $0x8,%esp
+     e78:	68 d2 19 00 00       	push   $0x19d2
+     e7d:	ff 75 08             	push   0x8(%ebp)
+     e80:	e8 d4 f2 ff ff       	call   159 <fail>
+     e85:	83 c4 10             	add    $0x10,%esp
+    u += rdtsc() - t;
+     e88:	e8 73 f1 ff ff       	call   0 <rdtsc>
+     e8d:	2b 45 d0             	sub    -0x30(%ebp),%eax
+     e90:	1b 55 d4             	sbb    -0x2c(%ebp),%edx
+     e93:	01 45 e0             	add    %eax,-0x20(%ebp)
+     e96:	11 55 e4             	adc    %edx,-0x1c(%ebp)
+  for(i = 0; i < n; i++){
+     e99:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ea0:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+     ea3:	0f 8c 65 ff ff ff    	jl     e0e <createunlink+0xfa>
+  }
+  printf(1, "bench %s %d %d create\n", name, n, div64(c, n));
+     ea9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     eac:	83 ec 04             	sub    $0x4,%esp
+     eaf:	50                   	push   %eax
+     eb0:	ff 75 ec             	push   -0x14(%ebp)
+     eb3:	ff 75 e8             	push   -0x18(%ebp)
+     eb6:	e8 5b f1 ff ff       	call   16 <div64>
+     ebb:	83 c4 10             	add    $0x10,%esp
+     ebe:	83 ec 0c             	sub    $0xc,%esp
+     ec1:	50                   	push   %eax
+     ec2:	ff 75 dc             	push   -0x24(%ebp)
+     ec5:	ff 75 08             	push   0x8(%ebp)
+     ec8:	68 d9 19 00 00       	push   $0x19d9
+     ecd:	6a 01                	push   $0x1
+     ecf:	e8 97 06 00 00       	call   156b <printf>
+     ed4:	83 c4 20             	add    $0x20,%esp
+  printf(1, "bench %s %d %d unlink\n", name, n, div64(u, n));
+     ed7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     eda:	83 ec 04             	sub    $0x4,%esp
+     edd:	50                   	push   %eax
+     ede:	ff 75 e4             	push   -0x1c(%ebp)
+     ee1:	ff 75 e0             	push   -0x20(%ebp)
+     ee4:	e8 2d f1 ff ff       	call   16 <div64>
+     ee9:	83 c4 10             	add    $0x10,%esp
+     eec:	83 ec 0c             	sub    $0xc,%esp
+     eef:	50                   	push   %eax
+     ef0:	ff 75 dc             	push   -0x24(%ebp)
+     ef3:	ff 75 08             	push   0x8(%ebp)
+     ef6:	68 f0 19 00 00       	push   $0x19f0
+     efb:	6a 01                	push   $0x1
+     efd:	e8 69 06 00 00       	call   156b <printf>
+     f02:	83 c4 20             	add    $0x20,%esp
+}
+     f05:	90                   	nop
+     f06:	c9                   	leave
+     f07:	c3                   	ret
+
+00000f08 <sbrkgrow>:
+
+void
+sbrkgrow(char *name)
+{
+     f08:	55                   	push   %ebp
+     f09:	89 e5                	mov    %esp,%ebp
+     f0b:	83 ec 18             	sub    $0x18,%esp
+  int i, n;
+  u64 t;
+
+  n = 256;
+     f0e:	c7 45 f0 00 01 00 00 	movl   $0x100,-0x10(%ebp)
+  t = rdtsc();
+     f15:	e8 e6 f0 ff ff       	call   0 <rdtsc>
+     f1a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     f1d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  for(i = 0; i < n; i++)
+     f20:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f27:	eb 2c                	jmp    f55 <sbrkgrow+0x4d>
+    if(sbrk(4096) == (char*)-1)
+     f29:	83 ec 0c             	sub    $0xc,%esp
+     f2c:	68 00 10 00 00       	push   $0x1000
+     f31:	e8 c1 04 00 00       	call   13f7 <sbrk>
+     f36:	83 c4 10             	add    $0x10,%esp
+     f39:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f3c:	75 13                	jne    f51 <sbrkgrow+0x49>
+      fail(name, "sbrk");
+     f3e:	83 ec 08             	sub    $0x8,%esp
+     f41:	68 07 1a 00 00       	push   $0x1a07
+     f46:	ff 75 08             	push   0x8(%ebp)
+     f49:	e8 0b f2 ff ff       	call   159 <fail>
+     f4e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+     f51:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     f55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f58:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     f5b:	7c cc                	jl     f29 <sbrkgrow+0x21>
+  t = rdtsc() - t;
+     f5d:	e8 9e f0 ff ff       	call   0 <rdtsc>
+     f62:	2b 45 e8             	sub    -0x18(%ebp),%eax
+     f65:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+     f68:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     f6b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  sbrk(-n*4096);
+     f6e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     f71:	b8 00 00 00 00       	mov    $0x0,%eax
+     f76:	29 d0                	sub    %edx,%eax
+     f78:	c1 e0 0c             	shl    $0xc,%eax
+     f7b:	83 ec 0c             	sub    $0xc,%esp
+     f7e:	50                   	push   %eax
+     f7f:	e8 73 04 00 00       	call   13f7 <sbrk>
+     f84:	83 c4 10             	add    $0x10,%esp
+  report(name, n, t, "page");
+     f87:	83 ec 0c             	sub    $0xc,%esp
+     f8a:	68 0c 1a 00 00       	push   $0x1a0c
+     f8f:	ff 75 ec             	push   -0x14(%ebp)
+     f92:	ff 75 e8             	push   -0x18(%ebp)
+     f95:	ff 75 f0             	push   -0x10(%ebp)
+     f98:	ff 75 08             	push   0x8(%ebp)
+     f9b:	e8 73 f1 ff ff       	call   113 <report>
+     fa0:	83 c4 20             	add    $0x20,%esp
+}
+     fa3:	90                   	nop
+     fa4:	c9                   	leave
+     fa5:	c3                   	ret
+
+00000fa6 <main>:
+
+#define NBENCH (sizeof(benches)/sizeof(benches[0]))
+
+int
+main(int argc, char *argv[])
+{
+     fa6:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     faa:	83 e4 f0             	and    $0xfffffff0,%esp
+     fad:	ff 71 fc             	push   -0x4(%ecx)
+     fb0:	55                   	push   %ebp
+     fb1:	89 e5                	mov    %esp,%ebp
+     fb3:	53                   	push   %ebx
+     fb4:	51                   	push   %ecx
+     fb5:	83 ec 10             	sub    $0x10,%esp
+     fb8:	89 cb                	mov    %ecx,%ebx
+  int i, j, pid;
+
+  if(argc > 1 && strcmp(argv[1], "-exit") == 0)
+     fba:	83 3b 01             	cmpl   $0x1,(%ebx)
+     fbd:	7e 22                	jle    fe1 <main+0x3b>
+     fbf:	8b 43 04             	mov    0x4(%ebx),%eax
+     fc2:	83 c0 04             	add    $0x4,%eax
+     fc5:	8b 00                	mov    (%eax),%eax
+     fc7:	83 ec 08             	sub    $0x8,%esp
+     fca:	68 59 19 00 00       	push   $0x1959
+     fcf:	50                   	push   %eax
+     fd0:	e8 5b 01 00 00       	call   1130 <strcmp>
+     fd5:	83 c4 10             	add    $0x10,%esp
+     fd8:	85 c0                	test   %eax,%eax
+     fda:	75 05                	jne    fe1 <main+0x3b>
+    exit();
+     fdc:	e8 8e 03 00 00       	call   136f <exit>
+  argv0 = argv[0];
+     fe1:	8b 43 04             	mov    0x4(%ebx),%eax
+     fe4:	8b 00                	mov    (%eax),%eax
+     fe6:	a3 e0 30 00 00       	mov    %eax,0x30e0
+
+  for(i = 0; i < NBENCH; i++){
+     feb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     ff2:	e9 b0 00 00 00       	jmp    10a7 <main+0x101>
+    if(argc > 1){
+     ff7:	83 3b 01             	cmpl   $0x1,(%ebx)
+     ffa:	7e 4a                	jle    1046 <main+0xa0>
+      for(j = 1; j < argc; j++)
+     ffc:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    1003:	eb 30                	jmp    1035 <main+0x8f>
+        if(strcmp(argv[j], benches[i].name) == 0)
+    1005:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1008:	8b 14 c5 40 20 00 00 	mov    0x2040(,%eax,8),%edx
+    100f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1012:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+    1019:	8b 43 04             	mov    0x4(%ebx),%eax
+    101c:	01 c8                	add    %ecx,%eax
+    101e:	8b 00                	mov    (%eax),%eax
+    1020:	83 ec 08             	sub    $0x8,%esp
+    1023:	52                   	push   %edx
+    1024:	50                   	push   %eax
+    1025:	e8 06 01 00 00       	call   1130 <strcmp>
+    102a:	83 c4 10             	add    $0x10,%esp
+    102d:	85 c0                	test   %eax,%eax
+    102f:	74 0d                	je     103e <main+0x98>
+      for(j = 1; j < argc; j++)
+    1031:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1035:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1038:	3b 03                	cmp    (%ebx),%eax
+    103a:	7c c9                	jl     1005 <main+0x5f>
+    103c:	eb 01                	jmp    103f <main+0x99>
+          break;
+    103e:	90                   	nop
+      if(j == argc)
+    103f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1042:	3b 03                	cmp    (%ebx),%eax
+    1044:	74 5c                	je     10a2 <main+0xfc>
+        continue;
+    }
+    // In a child, so that a failure ends only this benchmark.
+    if((pid = fork()) < 0){
+    1046:	e8 1c 03 00 00       	call   1367 <fork>
+    104b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    104e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1052:	79 1f                	jns    1073 <main+0xcd>
+      printf(1, "bench %s: fork failed\n", benches[i].name);
+    1054:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1057:	8b 04 c5 40 20 00 00 	mov    0x2040(,%eax,8),%eax
+    105e:	83 ec 04             	sub    $0x4,%esp
+    1061:	50                   	push   %eax
+    1062:	68 79 1a 00 00       	push   $0x1a79
+    1067:	6a 01                	push   $0x1
+    1069:	e8 fd 04 00 00       	call   156b <printf>
+    106e:	83 c4 10             	add    $0x10,%esp
+      continue;
+    1071:	eb 30                	jmp    10a3 <main+0xfd>
+    }
+    if(pid == 0){
+    1073:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1077:	75 22                	jne    109b <main+0xf5>
+      benches[i].fn(benches[i].name);
+    1079:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    107c:	8b 04 c5 44 20 00 00 	mov    0x2044(,%eax,8),%eax
+    1083:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1086:	8b 14 d5 40 20 00 00 	mov    0x2040(,%edx,8),%edx
+    108d:	83 ec 0c             	sub    $0xc,%esp
+    1090:	52                   	push   %edx
+    1091:	ff d0                	call   *%eax
+    1093:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1096:	e8 d4 02 00 00       	call   136f <exit>
+    }
+    wait();
+    109b:	e8 d7 02 00 00       	call   1377 <wait>
+    10a0:	eb 01                	jmp    10a3 <main+0xfd>
+        continue;
+    10a2:	90                   	nop
+  for(i = 0; i < NBENCH; i++){
+    10a3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    10a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10aa:	83 f8 0f             	cmp    $0xf,%eax
+    10ad:	0f 86 44 ff ff ff    	jbe    ff7 <main+0x51>
+  }
+  unlink(FILE);
+    10b3:	83 ec 0c             	sub    $0xc,%esp
+    10b6:	68 82 19 00 00       	push   $0x1982
+    10bb:	e8 ff 02 00 00       	call   13bf <unlink>
+    10c0:	83 c4 10             	add    $0x10,%esp
+  printf(1, "bench done\n");
+    10c3:	83 ec 08             	sub    $0x8,%esp
+    10c6:	68 90 1a 00 00       	push   $0x1a90
+    10cb:	6a 01                	push   $0x1
+    10cd:	e8 99 04 00 00       	call   156b <printf>
+    10d2:	83 c4 10             	add    $0x10,%esp
+  exit();
+    10d5:	e8 95 02 00 00       	call   136f <exit>
+
+000010da <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+    10da:	55                   	push   %ebp
+    10db:	89 e5                	mov    %esp,%ebp
+    10dd:	57                   	push   %edi
+    10de:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+    10df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    10e2:	8b 55 10             	mov    0x10(%ebp),%edx
+    10e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10e8:	89 cb                	mov    %ecx,%ebx
+    10ea:	89 df                	mov    %ebx,%edi
+    10ec:	89 d1                	mov    %edx,%ecx
+    10ee:	fc                   	cld
+    10ef:	f3 aa                	rep stos %al,%es:(%edi)
+    10f1:	89 ca                	mov    %ecx,%edx
+    10f3:	89 fb                	mov    %edi,%ebx
+    10f5:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    10f8:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    10fb:	90                   	nop
+    10fc:	5b                   	pop    %ebx
+    10fd:	5f                   	pop    %edi
+    10fe:	5d                   	pop    %ebp
+    10ff:	c3                   	ret
+
+00001100 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    1100:	55                   	push   %ebp
+    1101:	89 e5                	mov    %esp,%ebp
+    1103:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+    1106:	8b 45 08             	mov    0x8(%ebp),%eax
+    1109:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    110c:	90                   	nop
+    110d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1110:	8d 42 01             	lea    0x1(%edx),%eax
+    1113:	89 45 0c             	mov    %eax,0xc(%ebp)
+    1116:	8b 45 08             	mov    0x8(%ebp),%eax
+    1119:	8d 48 01             	lea    0x1(%eax),%ecx
+    111c:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    111f:	0f b6 12             	movzbl (%edx),%edx
+    1122:	88 10                	mov    %dl,(%eax)
+    1124:	0f b6 00             	movzbl (%eax),%eax
+    1127:	84 c0                	test   %al,%al
+    1129:	75 e2                	jne    110d <strcpy+0xd>
+    ;
+  return os;
+    112b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    112e:	c9                   	leave
+    112f:	c3                   	ret
+
+00001130 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    1133:	eb 08                	jmp    113d <strcmp+0xd>
+    p++, q++;
+    1135:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    1139:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    113d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1140:	0f b6 00             	movzbl (%eax),%eax
+    1143:	84 c0                	test   %al,%al
+    1145:	74 10                	je     1157 <strcmp+0x27>
+    1147:	8b 45 08             	mov    0x8(%ebp),%eax
+    114a:	0f b6 10             	movzbl (%eax),%edx
+    114d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1150:	0f b6 00             	movzbl (%eax),%eax
+    1153:	38 c2                	cmp    %al,%dl
+    1155:	74 de                	je     1135 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    1157:	8b 45 08             	mov    0x8(%ebp),%eax
+    115a:	0f b6 00             	movzbl (%eax),%eax
+    115d:	0f b6 d0             	movzbl %al,%edx
+    1160:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1163:	0f b6 00             	movzbl (%eax),%eax
+    1166:	0f b6 c0             	movzbl %al,%eax
+    1169:	29 c2                	sub    %eax,%edx
+    116b:	89 d0                	mov    %edx,%eax
+}
+    116d:	5d                   	pop    %ebp
+    116e:	c3                   	ret
+
+0000116f <strlen>:
+
+uint
+strlen(char *s)
+{
+    116f:	55                   	push   %ebp
+    1170:	89 e5                	mov    %esp,%ebp
+    1172:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1175:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    117c:	eb 04                	jmp    1182 <strlen+0x13>
+    117e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1182:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    1185:	8b 45 08             	mov    0x8(%ebp),%eax
+    1188:	01 d0                	add    %edx,%eax
+    118a:	0f b6 00             	movzbl (%eax),%eax
+    118d:	84 c0                	test   %al,%al
+    118f:	75 ed                	jne    117e <strlen+0xf>
+    ;
+  return n;
+    1191:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    1194:	c9                   	leave
+    1195:	c3                   	ret
+
+00001196 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    1196:	55                   	push   %ebp
+    1197:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    1199:	8b 45 10             	mov    0x10(%ebp),%eax
+    119c:	50                   	push   %eax
+    119d:	ff 75 0c             	push   0xc(%ebp)
+    11a0:	ff 75 08             	push   0x8(%ebp)
+    11a3:	e8 32 ff ff ff       	call   10da <stosb>
+    11a8:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    11ab:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    11ae:	c9                   	leave
+    11af:	c3                   	ret
+
+000011b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    11b0:	55                   	push   %ebp
+    11b1:	89 e5                	mov    %esp,%ebp
+    11b3:	83 ec 04             	sub    $0x4,%esp
+    11b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11b9:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    11bc:	eb 14                	jmp    11d2 <strchr+0x22>
+    if(*s == c)
+    11be:	8b 45 08             	mov    0x8(%ebp),%eax
+    11c1:	0f b6 00             	movzbl (%eax),%eax
+    11c4:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    11c7:	75 05                	jne    11ce <strchr+0x1e>
+      return (char*)s;
+    11c9:	8b 45 08             	mov    0x8(%ebp),%eax
+    11cc:	eb 13                	jmp    11e1 <strchr+0x31>
+  for(; *s; s++)
+    11ce:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    11d2:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d5:	0f b6 00             	movzbl (%eax),%eax
+    11d8:	84 c0                	test   %al,%al
+    11da:	75 e2                	jne    11be <strchr+0xe>
+  return 0;
+    11dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    11e1:	c9                   	leave
+    11e2:	c3                   	ret
+
+000011e3 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    11e3:	55                   	push   %ebp
+    11e4:	89 e5                	mov    %esp,%ebp
+    11e6:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    11e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11f0:	eb 42                	jmp    1234 <gets+0x51>
+    cc = read(0, &c, 1);
+    11f2:	83 ec 04             	sub    $0x4,%esp
+    11f5:	6a 01                	push   $0x1
+    11f7:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    11fa:	50                   	push   %eax
+    11fb:	6a 00                	push   $0x0
+    11fd:	e8 85 01 00 00       	call   1387 <read>
+    1202:	83 c4 10             	add    $0x10,%esp
+    1205:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    1208:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    120c:	7e 33                	jle    1241 <gets+0x5e>
+      break;
+    buf[i++] = c;
+    120e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1211:	8d 50 01             	lea    0x1(%eax),%edx
+    1214:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1217:	89 c2                	mov    %eax,%edx
+    1219:	8b 45 08             	mov    0x8(%ebp),%eax
+    121c:	01 c2                	add    %eax,%edx
+    121e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1222:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    1224:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1228:	3c 0a                	cmp    $0xa,%al
+    122a:	74 16                	je     1242 <gets+0x5f>
+    122c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1230:	3c 0d                	cmp    $0xd,%al
+    1232:	74 0e                	je     1242 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    1234:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1237:	83 c0 01             	add    $0x1,%eax
+    123a:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    123d:	7f b3                	jg     11f2 <gets+0xf>
+    123f:	eb 01                	jmp    1242 <gets+0x5f>
+      break;
+    1241:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1242:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1245:	8b 45 08             	mov    0x8(%ebp),%eax
+    1248:	01 d0                	add    %edx,%eax
+    124a:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    124d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1250:	c9                   	leave
+    1251:	c3                   	ret
+
+00001252 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1252:	55                   	push   %ebp
+    1253:	89 e5                	mov    %esp,%ebp
+    1255:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    1258:	83 ec 08             	sub    $0x8,%esp
+    125b:	6a 00                	push   $0x0
+    125d:	ff 75 08             	push   0x8(%ebp)
+    1260:	e8 4a 01 00 00       	call   13af <open>
+    1265:	83 c4 10             	add    $0x10,%esp
+    1268:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    126b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    126f:	79 07                	jns    1278 <stat+0x26>
+    return -1;
+    1271:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1276:	eb 25                	jmp    129d <stat+0x4b>
+  r = fstat(fd, st);
+    1278:	83 ec 08             	sub    $0x8,%esp
+    127b:	ff 75 0c             	push   0xc(%ebp)
+    127e:	ff 75 f4             	push   -0xc(%ebp)
+    1281:	e8 41 01 00 00       	call   13c7 <fstat>
+    1286:	83 c4 10             	add    $0x10,%esp
+    1289:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    128c:	83 ec 0c             	sub    $0xc,%esp
+    128f:	ff 75 f4             	push   -0xc(%ebp)
+    1292:	e8 00 01 00 00       	call   1397 <close>
+    1297:	83 c4 10             	add    $0x10,%esp
+  return r;
+    129a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    129d:	c9                   	leave
+    129e:	c3                   	ret
+
+0000129f <atoi>:
+
+int
+atoi(const char *s)
+{
+    129f:	55                   	push   %ebp
+    12a0:	89 e5                	mov    %esp,%ebp
+    12a2:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    12a5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    12ac:	eb 25                	jmp    12d3 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    12ae:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    12b1:	89 d0                	mov    %edx,%eax
+    12b3:	c1 e0 02             	shl    $0x2,%eax
+    12b6:	01 d0                	add    %edx,%eax
+    12b8:	01 c0                	add    %eax,%eax
+    12ba:	89 c1                	mov    %eax,%ecx
+    12bc:	8b 45 08             	mov    0x8(%ebp),%eax
+    12bf:	8d 50 01             	lea    0x1(%eax),%edx
+    12c2:	89 55 08             	mov    %edx,0x8(%ebp)
+    12c5:	0f b6 00             	movzbl (%eax),%eax
+    12c8:	0f be c0             	movsbl %al,%eax
+    12cb:	01 c8                	add    %ecx,%eax
+    12cd:	83 e8 30             	sub    $0x30,%eax
+    12d0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    12d3:	8b 45 08             	mov    0x8(%ebp),%eax
+    12d6:	0f b6 00             	movzbl (%eax),%eax
+    12d9:	3c 2f                	cmp    $0x2f,%al
+    12db:	7e 0a                	jle    12e7 <atoi+0x48>
+    12dd:	8b 45 08             	mov    0x8(%ebp),%eax
+    12e0:	0f b6 00             	movzbl (%eax),%eax
+    12e3:	3c 39                	cmp    $0x39,%al
+    12e5:	7e c7                	jle    12ae <atoi+0xf>
+  return n;
+    12e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    12ea:	c9                   	leave
+    12eb:	c3                   	ret
+
+000012ec <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    12ec:	55                   	push   %ebp
+    12ed:	89 e5                	mov    %esp,%ebp
+    12ef:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+    12f2:	8b 45 08             	mov    0x8(%ebp),%eax
+    12f5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    12f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12fb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    12fe:	eb 17                	jmp    1317 <memmove+0x2b>
+    *dst++ = *src++;
+    1300:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    1303:	8d 42 01             	lea    0x1(%edx),%eax
+    1306:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    1309:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    130c:	8d 48 01             	lea    0x1(%eax),%ecx
+    130f:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    1312:	0f b6 12             	movzbl (%edx),%edx
+    1315:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    1317:	8b 45 10             	mov    0x10(%ebp),%eax
+    131a:	8d 50 ff             	lea    -0x1(%eax),%edx
+    131d:	89 55 10             	mov    %edx,0x10(%ebp)
+    1320:	85 c0                	test   %eax,%eax
+    1322:	7f dc                	jg     1300 <memmove+0x14>
+  return vdst;
+    1324:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1327:	c9                   	leave
+    1328:	c3                   	ret
+
+00001329 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+    1329:	55                   	push   %ebp
+    132a:	89 e5                	mov    %esp,%ebp
+    132c:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+    132f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1336:	eb 04                	jmp    133c <ncpus+0x13>
+    1338:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    133c:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+    1340:	7f 16                	jg     1358 <ncpus+0x2f>
+    1342:	83 ec 08             	sub    $0x8,%esp
+    1345:	8d 45 8c             	lea    -0x74(%ebp),%eax
+    1348:	50                   	push   %eax
+    1349:	ff 75 f4             	push   -0xc(%ebp)
+    134c:	e8 d6 00 00 00       	call   1427 <intrstat>
+    1351:	83 c4 10             	add    $0x10,%esp
+    1354:	85 c0                	test   %eax,%eax
+    1356:	74 e0                	je     1338 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+    1358:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    135b:	ba 01 00 00 00       	mov    $0x1,%edx
+    1360:	85 c0                	test   %eax,%eax
+    1362:	0f 4e c2             	cmovle %edx,%eax
+}
+    1365:	c9                   	leave
+    1366:	c3                   	ret
+
+00001367 <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+    1367:	b8 01 00 00 00       	mov    $0x1,%eax
+    136c:	cd 40                	int    $0x40
+    136e:	c3                   	ret
+
+0000136f <exit>:
+SYSCALL(exit)
+    136f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1374:	cd 40                	int    $0x40
+    1376:	c3                   	ret
+
+00001377 <wait>:
+SYSCALL(wait)
+    1377:	b8 03 00 00 00       	mov    $0x3,%eax
+    137c:	cd 40                	int    $0x40
+    137e:	c3                   	ret
+
+0000137f <pipe>:
+SYSCALL(pipe)
+    137f:	b8 04 00 00 00       	mov    $0x4,%eax
+    1384:	cd 40                	int    $0x40
+    1386:	c3                   	ret
+
+00001387 <read>:
+SYSCALL(read)
+    1387:	b8 05 00 00 00       	mov    $0x5,%eax
+    138c:	cd 40                	int    $0x40
+    138e:	c3                   	ret
+
+0000138f <write>:
+SYSCALL(write)
+    138f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1394:	cd 40                	int    $0x40
+    1396:	c3                   	ret
+
+00001397 <close>:
+SYSCALL(close)
+    1397:	b8 15 00 00 00       	mov    $0x15,%eax
+    139c:	cd 40                	int    $0x40
+    139e:	c3                   	ret
+
+0000139f <kill>:
+SYSCALL(kill)
+    139f:	b8 06 00 00 00       	mov    $0x6,%eax
+    13a4:	cd 40                	int    $0x40
+    13a6:	c3                   	ret
+
+000013a7 <exec>:
+SYSCALL(exec)
+    13a7:	b8 07 00 00 00       	mov    $0x7,%eax
+    13ac:	cd 40                	int    $0x40
+    13ae:	c3                   	ret
+
+000013af <open>:
+SYSCALL(open)
+    13af:	b8 0f 00 00 00       	mov    $0xf,%eax
+    13b4:	cd 40                	int    $0x40
+    13b6:	c3                   	ret
+
+000013b7 <mknod>:
+SYSCALL(mknod)
+    13b7:	b8 11 00 00 00       	mov    $0x11,%eax
+    13bc:	cd 40                	int    $0x40
+    13be:	c3                   	ret
+
+000013bf <unlink>:
+SYSCALL(unlink)
+    13bf:	b8 12 00 00 00       	mov    $0x12,%eax
+    13c4:	cd 40                	int    $0x40
+    13c6:	c3                   	ret
+
+000013c7 <fstat>:
+SYSCALL(fstat)
+    13c7:	b8 08 00 00 00       	mov    $0x8,%eax
+    13cc:	cd 40                	int    $0x40
+    13ce:	c3                   	ret
+
+000013cf <link>:
+SYSCALL(link)
+    13cf:	b8 13 00 00 00       	mov    $0x13,%eax
+    13d4:	cd 40                	int    $0x40
+    13d6:	c3                   	ret
+
+000013d7 <mkdir>:
+SYSCALL(mkdir)
+    13d7:	b8 14 00 00 00       	mov    $0x14,%eax
+    13dc:	cd 40                	int    $0x40
+    13de:	c3                   	ret
+
+000013df <chdir>:
+SYSCALL(chdir)
+    13df:	b8 09 00 00 00       	mov    $0x9,%eax
+    13e4:	cd 40                	int    $0x40
+    13e6:	c3                   	ret
+
+000013e7 <dup>:
+SYSCALL(dup)
+    13e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+    13ec:	cd 40                	int    $0x40
+    13ee:	c3                   	ret
+
+000013ef <getpid>:
+SYSCALL(getpid)
+    13ef:	b8 0b 00 00 00       	mov    $0xb,%eax
+    13f4:	cd 40                	int    $0x40
+    13f6:	c3                   	ret
+
+000013f7 <sbrk>:
+SYSCALL(sbrk)
+    13f7:	b8 0c 00 00 00       	mov    $0xc,%eax
+    13fc:	cd 40                	int    $0x40
+    13fe:	c3                   	ret
+
+000013ff <sleep>:
+SYSCALL(sleep)
+    13ff:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1404:	cd 40                	int    $0x40
+    1406:	c3                   	ret
+
+00001407 <uptime>:
+SYSCALL(uptime)
+    1407:	b8 0e 00 00 00       	mov    $0xe,%eax
+    140c:	cd 40                	int    $0x40
+    140e:	c3                   	ret
+
+0000140f <poll>:
+SYSCALL(poll)
+    140f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1414:	cd 40                	int    $0x40
+    1416:	c3                   	ret
+
+00001417 <fcntl>:
+SYSCALL(fcntl)
+    1417:	b8 17 00 00 00       	mov    $0x17,%eax
+    141c:	cd 40                	int    $0x40
+    141e:	c3                   	ret
+
+0000141f <irqroute>:
+SYSCALL(irqroute)
+    141f:	b8 18 00 00 00       	mov    $0x18,%eax
+    1424:	cd 40                	int    $0x40
+    1426:	c3                   	ret
+
+00001427 <intrstat>:
+SYSCALL(intrstat)
+    1427:	b8 19 00 00 00       	mov    $0x19,%eax
+    142c:	cd 40                	int    $0x40
+    142e:	c3                   	ret
+
+0000142f <pread>:
+SYSCALL(pread)
+    142f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1434:	cd 40                	int    $0x40
+    1436:	c3                   	ret
+
+00001437 <getdents>:
+SYSCALL(getdents)
+    1437:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    143c:	cd 40                	int    $0x40
+    143e:	c3                   	ret
+
+0000143f <fstatat>:
+SYSCALL(fstatat)
+    143f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1444:	cd 40                	int    $0x40
+    1446:	c3                   	ret
+
+00001447 <openat>:
+SYSCALL(openat)
+    1447:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    144c:	cd 40                	int    $0x40
+    144e:	c3                   	ret
+
+0000144f <unlinkat>:
+SYSCALL(unlinkat)
+    144f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1454:	cd 40                	int    $0x40
+    1456:	c3                   	ret
+
+00001457 <mkdirat>:
+SYSCALL(mkdirat)
+    1457:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    145c:	cd 40                	int    $0x40
+    145e:	c3                   	ret
+
+0000145f <linkat>:
+SYSCALL(linkat)
+    145f:	b8 20 00 00 00       	mov    $0x20,%eax
+    1464:	cd 40                	int    $0x40
+    1466:	c3                   	ret
+
+00001467 <exits>:
+SYSCALL(exits)
+    1467:	b8 21 00 00 00       	mov    $0x21,%eax
+    146c:	cd 40                	int    $0x40
+    146e:	c3                   	ret
+
+0000146f <waitstatus>:
+SYSCALL(waitstatus)
+    146f:	b8 22 00 00 00       	mov    $0x22,%eax
+    1474:	cd 40                	int    $0x40
+    1476:	c3                   	ret
+
+00001477 <pwrite>:
+SYSCALL(pwrite)
+    1477:	b8 23 00 00 00       	mov    $0x23,%eax
+    147c:	cd 40                	int    $0x40
+    147e:	c3                   	ret
+
+0000147f <lseek>:
+SYSCALL(lseek)
+    147f:	b8 24 00 00 00       	mov    $0x24,%eax
+    1484:	cd 40                	int    $0x40
+    1486:	c3                   	ret
+
+00001487 <copyfilerange>:
+SYSCALL(copyfilerange)
+    1487:	b8 25 00 00 00       	mov    $0x25,%eax
+    148c:	cd 40                	int    $0x40
+    148e:	c3                   	ret
+
+0000148f <fsctl>:
+SYSCALL(fsctl)
+    148f:	b8 26 00 00 00       	mov    $0x26,%eax
+    1494:	cd 40                	int    $0x40
+    1496:	c3                   	ret
+
+00001497 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    1497:	55                   	push   %ebp
+    1498:	89 e5                	mov    %esp,%ebp
+    149a:	83 ec 18             	sub    $0x18,%esp
+    149d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14a0:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    14a3:	83 ec 04             	sub    $0x4,%esp
+    14a6:	6a 01                	push   $0x1
+    14a8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    14ab:	50                   	push   %eax
+    14ac:	ff 75 08             	push   0x8(%ebp)
+    14af:	e8 db fe ff ff       	call   138f <write>
+    14b4:	83 c4 10             	add    $0x10,%esp
+}
+    14b7:	90                   	nop
+    14b8:	c9                   	leave
+    14b9:	c3                   	ret
+
+000014ba <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    14ba:	55                   	push   %ebp
+    14bb:	89 e5                	mov    %esp,%ebp
+    14bd:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    14c0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    14c7:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    14cb:	74 17                	je     14e4 <printint+0x2a>
+    14cd:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    14d1:	79 11                	jns    14e4 <printint+0x2a>
+    neg = 1;
+    14d3:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    14da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14dd:	f7 d8                	neg    %eax
+    14df:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    14e2:	eb 06                	jmp    14ea <printint+0x30>
+  } else {
+    x = xx;
+    14e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    14e7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    14ea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    14f1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    14f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    14f7:	ba 00 00 00 00       	mov    $0x0,%edx
+    14fc:	f7 f1                	div    %ecx
+    14fe:	89 d1                	mov    %edx,%ecx
+    1500:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1503:	8d 50 01             	lea    0x1(%eax),%edx
+    1506:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1509:	0f b6 91 c0 20 00 00 	movzbl 0x20c0(%ecx),%edx
+    1510:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    1514:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1517:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    151a:	ba 00 00 00 00       	mov    $0x0,%edx
+    151f:	f7 f1                	div    %ecx
+    1521:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1524:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1528:	75 c7                	jne    14f1 <printint+0x37>
+  if(neg)
+    152a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    152e:	74 2d                	je     155d <printint+0xa3>
+    buf[i++] = '-';
+    1530:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1533:	8d 50 01             	lea    0x1(%eax),%edx
+    1536:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1539:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    153e:	eb 1d                	jmp    155d <printint+0xa3>
+    putc(fd, buf[i]);
+    1540:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    1543:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1546:	01 d0                	add    %edx,%eax
+    1548:	0f b6 00             	movzbl (%eax),%eax
+    154b:	0f be c0             	movsbl %al,%eax
+    154e:	83 ec 08             	sub    $0x8,%esp
+    1551:	50                   	push   %eax
+    1552:	ff 75 08             	push   0x8(%ebp)
+    1555:	e8 3d ff ff ff       	call   1497 <putc>
+    155a:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    155d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    1561:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1565:	79 d9                	jns    1540 <printint+0x86>
+}
+    1567:	90                   	nop
+    1568:	90                   	nop
+    1569:	c9                   	leave
+    156a:	c3                   	ret
+
+0000156b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    156b:	55                   	push   %ebp
+    156c:	89 e5                	mov    %esp,%ebp
+    156e:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    1571:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    1578:	8d 45 0c             	lea    0xc(%ebp),%eax
+    157b:	83 c0 04             	add    $0x4,%eax
+    157e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1581:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1588:	e9 59 01 00 00       	jmp    16e6 <printf+0x17b>
+    c = fmt[i] & 0xff;
+    158d:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1590:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1593:	01 d0                	add    %edx,%eax
+    1595:	0f b6 00             	movzbl (%eax),%eax
+    1598:	0f be c0             	movsbl %al,%eax
+    159b:	25 ff 00 00 00       	and    $0xff,%eax
+    15a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    15a3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    15a7:	75 2c                	jne    15d5 <printf+0x6a>
+      if(c == '%'){
+    15a9:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    15ad:	75 0c                	jne    15bb <printf+0x50>
+        state = '%';
+    15af:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    15b6:	e9 27 01 00 00       	jmp    16e2 <printf+0x177>
+      } else {
+        putc(fd, c);
+    15bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    15be:	0f be c0             	movsbl %al,%eax
+    15c1:	83 ec 08             	sub    $0x8,%esp
+    15c4:	50                   	push   %eax
+    15c5:	ff 75 08             	push   0x8(%ebp)
+    15c8:	e8 ca fe ff ff       	call   1497 <putc>
+    15cd:	83 c4 10             	add    $0x10,%esp
+    15d0:	e9 0d 01 00 00       	jmp    16e2 <printf+0x177>
+      }
+    } else if(state == '%'){
+    15d5:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    15d9:	0f 85 03 01 00 00    	jne    16e2 <printf+0x177>
+      if(c == 'd'){
+    15df:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    15e3:	75 1e                	jne    1603 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    15e5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    15e8:	8b 00                	mov    (%eax),%eax
+    15ea:	6a 01                	push   $0x1
+    15ec:	6a 0a                	push   $0xa
+    15ee:	50                   	push   %eax
+    15ef:	ff 75 08             	push   0x8(%ebp)
+    15f2:	e8 c3 fe ff ff       	call   14ba <printint>
+    15f7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    15fa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    15fe:	e9 d8 00 00 00       	jmp    16db <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    1603:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    1607:	74 06                	je     160f <printf+0xa4>
+    1609:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    160d:	75 1e                	jne    162d <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    160f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1612:	8b 00                	mov    (%eax),%eax
+    1614:	6a 00                	push   $0x0
+    1616:	6a 10                	push   $0x10
+    1618:	50                   	push   %eax
+    1619:	ff 75 08             	push   0x8(%ebp)
+    161c:	e8 99 fe ff ff       	call   14ba <printint>
+    1621:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1624:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1628:	e9 ae 00 00 00       	jmp    16db <printf+0x170>
+      } else if(c == 's'){
+    162d:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    1631:	75 43                	jne    1676 <printf+0x10b>
+        s = (char*)*ap;
+    1633:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1636:	8b 00                	mov    (%eax),%eax
+    1638:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    163b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    163f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1643:	75 25                	jne    166a <printf+0xff>
+          s = "(null)";
+    1645:	c7 45 f4 9c 1a 00 00 	movl   $0x1a9c,-0xc(%ebp)
+        while(*s != 0){
+    164c:	eb 1c                	jmp    166a <printf+0xff>
+          putc(fd, *s);
+    164e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1651:	0f b6 00             	movzbl (%eax),%eax
+    1654:	0f be c0             	movsbl %al,%eax
+    1657:	83 ec 08             	sub    $0x8,%esp
+    165a:	50                   	push   %eax
+    165b:	ff 75 08             	push   0x8(%ebp)
+    165e:	e8 34 fe ff ff       	call   1497 <putc>
+    1663:	83 c4 10             	add    $0x10,%esp
+          s++;
+    1666:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    166a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    166d:	0f b6 00             	movzbl (%eax),%eax
+    1670:	84 c0                	test   %al,%al
+    1672:	75 da                	jne    164e <printf+0xe3>
+    1674:	eb 65                	jmp    16db <printf+0x170>
+        }
+      } else if(c == 'c'){
+    1676:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    167a:	75 1d                	jne    1699 <printf+0x12e>
+        putc(fd, *ap);
+    167c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    167f:	8b 00                	mov    (%eax),%eax
+    1681:	0f be c0             	movsbl %al,%eax
+    1684:	83 ec 08             	sub    $0x8,%esp
+    1687:	50                   	push   %eax
+    1688:	ff 75 08             	push   0x8(%ebp)
+    168b:	e8 07 fe ff ff       	call   1497 <putc>
+    1690:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1693:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1697:	eb 42                	jmp    16db <printf+0x170>
+      } else if(c == '%'){
+    1699:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    169d:	75 17                	jne    16b6 <printf+0x14b>
+        putc(fd, c);
+    169f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    16a2:	0f be c0             	movsbl %al,%eax
+    16a5:	83 ec 08             	sub    $0x8,%esp
+    16a8:	50                   	push   %eax
+    16a9:	ff 75 08             	push   0x8(%ebp)
+    16ac:	e8 e6 fd ff ff       	call   1497 <putc>
+    16b1:	83 c4 10             	add    $0x10,%esp
+    16b4:	eb 25                	jmp    16db <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    16b6:	83 ec 08             	sub    $0x8,%esp
+    16b9:	6a 25                	push   $0x25
+    16bb:	ff 75 08             	push   0x8(%ebp)
+    16be:	e8 d4 fd ff ff       	call   1497 <putc>
+    16c3:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    16c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    16c9:	0f be c0             	movsbl %al,%eax
+    16cc:	83 ec 08             	sub    $0x8,%esp
+    16cf:	50                   	push   %eax
+    16d0:	ff 75 08             	push   0x8(%ebp)
+    16d3:	e8 bf fd ff ff       	call   1497 <putc>
+    16d8:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    16db:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    16e2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    16e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+    16e9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    16ec:	01 d0                	add    %edx,%eax
+    16ee:	0f b6 00             	movzbl (%eax),%eax
+    16f1:	84 c0                	test   %al,%al
+    16f3:	0f 85 94 fe ff ff    	jne    158d <printf+0x22>
+    }
+  }
+}
+    16f9:	90                   	nop
+    16fa:	90                   	nop
+    16fb:	c9                   	leave
+    16fc:	c3                   	ret
+
+000016fd <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    16fd:	55                   	push   %ebp
+    16fe:	89 e5                	mov    %esp,%ebp
+    1700:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1703:	8b 45 08             	mov    0x8(%ebp),%eax
+    1706:	83 e8 08             	sub    $0x8,%eax
+    1709:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    170c:	a1 ec 30 00 00       	mov    0x30ec,%eax
+    1711:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1714:	eb 24                	jmp    173a <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1716:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1719:	8b 00                	mov    (%eax),%eax
+    171b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    171e:	72 12                	jb     1732 <free+0x35>
+    1720:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1723:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1726:	72 24                	jb     174c <free+0x4f>
+    1728:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    172b:	8b 00                	mov    (%eax),%eax
+    172d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1730:	72 1a                	jb     174c <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1732:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1735:	8b 00                	mov    (%eax),%eax
+    1737:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    173a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    173d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1740:	73 d4                	jae    1716 <free+0x19>
+    1742:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1745:	8b 00                	mov    (%eax),%eax
+    1747:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    174a:	73 ca                	jae    1716 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    174c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    174f:	8b 40 04             	mov    0x4(%eax),%eax
+    1752:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1759:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    175c:	01 c2                	add    %eax,%edx
+    175e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1761:	8b 00                	mov    (%eax),%eax
+    1763:	39 c2                	cmp    %eax,%edx
+    1765:	75 24                	jne    178b <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    1767:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    176a:	8b 50 04             	mov    0x4(%eax),%edx
+    176d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1770:	8b 00                	mov    (%eax),%eax
+    1772:	8b 40 04             	mov    0x4(%eax),%eax
+    1775:	01 c2                	add    %eax,%edx
+    1777:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    177a:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    177d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1780:	8b 00                	mov    (%eax),%eax
+    1782:	8b 10                	mov    (%eax),%edx
+    1784:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1787:	89 10                	mov    %edx,(%eax)
+    1789:	eb 0a                	jmp    1795 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    178b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    178e:	8b 10                	mov    (%eax),%edx
+    1790:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1793:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    1795:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1798:	8b 40 04             	mov    0x4(%eax),%eax
+    179b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    17a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    17a5:	01 d0                	add    %edx,%eax
+    17a7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    17aa:	75 20                	jne    17cc <free+0xcf>
+    p->s.size += bp->s.size;
+    17ac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    17af:	8b 50 04             	mov    0x4(%eax),%edx
+    17b2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    17b5:	8b 40 04             	mov    0x4(%eax),%eax
+    17b8:	01 c2                	add    %eax,%edx
+    17ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    17bd:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    17c0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    17c3:	8b 10                	mov    (%eax),%edx
+    17c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    17c8:	89 10                	mov    %edx,(%eax)
+    17ca:	eb 08                	jmp    17d4 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    17cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    17cf:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    17d2:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    17d4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    17d7:	a3 ec 30 00 00       	mov    %eax,0x30ec
+}
+    17dc:	90                   	nop
+    17dd:	c9                   	leave
+    17de:	c3                   	ret
+
+000017df <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    17df:	55                   	push   %ebp
+    17e0:	89 e5                	mov    %esp,%ebp
+    17e2:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    17e5:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    17ec:	77 07                	ja     17f5 <morecore+0x16>
+    nu = 4096;
+    17ee:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    17f5:	8b 45 08             	mov    0x8(%ebp),%eax
+    17f8:	c1 e0 03             	shl    $0x3,%eax
+    17fb:	83 ec 0c             	sub    $0xc,%esp
+    17fe:	50                   	push   %eax
+    17ff:	e8 f3 fb ff ff       	call   13f7 <sbrk>
+    1804:	83 c4 10             	add    $0x10,%esp
+    1807:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    180a:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    180e:	75 07                	jne    1817 <morecore+0x38>
+    return 0;
+    1810:	b8 00 00 00 00       	mov    $0x0,%eax
+    1815:	eb 26                	jmp    183d <morecore+0x5e>
+  hp = (Header*)p;
+    1817:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    181a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    181d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1820:	8b 55 08             	mov    0x8(%ebp),%edx
+    1823:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    1826:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1829:	83 c0 08             	add    $0x8,%eax
+    182c:	83 ec 0c             	sub    $0xc,%esp
+    182f:	50                   	push   %eax
+    1830:	e8 c8 fe ff ff       	call   16fd <free>
+    1835:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    1838:	a1 ec 30 00 00       	mov    0x30ec,%eax
+}
+    183d:	c9                   	leave
+    183e:	c3                   	ret
+
+0000183f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    183f:	55                   	push   %ebp
+    1840:	89 e5                	mov    %esp,%ebp
+    1842:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1845:	8b 45 08             	mov    0x8(%ebp),%eax
+    1848:	83 c0 07             	add    $0x7,%eax
+    184b:	c1 e8 03             	shr    $0x3,%eax
+    184e:	83 c0 01             	add    $0x1,%eax
+    1851:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    1854:	a1 ec 30 00 00       	mov    0x30ec,%eax
+    1859:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    185c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1860:	75 23                	jne    1885 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    1862:	c7 45 f0 e4 30 00 00 	movl   $0x30e4,-0x10(%ebp)
+    1869:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    186c:	a3 ec 30 00 00       	mov    %eax,0x30ec
+    1871:	a1 ec 30 00 00       	mov    0x30ec,%eax
+    1876:	a3 e4 30 00 00       	mov    %eax,0x30e4
+    base.s.size = 0;
+    187b:	c7 05 e8 30 00 00 00 	movl   $0x0,0x30e8
+    1882:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1885:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1888:	8b 00                	mov    (%eax),%eax
+    188a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    188d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1890:	8b 40 04             	mov    0x4(%eax),%eax
+    1893:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    1896:	72 4d                	jb     18e5 <malloc+0xa6>
+      if(p->s.size == nunits)
+    1898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    189b:	8b 40 04             	mov    0x4(%eax),%eax
+    189e:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    18a1:	75 0c                	jne    18af <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    18a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18a6:	8b 10                	mov    (%eax),%edx
+    18a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    18ab:	89 10                	mov    %edx,(%eax)
+    18ad:	eb 26                	jmp    18d5 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    18af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18b2:	8b 40 04             	mov    0x4(%eax),%eax
+    18b5:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    18b8:	89 c2                	mov    %eax,%edx
+    18ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18bd:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    18c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18c3:	8b 40 04             	mov    0x4(%eax),%eax
+    18c6:	c1 e0 03             	shl    $0x3,%eax
+    18c9:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    18cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18cf:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    18d2:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    18d5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    18d8:	a3 ec 30 00 00       	mov    %eax,0x30ec
+      return (void*)(p + 1);
+    18dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18e0:	83 c0 08             	add    $0x8,%eax
+    18e3:	eb 3b                	jmp    1920 <malloc+0xe1>
+    }
+    if(p == freep)
+    18e5:	a1 ec 30 00 00       	mov    0x30ec,%eax
+    18ea:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    18ed:	75 1e                	jne    190d <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    18ef:	83 ec 0c             	sub    $0xc,%esp
+    18f2:	ff 75 ec             	push   -0x14(%ebp)
+    18f5:	e8 e5 fe ff ff       	call   17df <morecore>
+    18fa:	83 c4 10             	add    $0x10,%esp
+    18fd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1900:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1904:	75 07                	jne    190d <malloc+0xce>
+        return 0;
+    1906:	b8 00 00 00 00       	mov    $0x0,%eax
+    190b:	eb 13                	jmp    1920 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    190d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1910:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1913:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1916:	8b 00                	mov    (%eax),%eax
+    1918:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    191b:	e9 6d ff ff ff       	jmp    188d <malloc+0x4e>
+  }
+}
+    1920:	c9                   	leave
+    1921:	c3                   	ret
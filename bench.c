@@ -0,0 +1,482 @@
+// Micro-benchmarks.
+//   bench [name ...]
+// Runs every benchmark below, or just the named ones, timing
+// each with the cycle counter.  Every result is one line
+//   bench <name> <count> <cycles> <unit>
+// meaning <cycles> per <unit>, averaged over <count> units, so
+// that the output of "make bench" can be compared by a script.
+// "bench tsc <ticks> <cycles> tick" calibrates against the
+// timer so that cycles can be turned into time.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fsctl.h"
+
+typedef unsigned long long u64;
+
+#define FILE "benchfile"
+#define FILESIZE (64*1024)
+
+char buf[4096];
+char *argv0;
+
+static inline u64
+rdtsc(void)
+{
+  u64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+  return t;
+}
+
+// a/b without libgcc's 64-bit division.
+uint
+div64(u64 a, uint b)
+{
+  u64 q, r;
+  int i;
+
+  q = r = 0;
+  for(i = 63; i >= 0; i--){
+    r = r << 1 | ((a >> i) & 1);
+    if(r >= b){
+      r -= b;
+      q |= (u64)1 << i;
+    }
+  }
+  return q > 0xffffffff ? 0xffffffff : q;
+}
+
+void
+report(char *name, int n, u64 t, char *unit)
+{
+  printf(1, "bench %s %d %d %s\n", name, n, div64(t, n), unit);
+}
+
+// Give up on this benchmark.  main runs each one in a process
+// of its own, so the rest still run.
+void
+fail(char *name, char *what)
+{
+  printf(1, "bench %s: %s failed\n", name, what);
+  exit();
+}
+
+uint seed = 1;
+
+int
+rnd(int n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+void
+tsc(char *name)
+{
+  uint t0;
+  u64 c;
+  int n;
+
+  n = 10;
+  t0 = uptime();
+  while(uptime() == t0)
+    ;
+  c = rdtsc();
+  t0 = uptime();
+  while(uptime() - t0 < n)
+    ;
+  report(name, n, rdtsc() - c, "tick");
+}
+
+void
+nullsys(char *name)
+{
+  u64 t;
+  int i, n;
+
+  n = 10000;
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    getpid();
+  report(name, n, rdtsc() - t, "call");
+}
+
+void
+forkexit(char *name)
+{
+  u64 t;
+  int i, n, pid;
+
+  n = 200;
+  t = rdtsc();
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0)
+      fail(name, "fork");
+    if(pid == 0)
+      exit();
+    wait();
+  }
+  report(name, n, rdtsc() - t, "fork");
+}
+
+void
+forkexec(char *name)
+{
+  u64 t;
+  int i, n, pid;
+  char *args[3];
+
+  n = 50;
+  t = rdtsc();
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0)
+      fail(name, "fork");
+    if(pid == 0){
+      args[0] = argv0;
+      args[1] = "-exit";
+      args[2] = 0;
+      exec(argv0, args);
+      fail(name, "exec");
+    }
+    wait();
+  }
+  report(name, n, rdtsc() - t, "exec");
+}
+
+void
+pipebw(char *name)
+{
+  u64 t;
+  int fds[2], n, total, m;
+
+  total = 1024*1024;
+  if(pipe(fds) < 0)
+    fail(name, "pipe");
+  t = rdtsc();
+  if(fork() == 0){
+    close(fds[0]);
+    for(n = 0; n < total; n += sizeof(buf))
+      write(fds[1], buf, sizeof(buf));
+    exit();
+  }
+  close(fds[1]);
+  for(n = 0; n < total; n += m)
+    if((m = read(fds[0], buf, sizeof(buf))) <= 0)
+      fail(name, "read");
+  t = rdtsc() - t;
+  close(fds[0]);
+  wait();
+  report(name, total/1024, t, "KB");
+}
+
+// Pass a byte around a ring of nproc processes n times.
+// With nproc = 2 this is pipe ping-pong latency; with more
+// processes than CPUs every hop is a context switch.
+// The pipes are made one hop at a time and every process
+// keeps only the two ends it uses, so no process holds more
+// than a few descriptors however long the ring.
+u64
+ring(char *name, int nproc, int n)
+{
+  int first[2], fds[2], in, i, j;
+  u64 t;
+  char c;
+
+  if(pipe(first) < 0)
+    fail(name, "pipe");
+  in = first[0];
+  for(i = 1; i < nproc; i++){
+    if(pipe(fds) < 0)
+      fail(name, "pipe");
+    if(fork() == 0){
+      close(first[1]);
+      close(fds[0]);
+      for(j = 0; j < n; j++){
+        if(read(in, &c, 1) != 1)
+          break;
+        write(fds[1], &c, 1);
+      }
+      exit();
+    }
+    close(in);
+    close(fds[1]);
+    in = fds[0];
+  }
+  t = rdtsc();
+  for(j = 0; j < n; j++){
+    write(first[1], &c, 1);
+    if(read(in, &c, 1) != 1)
+      fail(name, "read");
+  }
+  t = rdtsc() - t;
+  close(first[1]);
+  close(in);
+  for(i = 1; i < nproc; i++)
+    wait();
+  return t;
+}
+
+void
+pipelat(char *name)
+{
+  int n;
+
+  n = 1000;
+  report(name, n, ring(name, 2, n), "roundtrip");
+}
+
+void
+ctxsw(char *name)
+{
+  int n;
+
+  n = 200;
+  report(name, n*8, ring(name, 8, n), "switch");
+}
+
+void
+seqwrite(char *name)
+{
+  int fd, n;
+  u64 t;
+
+  unlink(FILE);
+  t = rdtsc();
+  if((fd = open(FILE, O_CREATE|O_RDWR)) < 0)
+    fail(name, "create");
+  for(n = 0; n < FILESIZE; n += sizeof(buf))
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+      fail(name, "write");
+  close(fd);
+  report(name, FILESIZE/1024, rdtsc() - t, "KB");
+}
+
+// Make sure FILE exists for the read benchmarks when
+// seqwrite was not asked for.
+void
+needfile(char *name)
+{
+  struct stat st;
+  int fd, n;
+
+  if(stat(FILE, &st) == 0 && st.size >= FILESIZE)
+    return;
+  if((fd = open(FILE, O_CREATE|O_RDWR)) < 0)
+    fail(name, "create");
+  for(n = 0; n < FILESIZE; n += sizeof(buf))
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+      fail(name, "write");
+  close(fd);
+}
+
+void
+seqread(char *name)
+{
+  int fd, n, m;
+  u64 t;
+
+  needfile(name);
+  t = rdtsc();
+  if((fd = open(FILE, O_RDONLY)) < 0)
+    fail(name, "open");
+  for(n = 0; n < FILESIZE; n += m)
+    if((m = read(fd, buf, sizeof(buf))) <= 0)
+      fail(name, "read");
+  close(fd);
+  report(name, FILESIZE/1024, rdtsc() - t, "KB");
+}
+
+void
+randread(char *name)
+{
+  int fd, i, n;
+  u64 t;
+
+  n = 256;
+  needfile(name);
+  if((fd = open(FILE, O_RDONLY)) < 0)
+    fail(name, "open");
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    if(pread(fd, buf, 512, rnd(FILESIZE/512)*512) != 512)
+      fail(name, "pread");
+  t = rdtsc() - t;
+  close(fd);
+  report(name, n, t, "block");
+}
+
+void
+randwrite(char *name)
+{
+  int fd, i, n;
+  u64 t;
+
+  n = 256;
+  needfile(name);
+  if((fd = open(FILE, O_RDWR)) < 0)
+    fail(name, "open");
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    if(pwrite(fd, buf, 512, rnd(FILESIZE/512)*512) != 512)
+      fail(name, "pwrite");
+  t = rdtsc() - t;
+  close(fd);
+  report(name, n, t, "block");
+}
+
+// Copy FILE in the kernel: at offset 0 its blocks are shared,
+// at offset 1 they are copied.
+void
+copyrange(char *name, int off)
+{
+  int in, out;
+  u64 t;
+
+  needfile(name);
+  unlink("benchcopy");
+  if((in = open(FILE, O_RDONLY)) < 0 || (out = open("benchcopy", O_CREATE|O_RDWR)) < 0)
+    fail(name, "open");
+  t = rdtsc();
+  if(copyfilerange(in, 0, out, off, FILESIZE) != FILESIZE)
+    fail(name, "copyfilerange");
+  t = rdtsc() - t;
+  close(in);
+  close(out);
+  unlink("benchcopy");
+  report(name, FILESIZE/1024, t, "KB");
+}
+
+void
+clone(char *name)
+{
+  copyrange(name, 0);
+}
+
+void
+copy(char *name)
+{
+  copyrange(name, 1);
+}
+
+// seqread of FILE compressed.  FILE is left compressed, so it
+// is removed for the benchmarks after.
+void
+zread(char *name)
+{
+  int fd;
+
+  needfile(name);
+  if((fd = open(FILE, O_RDWR)) < 0 || fsctl(fd, FS_COMPRESS, 0) < 0)
+    fail(name, "compress");
+  close(fd);
+  seqread(name);
+  unlink(FILE);
+}
+
+void
+createunlink(char *name)
+{
+  char file[8];
+  int i, n, fd;
+  u64 t, c, u;
+
+  n = 100;
+  file[0] = 'b';
+  file[3] = 0;
+  c = u = 0;
+  for(i = 0; i < n; i++){
+    file[1] = '0' + i/10;
+    file[2] = '0' + i%10;
+    t = rdtsc();
+    if((fd = open(file, O_CREATE|O_RDWR)) < 0)
+      fail(name, "create");
+    close(fd);
+    c += rdtsc() - t;
+  }
+  for(i = 0; i < n; i++){
+    file[1] = '0' + i/10;
+    file[2] = '0' + i%10;
+    t = rdtsc();
+    if(unlink(file) < 0)
+      fail(name, "unlink");
+    u += rdtsc() - t;
+  }
+  printf(1, "bench %s %d %d create\n", name, n, div64(c, n));
+  printf(1, "bench %s %d %d unlink\n", name, n, div64(u, n));
+}
+
+void
+sbrkgrow(char *name)
+{
+  int i, n;
+  u64 t;
+
+  n = 256;
+  t = rdtsc();
+  for(i = 0; i < n; i++)
+    if(sbrk(4096) == (char*)-1)
+      fail(name, "sbrk");
+  t = rdtsc() - t;
+  sbrk(-n*4096);
+  report(name, n, t, "page");
+}
+
+struct {
+  char *name;
+  void (*fn)(char*);
+} benches[] = {
+  { "tsc",       tsc },
+  { "nullsys",   nullsys },
+  { "forkexit",  forkexit },
+  { "forkexec",  forkexec },
+  { "pipebw",    pipebw },
+  { "pipelat",   pipelat },
+  { "ctxsw",     ctxsw },
+  { "seqwrite",  seqwrite },
+  { "seqread",   seqread },
+  { "randread",  randread },
+  { "randwrite", randwrite },
+  { "clone",     clone },
+  { "copy",      copy },
+  { "zread",     zread },
+  { "create",    createunlink },
+  { "sbrk",      sbrkgrow },
+};
+
+#define NBENCH (sizeof(benches)/sizeof(benches[0]))
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, pid;
+
+  if(argc > 1 && strcmp(argv[1], "-exit") == 0)
+    exit();
+  argv0 = argv[0];
+
+  for(i = 0; i < NBENCH; i++){
+    if(argc > 1){
+      for(j = 1; j < argc; j++)
+        if(strcmp(argv[j], benches[i].name) == 0)
+          break;
+      if(j == argc)
+        continue;
+    }
+    // In a child, so that a failure ends only this benchmark.
+    if((pid = fork()) < 0){
+      printf(1, "bench %s: fork failed\n", benches[i].name);
+      continue;
+    }
+    if(pid == 0){
+      benches[i].fn(benches[i].name);
+      exit();
+    }
+    wait();
+  }
+  unlink(FILE);
+  printf(1, "bench done\n");
+  exit();
+}
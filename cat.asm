@@ -0,0 +1,1335 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+   6:	eb 15                	jmp    1d <cat+0x1d>
+    write(1, buf, n);
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	ff 75 f4             	push   -0xc(%ebp)
+   e:	68 20 0c 00 00       	push   $0xc20
+  13:	6a 01                	push   $0x1
+  15:	e8 aa 03 00 00       	call   3c4 <write>
+  1a:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  1d:	83 ec 04             	sub    $0x4,%esp
+  20:	68 00 02 00 00       	push   $0x200
+  25:	68 20 0c 00 00       	push   $0xc20
+  2a:	ff 75 08             	push   0x8(%ebp)
+  2d:	e8 8a 03 00 00       	call   3bc <read>
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  38:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  3c:	7f ca                	jg     8 <cat+0x8>
+  if(n < 0){
+  3e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  42:	79 17                	jns    5b <cat+0x5b>
+    printf(1, "cat: read error\n");
+  44:	83 ec 08             	sub    $0x8,%esp
+  47:	68 57 09 00 00       	push   $0x957
+  4c:	6a 01                	push   $0x1
+  4e:	e8 4d 05 00 00       	call   5a0 <printf>
+  53:	83 c4 10             	add    $0x10,%esp
+    exit();
+  56:	e8 49 03 00 00       	call   3a4 <exit>
+  }
+}
+  5b:	90                   	nop
+  5c:	c9                   	leave
+  5d:	c3                   	ret
+
+0000005e <main>:
+
+int
+main(int argc, char *argv[])
+{
+  5e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  62:	83 e4 f0             	and    $0xfffffff0,%esp
+  65:	ff 71 fc             	push   -0x4(%ecx)
+  68:	55                   	push   %ebp
+  69:	89 e5                	mov    %esp,%ebp
+  6b:	53                   	push   %ebx
+  6c:	51                   	push   %ecx
+  6d:	83 ec 10             	sub    $0x10,%esp
+  70:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  72:	83 3b 01             	cmpl   $0x1,(%ebx)
+  75:	7f 12                	jg     89 <main+0x2b>
+    cat(0);
+  77:	83 ec 0c             	sub    $0xc,%esp
+  7a:	6a 00                	push   $0x0
+  7c:	e8 7f ff ff ff       	call   0 <cat>
+  81:	83 c4 10             	add    $0x10,%esp
+    exit();
+  84:	e8 1b 03 00 00       	call   3a4 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  89:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  90:	eb 71                	jmp    103 <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+  92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  95:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  9c:	8b 43 04             	mov    0x4(%ebx),%eax
+  9f:	01 d0                	add    %edx,%eax
+  a1:	8b 00                	mov    (%eax),%eax
+  a3:	83 ec 08             	sub    $0x8,%esp
+  a6:	6a 00                	push   $0x0
+  a8:	50                   	push   %eax
+  a9:	e8 36 03 00 00       	call   3e4 <open>
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  b4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  b8:	79 29                	jns    e3 <main+0x85>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  bd:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  c4:	8b 43 04             	mov    0x4(%ebx),%eax
+  c7:	01 d0                	add    %edx,%eax
+  c9:	8b 00                	mov    (%eax),%eax
+  cb:	83 ec 04             	sub    $0x4,%esp
+  ce:	50                   	push   %eax
+  cf:	68 68 09 00 00       	push   $0x968
+  d4:	6a 01                	push   $0x1
+  d6:	e8 c5 04 00 00       	call   5a0 <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+      exit();
+  de:	e8 c1 02 00 00       	call   3a4 <exit>
+    }
+    cat(fd);
+  e3:	83 ec 0c             	sub    $0xc,%esp
+  e6:	ff 75 f0             	push   -0x10(%ebp)
+  e9:	e8 12 ff ff ff       	call   0 <cat>
+  ee:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+  f1:	83 ec 0c             	sub    $0xc,%esp
+  f4:	ff 75 f0             	push   -0x10(%ebp)
+  f7:	e8 d0 02 00 00       	call   3cc <close>
+  fc:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+  ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 103:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 106:	3b 03                	cmp    (%ebx),%eax
+ 108:	7c 88                	jl     92 <main+0x34>
+  }
+  exit();
+ 10a:	e8 95 02 00 00       	call   3a4 <exit>
+
+0000010f <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 10f:	55                   	push   %ebp
+ 110:	89 e5                	mov    %esp,%ebp
+ 112:	57                   	push   %edi
+ 113:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 114:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 117:	8b 55 10             	mov    0x10(%ebp),%edx
+ 11a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11d:	89 cb                	mov    %ecx,%ebx
+ 11f:	89 df                	mov    %ebx,%edi
+ 121:	89 d1                	mov    %edx,%ecx
+ 123:	fc                   	cld
+ 124:	f3 aa                	rep stos %al,%es:(%edi)
+ 126:	89 ca                	mov    %ecx,%edx
+ 128:	89 fb                	mov    %edi,%ebx
+ 12a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 12d:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 130:	90                   	nop
+ 131:	5b                   	pop    %ebx
+ 132:	5f                   	pop    %edi
+ 133:	5d                   	pop    %ebp
+ 134:	c3                   	ret
+
+00000135 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 141:	90                   	nop
+ 142:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 145:	8d 42 01             	lea    0x1(%edx),%eax
+ 148:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 14b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 151:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 154:	0f b6 12             	movzbl (%edx),%edx
+ 157:	88 10                	mov    %dl,(%eax)
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	84 c0                	test   %al,%al
+ 15e:	75 e2                	jne    142 <strcpy+0xd>
+    ;
+  return os;
+ 160:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 163:	c9                   	leave
+ 164:	c3                   	ret
+
+00000165 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 165:	55                   	push   %ebp
+ 166:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 168:	eb 08                	jmp    172 <strcmp+0xd>
+    p++, q++;
+ 16a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 172:	8b 45 08             	mov    0x8(%ebp),%eax
+ 175:	0f b6 00             	movzbl (%eax),%eax
+ 178:	84 c0                	test   %al,%al
+ 17a:	74 10                	je     18c <strcmp+0x27>
+ 17c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 17f:	0f b6 10             	movzbl (%eax),%edx
+ 182:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 185:	0f b6 00             	movzbl (%eax),%eax
+ 188:	38 c2                	cmp    %al,%dl
+ 18a:	74 de                	je     16a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 18c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18f:	0f b6 00             	movzbl (%eax),%eax
+ 192:	0f b6 d0             	movzbl %al,%edx
+ 195:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 198:	0f b6 00             	movzbl (%eax),%eax
+ 19b:	0f b6 c0             	movzbl %al,%eax
+ 19e:	29 c2                	sub    %eax,%edx
+ 1a0:	89 d0                	mov    %edx,%eax
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	c3                   	ret
+
+000001a4 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1b1:	eb 04                	jmp    1b7 <strlen+0x13>
+ 1b3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1b7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bd:	01 d0                	add    %edx,%eax
+ 1bf:	0f b6 00             	movzbl (%eax),%eax
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	75 ed                	jne    1b3 <strlen+0xf>
+    ;
+  return n;
+ 1c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1c9:	c9                   	leave
+ 1ca:	c3                   	ret
+
+000001cb <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1cb:	55                   	push   %ebp
+ 1cc:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1ce:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1d1:	50                   	push   %eax
+ 1d2:	ff 75 0c             	push   0xc(%ebp)
+ 1d5:	ff 75 08             	push   0x8(%ebp)
+ 1d8:	e8 32 ff ff ff       	call   10f <stosb>
+ 1dd:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1e0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+
+000001e5 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1e5:	55                   	push   %ebp
+ 1e6:	89 e5                	mov    %esp,%ebp
+ 1e8:	83 ec 04             	sub    $0x4,%esp
+ 1eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ee:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1f1:	eb 14                	jmp    207 <strchr+0x22>
+    if(*s == c)
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 00             	movzbl (%eax),%eax
+ 1f9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1fc:	75 05                	jne    203 <strchr+0x1e>
+      return (char*)s;
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	eb 13                	jmp    216 <strchr+0x31>
+  for(; *s; s++)
+ 203:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 207:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20a:	0f b6 00             	movzbl (%eax),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 e2                	jne    1f3 <strchr+0xe>
+  return 0;
+ 211:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 216:	c9                   	leave
+ 217:	c3                   	ret
+
+00000218 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 218:	55                   	push   %ebp
+ 219:	89 e5                	mov    %esp,%ebp
+ 21b:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 21e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 225:	eb 42                	jmp    269 <gets+0x51>
+    cc = read(0, &c, 1);
+ 227:	83 ec 04             	sub    $0x4,%esp
+ 22a:	6a 01                	push   $0x1
+ 22c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 22f:	50                   	push   %eax
+ 230:	6a 00                	push   $0x0
+ 232:	e8 85 01 00 00       	call   3bc <read>
+ 237:	83 c4 10             	add    $0x10,%esp
+ 23a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 23d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 241:	7e 33                	jle    276 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 246:	8d 50 01             	lea    0x1(%eax),%edx
+ 249:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 24c:	89 c2                	mov    %eax,%edx
+ 24e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 251:	01 c2                	add    %eax,%edx
+ 253:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 257:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 259:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 25d:	3c 0a                	cmp    $0xa,%al
+ 25f:	74 16                	je     277 <gets+0x5f>
+ 261:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 265:	3c 0d                	cmp    $0xd,%al
+ 267:	74 0e                	je     277 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 269:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 26c:	83 c0 01             	add    $0x1,%eax
+ 26f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 272:	7f b3                	jg     227 <gets+0xf>
+ 274:	eb 01                	jmp    277 <gets+0x5f>
+      break;
+ 276:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 277:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 27a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27d:	01 d0                	add    %edx,%eax
+ 27f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 282:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 285:	c9                   	leave
+ 286:	c3                   	ret
+
+00000287 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 287:	55                   	push   %ebp
+ 288:	89 e5                	mov    %esp,%ebp
+ 28a:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 28d:	83 ec 08             	sub    $0x8,%esp
+ 290:	6a 00                	push   $0x0
+ 292:	ff 75 08             	push   0x8(%ebp)
+ 295:	e8 4a 01 00 00       	call   3e4 <open>
+ 29a:	83 c4 10             	add    $0x10,%esp
+ 29d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2a0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2a4:	79 07                	jns    2ad <stat+0x26>
+    return -1;
+ 2a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ab:	eb 25                	jmp    2d2 <stat+0x4b>
+  r = fstat(fd, st);
+ 2ad:	83 ec 08             	sub    $0x8,%esp
+ 2b0:	ff 75 0c             	push   0xc(%ebp)
+ 2b3:	ff 75 f4             	push   -0xc(%ebp)
+ 2b6:	e8 41 01 00 00       	call   3fc <fstat>
+ 2bb:	83 c4 10             	add    $0x10,%esp
+ 2be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2c1:	83 ec 0c             	sub    $0xc,%esp
+ 2c4:	ff 75 f4             	push   -0xc(%ebp)
+ 2c7:	e8 00 01 00 00       	call   3cc <close>
+ 2cc:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2d2:	c9                   	leave
+ 2d3:	c3                   	ret
+
+000002d4 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2d4:	55                   	push   %ebp
+ 2d5:	89 e5                	mov    %esp,%ebp
+ 2d7:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2e1:	eb 25                	jmp    308 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2e3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2e6:	89 d0                	mov    %edx,%eax
+ 2e8:	c1 e0 02             	shl    $0x2,%eax
+ 2eb:	01 d0                	add    %edx,%eax
+ 2ed:	01 c0                	add    %eax,%eax
+ 2ef:	89 c1                	mov    %eax,%ecx
+ 2f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2fa:	0f b6 00             	movzbl (%eax),%eax
+ 2fd:	0f be c0             	movsbl %al,%eax
+ 300:	01 c8                	add    %ecx,%eax
+ 302:	83 e8 30             	sub    $0x30,%eax
+ 305:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 308:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30b:	0f b6 00             	movzbl (%eax),%eax
+ 30e:	3c 2f                	cmp    $0x2f,%al
+ 310:	7e 0a                	jle    31c <atoi+0x48>
+ 312:	8b 45 08             	mov    0x8(%ebp),%eax
+ 315:	0f b6 00             	movzbl (%eax),%eax
+ 318:	3c 39                	cmp    $0x39,%al
+ 31a:	7e c7                	jle    2e3 <atoi+0xf>
+  return n;
+ 31c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 31f:	c9                   	leave
+ 320:	c3                   	ret
+
+00000321 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 321:	55                   	push   %ebp
+ 322:	89 e5                	mov    %esp,%ebp
+ 324:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 327:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 32d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 330:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 333:	eb 17                	jmp    34c <memmove+0x2b>
+    *dst++ = *src++;
+ 335:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 338:	8d 42 01             	lea    0x1(%edx),%eax
+ 33b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 33e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 341:	8d 48 01             	lea    0x1(%eax),%ecx
+ 344:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 347:	0f b6 12             	movzbl (%edx),%edx
+ 34a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 34c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 34f:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 352:	89 55 10             	mov    %edx,0x10(%ebp)
+ 355:	85 c0                	test   %eax,%eax
+ 357:	7f dc                	jg     335 <memmove+0x14>
+  return vdst;
+ 359:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 35c:	c9                   	leave
+ 35d:	c3                   	ret
+
+0000035e <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 35e:	55                   	push   %ebp
+ 35f:	89 e5                	mov    %esp,%ebp
+ 361:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 364:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 36b:	eb 04                	jmp    371 <ncpus+0x13>
+ 36d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 371:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 375:	7f 16                	jg     38d <ncpus+0x2f>
+ 377:	83 ec 08             	sub    $0x8,%esp
+ 37a:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 37d:	50                   	push   %eax
+ 37e:	ff 75 f4             	push   -0xc(%ebp)
+ 381:	e8 d6 00 00 00       	call   45c <intrstat>
+ 386:	83 c4 10             	add    $0x10,%esp
+ 389:	85 c0                	test   %eax,%eax
+ 38b:	74 e0                	je     36d <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 38d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 390:	ba 01 00 00 00       	mov    $0x1,%edx
+ 395:	85 c0                	test   %eax,%eax
+ 397:	0f 4e c2             	cmovle %edx,%eax
+}
+ 39a:	c9                   	leave
+ 39b:	c3                   	ret
+
+0000039c <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 39c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3a1:	cd 40                	int    $0x40
+ 3a3:	c3                   	ret
+
+000003a4 <exit>:
+SYSCALL(exit)
+ 3a4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a9:	cd 40                	int    $0x40
+ 3ab:	c3                   	ret
+
+000003ac <wait>:
+SYSCALL(wait)
+ 3ac:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3b1:	cd 40                	int    $0x40
+ 3b3:	c3                   	ret
+
+000003b4 <pipe>:
+SYSCALL(pipe)
+ 3b4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3b9:	cd 40                	int    $0x40
+ 3bb:	c3                   	ret
+
+000003bc <read>:
+SYSCALL(read)
+ 3bc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3c1:	cd 40                	int    $0x40
+ 3c3:	c3                   	ret
+
+000003c4 <write>:
+SYSCALL(write)
+ 3c4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3c9:	cd 40                	int    $0x40
+ 3cb:	c3                   	ret
+
+000003cc <close>:
+SYSCALL(close)
+ 3cc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3d1:	cd 40                	int    $0x40
+ 3d3:	c3                   	ret
+
+000003d4 <kill>:
+SYSCALL(kill)
+ 3d4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3d9:	cd 40                	int    $0x40
+ 3db:	c3                   	ret
+
+000003dc <exec>:
+SYSCALL(exec)
+ 3dc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3e1:	cd 40                	int    $0x40
+ 3e3:	c3                   	ret
+
+000003e4 <open>:
+SYSCALL(open)
+ 3e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3e9:	cd 40                	int    $0x40
+ 3eb:	c3                   	ret
+
+000003ec <mknod>:
+SYSCALL(mknod)
+ 3ec:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3f1:	cd 40                	int    $0x40
+ 3f3:	c3                   	ret
+
+000003f4 <unlink>:
+SYSCALL(unlink)
+ 3f4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3f9:	cd 40                	int    $0x40
+ 3fb:	c3                   	ret
+
+000003fc <fstat>:
+SYSCALL(fstat)
+ 3fc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 401:	cd 40                	int    $0x40
+ 403:	c3                   	ret
+
+00000404 <link>:
+SYSCALL(link)
+ 404:	b8 13 00 00 00       	mov    $0x13,%eax
+ 409:	cd 40                	int    $0x40
+ 40b:	c3                   	ret
+
+0000040c <mkdir>:
+SYSCALL(mkdir)
+ 40c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 411:	cd 40                	int    $0x40
+ 413:	c3                   	ret
+
+00000414 <chdir>:
+SYSCALL(chdir)
+ 414:	b8 09 00 00 00       	mov    $0x9,%eax
+ 419:	cd 40                	int    $0x40
+ 41b:	c3                   	ret
+
+0000041c <dup>:
+SYSCALL(dup)
+ 41c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <getpid>:
+SYSCALL(getpid)
+ 424:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <sbrk>:
+SYSCALL(sbrk)
+ 42c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <sleep>:
+SYSCALL(sleep)
+ 434:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <uptime>:
+SYSCALL(uptime)
+ 43c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <poll>:
+SYSCALL(poll)
+ 444:	b8 16 00 00 00       	mov    $0x16,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <fcntl>:
+SYSCALL(fcntl)
+ 44c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <irqroute>:
+SYSCALL(irqroute)
+ 454:	b8 18 00 00 00       	mov    $0x18,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <intrstat>:
+SYSCALL(intrstat)
+ 45c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <pread>:
+SYSCALL(pread)
+ 464:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <getdents>:
+SYSCALL(getdents)
+ 46c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <fstatat>:
+SYSCALL(fstatat)
+ 474:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <openat>:
+SYSCALL(openat)
+ 47c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <unlinkat>:
+SYSCALL(unlinkat)
+ 484:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <mkdirat>:
+SYSCALL(mkdirat)
+ 48c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <linkat>:
+SYSCALL(linkat)
+ 494:	b8 20 00 00 00       	mov    $0x20,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <exits>:
+SYSCALL(exits)
+ 49c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <waitstatus>:
+SYSCALL(waitstatus)
+ 4a4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <pwrite>:
+SYSCALL(pwrite)
+ 4ac:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <lseek>:
+SYSCALL(lseek)
+ 4b4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <copyfilerange>:
+SYSCALL(copyfilerange)
+ 4bc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <fsctl>:
+SYSCALL(fsctl)
+ 4c4:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4cc:	55                   	push   %ebp
+ 4cd:	89 e5                	mov    %esp,%ebp
+ 4cf:	83 ec 18             	sub    $0x18,%esp
+ 4d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d5:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4d8:	83 ec 04             	sub    $0x4,%esp
+ 4db:	6a 01                	push   $0x1
+ 4dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 4e0:	50                   	push   %eax
+ 4e1:	ff 75 08             	push   0x8(%ebp)
+ 4e4:	e8 db fe ff ff       	call   3c4 <write>
+ 4e9:	83 c4 10             	add    $0x10,%esp
+}
+ 4ec:	90                   	nop
+ 4ed:	c9                   	leave
+ 4ee:	c3                   	ret
+
+000004ef <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4ef:	55                   	push   %ebp
+ 4f0:	89 e5                	mov    %esp,%ebp
+ 4f2:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4f5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4fc:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 500:	74 17                	je     519 <printint+0x2a>
+ 502:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 506:	79 11                	jns    519 <printint+0x2a>
+    neg = 1;
+ 508:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 50f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 512:	f7 d8                	neg    %eax
+ 514:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 517:	eb 06                	jmp    51f <printint+0x30>
+  } else {
+    x = xx;
+ 519:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 51c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 51f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 526:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 529:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 52c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 531:	f7 f1                	div    %ecx
+ 533:	89 d1                	mov    %edx,%ecx
+ 535:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 538:	8d 50 01             	lea    0x1(%eax),%edx
+ 53b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 53e:	0f b6 91 0c 0c 00 00 	movzbl 0xc0c(%ecx),%edx
+ 545:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 549:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 54c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 54f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 554:	f7 f1                	div    %ecx
+ 556:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 559:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 55d:	75 c7                	jne    526 <printint+0x37>
+  if(neg)
+ 55f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 563:	74 2d                	je     592 <printint+0xa3>
+    buf[i++] = '-';
+ 565:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 568:	8d 50 01             	lea    0x1(%eax),%edx
+ 56b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 56e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 573:	eb 1d                	jmp    592 <printint+0xa3>
+    putc(fd, buf[i]);
+ 575:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 578:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 57b:	01 d0                	add    %edx,%eax
+ 57d:	0f b6 00             	movzbl (%eax),%eax
+ 580:	0f be c0             	movsbl %al,%eax
+ 583:	83 ec 08             	sub    $0x8,%esp
+ 586:	50                   	push   %eax
+ 587:	ff 75 08             	push   0x8(%ebp)
+ 58a:	e8 3d ff ff ff       	call   4cc <putc>
+ 58f:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 592:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 596:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 59a:	79 d9                	jns    575 <printint+0x86>
+}
+ 59c:	90                   	nop
+ 59d:	90                   	nop
+ 59e:	c9                   	leave
+ 59f:	c3                   	ret
+
+000005a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 5a6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 5ad:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5b0:	83 c0 04             	add    $0x4,%eax
+ 5b3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5b6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 5bd:	e9 59 01 00 00       	jmp    71b <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 5c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5c8:	01 d0                	add    %edx,%eax
+ 5ca:	0f b6 00             	movzbl (%eax),%eax
+ 5cd:	0f be c0             	movsbl %al,%eax
+ 5d0:	25 ff 00 00 00       	and    $0xff,%eax
+ 5d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 5d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5dc:	75 2c                	jne    60a <printf+0x6a>
+      if(c == '%'){
+ 5de:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5e2:	75 0c                	jne    5f0 <printf+0x50>
+        state = '%';
+ 5e4:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 5eb:	e9 27 01 00 00       	jmp    717 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5f3:	0f be c0             	movsbl %al,%eax
+ 5f6:	83 ec 08             	sub    $0x8,%esp
+ 5f9:	50                   	push   %eax
+ 5fa:	ff 75 08             	push   0x8(%ebp)
+ 5fd:	e8 ca fe ff ff       	call   4cc <putc>
+ 602:	83 c4 10             	add    $0x10,%esp
+ 605:	e9 0d 01 00 00       	jmp    717 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 60a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 60e:	0f 85 03 01 00 00    	jne    717 <printf+0x177>
+      if(c == 'd'){
+ 614:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 618:	75 1e                	jne    638 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 61a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 61d:	8b 00                	mov    (%eax),%eax
+ 61f:	6a 01                	push   $0x1
+ 621:	6a 0a                	push   $0xa
+ 623:	50                   	push   %eax
+ 624:	ff 75 08             	push   0x8(%ebp)
+ 627:	e8 c3 fe ff ff       	call   4ef <printint>
+ 62c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 62f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 633:	e9 d8 00 00 00       	jmp    710 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 638:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 63c:	74 06                	je     644 <printf+0xa4>
+ 63e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 642:	75 1e                	jne    662 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 644:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 647:	8b 00                	mov    (%eax),%eax
+ 649:	6a 00                	push   $0x0
+ 64b:	6a 10                	push   $0x10
+ 64d:	50                   	push   %eax
+ 64e:	ff 75 08             	push   0x8(%ebp)
+ 651:	e8 99 fe ff ff       	call   4ef <printint>
+ 656:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 659:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 65d:	e9 ae 00 00 00       	jmp    710 <printf+0x170>
+      } else if(c == 's'){
+ 662:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 666:	75 43                	jne    6ab <printf+0x10b>
+        s = (char*)*ap;
+ 668:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 66b:	8b 00                	mov    (%eax),%eax
+ 66d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 670:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 674:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 678:	75 25                	jne    69f <printf+0xff>
+          s = "(null)";
+ 67a:	c7 45 f4 7d 09 00 00 	movl   $0x97d,-0xc(%ebp)
+        while(*s != 0){
+ 681:	eb 1c                	jmp    69f <printf+0xff>
+          putc(fd, *s);
+ 683:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 686:	0f b6 00             	movzbl (%eax),%eax
+ 689:	0f be c0             	movsbl %al,%eax
+ 68c:	83 ec 08             	sub    $0x8,%esp
+ 68f:	50                   	push   %eax
+ 690:	ff 75 08             	push   0x8(%ebp)
+ 693:	e8 34 fe ff ff       	call   4cc <putc>
+ 698:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 69b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 69f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6a2:	0f b6 00             	movzbl (%eax),%eax
+ 6a5:	84 c0                	test   %al,%al
+ 6a7:	75 da                	jne    683 <printf+0xe3>
+ 6a9:	eb 65                	jmp    710 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 6ab:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6af:	75 1d                	jne    6ce <printf+0x12e>
+        putc(fd, *ap);
+ 6b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6b4:	8b 00                	mov    (%eax),%eax
+ 6b6:	0f be c0             	movsbl %al,%eax
+ 6b9:	83 ec 08             	sub    $0x8,%esp
+ 6bc:	50                   	push   %eax
+ 6bd:	ff 75 08             	push   0x8(%ebp)
+ 6c0:	e8 07 fe ff ff       	call   4cc <putc>
+ 6c5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6c8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6cc:	eb 42                	jmp    710 <printf+0x170>
+      } else if(c == '%'){
+ 6ce:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6d2:	75 17                	jne    6eb <printf+0x14b>
+        putc(fd, c);
+ 6d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6d7:	0f be c0             	movsbl %al,%eax
+ 6da:	83 ec 08             	sub    $0x8,%esp
+ 6dd:	50                   	push   %eax
+ 6de:	ff 75 08             	push   0x8(%ebp)
+ 6e1:	e8 e6 fd ff ff       	call   4cc <putc>
+ 6e6:	83 c4 10             	add    $0x10,%esp
+ 6e9:	eb 25                	jmp    710 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 6eb:	83 ec 08             	sub    $0x8,%esp
+ 6ee:	6a 25                	push   $0x25
+ 6f0:	ff 75 08             	push   0x8(%ebp)
+ 6f3:	e8 d4 fd ff ff       	call   4cc <putc>
+ 6f8:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6fe:	0f be c0             	movsbl %al,%eax
+ 701:	83 ec 08             	sub    $0x8,%esp
+ 704:	50                   	push   %eax
+ 705:	ff 75 08             	push   0x8(%ebp)
+ 708:	e8 bf fd ff ff       	call   4cc <putc>
+ 70d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 710:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 717:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 71b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 71e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 721:	01 d0                	add    %edx,%eax
+ 723:	0f b6 00             	movzbl (%eax),%eax
+ 726:	84 c0                	test   %al,%al
+ 728:	0f 85 94 fe ff ff    	jne    5c2 <printf+0x22>
+    }
+  }
+}
+ 72e:	90                   	nop
+ 72f:	90                   	nop
+ 730:	c9                   	leave
+ 731:	c3                   	ret
+
+00000732 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 732:	55                   	push   %ebp
+ 733:	89 e5                	mov    %esp,%ebp
+ 735:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 738:	8b 45 08             	mov    0x8(%ebp),%eax
+ 73b:	83 e8 08             	sub    $0x8,%eax
+ 73e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 741:	a1 28 0e 00 00       	mov    0xe28,%eax
+ 746:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 749:	eb 24                	jmp    76f <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 74b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 74e:	8b 00                	mov    (%eax),%eax
+ 750:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 753:	72 12                	jb     767 <free+0x35>
+ 755:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 758:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 75b:	72 24                	jb     781 <free+0x4f>
+ 75d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 760:	8b 00                	mov    (%eax),%eax
+ 762:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 765:	72 1a                	jb     781 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 767:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76a:	8b 00                	mov    (%eax),%eax
+ 76c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 76f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 772:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 775:	73 d4                	jae    74b <free+0x19>
+ 777:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 77a:	8b 00                	mov    (%eax),%eax
+ 77c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 77f:	73 ca                	jae    74b <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 781:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 784:	8b 40 04             	mov    0x4(%eax),%eax
+ 787:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 78e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 791:	01 c2                	add    %eax,%edx
+ 793:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 796:	8b 00                	mov    (%eax),%eax
+ 798:	39 c2                	cmp    %eax,%edx
+ 79a:	75 24                	jne    7c0 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 79c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 79f:	8b 50 04             	mov    0x4(%eax),%edx
+ 7a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a5:	8b 00                	mov    (%eax),%eax
+ 7a7:	8b 40 04             	mov    0x4(%eax),%eax
+ 7aa:	01 c2                	add    %eax,%edx
+ 7ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7af:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b5:	8b 00                	mov    (%eax),%eax
+ 7b7:	8b 10                	mov    (%eax),%edx
+ 7b9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7bc:	89 10                	mov    %edx,(%eax)
+ 7be:	eb 0a                	jmp    7ca <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7c3:	8b 10                	mov    (%eax),%edx
+ 7c5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c8:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 7ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cd:	8b 40 04             	mov    0x4(%eax),%eax
+ 7d0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7da:	01 d0                	add    %edx,%eax
+ 7dc:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7df:	75 20                	jne    801 <free+0xcf>
+    p->s.size += bp->s.size;
+ 7e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e4:	8b 50 04             	mov    0x4(%eax),%edx
+ 7e7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ea:	8b 40 04             	mov    0x4(%eax),%eax
+ 7ed:	01 c2                	add    %eax,%edx
+ 7ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f2:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7f5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f8:	8b 10                	mov    (%eax),%edx
+ 7fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fd:	89 10                	mov    %edx,(%eax)
+ 7ff:	eb 08                	jmp    809 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 801:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 804:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 807:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 809:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 80c:	a3 28 0e 00 00       	mov    %eax,0xe28
+}
+ 811:	90                   	nop
+ 812:	c9                   	leave
+ 813:	c3                   	ret
+
+00000814 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 814:	55                   	push   %ebp
+ 815:	89 e5                	mov    %esp,%ebp
+ 817:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 81a:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 821:	77 07                	ja     82a <morecore+0x16>
+    nu = 4096;
+ 823:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 82a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 82d:	c1 e0 03             	shl    $0x3,%eax
+ 830:	83 ec 0c             	sub    $0xc,%esp
+ 833:	50                   	push   %eax
+ 834:	e8 f3 fb ff ff       	call   42c <sbrk>
+ 839:	83 c4 10             	add    $0x10,%esp
+ 83c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 83f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 843:	75 07                	jne    84c <morecore+0x38>
+    return 0;
+ 845:	b8 00 00 00 00       	mov    $0x0,%eax
+ 84a:	eb 26                	jmp    872 <morecore+0x5e>
+  hp = (Header*)p;
+ 84c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 852:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 855:	8b 55 08             	mov    0x8(%ebp),%edx
+ 858:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 85b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 85e:	83 c0 08             	add    $0x8,%eax
+ 861:	83 ec 0c             	sub    $0xc,%esp
+ 864:	50                   	push   %eax
+ 865:	e8 c8 fe ff ff       	call   732 <free>
+ 86a:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 86d:	a1 28 0e 00 00       	mov    0xe28,%eax
+}
+ 872:	c9                   	leave
+ 873:	c3                   	ret
+
+00000874 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 874:	55                   	push   %ebp
+ 875:	89 e5                	mov    %esp,%ebp
+ 877:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 87a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 87d:	83 c0 07             	add    $0x7,%eax
+ 880:	c1 e8 03             	shr    $0x3,%eax
+ 883:	83 c0 01             	add    $0x1,%eax
+ 886:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 889:	a1 28 0e 00 00       	mov    0xe28,%eax
+ 88e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 891:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 895:	75 23                	jne    8ba <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 897:	c7 45 f0 20 0e 00 00 	movl   $0xe20,-0x10(%ebp)
+ 89e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8a1:	a3 28 0e 00 00       	mov    %eax,0xe28
+ 8a6:	a1 28 0e 00 00       	mov    0xe28,%eax
+ 8ab:	a3 20 0e 00 00       	mov    %eax,0xe20
+    base.s.size = 0;
+ 8b0:	c7 05 24 0e 00 00 00 	movl   $0x0,0xe24
+ 8b7:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8bd:	8b 00                	mov    (%eax),%eax
+ 8bf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c5:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c8:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 8cb:	72 4d                	jb     91a <malloc+0xa6>
+      if(p->s.size == nunits)
+ 8cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d0:	8b 40 04             	mov    0x4(%eax),%eax
+ 8d3:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 8d6:	75 0c                	jne    8e4 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 8d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8db:	8b 10                	mov    (%eax),%edx
+ 8dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e0:	89 10                	mov    %edx,(%eax)
+ 8e2:	eb 26                	jmp    90a <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 8e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ea:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8ed:	89 c2                	mov    %eax,%edx
+ 8ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f2:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f8:	8b 40 04             	mov    0x4(%eax),%eax
+ 8fb:	c1 e0 03             	shl    $0x3,%eax
+ 8fe:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 901:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 904:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 907:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 90a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 90d:	a3 28 0e 00 00       	mov    %eax,0xe28
+      return (void*)(p + 1);
+ 912:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 915:	83 c0 08             	add    $0x8,%eax
+ 918:	eb 3b                	jmp    955 <malloc+0xe1>
+    }
+    if(p == freep)
+ 91a:	a1 28 0e 00 00       	mov    0xe28,%eax
+ 91f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 922:	75 1e                	jne    942 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 924:	83 ec 0c             	sub    $0xc,%esp
+ 927:	ff 75 ec             	push   -0x14(%ebp)
+ 92a:	e8 e5 fe ff ff       	call   814 <morecore>
+ 92f:	83 c4 10             	add    $0x10,%esp
+ 932:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 935:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 939:	75 07                	jne    942 <malloc+0xce>
+        return 0;
+ 93b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 940:	eb 13                	jmp    955 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 942:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 945:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 948:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94b:	8b 00                	mov    (%eax),%eax
+ 94d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 950:	e9 6d ff ff ff       	jmp    8c2 <malloc+0x4e>
+  }
+}
+ 955:	c9                   	leave
+ 956:	c3                   	ret
@@ -0,0 +1,1345 @@
+
+_compress:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fcntl.h"
+#include "fsctl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 2c             	sub    $0x2c,%esp
+  13:	89 cb                	mov    %ecx,%ebx
+  struct extents e0, e1;
+  int i, fd;
+
+  if(argc < 2){
+  15:	83 3b 01             	cmpl   $0x1,(%ebx)
+  18:	7f 17                	jg     31 <main+0x31>
+    printf(2, "usage: compress file ...\n");
+  1a:	83 ec 08             	sub    $0x8,%esp
+  1d:	68 90 09 00 00       	push   $0x990
+  22:	6a 02                	push   $0x2
+  24:	e8 b0 05 00 00       	call   5d9 <printf>
+  29:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2c:	e8 ac 03 00 00       	call   3dd <exit>
+  }
+  for(i = 1; i < argc; i++){
+  31:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  38:	e9 fb 00 00 00       	jmp    138 <main+0x138>
+    if((fd = open(argv[i], O_RDWR)) < 0){
+  3d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  40:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  47:	8b 43 04             	mov    0x4(%ebx),%eax
+  4a:	01 d0                	add    %edx,%eax
+  4c:	8b 00                	mov    (%eax),%eax
+  4e:	83 ec 08             	sub    $0x8,%esp
+  51:	6a 02                	push   $0x2
+  53:	50                   	push   %eax
+  54:	e8 c4 03 00 00       	call   41d <open>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  5f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  63:	79 29                	jns    8e <main+0x8e>
+      printf(2, "compress: cannot open %s\n", argv[i]);
+  65:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  68:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  6f:	8b 43 04             	mov    0x4(%ebx),%eax
+  72:	01 d0                	add    %edx,%eax
+  74:	8b 00                	mov    (%eax),%eax
+  76:	83 ec 04             	sub    $0x4,%esp
+  79:	50                   	push   %eax
+  7a:	68 aa 09 00 00       	push   $0x9aa
+  7f:	6a 02                	push   $0x2
+  81:	e8 53 05 00 00       	call   5d9 <printf>
+  86:	83 c4 10             	add    $0x10,%esp
+      continue;
+  89:	e9 a6 00 00 00       	jmp    134 <main+0x134>
+    }
+    if(fsctl(fd, FS_EXTENTS, &e0) < 0 || fsctl(fd, FS_COMPRESS, 0) < 0 ||
+  8e:	83 ec 04             	sub    $0x4,%esp
+  91:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  94:	50                   	push   %eax
+  95:	6a 01                	push   $0x1
+  97:	ff 75 e0             	push   -0x20(%ebp)
+  9a:	e8 5e 04 00 00       	call   4fd <fsctl>
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	85 c0                	test   %eax,%eax
+  a4:	78 2e                	js     d4 <main+0xd4>
+  a6:	83 ec 04             	sub    $0x4,%esp
+  a9:	6a 00                	push   $0x0
+  ab:	6a 03                	push   $0x3
+  ad:	ff 75 e0             	push   -0x20(%ebp)
+  b0:	e8 48 04 00 00       	call   4fd <fsctl>
+  b5:	83 c4 10             	add    $0x10,%esp
+  b8:	85 c0                	test   %eax,%eax
+  ba:	78 18                	js     d4 <main+0xd4>
+       fsctl(fd, FS_EXTENTS, &e1) < 0)
+  bc:	83 ec 04             	sub    $0x4,%esp
+  bf:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  c2:	50                   	push   %eax
+  c3:	6a 01                	push   $0x1
+  c5:	ff 75 e0             	push   -0x20(%ebp)
+  c8:	e8 30 04 00 00       	call   4fd <fsctl>
+  cd:	83 c4 10             	add    $0x10,%esp
+    if(fsctl(fd, FS_EXTENTS, &e0) < 0 || fsctl(fd, FS_COMPRESS, 0) < 0 ||
+  d0:	85 c0                	test   %eax,%eax
+  d2:	79 26                	jns    fa <main+0xfa>
+      printf(2, "compress: %s failed\n", argv[i]);
+  d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  d7:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  de:	8b 43 04             	mov    0x4(%ebx),%eax
+  e1:	01 d0                	add    %edx,%eax
+  e3:	8b 00                	mov    (%eax),%eax
+  e5:	83 ec 04             	sub    $0x4,%esp
+  e8:	50                   	push   %eax
+  e9:	68 c4 09 00 00       	push   $0x9c4
+  ee:	6a 02                	push   $0x2
+  f0:	e8 e4 04 00 00       	call   5d9 <printf>
+  f5:	83 c4 10             	add    $0x10,%esp
+  f8:	eb 2c                	jmp    126 <main+0x126>
+    else
+      printf(1, "%s %d %d\n", argv[i], e0.nblocks, e1.nblocks);
+  fa:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  fd:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 100:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 103:	8d 34 85 00 00 00 00 	lea    0x0(,%eax,4),%esi
+ 10a:	8b 43 04             	mov    0x4(%ebx),%eax
+ 10d:	01 f0                	add    %esi,%eax
+ 10f:	8b 00                	mov    (%eax),%eax
+ 111:	83 ec 0c             	sub    $0xc,%esp
+ 114:	51                   	push   %ecx
+ 115:	52                   	push   %edx
+ 116:	50                   	push   %eax
+ 117:	68 d9 09 00 00       	push   $0x9d9
+ 11c:	6a 01                	push   $0x1
+ 11e:	e8 b6 04 00 00       	call   5d9 <printf>
+ 123:	83 c4 20             	add    $0x20,%esp
+    close(fd);
+ 126:	83 ec 0c             	sub    $0xc,%esp
+ 129:	ff 75 e0             	push   -0x20(%ebp)
+ 12c:	e8 d4 02 00 00       	call   405 <close>
+ 131:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 134:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 138:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 13b:	3b 03                	cmp    (%ebx),%eax
+ 13d:	0f 8c fa fe ff ff    	jl     3d <main+0x3d>
+  }
+  exit();
+ 143:	e8 95 02 00 00       	call   3dd <exit>
+
+00000148 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	57                   	push   %edi
+ 14c:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 14d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 150:	8b 55 10             	mov    0x10(%ebp),%edx
+ 153:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 156:	89 cb                	mov    %ecx,%ebx
+ 158:	89 df                	mov    %ebx,%edi
+ 15a:	89 d1                	mov    %edx,%ecx
+ 15c:	fc                   	cld
+ 15d:	f3 aa                	rep stos %al,%es:(%edi)
+ 15f:	89 ca                	mov    %ecx,%edx
+ 161:	89 fb                	mov    %edi,%ebx
+ 163:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 166:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 169:	90                   	nop
+ 16a:	5b                   	pop    %ebx
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+
+0000016e <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 17a:	90                   	nop
+ 17b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 17e:	8d 42 01             	lea    0x1(%edx),%eax
+ 181:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 184:	8b 45 08             	mov    0x8(%ebp),%eax
+ 187:	8d 48 01             	lea    0x1(%eax),%ecx
+ 18a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 18d:	0f b6 12             	movzbl (%edx),%edx
+ 190:	88 10                	mov    %dl,(%eax)
+ 192:	0f b6 00             	movzbl (%eax),%eax
+ 195:	84 c0                	test   %al,%al
+ 197:	75 e2                	jne    17b <strcpy+0xd>
+    ;
+  return os;
+ 199:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 19c:	c9                   	leave
+ 19d:	c3                   	ret
+
+0000019e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 19e:	55                   	push   %ebp
+ 19f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1a1:	eb 08                	jmp    1ab <strcmp+0xd>
+    p++, q++;
+ 1a3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1a7:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ae:	0f b6 00             	movzbl (%eax),%eax
+ 1b1:	84 c0                	test   %al,%al
+ 1b3:	74 10                	je     1c5 <strcmp+0x27>
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	0f b6 10             	movzbl (%eax),%edx
+ 1bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1be:	0f b6 00             	movzbl (%eax),%eax
+ 1c1:	38 c2                	cmp    %al,%dl
+ 1c3:	74 de                	je     1a3 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c8:	0f b6 00             	movzbl (%eax),%eax
+ 1cb:	0f b6 d0             	movzbl %al,%edx
+ 1ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d1:	0f b6 00             	movzbl (%eax),%eax
+ 1d4:	0f b6 c0             	movzbl %al,%eax
+ 1d7:	29 c2                	sub    %eax,%edx
+ 1d9:	89 d0                	mov    %edx,%eax
+}
+ 1db:	5d                   	pop    %ebp
+ 1dc:	c3                   	ret
+
+000001dd <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1ea:	eb 04                	jmp    1f0 <strlen+0x13>
+ 1ec:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1f0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	01 d0                	add    %edx,%eax
+ 1f8:	0f b6 00             	movzbl (%eax),%eax
+ 1fb:	84 c0                	test   %al,%al
+ 1fd:	75 ed                	jne    1ec <strlen+0xf>
+    ;
+  return n;
+ 1ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 202:	c9                   	leave
+ 203:	c3                   	ret
+
+00000204 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 204:	55                   	push   %ebp
+ 205:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 207:	8b 45 10             	mov    0x10(%ebp),%eax
+ 20a:	50                   	push   %eax
+ 20b:	ff 75 0c             	push   0xc(%ebp)
+ 20e:	ff 75 08             	push   0x8(%ebp)
+ 211:	e8 32 ff ff ff       	call   148 <stosb>
+ 216:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 219:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 21c:	c9                   	leave
+ 21d:	c3                   	ret
+
+0000021e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 21e:	55                   	push   %ebp
+ 21f:	89 e5                	mov    %esp,%ebp
+ 221:	83 ec 04             	sub    $0x4,%esp
+ 224:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 227:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 22a:	eb 14                	jmp    240 <strchr+0x22>
+    if(*s == c)
+ 22c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22f:	0f b6 00             	movzbl (%eax),%eax
+ 232:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 235:	75 05                	jne    23c <strchr+0x1e>
+      return (char*)s;
+ 237:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23a:	eb 13                	jmp    24f <strchr+0x31>
+  for(; *s; s++)
+ 23c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 240:	8b 45 08             	mov    0x8(%ebp),%eax
+ 243:	0f b6 00             	movzbl (%eax),%eax
+ 246:	84 c0                	test   %al,%al
+ 248:	75 e2                	jne    22c <strchr+0xe>
+  return 0;
+ 24a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 24f:	c9                   	leave
+ 250:	c3                   	ret
+
+00000251 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 251:	55                   	push   %ebp
+ 252:	89 e5                	mov    %esp,%ebp
+ 254:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 257:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 25e:	eb 42                	jmp    2a2 <gets+0x51>
+    cc = read(0, &c, 1);
+ 260:	83 ec 04             	sub    $0x4,%esp
+ 263:	6a 01                	push   $0x1
+ 265:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 268:	50                   	push   %eax
+ 269:	6a 00                	push   $0x0
+ 26b:	e8 85 01 00 00       	call   3f5 <read>
+ 270:	83 c4 10             	add    $0x10,%esp
+ 273:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 276:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 27a:	7e 33                	jle    2af <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 27c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 27f:	8d 50 01             	lea    0x1(%eax),%edx
+ 282:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 285:	89 c2                	mov    %eax,%edx
+ 287:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28a:	01 c2                	add    %eax,%edx
+ 28c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 290:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 292:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 296:	3c 0a                	cmp    $0xa,%al
+ 298:	74 16                	je     2b0 <gets+0x5f>
+ 29a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29e:	3c 0d                	cmp    $0xd,%al
+ 2a0:	74 0e                	je     2b0 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2a5:	83 c0 01             	add    $0x1,%eax
+ 2a8:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2ab:	7f b3                	jg     260 <gets+0xf>
+ 2ad:	eb 01                	jmp    2b0 <gets+0x5f>
+      break;
+ 2af:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2b0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	01 d0                	add    %edx,%eax
+ 2b8:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2bb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2be:	c9                   	leave
+ 2bf:	c3                   	ret
+
+000002c0 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2c6:	83 ec 08             	sub    $0x8,%esp
+ 2c9:	6a 00                	push   $0x0
+ 2cb:	ff 75 08             	push   0x8(%ebp)
+ 2ce:	e8 4a 01 00 00       	call   41d <open>
+ 2d3:	83 c4 10             	add    $0x10,%esp
+ 2d6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2d9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2dd:	79 07                	jns    2e6 <stat+0x26>
+    return -1;
+ 2df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2e4:	eb 25                	jmp    30b <stat+0x4b>
+  r = fstat(fd, st);
+ 2e6:	83 ec 08             	sub    $0x8,%esp
+ 2e9:	ff 75 0c             	push   0xc(%ebp)
+ 2ec:	ff 75 f4             	push   -0xc(%ebp)
+ 2ef:	e8 41 01 00 00       	call   435 <fstat>
+ 2f4:	83 c4 10             	add    $0x10,%esp
+ 2f7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2fa:	83 ec 0c             	sub    $0xc,%esp
+ 2fd:	ff 75 f4             	push   -0xc(%ebp)
+ 300:	e8 00 01 00 00       	call   405 <close>
+ 305:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 308:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 30b:	c9                   	leave
+ 30c:	c3                   	ret
+
+0000030d <atoi>:
+
+int
+atoi(const char *s)
+{
+ 30d:	55                   	push   %ebp
+ 30e:	89 e5                	mov    %esp,%ebp
+ 310:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 313:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 31a:	eb 25                	jmp    341 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 31c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 31f:	89 d0                	mov    %edx,%eax
+ 321:	c1 e0 02             	shl    $0x2,%eax
+ 324:	01 d0                	add    %edx,%eax
+ 326:	01 c0                	add    %eax,%eax
+ 328:	89 c1                	mov    %eax,%ecx
+ 32a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32d:	8d 50 01             	lea    0x1(%eax),%edx
+ 330:	89 55 08             	mov    %edx,0x8(%ebp)
+ 333:	0f b6 00             	movzbl (%eax),%eax
+ 336:	0f be c0             	movsbl %al,%eax
+ 339:	01 c8                	add    %ecx,%eax
+ 33b:	83 e8 30             	sub    $0x30,%eax
+ 33e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 341:	8b 45 08             	mov    0x8(%ebp),%eax
+ 344:	0f b6 00             	movzbl (%eax),%eax
+ 347:	3c 2f                	cmp    $0x2f,%al
+ 349:	7e 0a                	jle    355 <atoi+0x48>
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	0f b6 00             	movzbl (%eax),%eax
+ 351:	3c 39                	cmp    $0x39,%al
+ 353:	7e c7                	jle    31c <atoi+0xf>
+  return n;
+ 355:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 358:	c9                   	leave
+ 359:	c3                   	ret
+
+0000035a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 35a:	55                   	push   %ebp
+ 35b:	89 e5                	mov    %esp,%ebp
+ 35d:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 360:	8b 45 08             	mov    0x8(%ebp),%eax
+ 363:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 366:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 369:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 36c:	eb 17                	jmp    385 <memmove+0x2b>
+    *dst++ = *src++;
+ 36e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 371:	8d 42 01             	lea    0x1(%edx),%eax
+ 374:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 377:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 37a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 37d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 380:	0f b6 12             	movzbl (%edx),%edx
+ 383:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 385:	8b 45 10             	mov    0x10(%ebp),%eax
+ 388:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 38b:	89 55 10             	mov    %edx,0x10(%ebp)
+ 38e:	85 c0                	test   %eax,%eax
+ 390:	7f dc                	jg     36e <memmove+0x14>
+  return vdst;
+ 392:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 395:	c9                   	leave
+ 396:	c3                   	ret
+
+00000397 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 397:	55                   	push   %ebp
+ 398:	89 e5                	mov    %esp,%ebp
+ 39a:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 39d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3a4:	eb 04                	jmp    3aa <ncpus+0x13>
+ 3a6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 3aa:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 3ae:	7f 16                	jg     3c6 <ncpus+0x2f>
+ 3b0:	83 ec 08             	sub    $0x8,%esp
+ 3b3:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 3b6:	50                   	push   %eax
+ 3b7:	ff 75 f4             	push   -0xc(%ebp)
+ 3ba:	e8 d6 00 00 00       	call   495 <intrstat>
+ 3bf:	83 c4 10             	add    $0x10,%esp
+ 3c2:	85 c0                	test   %eax,%eax
+ 3c4:	74 e0                	je     3a6 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 3c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c9:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3ce:	85 c0                	test   %eax,%eax
+ 3d0:	0f 4e c2             	cmovle %edx,%eax
+}
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+
+000003d5 <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 3d5:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <exit>:
+SYSCALL(exit)
+ 3dd:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3e2:	cd 40                	int    $0x40
+ 3e4:	c3                   	ret
+
+000003e5 <wait>:
+SYSCALL(wait)
+ 3e5:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <pipe>:
+SYSCALL(pipe)
+ 3ed:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <read>:
+SYSCALL(read)
+ 3f5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3fa:	cd 40                	int    $0x40
+ 3fc:	c3                   	ret
+
+000003fd <write>:
+SYSCALL(write)
+ 3fd:	b8 10 00 00 00       	mov    $0x10,%eax
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <close>:
+SYSCALL(close)
+ 405:	b8 15 00 00 00       	mov    $0x15,%eax
+ 40a:	cd 40                	int    $0x40
+ 40c:	c3                   	ret
+
+0000040d <kill>:
+SYSCALL(kill)
+ 40d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 412:	cd 40                	int    $0x40
+ 414:	c3                   	ret
+
+00000415 <exec>:
+SYSCALL(exec)
+ 415:	b8 07 00 00 00       	mov    $0x7,%eax
+ 41a:	cd 40                	int    $0x40
+ 41c:	c3                   	ret
+
+0000041d <open>:
+SYSCALL(open)
+ 41d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 422:	cd 40                	int    $0x40
+ 424:	c3                   	ret
+
+00000425 <mknod>:
+SYSCALL(mknod)
+ 425:	b8 11 00 00 00       	mov    $0x11,%eax
+ 42a:	cd 40                	int    $0x40
+ 42c:	c3                   	ret
+
+0000042d <unlink>:
+SYSCALL(unlink)
+ 42d:	b8 12 00 00 00       	mov    $0x12,%eax
+ 432:	cd 40                	int    $0x40
+ 434:	c3                   	ret
+
+00000435 <fstat>:
+SYSCALL(fstat)
+ 435:	b8 08 00 00 00       	mov    $0x8,%eax
+ 43a:	cd 40                	int    $0x40
+ 43c:	c3                   	ret
+
+0000043d <link>:
+SYSCALL(link)
+ 43d:	b8 13 00 00 00       	mov    $0x13,%eax
+ 442:	cd 40                	int    $0x40
+ 444:	c3                   	ret
+
+00000445 <mkdir>:
+SYSCALL(mkdir)
+ 445:	b8 14 00 00 00       	mov    $0x14,%eax
+ 44a:	cd 40                	int    $0x40
+ 44c:	c3                   	ret
+
+0000044d <chdir>:
+SYSCALL(chdir)
+ 44d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 452:	cd 40                	int    $0x40
+ 454:	c3                   	ret
+
+00000455 <dup>:
+SYSCALL(dup)
+ 455:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 45a:	cd 40                	int    $0x40
+ 45c:	c3                   	ret
+
+0000045d <getpid>:
+SYSCALL(getpid)
+ 45d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 462:	cd 40                	int    $0x40
+ 464:	c3                   	ret
+
+00000465 <sbrk>:
+SYSCALL(sbrk)
+ 465:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 46a:	cd 40                	int    $0x40
+ 46c:	c3                   	ret
+
+0000046d <sleep>:
+SYSCALL(sleep)
+ 46d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 472:	cd 40                	int    $0x40
+ 474:	c3                   	ret
+
+00000475 <uptime>:
+SYSCALL(uptime)
+ 475:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <poll>:
+SYSCALL(poll)
+ 47d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 482:	cd 40                	int    $0x40
+ 484:	c3                   	ret
+
+00000485 <fcntl>:
+SYSCALL(fcntl)
+ 485:	b8 17 00 00 00       	mov    $0x17,%eax
+ 48a:	cd 40                	int    $0x40
+ 48c:	c3                   	ret
+
+0000048d <irqroute>:
+SYSCALL(irqroute)
+ 48d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 492:	cd 40                	int    $0x40
+ 494:	c3                   	ret
+
+00000495 <intrstat>:
+SYSCALL(intrstat)
+ 495:	b8 19 00 00 00       	mov    $0x19,%eax
+ 49a:	cd 40                	int    $0x40
+ 49c:	c3                   	ret
+
+0000049d <pread>:
+SYSCALL(pread)
+ 49d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4a2:	cd 40                	int    $0x40
+ 4a4:	c3                   	ret
+
+000004a5 <getdents>:
+SYSCALL(getdents)
+ 4a5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4aa:	cd 40                	int    $0x40
+ 4ac:	c3                   	ret
+
+000004ad <fstatat>:
+SYSCALL(fstatat)
+ 4ad:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <openat>:
+SYSCALL(openat)
+ 4b5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4ba:	cd 40                	int    $0x40
+ 4bc:	c3                   	ret
+
+000004bd <unlinkat>:
+SYSCALL(unlinkat)
+ 4bd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <mkdirat>:
+SYSCALL(mkdirat)
+ 4c5:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4ca:	cd 40                	int    $0x40
+ 4cc:	c3                   	ret
+
+000004cd <linkat>:
+SYSCALL(linkat)
+ 4cd:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4d2:	cd 40                	int    $0x40
+ 4d4:	c3                   	ret
+
+000004d5 <exits>:
+SYSCALL(exits)
+ 4d5:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4da:	cd 40                	int    $0x40
+ 4dc:	c3                   	ret
+
+000004dd <waitstatus>:
+SYSCALL(waitstatus)
+ 4dd:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4e2:	cd 40                	int    $0x40
+ 4e4:	c3                   	ret
+
+000004e5 <pwrite>:
+SYSCALL(pwrite)
+ 4e5:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4ea:	cd 40                	int    $0x40
+ 4ec:	c3                   	ret
+
+000004ed <lseek>:
+SYSCALL(lseek)
+ 4ed:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4f2:	cd 40                	int    $0x40
+ 4f4:	c3                   	ret
+
+000004f5 <copyfilerange>:
+SYSCALL(copyfilerange)
+ 4f5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4fa:	cd 40                	int    $0x40
+ 4fc:	c3                   	ret
+
+000004fd <fsctl>:
+SYSCALL(fsctl)
+ 4fd:	b8 26 00 00 00       	mov    $0x26,%eax
+ 502:	cd 40                	int    $0x40
+ 504:	c3                   	ret
+
+00000505 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 505:	55                   	push   %ebp
+ 506:	89 e5                	mov    %esp,%ebp
+ 508:	83 ec 18             	sub    $0x18,%esp
+ 50b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 50e:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 511:	83 ec 04             	sub    $0x4,%esp
+ 514:	6a 01                	push   $0x1
+ 516:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 519:	50                   	push   %eax
+ 51a:	ff 75 08             	push   0x8(%ebp)
+ 51d:	e8 db fe ff ff       	call   3fd <write>
+ 522:	83 c4 10             	add    $0x10,%esp
+}
+ 525:	90                   	nop
+ 526:	c9                   	leave
+ 527:	c3                   	ret
+
+00000528 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 528:	55                   	push   %ebp
+ 529:	89 e5                	mov    %esp,%ebp
+ 52b:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 52e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 535:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 539:	74 17                	je     552 <printint+0x2a>
+ 53b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 53f:	79 11                	jns    552 <printint+0x2a>
+    neg = 1;
+ 541:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 548:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 54b:	f7 d8                	neg    %eax
+ 54d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 550:	eb 06                	jmp    558 <printint+0x30>
+  } else {
+    x = xx;
+ 552:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 555:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 558:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 55f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 562:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 565:	ba 00 00 00 00       	mov    $0x0,%edx
+ 56a:	f7 f1                	div    %ecx
+ 56c:	89 d1                	mov    %edx,%ecx
+ 56e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 571:	8d 50 01             	lea    0x1(%eax),%edx
+ 574:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 577:	0f b6 91 58 0c 00 00 	movzbl 0xc58(%ecx),%edx
+ 57e:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 582:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 585:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 588:	ba 00 00 00 00       	mov    $0x0,%edx
+ 58d:	f7 f1                	div    %ecx
+ 58f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 592:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 596:	75 c7                	jne    55f <printint+0x37>
+  if(neg)
+ 598:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 59c:	74 2d                	je     5cb <printint+0xa3>
+    buf[i++] = '-';
+ 59e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a1:	8d 50 01             	lea    0x1(%eax),%edx
+ 5a4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5a7:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5ac:	eb 1d                	jmp    5cb <printint+0xa3>
+    putc(fd, buf[i]);
+ 5ae:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5b4:	01 d0                	add    %edx,%eax
+ 5b6:	0f b6 00             	movzbl (%eax),%eax
+ 5b9:	0f be c0             	movsbl %al,%eax
+ 5bc:	83 ec 08             	sub    $0x8,%esp
+ 5bf:	50                   	push   %eax
+ 5c0:	ff 75 08             	push   0x8(%ebp)
+ 5c3:	e8 3d ff ff ff       	call   505 <putc>
+ 5c8:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 5cb:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 5cf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5d3:	79 d9                	jns    5ae <printint+0x86>
+}
+ 5d5:	90                   	nop
+ 5d6:	90                   	nop
+ 5d7:	c9                   	leave
+ 5d8:	c3                   	ret
+
+000005d9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5d9:	55                   	push   %ebp
+ 5da:	89 e5                	mov    %esp,%ebp
+ 5dc:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 5df:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 5e6:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5e9:	83 c0 04             	add    $0x4,%eax
+ 5ec:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5ef:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 5f6:	e9 59 01 00 00       	jmp    754 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 5fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 601:	01 d0                	add    %edx,%eax
+ 603:	0f b6 00             	movzbl (%eax),%eax
+ 606:	0f be c0             	movsbl %al,%eax
+ 609:	25 ff 00 00 00       	and    $0xff,%eax
+ 60e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 611:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 615:	75 2c                	jne    643 <printf+0x6a>
+      if(c == '%'){
+ 617:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 61b:	75 0c                	jne    629 <printf+0x50>
+        state = '%';
+ 61d:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 624:	e9 27 01 00 00       	jmp    750 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 629:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 62c:	0f be c0             	movsbl %al,%eax
+ 62f:	83 ec 08             	sub    $0x8,%esp
+ 632:	50                   	push   %eax
+ 633:	ff 75 08             	push   0x8(%ebp)
+ 636:	e8 ca fe ff ff       	call   505 <putc>
+ 63b:	83 c4 10             	add    $0x10,%esp
+ 63e:	e9 0d 01 00 00       	jmp    750 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 643:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 647:	0f 85 03 01 00 00    	jne    750 <printf+0x177>
+      if(c == 'd'){
+ 64d:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 651:	75 1e                	jne    671 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 653:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 656:	8b 00                	mov    (%eax),%eax
+ 658:	6a 01                	push   $0x1
+ 65a:	6a 0a                	push   $0xa
+ 65c:	50                   	push   %eax
+ 65d:	ff 75 08             	push   0x8(%ebp)
+ 660:	e8 c3 fe ff ff       	call   528 <printint>
+ 665:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 668:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 66c:	e9 d8 00 00 00       	jmp    749 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 671:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 675:	74 06                	je     67d <printf+0xa4>
+ 677:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 67b:	75 1e                	jne    69b <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 67d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 680:	8b 00                	mov    (%eax),%eax
+ 682:	6a 00                	push   $0x0
+ 684:	6a 10                	push   $0x10
+ 686:	50                   	push   %eax
+ 687:	ff 75 08             	push   0x8(%ebp)
+ 68a:	e8 99 fe ff ff       	call   528 <printint>
+ 68f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 692:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 696:	e9 ae 00 00 00       	jmp    749 <printf+0x170>
+      } else if(c == 's'){
+ 69b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 69f:	75 43                	jne    6e4 <printf+0x10b>
+        s = (char*)*ap;
+ 6a1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a4:	8b 00                	mov    (%eax),%eax
+ 6a6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6a9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6ad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6b1:	75 25                	jne    6d8 <printf+0xff>
+          s = "(null)";
+ 6b3:	c7 45 f4 e3 09 00 00 	movl   $0x9e3,-0xc(%ebp)
+        while(*s != 0){
+ 6ba:	eb 1c                	jmp    6d8 <printf+0xff>
+          putc(fd, *s);
+ 6bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6bf:	0f b6 00             	movzbl (%eax),%eax
+ 6c2:	0f be c0             	movsbl %al,%eax
+ 6c5:	83 ec 08             	sub    $0x8,%esp
+ 6c8:	50                   	push   %eax
+ 6c9:	ff 75 08             	push   0x8(%ebp)
+ 6cc:	e8 34 fe ff ff       	call   505 <putc>
+ 6d1:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 6d4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 6d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6db:	0f b6 00             	movzbl (%eax),%eax
+ 6de:	84 c0                	test   %al,%al
+ 6e0:	75 da                	jne    6bc <printf+0xe3>
+ 6e2:	eb 65                	jmp    749 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 6e4:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6e8:	75 1d                	jne    707 <printf+0x12e>
+        putc(fd, *ap);
+ 6ea:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ed:	8b 00                	mov    (%eax),%eax
+ 6ef:	0f be c0             	movsbl %al,%eax
+ 6f2:	83 ec 08             	sub    $0x8,%esp
+ 6f5:	50                   	push   %eax
+ 6f6:	ff 75 08             	push   0x8(%ebp)
+ 6f9:	e8 07 fe ff ff       	call   505 <putc>
+ 6fe:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 701:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 705:	eb 42                	jmp    749 <printf+0x170>
+      } else if(c == '%'){
+ 707:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 70b:	75 17                	jne    724 <printf+0x14b>
+        putc(fd, c);
+ 70d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 710:	0f be c0             	movsbl %al,%eax
+ 713:	83 ec 08             	sub    $0x8,%esp
+ 716:	50                   	push   %eax
+ 717:	ff 75 08             	push   0x8(%ebp)
+ 71a:	e8 e6 fd ff ff       	call   505 <putc>
+ 71f:	83 c4 10             	add    $0x10,%esp
+ 722:	eb 25                	jmp    749 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 724:	83 ec 08             	sub    $0x8,%esp
+ 727:	6a 25                	push   $0x25
+ 729:	ff 75 08             	push   0x8(%ebp)
+ 72c:	e8 d4 fd ff ff       	call   505 <putc>
+ 731:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 734:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 737:	0f be c0             	movsbl %al,%eax
+ 73a:	83 ec 08             	sub    $0x8,%esp
+ 73d:	50                   	push   %eax
+ 73e:	ff 75 08             	push   0x8(%ebp)
+ 741:	e8 bf fd ff ff       	call   505 <putc>
+ 746:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 749:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 750:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 754:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 757:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 75a:	01 d0                	add    %edx,%eax
+ 75c:	0f b6 00             	movzbl (%eax),%eax
+ 75f:	84 c0                	test   %al,%al
+ 761:	0f 85 94 fe ff ff    	jne    5fb <printf+0x22>
+    }
+  }
+}
+ 767:	90                   	nop
+ 768:	90                   	nop
+ 769:	c9                   	leave
+ 76a:	c3                   	ret
+
+0000076b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 76b:	55                   	push   %ebp
+ 76c:	89 e5                	mov    %esp,%ebp
+ 76e:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 771:	8b 45 08             	mov    0x8(%ebp),%eax
+ 774:	83 e8 08             	sub    $0x8,%eax
+ 777:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 77a:	a1 74 0c 00 00       	mov    0xc74,%eax
+ 77f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 782:	eb 24                	jmp    7a8 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 784:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 787:	8b 00                	mov    (%eax),%eax
+ 789:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 78c:	72 12                	jb     7a0 <free+0x35>
+ 78e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 791:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 794:	72 24                	jb     7ba <free+0x4f>
+ 796:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 799:	8b 00                	mov    (%eax),%eax
+ 79b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 79e:	72 1a                	jb     7ba <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a3:	8b 00                	mov    (%eax),%eax
+ 7a5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7a8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ab:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7ae:	73 d4                	jae    784 <free+0x19>
+ 7b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b3:	8b 00                	mov    (%eax),%eax
+ 7b5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7b8:	73 ca                	jae    784 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7ba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7bd:	8b 40 04             	mov    0x4(%eax),%eax
+ 7c0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7c7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ca:	01 c2                	add    %eax,%edx
+ 7cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cf:	8b 00                	mov    (%eax),%eax
+ 7d1:	39 c2                	cmp    %eax,%edx
+ 7d3:	75 24                	jne    7f9 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 7d5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7d8:	8b 50 04             	mov    0x4(%eax),%edx
+ 7db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7de:	8b 00                	mov    (%eax),%eax
+ 7e0:	8b 40 04             	mov    0x4(%eax),%eax
+ 7e3:	01 c2                	add    %eax,%edx
+ 7e5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e8:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ee:	8b 00                	mov    (%eax),%eax
+ 7f0:	8b 10                	mov    (%eax),%edx
+ 7f2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f5:	89 10                	mov    %edx,(%eax)
+ 7f7:	eb 0a                	jmp    803 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7f9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fc:	8b 10                	mov    (%eax),%edx
+ 7fe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 801:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 803:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 806:	8b 40 04             	mov    0x4(%eax),%eax
+ 809:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 810:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 813:	01 d0                	add    %edx,%eax
+ 815:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 818:	75 20                	jne    83a <free+0xcf>
+    p->s.size += bp->s.size;
+ 81a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81d:	8b 50 04             	mov    0x4(%eax),%edx
+ 820:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 823:	8b 40 04             	mov    0x4(%eax),%eax
+ 826:	01 c2                	add    %eax,%edx
+ 828:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 82b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 82e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 831:	8b 10                	mov    (%eax),%edx
+ 833:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 836:	89 10                	mov    %edx,(%eax)
+ 838:	eb 08                	jmp    842 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 83a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 83d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 840:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 842:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 845:	a3 74 0c 00 00       	mov    %eax,0xc74
+}
+ 84a:	90                   	nop
+ 84b:	c9                   	leave
+ 84c:	c3                   	ret
+
+0000084d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 84d:	55                   	push   %ebp
+ 84e:	89 e5                	mov    %esp,%ebp
+ 850:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 853:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 85a:	77 07                	ja     863 <morecore+0x16>
+    nu = 4096;
+ 85c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 863:	8b 45 08             	mov    0x8(%ebp),%eax
+ 866:	c1 e0 03             	shl    $0x3,%eax
+ 869:	83 ec 0c             	sub    $0xc,%esp
+ 86c:	50                   	push   %eax
+ 86d:	e8 f3 fb ff ff       	call   465 <sbrk>
+ 872:	83 c4 10             	add    $0x10,%esp
+ 875:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 878:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 87c:	75 07                	jne    885 <morecore+0x38>
+    return 0;
+ 87e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 883:	eb 26                	jmp    8ab <morecore+0x5e>
+  hp = (Header*)p;
+ 885:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 888:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 88b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88e:	8b 55 08             	mov    0x8(%ebp),%edx
+ 891:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 894:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 897:	83 c0 08             	add    $0x8,%eax
+ 89a:	83 ec 0c             	sub    $0xc,%esp
+ 89d:	50                   	push   %eax
+ 89e:	e8 c8 fe ff ff       	call   76b <free>
+ 8a3:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8a6:	a1 74 0c 00 00       	mov    0xc74,%eax
+}
+ 8ab:	c9                   	leave
+ 8ac:	c3                   	ret
+
+000008ad <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8ad:	55                   	push   %ebp
+ 8ae:	89 e5                	mov    %esp,%ebp
+ 8b0:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b6:	83 c0 07             	add    $0x7,%eax
+ 8b9:	c1 e8 03             	shr    $0x3,%eax
+ 8bc:	83 c0 01             	add    $0x1,%eax
+ 8bf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 8c2:	a1 74 0c 00 00       	mov    0xc74,%eax
+ 8c7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8ca:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8ce:	75 23                	jne    8f3 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 8d0:	c7 45 f0 6c 0c 00 00 	movl   $0xc6c,-0x10(%ebp)
+ 8d7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8da:	a3 74 0c 00 00       	mov    %eax,0xc74
+ 8df:	a1 74 0c 00 00       	mov    0xc74,%eax
+ 8e4:	a3 6c 0c 00 00       	mov    %eax,0xc6c
+    base.s.size = 0;
+ 8e9:	c7 05 70 0c 00 00 00 	movl   $0x0,0xc70
+ 8f0:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8f6:	8b 00                	mov    (%eax),%eax
+ 8f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8fe:	8b 40 04             	mov    0x4(%eax),%eax
+ 901:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 904:	72 4d                	jb     953 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 906:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 909:	8b 40 04             	mov    0x4(%eax),%eax
+ 90c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 90f:	75 0c                	jne    91d <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 911:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 914:	8b 10                	mov    (%eax),%edx
+ 916:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 919:	89 10                	mov    %edx,(%eax)
+ 91b:	eb 26                	jmp    943 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 91d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 920:	8b 40 04             	mov    0x4(%eax),%eax
+ 923:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 926:	89 c2                	mov    %eax,%edx
+ 928:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 92b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 92e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 931:	8b 40 04             	mov    0x4(%eax),%eax
+ 934:	c1 e0 03             	shl    $0x3,%eax
+ 937:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 93a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 940:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 943:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 946:	a3 74 0c 00 00       	mov    %eax,0xc74
+      return (void*)(p + 1);
+ 94b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 94e:	83 c0 08             	add    $0x8,%eax
+ 951:	eb 3b                	jmp    98e <malloc+0xe1>
+    }
+    if(p == freep)
+ 953:	a1 74 0c 00 00       	mov    0xc74,%eax
+ 958:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 95b:	75 1e                	jne    97b <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 95d:	83 ec 0c             	sub    $0xc,%esp
+ 960:	ff 75 ec             	push   -0x14(%ebp)
+ 963:	e8 e5 fe ff ff       	call   84d <morecore>
+ 968:	83 c4 10             	add    $0x10,%esp
+ 96b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 96e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 972:	75 07                	jne    97b <malloc+0xce>
+        return 0;
+ 974:	b8 00 00 00 00       	mov    $0x0,%eax
+ 979:	eb 13                	jmp    98e <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 97b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 981:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 984:	8b 00                	mov    (%eax),%eax
+ 986:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 989:	e9 6d ff ff ff       	jmp    8fb <malloc+0x4e>
+  }
+}
+ 98e:	c9                   	leave
+ 98f:	c3                   	ret
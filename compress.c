@@ -0,0 +1,39 @@
+// Compress files in place.
+//   compress file ...
+// Stores each file's clusters compressed where that saves
+// blocks, with fsctl(FS_COMPRESS), and prints
+//   <file> <blocks before> <blocks after>
+// Reading a compressed file decompresses it on the way; writing
+// part of a compressed cluster stores that cluster uncompressed
+// again, until the file is compressed once more.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fsctl.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct extents e0, e1;
+  int i, fd;
+
+  if(argc < 2){
+    printf(2, "usage: compress file ...\n");
+    exit();
+  }
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], O_RDWR)) < 0){
+      printf(2, "compress: cannot open %s\n", argv[i]);
+      continue;
+    }
+    if(fsctl(fd, FS_EXTENTS, &e0) < 0 || fsctl(fd, FS_COMPRESS, 0) < 0 ||
+       fsctl(fd, FS_EXTENTS, &e1) < 0)
+      printf(2, "compress: %s failed\n", argv[i]);
+    else
+      printf(1, "%s %d %d\n", argv[i], e0.nblocks, e1.nblocks);
+    close(fd);
+  }
+  exit();
+}
@@ -13,6 +13,8 @@
 #include "mmu.h"
 #include "proc.h"
 #include "x86.h"
+#include "poll.h"
+#include "fcntl.h"
 
 static void consputc(int);
 
@@ -184,48 +186,109 @@ struct {
 
 #define C(x)  ((x)-'@')  // Control-x
 
+// Characters taken from the keyboard or serial port by
+// consoleintr(), waiting for consolesoftirq() to run them
+// through the line discipline.
+#define RAW_BUF 128
+static struct {
+  struct spinlock lock;
+  uchar buf[RAW_BUF];
+  uint r;  // Read index
+  uint w;  // Write index
+} raw;
+
+// Interrupt handler: just drain the device, which must be done
+// before the interrupt is acknowledged.  Editing, echo and
+// wakeups happen later in consolesoftirq().
 void
 consoleintr(int (*getc)(void))
 {
   int c;
 
-  acquire(&input.lock);
+  acquire(&raw.lock);
   while((c = getc()) >= 0){
-    switch(c){
-    case C('P'):  // Process listing.
-      procdump();
-      break;
-    case C('U'):  // Kill line.
-      while(input.e != input.w &&
-            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
-        input.e--;
-        consputc(BACKSPACE);
-      }
-      break;
-    case C('H'): case '\x7f':  // Backspace
-      if(input.e != input.w){
-        input.e--;
-        consputc(BACKSPACE);
-      }
-      break;
-    default:
-      if(c != 0 && input.e-input.r < INPUT_BUF){
-        c = (c == '\r') ? '\n' : c;
-        input.buf[input.e++ % INPUT_BUF] = c;
-        consputc(c);
-        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
-          input.w = input.e;
-          wakeup(&input.r);
+    if(raw.w - raw.r < RAW_BUF)
+      raw.buf[raw.w++ % RAW_BUF] = c;
+  }
+  release(&raw.lock);
+  raisesoftirq(SOFTIRQ_CONSOLE);
+}
+
+static int
+rawgetc(void)
+{
+  int c;
+
+  acquire(&raw.lock);
+  c = -1;
+  if(raw.r != raw.w)
+    c = raw.buf[raw.r++ % RAW_BUF];
+  release(&raw.lock);
+  return c;
+}
+
+// Line discipline.  Echo is collected while input.lock is held
+// and written to the screen and serial port (slow) after it is
+// released.  Backspace is recorded as '\b', which is never
+// echoed literally.
+static void
+consolesoftirq(void)
+{
+  char echo[2*INPUT_BUF];
+  int c, i, n, dump;
+
+  do {
+    n = 0;
+    dump = 0;
+    acquire(&input.lock);
+    // A character echoes at most INPUT_BUF backspaces (^U).
+    while(n <= INPUT_BUF && (c = rawgetc()) >= 0){
+      switch(c){
+      case C('P'):  // Process listing.
+        dump = 1;
+        break;
+      case C('U'):  // Kill line.
+        while(input.e != input.w &&
+              input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+          input.e--;
+          echo[n++] = '\b';
+        }
+        break;
+      case C('H'): case '\x7f':  // Backspace
+        if(input.e != input.w){
+          input.e--;
+          echo[n++] = '\b';
+        }
+        break;
+      default:
+        if(c != 0 && input.e-input.r < INPUT_BUF){
+          c = (c == '\r') ? '\n' : c;
+          input.buf[input.e++ % INPUT_BUF] = c;
+          echo[n++] = c;
+          if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+            input.w = input.e;
+            wakeup(&input.r);
+            pollwakeup();
+          }
         }
+        break;
       }
-      break;
     }
-  }
-  release(&input.lock);
+    release(&input.lock);
+
+    acquire(&cons.lock);
+    for(i = 0; i < n; i++)
+      consputc(echo[i] == '\b' ? BACKSPACE : echo[i] & 0xff);
+    release(&cons.lock);
+    if(dump)
+      procdump();
+  } while(c >= 0);
 }
 
+// Read up to a line.  With nonblock, return what is there
+// instead of sleeping, or -EAGAIN if nothing is.
 int
-consoleread(struct inode *ip, char *dst, int n)
+consoleread(struct inode *ip, char *dst, int n, int nonblock)
 {
   uint target;
   int c;
@@ -234,6 +297,13 @@ consoleread(struct inode *ip, char *dst, int n)
   target = n;
   acquire(&input.lock);
   while(n > 0){
+    if(nonblock && input.r == input.w){
+      if(n < target)
+        break;
+      release(&input.lock);
+      ilock(ip);
+      return -EAGAIN;
+    }
     while(input.r == input.w){
       if(proc->killed){
         release(&input.lock);
@@ -277,16 +347,32 @@ consolewrite(struct inode *ip, char *buf, int n)
   return n;
 }
 
+int
+consolepoll(struct inode *ip)
+{
+  int r;
+
+  acquire(&input.lock);
+  r = POLLOUT;
+  if(input.r != input.w)
+    r |= POLLIN;
+  release(&input.lock);
+  return r;
+}
+
 void
 consoleinit(void)
 {
   // ロックの初期化
   initlock(&cons.lock, "console");
   initlock(&input.lock, "input");
+  initlock(&raw.lock, "rawinput");
+  setsoftirq(SOFTIRQ_CONSOLE, consolesoftirq);
 
   // 関数ポインタの設定を行う　
   devsw[CONSOLE].write = consolewrite;
   devsw[CONSOLE].read = consoleread;
+  devsw[CONSOLE].poll = consolepoll;
   cons.locking = 1;
 
   // ユニプロセッサ上で割り込みを有効にする
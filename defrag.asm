@@ -0,0 +1,1725 @@
+
+_defrag:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <file>:
+
+// Directories can only be opened for reading, so walk does;
+// FS_DEFRAG needs the file opened for writing.
+void
+file(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  struct extents e;
+  int wfd;
+
+  if(fsctl(fd, FS_EXTENTS, &e) < 0){
+   6:	83 ec 04             	sub    $0x4,%esp
+   9:	8d 45 e8             	lea    -0x18(%ebp),%eax
+   c:	50                   	push   %eax
+   d:	6a 01                	push   $0x1
+   f:	ff 75 08             	push   0x8(%ebp)
+  12:	e8 c5 08 00 00       	call   8dc <fsctl>
+  17:	83 c4 10             	add    $0x10,%esp
+  1a:	85 c0                	test   %eax,%eax
+  1c:	79 1c                	jns    3a <file+0x3a>
+    printf(2, "defrag: cannot map %s\n", path);
+  1e:	83 ec 04             	sub    $0x4,%esp
+  21:	68 20 11 00 00       	push   $0x1120
+  26:	68 70 0d 00 00       	push   $0xd70
+  2b:	6a 02                	push   $0x2
+  2d:	e8 86 09 00 00       	call   9b8 <printf>
+  32:	83 c4 10             	add    $0x10,%esp
+    return;
+  35:	e9 ff 00 00 00       	jmp    139 <file+0x139>
+  }
+  nfile++;
+  3a:	a1 24 13 00 00       	mov    0x1324,%eax
+  3f:	83 c0 01             	add    $0x1,%eax
+  42:	a3 24 13 00 00       	mov    %eax,0x1324
+  nblock += e.nblocks;
+  47:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  4a:	a1 28 13 00 00       	mov    0x1328,%eax
+  4f:	01 d0                	add    %edx,%eax
+  51:	a3 28 13 00 00       	mov    %eax,0x1328
+  nextent += e.nextents;
+  56:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  59:	a1 2c 13 00 00       	mov    0x132c,%eax
+  5e:	01 d0                	add    %edx,%eax
+  60:	a3 2c 13 00 00       	mov    %eax,0x132c
+  if(e.nextents <= 1)
+  65:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  68:	83 f8 01             	cmp    $0x1,%eax
+  6b:	0f 8e c7 00 00 00    	jle    138 <file+0x138>
+    return;
+  printf(1, "%s %d %d", path, e.nblocks, e.nextents);
+  71:	8b 55 ec             	mov    -0x14(%ebp),%edx
+  74:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  77:	83 ec 0c             	sub    $0xc,%esp
+  7a:	52                   	push   %edx
+  7b:	50                   	push   %eax
+  7c:	68 20 11 00 00       	push   $0x1120
+  81:	68 87 0d 00 00       	push   $0xd87
+  86:	6a 01                	push   $0x1
+  88:	e8 2b 09 00 00       	call   9b8 <printf>
+  8d:	83 c4 20             	add    $0x20,%esp
+  if(!dryrun){
+  90:	a1 20 13 00 00       	mov    0x1320,%eax
+  95:	85 c0                	test   %eax,%eax
+  97:	0f 85 87 00 00 00    	jne    124 <file+0x124>
+    if((wfd = open(path, O_RDWR)) < 0 || fsctl(wfd, FS_DEFRAG, 0) < 0)
+  9d:	83 ec 08             	sub    $0x8,%esp
+  a0:	6a 02                	push   $0x2
+  a2:	68 20 11 00 00       	push   $0x1120
+  a7:	e8 50 07 00 00       	call   7fc <open>
+  ac:	83 c4 10             	add    $0x10,%esp
+  af:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  b6:	78 16                	js     ce <file+0xce>
+  b8:	83 ec 04             	sub    $0x4,%esp
+  bb:	6a 00                	push   $0x0
+  bd:	6a 02                	push   $0x2
+  bf:	ff 75 f4             	push   -0xc(%ebp)
+  c2:	e8 15 08 00 00       	call   8dc <fsctl>
+  c7:	83 c4 10             	add    $0x10,%esp
+  ca:	85 c0                	test   %eax,%eax
+  cc:	79 14                	jns    e2 <file+0xe2>
+      printf(1, " failed");
+  ce:	83 ec 08             	sub    $0x8,%esp
+  d1:	68 90 0d 00 00       	push   $0xd90
+  d6:	6a 01                	push   $0x1
+  d8:	e8 db 08 00 00       	call   9b8 <printf>
+  dd:	83 c4 10             	add    $0x10,%esp
+  e0:	eb 2e                	jmp    110 <file+0x110>
+    else if(fsctl(wfd, FS_EXTENTS, &e) == 0)
+  e2:	83 ec 04             	sub    $0x4,%esp
+  e5:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  e8:	50                   	push   %eax
+  e9:	6a 01                	push   $0x1
+  eb:	ff 75 f4             	push   -0xc(%ebp)
+  ee:	e8 e9 07 00 00       	call   8dc <fsctl>
+  f3:	83 c4 10             	add    $0x10,%esp
+  f6:	85 c0                	test   %eax,%eax
+  f8:	75 16                	jne    110 <file+0x110>
+      printf(1, " -> %d", e.nextents);
+  fa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  fd:	83 ec 04             	sub    $0x4,%esp
+ 100:	50                   	push   %eax
+ 101:	68 98 0d 00 00       	push   $0xd98
+ 106:	6a 01                	push   $0x1
+ 108:	e8 ab 08 00 00       	call   9b8 <printf>
+ 10d:	83 c4 10             	add    $0x10,%esp
+    if(wfd >= 0)
+ 110:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 114:	78 0e                	js     124 <file+0x124>
+      close(wfd);
+ 116:	83 ec 0c             	sub    $0xc,%esp
+ 119:	ff 75 f4             	push   -0xc(%ebp)
+ 11c:	e8 c3 06 00 00       	call   7e4 <close>
+ 121:	83 c4 10             	add    $0x10,%esp
+  }
+  printf(1, "\n");
+ 124:	83 ec 08             	sub    $0x8,%esp
+ 127:	68 9f 0d 00 00       	push   $0xd9f
+ 12c:	6a 01                	push   $0x1
+ 12e:	e8 85 08 00 00       	call   9b8 <printf>
+ 133:	83 c4 10             	add    $0x10,%esp
+ 136:	eb 01                	jmp    139 <file+0x139>
+    return;
+ 138:	90                   	nop
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <walk>:
+
+// Visit path, which is len bytes long, and everything under it.
+void
+walk(int len)
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+ 13e:	81 ec 38 01 00 00    	sub    $0x138,%esp
+  struct dirent de[16];
+  struct stat st;
+  int fd, i, n;
+  char *p;
+
+  if((fd = open(path, 0)) < 0){
+ 144:	83 ec 08             	sub    $0x8,%esp
+ 147:	6a 00                	push   $0x0
+ 149:	68 20 11 00 00       	push   $0x1120
+ 14e:	e8 a9 06 00 00       	call   7fc <open>
+ 153:	83 c4 10             	add    $0x10,%esp
+ 156:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 159:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 15d:	79 1c                	jns    17b <walk+0x40>
+    printf(2, "defrag: cannot open %s\n", path);
+ 15f:	83 ec 04             	sub    $0x4,%esp
+ 162:	68 20 11 00 00       	push   $0x1120
+ 167:	68 a1 0d 00 00       	push   $0xda1
+ 16c:	6a 02                	push   $0x2
+ 16e:	e8 45 08 00 00       	call   9b8 <printf>
+ 173:	83 c4 10             	add    $0x10,%esp
+    return;
+ 176:	e9 c3 01 00 00       	jmp    33e <walk+0x203>
+  }
+  if(fstat(fd, &st) < 0){
+ 17b:	83 ec 08             	sub    $0x8,%esp
+ 17e:	8d 85 d4 fe ff ff    	lea    -0x12c(%ebp),%eax
+ 184:	50                   	push   %eax
+ 185:	ff 75 ec             	push   -0x14(%ebp)
+ 188:	e8 87 06 00 00       	call   814 <fstat>
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	85 c0                	test   %eax,%eax
+ 192:	79 2a                	jns    1be <walk+0x83>
+    printf(2, "defrag: cannot stat %s\n", path);
+ 194:	83 ec 04             	sub    $0x4,%esp
+ 197:	68 20 11 00 00       	push   $0x1120
+ 19c:	68 b9 0d 00 00       	push   $0xdb9
+ 1a1:	6a 02                	push   $0x2
+ 1a3:	e8 10 08 00 00       	call   9b8 <printf>
+ 1a8:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 1ab:	83 ec 0c             	sub    $0xc,%esp
+ 1ae:	ff 75 ec             	push   -0x14(%ebp)
+ 1b1:	e8 2e 06 00 00       	call   7e4 <close>
+ 1b6:	83 c4 10             	add    $0x10,%esp
+    return;
+ 1b9:	e9 80 01 00 00       	jmp    33e <walk+0x203>
+  }
+  if(st.type == T_FILE)
+ 1be:	0f b7 85 d4 fe ff ff 	movzwl -0x12c(%ebp),%eax
+ 1c5:	66 83 f8 02          	cmp    $0x2,%ax
+ 1c9:	75 13                	jne    1de <walk+0xa3>
+    file(fd);
+ 1cb:	83 ec 0c             	sub    $0xc,%esp
+ 1ce:	ff 75 ec             	push   -0x14(%ebp)
+ 1d1:	e8 2a fe ff ff       	call   0 <file>
+ 1d6:	83 c4 10             	add    $0x10,%esp
+ 1d9:	e9 52 01 00 00       	jmp    330 <walk+0x1f5>
+  else if(st.type == T_DIR){
+ 1de:	0f b7 85 d4 fe ff ff 	movzwl -0x12c(%ebp),%eax
+ 1e5:	66 83 f8 01          	cmp    $0x1,%ax
+ 1e9:	0f 85 41 01 00 00    	jne    330 <walk+0x1f5>
+    while((n = getdents(fd, de, sizeof(de))) > 0){
+ 1ef:	e9 15 01 00 00       	jmp    309 <walk+0x1ce>
+      for(i = 0; i < n/sizeof(de[0]); i++){
+ 1f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1fb:	e9 f8 00 00 00       	jmp    2f8 <walk+0x1bd>
+        if(strcmp(de[i].name, ".") == 0 || strcmp(de[i].name, "..") == 0)
+ 200:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+ 206:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 209:	c1 e2 04             	shl    $0x4,%edx
+ 20c:	01 d0                	add    %edx,%eax
+ 20e:	83 c0 02             	add    $0x2,%eax
+ 211:	83 ec 08             	sub    $0x8,%esp
+ 214:	68 d1 0d 00 00       	push   $0xdd1
+ 219:	50                   	push   %eax
+ 21a:	e8 5e 03 00 00       	call   57d <strcmp>
+ 21f:	83 c4 10             	add    $0x10,%esp
+ 222:	85 c0                	test   %eax,%eax
+ 224:	0f 84 c9 00 00 00    	je     2f3 <walk+0x1b8>
+ 22a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+ 230:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 233:	c1 e2 04             	shl    $0x4,%edx
+ 236:	01 d0                	add    %edx,%eax
+ 238:	83 c0 02             	add    $0x2,%eax
+ 23b:	83 ec 08             	sub    $0x8,%esp
+ 23e:	68 d3 0d 00 00       	push   $0xdd3
+ 243:	50                   	push   %eax
+ 244:	e8 34 03 00 00       	call   57d <strcmp>
+ 249:	83 c4 10             	add    $0x10,%esp
+ 24c:	85 c0                	test   %eax,%eax
+ 24e:	0f 84 9f 00 00 00    	je     2f3 <walk+0x1b8>
+          continue;
+        if(len + 1 + DIRSIZ + 1 > sizeof(path)){
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	83 c0 10             	add    $0x10,%eax
+ 25a:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 25f:	76 14                	jbe    275 <walk+0x13a>
+          printf(2, "defrag: path too long\n");
+ 261:	83 ec 08             	sub    $0x8,%esp
+ 264:	68 d6 0d 00 00       	push   $0xdd6
+ 269:	6a 02                	push   $0x2
+ 26b:	e8 48 07 00 00       	call   9b8 <printf>
+ 270:	83 c4 10             	add    $0x10,%esp
+          continue;
+ 273:	eb 7f                	jmp    2f4 <walk+0x1b9>
+        }
+        p = path + len;
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	05 20 11 00 00       	add    $0x1120,%eax
+ 27d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(len == 0 || p[-1] != '/')
+ 280:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 284:	74 0d                	je     293 <walk+0x158>
+ 286:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 289:	83 e8 01             	sub    $0x1,%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	3c 2f                	cmp    $0x2f,%al
+ 291:	74 0c                	je     29f <walk+0x164>
+          *p++ = '/';
+ 293:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 296:	8d 50 01             	lea    0x1(%eax),%edx
+ 299:	89 55 f0             	mov    %edx,-0x10(%ebp)
+ 29c:	c6 00 2f             	movb   $0x2f,(%eax)
+        memmove(p, de[i].name, DIRSIZ);
+ 29f:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+ 2a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2a8:	c1 e2 04             	shl    $0x4,%edx
+ 2ab:	01 d0                	add    %edx,%eax
+ 2ad:	83 c0 02             	add    $0x2,%eax
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 0e                	push   $0xe
+ 2b5:	50                   	push   %eax
+ 2b6:	ff 75 f0             	push   -0x10(%ebp)
+ 2b9:	e8 7b 04 00 00       	call   739 <memmove>
+ 2be:	83 c4 10             	add    $0x10,%esp
+        p[DIRSIZ] = 0;
+ 2c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2c4:	83 c0 0e             	add    $0xe,%eax
+ 2c7:	c6 00 00             	movb   $0x0,(%eax)
+        walk(strlen(path));
+ 2ca:	83 ec 0c             	sub    $0xc,%esp
+ 2cd:	68 20 11 00 00       	push   $0x1120
+ 2d2:	e8 e5 02 00 00       	call   5bc <strlen>
+ 2d7:	83 c4 10             	add    $0x10,%esp
+ 2da:	83 ec 0c             	sub    $0xc,%esp
+ 2dd:	50                   	push   %eax
+ 2de:	e8 58 fe ff ff       	call   13b <walk>
+ 2e3:	83 c4 10             	add    $0x10,%esp
+        path[len] = 0;
+ 2e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e9:	05 20 11 00 00       	add    $0x1120,%eax
+ 2ee:	c6 00 00             	movb   $0x0,(%eax)
+ 2f1:	eb 01                	jmp    2f4 <walk+0x1b9>
+          continue;
+ 2f3:	90                   	nop
+      for(i = 0; i < n/sizeof(de[0]); i++){
+ 2f4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2f8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2fb:	c1 e8 04             	shr    $0x4,%eax
+ 2fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 301:	39 c2                	cmp    %eax,%edx
+ 303:	0f 82 f7 fe ff ff    	jb     200 <walk+0xc5>
+    while((n = getdents(fd, de, sizeof(de))) > 0){
+ 309:	83 ec 04             	sub    $0x4,%esp
+ 30c:	68 00 01 00 00       	push   $0x100
+ 311:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+ 317:	50                   	push   %eax
+ 318:	ff 75 ec             	push   -0x14(%ebp)
+ 31b:	e8 64 05 00 00       	call   884 <getdents>
+ 320:	83 c4 10             	add    $0x10,%esp
+ 323:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 326:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 32a:	0f 8f c4 fe ff ff    	jg     1f4 <walk+0xb9>
+      }
+    }
+  }
+  close(fd);
+ 330:	83 ec 0c             	sub    $0xc,%esp
+ 333:	ff 75 ec             	push   -0x14(%ebp)
+ 336:	e8 a9 04 00 00       	call   7e4 <close>
+ 33b:	83 c4 10             	add    $0x10,%esp
+}
+ 33e:	c9                   	leave
+ 33f:	c3                   	ret
+
+00000340 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 340:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 344:	83 e4 f0             	and    $0xfffffff0,%esp
+ 347:	ff 71 fc             	push   -0x4(%ecx)
+ 34a:	55                   	push   %ebp
+ 34b:	89 e5                	mov    %esp,%ebp
+ 34d:	57                   	push   %edi
+ 34e:	56                   	push   %esi
+ 34f:	53                   	push   %ebx
+ 350:	51                   	push   %ecx
+ 351:	83 ec 18             	sub    $0x18,%esp
+ 354:	89 cb                	mov    %ecx,%ebx
+  int i, avg;
+
+  i = 1;
+ 356:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  if(i < argc && strcmp(argv[i], "-n") == 0){
+ 35d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 360:	3b 03                	cmp    (%ebx),%eax
+ 362:	7d 34                	jge    398 <main+0x58>
+ 364:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 367:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 36e:	8b 43 04             	mov    0x4(%ebx),%eax
+ 371:	01 d0                	add    %edx,%eax
+ 373:	8b 00                	mov    (%eax),%eax
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	68 ed 0d 00 00       	push   $0xded
+ 37d:	50                   	push   %eax
+ 37e:	e8 fa 01 00 00       	call   57d <strcmp>
+ 383:	83 c4 10             	add    $0x10,%esp
+ 386:	85 c0                	test   %eax,%eax
+ 388:	75 0e                	jne    398 <main+0x58>
+    dryrun = 1;
+ 38a:	c7 05 20 13 00 00 01 	movl   $0x1,0x1320
+ 391:	00 00 00 
+    i++;
+ 394:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  }
+  if(i == argc){
+ 398:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 39b:	3b 03                	cmp    (%ebx),%eax
+ 39d:	0f 85 b3 00 00 00    	jne    456 <main+0x116>
+    strcpy(path, "/");
+ 3a3:	83 ec 08             	sub    $0x8,%esp
+ 3a6:	68 f0 0d 00 00       	push   $0xdf0
+ 3ab:	68 20 11 00 00       	push   $0x1120
+ 3b0:	e8 98 01 00 00       	call   54d <strcpy>
+ 3b5:	83 c4 10             	add    $0x10,%esp
+    walk(1);
+ 3b8:	83 ec 0c             	sub    $0xc,%esp
+ 3bb:	6a 01                	push   $0x1
+ 3bd:	e8 79 fd ff ff       	call   13b <walk>
+ 3c2:	83 c4 10             	add    $0x10,%esp
+  }
+  for(; i < argc; i++){
+ 3c5:	e9 8c 00 00 00       	jmp    456 <main+0x116>
+    if(strlen(argv[i]) >= sizeof(path)){
+ 3ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3cd:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 3d4:	8b 43 04             	mov    0x4(%ebx),%eax
+ 3d7:	01 d0                	add    %edx,%eax
+ 3d9:	8b 00                	mov    (%eax),%eax
+ 3db:	83 ec 0c             	sub    $0xc,%esp
+ 3de:	50                   	push   %eax
+ 3df:	e8 d8 01 00 00       	call   5bc <strlen>
+ 3e4:	83 c4 10             	add    $0x10,%esp
+ 3e7:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+ 3ec:	76 26                	jbe    414 <main+0xd4>
+      printf(2, "defrag: %s: path too long\n", argv[i]);
+ 3ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3f1:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 3f8:	8b 43 04             	mov    0x4(%ebx),%eax
+ 3fb:	01 d0                	add    %edx,%eax
+ 3fd:	8b 00                	mov    (%eax),%eax
+ 3ff:	83 ec 04             	sub    $0x4,%esp
+ 402:	50                   	push   %eax
+ 403:	68 f2 0d 00 00       	push   $0xdf2
+ 408:	6a 02                	push   $0x2
+ 40a:	e8 a9 05 00 00       	call   9b8 <printf>
+ 40f:	83 c4 10             	add    $0x10,%esp
+      continue;
+ 412:	eb 3e                	jmp    452 <main+0x112>
+    }
+    strcpy(path, argv[i]);
+ 414:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 417:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 41e:	8b 43 04             	mov    0x4(%ebx),%eax
+ 421:	01 d0                	add    %edx,%eax
+ 423:	8b 00                	mov    (%eax),%eax
+ 425:	83 ec 08             	sub    $0x8,%esp
+ 428:	50                   	push   %eax
+ 429:	68 20 11 00 00       	push   $0x1120
+ 42e:	e8 1a 01 00 00       	call   54d <strcpy>
+ 433:	83 c4 10             	add    $0x10,%esp
+    walk(strlen(path));
+ 436:	83 ec 0c             	sub    $0xc,%esp
+ 439:	68 20 11 00 00       	push   $0x1120
+ 43e:	e8 79 01 00 00       	call   5bc <strlen>
+ 443:	83 c4 10             	add    $0x10,%esp
+ 446:	83 ec 0c             	sub    $0xc,%esp
+ 449:	50                   	push   %eax
+ 44a:	e8 ec fc ff ff       	call   13b <walk>
+ 44f:	83 c4 10             	add    $0x10,%esp
+  for(; i < argc; i++){
+ 452:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 456:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 459:	3b 03                	cmp    (%ebx),%eax
+ 45b:	0f 8c 69 ff ff ff    	jl     3ca <main+0x8a>
+  }
+  avg = nextent ? nblock*100/nextent : 0;
+ 461:	a1 2c 13 00 00       	mov    0x132c,%eax
+ 466:	85 c0                	test   %eax,%eax
+ 468:	74 13                	je     47d <main+0x13d>
+ 46a:	a1 28 13 00 00       	mov    0x1328,%eax
+ 46f:	6b c0 64             	imul   $0x64,%eax,%eax
+ 472:	8b 3d 2c 13 00 00    	mov    0x132c,%edi
+ 478:	99                   	cltd
+ 479:	f7 ff                	idiv   %edi
+ 47b:	eb 05                	jmp    482 <main+0x142>
+ 47d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 482:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  printf(1, "defrag %d files %d blocks %d extents %d.%d%d avg\n",
+ 485:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 488:	ba 67 66 66 66       	mov    $0x66666667,%edx
+ 48d:	89 c8                	mov    %ecx,%eax
+ 48f:	f7 ea                	imul   %edx
+ 491:	c1 fa 02             	sar    $0x2,%edx
+ 494:	89 c8                	mov    %ecx,%eax
+ 496:	c1 f8 1f             	sar    $0x1f,%eax
+ 499:	89 d3                	mov    %edx,%ebx
+ 49b:	29 c3                	sub    %eax,%ebx
+ 49d:	89 d8                	mov    %ebx,%eax
+ 49f:	c1 e0 02             	shl    $0x2,%eax
+ 4a2:	01 d8                	add    %ebx,%eax
+ 4a4:	01 c0                	add    %eax,%eax
+ 4a6:	29 c1                	sub    %eax,%ecx
+ 4a8:	89 cb                	mov    %ecx,%ebx
+         nfile, nblock, nextent, avg/100, avg/10%10, avg%10);
+ 4aa:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 4ad:	ba 67 66 66 66       	mov    $0x66666667,%edx
+ 4b2:	89 c8                	mov    %ecx,%eax
+ 4b4:	f7 ea                	imul   %edx
+ 4b6:	c1 fa 02             	sar    $0x2,%edx
+ 4b9:	89 c8                	mov    %ecx,%eax
+ 4bb:	c1 f8 1f             	sar    $0x1f,%eax
+ 4be:	89 d6                	mov    %edx,%esi
+ 4c0:	29 c6                	sub    %eax,%esi
+  printf(1, "defrag %d files %d blocks %d extents %d.%d%d avg\n",
+ 4c2:	ba 67 66 66 66       	mov    $0x66666667,%edx
+ 4c7:	89 f0                	mov    %esi,%eax
+ 4c9:	f7 ea                	imul   %edx
+ 4cb:	c1 fa 02             	sar    $0x2,%edx
+ 4ce:	89 f0                	mov    %esi,%eax
+ 4d0:	c1 f8 1f             	sar    $0x1f,%eax
+ 4d3:	89 d1                	mov    %edx,%ecx
+ 4d5:	29 c1                	sub    %eax,%ecx
+ 4d7:	89 c8                	mov    %ecx,%eax
+ 4d9:	c1 e0 02             	shl    $0x2,%eax
+ 4dc:	01 c8                	add    %ecx,%eax
+ 4de:	01 c0                	add    %eax,%eax
+ 4e0:	29 c6                	sub    %eax,%esi
+ 4e2:	89 f1                	mov    %esi,%ecx
+ 4e4:	8b 75 e0             	mov    -0x20(%ebp),%esi
+ 4e7:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+ 4ec:	89 f0                	mov    %esi,%eax
+ 4ee:	f7 ea                	imul   %edx
+ 4f0:	c1 fa 05             	sar    $0x5,%edx
+ 4f3:	89 f0                	mov    %esi,%eax
+ 4f5:	c1 f8 1f             	sar    $0x1f,%eax
+ 4f8:	89 d7                	mov    %edx,%edi
+ 4fa:	29 c7                	sub    %eax,%edi
+ 4fc:	8b 35 2c 13 00 00    	mov    0x132c,%esi
+ 502:	8b 15 28 13 00 00    	mov    0x1328,%edx
+ 508:	a1 24 13 00 00       	mov    0x1324,%eax
+ 50d:	53                   	push   %ebx
+ 50e:	51                   	push   %ecx
+ 50f:	57                   	push   %edi
+ 510:	56                   	push   %esi
+ 511:	52                   	push   %edx
+ 512:	50                   	push   %eax
+ 513:	68 10 0e 00 00       	push   $0xe10
+ 518:	6a 01                	push   $0x1
+ 51a:	e8 99 04 00 00       	call   9b8 <printf>
+ 51f:	83 c4 20             	add    $0x20,%esp
+  exit();
+ 522:	e8 95 02 00 00       	call   7bc <exit>
+
+00000527 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 527:	55                   	push   %ebp
+ 528:	89 e5                	mov    %esp,%ebp
+ 52a:	57                   	push   %edi
+ 52b:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 52c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 52f:	8b 55 10             	mov    0x10(%ebp),%edx
+ 532:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 535:	89 cb                	mov    %ecx,%ebx
+ 537:	89 df                	mov    %ebx,%edi
+ 539:	89 d1                	mov    %edx,%ecx
+ 53b:	fc                   	cld
+ 53c:	f3 aa                	rep stos %al,%es:(%edi)
+ 53e:	89 ca                	mov    %ecx,%edx
+ 540:	89 fb                	mov    %edi,%ebx
+ 542:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 545:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 548:	90                   	nop
+ 549:	5b                   	pop    %ebx
+ 54a:	5f                   	pop    %edi
+ 54b:	5d                   	pop    %ebp
+ 54c:	c3                   	ret
+
+0000054d <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 54d:	55                   	push   %ebp
+ 54e:	89 e5                	mov    %esp,%ebp
+ 550:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 559:	90                   	nop
+ 55a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 55d:	8d 42 01             	lea    0x1(%edx),%eax
+ 560:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	8d 48 01             	lea    0x1(%eax),%ecx
+ 569:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 56c:	0f b6 12             	movzbl (%edx),%edx
+ 56f:	88 10                	mov    %dl,(%eax)
+ 571:	0f b6 00             	movzbl (%eax),%eax
+ 574:	84 c0                	test   %al,%al
+ 576:	75 e2                	jne    55a <strcpy+0xd>
+    ;
+  return os;
+ 578:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 57b:	c9                   	leave
+ 57c:	c3                   	ret
+
+0000057d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 57d:	55                   	push   %ebp
+ 57e:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 580:	eb 08                	jmp    58a <strcmp+0xd>
+    p++, q++;
+ 582:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 586:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 58a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58d:	0f b6 00             	movzbl (%eax),%eax
+ 590:	84 c0                	test   %al,%al
+ 592:	74 10                	je     5a4 <strcmp+0x27>
+ 594:	8b 45 08             	mov    0x8(%ebp),%eax
+ 597:	0f b6 10             	movzbl (%eax),%edx
+ 59a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59d:	0f b6 00             	movzbl (%eax),%eax
+ 5a0:	38 c2                	cmp    %al,%dl
+ 5a2:	74 de                	je     582 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 5a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a7:	0f b6 00             	movzbl (%eax),%eax
+ 5aa:	0f b6 d0             	movzbl %al,%edx
+ 5ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b0:	0f b6 00             	movzbl (%eax),%eax
+ 5b3:	0f b6 c0             	movzbl %al,%eax
+ 5b6:	29 c2                	sub    %eax,%edx
+ 5b8:	89 d0                	mov    %edx,%eax
+}
+ 5ba:	5d                   	pop    %ebp
+ 5bb:	c3                   	ret
+
+000005bc <strlen>:
+
+uint
+strlen(char *s)
+{
+ 5bc:	55                   	push   %ebp
+ 5bd:	89 e5                	mov    %esp,%ebp
+ 5bf:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5c2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 5c9:	eb 04                	jmp    5cf <strlen+0x13>
+ 5cb:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 5cf:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 5d2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d5:	01 d0                	add    %edx,%eax
+ 5d7:	0f b6 00             	movzbl (%eax),%eax
+ 5da:	84 c0                	test   %al,%al
+ 5dc:	75 ed                	jne    5cb <strlen+0xf>
+    ;
+  return n;
+ 5de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5e1:	c9                   	leave
+ 5e2:	c3                   	ret
+
+000005e3 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 5e3:	55                   	push   %ebp
+ 5e4:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 5e6:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5e9:	50                   	push   %eax
+ 5ea:	ff 75 0c             	push   0xc(%ebp)
+ 5ed:	ff 75 08             	push   0x8(%ebp)
+ 5f0:	e8 32 ff ff ff       	call   527 <stosb>
+ 5f5:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 5f8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5fb:	c9                   	leave
+ 5fc:	c3                   	ret
+
+000005fd <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5fd:	55                   	push   %ebp
+ 5fe:	89 e5                	mov    %esp,%ebp
+ 600:	83 ec 04             	sub    $0x4,%esp
+ 603:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 606:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 609:	eb 14                	jmp    61f <strchr+0x22>
+    if(*s == c)
+ 60b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60e:	0f b6 00             	movzbl (%eax),%eax
+ 611:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 614:	75 05                	jne    61b <strchr+0x1e>
+      return (char*)s;
+ 616:	8b 45 08             	mov    0x8(%ebp),%eax
+ 619:	eb 13                	jmp    62e <strchr+0x31>
+  for(; *s; s++)
+ 61b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 61f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 622:	0f b6 00             	movzbl (%eax),%eax
+ 625:	84 c0                	test   %al,%al
+ 627:	75 e2                	jne    60b <strchr+0xe>
+  return 0;
+ 629:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 62e:	c9                   	leave
+ 62f:	c3                   	ret
+
+00000630 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 636:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 63d:	eb 42                	jmp    681 <gets+0x51>
+    cc = read(0, &c, 1);
+ 63f:	83 ec 04             	sub    $0x4,%esp
+ 642:	6a 01                	push   $0x1
+ 644:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 647:	50                   	push   %eax
+ 648:	6a 00                	push   $0x0
+ 64a:	e8 85 01 00 00       	call   7d4 <read>
+ 64f:	83 c4 10             	add    $0x10,%esp
+ 652:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 655:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 659:	7e 33                	jle    68e <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 65b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 65e:	8d 50 01             	lea    0x1(%eax),%edx
+ 661:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 664:	89 c2                	mov    %eax,%edx
+ 666:	8b 45 08             	mov    0x8(%ebp),%eax
+ 669:	01 c2                	add    %eax,%edx
+ 66b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 66f:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 671:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 675:	3c 0a                	cmp    $0xa,%al
+ 677:	74 16                	je     68f <gets+0x5f>
+ 679:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 67d:	3c 0d                	cmp    $0xd,%al
+ 67f:	74 0e                	je     68f <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 681:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 684:	83 c0 01             	add    $0x1,%eax
+ 687:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 68a:	7f b3                	jg     63f <gets+0xf>
+ 68c:	eb 01                	jmp    68f <gets+0x5f>
+      break;
+ 68e:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 68f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 692:	8b 45 08             	mov    0x8(%ebp),%eax
+ 695:	01 d0                	add    %edx,%eax
+ 697:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 69a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 69d:	c9                   	leave
+ 69e:	c3                   	ret
+
+0000069f <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 69f:	55                   	push   %ebp
+ 6a0:	89 e5                	mov    %esp,%ebp
+ 6a2:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 6a5:	83 ec 08             	sub    $0x8,%esp
+ 6a8:	6a 00                	push   $0x0
+ 6aa:	ff 75 08             	push   0x8(%ebp)
+ 6ad:	e8 4a 01 00 00       	call   7fc <open>
+ 6b2:	83 c4 10             	add    $0x10,%esp
+ 6b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 6b8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6bc:	79 07                	jns    6c5 <stat+0x26>
+    return -1;
+ 6be:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6c3:	eb 25                	jmp    6ea <stat+0x4b>
+  r = fstat(fd, st);
+ 6c5:	83 ec 08             	sub    $0x8,%esp
+ 6c8:	ff 75 0c             	push   0xc(%ebp)
+ 6cb:	ff 75 f4             	push   -0xc(%ebp)
+ 6ce:	e8 41 01 00 00       	call   814 <fstat>
+ 6d3:	83 c4 10             	add    $0x10,%esp
+ 6d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 6d9:	83 ec 0c             	sub    $0xc,%esp
+ 6dc:	ff 75 f4             	push   -0xc(%ebp)
+ 6df:	e8 00 01 00 00       	call   7e4 <close>
+ 6e4:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 6e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 6ea:	c9                   	leave
+ 6eb:	c3                   	ret
+
+000006ec <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6ec:	55                   	push   %ebp
+ 6ed:	89 e5                	mov    %esp,%ebp
+ 6ef:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 6f2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 6f9:	eb 25                	jmp    720 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 6fb:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 6fe:	89 d0                	mov    %edx,%eax
+ 700:	c1 e0 02             	shl    $0x2,%eax
+ 703:	01 d0                	add    %edx,%eax
+ 705:	01 c0                	add    %eax,%eax
+ 707:	89 c1                	mov    %eax,%ecx
+ 709:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70c:	8d 50 01             	lea    0x1(%eax),%edx
+ 70f:	89 55 08             	mov    %edx,0x8(%ebp)
+ 712:	0f b6 00             	movzbl (%eax),%eax
+ 715:	0f be c0             	movsbl %al,%eax
+ 718:	01 c8                	add    %ecx,%eax
+ 71a:	83 e8 30             	sub    $0x30,%eax
+ 71d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 720:	8b 45 08             	mov    0x8(%ebp),%eax
+ 723:	0f b6 00             	movzbl (%eax),%eax
+ 726:	3c 2f                	cmp    $0x2f,%al
+ 728:	7e 0a                	jle    734 <atoi+0x48>
+ 72a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72d:	0f b6 00             	movzbl (%eax),%eax
+ 730:	3c 39                	cmp    $0x39,%al
+ 732:	7e c7                	jle    6fb <atoi+0xf>
+  return n;
+ 734:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 737:	c9                   	leave
+ 738:	c3                   	ret
+
+00000739 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 739:	55                   	push   %ebp
+ 73a:	89 e5                	mov    %esp,%ebp
+ 73c:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 73f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 742:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 745:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 748:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 74b:	eb 17                	jmp    764 <memmove+0x2b>
+    *dst++ = *src++;
+ 74d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 750:	8d 42 01             	lea    0x1(%edx),%eax
+ 753:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 756:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 759:	8d 48 01             	lea    0x1(%eax),%ecx
+ 75c:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 75f:	0f b6 12             	movzbl (%edx),%edx
+ 762:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 764:	8b 45 10             	mov    0x10(%ebp),%eax
+ 767:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 76a:	89 55 10             	mov    %edx,0x10(%ebp)
+ 76d:	85 c0                	test   %eax,%eax
+ 76f:	7f dc                	jg     74d <memmove+0x14>
+  return vdst;
+ 771:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 774:	c9                   	leave
+ 775:	c3                   	ret
+
+00000776 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 776:	55                   	push   %ebp
+ 777:	89 e5                	mov    %esp,%ebp
+ 779:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 77c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 783:	eb 04                	jmp    789 <ncpus+0x13>
+ 785:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 789:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 78d:	7f 16                	jg     7a5 <ncpus+0x2f>
+ 78f:	83 ec 08             	sub    $0x8,%esp
+ 792:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 795:	50                   	push   %eax
+ 796:	ff 75 f4             	push   -0xc(%ebp)
+ 799:	e8 d6 00 00 00       	call   874 <intrstat>
+ 79e:	83 c4 10             	add    $0x10,%esp
+ 7a1:	85 c0                	test   %eax,%eax
+ 7a3:	74 e0                	je     785 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 7a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a8:	ba 01 00 00 00       	mov    $0x1,%edx
+ 7ad:	85 c0                	test   %eax,%eax
+ 7af:	0f 4e c2             	cmovle %edx,%eax
+}
+ 7b2:	c9                   	leave
+ 7b3:	c3                   	ret
+
+000007b4 <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 7b4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <exit>:
+SYSCALL(exit)
+ 7bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <wait>:
+SYSCALL(wait)
+ 7c4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <pipe>:
+SYSCALL(pipe)
+ 7cc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7d1:	cd 40                	int    $0x40
+ 7d3:	c3                   	ret
+
+000007d4 <read>:
+SYSCALL(read)
+ 7d4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7d9:	cd 40                	int    $0x40
+ 7db:	c3                   	ret
+
+000007dc <write>:
+SYSCALL(write)
+ 7dc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+000007e4 <close>:
+SYSCALL(close)
+ 7e4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <kill>:
+SYSCALL(kill)
+ 7ec:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+000007f4 <exec>:
+SYSCALL(exec)
+ 7f4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+000007fc <open>:
+SYSCALL(open)
+ 7fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 801:	cd 40                	int    $0x40
+ 803:	c3                   	ret
+
+00000804 <mknod>:
+SYSCALL(mknod)
+ 804:	b8 11 00 00 00       	mov    $0x11,%eax
+ 809:	cd 40                	int    $0x40
+ 80b:	c3                   	ret
+
+0000080c <unlink>:
+SYSCALL(unlink)
+ 80c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 811:	cd 40                	int    $0x40
+ 813:	c3                   	ret
+
+00000814 <fstat>:
+SYSCALL(fstat)
+ 814:	b8 08 00 00 00       	mov    $0x8,%eax
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+0000081c <link>:
+SYSCALL(link)
+ 81c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 821:	cd 40                	int    $0x40
+ 823:	c3                   	ret
+
+00000824 <mkdir>:
+SYSCALL(mkdir)
+ 824:	b8 14 00 00 00       	mov    $0x14,%eax
+ 829:	cd 40                	int    $0x40
+ 82b:	c3                   	ret
+
+0000082c <chdir>:
+SYSCALL(chdir)
+ 82c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 831:	cd 40                	int    $0x40
+ 833:	c3                   	ret
+
+00000834 <dup>:
+SYSCALL(dup)
+ 834:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 839:	cd 40                	int    $0x40
+ 83b:	c3                   	ret
+
+0000083c <getpid>:
+SYSCALL(getpid)
+ 83c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 841:	cd 40                	int    $0x40
+ 843:	c3                   	ret
+
+00000844 <sbrk>:
+SYSCALL(sbrk)
+ 844:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 849:	cd 40                	int    $0x40
+ 84b:	c3                   	ret
+
+0000084c <sleep>:
+SYSCALL(sleep)
+ 84c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 851:	cd 40                	int    $0x40
+ 853:	c3                   	ret
+
+00000854 <uptime>:
+SYSCALL(uptime)
+ 854:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 859:	cd 40                	int    $0x40
+ 85b:	c3                   	ret
+
+0000085c <poll>:
+SYSCALL(poll)
+ 85c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 861:	cd 40                	int    $0x40
+ 863:	c3                   	ret
+
+00000864 <fcntl>:
+SYSCALL(fcntl)
+ 864:	b8 17 00 00 00       	mov    $0x17,%eax
+ 869:	cd 40                	int    $0x40
+ 86b:	c3                   	ret
+
+0000086c <irqroute>:
+SYSCALL(irqroute)
+ 86c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 871:	cd 40                	int    $0x40
+ 873:	c3                   	ret
+
+00000874 <intrstat>:
+SYSCALL(intrstat)
+ 874:	b8 19 00 00 00       	mov    $0x19,%eax
+ 879:	cd 40                	int    $0x40
+ 87b:	c3                   	ret
+
+0000087c <pread>:
+SYSCALL(pread)
+ 87c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 881:	cd 40                	int    $0x40
+ 883:	c3                   	ret
+
+00000884 <getdents>:
+SYSCALL(getdents)
+ 884:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 889:	cd 40                	int    $0x40
+ 88b:	c3                   	ret
+
+0000088c <fstatat>:
+SYSCALL(fstatat)
+ 88c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 891:	cd 40                	int    $0x40
+ 893:	c3                   	ret
+
+00000894 <openat>:
+SYSCALL(openat)
+ 894:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 899:	cd 40                	int    $0x40
+ 89b:	c3                   	ret
+
+0000089c <unlinkat>:
+SYSCALL(unlinkat)
+ 89c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8a1:	cd 40                	int    $0x40
+ 8a3:	c3                   	ret
+
+000008a4 <mkdirat>:
+SYSCALL(mkdirat)
+ 8a4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8a9:	cd 40                	int    $0x40
+ 8ab:	c3                   	ret
+
+000008ac <linkat>:
+SYSCALL(linkat)
+ 8ac:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8b1:	cd 40                	int    $0x40
+ 8b3:	c3                   	ret
+
+000008b4 <exits>:
+SYSCALL(exits)
+ 8b4:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8b9:	cd 40                	int    $0x40
+ 8bb:	c3                   	ret
+
+000008bc <waitstatus>:
+SYSCALL(waitstatus)
+ 8bc:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8c1:	cd 40                	int    $0x40
+ 8c3:	c3                   	ret
+
+000008c4 <pwrite>:
+SYSCALL(pwrite)
+ 8c4:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8c9:	cd 40                	int    $0x40
+ 8cb:	c3                   	ret
+
+000008cc <lseek>:
+SYSCALL(lseek)
+ 8cc:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8d1:	cd 40                	int    $0x40
+ 8d3:	c3                   	ret
+
+000008d4 <copyfilerange>:
+SYSCALL(copyfilerange)
+ 8d4:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8d9:	cd 40                	int    $0x40
+ 8db:	c3                   	ret
+
+000008dc <fsctl>:
+SYSCALL(fsctl)
+ 8dc:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8e1:	cd 40                	int    $0x40
+ 8e3:	c3                   	ret
+
+000008e4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8e4:	55                   	push   %ebp
+ 8e5:	89 e5                	mov    %esp,%ebp
+ 8e7:	83 ec 18             	sub    $0x18,%esp
+ 8ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8ed:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	6a 01                	push   $0x1
+ 8f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8f8:	50                   	push   %eax
+ 8f9:	ff 75 08             	push   0x8(%ebp)
+ 8fc:	e8 db fe ff ff       	call   7dc <write>
+ 901:	83 c4 10             	add    $0x10,%esp
+}
+ 904:	90                   	nop
+ 905:	c9                   	leave
+ 906:	c3                   	ret
+
+00000907 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 907:	55                   	push   %ebp
+ 908:	89 e5                	mov    %esp,%ebp
+ 90a:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 90d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 914:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 918:	74 17                	je     931 <printint+0x2a>
+ 91a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 91e:	79 11                	jns    931 <printint+0x2a>
+    neg = 1;
+ 920:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 927:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 92a:	f7 d8                	neg    %eax
+ 92c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 92f:	eb 06                	jmp    937 <printint+0x30>
+  } else {
+    x = xx;
+ 931:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 934:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 937:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 93e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 941:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 944:	ba 00 00 00 00       	mov    $0x0,%edx
+ 949:	f7 f1                	div    %ecx
+ 94b:	89 d1                	mov    %edx,%ecx
+ 94d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 950:	8d 50 01             	lea    0x1(%eax),%edx
+ 953:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 956:	0f b6 91 fc 10 00 00 	movzbl 0x10fc(%ecx),%edx
+ 95d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 961:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 964:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 967:	ba 00 00 00 00       	mov    $0x0,%edx
+ 96c:	f7 f1                	div    %ecx
+ 96e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 971:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 975:	75 c7                	jne    93e <printint+0x37>
+  if(neg)
+ 977:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 97b:	74 2d                	je     9aa <printint+0xa3>
+    buf[i++] = '-';
+ 97d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 980:	8d 50 01             	lea    0x1(%eax),%edx
+ 983:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 986:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 98b:	eb 1d                	jmp    9aa <printint+0xa3>
+    putc(fd, buf[i]);
+ 98d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 990:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 993:	01 d0                	add    %edx,%eax
+ 995:	0f b6 00             	movzbl (%eax),%eax
+ 998:	0f be c0             	movsbl %al,%eax
+ 99b:	83 ec 08             	sub    $0x8,%esp
+ 99e:	50                   	push   %eax
+ 99f:	ff 75 08             	push   0x8(%ebp)
+ 9a2:	e8 3d ff ff ff       	call   8e4 <putc>
+ 9a7:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 9aa:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 9ae:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9b2:	79 d9                	jns    98d <printint+0x86>
+}
+ 9b4:	90                   	nop
+ 9b5:	90                   	nop
+ 9b6:	c9                   	leave
+ 9b7:	c3                   	ret
+
+000009b8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 9b8:	55                   	push   %ebp
+ 9b9:	89 e5                	mov    %esp,%ebp
+ 9bb:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 9be:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 9c5:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9c8:	83 c0 04             	add    $0x4,%eax
+ 9cb:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9ce:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 9d5:	e9 59 01 00 00       	jmp    b33 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 9da:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e0:	01 d0                	add    %edx,%eax
+ 9e2:	0f b6 00             	movzbl (%eax),%eax
+ 9e5:	0f be c0             	movsbl %al,%eax
+ 9e8:	25 ff 00 00 00       	and    $0xff,%eax
+ 9ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 9f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9f4:	75 2c                	jne    a22 <printf+0x6a>
+      if(c == '%'){
+ 9f6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9fa:	75 0c                	jne    a08 <printf+0x50>
+        state = '%';
+ 9fc:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ a03:	e9 27 01 00 00       	jmp    b2f <printf+0x177>
+      } else {
+        putc(fd, c);
+ a08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a0b:	0f be c0             	movsbl %al,%eax
+ a0e:	83 ec 08             	sub    $0x8,%esp
+ a11:	50                   	push   %eax
+ a12:	ff 75 08             	push   0x8(%ebp)
+ a15:	e8 ca fe ff ff       	call   8e4 <putc>
+ a1a:	83 c4 10             	add    $0x10,%esp
+ a1d:	e9 0d 01 00 00       	jmp    b2f <printf+0x177>
+      }
+    } else if(state == '%'){
+ a22:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a26:	0f 85 03 01 00 00    	jne    b2f <printf+0x177>
+      if(c == 'd'){
+ a2c:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a30:	75 1e                	jne    a50 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a32:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a35:	8b 00                	mov    (%eax),%eax
+ a37:	6a 01                	push   $0x1
+ a39:	6a 0a                	push   $0xa
+ a3b:	50                   	push   %eax
+ a3c:	ff 75 08             	push   0x8(%ebp)
+ a3f:	e8 c3 fe ff ff       	call   907 <printint>
+ a44:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a47:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a4b:	e9 d8 00 00 00       	jmp    b28 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ a50:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a54:	74 06                	je     a5c <printf+0xa4>
+ a56:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a5a:	75 1e                	jne    a7a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ a5c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a5f:	8b 00                	mov    (%eax),%eax
+ a61:	6a 00                	push   $0x0
+ a63:	6a 10                	push   $0x10
+ a65:	50                   	push   %eax
+ a66:	ff 75 08             	push   0x8(%ebp)
+ a69:	e8 99 fe ff ff       	call   907 <printint>
+ a6e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a71:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a75:	e9 ae 00 00 00       	jmp    b28 <printf+0x170>
+      } else if(c == 's'){
+ a7a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a7e:	75 43                	jne    ac3 <printf+0x10b>
+        s = (char*)*ap;
+ a80:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a83:	8b 00                	mov    (%eax),%eax
+ a85:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a88:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a8c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a90:	75 25                	jne    ab7 <printf+0xff>
+          s = "(null)";
+ a92:	c7 45 f4 42 0e 00 00 	movl   $0xe42,-0xc(%ebp)
+        while(*s != 0){
+ a99:	eb 1c                	jmp    ab7 <printf+0xff>
+          putc(fd, *s);
+ a9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a9e:	0f b6 00             	movzbl (%eax),%eax
+ aa1:	0f be c0             	movsbl %al,%eax
+ aa4:	83 ec 08             	sub    $0x8,%esp
+ aa7:	50                   	push   %eax
+ aa8:	ff 75 08             	push   0x8(%ebp)
+ aab:	e8 34 fe ff ff       	call   8e4 <putc>
+ ab0:	83 c4 10             	add    $0x10,%esp
+          s++;
+ ab3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ ab7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aba:	0f b6 00             	movzbl (%eax),%eax
+ abd:	84 c0                	test   %al,%al
+ abf:	75 da                	jne    a9b <printf+0xe3>
+ ac1:	eb 65                	jmp    b28 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ ac3:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ ac7:	75 1d                	jne    ae6 <printf+0x12e>
+        putc(fd, *ap);
+ ac9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ acc:	8b 00                	mov    (%eax),%eax
+ ace:	0f be c0             	movsbl %al,%eax
+ ad1:	83 ec 08             	sub    $0x8,%esp
+ ad4:	50                   	push   %eax
+ ad5:	ff 75 08             	push   0x8(%ebp)
+ ad8:	e8 07 fe ff ff       	call   8e4 <putc>
+ add:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ ae0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ ae4:	eb 42                	jmp    b28 <printf+0x170>
+      } else if(c == '%'){
+ ae6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ aea:	75 17                	jne    b03 <printf+0x14b>
+        putc(fd, c);
+ aec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ aef:	0f be c0             	movsbl %al,%eax
+ af2:	83 ec 08             	sub    $0x8,%esp
+ af5:	50                   	push   %eax
+ af6:	ff 75 08             	push   0x8(%ebp)
+ af9:	e8 e6 fd ff ff       	call   8e4 <putc>
+ afe:	83 c4 10             	add    $0x10,%esp
+ b01:	eb 25                	jmp    b28 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b03:	83 ec 08             	sub    $0x8,%esp
+ b06:	6a 25                	push   $0x25
+ b08:	ff 75 08             	push   0x8(%ebp)
+ b0b:	e8 d4 fd ff ff       	call   8e4 <putc>
+ b10:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ b13:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b16:	0f be c0             	movsbl %al,%eax
+ b19:	83 ec 08             	sub    $0x8,%esp
+ b1c:	50                   	push   %eax
+ b1d:	ff 75 08             	push   0x8(%ebp)
+ b20:	e8 bf fd ff ff       	call   8e4 <putc>
+ b25:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b28:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b2f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b33:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b39:	01 d0                	add    %edx,%eax
+ b3b:	0f b6 00             	movzbl (%eax),%eax
+ b3e:	84 c0                	test   %al,%al
+ b40:	0f 85 94 fe ff ff    	jne    9da <printf+0x22>
+    }
+  }
+}
+ b46:	90                   	nop
+ b47:	90                   	nop
+ b48:	c9                   	leave
+ b49:	c3                   	ret
+
+00000b4a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b4a:	55                   	push   %ebp
+ b4b:	89 e5                	mov    %esp,%ebp
+ b4d:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b50:	8b 45 08             	mov    0x8(%ebp),%eax
+ b53:	83 e8 08             	sub    $0x8,%eax
+ b56:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b59:	a1 38 13 00 00       	mov    0x1338,%eax
+ b5e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b61:	eb 24                	jmp    b87 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b66:	8b 00                	mov    (%eax),%eax
+ b68:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b6b:	72 12                	jb     b7f <free+0x35>
+ b6d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b70:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b73:	72 24                	jb     b99 <free+0x4f>
+ b75:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b78:	8b 00                	mov    (%eax),%eax
+ b7a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b7d:	72 1a                	jb     b99 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b7f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b82:	8b 00                	mov    (%eax),%eax
+ b84:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b87:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b8a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b8d:	73 d4                	jae    b63 <free+0x19>
+ b8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b92:	8b 00                	mov    (%eax),%eax
+ b94:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b97:	73 ca                	jae    b63 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b99:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b9c:	8b 40 04             	mov    0x4(%eax),%eax
+ b9f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ba6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba9:	01 c2                	add    %eax,%edx
+ bab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bae:	8b 00                	mov    (%eax),%eax
+ bb0:	39 c2                	cmp    %eax,%edx
+ bb2:	75 24                	jne    bd8 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ bb4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb7:	8b 50 04             	mov    0x4(%eax),%edx
+ bba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bbd:	8b 00                	mov    (%eax),%eax
+ bbf:	8b 40 04             	mov    0x4(%eax),%eax
+ bc2:	01 c2                	add    %eax,%edx
+ bc4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bc7:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bcd:	8b 00                	mov    (%eax),%eax
+ bcf:	8b 10                	mov    (%eax),%edx
+ bd1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bd4:	89 10                	mov    %edx,(%eax)
+ bd6:	eb 0a                	jmp    be2 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bd8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bdb:	8b 10                	mov    (%eax),%edx
+ bdd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ be0:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ be2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be5:	8b 40 04             	mov    0x4(%eax),%eax
+ be8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf2:	01 d0                	add    %edx,%eax
+ bf4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bf7:	75 20                	jne    c19 <free+0xcf>
+    p->s.size += bp->s.size;
+ bf9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfc:	8b 50 04             	mov    0x4(%eax),%edx
+ bff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c02:	8b 40 04             	mov    0x4(%eax),%eax
+ c05:	01 c2                	add    %eax,%edx
+ c07:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c0a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c0d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c10:	8b 10                	mov    (%eax),%edx
+ c12:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c15:	89 10                	mov    %edx,(%eax)
+ c17:	eb 08                	jmp    c21 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c1f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c24:	a3 38 13 00 00       	mov    %eax,0x1338
+}
+ c29:	90                   	nop
+ c2a:	c9                   	leave
+ c2b:	c3                   	ret
+
+00000c2c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c2c:	55                   	push   %ebp
+ c2d:	89 e5                	mov    %esp,%ebp
+ c2f:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c32:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c39:	77 07                	ja     c42 <morecore+0x16>
+    nu = 4096;
+ c3b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c42:	8b 45 08             	mov    0x8(%ebp),%eax
+ c45:	c1 e0 03             	shl    $0x3,%eax
+ c48:	83 ec 0c             	sub    $0xc,%esp
+ c4b:	50                   	push   %eax
+ c4c:	e8 f3 fb ff ff       	call   844 <sbrk>
+ c51:	83 c4 10             	add    $0x10,%esp
+ c54:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c57:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c5b:	75 07                	jne    c64 <morecore+0x38>
+    return 0;
+ c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+ c62:	eb 26                	jmp    c8a <morecore+0x5e>
+  hp = (Header*)p;
+ c64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c67:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c6d:	8b 55 08             	mov    0x8(%ebp),%edx
+ c70:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c73:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c76:	83 c0 08             	add    $0x8,%eax
+ c79:	83 ec 0c             	sub    $0xc,%esp
+ c7c:	50                   	push   %eax
+ c7d:	e8 c8 fe ff ff       	call   b4a <free>
+ c82:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c85:	a1 38 13 00 00       	mov    0x1338,%eax
+}
+ c8a:	c9                   	leave
+ c8b:	c3                   	ret
+
+00000c8c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c8c:	55                   	push   %ebp
+ c8d:	89 e5                	mov    %esp,%ebp
+ c8f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c92:	8b 45 08             	mov    0x8(%ebp),%eax
+ c95:	83 c0 07             	add    $0x7,%eax
+ c98:	c1 e8 03             	shr    $0x3,%eax
+ c9b:	83 c0 01             	add    $0x1,%eax
+ c9e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ ca1:	a1 38 13 00 00       	mov    0x1338,%eax
+ ca6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ca9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cad:	75 23                	jne    cd2 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ caf:	c7 45 f0 30 13 00 00 	movl   $0x1330,-0x10(%ebp)
+ cb6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cb9:	a3 38 13 00 00       	mov    %eax,0x1338
+ cbe:	a1 38 13 00 00       	mov    0x1338,%eax
+ cc3:	a3 30 13 00 00       	mov    %eax,0x1330
+    base.s.size = 0;
+ cc8:	c7 05 34 13 00 00 00 	movl   $0x0,0x1334
+ ccf:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cd5:	8b 00                	mov    (%eax),%eax
+ cd7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cdd:	8b 40 04             	mov    0x4(%eax),%eax
+ ce0:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ce3:	72 4d                	jb     d32 <malloc+0xa6>
+      if(p->s.size == nunits)
+ ce5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce8:	8b 40 04             	mov    0x4(%eax),%eax
+ ceb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ cee:	75 0c                	jne    cfc <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ cf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf3:	8b 10                	mov    (%eax),%edx
+ cf5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cf8:	89 10                	mov    %edx,(%eax)
+ cfa:	eb 26                	jmp    d22 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ cfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cff:	8b 40 04             	mov    0x4(%eax),%eax
+ d02:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d05:	89 c2                	mov    %eax,%edx
+ d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d10:	8b 40 04             	mov    0x4(%eax),%eax
+ d13:	c1 e0 03             	shl    $0x3,%eax
+ d16:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d1f:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ d22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d25:	a3 38 13 00 00       	mov    %eax,0x1338
+      return (void*)(p + 1);
+ d2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2d:	83 c0 08             	add    $0x8,%eax
+ d30:	eb 3b                	jmp    d6d <malloc+0xe1>
+    }
+    if(p == freep)
+ d32:	a1 38 13 00 00       	mov    0x1338,%eax
+ d37:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d3a:	75 1e                	jne    d5a <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d3c:	83 ec 0c             	sub    $0xc,%esp
+ d3f:	ff 75 ec             	push   -0x14(%ebp)
+ d42:	e8 e5 fe ff ff       	call   c2c <morecore>
+ d47:	83 c4 10             	add    $0x10,%esp
+ d4a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d4d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d51:	75 07                	jne    d5a <malloc+0xce>
+        return 0;
+ d53:	b8 00 00 00 00       	mov    $0x0,%eax
+ d58:	eb 13                	jmp    d6d <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d5d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d63:	8b 00                	mov    (%eax),%eax
+ d65:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d68:	e9 6d ff ff ff       	jmp    cda <malloc+0x4e>
+  }
+}
+ d6d:	c9                   	leave
+ d6e:	c3                   	ret
@@ -0,0 +1,121 @@
+// Report and repair file fragmentation.
+//   defrag [-n] [path ...]
+// Walks the named files and directories (by default /) and, for
+// every file whose blocks are not one run on disk, prints
+//   <path> <blocks> <extents>
+// then moves its blocks into one run with fsctl(FS_DEFRAG),
+// unless -n is given, and prints the extents left.  The last
+// line totals what was found before any moves:
+//   defrag <files> files <blocks> blocks <extents> extents <avg> avg
+// where <avg> is the average extent length in blocks, to two
+// places.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fs.h"
+#include "fcntl.h"
+#include "fsctl.h"
+
+char path[512];
+int dryrun;
+int nfile, nblock, nextent;
+
+// Directories can only be opened for reading, so walk does;
+// FS_DEFRAG needs the file opened for writing.
+void
+file(int fd)
+{
+  struct extents e;
+  int wfd;
+
+  if(fsctl(fd, FS_EXTENTS, &e) < 0){
+    printf(2, "defrag: cannot map %s\n", path);
+    return;
+  }
+  nfile++;
+  nblock += e.nblocks;
+  nextent += e.nextents;
+  if(e.nextents <= 1)
+    return;
+  printf(1, "%s %d %d", path, e.nblocks, e.nextents);
+  if(!dryrun){
+    if((wfd = open(path, O_RDWR)) < 0 || fsctl(wfd, FS_DEFRAG, 0) < 0)
+      printf(1, " failed");
+    else if(fsctl(wfd, FS_EXTENTS, &e) == 0)
+      printf(1, " -> %d", e.nextents);
+    if(wfd >= 0)
+      close(wfd);
+  }
+  printf(1, "\n");
+}
+
+// Visit path, which is len bytes long, and everything under it.
+void
+walk(int len)
+{
+  struct dirent de[16];
+  struct stat st;
+  int fd, i, n;
+  char *p;
+
+  if((fd = open(path, 0)) < 0){
+    printf(2, "defrag: cannot open %s\n", path);
+    return;
+  }
+  if(fstat(fd, &st) < 0){
+    printf(2, "defrag: cannot stat %s\n", path);
+    close(fd);
+    return;
+  }
+  if(st.type == T_FILE)
+    file(fd);
+  else if(st.type == T_DIR){
+    while((n = getdents(fd, de, sizeof(de))) > 0){
+      for(i = 0; i < n/sizeof(de[0]); i++){
+        if(strcmp(de[i].name, ".") == 0 || strcmp(de[i].name, "..") == 0)
+          continue;
+        if(len + 1 + DIRSIZ + 1 > sizeof(path)){
+          printf(2, "defrag: path too long\n");
+          continue;
+        }
+        p = path + len;
+        if(len == 0 || p[-1] != '/')
+          *p++ = '/';
+        memmove(p, de[i].name, DIRSIZ);
+        p[DIRSIZ] = 0;
+        walk(strlen(path));
+        path[len] = 0;
+      }
+    }
+  }
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, avg;
+
+  i = 1;
+  if(i < argc && strcmp(argv[i], "-n") == 0){
+    dryrun = 1;
+    i++;
+  }
+  if(i == argc){
+    strcpy(path, "/");
+    walk(1);
+  }
+  for(; i < argc; i++){
+    if(strlen(argv[i]) >= sizeof(path)){
+      printf(2, "defrag: %s: path too long\n", argv[i]);
+      continue;
+    }
+    strcpy(path, argv[i]);
+    walk(strlen(path));
+  }
+  avg = nextent ? nblock*100/nextent : 0;
+  printf(1, "defrag %d files %d blocks %d extents %d.%d%d avg\n",
+         nfile, nblock, nextent, avg/100, avg/10%10, avg%10);
+  exit();
+}
@@ -1,5 +1,6 @@
 struct buf;
 struct context;
+struct extents;
 struct file;
 struct inode;
 struct pipe;
@@ -8,6 +9,7 @@ struct rtcdate;
 struct spinlock;
 struct stat;
 struct superblock;
+struct tlbbatch;
 
 // bio.c
 void            binit(void);
@@ -25,18 +27,40 @@ void            panic(char*) __attribute__((noreturn));
 int             exec(char*, char**);
 
 // file.c
+int             fdalloc(struct file*);
+void            fdcloseall(void);
+int             fdcopy(struct proc*);
+struct file*    fdfree(int);
+void            fdinit(struct proc*);
 struct file*    filealloc(void);
 void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filepread(struct file*, char*, int n, uint off);
+int             fileseek(struct file*, int, int);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filepwrite(struct file*, char*, int n, uint off);
+int             filecopy(struct file*, uint, struct file*, uint, int);
+int             filepoll(struct file*, int);
+uint            pollstart(int);
+uint            pollwait(uint);
+void            polldone(int);
+void            pollwakeup(void);
+void            polltick(void);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+struct inode*   dircreate(struct inode*, char*, short, short, short);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
+int             dirunlink(struct inode*, char*);
+int             copyi(struct inode*, uint, struct inode*, uint, uint);
+int             icompress(struct inode*);
+int             idefrag(struct inode*);
+int             iexpand(struct inode*, uint);
+void            iextents(struct inode*, struct extents*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(void);
@@ -45,10 +69,16 @@ void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
+void            iflush(void);
+void            ireclaim(uint);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
+struct inode*   nameiat(struct inode*, char*);
+struct inode*   nameiparentat(struct inode*, char*, char*);
 int             readi(struct inode*, char*, uint, uint);
+void            reclaimer(void) __attribute__((noreturn));
+void            reclaimwait(void);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
@@ -59,9 +89,19 @@ void            iderw(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
+int             ioapicroute(int irq, uint cpumask);
 extern uchar    ioapicid;
 void            ioapicinit(void);
 
+// ipi.c
+void            ipicall(void);
+void            ipiinit(void);
+void            ipiresched(void);
+void            smpcall(int, void (*)(void*), void*);
+void            tlbadd(struct tlbbatch*, uint);
+void            tlbflush(struct tlbbatch*);
+void            tlbstart(struct tlbbatch*, pde_t*);
+
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
@@ -77,15 +117,21 @@ int             cpunum(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(int, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
 // log.c
 void            initlog(void);
 void            log_write(struct buf*);
-void            begin_op();
+void            log_writerange(struct buf*, uint, uint);
+void            begin_op(int);
 void            end_op();
 
+// lz.c
+int             lzcompress(uchar*, int, uchar*, int, ushort*);
+int             lzdecompress(uchar*, int, uchar*, int);
+
 // mp.c
 extern int      ismp;
 int             mpbcpu(void);
@@ -99,8 +145,9 @@ void            picinit(void);
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
-int             piperead(struct pipe*, char*, int);
-int             pipewrite(struct pipe*, char*, int);
+int             piperead(struct pipe*, char*, int, int);
+int             pipewrite(struct pipe*, char*, int, int);
+int             pipepoll(struct pipe*, int);
 
 //PAGEBREAK: 16
 // proc.c
@@ -109,13 +156,14 @@ void            exit(void);
 int             fork(void);
 int             growproc(int);
 int             kill(int);
+void            kproc(char*, void (*)(void));
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
-int             wait(void);
+int             wait(int*);
 void            wakeup(void*);
 void            yield(void);
 
@@ -130,6 +178,8 @@ void            initlock(struct spinlock*, char*);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
+void            clibegin(void);
+void            cliend(void);
 
 // string.c
 int             memcmp(const void*, const void*, uint);
@@ -153,6 +203,8 @@ void            timerinit(void);
 
 // trap.c
 void            idtinit(void);
+void            raisesoftirq(int);
+void            setsoftirq(int, void (*)(void));
 extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
@@ -170,6 +222,7 @@ pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
+int             unmapuvm(pde_t*, uint*, uint, char**, int, struct tlbbatch*);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
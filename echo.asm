@@ -0,0 +1,1256 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 ad 08 00 00       	mov    $0x8ad,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 af 08 00 00       	mov    $0x8af,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 b1 08 00 00       	push   $0x8b1
+  4b:	6a 01                	push   $0x1
+  4d:	e8 a4 04 00 00       	call   4f6 <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+  60:	e8 95 02 00 00       	call   2fa <exit>
+
+00000065 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  91:	8b 45 08             	mov    0x8(%ebp),%eax
+  94:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  97:	90                   	nop
+  98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  9b:	8d 42 01             	lea    0x1(%edx),%eax
+  9e:	89 45 0c             	mov    %eax,0xc(%ebp)
+  a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  a4:	8d 48 01             	lea    0x1(%eax),%ecx
+  a7:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  aa:	0f b6 12             	movzbl (%edx),%edx
+  ad:	88 10                	mov    %dl,(%eax)
+  af:	0f b6 00             	movzbl (%eax),%eax
+  b2:	84 c0                	test   %al,%al
+  b4:	75 e2                	jne    98 <strcpy+0xd>
+    ;
+  return os;
+  b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b9:	c9                   	leave
+  ba:	c3                   	ret
+
+000000bb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  bb:	55                   	push   %ebp
+  bc:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  be:	eb 08                	jmp    c8 <strcmp+0xd>
+    p++, q++;
+  c0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  c4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  cb:	0f b6 00             	movzbl (%eax),%eax
+  ce:	84 c0                	test   %al,%al
+  d0:	74 10                	je     e2 <strcmp+0x27>
+  d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  d5:	0f b6 10             	movzbl (%eax),%edx
+  d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  db:	0f b6 00             	movzbl (%eax),%eax
+  de:	38 c2                	cmp    %al,%dl
+  e0:	74 de                	je     c0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  e5:	0f b6 00             	movzbl (%eax),%eax
+  e8:	0f b6 d0             	movzbl %al,%edx
+  eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ee:	0f b6 00             	movzbl (%eax),%eax
+  f1:	0f b6 c0             	movzbl %al,%eax
+  f4:	29 c2                	sub    %eax,%edx
+  f6:	89 d0                	mov    %edx,%eax
+}
+  f8:	5d                   	pop    %ebp
+  f9:	c3                   	ret
+
+000000fa <strlen>:
+
+uint
+strlen(char *s)
+{
+  fa:	55                   	push   %ebp
+  fb:	89 e5                	mov    %esp,%ebp
+  fd:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 100:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 107:	eb 04                	jmp    10d <strlen+0x13>
+ 109:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 10d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	01 d0                	add    %edx,%eax
+ 115:	0f b6 00             	movzbl (%eax),%eax
+ 118:	84 c0                	test   %al,%al
+ 11a:	75 ed                	jne    109 <strlen+0xf>
+    ;
+  return n;
+ 11c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 11f:	c9                   	leave
+ 120:	c3                   	ret
+
+00000121 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 121:	55                   	push   %ebp
+ 122:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 124:	8b 45 10             	mov    0x10(%ebp),%eax
+ 127:	50                   	push   %eax
+ 128:	ff 75 0c             	push   0xc(%ebp)
+ 12b:	ff 75 08             	push   0x8(%ebp)
+ 12e:	e8 32 ff ff ff       	call   65 <stosb>
+ 133:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 136:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 139:	c9                   	leave
+ 13a:	c3                   	ret
+
+0000013b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 13b:	55                   	push   %ebp
+ 13c:	89 e5                	mov    %esp,%ebp
+ 13e:	83 ec 04             	sub    $0x4,%esp
+ 141:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 144:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 147:	eb 14                	jmp    15d <strchr+0x22>
+    if(*s == c)
+ 149:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14c:	0f b6 00             	movzbl (%eax),%eax
+ 14f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 152:	75 05                	jne    159 <strchr+0x1e>
+      return (char*)s;
+ 154:	8b 45 08             	mov    0x8(%ebp),%eax
+ 157:	eb 13                	jmp    16c <strchr+0x31>
+  for(; *s; s++)
+ 159:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 15d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 160:	0f b6 00             	movzbl (%eax),%eax
+ 163:	84 c0                	test   %al,%al
+ 165:	75 e2                	jne    149 <strchr+0xe>
+  return 0;
+ 167:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 16c:	c9                   	leave
+ 16d:	c3                   	ret
+
+0000016e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 16e:	55                   	push   %ebp
+ 16f:	89 e5                	mov    %esp,%ebp
+ 171:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 174:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 17b:	eb 42                	jmp    1bf <gets+0x51>
+    cc = read(0, &c, 1);
+ 17d:	83 ec 04             	sub    $0x4,%esp
+ 180:	6a 01                	push   $0x1
+ 182:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 185:	50                   	push   %eax
+ 186:	6a 00                	push   $0x0
+ 188:	e8 85 01 00 00       	call   312 <read>
+ 18d:	83 c4 10             	add    $0x10,%esp
+ 190:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 193:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 197:	7e 33                	jle    1cc <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 199:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19c:	8d 50 01             	lea    0x1(%eax),%edx
+ 19f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1a2:	89 c2                	mov    %eax,%edx
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	01 c2                	add    %eax,%edx
+ 1a9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ad:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1af:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1b3:	3c 0a                	cmp    $0xa,%al
+ 1b5:	74 16                	je     1cd <gets+0x5f>
+ 1b7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bb:	3c 0d                	cmp    $0xd,%al
+ 1bd:	74 0e                	je     1cd <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c2:	83 c0 01             	add    $0x1,%eax
+ 1c5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1c8:	7f b3                	jg     17d <gets+0xf>
+ 1ca:	eb 01                	jmp    1cd <gets+0x5f>
+      break;
+ 1cc:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	01 d0                	add    %edx,%eax
+ 1d5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+
+000001dd <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+ 1e0:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e3:	83 ec 08             	sub    $0x8,%esp
+ 1e6:	6a 00                	push   $0x0
+ 1e8:	ff 75 08             	push   0x8(%ebp)
+ 1eb:	e8 4a 01 00 00       	call   33a <open>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+ 1f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1fa:	79 07                	jns    203 <stat+0x26>
+    return -1;
+ 1fc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 201:	eb 25                	jmp    228 <stat+0x4b>
+  r = fstat(fd, st);
+ 203:	83 ec 08             	sub    $0x8,%esp
+ 206:	ff 75 0c             	push   0xc(%ebp)
+ 209:	ff 75 f4             	push   -0xc(%ebp)
+ 20c:	e8 41 01 00 00       	call   352 <fstat>
+ 211:	83 c4 10             	add    $0x10,%esp
+ 214:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 217:	83 ec 0c             	sub    $0xc,%esp
+ 21a:	ff 75 f4             	push   -0xc(%ebp)
+ 21d:	e8 00 01 00 00       	call   322 <close>
+ 222:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 225:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 228:	c9                   	leave
+ 229:	c3                   	ret
+
+0000022a <atoi>:
+
+int
+atoi(const char *s)
+{
+ 22a:	55                   	push   %ebp
+ 22b:	89 e5                	mov    %esp,%ebp
+ 22d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 230:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 237:	eb 25                	jmp    25e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 239:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 23c:	89 d0                	mov    %edx,%eax
+ 23e:	c1 e0 02             	shl    $0x2,%eax
+ 241:	01 d0                	add    %edx,%eax
+ 243:	01 c0                	add    %eax,%eax
+ 245:	89 c1                	mov    %eax,%ecx
+ 247:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24a:	8d 50 01             	lea    0x1(%eax),%edx
+ 24d:	89 55 08             	mov    %edx,0x8(%ebp)
+ 250:	0f b6 00             	movzbl (%eax),%eax
+ 253:	0f be c0             	movsbl %al,%eax
+ 256:	01 c8                	add    %ecx,%eax
+ 258:	83 e8 30             	sub    $0x30,%eax
+ 25b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 25e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 261:	0f b6 00             	movzbl (%eax),%eax
+ 264:	3c 2f                	cmp    $0x2f,%al
+ 266:	7e 0a                	jle    272 <atoi+0x48>
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	0f b6 00             	movzbl (%eax),%eax
+ 26e:	3c 39                	cmp    $0x39,%al
+ 270:	7e c7                	jle    239 <atoi+0xf>
+  return n;
+ 272:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 27d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 280:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 283:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 286:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 289:	eb 17                	jmp    2a2 <memmove+0x2b>
+    *dst++ = *src++;
+ 28b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 28e:	8d 42 01             	lea    0x1(%edx),%eax
+ 291:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 294:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 297:	8d 48 01             	lea    0x1(%eax),%ecx
+ 29a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 29d:	0f b6 12             	movzbl (%edx),%edx
+ 2a0:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2a2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2a5:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2a8:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	7f dc                	jg     28b <memmove+0x14>
+  return vdst;
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2b2:	c9                   	leave
+ 2b3:	c3                   	ret
+
+000002b4 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 2b4:	55                   	push   %ebp
+ 2b5:	89 e5                	mov    %esp,%ebp
+ 2b7:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 2ba:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2c1:	eb 04                	jmp    2c7 <ncpus+0x13>
+ 2c3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2c7:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 2cb:	7f 16                	jg     2e3 <ncpus+0x2f>
+ 2cd:	83 ec 08             	sub    $0x8,%esp
+ 2d0:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 2d3:	50                   	push   %eax
+ 2d4:	ff 75 f4             	push   -0xc(%ebp)
+ 2d7:	e8 d6 00 00 00       	call   3b2 <intrstat>
+ 2dc:	83 c4 10             	add    $0x10,%esp
+ 2df:	85 c0                	test   %eax,%eax
+ 2e1:	74 e0                	je     2c3 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 2e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2e6:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2eb:	85 c0                	test   %eax,%eax
+ 2ed:	0f 4e c2             	cmovle %edx,%eax
+}
+ 2f0:	c9                   	leave
+ 2f1:	c3                   	ret
+
+000002f2 <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 2f2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <exit>:
+SYSCALL(exit)
+ 2fa:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <wait>:
+SYSCALL(wait)
+ 302:	b8 03 00 00 00       	mov    $0x3,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <pipe>:
+SYSCALL(pipe)
+ 30a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <read>:
+SYSCALL(read)
+ 312:	b8 05 00 00 00       	mov    $0x5,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <write>:
+SYSCALL(write)
+ 31a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <close>:
+SYSCALL(close)
+ 322:	b8 15 00 00 00       	mov    $0x15,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+0000032a <kill>:
+SYSCALL(kill)
+ 32a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 32f:	cd 40                	int    $0x40
+ 331:	c3                   	ret
+
+00000332 <exec>:
+SYSCALL(exec)
+ 332:	b8 07 00 00 00       	mov    $0x7,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <open>:
+SYSCALL(open)
+ 33a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 33f:	cd 40                	int    $0x40
+ 341:	c3                   	ret
+
+00000342 <mknod>:
+SYSCALL(mknod)
+ 342:	b8 11 00 00 00       	mov    $0x11,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <unlink>:
+SYSCALL(unlink)
+ 34a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <fstat>:
+SYSCALL(fstat)
+ 352:	b8 08 00 00 00       	mov    $0x8,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <link>:
+SYSCALL(link)
+ 35a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <mkdir>:
+SYSCALL(mkdir)
+ 362:	b8 14 00 00 00       	mov    $0x14,%eax
+ 367:	cd 40                	int    $0x40
+ 369:	c3                   	ret
+
+0000036a <chdir>:
+SYSCALL(chdir)
+ 36a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 36f:	cd 40                	int    $0x40
+ 371:	c3                   	ret
+
+00000372 <dup>:
+SYSCALL(dup)
+ 372:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 377:	cd 40                	int    $0x40
+ 379:	c3                   	ret
+
+0000037a <getpid>:
+SYSCALL(getpid)
+ 37a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 37f:	cd 40                	int    $0x40
+ 381:	c3                   	ret
+
+00000382 <sbrk>:
+SYSCALL(sbrk)
+ 382:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 387:	cd 40                	int    $0x40
+ 389:	c3                   	ret
+
+0000038a <sleep>:
+SYSCALL(sleep)
+ 38a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 38f:	cd 40                	int    $0x40
+ 391:	c3                   	ret
+
+00000392 <uptime>:
+SYSCALL(uptime)
+ 392:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 397:	cd 40                	int    $0x40
+ 399:	c3                   	ret
+
+0000039a <poll>:
+SYSCALL(poll)
+ 39a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+000003a2 <fcntl>:
+SYSCALL(fcntl)
+ 3a2:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+000003aa <irqroute>:
+SYSCALL(irqroute)
+ 3aa:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+000003b2 <intrstat>:
+SYSCALL(intrstat)
+ 3b2:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <pread>:
+SYSCALL(pread)
+ 3ba:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <getdents>:
+SYSCALL(getdents)
+ 3c2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <fstatat>:
+SYSCALL(fstatat)
+ 3ca:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <openat>:
+SYSCALL(openat)
+ 3d2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <unlinkat>:
+SYSCALL(unlinkat)
+ 3da:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <mkdirat>:
+SYSCALL(mkdirat)
+ 3e2:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <linkat>:
+SYSCALL(linkat)
+ 3ea:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <exits>:
+SYSCALL(exits)
+ 3f2:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <waitstatus>:
+SYSCALL(waitstatus)
+ 3fa:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <pwrite>:
+SYSCALL(pwrite)
+ 402:	b8 23 00 00 00       	mov    $0x23,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <lseek>:
+SYSCALL(lseek)
+ 40a:	b8 24 00 00 00       	mov    $0x24,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <copyfilerange>:
+SYSCALL(copyfilerange)
+ 412:	b8 25 00 00 00       	mov    $0x25,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <fsctl>:
+SYSCALL(fsctl)
+ 41a:	b8 26 00 00 00       	mov    $0x26,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 422:	55                   	push   %ebp
+ 423:	89 e5                	mov    %esp,%ebp
+ 425:	83 ec 18             	sub    $0x18,%esp
+ 428:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 42b:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 42e:	83 ec 04             	sub    $0x4,%esp
+ 431:	6a 01                	push   $0x1
+ 433:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 436:	50                   	push   %eax
+ 437:	ff 75 08             	push   0x8(%ebp)
+ 43a:	e8 db fe ff ff       	call   31a <write>
+ 43f:	83 c4 10             	add    $0x10,%esp
+}
+ 442:	90                   	nop
+ 443:	c9                   	leave
+ 444:	c3                   	ret
+
+00000445 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 445:	55                   	push   %ebp
+ 446:	89 e5                	mov    %esp,%ebp
+ 448:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 44b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 452:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 456:	74 17                	je     46f <printint+0x2a>
+ 458:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 45c:	79 11                	jns    46f <printint+0x2a>
+    neg = 1;
+ 45e:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 465:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 468:	f7 d8                	neg    %eax
+ 46a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 46d:	eb 06                	jmp    475 <printint+0x30>
+  } else {
+    x = xx;
+ 46f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 472:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 475:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 47c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 47f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 482:	ba 00 00 00 00       	mov    $0x0,%edx
+ 487:	f7 f1                	div    %ecx
+ 489:	89 d1                	mov    %edx,%ecx
+ 48b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 48e:	8d 50 01             	lea    0x1(%eax),%edx
+ 491:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 494:	0f b6 91 28 0b 00 00 	movzbl 0xb28(%ecx),%edx
+ 49b:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 49f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4a2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4a5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4aa:	f7 f1                	div    %ecx
+ 4ac:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4af:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4b3:	75 c7                	jne    47c <printint+0x37>
+  if(neg)
+ 4b5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4b9:	74 2d                	je     4e8 <printint+0xa3>
+    buf[i++] = '-';
+ 4bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4be:	8d 50 01             	lea    0x1(%eax),%edx
+ 4c1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4c4:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 4c9:	eb 1d                	jmp    4e8 <printint+0xa3>
+    putc(fd, buf[i]);
+ 4cb:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 4ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4d1:	01 d0                	add    %edx,%eax
+ 4d3:	0f b6 00             	movzbl (%eax),%eax
+ 4d6:	0f be c0             	movsbl %al,%eax
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	50                   	push   %eax
+ 4dd:	ff 75 08             	push   0x8(%ebp)
+ 4e0:	e8 3d ff ff ff       	call   422 <putc>
+ 4e5:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 4e8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4ec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4f0:	79 d9                	jns    4cb <printint+0x86>
+}
+ 4f2:	90                   	nop
+ 4f3:	90                   	nop
+ 4f4:	c9                   	leave
+ 4f5:	c3                   	ret
+
+000004f6 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4f6:	55                   	push   %ebp
+ 4f7:	89 e5                	mov    %esp,%ebp
+ 4f9:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 4fc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 503:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 506:	83 c0 04             	add    $0x4,%eax
+ 509:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 50c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 513:	e9 59 01 00 00       	jmp    671 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 518:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 51b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 51e:	01 d0                	add    %edx,%eax
+ 520:	0f b6 00             	movzbl (%eax),%eax
+ 523:	0f be c0             	movsbl %al,%eax
+ 526:	25 ff 00 00 00       	and    $0xff,%eax
+ 52b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 52e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 532:	75 2c                	jne    560 <printf+0x6a>
+      if(c == '%'){
+ 534:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 538:	75 0c                	jne    546 <printf+0x50>
+        state = '%';
+ 53a:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 541:	e9 27 01 00 00       	jmp    66d <printf+0x177>
+      } else {
+        putc(fd, c);
+ 546:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 549:	0f be c0             	movsbl %al,%eax
+ 54c:	83 ec 08             	sub    $0x8,%esp
+ 54f:	50                   	push   %eax
+ 550:	ff 75 08             	push   0x8(%ebp)
+ 553:	e8 ca fe ff ff       	call   422 <putc>
+ 558:	83 c4 10             	add    $0x10,%esp
+ 55b:	e9 0d 01 00 00       	jmp    66d <printf+0x177>
+      }
+    } else if(state == '%'){
+ 560:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 564:	0f 85 03 01 00 00    	jne    66d <printf+0x177>
+      if(c == 'd'){
+ 56a:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 56e:	75 1e                	jne    58e <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 570:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 573:	8b 00                	mov    (%eax),%eax
+ 575:	6a 01                	push   $0x1
+ 577:	6a 0a                	push   $0xa
+ 579:	50                   	push   %eax
+ 57a:	ff 75 08             	push   0x8(%ebp)
+ 57d:	e8 c3 fe ff ff       	call   445 <printint>
+ 582:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 585:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 589:	e9 d8 00 00 00       	jmp    666 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 58e:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 592:	74 06                	je     59a <printf+0xa4>
+ 594:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 598:	75 1e                	jne    5b8 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 59a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 59d:	8b 00                	mov    (%eax),%eax
+ 59f:	6a 00                	push   $0x0
+ 5a1:	6a 10                	push   $0x10
+ 5a3:	50                   	push   %eax
+ 5a4:	ff 75 08             	push   0x8(%ebp)
+ 5a7:	e8 99 fe ff ff       	call   445 <printint>
+ 5ac:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5af:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5b3:	e9 ae 00 00 00       	jmp    666 <printf+0x170>
+      } else if(c == 's'){
+ 5b8:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5bc:	75 43                	jne    601 <printf+0x10b>
+        s = (char*)*ap;
+ 5be:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c1:	8b 00                	mov    (%eax),%eax
+ 5c3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 5c6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 5ca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5ce:	75 25                	jne    5f5 <printf+0xff>
+          s = "(null)";
+ 5d0:	c7 45 f4 b6 08 00 00 	movl   $0x8b6,-0xc(%ebp)
+        while(*s != 0){
+ 5d7:	eb 1c                	jmp    5f5 <printf+0xff>
+          putc(fd, *s);
+ 5d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5dc:	0f b6 00             	movzbl (%eax),%eax
+ 5df:	0f be c0             	movsbl %al,%eax
+ 5e2:	83 ec 08             	sub    $0x8,%esp
+ 5e5:	50                   	push   %eax
+ 5e6:	ff 75 08             	push   0x8(%ebp)
+ 5e9:	e8 34 fe ff ff       	call   422 <putc>
+ 5ee:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 5f1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 5f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f8:	0f b6 00             	movzbl (%eax),%eax
+ 5fb:	84 c0                	test   %al,%al
+ 5fd:	75 da                	jne    5d9 <printf+0xe3>
+ 5ff:	eb 65                	jmp    666 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 601:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 605:	75 1d                	jne    624 <printf+0x12e>
+        putc(fd, *ap);
+ 607:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 60a:	8b 00                	mov    (%eax),%eax
+ 60c:	0f be c0             	movsbl %al,%eax
+ 60f:	83 ec 08             	sub    $0x8,%esp
+ 612:	50                   	push   %eax
+ 613:	ff 75 08             	push   0x8(%ebp)
+ 616:	e8 07 fe ff ff       	call   422 <putc>
+ 61b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 61e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 622:	eb 42                	jmp    666 <printf+0x170>
+      } else if(c == '%'){
+ 624:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 628:	75 17                	jne    641 <printf+0x14b>
+        putc(fd, c);
+ 62a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 62d:	0f be c0             	movsbl %al,%eax
+ 630:	83 ec 08             	sub    $0x8,%esp
+ 633:	50                   	push   %eax
+ 634:	ff 75 08             	push   0x8(%ebp)
+ 637:	e8 e6 fd ff ff       	call   422 <putc>
+ 63c:	83 c4 10             	add    $0x10,%esp
+ 63f:	eb 25                	jmp    666 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 641:	83 ec 08             	sub    $0x8,%esp
+ 644:	6a 25                	push   $0x25
+ 646:	ff 75 08             	push   0x8(%ebp)
+ 649:	e8 d4 fd ff ff       	call   422 <putc>
+ 64e:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 651:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 654:	0f be c0             	movsbl %al,%eax
+ 657:	83 ec 08             	sub    $0x8,%esp
+ 65a:	50                   	push   %eax
+ 65b:	ff 75 08             	push   0x8(%ebp)
+ 65e:	e8 bf fd ff ff       	call   422 <putc>
+ 663:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 666:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 66d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 671:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 674:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 677:	01 d0                	add    %edx,%eax
+ 679:	0f b6 00             	movzbl (%eax),%eax
+ 67c:	84 c0                	test   %al,%al
+ 67e:	0f 85 94 fe ff ff    	jne    518 <printf+0x22>
+    }
+  }
+}
+ 684:	90                   	nop
+ 685:	90                   	nop
+ 686:	c9                   	leave
+ 687:	c3                   	ret
+
+00000688 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 688:	55                   	push   %ebp
+ 689:	89 e5                	mov    %esp,%ebp
+ 68b:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 68e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 691:	83 e8 08             	sub    $0x8,%eax
+ 694:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 697:	a1 44 0b 00 00       	mov    0xb44,%eax
+ 69c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 69f:	eb 24                	jmp    6c5 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a4:	8b 00                	mov    (%eax),%eax
+ 6a6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6a9:	72 12                	jb     6bd <free+0x35>
+ 6ab:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6ae:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6b1:	72 24                	jb     6d7 <free+0x4f>
+ 6b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b6:	8b 00                	mov    (%eax),%eax
+ 6b8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6bb:	72 1a                	jb     6d7 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c0:	8b 00                	mov    (%eax),%eax
+ 6c2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6c5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6c8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6cb:	73 d4                	jae    6a1 <free+0x19>
+ 6cd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d0:	8b 00                	mov    (%eax),%eax
+ 6d2:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6d5:	73 ca                	jae    6a1 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6d7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6da:	8b 40 04             	mov    0x4(%eax),%eax
+ 6dd:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6e4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e7:	01 c2                	add    %eax,%edx
+ 6e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ec:	8b 00                	mov    (%eax),%eax
+ 6ee:	39 c2                	cmp    %eax,%edx
+ 6f0:	75 24                	jne    716 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 6f2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f5:	8b 50 04             	mov    0x4(%eax),%edx
+ 6f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fb:	8b 00                	mov    (%eax),%eax
+ 6fd:	8b 40 04             	mov    0x4(%eax),%eax
+ 700:	01 c2                	add    %eax,%edx
+ 702:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 705:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 708:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 70b:	8b 00                	mov    (%eax),%eax
+ 70d:	8b 10                	mov    (%eax),%edx
+ 70f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 712:	89 10                	mov    %edx,(%eax)
+ 714:	eb 0a                	jmp    720 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 716:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 719:	8b 10                	mov    (%eax),%edx
+ 71b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 71e:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 720:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 723:	8b 40 04             	mov    0x4(%eax),%eax
+ 726:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 72d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 730:	01 d0                	add    %edx,%eax
+ 732:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 735:	75 20                	jne    757 <free+0xcf>
+    p->s.size += bp->s.size;
+ 737:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73a:	8b 50 04             	mov    0x4(%eax),%edx
+ 73d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 740:	8b 40 04             	mov    0x4(%eax),%eax
+ 743:	01 c2                	add    %eax,%edx
+ 745:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 748:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 74b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74e:	8b 10                	mov    (%eax),%edx
+ 750:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 753:	89 10                	mov    %edx,(%eax)
+ 755:	eb 08                	jmp    75f <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 757:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 75d:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 75f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 762:	a3 44 0b 00 00       	mov    %eax,0xb44
+}
+ 767:	90                   	nop
+ 768:	c9                   	leave
+ 769:	c3                   	ret
+
+0000076a <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 76a:	55                   	push   %ebp
+ 76b:	89 e5                	mov    %esp,%ebp
+ 76d:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 770:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 777:	77 07                	ja     780 <morecore+0x16>
+    nu = 4096;
+ 779:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 780:	8b 45 08             	mov    0x8(%ebp),%eax
+ 783:	c1 e0 03             	shl    $0x3,%eax
+ 786:	83 ec 0c             	sub    $0xc,%esp
+ 789:	50                   	push   %eax
+ 78a:	e8 f3 fb ff ff       	call   382 <sbrk>
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 795:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 799:	75 07                	jne    7a2 <morecore+0x38>
+    return 0;
+ 79b:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7a0:	eb 26                	jmp    7c8 <morecore+0x5e>
+  hp = (Header*)p;
+ 7a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ab:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7ae:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7b1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b4:	83 c0 08             	add    $0x8,%eax
+ 7b7:	83 ec 0c             	sub    $0xc,%esp
+ 7ba:	50                   	push   %eax
+ 7bb:	e8 c8 fe ff ff       	call   688 <free>
+ 7c0:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 7c3:	a1 44 0b 00 00       	mov    0xb44,%eax
+}
+ 7c8:	c9                   	leave
+ 7c9:	c3                   	ret
+
+000007ca <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7ca:	55                   	push   %ebp
+ 7cb:	89 e5                	mov    %esp,%ebp
+ 7cd:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d3:	83 c0 07             	add    $0x7,%eax
+ 7d6:	c1 e8 03             	shr    $0x3,%eax
+ 7d9:	83 c0 01             	add    $0x1,%eax
+ 7dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 7df:	a1 44 0b 00 00       	mov    0xb44,%eax
+ 7e4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7e7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7eb:	75 23                	jne    810 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 7ed:	c7 45 f0 3c 0b 00 00 	movl   $0xb3c,-0x10(%ebp)
+ 7f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7f7:	a3 44 0b 00 00       	mov    %eax,0xb44
+ 7fc:	a1 44 0b 00 00       	mov    0xb44,%eax
+ 801:	a3 3c 0b 00 00       	mov    %eax,0xb3c
+    base.s.size = 0;
+ 806:	c7 05 40 0b 00 00 00 	movl   $0x0,0xb40
+ 80d:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 810:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 813:	8b 00                	mov    (%eax),%eax
+ 815:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 818:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81b:	8b 40 04             	mov    0x4(%eax),%eax
+ 81e:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 821:	72 4d                	jb     870 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 823:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 826:	8b 40 04             	mov    0x4(%eax),%eax
+ 829:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 82c:	75 0c                	jne    83a <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 82e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 831:	8b 10                	mov    (%eax),%edx
+ 833:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 836:	89 10                	mov    %edx,(%eax)
+ 838:	eb 26                	jmp    860 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 83a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83d:	8b 40 04             	mov    0x4(%eax),%eax
+ 840:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 843:	89 c2                	mov    %eax,%edx
+ 845:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 848:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 84b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84e:	8b 40 04             	mov    0x4(%eax),%eax
+ 851:	c1 e0 03             	shl    $0x3,%eax
+ 854:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 857:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 85d:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 860:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 863:	a3 44 0b 00 00       	mov    %eax,0xb44
+      return (void*)(p + 1);
+ 868:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86b:	83 c0 08             	add    $0x8,%eax
+ 86e:	eb 3b                	jmp    8ab <malloc+0xe1>
+    }
+    if(p == freep)
+ 870:	a1 44 0b 00 00       	mov    0xb44,%eax
+ 875:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 878:	75 1e                	jne    898 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 87a:	83 ec 0c             	sub    $0xc,%esp
+ 87d:	ff 75 ec             	push   -0x14(%ebp)
+ 880:	e8 e5 fe ff ff       	call   76a <morecore>
+ 885:	83 c4 10             	add    $0x10,%esp
+ 888:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 88b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 88f:	75 07                	jne    898 <malloc+0xce>
+        return 0;
+ 891:	b8 00 00 00 00       	mov    $0x0,%eax
+ 896:	eb 13                	jmp    8ab <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 89b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 89e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a1:	8b 00                	mov    (%eax),%eax
+ 8a3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8a6:	e9 6d ff ff ff       	jmp    818 <malloc+0x4e>
+  }
+}
+ 8ab:	c9                   	leave
+ 8ac:	c3                   	ret
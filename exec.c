@@ -18,7 +18,7 @@ exec(char *path, char **argv)
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
 
-  begin_op();
+  begin_op(IPUTBLOCKS);
   if((ip = namei(path)) == 0){
     end_op();
     return -1;
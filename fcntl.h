@@ -2,3 +2,21 @@
 #define O_WRONLY  0x001
 #define O_RDWR    0x002
 #define O_CREATE  0x200
+#define O_NONBLOCK 0x800
+
+// Directory argument of the *at() calls meaning the current
+// directory.
+#define AT_FDCWD  -100
+
+// lseek() whence
+#define SEEK_SET  0  // offset from the start
+#define SEEK_CUR  1  // from the current offset
+#define SEEK_END  2  // from the end
+
+// fcntl() commands
+#define F_GETFL   1  // return open mode flags
+#define F_SETFL   2  // set O_NONBLOCK from arg
+
+// Returned, negated, by read() and write() on an O_NONBLOCK
+// descriptor when the call would otherwise have to sleep.
+#define EAGAIN   11
@@ -5,20 +5,42 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "proc.h"
 #include "fs.h"
 #include "file.h"
 #include "spinlock.h"
+#include "poll.h"
+#include "fcntl.h"
 
 struct devsw devsw[NDEV];
+
+// Files come from pages of them, taken from kalloc() when the
+// free list runs dry and kept after, so the number open is
+// limited only by memory.
+#define NFPAGE (PGSIZE / sizeof(struct file))
+
 struct {
   struct spinlock lock;
-  struct file file[NFILE];
+  struct file *free;  // files with ref 0, linked by next
 } ftable;
 
+// Processes in poll() sleep on pollq.seq.  Anything that might
+// make a file ready (pipe reads and writes, console input) bumps
+// seq and wakes them, and they rescan their descriptors.
+struct {
+  struct spinlock lock;
+  uint seq;
+  int nwait;   // processes in poll()
+  int ntimed;  // ... of which have a timeout
+} pollq;
+
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  initlock(&pollq.lock, "pollq");
 }
 
 // Allocate a file structure.
@@ -26,17 +48,25 @@ struct file*
 filealloc(void)
 {
   struct file *f;
+  int i;
 
   acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
+  if(ftable.free == 0){
+    if((f = (struct file*)kalloc()) == 0){
       release(&ftable.lock);
-      return f;
+      return 0;
+    }
+    memset(f, 0, PGSIZE);
+    for(i = 0; i < NFPAGE; i++){
+      f[i].next = ftable.free;
+      ftable.free = &f[i];
     }
   }
+  f = ftable.free;
+  ftable.free = f->next;
+  f->ref = 1;
   release(&ftable.lock);
-  return 0;
+  return f;
 }
 
 // Increment ref count for file f.
@@ -67,17 +97,121 @@ fileclose(struct file *f)
   ff = *f;
   f->ref = 0;
   f->type = FD_NONE;
+  f->next = ftable.free;
+  ftable.free = f;
   release(&ftable.lock);
   
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
   else if(ff.type == FD_INODE){
-    begin_op();
+    begin_op(IPUTBLOCKS);
     iput(ff.ip);
     end_op();
   }
 }
 
+//PAGEBREAK!
+// Descriptor tables.  A process starts with the NOFILE slots
+// in struct proc, and fdalloc() moves its table to a page of
+// MAXOFILE when those run out.  fdmap has a bit set for each
+// descriptor in use, so that the lowest free one, and those to
+// copy or close, are found a word at a time.
+
+// Give p an empty descriptor table.
+void
+fdinit(struct proc *p)
+{
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE;
+  memset(p->ofile0, 0, sizeof(p->ofile0));
+  memset(p->fdmap, 0, sizeof(p->fdmap));
+}
+
+// Allocate the lowest free file descriptor of the current
+// process for f.  Takes over file reference from caller on
+// success.
+int
+fdalloc(struct file *f)
+{
+  struct file **t;
+  int i, fd;
+
+  for(i = 0; i < MAXOFILE/32 && proc->fdmap[i] == ~0; i++)
+    ;
+  if(i == MAXOFILE/32)
+    return -1;
+  for(fd = i*32; proc->fdmap[i] & (1U << fd%32); fd++)
+    ;
+  if(fd >= proc->nofile){
+    if((t = (struct file**)kalloc()) == 0)
+      return -1;
+    memset(t, 0, PGSIZE);
+    memmove(t, proc->ofile, proc->nofile*sizeof(t[0]));
+    proc->ofile = t;
+    proc->nofile = MAXOFILE;
+  }
+  proc->fdmap[i] |= 1U << fd%32;
+  proc->ofile[fd] = f;
+  return fd;
+}
+
+// Free descriptor fd of the current process and return its
+// file, whose reference passes to the caller.
+struct file*
+fdfree(int fd)
+{
+  struct file *f;
+
+  f = proc->ofile[fd];
+  proc->ofile[fd] = 0;
+  proc->fdmap[fd/32] &= ~(1U << fd%32);
+  return f;
+}
+
+// Give np, just allocated, a copy of the current process's
+// descriptors.  Returns -1 if there is no memory for it.
+int
+fdcopy(struct proc *np)
+{
+  int i, fd;
+
+  if(proc->nofile > NOFILE){
+    if((np->ofile = (struct file**)kalloc()) == 0){
+      np->ofile = np->ofile0;
+      return -1;
+    }
+    memset(np->ofile, 0, PGSIZE);
+    np->nofile = proc->nofile;
+  }
+  for(i = 0; i < MAXOFILE/32; i++){
+    np->fdmap[i] = proc->fdmap[i];
+    if(proc->fdmap[i] == 0)
+      continue;
+    for(fd = i*32; fd < (i+1)*32; fd++)
+      if(proc->fdmap[i] & (1U << fd%32))
+        np->ofile[fd] = filedup(proc->ofile[fd]);
+  }
+  return 0;
+}
+
+// Close all of the current process's descriptors.
+void
+fdcloseall(void)
+{
+  int i, fd;
+
+  for(i = 0; i < MAXOFILE/32; i++){
+    if(proc->fdmap[i] == 0)
+      continue;
+    for(fd = i*32; fd < (i+1)*32; fd++)
+      if(proc->fdmap[i] & (1U << fd%32))
+        fileclose(fdfree(fd));
+  }
+  if(proc->ofile != proc->ofile0)
+    kfree((char*)proc->ofile);
+  fdinit(proc);
+}
+
 // Get metadata about file f.
 int
 filestat(struct file *f, struct stat *st)
@@ -100,10 +234,17 @@ fileread(struct file *f, char *addr, int n)
   if(f->readable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return piperead(f->pipe, addr, n);
+    return piperead(f->pipe, addr, n, f->nonblock);
   if(f->type == FD_INODE){
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+    if(f->ip->type == T_DEV){
+      // The device decides, under its own lock, whether the
+      // read would sleep, as piperead() does.
+      r = -1;
+      if(f->ip->major >= 0 && f->ip->major < NDEV &&
+         devsw[f->ip->major].read)
+        r = devsw[f->ip->major].read(f->ip, addr, n, f->nonblock);
+    } else if((r = readi(f->ip, addr, f->off, n)) > 0)
       f->off += r;
     iunlock(f->ip);
     return r;
@@ -111,46 +252,253 @@ fileread(struct file *f, char *addr, int n)
   panic("fileread");
 }
 
+// Read from file f at offset off, leaving f->off alone.
+// Pipes and devices have no offsets.
+int
+filepread(struct file *f, char *addr, int n, uint off)
+{
+  int r;
+
+  if(f->readable == 0 || f->type != FD_INODE)
+    return -1;
+  ilock(f->ip);
+  r = -1;
+  if(f->ip->type != T_DEV)
+    r = readi(f->ip, addr, off, n);
+  iunlock(f->ip);
+  return r;
+}
+
+// Set f's offset to off from the start (SEEK_SET), the current
+// offset (SEEK_CUR) or the end (SEEK_END), and return it.  The
+// offset may pass the end; a write there leaves a hole.
+// Pipes and devices have no offsets.
+int
+fileseek(struct file *f, int off, int whence)
+{
+  int base;
+
+  if(f->type != FD_INODE)
+    return -1;
+  ilock(f->ip);
+  if(f->ip->type == T_DEV){
+    iunlock(f->ip);
+    return -1;
+  }
+  switch(whence){
+  case SEEK_SET:
+    base = 0;
+    break;
+  case SEEK_CUR:
+    base = f->off;
+    break;
+  case SEEK_END:
+    base = f->ip->size;
+    break;
+  default:
+    iunlock(f->ip);
+    return -1;
+  }
+  if(base + off < 0){
+    iunlock(f->ip);
+    return -1;
+  }
+  f->off = base + off;
+  iunlock(f->ip);
+  return f->off;
+}
+
+// Return the subset of events (plus POLLERR and POLLHUP,
+// which are always reported) that are ready on file f.
+int
+filepoll(struct file *f, int events)
+{
+  int r;
+  struct inode *ip;
+
+  r = 0;
+  if(f->type == FD_PIPE)
+    r = pipepoll(f->pipe, f->writable);
+  else if(f->type == FD_INODE){
+    ip = f->ip;
+    if(ip->type == T_DEV && ip->major >= 0 && ip->major < NDEV &&
+       devsw[ip->major].poll)
+      r = devsw[ip->major].poll(ip);
+    else
+      r = POLLIN | POLLOUT;  // disk files never block
+  }
+  if(!f->readable)
+    r &= ~POLLIN;
+  if(!f->writable)
+    r &= ~POLLOUT;
+  return r & (events | POLLERR | POLLHUP);
+}
+
+// Register the calling process as a poller and return the
+// current wakeup sequence number.  timed is non-zero if the
+// poller also wants to be woken at each clock tick.
+uint
+pollstart(int timed)
+{
+  uint seq;
+
+  acquire(&pollq.lock);
+  pollq.nwait++;
+  if(timed)
+    pollq.ntimed++;
+  seq = pollq.seq;
+  release(&pollq.lock);
+  return seq;
+}
+
+// Sleep until something has called pollwakeup() since the
+// poller observed seq.  Returns the new sequence number.
+uint
+pollwait(uint seq)
+{
+  acquire(&pollq.lock);
+  while(pollq.seq == seq && !proc->killed)
+    sleep(&pollq.seq, &pollq.lock);
+  seq = pollq.seq;
+  release(&pollq.lock);
+  return seq;
+}
+
+void
+polldone(int timed)
+{
+  acquire(&pollq.lock);
+  pollq.nwait--;
+  if(timed)
+    pollq.ntimed--;
+  release(&pollq.lock);
+}
+
+// Some file may have become ready; make pollers rescan.
+void
+pollwakeup(void)
+{
+  acquire(&pollq.lock);
+  pollq.seq++;
+  if(pollq.nwait > 0)
+    wakeup(&pollq.seq);
+  release(&pollq.lock);
+}
+
+// Called on every clock tick so that poll() timeouts expire.
+void
+polltick(void)
+{
+  if(pollq.ntimed > 0)
+    pollwakeup();
+}
+
+// Write n bytes of an inode file at *off, advancing *off.
+static int
+fileiwrite(struct file *f, char *addr, int n, uint *off)
+{
+  int r, max, i, n1;
+
+  // write a few blocks at a time, each chunk reserving
+  // WRITEBLOCKS() of the log (see file.h).
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  max = WRITEMAX;
+  i = 0;
+  while(i < n){
+    n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_op(WRITEBLOCKS(n1));
+    ilock(f->ip);
+    if ((r = writei(f->ip, addr + i, *off, n1)) > 0)
+      *off += r;
+    iunlock(f->ip);
+    end_op();
+
+    if(r < 0)
+      break;
+    i += r;
+    // writei() stops at a compressed cluster.  If iexpand()
+    // finds it expanded already, another writer got there first
+    // and writei() can go on.
+    if(r != n1 && iexpand(f->ip, *off) < 0)
+      break;
+  }
+  return i == n ? n : -1;
+}
+
 //PAGEBREAK!
 // Write to file f.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
-
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((LOGSIZE-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
-
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
-    }
-    return i == n ? n : -1;
-  }
+    return pipewrite(f->pipe, addr, n, f->nonblock);
+  if(f->type == FD_INODE)
+    return fileiwrite(f, addr, n, &f->off);
   panic("filewrite");
 }
 
+// Copy n bytes from fin at offin to fout at offout, without
+// using or moving either offset, a few blocks per transaction
+// as fileiwrite() does.  Returns the number of bytes copied.
+int
+filecopy(struct file *fin, uint offin, struct file *fout, uint offout, int n)
+{
+  struct inode *a, *b;
+  int r, i, n1, eof;
+
+  if(fin->readable == 0 || fout->writable == 0 ||
+     fin->type != FD_INODE || fout->type != FD_INODE)
+    return -1;
+
+  // Lock the two inodes in i-number order.
+  a = fin->ip;
+  b = fout->ip;
+  if(a->inum > b->inum){
+    a = fout->ip;
+    b = fin->ip;
+  }
+  i = 0;
+  while(i < n){
+    n1 = n - i;
+    if(n1 > WRITEMAX)
+      n1 = WRITEMAX;
+
+    begin_op(WRITEBLOCKS(n1));
+    ilock(a);
+    if(b != a)
+      ilock(b);
+    r = copyi(fout->ip, offout + i, fin->ip, offin + i, n1);
+    eof = offin + i + r >= fin->ip->size;
+    if(b != a)
+      iunlock(b);
+    iunlock(a);
+    end_op();
+
+    if(r < 0)
+      return i > 0 ? i : -1;
+    i += r;
+    // copyi() stops at the end of fin, or at a compressed
+    // cluster of fout, which must be expanded to go on; as in
+    // fileiwrite(), one expanded already by another writer
+    // is no reason to stop.
+    if(r < n1 && (eof || iexpand(fout->ip, offout + i) < 0))
+      break;
+  }
+  return i;
+}
+
+// Write at offset off without using or moving f->off.
+int
+filepwrite(struct file *f, char *addr, int n, uint off)
+{
+  if(f->writable == 0 || f->type != FD_INODE || f->ip->type == T_DEV)
+    return -1;
+  return fileiwrite(f, addr, n, &off);
+}
+
@@ -3,9 +3,11 @@ struct file {
   int ref; // reference count
   char readable;
   char writable;
+  char nonblock;  // O_NONBLOCK: fail with -EAGAIN instead of sleeping
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  struct file *next;  // on ftable's free list, when ref is 0
 };
 
 
@@ -14,7 +16,7 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
-  int flags;          // I_BUSY, I_VALID
+  int flags;          // I_BUSY, I_VALID, I_DIRTY, I_RECLAIM
 
   short type;         // copy of disk inode
   short major;
@@ -22,15 +24,32 @@ struct inode {
   short nlink;
   uint size;
   uint addrs[NDIRECT+1];
+
+  uchar *cpage;       // kalloc()ed page for compressed clusters, or 0
+  int ccluster;       // cluster decompressed in cpage, or -1
 };
+// Log blocks a write of n bytes can use: each data block (one
+// more if unaligned), its bitmap block and the reference count
+// block of the shared block it replaces, the i-node and the
+// indirect block.
+#define WRITEBLOCKS(n) (3*(((n)+BSIZE-1)/BSIZE + 1) + 2)
+
+// Largest write to do in one transaction: it may reserve at
+// most half the log, so that two large writes can proceed
+// together.
+#define WRITEMAX (((LOGSIZE/2-1-1-3) / 3) * BSIZE)
+
 #define I_BUSY 0x1
 #define I_VALID 0x2
+#define I_DIRTY 0x4  // changed in this transaction; see iupdate()
+#define I_RECLAIM 0x8  // unlinked, waiting for the reclaimer; see iput()
 
 // table mapping major device number to
 // device functions
 struct devsw {
-  int (*read)(struct inode*, char*, int);
+  int (*read)(struct inode*, char*, int, int);  // last: nonblock
   int (*write)(struct inode*, char*, int);
+  int (*poll)(struct inode*);  // returns POLLIN/POLLOUT readiness
 };
 
 extern struct devsw devsw[];
@@ -19,9 +19,11 @@
 #include "buf.h"
 #include "fs.h"
 #include "file.h"
+#include "fsctl.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
-static void itrunc(struct inode*);
+static int itrunc(struct inode*);
+static int tail(uint*, int, uint*);
 
 // Read the super block.
 void
@@ -64,7 +66,7 @@ balloc(uint dev)
       m = 1 << (bi % 8);
       if((bp->data[bi/8] & m) == 0){  // Is block free?
         bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
+        log_writerange(bp, bi/8, 1);
         brelse(bp);
         bzero(dev, b + bi);
         return b + bi;
@@ -75,23 +77,156 @@ balloc(uint dev)
   panic("balloc: out of blocks");
 }
 
-// Free a disk block.
-static void
-bfree(int dev, uint b)
+// Mark block b in use, if it is free.  Returns -1 if it is not.
+static int
+bclaim(uint dev, uint b)
 {
   struct buf *bp;
   struct superblock sb;
-  int bi, m;
+  int bi, m, r;
 
   readsb(dev, &sb);
   bp = bread(dev, BBLOCK(b, sb.ninodes));
   bi = b % BPB;
   m = 1 << (bi % 8);
-  if((bp->data[bi/8] & m) == 0)
-    panic("freeing free block");
-  bp->data[bi/8] &= ~m;
-  log_write(bp);
+  r = -1;
+  if((bp->data[bi/8] & m) == 0){
+    bp->data[bi/8] |= m;
+    log_writerange(bp, bi/8, 1);
+    r = 0;
+  }
   brelse(bp);
+  return r;
+}
+
+// Return the first of n consecutive free blocks, or 0 if there
+// is no such run.  Nothing is marked: the blocks can be taken
+// by others before the caller claims them.
+static uint
+bfindrun(uint dev, uint n)
+{
+  struct buf *bp;
+  struct superblock sb;
+  uint b, start;
+
+  readsb(dev, &sb);
+  bp = 0;
+  start = 0;
+  for(b = 0; b < sb.size - sb.nlog; b++){
+    if(bp == 0 || bp->sector != BBLOCK(b, sb.ninodes)){
+      if(bp)
+        brelse(bp);
+      bp = bread(dev, BBLOCK(b, sb.ninodes));
+    }
+    if(bp->data[(b%BPB)/8] & (1 << (b%8)))
+      start = b + 1;
+    else if(b + 1 - start == n)
+      break;
+  }
+  if(bp)
+    brelse(bp);
+  return b < sb.size - sb.nlog ? start : 0;
+}
+
+// Return the reference count of block b.
+static int
+brefs(uint dev, uint b)
+{
+  struct buf *bp;
+  struct superblock sb;
+  int n;
+
+  readsb(dev, &sb);
+  bp = bread(dev, RBLOCK(b, sb.ninodes, sb.size));
+  n = bp->data[b%RPB];
+  brelse(bp);
+  return n;
+}
+
+// Add a file to those sharing block b.  Returns -1 if the count
+// is at its limit, in which case the caller must copy instead.
+static int
+bshare(uint dev, uint b)
+{
+  struct buf *bp;
+  struct superblock sb;
+  int r;
+
+  readsb(dev, &sb);
+  bp = bread(dev, RBLOCK(b, sb.ninodes, sb.size));
+  r = -1;
+  if(bp->data[b%RPB] < 255){
+    bp->data[b%RPB]++;
+    log_writerange(bp, b%RPB, 1);
+    r = 0;
+  }
+  brelse(bp);
+  return r;
+}
+
+// Drop a reference to each of the disk blocks a[0..n), skipping
+// zeros, and clear a[].  Shared blocks just lose a count; the
+// rest are freed.  Those are taken a bitmap block at a time, so
+// that each bitmap block is read and logged once however many
+// of them it covers.
+static void
+bfree(int dev, uint *a, int n)
+{
+  struct buf *bp;
+  struct superblock sb;
+  uint g, next;
+  int i, bi, m, lo, hi;
+
+  readsb(dev, &sb);
+  bp = 0;
+  for(i = 0; i < n; i++){
+    if(a[i] == CADDR)  // marks a compressed cluster; not a block
+      a[i] = 0;
+    if(a[i] == 0)
+      continue;
+    if(bp == 0 || bp->sector != RBLOCK(a[i], sb.ninodes, sb.size)){
+      if(bp)
+        brelse(bp);
+      bp = bread(dev, RBLOCK(a[i], sb.ninodes, sb.size));
+    }
+    if(bp->data[a[i]%RPB] > 0){
+      bp->data[a[i]%RPB]--;
+      log_writerange(bp, a[i]%RPB, 1);
+      a[i] = 0;
+    }
+  }
+  if(bp)
+    brelse(bp);
+
+  g = 0;  // bitmap block last done, as b/BPB + 1
+  for(;;){
+    next = 0;
+    for(i = 0; i < n; i++)
+      if(a[i] && a[i]/BPB + 1 > g && (next == 0 || a[i]/BPB + 1 < next))
+        next = a[i]/BPB + 1;
+    if(next == 0)
+      break;
+    g = next;
+    bp = bread(dev, BBLOCK((g-1)*BPB, sb.ninodes));
+    lo = BSIZE;
+    hi = 0;
+    for(i = 0; i < n; i++){
+      if(a[i] == 0 || a[i]/BPB + 1 != g)
+        continue;
+      bi = a[i] % BPB;
+      m = 1 << (bi % 8);
+      if((bp->data[bi/8] & m) == 0)
+        panic("freeing free block");
+      bp->data[bi/8] &= ~m;
+      if(bi/8 < lo)
+        lo = bi/8;
+      if(bi/8 >= hi)
+        hi = bi/8 + 1;
+      a[i] = 0;
+    }
+    log_writerange(bp, lo, hi - lo);
+    brelse(bp);
+  }
 }
 
 // Inodes.
@@ -159,6 +294,7 @@ bfree(int dev, uint b)
 struct {
   struct spinlock lock;
   struct inode inode[NINODE];
+  int nreclaim;  // inodes handed to the reclaimer and not yet freed
 } icache;
 
 void
@@ -188,7 +324,7 @@ ialloc(uint dev, short type)
     if(dip->type == 0){  // a free inode
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
-      log_write(bp);   // mark it allocated on the disk
+      log_writerange(bp, (uchar*)dip - bp->data, sizeof(*dip));   // mark it allocated on the disk
       brelse(bp);
       return iget(dev, inum);
     }
@@ -197,9 +333,9 @@ ialloc(uint dev, short type)
   panic("ialloc: no inodes");
 }
 
-// Copy a modified in-memory inode to disk.
-void
-iupdate(struct inode *ip)
+// Copy an in-memory inode to its block, already in the log.
+static void
+iwrite(struct inode *ip)
 {
   struct buf *bp;
   struct dinode *dip;
@@ -212,10 +348,57 @@ iupdate(struct inode *ip)
   dip->nlink = ip->nlink;
   dip->size = ip->size;
   memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
-  log_write(bp);
   brelse(bp);
 }
 
+// Copy a modified in-memory inode to disk.
+// Must be called inside a transaction with ip locked.
+// The copy is deferred: the first call in a transaction adds
+// the inode's slot of its block to the log and marks it
+// I_DIRTY, and iflush() copies it when the transaction
+// commits, so that an inode changed many times in one
+// transaction is copied once.  iput() copies it early when it
+// drops the last reference, before the slot can be reused.
+void
+iupdate(struct inode *ip)
+{
+  struct buf *bp;
+
+  acquire(&icache.lock);
+  if(ip->flags & I_DIRTY){
+    release(&icache.lock);
+    return;
+  }
+  ip->flags |= I_DIRTY;
+  release(&icache.lock);
+
+  bp = bread(ip->dev, IBLOCK(ip->inum));
+  log_writerange(bp, (ip->inum%IPB)*sizeof(struct dinode), sizeof(struct dinode));
+  brelse(bp);
+}
+
+// Copy every I_DIRTY inode to its block.  Called by commit(),
+// when no operation is running, so that no inode is changing
+// and none can lose its last reference.
+void
+iflush(void)
+{
+  struct inode *ip;
+  int dirty;
+
+  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
+    acquire(&icache.lock);
+    dirty = ip->flags & I_DIRTY;
+    release(&icache.lock);
+    if(!dirty)
+      continue;
+    iwrite(ip);
+    acquire(&icache.lock);
+    ip->flags &= ~I_DIRTY;
+    release(&icache.lock);
+  }
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
@@ -313,27 +496,53 @@ iunlock(struct inode *ip)
 // If that was the last reference, the inode cache entry can
 // be recycled.
 // If that was the last reference and the inode has no links
-// to it, free the inode (and its content) on disk.
+// to it, free the inode (and its content) on disk.  If one
+// itrunc() step cannot free all of its blocks, the reference
+// passes to the reclaimer instead, which frees the inode over
+// as many transactions as it needs.
 // All calls to iput() must be inside a transaction in
 // case it has to free the inode.
 void
 iput(struct inode *ip)
 {
+  uint g;
+
   acquire(&icache.lock);
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links and no other references: truncate and free.
     if(ip->flags & I_BUSY)
       panic("iput busy");
+    if(ip->addrs[NDIRECT] || tail(ip->addrs, NDIRECT, &g) > 0){
+      ip->flags |= I_RECLAIM;
+      icache.nreclaim++;
+      wakeup(&icache.nreclaim);
+      release(&icache.lock);
+      return;
+    }
     ip->flags |= I_BUSY;
     release(&icache.lock);
     itrunc(ip);
     ip->type = 0;
     iupdate(ip);
+    iwrite(ip);
     acquire(&icache.lock);
     ip->flags = 0;
     wakeup(ip);
+  } else if(ip->ref == 1 && (ip->flags & I_DIRTY)){
+    // last reference: write the deferred update now.
+    if(ip->flags & I_BUSY)
+      panic("iput busy");
+    ip->flags |= I_BUSY;
+    release(&icache.lock);
+    iwrite(ip);
+    acquire(&icache.lock);
+    ip->flags &= ~(I_BUSY|I_DIRTY);
+    wakeup(ip);
+  }
+  if(--ip->ref == 0 && ip->cpage){
+    kfree((char*)ip->cpage);
+    ip->cpage = 0;
   }
-  ip->ref--;
   release(&icache.lock);
 }
 
@@ -353,71 +562,402 @@ iunlockput(struct inode *ip)
 // are listed in ip->addrs[].  The next NINDIRECT blocks are 
 // listed in block ip->addrs[NDIRECT].
 
-// Return the disk block address of the nth block in inode ip.
-// If there is no such block, bmap allocates one.
+// Set the nth block of inode ip to addr, allocating the
+// indirect block if need be, and return the old address.
+// Since filling a hole need not change the size, this updates
+// the inode itself when it changes ip->addrs[].
 static uint
-bmap(struct inode *ip, uint bn)
+bset(struct inode *ip, uint bn, uint addr)
 {
-  uint addr, *a;
+  uint old, *a;
   struct buf *bp;
 
   if(bn < NDIRECT){
-    if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
-    return addr;
+    old = ip->addrs[bn];
+    ip->addrs[bn] = addr;
+    iupdate(ip);
+    return old;
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  if(bn >= NINDIRECT)
+    panic("bset: out of range");
+  if(ip->addrs[NDIRECT] == 0){
+    if(addr == 0)
+      return 0;
+    ip->addrs[NDIRECT] = balloc(ip->dev);
+    iupdate(ip);
+  }
+  bp = bread(ip->dev, ip->addrs[NDIRECT]);
+  a = (uint*)bp->data;
+  old = a[bn];
+  a[bn] = addr;
+  log_write(bp);
+  brelse(bp);
+  return old;
+}
+
+// Return the disk block address of the nth block in inode ip.
+// If there is no such block, bmap allocates one if alloc is
+// set, for writing, and otherwise returns 0: the block is a
+// hole, which reads as zeros.  Files are sparse: writing past
+// the end allocates only the blocks written.  For writing, a
+// block shared with other files is first copied, so that the
+// write shows in this file alone.
+static uint
+bmap(struct inode *ip, uint bn, int alloc)
+{
+  uint addr, old;
+  struct buf *bp, *nbp;
+
+  if(bn < NDIRECT)
+    addr = ip->addrs[bn];
+  else if(bn - NDIRECT < NINDIRECT){
+    addr = 0;
+    if(ip->addrs[NDIRECT]){
+      bp = bread(ip->dev, ip->addrs[NDIRECT]);
+      addr = ((uint*)bp->data)[bn - NDIRECT];
+      brelse(bp);
+    }
+  } else
+    panic("bmap: out of range");
+
+  if(!alloc)
+    return addr;
+  if(addr == CADDR)
+    panic("bmap: compressed cluster");
+  if(addr == 0){
+    addr = balloc(ip->dev);
+    bset(ip, bn, addr);
+  } else if(brefs(ip->dev, addr) > 0){
+    old = addr;
+    addr = balloc(ip->dev);
+    bp = bread(ip->dev, old);
+    nbp = bread(ip->dev, addr);
+    memmove(nbp->data, bp->data, BSIZE);
+    log_write(nbp);
+    brelse(bp);
+    brelse(nbp);
+    bset(ip, bn, addr);
+    bfree(ip->dev, &old, 1);
+  }
+  return addr;
+}
+
+//PAGEBREAK!
+// Compressed clusters (see fs.h).
+//
+// A compressed cluster is never written in place: readi()
+// decompresses it into the inode's cluster page, where the data
+// stays for later reads until the cluster is replaced, and
+// writei() and copyi() stop short at it, for the caller to
+// expand it with iexpand() in a transaction of its own.
+
+// ip->cpage holds a cluster's data, then its compressed form,
+// then lzcompress()'s hash table.
+#define CDATA(ip)  ((ip)->cpage)
+#define CZIP(ip)   ((ip)->cpage + CLUSTER*BSIZE)
+#define CTAB(ip)   ((ushort*)((ip)->cpage + (2*CLUSTER-1)*BSIZE))
+
+static int
+cpagealloc(struct inode *ip)
+{
+  if(ip->cpage == 0){
+    if((ip->cpage = (uchar*)kalloc()) == 0)
+      return -1;
+    ip->ccluster = -1;
+  }
+  return 0;
+}
+
+// Is the cluster holding block bn of ip compressed?
+static int
+iscompressed(struct inode *ip, uint bn)
+{
+  return bn < MAXFILE && bmap(ip, bn - bn%CLUSTER, 0) == CADDR;
+}
+
+// Return the data of compressed cluster c of ip, decompressed
+// into the cluster page, or 0 if it cannot be read.
+static uchar*
+cread(struct inode *ip, int c)
+{
+  struct buf *bp;
+  uchar *z;
+  uint i, addr;
+  int n;
+
+  if(cpagealloc(ip) < 0)
+    return 0;
+  if(ip->ccluster == c)
+    return CDATA(ip);
+  ip->ccluster = -1;
+  z = CZIP(ip);
+  for(i = 1; i < CLUSTER && (addr = bmap(ip, c*CLUSTER + i, 0)) != 0; i++){
     bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
+    memmove(z + (i-1)*BSIZE, bp->data, BSIZE);
+    brelse(bp);
+  }
+  n = z[0] | z[1]<<8;
+  if(i == 1 || n + 2 > (i-1)*BSIZE)
+    return 0;
+  if((n = lzdecompress(z + 2, n, CDATA(ip), CLUSTER*BSIZE)) < 0)
+    return 0;
+  memset(CDATA(ip) + n, 0, CLUSTER*BSIZE - n);
+  ip->ccluster = c;
+  return CDATA(ip);
+}
+
+// Return a block for new contents of a cluster whose blocks
+// were old[0..CLUSTER): one the file owns alone, taken out of
+// old[], so that rewriting a cluster needs no free space, or
+// else a new one.
+static uint
+creuse(struct inode *ip, uint *old)
+{
+  uint b;
+  int i;
+
+  for(i = 0; i < CLUSTER; i++){
+    if(old[i] && old[i] != CADDR && brefs(ip->dev, old[i]) == 0){
+      b = old[i];
+      old[i] = 0;
+      return b;
     }
+  }
+  return balloc(ip->dev);
+}
+
+static void
+cwrite(struct inode *ip, uint b, uchar *data)
+{
+  struct buf *bp;
+
+  bp = bread(ip->dev, b);
+  memmove(bp->data, data, BSIZE);
+  log_write(bp);
+  brelse(bp);
+}
+
+// Compress cluster c of ip, which is inside the file, if that
+// saves a block.  Returns 1 if it did, 0 if not, and -1 if
+// there is no memory to do it in.
+static int
+ccompress(struct inode *ip, int c)
+{
+  uint bn, old[CLUSTER], new[CLUSTER-1], end;
+  int i, k, n, nb;
+  struct buf *bp;
+
+  bn = c*CLUSTER;
+  if(bmap(ip, bn, 0) == CADDR)
+    return 0;
+  if(cpagealloc(ip) < 0)
+    return -1;
+  ip->ccluster = -1;
+  k = 0;
+  for(i = 0; i < CLUSTER; i++){
+    if((old[i] = bmap(ip, bn + i, 0)) == 0){
+      memset(CDATA(ip) + i*BSIZE, 0, BSIZE);
+      continue;
+    }
+    k++;
+    bp = bread(ip->dev, old[i]);
+    memmove(CDATA(ip) + i*BSIZE, bp->data, BSIZE);
     brelse(bp);
-    return addr;
   }
+  end = min(ip->size - bn*BSIZE, CLUSTER*BSIZE);
+  memset(CDATA(ip) + end, 0, CLUSTER*BSIZE - end);
+  if(k < 2 || (n = lzcompress(CDATA(ip), end, CZIP(ip) + 2, (k-1)*BSIZE - 2, CTAB(ip))) < 0)
+    return 0;
+  CZIP(ip)[0] = n;
+  CZIP(ip)[1] = n >> 8;
+  nb = (n + 2 + BSIZE-1) / BSIZE;
+  for(i = 0; i < nb; i++){
+    new[i] = creuse(ip, old);
+    cwrite(ip, new[i], CZIP(ip) + i*BSIZE);
+  }
+  bset(ip, bn, CADDR);
+  for(i = 1; i < CLUSTER; i++)
+    bset(ip, bn + i, i <= nb ? new[i-1] : 0);
+  bfree(ip->dev, old, CLUSTER);
+  ip->ccluster = c;
+  return 1;
+}
+
+// Store compressed cluster c of ip as ordinary blocks again,
+// leaving blocks of zeros as holes.  Returns -1 if it cannot be
+// read.
+static int
+cexpand(struct inode *ip, int c)
+{
+  uint bn, old[CLUSTER], new[CLUSTER];
+  uchar *data;
+  int i, j;
 
-  panic("bmap: out of range");
+  bn = c*CLUSTER;
+  if((data = cread(ip, c)) == 0)
+    return -1;
+  for(i = 0; i < CLUSTER; i++)
+    old[i] = bmap(ip, bn + i, 0);
+  for(i = 0; i < CLUSTER; i++){
+    for(j = 0; j < BSIZE && data[i*BSIZE + j] == 0; j++)
+      ;
+    new[i] = 0;
+    if(j < BSIZE){
+      new[i] = creuse(ip, old);
+      cwrite(ip, new[i], data + i*BSIZE);
+    }
+  }
+  for(i = 0; i < CLUSTER; i++)
+    bset(ip, bn + i, new[i]);
+  bfree(ip->dev, old, CLUSTER);
+  ip->ccluster = -1;
+  return 0;
 }
 
-// Truncate inode (discard contents).
+// Return i such that the blocks in a[i..n) all have their
+// counts in the same reference count block as the last one,
+// whose b/RPB is stored in *g, and so their bits in the same
+// bitmap block; 0 if a[0..n) holds no blocks at all.
+static int
+tail(uint *a, int n, uint *g)
+{
+  int i;
+
+  for(i = n; i > 0 && a[i-1] == 0; i--)
+    ;
+  if(i == 0)
+    return 0;
+  *g = a[i-1]/RPB;
+  while(i > 0 && (a[i-1] == 0 || a[i-1]/RPB == *g))
+    i--;
+  return i;
+}
+
+// Truncate inode (discard contents), a step at a time.
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
 // and has no in-memory reference to it (is
 // not an open file or current directory).
-static void
+// Each step frees the blocks at the end of the file that tail()
+// groups with the last one, working through the indirect block
+// first, so it writes at most TRUNCBLOCKS blocks: the bitmap
+// block, the reference count block, the indirect block and the
+// inode.
+// The inode is valid after every step, so the steps can be
+// separate transactions.  Returns 1 if blocks remain.
+static int
 itrunc(struct inode *ip)
 {
-  int i, j;
+  int i, n;
   struct buf *bp;
-  uint *a;
+  uint *a, g;
 
-  for(i = 0; i < NDIRECT; i++){
-    if(ip->addrs[i]){
-      bfree(ip->dev, ip->addrs[i]);
-      ip->addrs[i] = 0;
-    }
-  }
-  
   if(ip->addrs[NDIRECT]){
     bp = bread(ip->dev, ip->addrs[NDIRECT]);
     a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+    g = ip->addrs[NDIRECT]/RPB;
+    i = tail(a, NINDIRECT, &g);
+    bfree(ip->dev, a + i, NINDIRECT - i);
+    if(i == 0 && ip->addrs[NDIRECT]/RPB == g){
+      brelse(bp);
+      bfree(ip->dev, &ip->addrs[NDIRECT], 1);
+    } else {
+      log_write(bp);
+      brelse(bp);
     }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
+    n = NDIRECT + i;
+  } else {
+    n = tail(ip->addrs, NDIRECT, &g);
+    bfree(ip->dev, ip->addrs + n, NDIRECT - n);
   }
 
-  ip->size = 0;
+  if(ip->size > n*BSIZE)
+    ip->size = n*BSIZE;
   iupdate(ip);
+  for(i = 0; i <= NDIRECT; i++)
+    if(ip->addrs[i])
+      return 1;
+  return 0;
+}
+
+// Free ip, which has no links and whose reference the caller
+// holds, a transaction per itrunc() step.
+static void
+ireap(struct inode *ip)
+{
+  int more;
+
+  do {
+    begin_op(TRUNCBLOCKS);
+    ilock(ip);
+    more = itrunc(ip);
+    iunlock(ip);
+    end_op();
+  } while(more);
+  begin_op(IPUTBLOCKS);
+  iput(ip);
+  end_op();
+}
+
+// Free the inodes a crash left allocated with no links: those
+// iput() or the reclaimer had not finished with.  Called once
+// after recovery, before any other process uses the file system.
+void
+ireclaim(uint dev)
+{
+  struct superblock sb;
+  struct buf *bp;
+  struct dinode *dip;
+  uint inum;
+  int orphan;
+
+  readsb(dev, &sb);
+  for(inum = 1; inum < sb.ninodes; inum++){
+    bp = bread(dev, IBLOCK(inum));
+    dip = (struct dinode*)bp->data + inum%IPB;
+    orphan = dip->type != 0 && dip->nlink == 0;
+    brelse(bp);
+    if(orphan)
+      ireap(iget(dev, inum));
+  }
+}
+
+// The reclaimer, run as a kernel process: frees the inodes
+// iput() hands it, so that unlinking a large file does not
+// wait for its blocks to be freed.
+void
+reclaimer(void)
+{
+  struct inode *ip;
+
+  acquire(&icache.lock);
+  for(;;){
+    for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++)
+      if(ip->flags & I_RECLAIM)
+        break;
+    if(ip == &icache.inode[NINODE]){
+      sleep(&icache.nreclaim, &icache.lock);
+      continue;
+    }
+    ip->flags &= ~I_RECLAIM;
+    release(&icache.lock);
+    ireap(ip);
+    acquire(&icache.lock);
+    icache.nreclaim--;
+    wakeup(&icache.nreclaim);
+  }
+}
+
+// Wait until the reclaimer has freed every inode handed to it.
+void
+reclaimwait(void)
+{
+  acquire(&icache.lock);
+  while(icache.nreclaim > 0)
+    sleep(&icache.nreclaim, &icache.lock);
+  release(&icache.lock);
 }
 
 // Copy stat information from inode.
@@ -433,26 +973,47 @@ stati(struct inode *ip, struct stat *st)
 
 //PAGEBREAK!
 // Read data from inode.
+// Reading at or past the end returns 0.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
+  uchar *data;
+  int c;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
       return -1;
-    return devsw[ip->major].read(ip, dst, n);
+    return devsw[ip->major].read(ip, dst, n, 0);
   }
 
-  if(off > ip->size || off + n < off)
+  if(off + n < off)
     return -1;
+  if(off >= ip->size)
+    return 0;
   if(off + n > ip->size)
     n = ip->size - off;
 
+  c = -1;
+  data = 0;
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
+    if(off/BSIZE/CLUSTER != c){
+      c = off/BSIZE/CLUSTER;
+      data = 0;
+      if(iscompressed(ip, off/BSIZE) && (data = cread(ip, c)) == 0)
+        return -1;
+    }
+    if(data){
+      memmove(dst, data + off%(CLUSTER*BSIZE), m);
+      continue;
+    }
+    if((addr = bmap(ip, off/BSIZE, 0)) == 0){
+      memset(dst, 0, m);
+      continue;
+    }
+    bp = bread(ip->dev, addr);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
@@ -461,6 +1022,9 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 
 // PAGEBREAK!
 // Write data to inode.
+// Writing past the end leaves a hole between.  Returns the
+// number of bytes written, fewer if it comes to a compressed
+// cluster.
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
@@ -473,24 +1037,266 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return devsw[ip->major].write(ip, src, n);
   }
 
-  if(off > ip->size || off + n < off)
+  if(off + n < off)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    if((tot == 0 || off%(CLUSTER*BSIZE) == 0) && iscompressed(ip, off/BSIZE))
+      break;
+    bp = bread(ip->dev, bmap(ip, off/BSIZE, 1));
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(bp->data + off%BSIZE, src, m);
     log_write(bp);
     brelse(bp);
   }
 
-  if(n > 0 && off > ip->size){
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  return tot;
+}
+
+// Copy n bytes of file src from soff to file dst at doff; both
+// are locked.  Whole blocks at block-aligned offsets are shared
+// rather than copied, holes included, so that cloning a file
+// writes only block pointers and reference counts; blocks of
+// compressed clusters are copied.  Returns the number of bytes
+// copied, fewer at the end of src or at a compressed cluster of
+// dst.
+int
+copyi(struct inode *dst, uint doff, struct inode *src, uint soff, uint n)
+{
+  uint tot, m, s, d;
+  struct buf *sbp, *dbp;
+  uchar *sdata;
+
+  if(src->type != T_FILE || dst->type != T_FILE)
+    return -1;
+  if(soff + n < soff || doff + n < doff)
+    return -1;
+  if(soff >= src->size)
+    return 0;
+  if(soff + n > src->size)
+    n = src->size - soff;
+  if(doff + n > MAXFILE*BSIZE)
+    return -1;
+  if(src == dst && soff < doff + n && doff < soff + n)
+    return -1;
+
+  sdata = 0;
+  for(tot=0; tot<n; tot+=m, soff+=m, doff+=m){
+    if((tot == 0 || doff%(CLUSTER*BSIZE) == 0) && iscompressed(dst, doff/BSIZE))
+      break;
+    if(tot == 0 || soff%(CLUSTER*BSIZE) == 0){
+      sdata = 0;
+      if(iscompressed(src, soff/BSIZE) &&
+         (sdata = cread(src, soff/BSIZE/CLUSTER)) == 0){
+        if(tot == 0)
+          return -1;
+        break;
+      }
+    }
+    m = min(n - tot, BSIZE - soff%BSIZE);
+    m = min(m, BSIZE - doff%BSIZE);
+    if(m == BSIZE && sdata == 0){
+      s = bmap(src, soff/BSIZE, 0);
+      if(s == bmap(dst, doff/BSIZE, 0))
+        continue;
+      if(s == 0 || bshare(dst->dev, s) == 0){
+        d = bset(dst, doff/BSIZE, s);
+        bfree(dst->dev, &d, 1);
+        continue;
+      }
+    }
+    // Copy: d is dst's own block, so s == d only within one file.
+    d = bmap(dst, doff/BSIZE, 1);
+    s = sdata ? 0 : bmap(src, soff/BSIZE, 0);
+    dbp = bread(dst->dev, d);
+    if(sdata)
+      memmove(dbp->data + doff%BSIZE, sdata + soff%(CLUSTER*BSIZE), m);
+    else if(s == 0)
+      memset(dbp->data + doff%BSIZE, 0, m);
+    else if(s == d)
+      memmove(dbp->data + doff%BSIZE, dbp->data + soff%BSIZE, m);
+    else {
+      sbp = bread(src->dev, s);
+      memmove(dbp->data + doff%BSIZE, sbp->data + soff%BSIZE, m);
+      brelse(sbp);
+    }
+    log_write(dbp);
+    brelse(dbp);
+  }
+
+  if(tot > 0 && doff > dst->size){
+    dst->size = doff;
+    iupdate(dst);
+  }
+  return tot;
+}
+
+// Count block addr, which follows *prev in file order, into e.
+static void
+extent(struct inode *ip, struct extents *e, uint *prev, uint addr)
+{
+  if(addr == 0 || addr == CADDR)
+    return;
+  e->nblocks++;
+  if(addr != *prev + 1)
+    e->nextents++;
+  if(brefs(ip->dev, addr) > 0)
+    e->nshared++;
+  *prev = addr;
+}
+
+// Fill in *e with the layout of ip, which is locked.
+void
+iextents(struct inode *ip, struct extents *e)
+{
+  struct buf *bp;
+  uint i, prev, *a;
+
+  memset(e, 0, sizeof(*e));
+  prev = 0;
+  for(i = 0; i < NDIRECT; i++)
+    extent(ip, e, &prev, ip->addrs[i]);
+  if(ip->addrs[NDIRECT]){
+    extent(ip, e, &prev, ip->addrs[NDIRECT]);
+    bp = bread(ip->dev, ip->addrs[NDIRECT]);
+    a = (uint*)bp->data;
+    for(i = 0; i < NINDIRECT; i++)
+      extent(ip, e, &prev, a[i]);
+    brelse(bp);
+  }
+}
+
+// Move block bn of ip, or its indirect block if ind is set, to
+// free block to: copy it, point ip at the copy and free the
+// original.  Returns 1 if it moved, 0 if there is nothing to
+// move (a hole, or a shared block, which would need the other
+// files changed too), or -1 if to has been taken.
+static int
+bmove(struct inode *ip, uint bn, int ind, uint to)
+{
+  uint from;
+  struct buf *bp, *nbp;
+
+  from = ind ? ip->addrs[NDIRECT] : bmap(ip, bn, 0);
+  if(from == 0 || from == CADDR || (!ind && brefs(ip->dev, from) > 0))
+    return 0;
+  if(bclaim(ip->dev, to) < 0)
+    return -1;
+  bp = bread(ip->dev, from);
+  nbp = bread(ip->dev, to);
+  memmove(nbp->data, bp->data, BSIZE);
+  log_write(nbp);
+  brelse(bp);
+  brelse(nbp);
+  if(ind){
+    ip->addrs[NDIRECT] = to;
+    iupdate(ip);
+  } else
+    bset(ip, bn, to);
+  bfree(ip->dev, &from, 1);
+  return 1;
+}
+
+// Move ip's blocks into a run of consecutive free blocks, in
+// file order, a few per transaction.  Each block moves within
+// one transaction, so a crash leaves it in one place or the
+// other, and the file is whole between transactions.  Returns
+// the number of blocks moved, or -1 if there is no free run
+// long enough or part of it was taken meanwhile.
+int
+idefrag(struct inode *ip)
+{
+  struct extents e;
+  uint pos, to;
+  int k, r, moved;
+
+  ilock(ip);
+  if(ip->type != T_FILE){
+    iunlock(ip);
+    return -1;
+  }
+  iextents(ip, &e);
+  iunlock(ip);
+  if(e.nextents <= 1 || e.nblocks == e.nshared)
+    return 0;
+  if((to = bfindrun(ip->dev, e.nblocks - e.nshared)) == 0)
+    return -1;
+
+  // pos runs over the direct blocks, the indirect block, and the
+  // blocks it lists.
+  moved = r = 0;
+  for(pos = 0; pos <= MAXFILE && r >= 0; ){
+    begin_op(WRITEBLOCKS(WRITEMAX));
+    ilock(ip);
+    for(k = 0; k < WRITEMAX/BSIZE && pos <= MAXFILE; pos++){
+      if(pos == NDIRECT)
+        r = bmove(ip, 0, 1, to);
+      else
+        r = bmove(ip, pos < NDIRECT ? pos : pos-1, 0, to);
+      if(r < 0)
+        break;
+      to += r;
+      k += r;
+      moved += r;
+    }
+    iunlock(ip);
+    end_op();
+  }
+  return r < 0 ? -1 : moved;
+}
+
+// Compress ip's clusters, a transaction each.  Returns the
+// number compressed, or -1 if ip is not a file or there is no
+// memory to do it in.
+int
+icompress(struct inode *ip)
+{
+  int c, r, n, done;
+
+  ilock(ip);
+  r = ip->type == T_FILE ? 0 : -1;
+  iunlock(ip);
+  n = 0;
+  for(c = 0; r >= 0; c++){
+    begin_op(WRITEBLOCKS(CLUSTER*BSIZE));
+    ilock(ip);
+    done = c*CLUSTER*BSIZE >= ip->size;
+    if(!done)
+      r = ccompress(ip, c);
+    iunlock(ip);
+    end_op();
+    if(done)
+      return n;
+    n += r;
+  }
+  return -1;
+}
+
+// Make the cluster holding byte off of ip ordinary blocks again,
+// for writei() or copyi() to go on, in a transaction of its own.
+// Returns 1 if it was compressed, 0 if not, and -1 if it cannot
+// be read.
+int
+iexpand(struct inode *ip, uint off)
+{
+  int r;
+
+  if(off >= MAXFILE*BSIZE)
+    return 0;
+  begin_op(WRITEBLOCKS(CLUSTER*BSIZE));
+  ilock(ip);
+  r = 0;
+  if(ip->type == T_FILE && iscompressed(ip, off/BSIZE))
+    r = cexpand(ip, off/BSIZE/CLUSTER) < 0 ? -1 : 1;
+  iunlock(ip);
+  end_op();
+  return r;
 }
 
 //PAGEBREAK!
@@ -600,19 +1406,20 @@ skipelem(char *path, char *name)
   return path;
 }
 
-// Look up and return the inode for a path name.
+// Look up and return the inode for a path name.  A relative
+// path starts at directory dp.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
 // Must be called inside a transaction since it calls iput().
 static struct inode*
-namex(char *path, int nameiparent, char *name)
+namex(struct inode *dp, char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
-    ip = idup(proc->cwd);
+    ip = idup(dp);
 
   while((path = skipelem(path, name)) != 0){
     ilock(ip);
@@ -643,11 +1450,142 @@ struct inode*
 namei(char *path)
 {
   char name[DIRSIZ];
-  return namex(path, 0, name);
+  return namex(proc->cwd, path, 0, name);
 }
 
 struct inode*
 nameiparent(char *path, char *name)
 {
-  return namex(path, 1, name);
+  return namex(proc->cwd, path, 1, name);
+}
+
+// Like namei, but a relative path starts at dp instead of
+// the current directory.
+struct inode*
+nameiat(struct inode *dp, char *path)
+{
+  char name[DIRSIZ];
+  return namex(dp, path, 0, name);
+}
+
+struct inode*
+nameiparentat(struct inode *dp, char *path, char *name)
+{
+  return namex(dp, path, 1, name);
+}
+
+//PAGEBREAK!
+// Creating and removing names, for sysfile.c and hostfs.c.
+
+// Create path, relative to directory pdp, in the caller's
+// transaction of CREATEBLOCKS or MKDIRBLOCKS, and return it
+// locked.  An existing file is returned if type is T_FILE.
+struct inode*
+dircreate(struct inode *pdp, char *path, short type, short major, short minor)
+{
+  uint off;
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparentat(pdp, path, name)) == 0)
+    return 0;
+  ilock(dp);
+
+  if((ip = dirlookup(dp, name, &off)) != 0){
+    iunlockput(dp);
+    ilock(ip);
+    if(type == T_FILE && ip->type == T_FILE)
+      return ip;
+    iunlockput(ip);
+    return 0;
+  }
+
+  if((ip = ialloc(dp->dev, type)) == 0)
+    panic("create: ialloc");
+
+  ilock(ip);
+  ip->major = major;
+  ip->minor = minor;
+  ip->nlink = 1;
+  iupdate(ip);
+
+  if(type == T_DIR){  // Create . and .. entries.
+    dp->nlink++;  // for ".."
+    iupdate(dp);
+    // No ip->nlink++ for ".": avoid cyclic ref count.
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+      panic("create dots");
+  }
+
+  if(dirlink(dp, name, ip->inum) < 0)
+    panic("create: dirlink");
+
+  iunlockput(dp);
+
+  return ip;
+}
+
+// Is the directory dp empty except for "." and ".." ?
+static int
+isdirempty(struct inode *dp)
+{
+  int off;
+  struct dirent de;
+
+  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      panic("isdirempty: readi");
+    if(de.inum != 0)
+      return 0;
+  }
+  return 1;
+}
+
+// Remove path, relative to directory pdp, in the caller's
+// transaction of UNLINKBLOCKS.
+int
+dirunlink(struct inode *pdp, char *path)
+{
+  struct inode *ip, *dp;
+  struct dirent de;
+  char name[DIRSIZ];
+  uint off;
+
+  if((dp = nameiparentat(pdp, path, name)) == 0)
+    return -1;
+
+  ilock(dp);
+
+  // Cannot unlink "." or "..".
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+    goto bad;
+
+  if((ip = dirlookup(dp, name, &off)) == 0)
+    goto bad;
+  ilock(ip);
+
+  if(ip->nlink < 1)
+    panic("unlink: nlink < 1");
+  if(ip->type == T_DIR && !isdirempty(ip)){
+    iunlockput(ip);
+    goto bad;
+  }
+
+  memset(&de, 0, sizeof(de));
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+    panic("unlink: writei");
+  if(ip->type == T_DIR){
+    dp->nlink--;
+    iupdate(dp);
+  }
+  iunlockput(dp);
+
+  ip->nlink--;
+  iupdate(ip);
+  iunlockput(ip);
+  return 0;
+
+bad:
+  iunlockput(dp);
+  return -1;
 }
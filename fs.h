@@ -5,8 +5,10 @@
 // Block 1 is super block.
 // Blocks 2 through sb.ninodes/IPB hold inodes.
 // Then free bitmap blocks holding sb.size bits.
+// Then reference count blocks holding sb.size bytes.
 // Then sb.nblocks data blocks.
-// Then sb.nlog log blocks.
+// Then sb.nlog log blocks: LOGHDRBLOCKS of header, then the
+// logged blocks.
 
 #define ROOTINO 1  // root i-number
 #define BSIZE 512  // block size
@@ -19,6 +21,10 @@ struct superblock {
   uint nlog;         // Number of log blocks
 };
 
+// Blocks holding the log header, two counts and LOGSIZE sector
+// numbers (see log.c).
+#define LOGHDRBLOCKS ((4*(2+LOGSIZE) + BSIZE-1) / BSIZE)
+
 #define NDIRECT 12
 #define NINDIRECT (BSIZE / sizeof(uint))
 #define MAXFILE (NDIRECT + NINDIRECT)
@@ -45,6 +51,23 @@ struct dinode {
 // Block containing bit for block b
 #define BBLOCK(b, ninodes) (b/BPB + (ninodes)/IPB + 3)
 
+// Reference counts per block.  A block's count is the number of
+// files sharing it beyond the first, so it is zero for a block
+// owned by one file, the usual case, and for a free block.
+#define RPB           BSIZE
+
+// Block containing the count for block b
+#define RBLOCK(b, ninodes, size) (b/RPB + (ninodes)/IPB + 3 + (size)/BPB + 1)
+
+// Compressed clusters.  A file's blocks are grouped in clusters
+// of CLUSTER, aligned in the file.  fsctl(FS_COMPRESS) stores a
+// cluster whose data compresses into fewer blocks that way: its
+// first block address becomes CADDR, the next ones hold a 2-byte
+// length and then the compressed data (see lz.c), and the rest
+// are 0.
+#define CLUSTER 4
+#define CADDR 0xffffffff
+
 // Directory is a file containing a sequence of dirent structures.
 #define DIRSIZ 14
 
@@ -0,0 +1,175 @@
+// Drive the host build of the file system (hostfs.c) with a
+// randomized workload and time it.
+//   fsbench [-t threads] [-n ops] [-s seed] fs.img
+// Each thread works in its own directory, creating, rewriting,
+// reading and unlinking up to NFILE small files.  The image is
+// read into memory first and never written back.  Results are
+// printed as
+//   fsbench <op> <count> <ns-per-op>
+// plus the sectors read and written through iderw().
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "hostfs.h"
+
+#define NFILE   8           // files per thread
+#define MAXSIZE (8*512)     // largest file written
+
+enum { CREATE, WRITE, READ, UNLINK, NOP };
+char *opname[NOP] = { "create", "write", "read", "unlink" };
+
+struct worker {
+  pthread_t tid;
+  int id;
+  unsigned int seed;
+  long count[NOP];
+  long ns[NOP];
+};
+
+int nops = 2000;
+
+long
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+void*
+work(void *arg)
+{
+  struct worker *w = arg;
+  struct inode *ip;
+  char path[32], buf[MAXSIZE];
+  int exists[NFILE], i, f, op, n;
+  long t;
+
+  hostthread();
+  memset(exists, 0, sizeof(exists));
+  memset(buf, 'a' + w->id, sizeof(buf));
+  snprintf(path, sizeof(path), "/t%d", w->id);
+  if((ip = hcreate(path, 1)) == 0){
+    fprintf(stderr, "fsbench: mkdir %s failed\n", path);
+    exit(1);
+  }
+  hclose(ip);
+
+  for(i = 0; i < nops; i++){
+    f = rand_r(&w->seed) % NFILE;
+    snprintf(path, sizeof(path), "/t%d/f%d", w->id, f);
+    op = exists[f] ? 1 + rand_r(&w->seed) % 3 : CREATE;
+    n = 1 + rand_r(&w->seed) % MAXSIZE;
+    t = now();
+    switch(op){
+    case CREATE:
+      if((ip = hcreate(path, 0)) == 0 || hwrite(ip, buf, 0, n) != n){
+        fprintf(stderr, "fsbench: create %s failed\n", path);
+        exit(1);
+      }
+      hclose(ip);
+      exists[f] = 1;
+      break;
+    case WRITE:
+      if((ip = hopen(path)) == 0 || hwrite(ip, buf, 0, n) != n){
+        fprintf(stderr, "fsbench: write %s failed\n", path);
+        exit(1);
+      }
+      hclose(ip);
+      break;
+    case READ:
+      if((ip = hopen(path)) == 0 || hread(ip, buf, 0, MAXSIZE) < 0){
+        fprintf(stderr, "fsbench: read %s failed\n", path);
+        exit(1);
+      }
+      hclose(ip);
+      break;
+    case UNLINK:
+      if(hunlink(path) < 0){
+        fprintf(stderr, "fsbench: unlink %s failed\n", path);
+        exit(1);
+      }
+      exists[f] = 0;
+      break;
+    }
+    w->ns[op] += now() - t;
+    w->count[op]++;
+  }
+  return 0;
+}
+
+void
+usage(void)
+{
+  fprintf(stderr, "usage: fsbench [-t threads] [-n ops] [-s seed] fs.img\n");
+  exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct worker *w;
+  struct stat st;
+  FILE *f;
+  int c, i, op, nthread;
+  unsigned int seed;
+  long count, ns, t;
+
+  nthread = 1;
+  seed = 1;
+  while((c = getopt(argc, argv, "t:n:s:")) != -1){
+    switch(c){
+    case 't': nthread = atoi(optarg); break;
+    case 'n': nops = atoi(optarg); break;
+    case 's': seed = atoi(optarg); break;
+    default: usage();
+    }
+  }
+  if(optind != argc-1 || nthread < 1 || nthread > 32)
+    usage();
+
+  if((f = fopen(argv[optind], "r")) == 0 || fstat(fileno(f), &st) < 0){
+    perror(argv[optind]);
+    exit(1);
+  }
+  hostnsector = st.st_size / 512;
+  hostdisk = malloc(st.st_size);
+  if(fread(hostdisk, 512, hostnsector, f) != hostnsector){
+    fprintf(stderr, "fsbench: short read of %s\n", argv[optind]);
+    exit(1);
+  }
+  fclose(f);
+  hostinit();
+
+  w = calloc(nthread, sizeof(*w));
+  t = now();
+  for(i = 0; i < nthread; i++){
+    w[i].id = i;
+    w[i].seed = seed + i;
+    pthread_create(&w[i].tid, 0, work, &w[i]);
+  }
+  for(i = 0; i < nthread; i++)
+    pthread_join(w[i].tid, 0);
+  hostidle();
+  t = now() - t;
+
+  for(op = 0; op < NOP; op++){
+    count = ns = 0;
+    for(i = 0; i < nthread; i++){
+      count += w[i].count[op];
+      ns += w[i].ns[op];
+    }
+    printf("fsbench %s %ld %ld\n", opname[op], count, count ? ns/count : 0);
+  }
+  printf("fsbench total %ld %ld\n", (long)nthread*nops, t/((long)nthread*nops));
+  printf("fsbench sectors-read %lu\n", hostreads);
+  printf("fsbench sectors-written %lu\n", hostwrites);
+  return 0;
+}
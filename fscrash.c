@@ -0,0 +1,407 @@
+// Crash-test the log with the host build of the file system.
+//   fscrash [-n ops] [-s seed] [-e every] fs.img
+// Runs a workload on the image (in a child process, so that this
+// process never has file system state of its own), recording
+// every sector written through iderw().  Then, for each prefix
+// of those writes (or every -e'th), it forks a child holding the
+// image as it would be had the machine crashed at that point,
+// runs recovery, and checks that
+//   - outside the log, the disk matches the state after the last
+//     transaction that had committed: all of it or none of it;
+//   - once orphaned inodes are freed, the file system is
+//     consistent: every block in use is marked in the bitmap and
+//     used as many times as its reference count says, no marked
+//     block is unused, link counts match the directory tree, and
+//     no inode is left with no links.
+// It reports failures and the recovery time by the number of
+// blocks the log held at the crash.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/wait.h>
+
+#include "types.h"
+#include "fs.h"
+#include "hostfs.h"
+
+#define T_DIR  1  // stat.h
+
+struct rec {
+  uint sector;
+  uchar data[BSIZE];
+};
+
+struct result {
+  int logn;   // blocks in the log at the crash
+  long ns;    // time taken by recovery
+};
+
+struct superblock sb;
+uint logstart;   // header sector
+uint datastart;  // first data block
+FILE *recf;
+uint seed = 1;
+
+long
+now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+// FNV-1a over everything but the log.
+unsigned long
+hashdisk(void)
+{
+  unsigned long h;
+  uchar *p, *e;
+
+  h = 14695981039346656037UL;
+  e = hostdisk + logstart*BSIZE;
+  for(p = hostdisk; p < e; p++)
+    h = (h ^ *p) * 1099511628211UL;
+  return h;
+}
+
+void
+record(uint sector, uchar *data)
+{
+  fwrite(&sector, sizeof(sector), 1, recf);
+  fwrite(data, BSIZE, 1, recf);
+}
+
+int
+rnd(int n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+// Creates, rewrites, extends (into the indirect block, and
+// sometimes past a hole), clones (sharing blocks, or copying at
+// unaligned offsets), defragments, compresses and unlinks files
+// in a few directories.
+void
+workload(int nops)
+{
+  static char buf[20*BSIZE];
+  char path[32], from[32];
+  struct inode *ip, *src;
+  int i, n, off;
+
+  for(i = 0; i < 3; i++){
+    snprintf(path, sizeof(path), "/d%d", i);
+    if((ip = hcreate(path, 1)) == 0){
+      fprintf(stderr, "fscrash: mkdir %s failed\n", path);
+      exit(1);
+    }
+    hclose(ip);
+  }
+  for(i = 0; i < nops; i++){
+    snprintf(path, sizeof(path), "/d%d/f%d", rnd(3), rnd(6));
+    memset(buf, 'a' + i%26, sizeof(buf));
+    if(rnd(4) == 0){
+      hunlink(path);
+      continue;
+    }
+    if(rnd(4) == 0){
+      if((ip = hopen(path)) != 0){
+        if(rnd(2))
+          hdefrag(ip);
+        else if(hcompress(ip) < 0){
+          fprintf(stderr, "fscrash: compress %s failed\n", path);
+          exit(1);
+        }
+        hclose(ip);
+      }
+      continue;
+    }
+    snprintf(from, sizeof(from), "/d%d/f%d", rnd(3), rnd(6));
+    if(rnd(4) == 0 && strcmp(from, path) != 0 && (src = hopen(from)) != 0){
+      n = hsize(src);
+      off = rnd(4)*BSIZE + (rnd(4) == 0 ? 7 : 0);
+      if(n <= 32*BSIZE){
+        if((ip = hcreate(path, 0)) == 0 || hcopy(ip, off, src, 0, n) != n){
+          fprintf(stderr, "fscrash: copy %s to %s failed\n", from, path);
+          exit(1);
+        }
+        hclose(ip);
+      }
+      hclose(src);
+      continue;
+    }
+    n = 1 + rnd(sizeof(buf));
+    off = 0;
+    if((ip = hcreate(path, 0)) != 0 && rnd(4) == 0 && hsize(ip) < 32*BSIZE)
+      off = hsize(ip) + rnd(8*BSIZE);
+    if(ip == 0 || hwrite(ip, buf, off, n) != n){
+      fprintf(stderr, "fscrash: write %s failed\n", path);
+      exit(1);
+    }
+    hclose(ip);
+  }
+}
+
+struct dinode*
+dinode(uint inum)
+{
+  return (struct dinode*)(hostdisk + IBLOCK(inum)*BSIZE) + inum%IPB;
+}
+
+int
+bitset(uint b)
+{
+  uchar *bp;
+
+  bp = hostdisk + BBLOCK(b, sb.ninodes)*BSIZE;
+  return bp[(b%BPB)/8] & (1 << (b%8));
+}
+
+char *fsckerr;
+
+int
+refcount(uint b)
+{
+  return hostdisk[RBLOCK(b, sb.ninodes, sb.size)*BSIZE + b%RPB];
+}
+
+// Count a use of block b by an inode.
+void
+useblock(short *used, uint b)
+{
+  if(b < datastart || b >= logstart)
+    fsckerr = "block address out of range";
+  else if(!bitset(b))
+    fsckerr = "block in use but free in bitmap";
+  else
+    used[b]++;
+}
+
+void
+fsck(void)
+{
+  static short used[65536];
+  static short links[65536];
+  struct dinode *dip;
+  struct dirent *de;
+  uint inum, b, i, *ind, off;
+
+  memset(used, 0, sizeof(used));
+  memset(links, 0, sizeof(links));
+  for(inum = 1; inum < sb.ninodes; inum++){
+    dip = dinode(inum);
+    if(dip->type == 0)
+      continue;
+    for(i = 0; i < NDIRECT; i++)
+      if(dip->addrs[i] && dip->addrs[i] != CADDR)
+        useblock(used, dip->addrs[i]);
+    if(dip->addrs[NDIRECT]){
+      useblock(used, dip->addrs[NDIRECT]);
+      ind = (uint*)(hostdisk + dip->addrs[NDIRECT]*BSIZE);
+      for(i = 0; i < NINDIRECT; i++)
+        if(ind[i] && ind[i] != CADDR)
+          useblock(used, ind[i]);
+    }
+    if(dip->type != T_DIR)
+      continue;
+    // Count references, except a directory's own ".".
+    for(off = 0; off < dip->size; off += sizeof(*de)){
+      b = off / BSIZE;
+      b = b < NDIRECT ? dip->addrs[b] :
+        ((uint*)(hostdisk + dip->addrs[NDIRECT]*BSIZE))[b - NDIRECT];
+      de = (struct dirent*)(hostdisk + b*BSIZE + off%BSIZE);
+      if(de->inum == 0 || strncmp(de->name, ".", DIRSIZ) == 0)
+        continue;
+      if(de->inum >= sb.ninodes || dinode(de->inum)->type == 0)
+        fsckerr = "directory entry for free inode";
+      else
+        links[de->inum]++;
+    }
+  }
+  for(b = datastart; b < logstart; b++){
+    if(bitset(b) && !used[b])
+      fsckerr = "block marked in bitmap but unused";
+    else if(bitset(b) && used[b] != refcount(b) + 1)
+      fsckerr = "reference count wrong";
+    else if(!bitset(b) && refcount(b) != 0)
+      fsckerr = "free block has a reference count";
+  }
+  for(inum = 1; inum < sb.ninodes; inum++){
+    dip = dinode(inum);
+    if(dip->type != 0 && dip->nlink != links[inum])
+      fsckerr = "link count wrong";
+    if(dip->type != 0 && dip->nlink == 0)
+      fsckerr = "unlinked inode not freed";
+  }
+}
+
+// Child: recover the crashed image in hostdisk and check it.
+void
+crash(int fd, unsigned long want)
+{
+  struct result r;
+  long t;
+
+  r.logn = *(int*)(hostdisk + logstart*BSIZE);
+  t = now();
+  hostrecover();
+  r.ns = now() - t;
+  if(hashdisk() != want)
+    fsckerr = "disk is not the last committed state";
+  else {
+    hostreclaim();
+    fsck();
+  }
+  if(fsckerr){
+    printf("%s\n", fsckerr);
+    exit(1);
+  }
+  write(fd, &r, sizeof(r));
+  exit(0);
+}
+
+void
+usage(void)
+{
+  fprintf(stderr, "usage: fscrash [-n ops] [-s seed] [-e every] fs.img\n");
+  exit(1);
+}
+
+int
+main(int argc, char *argv[])
+{
+  FILE *f;
+  struct rec *recs;
+  struct result r;
+  unsigned long *want, h;
+  long size, nrec, k, from, ntest, nfail, *count, *ns;
+  int c, nops, every, status, pfd[2], n;
+  uchar *orig;
+
+  nops = 100;
+  every = 1;
+  while((c = getopt(argc, argv, "n:s:e:")) != -1){
+    switch(c){
+    case 'n': nops = atoi(optarg); break;
+    case 's': seed = atoi(optarg); break;
+    case 'e': every = atoi(optarg); break;
+    default: usage();
+    }
+  }
+  if(optind != argc-1 || every < 1)
+    usage();
+
+  if((f = fopen(argv[optind], "r")) == 0){
+    perror(argv[optind]);
+    exit(1);
+  }
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  rewind(f);
+  hostnsector = size / BSIZE;
+  hostdisk = malloc(size);
+  if(fread(hostdisk, BSIZE, hostnsector, f) != hostnsector){
+    fprintf(stderr, "fscrash: short read of %s\n", argv[optind]);
+    exit(1);
+  }
+  fclose(f);
+  orig = malloc(size);
+  memmove(orig, hostdisk, size);
+  memmove(&sb, hostdisk + BSIZE, sizeof(sb));
+  logstart = sb.size - sb.nlog;
+  datastart = sb.ninodes/IPB + 3 + sb.size/BPB + 1 + sb.size/RPB + 1;
+
+  // Run the workload in a child, recording its writes.
+  recf = tmpfile();
+  if(fork() == 0){
+    hostwritehook = record;
+    hostinit();
+    workload(nops);
+    hostidle();
+    fflush(recf);
+    exit(0);
+  }
+  wait(&status);
+  if(!WIFEXITED(status) || WEXITSTATUS(status) != 0){
+    fprintf(stderr, "fscrash: workload failed\n");
+    exit(1);
+  }
+  fseek(recf, 0, SEEK_END);
+  nrec = ftell(recf) / sizeof(struct rec);
+  recs = malloc(nrec * sizeof(struct rec));
+  rewind(recf);
+  if(fread(recs, sizeof(struct rec), nrec, recf) != nrec){
+    fprintf(stderr, "fscrash: cannot read back the writes\n");
+    exit(1);
+  }
+
+  // want[k] is the state recovery must produce after a crash
+  // following k writes.  Blocks outside the log are written
+  // only while installing a committed transaction, between the
+  // header write that commits it (n > 0) and the one that
+  // clears the log (n == 0); a crash anywhere in between must
+  // recover to the state after the clear.
+  want = malloc((nrec+1) * sizeof(*want));
+  h = hashdisk();
+  from = -1;
+  for(k = 0; k < nrec; k++){
+    want[k] = h;
+    memmove(hostdisk + recs[k].sector*BSIZE, recs[k].data, BSIZE);
+    if(recs[k].sector != logstart)
+      continue;
+    if(*(int*)recs[k].data > 0){
+      from = k+1;
+    } else {
+      h = hashdisk();
+      for(; from >= 0 && from <= k; from++)
+        want[from] = h;
+      from = -1;
+    }
+  }
+  want[nrec] = h;
+
+  // Crash after every'th write, and after the last.
+  memmove(hostdisk, orig, size);
+  count = calloc(sb.nlog+1, sizeof(*count));
+  ns = calloc(sb.nlog+1, sizeof(*ns));
+  ntest = nfail = 0;
+  for(k = 0; k <= nrec; k++){
+    if(k % every == 0 || k == nrec){
+      ntest++;
+      if(pipe(pfd) < 0){
+        perror("pipe");
+        exit(1);
+      }
+      fflush(stdout);
+      if(fork() == 0){
+        close(pfd[0]);
+        crash(pfd[1], want[k]);
+      }
+      close(pfd[1]);
+      n = read(pfd[0], &r, sizeof(r));
+      close(pfd[0]);
+      wait(&status);
+      if(n != sizeof(r) || !WIFEXITED(status) || WEXITSTATUS(status) != 0){
+        printf("fscrash: crash after write %ld (sector %u) failed\n",
+               k, k ? recs[k-1].sector : 0);
+        nfail++;
+      } else if(r.logn >= 0 && r.logn <= sb.nlog){
+        count[r.logn]++;
+        ns[r.logn] += r.ns;
+      }
+    }
+    if(k < nrec)
+      memmove(hostdisk + recs[k].sector*BSIZE, recs[k].data, BSIZE);
+  }
+
+  printf("fscrash %ld writes %ld crashes %ld failed\n", nrec, ntest, nfail);
+  for(n = 0; n <= sb.nlog; n++)
+    if(count[n])
+      printf("fscrash recover %d %ld %ld\n", n, count[n], ns[n]/count[n]);
+  return nfail != 0;
+}
@@ -0,0 +1,17 @@
+// fsctl() commands, for file system support tools.
+// FS_DEFRAG and FS_COMPRESS rewrite the file and need a
+// descriptor open for writing.
+
+#define FS_EXTENTS  1  // fill in a struct extents for the file
+#define FS_DEFRAG   2  // move the file's blocks into one free run
+#define FS_COMPRESS 3  // compress the file's clusters (see fs.h)
+
+// Where a file's blocks lie on disk.  An extent is a run of
+// blocks with consecutive numbers, taken in file order with the
+// indirect block before the blocks it lists; nblocks/nextents
+// is the average extent length.
+struct extents {
+  int nblocks;   // blocks, counting the indirect block
+  int nextents;
+  int nshared;   // blocks shared with other files, which stay put
+};
@@ -0,0 +1,3723 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <flush>:
+int outfd = 1;
+int framed;
+
+void
+flush(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  if(nobuf == 0)
+       6:	a1 40 55 00 00       	mov    0x5540,%eax
+       b:	85 c0                	test   %eax,%eax
+       d:	74 4a                	je     59 <flush+0x59>
+    return;
+  if(framed)
+       f:	a1 44 55 00 00       	mov    0x5544,%eax
+      14:	85 c0                	test   %eax,%eax
+      16:	74 18                	je     30 <flush+0x30>
+    write(outfd, &nobuf, sizeof(nobuf));
+      18:	a1 00 25 00 00       	mov    0x2500,%eax
+      1d:	83 ec 04             	sub    $0x4,%esp
+      20:	6a 04                	push   $0x4
+      22:	68 40 55 00 00       	push   $0x5540
+      27:	50                   	push   %eax
+      28:	e8 56 19 00 00       	call   1983 <write>
+      2d:	83 c4 10             	add    $0x10,%esp
+  write(outfd, obuf, nobuf);
+      30:	8b 15 40 55 00 00    	mov    0x5540,%edx
+      36:	a1 00 25 00 00       	mov    0x2500,%eax
+      3b:	83 ec 04             	sub    $0x4,%esp
+      3e:	52                   	push   %edx
+      3f:	68 40 45 00 00       	push   $0x4540
+      44:	50                   	push   %eax
+      45:	e8 39 19 00 00       	call   1983 <write>
+      4a:	83 c4 10             	add    $0x10,%esp
+  nobuf = 0;
+      4d:	c7 05 40 55 00 00 00 	movl   $0x0,0x5540
+      54:	00 00 00 
+      57:	eb 01                	jmp    5a <flush+0x5a>
+    return;
+      59:	90                   	nop
+}
+      5a:	c9                   	leave
+      5b:	c3                   	ret
+
+0000005c <output>:
+
+void
+output(char *p, int n)
+{
+      5c:	55                   	push   %ebp
+      5d:	89 e5                	mov    %esp,%ebp
+      5f:	83 ec 18             	sub    $0x18,%esp
+  int m;
+
+  while(n > 0){
+      62:	eb 68                	jmp    cc <output+0x70>
+    if(nobuf == sizeof(obuf))
+      64:	a1 40 55 00 00       	mov    0x5540,%eax
+      69:	3d 00 10 00 00       	cmp    $0x1000,%eax
+      6e:	75 05                	jne    75 <output+0x19>
+      flush();
+      70:	e8 8b ff ff ff       	call   0 <flush>
+    m = sizeof(obuf) - nobuf;
+      75:	a1 40 55 00 00       	mov    0x5540,%eax
+      7a:	89 c2                	mov    %eax,%edx
+      7c:	b8 00 10 00 00       	mov    $0x1000,%eax
+      81:	29 d0                	sub    %edx,%eax
+      83:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m > n)
+      86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      89:	3b 45 0c             	cmp    0xc(%ebp),%eax
+      8c:	7e 06                	jle    94 <output+0x38>
+      m = n;
+      8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+      91:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    memmove(obuf+nobuf, p, m);
+      94:	a1 40 55 00 00       	mov    0x5540,%eax
+      99:	05 40 45 00 00       	add    $0x4540,%eax
+      9e:	83 ec 04             	sub    $0x4,%esp
+      a1:	ff 75 f4             	push   -0xc(%ebp)
+      a4:	ff 75 08             	push   0x8(%ebp)
+      a7:	50                   	push   %eax
+      a8:	e8 33 18 00 00       	call   18e0 <memmove>
+      ad:	83 c4 10             	add    $0x10,%esp
+    nobuf += m;
+      b0:	8b 15 40 55 00 00    	mov    0x5540,%edx
+      b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      b9:	01 d0                	add    %edx,%eax
+      bb:	a3 40 55 00 00       	mov    %eax,0x5540
+    p += m;
+      c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      c3:	01 45 08             	add    %eax,0x8(%ebp)
+    n -= m;
+      c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      c9:	29 45 0c             	sub    %eax,0xc(%ebp)
+  while(n > 0){
+      cc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+      d0:	7f 92                	jg     64 <output+0x8>
+  }
+}
+      d2:	90                   	nop
+      d3:	90                   	nop
+      d4:	c9                   	leave
+      d5:	c3                   	ret
+
+000000d6 <outint>:
+
+void
+outint(int x)
+{
+      d6:	55                   	push   %ebp
+      d7:	89 e5                	mov    %esp,%ebp
+      d9:	83 ec 18             	sub    $0x18,%esp
+  char s[12];
+  int i;
+
+  i = sizeof(s);
+      dc:	c7 45 f4 0c 00 00 00 	movl   $0xc,-0xc(%ebp)
+  do {
+    s[--i] = '0' + x % 10;
+      e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      e6:	ba 67 66 66 66       	mov    $0x66666667,%edx
+      eb:	89 c8                	mov    %ecx,%eax
+      ed:	f7 ea                	imul   %edx
+      ef:	c1 fa 02             	sar    $0x2,%edx
+      f2:	89 c8                	mov    %ecx,%eax
+      f4:	c1 f8 1f             	sar    $0x1f,%eax
+      f7:	29 c2                	sub    %eax,%edx
+      f9:	89 d0                	mov    %edx,%eax
+      fb:	c1 e0 02             	shl    $0x2,%eax
+      fe:	01 d0                	add    %edx,%eax
+     100:	01 c0                	add    %eax,%eax
+     102:	29 c1                	sub    %eax,%ecx
+     104:	89 ca                	mov    %ecx,%edx
+     106:	89 d0                	mov    %edx,%eax
+     108:	83 c0 30             	add    $0x30,%eax
+     10b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     10f:	89 c1                	mov    %eax,%ecx
+     111:	8d 55 e8             	lea    -0x18(%ebp),%edx
+     114:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     117:	01 d0                	add    %edx,%eax
+     119:	88 08                	mov    %cl,(%eax)
+    x /= 10;
+     11b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     11e:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     123:	89 c8                	mov    %ecx,%eax
+     125:	f7 ea                	imul   %edx
+     127:	89 d0                	mov    %edx,%eax
+     129:	c1 f8 02             	sar    $0x2,%eax
+     12c:	c1 f9 1f             	sar    $0x1f,%ecx
+     12f:	89 ca                	mov    %ecx,%edx
+     131:	29 d0                	sub    %edx,%eax
+     133:	89 45 08             	mov    %eax,0x8(%ebp)
+  } while(x > 0);
+     136:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     13a:	7f a7                	jg     e3 <outint+0xd>
+  output(s+i, sizeof(s)-i);
+     13c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     13f:	ba 0c 00 00 00       	mov    $0xc,%edx
+     144:	29 c2                	sub    %eax,%edx
+     146:	89 d1                	mov    %edx,%ecx
+     148:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     14b:	8d 55 e8             	lea    -0x18(%ebp),%edx
+     14e:	01 d0                	add    %edx,%eax
+     150:	83 ec 08             	sub    $0x8,%esp
+     153:	51                   	push   %ecx
+     154:	50                   	push   %eax
+     155:	e8 02 ff ff ff       	call   5c <output>
+     15a:	83 c4 10             	add    $0x10,%esp
+}
+     15d:	90                   	nop
+     15e:	c9                   	leave
+     15f:	c3                   	ret
+
+00000160 <grep>:
+
+void
+grep(int fd)
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	83 ec 28             	sub    $0x28,%esp
+  int n, m, count;
+  char *p, *q, *e;
+
+  m = 0;
+     166:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  count = 0;
+     16d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while((n = read(fd, buf+m, sizeof(buf)-m)) > 0){
+     174:	e9 b4 00 00 00       	jmp    22d <grep+0xcd>
+    m += n;
+     179:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     17c:	01 45 f4             	add    %eax,-0xc(%ebp)
+    p = buf;
+     17f:	c7 45 ec 20 25 00 00 	movl   $0x2520,-0x14(%ebp)
+    e = buf + m;
+     186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     189:	05 20 25 00 00       	add    $0x2520,%eax
+     18e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    while((q = scanc(p, e, '\n')) != 0){
+     191:	eb 47                	jmp    1da <grep+0x7a>
+      if(match(p, q - p)){
+     193:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     196:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     199:	83 ec 08             	sub    $0x8,%esp
+     19c:	50                   	push   %eax
+     19d:	ff 75 ec             	push   -0x14(%ebp)
+     1a0:	e8 28 13 00 00       	call   14cd <match>
+     1a5:	83 c4 10             	add    $0x10,%esp
+     1a8:	85 c0                	test   %eax,%eax
+     1aa:	74 25                	je     1d1 <grep+0x71>
+        count++;
+     1ac:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+        if(!cflag)
+     1b0:	a1 20 45 00 00       	mov    0x4520,%eax
+     1b5:	85 c0                	test   %eax,%eax
+     1b7:	75 18                	jne    1d1 <grep+0x71>
+          output(p, q+1 - p);
+     1b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1bc:	83 c0 01             	add    $0x1,%eax
+     1bf:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     1c2:	83 ec 08             	sub    $0x8,%esp
+     1c5:	50                   	push   %eax
+     1c6:	ff 75 ec             	push   -0x14(%ebp)
+     1c9:	e8 8e fe ff ff       	call   5c <output>
+     1ce:	83 c4 10             	add    $0x10,%esp
+      }
+      p = q+1;
+     1d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1d4:	83 c0 01             	add    $0x1,%eax
+     1d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    while((q = scanc(p, e, '\n')) != 0){
+     1da:	83 ec 04             	sub    $0x4,%esp
+     1dd:	6a 0a                	push   $0xa
+     1df:	ff 75 e4             	push   -0x1c(%ebp)
+     1e2:	ff 75 ec             	push   -0x14(%ebp)
+     1e5:	e8 04 06 00 00       	call   7ee <scanc>
+     1ea:	83 c4 10             	add    $0x10,%esp
+     1ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     1f0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     1f4:	75 9d                	jne    193 <grep+0x33>
+    }
+    if(p == buf)
+     1f6:	81 7d ec 20 25 00 00 	cmpl   $0x2520,-0x14(%ebp)
+     1fd:	75 07                	jne    206 <grep+0xa6>
+      m = 0;
+     1ff:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(m > 0){
+     206:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     20a:	7e 21                	jle    22d <grep+0xcd>
+      m -= p - buf;
+     20c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     20f:	2d 20 25 00 00       	sub    $0x2520,%eax
+     214:	29 45 f4             	sub    %eax,-0xc(%ebp)
+      memmove(buf, p, m);
+     217:	83 ec 04             	sub    $0x4,%esp
+     21a:	ff 75 f4             	push   -0xc(%ebp)
+     21d:	ff 75 ec             	push   -0x14(%ebp)
+     220:	68 20 25 00 00       	push   $0x2520
+     225:	e8 b6 16 00 00       	call   18e0 <memmove>
+     22a:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf+m, sizeof(buf)-m)) > 0){
+     22d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     230:	ba 00 20 00 00       	mov    $0x2000,%edx
+     235:	29 c2                	sub    %eax,%edx
+     237:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     23a:	05 20 25 00 00       	add    $0x2520,%eax
+     23f:	83 ec 04             	sub    $0x4,%esp
+     242:	52                   	push   %edx
+     243:	50                   	push   %eax
+     244:	ff 75 08             	push   0x8(%ebp)
+     247:	e8 2f 17 00 00       	call   197b <read>
+     24c:	83 c4 10             	add    $0x10,%esp
+     24f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     252:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     256:	0f 8f 1d ff ff ff    	jg     179 <grep+0x19>
+    }
+  }
+  if(cflag){
+     25c:	a1 20 45 00 00       	mov    0x4520,%eax
+     261:	85 c0                	test   %eax,%eax
+     263:	74 20                	je     285 <grep+0x125>
+    outint(count);
+     265:	83 ec 0c             	sub    $0xc,%esp
+     268:	ff 75 f0             	push   -0x10(%ebp)
+     26b:	e8 66 fe ff ff       	call   d6 <outint>
+     270:	83 c4 10             	add    $0x10,%esp
+    output("\n", 1);
+     273:	83 ec 08             	sub    $0x8,%esp
+     276:	6a 01                	push   $0x1
+     278:	68 18 1f 00 00       	push   $0x1f18
+     27d:	e8 da fd ff ff       	call   5c <output>
+     282:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     285:	90                   	nop
+     286:	c9                   	leave
+     287:	c3                   	ret
+
+00000288 <readn>:
+
+// Read exactly n bytes from a worker's pipe.
+int
+readn(int fd, void *p, int n)
+{
+     288:	55                   	push   %ebp
+     289:	89 e5                	mov    %esp,%ebp
+     28b:	83 ec 18             	sub    $0x18,%esp
+  int m, r;
+
+  for(m = 0; m < n; m += r)
+     28e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     295:	eb 34                	jmp    2cb <readn+0x43>
+    if((r = read(fd, (char*)p + m, n - m)) <= 0)
+     297:	8b 45 10             	mov    0x10(%ebp),%eax
+     29a:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     29d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     2a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2a3:	01 ca                	add    %ecx,%edx
+     2a5:	83 ec 04             	sub    $0x4,%esp
+     2a8:	50                   	push   %eax
+     2a9:	52                   	push   %edx
+     2aa:	ff 75 08             	push   0x8(%ebp)
+     2ad:	e8 c9 16 00 00       	call   197b <read>
+     2b2:	83 c4 10             	add    $0x10,%esp
+     2b5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     2b8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     2bc:	7f 07                	jg     2c5 <readn+0x3d>
+      return -1;
+     2be:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     2c3:	eb 13                	jmp    2d8 <readn+0x50>
+  for(m = 0; m < n; m += r)
+     2c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     2c8:	01 45 f4             	add    %eax,-0xc(%ebp)
+     2cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     2ce:	3b 45 10             	cmp    0x10(%ebp),%eax
+     2d1:	7c c4                	jl     297 <readn+0xf>
+  return 0;
+     2d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2d8:	c9                   	leave
+     2d9:	c3                   	ret
+
+000002da <pargrep>:
+
+// Worker i greps files i, i+nproc, ...; the parent copies their
+// records to standard output one file at a time, in order.
+void
+pargrep(char **files, int nfile, int nproc)
+{
+     2da:	55                   	push   %ebp
+     2db:	89 e5                	mov    %esp,%ebp
+     2dd:	83 ec 68             	sub    $0x68,%esp
+  int i, j, k, n, fd, pfd[NCPU][2];
+
+  if(nproc > NCPU)
+     2e0:	83 7d 10 08          	cmpl   $0x8,0x10(%ebp)
+     2e4:	7e 07                	jle    2ed <pargrep+0x13>
+    nproc = NCPU;
+     2e6:	c7 45 10 08 00 00 00 	movl   $0x8,0x10(%ebp)
+  if(nproc > nfile)
+     2ed:	8b 45 10             	mov    0x10(%ebp),%eax
+     2f0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     2f3:	7e 06                	jle    2fb <pargrep+0x21>
+    nproc = nfile;
+     2f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2f8:	89 45 10             	mov    %eax,0x10(%ebp)
+  for(i = 0; i < nproc; i++){
+     2fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     302:	e9 80 01 00 00       	jmp    487 <pargrep+0x1ad>
+    if(pipe(pfd[i]) < 0){
+     307:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+     30a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     30d:	c1 e2 03             	shl    $0x3,%edx
+     310:	01 d0                	add    %edx,%eax
+     312:	83 ec 0c             	sub    $0xc,%esp
+     315:	50                   	push   %eax
+     316:	e8 58 16 00 00       	call   1973 <pipe>
+     31b:	83 c4 10             	add    $0x10,%esp
+     31e:	85 c0                	test   %eax,%eax
+     320:	79 17                	jns    339 <pargrep+0x5f>
+      printf(2, "grep: pipe failed\n");
+     322:	83 ec 08             	sub    $0x8,%esp
+     325:	68 1a 1f 00 00       	push   $0x1f1a
+     32a:	6a 02                	push   $0x2
+     32c:	e8 2e 18 00 00       	call   1b5f <printf>
+     331:	83 c4 10             	add    $0x10,%esp
+      exit();
+     334:	e8 2a 16 00 00       	call   1963 <exit>
+    }
+    if(fork() == 0){
+     339:	e8 1d 16 00 00       	call   195b <fork>
+     33e:	85 c0                	test   %eax,%eax
+     340:	0f 85 2a 01 00 00    	jne    470 <pargrep+0x196>
+      for(j = 0; j <= i; j++)
+     346:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     34d:	eb 17                	jmp    366 <pargrep+0x8c>
+        close(pfd[j][0]);
+     34f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     352:	8b 44 c5 a4          	mov    -0x5c(%ebp,%eax,8),%eax
+     356:	83 ec 0c             	sub    $0xc,%esp
+     359:	50                   	push   %eax
+     35a:	e8 2c 16 00 00       	call   198b <close>
+     35f:	83 c4 10             	add    $0x10,%esp
+      for(j = 0; j <= i; j++)
+     362:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     366:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     369:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+     36c:	7e e1                	jle    34f <pargrep+0x75>
+      outfd = pfd[i][1];
+     36e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     371:	8b 44 c5 a8          	mov    -0x58(%ebp,%eax,8),%eax
+     375:	a3 00 25 00 00       	mov    %eax,0x2500
+      framed = 1;
+     37a:	c7 05 44 55 00 00 01 	movl   $0x1,0x5544
+     381:	00 00 00 
+      for(k = i; k < nfile; k += nproc){
+     384:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     387:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     38a:	e9 d0 00 00 00       	jmp    45f <pargrep+0x185>
+        if((fd = open(files[k], 0)) < 0){
+     38f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     392:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     399:	8b 45 08             	mov    0x8(%ebp),%eax
+     39c:	01 d0                	add    %edx,%eax
+     39e:	8b 00                	mov    (%eax),%eax
+     3a0:	83 ec 08             	sub    $0x8,%esp
+     3a3:	6a 00                	push   $0x0
+     3a5:	50                   	push   %eax
+     3a6:	e8 f8 15 00 00       	call   19a3 <open>
+     3ab:	83 c4 10             	add    $0x10,%esp
+     3ae:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     3b1:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     3b5:	79 63                	jns    41a <pargrep+0x140>
+          output("grep: cannot open ", 18);
+     3b7:	83 ec 08             	sub    $0x8,%esp
+     3ba:	6a 12                	push   $0x12
+     3bc:	68 2d 1f 00 00       	push   $0x1f2d
+     3c1:	e8 96 fc ff ff       	call   5c <output>
+     3c6:	83 c4 10             	add    $0x10,%esp
+          output(files[k], strlen(files[k]));
+     3c9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     3cc:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     3d6:	01 d0                	add    %edx,%eax
+     3d8:	8b 00                	mov    (%eax),%eax
+     3da:	83 ec 0c             	sub    $0xc,%esp
+     3dd:	50                   	push   %eax
+     3de:	e8 80 13 00 00       	call   1763 <strlen>
+     3e3:	83 c4 10             	add    $0x10,%esp
+     3e6:	89 c1                	mov    %eax,%ecx
+     3e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     3eb:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     3f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     3f5:	01 d0                	add    %edx,%eax
+     3f7:	8b 00                	mov    (%eax),%eax
+     3f9:	83 ec 08             	sub    $0x8,%esp
+     3fc:	51                   	push   %ecx
+     3fd:	50                   	push   %eax
+     3fe:	e8 59 fc ff ff       	call   5c <output>
+     403:	83 c4 10             	add    $0x10,%esp
+          output("\n", 1);
+     406:	83 ec 08             	sub    $0x8,%esp
+     409:	6a 01                	push   $0x1
+     40b:	68 18 1f 00 00       	push   $0x1f18
+     410:	e8 47 fc ff ff       	call   5c <output>
+     415:	83 c4 10             	add    $0x10,%esp
+     418:	eb 1c                	jmp    436 <pargrep+0x15c>
+        } else {
+          grep(fd);
+     41a:	83 ec 0c             	sub    $0xc,%esp
+     41d:	ff 75 e8             	push   -0x18(%ebp)
+     420:	e8 3b fd ff ff       	call   160 <grep>
+     425:	83 c4 10             	add    $0x10,%esp
+          close(fd);
+     428:	83 ec 0c             	sub    $0xc,%esp
+     42b:	ff 75 e8             	push   -0x18(%ebp)
+     42e:	e8 58 15 00 00       	call   198b <close>
+     433:	83 c4 10             	add    $0x10,%esp
+        }
+        flush();
+     436:	e8 c5 fb ff ff       	call   0 <flush>
+        n = 0;
+     43b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+        write(outfd, &n, sizeof(n));
+     442:	a1 00 25 00 00       	mov    0x2500,%eax
+     447:	83 ec 04             	sub    $0x4,%esp
+     44a:	6a 04                	push   $0x4
+     44c:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+     44f:	52                   	push   %edx
+     450:	50                   	push   %eax
+     451:	e8 2d 15 00 00       	call   1983 <write>
+     456:	83 c4 10             	add    $0x10,%esp
+      for(k = i; k < nfile; k += nproc){
+     459:	8b 45 10             	mov    0x10(%ebp),%eax
+     45c:	01 45 ec             	add    %eax,-0x14(%ebp)
+     45f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     462:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     465:	0f 8c 24 ff ff ff    	jl     38f <pargrep+0xb5>
+      }
+      exit();
+     46b:	e8 f3 14 00 00       	call   1963 <exit>
+    }
+    close(pfd[i][1]);
+     470:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     473:	8b 44 c5 a8          	mov    -0x58(%ebp,%eax,8),%eax
+     477:	83 ec 0c             	sub    $0xc,%esp
+     47a:	50                   	push   %eax
+     47b:	e8 0b 15 00 00       	call   198b <close>
+     480:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++){
+     483:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     487:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     48a:	3b 45 10             	cmp    0x10(%ebp),%eax
+     48d:	0f 8c 74 fe ff ff    	jl     307 <pargrep+0x2d>
+  }
+
+  for(k = 0; k < nfile; k++){
+     493:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     49a:	e9 88 00 00 00       	jmp    527 <pargrep+0x24d>
+    fd = pfd[k % nproc][0];
+     49f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     4a2:	99                   	cltd
+     4a3:	f7 7d 10             	idivl  0x10(%ebp)
+     4a6:	89 d0                	mov    %edx,%eax
+     4a8:	8b 44 c5 a4          	mov    -0x5c(%ebp,%eax,8),%eax
+     4ac:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    while(readn(fd, &n, sizeof(n)) == 0 && n > 0){
+     4af:	eb 53                	jmp    504 <pargrep+0x22a>
+      for(; n > 0; n -= j){
+        j = n < sizeof(buf) ? n : sizeof(buf);
+     4b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     4b4:	89 c2                	mov    %eax,%edx
+     4b6:	b8 00 20 00 00       	mov    $0x2000,%eax
+     4bb:	39 c2                	cmp    %eax,%edx
+     4bd:	0f 46 c2             	cmovbe %edx,%eax
+     4c0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        if(readn(fd, buf, j) < 0)
+     4c3:	83 ec 04             	sub    $0x4,%esp
+     4c6:	ff 75 f0             	push   -0x10(%ebp)
+     4c9:	68 20 25 00 00       	push   $0x2520
+     4ce:	ff 75 e8             	push   -0x18(%ebp)
+     4d1:	e8 b2 fd ff ff       	call   288 <readn>
+     4d6:	83 c4 10             	add    $0x10,%esp
+     4d9:	85 c0                	test   %eax,%eax
+     4db:	79 02                	jns    4df <pargrep+0x205>
+          break;
+     4dd:	eb 25                	jmp    504 <pargrep+0x22a>
+        write(1, buf, j);
+     4df:	83 ec 04             	sub    $0x4,%esp
+     4e2:	ff 75 f0             	push   -0x10(%ebp)
+     4e5:	68 20 25 00 00       	push   $0x2520
+     4ea:	6a 01                	push   $0x1
+     4ec:	e8 92 14 00 00       	call   1983 <write>
+     4f1:	83 c4 10             	add    $0x10,%esp
+      for(; n > 0; n -= j){
+     4f4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     4f7:	2b 45 f0             	sub    -0x10(%ebp),%eax
+     4fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     4fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     500:	85 c0                	test   %eax,%eax
+     502:	7f ad                	jg     4b1 <pargrep+0x1d7>
+    while(readn(fd, &n, sizeof(n)) == 0 && n > 0){
+     504:	83 ec 04             	sub    $0x4,%esp
+     507:	6a 04                	push   $0x4
+     509:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     50c:	50                   	push   %eax
+     50d:	ff 75 e8             	push   -0x18(%ebp)
+     510:	e8 73 fd ff ff       	call   288 <readn>
+     515:	83 c4 10             	add    $0x10,%esp
+     518:	85 c0                	test   %eax,%eax
+     51a:	75 07                	jne    523 <pargrep+0x249>
+     51c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     51f:	85 c0                	test   %eax,%eax
+     521:	7f da                	jg     4fd <pargrep+0x223>
+  for(k = 0; k < nfile; k++){
+     523:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     527:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     52a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     52d:	0f 8c 6c ff ff ff    	jl     49f <pargrep+0x1c5>
+      }
+    }
+  }
+  for(i = 0; i < nproc; i++){
+     533:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     53a:	eb 1c                	jmp    558 <pargrep+0x27e>
+    close(pfd[i][0]);
+     53c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     53f:	8b 44 c5 a4          	mov    -0x5c(%ebp,%eax,8),%eax
+     543:	83 ec 0c             	sub    $0xc,%esp
+     546:	50                   	push   %eax
+     547:	e8 3f 14 00 00       	call   198b <close>
+     54c:	83 c4 10             	add    $0x10,%esp
+    wait();
+     54f:	e8 17 14 00 00       	call   196b <wait>
+  for(i = 0; i < nproc; i++){
+     554:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     558:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     55b:	3b 45 10             	cmp    0x10(%ebp),%eax
+     55e:	7c dc                	jl     53c <pargrep+0x262>
+  }
+}
+     560:	90                   	nop
+     561:	90                   	nop
+     562:	c9                   	leave
+     563:	c3                   	ret
+
+00000564 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     564:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     568:	83 e4 f0             	and    $0xfffffff0,%esp
+     56b:	ff 71 fc             	push   -0x4(%ecx)
+     56e:	55                   	push   %ebp
+     56f:	89 e5                	mov    %esp,%ebp
+     571:	53                   	push   %ebx
+     572:	51                   	push   %ecx
+     573:	83 ec 10             	sub    $0x10,%esp
+     576:	89 cb                	mov    %ecx,%ebx
+  int fd, i, r, nproc;
+
+  nproc = 1;
+     578:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+     57f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+     586:	e9 bd 00 00 00       	jmp    648 <main+0xe4>
+    if(strcmp(argv[i], "-c") == 0)
+     58b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     58e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     595:	8b 43 04             	mov    0x4(%ebx),%eax
+     598:	01 d0                	add    %edx,%eax
+     59a:	8b 00                	mov    (%eax),%eax
+     59c:	83 ec 08             	sub    $0x8,%esp
+     59f:	68 40 1f 00 00       	push   $0x1f40
+     5a4:	50                   	push   %eax
+     5a5:	e8 7a 11 00 00       	call   1724 <strcmp>
+     5aa:	83 c4 10             	add    $0x10,%esp
+     5ad:	85 c0                	test   %eax,%eax
+     5af:	75 0f                	jne    5c0 <main+0x5c>
+      cflag = 1;
+     5b1:	c7 05 20 45 00 00 01 	movl   $0x1,0x4520
+     5b8:	00 00 00 
+     5bb:	e9 84 00 00 00       	jmp    644 <main+0xe0>
+    else if(strcmp(argv[i], "-P") == 0)
+     5c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5c3:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     5ca:	8b 43 04             	mov    0x4(%ebx),%eax
+     5cd:	01 d0                	add    %edx,%eax
+     5cf:	8b 00                	mov    (%eax),%eax
+     5d1:	83 ec 08             	sub    $0x8,%esp
+     5d4:	68 43 1f 00 00       	push   $0x1f43
+     5d9:	50                   	push   %eax
+     5da:	e8 45 11 00 00       	call   1724 <strcmp>
+     5df:	83 c4 10             	add    $0x10,%esp
+     5e2:	85 c0                	test   %eax,%eax
+     5e4:	75 0a                	jne    5f0 <main+0x8c>
+      nproc = ncpus();
+     5e6:	e8 32 13 00 00       	call   191d <ncpus>
+     5eb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     5ee:	eb 54                	jmp    644 <main+0xe0>
+    else if(strcmp(argv[i], "-j") == 0 && i+1 < argc)
+     5f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f3:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     5fa:	8b 43 04             	mov    0x4(%ebx),%eax
+     5fd:	01 d0                	add    %edx,%eax
+     5ff:	8b 00                	mov    (%eax),%eax
+     601:	83 ec 08             	sub    $0x8,%esp
+     604:	68 46 1f 00 00       	push   $0x1f46
+     609:	50                   	push   %eax
+     60a:	e8 15 11 00 00       	call   1724 <strcmp>
+     60f:	83 c4 10             	add    $0x10,%esp
+     612:	85 c0                	test   %eax,%eax
+     614:	75 55                	jne    66b <main+0x107>
+     616:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     619:	83 c0 01             	add    $0x1,%eax
+     61c:	39 03                	cmp    %eax,(%ebx)
+     61e:	7e 4b                	jle    66b <main+0x107>
+      nproc = atoi(argv[++i]);
+     620:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     624:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     627:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     62e:	8b 43 04             	mov    0x4(%ebx),%eax
+     631:	01 d0                	add    %edx,%eax
+     633:	8b 00                	mov    (%eax),%eax
+     635:	83 ec 0c             	sub    $0xc,%esp
+     638:	50                   	push   %eax
+     639:	e8 55 12 00 00       	call   1893 <atoi>
+     63e:	83 c4 10             	add    $0x10,%esp
+     641:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+     644:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     648:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     64b:	3b 03                	cmp    (%ebx),%eax
+     64d:	7d 1c                	jge    66b <main+0x107>
+     64f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     652:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     659:	8b 43 04             	mov    0x4(%ebx),%eax
+     65c:	01 d0                	add    %edx,%eax
+     65e:	8b 00                	mov    (%eax),%eax
+     660:	0f b6 00             	movzbl (%eax),%eax
+     663:	3c 2d                	cmp    $0x2d,%al
+     665:	0f 84 20 ff ff ff    	je     58b <main+0x27>
+    else
+      break;
+  }
+  if(argc <= i){
+     66b:	8b 03                	mov    (%ebx),%eax
+     66d:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+     670:	7f 17                	jg     689 <main+0x125>
+    printf(2, "usage: grep [-c] [-j n | -P] pattern [file ...]\n");
+     672:	83 ec 08             	sub    $0x8,%esp
+     675:	68 4c 1f 00 00       	push   $0x1f4c
+     67a:	6a 02                	push   $0x2
+     67c:	e8 de 14 00 00       	call   1b5f <printf>
+     681:	83 c4 10             	add    $0x10,%esp
+    exit();
+     684:	e8 da 12 00 00       	call   1963 <exit>
+  }
+  if((r = compile(argv[i])) < 0){
+     689:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     68c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     693:	8b 43 04             	mov    0x4(%ebx),%eax
+     696:	01 d0                	add    %edx,%eax
+     698:	8b 00                	mov    (%eax),%eax
+     69a:	83 ec 0c             	sub    $0xc,%esp
+     69d:	50                   	push   %eax
+     69e:	e8 9f 0b 00 00       	call   1242 <compile>
+     6a3:	83 c4 10             	add    $0x10,%esp
+     6a6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     6a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     6ad:	79 55                	jns    704 <main+0x1a0>
+    if(r == TOOBIG)
+     6af:	83 7d ec fe          	cmpl   $0xfffffffe,-0x14(%ebp)
+     6b3:	75 26                	jne    6db <main+0x177>
+      printf(2, "grep: pattern too long %s\n", argv[i]);
+     6b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6b8:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     6bf:	8b 43 04             	mov    0x4(%ebx),%eax
+     6c2:	01 d0                	add    %edx,%eax
+     6c4:	8b 00                	mov    (%eax),%eax
+     6c6:	83 ec 04             	sub    $0x4,%esp
+     6c9:	50                   	push   %eax
+     6ca:	68 7d 1f 00 00       	push   $0x1f7d
+     6cf:	6a 02                	push   $0x2
+     6d1:	e8 89 14 00 00       	call   1b5f <printf>
+     6d6:	83 c4 10             	add    $0x10,%esp
+     6d9:	eb 24                	jmp    6ff <main+0x19b>
+    else
+      printf(2, "grep: bad pattern %s\n", argv[i]);
+     6db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6de:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     6e5:	8b 43 04             	mov    0x4(%ebx),%eax
+     6e8:	01 d0                	add    %edx,%eax
+     6ea:	8b 00                	mov    (%eax),%eax
+     6ec:	83 ec 04             	sub    $0x4,%esp
+     6ef:	50                   	push   %eax
+     6f0:	68 98 1f 00 00       	push   $0x1f98
+     6f5:	6a 02                	push   $0x2
+     6f7:	e8 63 14 00 00       	call   1b5f <printf>
+     6fc:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6ff:	e8 5f 12 00 00       	call   1963 <exit>
+  }
+  i++;
+     704:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+
+  if(argc <= i){
+     708:	8b 03                	mov    (%ebx),%eax
+     70a:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+     70d:	7f 17                	jg     726 <main+0x1c2>
+    grep(0);
+     70f:	83 ec 0c             	sub    $0xc,%esp
+     712:	6a 00                	push   $0x0
+     714:	e8 47 fa ff ff       	call   160 <grep>
+     719:	83 c4 10             	add    $0x10,%esp
+    flush();
+     71c:	e8 df f8 ff ff       	call   0 <flush>
+    exit();
+     721:	e8 3d 12 00 00       	call   1963 <exit>
+  }
+
+  if(nproc > 1 && argc - i > 1){
+     726:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+     72a:	0f 8e ad 00 00 00    	jle    7dd <main+0x279>
+     730:	8b 03                	mov    (%ebx),%eax
+     732:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     735:	83 f8 01             	cmp    $0x1,%eax
+     738:	0f 8e 9f 00 00 00    	jle    7dd <main+0x279>
+    pargrep(argv+i, argc-i, nproc);
+     73e:	8b 03                	mov    (%ebx),%eax
+     740:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     743:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     746:	8d 0c 95 00 00 00 00 	lea    0x0(,%edx,4),%ecx
+     74d:	8b 53 04             	mov    0x4(%ebx),%edx
+     750:	01 ca                	add    %ecx,%edx
+     752:	83 ec 04             	sub    $0x4,%esp
+     755:	ff 75 f0             	push   -0x10(%ebp)
+     758:	50                   	push   %eax
+     759:	52                   	push   %edx
+     75a:	e8 7b fb ff ff       	call   2da <pargrep>
+     75f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     762:	e8 fc 11 00 00       	call   1963 <exit>
+  }
+
+  for(; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+     767:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     76a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     771:	8b 43 04             	mov    0x4(%ebx),%eax
+     774:	01 d0                	add    %edx,%eax
+     776:	8b 00                	mov    (%eax),%eax
+     778:	83 ec 08             	sub    $0x8,%esp
+     77b:	6a 00                	push   $0x0
+     77d:	50                   	push   %eax
+     77e:	e8 20 12 00 00       	call   19a3 <open>
+     783:	83 c4 10             	add    $0x10,%esp
+     786:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     789:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     78d:	79 2e                	jns    7bd <main+0x259>
+      flush();
+     78f:	e8 6c f8 ff ff       	call   0 <flush>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+     794:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     797:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     79e:	8b 43 04             	mov    0x4(%ebx),%eax
+     7a1:	01 d0                	add    %edx,%eax
+     7a3:	8b 00                	mov    (%eax),%eax
+     7a5:	83 ec 04             	sub    $0x4,%esp
+     7a8:	50                   	push   %eax
+     7a9:	68 ae 1f 00 00       	push   $0x1fae
+     7ae:	6a 01                	push   $0x1
+     7b0:	e8 aa 13 00 00       	call   1b5f <printf>
+     7b5:	83 c4 10             	add    $0x10,%esp
+      exit();
+     7b8:	e8 a6 11 00 00       	call   1963 <exit>
+    }
+    grep(fd);
+     7bd:	83 ec 0c             	sub    $0xc,%esp
+     7c0:	ff 75 e8             	push   -0x18(%ebp)
+     7c3:	e8 98 f9 ff ff       	call   160 <grep>
+     7c8:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+     7cb:	83 ec 0c             	sub    $0xc,%esp
+     7ce:	ff 75 e8             	push   -0x18(%ebp)
+     7d1:	e8 b5 11 00 00       	call   198b <close>
+     7d6:	83 c4 10             	add    $0x10,%esp
+  for(; i < argc; i++){
+     7d9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     7dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7e0:	3b 03                	cmp    (%ebx),%eax
+     7e2:	7c 83                	jl     767 <main+0x203>
+  }
+  flush();
+     7e4:	e8 17 f8 ff ff       	call   0 <flush>
+  exit();
+     7e9:	e8 75 11 00 00       	call   1963 <exit>
+
+000007ee <scanc>:
+}
+
+// memchr: find c in [p, e), a word at a time once p is aligned.
+char*
+scanc(char *p, char *e, int c)
+{
+     7ee:	55                   	push   %ebp
+     7ef:	89 e5                	mov    %esp,%ebp
+     7f1:	83 ec 10             	sub    $0x10,%esp
+  uint x, w;
+
+  for(; p < e && ((uint)p & 3) != 0; p++)
+     7f4:	eb 1a                	jmp    810 <scanc+0x22>
+    if(*p == c)
+     7f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7f9:	0f b6 00             	movzbl (%eax),%eax
+     7fc:	0f be c0             	movsbl %al,%eax
+     7ff:	39 45 10             	cmp    %eax,0x10(%ebp)
+     802:	75 08                	jne    80c <scanc+0x1e>
+      return p;
+     804:	8b 45 08             	mov    0x8(%ebp),%eax
+     807:	e9 83 00 00 00       	jmp    88f <scanc+0xa1>
+  for(; p < e && ((uint)p & 3) != 0; p++)
+     80c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     810:	8b 45 08             	mov    0x8(%ebp),%eax
+     813:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     816:	73 0a                	jae    822 <scanc+0x34>
+     818:	8b 45 08             	mov    0x8(%ebp),%eax
+     81b:	83 e0 03             	and    $0x3,%eax
+     81e:	85 c0                	test   %eax,%eax
+     820:	75 d4                	jne    7f6 <scanc+0x8>
+  x = (uchar)c * 0x01010101;
+     822:	8b 45 10             	mov    0x10(%ebp),%eax
+     825:	0f b6 c0             	movzbl %al,%eax
+     828:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+     82e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  for(; p + 4 <= e; p += 4){
+     831:	eb 28                	jmp    85b <scanc+0x6d>
+    w = *(uint*)p ^ x;
+     833:	8b 45 08             	mov    0x8(%ebp),%eax
+     836:	8b 00                	mov    (%eax),%eax
+     838:	33 45 fc             	xor    -0x4(%ebp),%eax
+     83b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    if((w - 0x01010101) & ~w & 0x80808080)  // some byte of w is 0
+     83e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     841:	8d 90 ff fe fe fe    	lea    -0x1010101(%eax),%edx
+     847:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     84a:	f7 d0                	not    %eax
+     84c:	21 d0                	and    %edx,%eax
+     84e:	25 80 80 80 80       	and    $0x80808080,%eax
+     853:	85 c0                	test   %eax,%eax
+     855:	75 11                	jne    868 <scanc+0x7a>
+  for(; p + 4 <= e; p += 4){
+     857:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+     85b:	8b 45 08             	mov    0x8(%ebp),%eax
+     85e:	83 c0 04             	add    $0x4,%eax
+     861:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     864:	73 cd                	jae    833 <scanc+0x45>
+     866:	eb 1a                	jmp    882 <scanc+0x94>
+      break;
+     868:	90                   	nop
+  }
+  for(; p < e; p++)
+     869:	eb 17                	jmp    882 <scanc+0x94>
+    if(*p == c)
+     86b:	8b 45 08             	mov    0x8(%ebp),%eax
+     86e:	0f b6 00             	movzbl (%eax),%eax
+     871:	0f be c0             	movsbl %al,%eax
+     874:	39 45 10             	cmp    %eax,0x10(%ebp)
+     877:	75 05                	jne    87e <scanc+0x90>
+      return p;
+     879:	8b 45 08             	mov    0x8(%ebp),%eax
+     87c:	eb 11                	jmp    88f <scanc+0xa1>
+  for(; p < e; p++)
+     87e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     882:	8b 45 08             	mov    0x8(%ebp),%eax
+     885:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     888:	72 e1                	jb     86b <scanc+0x7d>
+  return 0;
+     88a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     88f:	c9                   	leave
+     890:	c3                   	ret
+
+00000891 <mknode>:
+static int npre;
+static int literal;
+
+static struct node*
+mknode(int type, struct node *l, struct node *r)
+{
+     891:	55                   	push   %ebp
+     892:	89 e5                	mov    %esp,%ebp
+     894:	83 ec 10             	sub    $0x10,%esp
+  struct node *n;
+
+  if(nnode >= MAXNODE){
+     897:	a1 60 65 00 00       	mov    0x6560,%eax
+     89c:	3d ff 00 00 00       	cmp    $0xff,%eax
+     8a1:	7e 14                	jle    8b7 <mknode+0x26>
+    bad = TOOBIG;
+     8a3:	c7 05 a8 87 00 00 fe 	movl   $0xfffffffe,0x87a8
+     8aa:	ff ff ff 
+    nnode = 0;
+     8ad:	c7 05 60 65 00 00 00 	movl   $0x0,0x6560
+     8b4:	00 00 00 
+  }
+  n = &nodes[nnode++];
+     8b7:	a1 60 65 00 00       	mov    0x6560,%eax
+     8bc:	8d 50 01             	lea    0x1(%eax),%edx
+     8bf:	89 15 60 65 00 00    	mov    %edx,0x6560
+     8c5:	c1 e0 04             	shl    $0x4,%eax
+     8c8:	05 60 55 00 00       	add    $0x5560,%eax
+     8cd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  n->type = type;
+     8d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     8d3:	8b 55 08             	mov    0x8(%ebp),%edx
+     8d6:	89 10                	mov    %edx,(%eax)
+  n->c = 0;
+     8d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     8db:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  n->l = l;
+     8e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     8e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8e8:	89 50 08             	mov    %edx,0x8(%eax)
+  n->r = r;
+     8eb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     8ee:	8b 55 10             	mov    0x10(%ebp),%edx
+     8f1:	89 50 0c             	mov    %edx,0xc(%eax)
+  return n;
+     8f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     8f7:	c9                   	leave
+     8f8:	c3                   	ret
+
+000008f9 <parseclass>:
+static struct node *parsealt(void);
+
+// [abc], [a-z], [^...]; a ] right after [ or [^ is literal.
+static struct node*
+parseclass(void)
+{
+     8f9:	55                   	push   %ebp
+     8fa:	89 e5                	mov    %esp,%ebp
+     8fc:	56                   	push   %esi
+     8fd:	53                   	push   %ebx
+     8fe:	83 ec 20             	sub    $0x20,%esp
+  struct node *n;
+  uchar *b;
+  int i, neg, lo, hi;
+
+  if(ncls >= MAXCLASS){
+     901:	a1 80 67 00 00       	mov    0x6780,%eax
+     906:	83 f8 0f             	cmp    $0xf,%eax
+     909:	7e 14                	jle    91f <parseclass+0x26>
+    bad = TOOBIG;
+     90b:	c7 05 a8 87 00 00 fe 	movl   $0xfffffffe,0x87a8
+     912:	ff ff ff 
+    ncls = 0;
+     915:	c7 05 80 67 00 00 00 	movl   $0x0,0x6780
+     91c:	00 00 00 
+  }
+  n = mknode(CLS, 0, 0);
+     91f:	6a 00                	push   $0x0
+     921:	6a 00                	push   $0x0
+     923:	6a 02                	push   $0x2
+     925:	e8 67 ff ff ff       	call   891 <mknode>
+     92a:	83 c4 0c             	add    $0xc,%esp
+     92d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  n->c = ncls;
+     930:	8b 15 80 67 00 00    	mov    0x6780,%edx
+     936:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     939:	89 50 04             	mov    %edx,0x4(%eax)
+  b = cls[ncls++];
+     93c:	a1 80 67 00 00       	mov    0x6780,%eax
+     941:	8d 50 01             	lea    0x1(%eax),%edx
+     944:	89 15 80 67 00 00    	mov    %edx,0x6780
+     94a:	c1 e0 05             	shl    $0x5,%eax
+     94d:	05 80 65 00 00       	add    $0x6580,%eax
+     952:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  memset(b, 0, 256/8);
+     955:	83 ec 04             	sub    $0x4,%esp
+     958:	6a 20                	push   $0x20
+     95a:	6a 00                	push   $0x0
+     95c:	ff 75 e0             	push   -0x20(%ebp)
+     95f:	e8 26 0e 00 00       	call   178a <memset>
+     964:	83 c4 10             	add    $0x10,%esp
+  neg = 0;
+     967:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(*rp == '^'){
+     96e:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     973:	0f b6 00             	movzbl (%eax),%eax
+     976:	3c 5e                	cmp    $0x5e,%al
+     978:	75 14                	jne    98e <parseclass+0x95>
+    neg = 1;
+     97a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    rp++;
+     981:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     986:	83 c0 01             	add    $0x1,%eax
+     989:	a3 a4 87 00 00       	mov    %eax,0x87a4
+  }
+  for(i = 0; *rp && (*rp != ']' || i == 0); i++){
+     98e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     995:	e9 ad 00 00 00       	jmp    a47 <parseclass+0x14e>
+    lo = hi = (uchar)*rp++;
+     99a:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     99f:	8d 50 01             	lea    0x1(%eax),%edx
+     9a2:	89 15 a4 87 00 00    	mov    %edx,0x87a4
+     9a8:	0f b6 00             	movzbl (%eax),%eax
+     9ab:	0f b6 c0             	movzbl %al,%eax
+     9ae:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     9b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9b4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(rp[0] == '-' && rp[1] && rp[1] != ']'){
+     9b7:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     9bc:	0f b6 00             	movzbl (%eax),%eax
+     9bf:	3c 2d                	cmp    $0x2d,%al
+     9c1:	75 78                	jne    a3b <parseclass+0x142>
+     9c3:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     9c8:	83 c0 01             	add    $0x1,%eax
+     9cb:	0f b6 00             	movzbl (%eax),%eax
+     9ce:	84 c0                	test   %al,%al
+     9d0:	74 69                	je     a3b <parseclass+0x142>
+     9d2:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     9d7:	83 c0 01             	add    $0x1,%eax
+     9da:	0f b6 00             	movzbl (%eax),%eax
+     9dd:	3c 5d                	cmp    $0x5d,%al
+     9df:	74 5a                	je     a3b <parseclass+0x142>
+      hi = (uchar)rp[1];
+     9e1:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     9e6:	83 c0 01             	add    $0x1,%eax
+     9e9:	0f b6 00             	movzbl (%eax),%eax
+     9ec:	0f b6 c0             	movzbl %al,%eax
+     9ef:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      rp += 2;
+     9f2:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     9f7:	83 c0 02             	add    $0x2,%eax
+     9fa:	a3 a4 87 00 00       	mov    %eax,0x87a4
+    }
+    for(; lo <= hi; lo++)
+     9ff:	eb 3a                	jmp    a3b <parseclass+0x142>
+      b[lo/8] |= 1 << (lo%8);
+     a01:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a04:	8d 50 07             	lea    0x7(%eax),%edx
+     a07:	85 c0                	test   %eax,%eax
+     a09:	0f 48 c2             	cmovs  %edx,%eax
+     a0c:	c1 f8 03             	sar    $0x3,%eax
+     a0f:	89 c1                	mov    %eax,%ecx
+     a11:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     a14:	01 ca                	add    %ecx,%edx
+     a16:	0f b6 12             	movzbl (%edx),%edx
+     a19:	89 d6                	mov    %edx,%esi
+     a1b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     a1e:	83 e2 07             	and    $0x7,%edx
+     a21:	bb 01 00 00 00       	mov    $0x1,%ebx
+     a26:	89 d1                	mov    %edx,%ecx
+     a28:	d3 e3                	shl    %cl,%ebx
+     a2a:	89 da                	mov    %ebx,%edx
+     a2c:	09 f2                	or     %esi,%edx
+     a2e:	89 c1                	mov    %eax,%ecx
+     a30:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     a33:	01 c8                	add    %ecx,%eax
+     a35:	88 10                	mov    %dl,(%eax)
+    for(; lo <= hi; lo++)
+     a37:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     a3b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     a3e:	3b 45 e8             	cmp    -0x18(%ebp),%eax
+     a41:	7e be                	jle    a01 <parseclass+0x108>
+  for(i = 0; *rp && (*rp != ']' || i == 0); i++){
+     a43:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     a47:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     a4c:	0f b6 00             	movzbl (%eax),%eax
+     a4f:	84 c0                	test   %al,%al
+     a51:	74 1a                	je     a6d <parseclass+0x174>
+     a53:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     a58:	0f b6 00             	movzbl (%eax),%eax
+     a5b:	3c 5d                	cmp    $0x5d,%al
+     a5d:	0f 85 37 ff ff ff    	jne    99a <parseclass+0xa1>
+     a63:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     a67:	0f 84 2d ff ff ff    	je     99a <parseclass+0xa1>
+  }
+  if(*rp != ']')
+     a6d:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     a72:	0f b6 00             	movzbl (%eax),%eax
+     a75:	3c 5d                	cmp    $0x5d,%al
+     a77:	74 0c                	je     a85 <parseclass+0x18c>
+    bad = MALFORMED;
+     a79:	c7 05 a8 87 00 00 ff 	movl   $0xffffffff,0x87a8
+     a80:	ff ff ff 
+     a83:	eb 0d                	jmp    a92 <parseclass+0x199>
+  else
+    rp++;
+     a85:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     a8a:	83 c0 01             	add    $0x1,%eax
+     a8d:	a3 a4 87 00 00       	mov    %eax,0x87a4
+  if(neg)
+     a92:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     a96:	74 2a                	je     ac2 <parseclass+0x1c9>
+    for(i = 0; i < 256/8; i++)
+     a98:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     a9f:	eb 1b                	jmp    abc <parseclass+0x1c3>
+      b[i] = ~b[i];
+     aa1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     aa4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     aa7:	01 d0                	add    %edx,%eax
+     aa9:	0f b6 10             	movzbl (%eax),%edx
+     aac:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     aaf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     ab2:	01 c8                	add    %ecx,%eax
+     ab4:	f7 d2                	not    %edx
+     ab6:	88 10                	mov    %dl,(%eax)
+    for(i = 0; i < 256/8; i++)
+     ab8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     abc:	83 7d f4 1f          	cmpl   $0x1f,-0xc(%ebp)
+     ac0:	7e df                	jle    aa1 <parseclass+0x1a8>
+  return n;
+     ac2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+}
+     ac5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ac8:	5b                   	pop    %ebx
+     ac9:	5e                   	pop    %esi
+     aca:	5d                   	pop    %ebp
+     acb:	c3                   	ret
+
+00000acc <parseatom>:
+
+static struct node*
+parseatom(void)
+{
+     acc:	55                   	push   %ebp
+     acd:	89 e5                	mov    %esp,%ebp
+     acf:	83 ec 18             	sub    $0x18,%esp
+  struct node *n;
+  int c;
+
+  c = *rp++;
+     ad2:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     ad7:	8d 50 01             	lea    0x1(%eax),%edx
+     ada:	89 15 a4 87 00 00    	mov    %edx,0x87a4
+     ae0:	0f b6 00             	movzbl (%eax),%eax
+     ae3:	0f be c0             	movsbl %al,%eax
+     ae6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  switch(c){
+     ae9:	83 7d f4 5e          	cmpl   $0x5e,-0xc(%ebp)
+     aed:	0f 84 14 01 00 00    	je     c07 <parseatom+0x13b>
+     af3:	83 7d f4 5e          	cmpl   $0x5e,-0xc(%ebp)
+     af7:	0f 8f 54 01 00 00    	jg     c51 <parseatom+0x185>
+     afd:	83 7d f4 5c          	cmpl   $0x5c,-0xc(%ebp)
+     b01:	0f 84 26 01 00 00    	je     c2d <parseatom+0x161>
+     b07:	83 7d f4 5c          	cmpl   $0x5c,-0xc(%ebp)
+     b0b:	0f 8f 40 01 00 00    	jg     c51 <parseatom+0x185>
+     b11:	83 7d f4 5b          	cmpl   $0x5b,-0xc(%ebp)
+     b15:	0f 84 d2 00 00 00    	je     bed <parseatom+0x121>
+     b1b:	83 7d f4 5b          	cmpl   $0x5b,-0xc(%ebp)
+     b1f:	0f 8f 2c 01 00 00    	jg     c51 <parseatom+0x185>
+     b25:	83 7d f4 2e          	cmpl   $0x2e,-0xc(%ebp)
+     b29:	0f 84 c5 00 00 00    	je     bf4 <parseatom+0x128>
+     b2f:	83 7d f4 2e          	cmpl   $0x2e,-0xc(%ebp)
+     b33:	0f 8f 18 01 00 00    	jg     c51 <parseatom+0x185>
+     b39:	83 7d f4 24          	cmpl   $0x24,-0xc(%ebp)
+     b3d:	0f 84 d7 00 00 00    	je     c1a <parseatom+0x14e>
+     b43:	83 7d f4 28          	cmpl   $0x28,-0xc(%ebp)
+     b47:	0f 85 04 01 00 00    	jne    c51 <parseatom+0x185>
+  case '(':
+    // Each group costs a few stack frames here and in gen, so
+    // limit the nesting rather than overflow the stack.
+    if(depth >= MAXDEPTH){
+     b4d:	a1 ac 87 00 00       	mov    0x87ac,%eax
+     b52:	83 f8 0f             	cmp    $0xf,%eax
+     b55:	7e 3e                	jle    b95 <parseatom+0xc9>
+      bad = TOOBIG;
+     b57:	c7 05 a8 87 00 00 fe 	movl   $0xfffffffe,0x87a8
+     b5e:	ff ff ff 
+      rp += strlen(rp);
+     b61:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     b66:	83 ec 0c             	sub    $0xc,%esp
+     b69:	50                   	push   %eax
+     b6a:	e8 f4 0b 00 00       	call   1763 <strlen>
+     b6f:	83 c4 10             	add    $0x10,%esp
+     b72:	8b 15 a4 87 00 00    	mov    0x87a4,%edx
+     b78:	01 d0                	add    %edx,%eax
+     b7a:	a3 a4 87 00 00       	mov    %eax,0x87a4
+      return mknode(EMPTY, 0, 0);
+     b7f:	83 ec 04             	sub    $0x4,%esp
+     b82:	6a 00                	push   $0x0
+     b84:	6a 00                	push   $0x0
+     b86:	6a 05                	push   $0x5
+     b88:	e8 04 fd ff ff       	call   891 <mknode>
+     b8d:	83 c4 10             	add    $0x10,%esp
+     b90:	e9 dc 00 00 00       	jmp    c71 <parseatom+0x1a5>
+    }
+    depth++;
+     b95:	a1 ac 87 00 00       	mov    0x87ac,%eax
+     b9a:	83 c0 01             	add    $0x1,%eax
+     b9d:	a3 ac 87 00 00       	mov    %eax,0x87ac
+    n = parsealt();
+     ba2:	e8 14 02 00 00       	call   dbb <parsealt>
+     ba7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    depth--;
+     baa:	a1 ac 87 00 00       	mov    0x87ac,%eax
+     baf:	83 e8 01             	sub    $0x1,%eax
+     bb2:	a3 ac 87 00 00       	mov    %eax,0x87ac
+    if(*rp == ')')
+     bb7:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     bbc:	0f b6 00             	movzbl (%eax),%eax
+     bbf:	3c 29                	cmp    $0x29,%al
+     bc1:	75 0f                	jne    bd2 <parseatom+0x106>
+      rp++;
+     bc3:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     bc8:	83 c0 01             	add    $0x1,%eax
+     bcb:	a3 a4 87 00 00       	mov    %eax,0x87a4
+     bd0:	eb 13                	jmp    be5 <parseatom+0x119>
+    else if(!bad)
+     bd2:	a1 a8 87 00 00       	mov    0x87a8,%eax
+     bd7:	85 c0                	test   %eax,%eax
+     bd9:	75 0a                	jne    be5 <parseatom+0x119>
+      bad = MALFORMED;
+     bdb:	c7 05 a8 87 00 00 ff 	movl   $0xffffffff,0x87a8
+     be2:	ff ff ff 
+    return n;
+     be5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     be8:	e9 84 00 00 00       	jmp    c71 <parseatom+0x1a5>
+  case '[':
+    return parseclass();
+     bed:	e8 07 fd ff ff       	call   8f9 <parseclass>
+     bf2:	eb 7d                	jmp    c71 <parseatom+0x1a5>
+  case '.':
+    return mknode(ANY, 0, 0);
+     bf4:	83 ec 04             	sub    $0x4,%esp
+     bf7:	6a 00                	push   $0x0
+     bf9:	6a 00                	push   $0x0
+     bfb:	6a 01                	push   $0x1
+     bfd:	e8 8f fc ff ff       	call   891 <mknode>
+     c02:	83 c4 10             	add    $0x10,%esp
+     c05:	eb 6a                	jmp    c71 <parseatom+0x1a5>
+  case '^':
+    return mknode(BOL, 0, 0);
+     c07:	83 ec 04             	sub    $0x4,%esp
+     c0a:	6a 00                	push   $0x0
+     c0c:	6a 00                	push   $0x0
+     c0e:	6a 03                	push   $0x3
+     c10:	e8 7c fc ff ff       	call   891 <mknode>
+     c15:	83 c4 10             	add    $0x10,%esp
+     c18:	eb 57                	jmp    c71 <parseatom+0x1a5>
+  case '$':
+    return mknode(EOL, 0, 0);
+     c1a:	83 ec 04             	sub    $0x4,%esp
+     c1d:	6a 00                	push   $0x0
+     c1f:	6a 00                	push   $0x0
+     c21:	6a 04                	push   $0x4
+     c23:	e8 69 fc ff ff       	call   891 <mknode>
+     c28:	83 c4 10             	add    $0x10,%esp
+     c2b:	eb 44                	jmp    c71 <parseatom+0x1a5>
+  case '\\':
+    if(*rp)
+     c2d:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     c32:	0f b6 00             	movzbl (%eax),%eax
+     c35:	84 c0                	test   %al,%al
+     c37:	74 17                	je     c50 <parseatom+0x184>
+      c = *rp++;
+     c39:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     c3e:	8d 50 01             	lea    0x1(%eax),%edx
+     c41:	89 15 a4 87 00 00    	mov    %edx,0x87a4
+     c47:	0f b6 00             	movzbl (%eax),%eax
+     c4a:	0f be c0             	movsbl %al,%eax
+     c4d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    break;
+     c50:	90                   	nop
+  }
+  n = mknode(LIT, 0, 0);
+     c51:	83 ec 04             	sub    $0x4,%esp
+     c54:	6a 00                	push   $0x0
+     c56:	6a 00                	push   $0x0
+     c58:	6a 00                	push   $0x0
+     c5a:	e8 32 fc ff ff       	call   891 <mknode>
+     c5f:	83 c4 10             	add    $0x10,%esp
+     c62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  n->c = c;
+     c65:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c68:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     c6b:	89 50 04             	mov    %edx,0x4(%eax)
+  return n;
+     c6e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     c71:	c9                   	leave
+     c72:	c3                   	ret
+
+00000c73 <parserep>:
+
+// atom followed by any number of * + ?.  A leading * + or ?
+// has nothing to repeat and is taken literally.
+static struct node*
+parserep(void)
+{
+     c73:	55                   	push   %ebp
+     c74:	89 e5                	mov    %esp,%ebp
+     c76:	83 ec 18             	sub    $0x18,%esp
+  struct node *n;
+
+  n = parseatom();
+     c79:	e8 4e fe ff ff       	call   acc <parseatom>
+     c7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(;;){
+    if(*rp == '*')
+     c81:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     c86:	0f b6 00             	movzbl (%eax),%eax
+     c89:	3c 2a                	cmp    $0x2a,%al
+     c8b:	75 17                	jne    ca4 <parserep+0x31>
+      n = mknode(STAR, n, 0);
+     c8d:	83 ec 04             	sub    $0x4,%esp
+     c90:	6a 00                	push   $0x0
+     c92:	ff 75 f4             	push   -0xc(%ebp)
+     c95:	6a 08                	push   $0x8
+     c97:	e8 f5 fb ff ff       	call   891 <mknode>
+     c9c:	83 c4 10             	add    $0x10,%esp
+     c9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ca2:	eb 4b                	jmp    cef <parserep+0x7c>
+    else if(*rp == '+')
+     ca4:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     ca9:	0f b6 00             	movzbl (%eax),%eax
+     cac:	3c 2b                	cmp    $0x2b,%al
+     cae:	75 17                	jne    cc7 <parserep+0x54>
+      n = mknode(PLUS, n, 0);
+     cb0:	83 ec 04             	sub    $0x4,%esp
+     cb3:	6a 00                	push   $0x0
+     cb5:	ff 75 f4             	push   -0xc(%ebp)
+     cb8:	6a 09                	push   $0x9
+     cba:	e8 d2 fb ff ff       	call   891 <mknode>
+     cbf:	83 c4 10             	add    $0x10,%esp
+     cc2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     cc5:	eb 28                	jmp    cef <parserep+0x7c>
+    else if(*rp == '?')
+     cc7:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     ccc:	0f b6 00             	movzbl (%eax),%eax
+     ccf:	3c 3f                	cmp    $0x3f,%al
+     cd1:	75 17                	jne    cea <parserep+0x77>
+      n = mknode(QUEST, n, 0);
+     cd3:	83 ec 04             	sub    $0x4,%esp
+     cd6:	6a 00                	push   $0x0
+     cd8:	ff 75 f4             	push   -0xc(%ebp)
+     cdb:	6a 0a                	push   $0xa
+     cdd:	e8 af fb ff ff       	call   891 <mknode>
+     ce2:	83 c4 10             	add    $0x10,%esp
+     ce5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     ce8:	eb 05                	jmp    cef <parserep+0x7c>
+    else
+      return n;
+     cea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ced:	eb 0f                	jmp    cfe <parserep+0x8b>
+    rp++;
+     cef:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     cf4:	83 c0 01             	add    $0x1,%eax
+     cf7:	a3 a4 87 00 00       	mov    %eax,0x87a4
+    if(*rp == '*')
+     cfc:	eb 83                	jmp    c81 <parserep+0xe>
+  }
+}
+     cfe:	c9                   	leave
+     cff:	c3                   	ret
+
+00000d00 <parsecat>:
+// Concatenations and alternations are built as chains down the
+// right, with t the last CAT or ALT node, so gen and prefix can
+// walk them in a loop instead of recursing once per element.
+static struct node*
+parsecat(void)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	83 ec 18             	sub    $0x18,%esp
+  struct node *n, *t, *r;
+
+  n = t = 0;
+     d06:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     d0d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d10:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(*rp && *rp != '|' && *rp != ')'){
+     d13:	eb 60                	jmp    d75 <parsecat+0x75>
+    r = parserep();
+     d15:	e8 59 ff ff ff       	call   c73 <parserep>
+     d1a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(n == 0)
+     d1d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     d21:	75 08                	jne    d2b <parsecat+0x2b>
+      n = r;
+     d23:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d26:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     d29:	eb 4a                	jmp    d75 <parsecat+0x75>
+    else if(t == 0)
+     d2b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d2f:	75 1e                	jne    d4f <parsecat+0x4f>
+      n = t = mknode(CAT, n, r);
+     d31:	83 ec 04             	sub    $0x4,%esp
+     d34:	ff 75 ec             	push   -0x14(%ebp)
+     d37:	ff 75 f4             	push   -0xc(%ebp)
+     d3a:	6a 06                	push   $0x6
+     d3c:	e8 50 fb ff ff       	call   891 <mknode>
+     d41:	83 c4 10             	add    $0x10,%esp
+     d44:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     d47:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d4a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     d4d:	eb 26                	jmp    d75 <parsecat+0x75>
+    else
+      t = t->r = mknode(CAT, t->r, r);
+     d4f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d52:	8b 40 0c             	mov    0xc(%eax),%eax
+     d55:	83 ec 04             	sub    $0x4,%esp
+     d58:	ff 75 ec             	push   -0x14(%ebp)
+     d5b:	50                   	push   %eax
+     d5c:	6a 06                	push   $0x6
+     d5e:	e8 2e fb ff ff       	call   891 <mknode>
+     d63:	83 c4 10             	add    $0x10,%esp
+     d66:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     d69:	89 42 0c             	mov    %eax,0xc(%edx)
+     d6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d6f:	8b 40 0c             	mov    0xc(%eax),%eax
+     d72:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(*rp && *rp != '|' && *rp != ')'){
+     d75:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     d7a:	0f b6 00             	movzbl (%eax),%eax
+     d7d:	84 c0                	test   %al,%al
+     d7f:	74 1c                	je     d9d <parsecat+0x9d>
+     d81:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     d86:	0f b6 00             	movzbl (%eax),%eax
+     d89:	3c 7c                	cmp    $0x7c,%al
+     d8b:	74 10                	je     d9d <parsecat+0x9d>
+     d8d:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     d92:	0f b6 00             	movzbl (%eax),%eax
+     d95:	3c 29                	cmp    $0x29,%al
+     d97:	0f 85 78 ff ff ff    	jne    d15 <parsecat+0x15>
+  }
+  return n ? n : mknode(EMPTY, 0, 0);
+     d9d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     da1:	75 13                	jne    db6 <parsecat+0xb6>
+     da3:	83 ec 04             	sub    $0x4,%esp
+     da6:	6a 00                	push   $0x0
+     da8:	6a 00                	push   $0x0
+     daa:	6a 05                	push   $0x5
+     dac:	e8 e0 fa ff ff       	call   891 <mknode>
+     db1:	83 c4 10             	add    $0x10,%esp
+     db4:	eb 03                	jmp    db9 <parsecat+0xb9>
+     db6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     db9:	c9                   	leave
+     dba:	c3                   	ret
+
+00000dbb <parsealt>:
+
+static struct node*
+parsealt(void)
+{
+     dbb:	55                   	push   %ebp
+     dbc:	89 e5                	mov    %esp,%ebp
+     dbe:	83 ec 18             	sub    $0x18,%esp
+  struct node *n, *t;
+
+  n = parsecat();
+     dc1:	e8 3a ff ff ff       	call   d00 <parsecat>
+     dc6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  t = 0;
+     dc9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(*rp == '|'){
+     dd0:	eb 5d                	jmp    e2f <parsealt+0x74>
+    rp++;
+     dd2:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     dd7:	83 c0 01             	add    $0x1,%eax
+     dda:	a3 a4 87 00 00       	mov    %eax,0x87a4
+    if(t == 0)
+     ddf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     de3:	75 21                	jne    e06 <parsealt+0x4b>
+      n = t = mknode(ALT, n, parsecat());
+     de5:	e8 16 ff ff ff       	call   d00 <parsecat>
+     dea:	83 ec 04             	sub    $0x4,%esp
+     ded:	50                   	push   %eax
+     dee:	ff 75 f4             	push   -0xc(%ebp)
+     df1:	6a 07                	push   $0x7
+     df3:	e8 99 fa ff ff       	call   891 <mknode>
+     df8:	83 c4 10             	add    $0x10,%esp
+     dfb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     dfe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e01:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     e04:	eb 29                	jmp    e2f <parsealt+0x74>
+    else
+      t = t->r = mknode(ALT, t->r, parsecat());
+     e06:	e8 f5 fe ff ff       	call   d00 <parsecat>
+     e0b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     e0e:	8b 52 0c             	mov    0xc(%edx),%edx
+     e11:	83 ec 04             	sub    $0x4,%esp
+     e14:	50                   	push   %eax
+     e15:	52                   	push   %edx
+     e16:	6a 07                	push   $0x7
+     e18:	e8 74 fa ff ff       	call   891 <mknode>
+     e1d:	83 c4 10             	add    $0x10,%esp
+     e20:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     e23:	89 42 0c             	mov    %eax,0xc(%edx)
+     e26:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e29:	8b 40 0c             	mov    0xc(%eax),%eax
+     e2c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(*rp == '|'){
+     e2f:	a1 a4 87 00 00       	mov    0x87a4,%eax
+     e34:	0f b6 00             	movzbl (%eax),%eax
+     e37:	3c 7c                	cmp    $0x7c,%al
+     e39:	74 97                	je     dd2 <parsealt+0x17>
+  }
+  return n;
+     e3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     e3e:	c9                   	leave
+     e3f:	c3                   	ret
+
+00000e40 <emit>:
+
+static int
+emit(int op, int c)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+  if(ninst >= MAXINST){
+     e43:	a1 a0 87 00 00       	mov    0x87a0,%eax
+     e48:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+     e4d:	7e 14                	jle    e63 <emit+0x23>
+    bad = TOOBIG;
+     e4f:	c7 05 a8 87 00 00 fe 	movl   $0xfffffffe,0x87a8
+     e56:	ff ff ff 
+    ninst = 0;
+     e59:	c7 05 a0 87 00 00 00 	movl   $0x0,0x87a0
+     e60:	00 00 00 
+  }
+  prog[ninst].op = op;
+     e63:	a1 a0 87 00 00       	mov    0x87a0,%eax
+     e68:	c1 e0 04             	shl    $0x4,%eax
+     e6b:	8d 90 a0 67 00 00    	lea    0x67a0(%eax),%edx
+     e71:	8b 45 08             	mov    0x8(%ebp),%eax
+     e74:	89 02                	mov    %eax,(%edx)
+  prog[ninst].c = c;
+     e76:	a1 a0 87 00 00       	mov    0x87a0,%eax
+     e7b:	c1 e0 04             	shl    $0x4,%eax
+     e7e:	8d 90 a4 67 00 00    	lea    0x67a4(%eax),%edx
+     e84:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e87:	89 02                	mov    %eax,(%edx)
+  prog[ninst].x = prog[ninst].y = 0;
+     e89:	a1 a0 87 00 00       	mov    0x87a0,%eax
+     e8e:	89 c2                	mov    %eax,%edx
+     e90:	c1 e2 04             	shl    $0x4,%edx
+     e93:	81 c2 ac 67 00 00    	add    $0x67ac,%edx
+     e99:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+     e9f:	8b 15 a0 87 00 00    	mov    0x87a0,%edx
+     ea5:	c1 e0 04             	shl    $0x4,%eax
+     ea8:	05 ac 67 00 00       	add    $0x67ac,%eax
+     ead:	8b 00                	mov    (%eax),%eax
+     eaf:	c1 e2 04             	shl    $0x4,%edx
+     eb2:	81 c2 a8 67 00 00    	add    $0x67a8,%edx
+     eb8:	89 02                	mov    %eax,(%edx)
+  return ninst++;
+     eba:	a1 a0 87 00 00       	mov    0x87a0,%eax
+     ebf:	8d 50 01             	lea    0x1(%eax),%edx
+     ec2:	89 15 a0 87 00 00    	mov    %edx,0x87a0
+}
+     ec8:	5d                   	pop    %ebp
+     ec9:	c3                   	ret
+
+00000eca <gen>:
+
+// Generate code for n.  Only groups and repetitions nest, and
+// the nesting is limited to MAXDEPTH to stay within the stack.
+static void
+gen(struct node *n)
+{
+     eca:	55                   	push   %ebp
+     ecb:	89 e5                	mov    %esp,%ebp
+     ecd:	83 ec 18             	sub    $0x18,%esp
+  int a, b, j;
+
+  if(gdepth >= MAXDEPTH){
+     ed0:	a1 b0 87 00 00       	mov    0x87b0,%eax
+     ed5:	83 f8 0f             	cmp    $0xf,%eax
+     ed8:	7e 0f                	jle    ee9 <gen+0x1f>
+    bad = TOOBIG;
+     eda:	c7 05 a8 87 00 00 fe 	movl   $0xfffffffe,0x87a8
+     ee1:	ff ff ff 
+    return;
+     ee4:	e9 bb 02 00 00       	jmp    11a4 <gen+0x2da>
+  }
+  gdepth++;
+     ee9:	a1 b0 87 00 00       	mov    0x87b0,%eax
+     eee:	83 c0 01             	add    $0x1,%eax
+     ef1:	a3 b0 87 00 00       	mov    %eax,0x87b0
+  for(; n->type == CAT; n = n->r)
+     ef6:	eb 1b                	jmp    f13 <gen+0x49>
+    gen(n->l);
+     ef8:	8b 45 08             	mov    0x8(%ebp),%eax
+     efb:	8b 40 08             	mov    0x8(%eax),%eax
+     efe:	83 ec 0c             	sub    $0xc,%esp
+     f01:	50                   	push   %eax
+     f02:	e8 c3 ff ff ff       	call   eca <gen>
+     f07:	83 c4 10             	add    $0x10,%esp
+  for(; n->type == CAT; n = n->r)
+     f0a:	8b 45 08             	mov    0x8(%ebp),%eax
+     f0d:	8b 40 0c             	mov    0xc(%eax),%eax
+     f10:	89 45 08             	mov    %eax,0x8(%ebp)
+     f13:	8b 45 08             	mov    0x8(%ebp),%eax
+     f16:	8b 00                	mov    (%eax),%eax
+     f18:	83 f8 06             	cmp    $0x6,%eax
+     f1b:	74 db                	je     ef8 <gen+0x2e>
+  switch(n->type){
+     f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+     f20:	8b 00                	mov    (%eax),%eax
+     f22:	83 f8 0a             	cmp    $0xa,%eax
+     f25:	0f 87 6c 02 00 00    	ja     1197 <gen+0x2cd>
+     f2b:	8b 04 85 c4 1f 00 00 	mov    0x1fc4(,%eax,4),%eax
+     f32:	ff e0                	jmp    *%eax
+  case LIT:
+    emit(ICHAR, n->c);
+     f34:	8b 45 08             	mov    0x8(%ebp),%eax
+     f37:	8b 40 04             	mov    0x4(%eax),%eax
+     f3a:	83 ec 08             	sub    $0x8,%esp
+     f3d:	50                   	push   %eax
+     f3e:	6a 00                	push   $0x0
+     f40:	e8 fb fe ff ff       	call   e40 <emit>
+     f45:	83 c4 10             	add    $0x10,%esp
+    break;
+     f48:	e9 4a 02 00 00       	jmp    1197 <gen+0x2cd>
+  case ANY:
+    emit(IANY, 0);
+     f4d:	83 ec 08             	sub    $0x8,%esp
+     f50:	6a 00                	push   $0x0
+     f52:	6a 01                	push   $0x1
+     f54:	e8 e7 fe ff ff       	call   e40 <emit>
+     f59:	83 c4 10             	add    $0x10,%esp
+    break;
+     f5c:	e9 36 02 00 00       	jmp    1197 <gen+0x2cd>
+  case CLS:
+    emit(ICLASS, n->c);
+     f61:	8b 45 08             	mov    0x8(%ebp),%eax
+     f64:	8b 40 04             	mov    0x4(%eax),%eax
+     f67:	83 ec 08             	sub    $0x8,%esp
+     f6a:	50                   	push   %eax
+     f6b:	6a 02                	push   $0x2
+     f6d:	e8 ce fe ff ff       	call   e40 <emit>
+     f72:	83 c4 10             	add    $0x10,%esp
+    break;
+     f75:	e9 1d 02 00 00       	jmp    1197 <gen+0x2cd>
+  case BOL:
+    emit(IBOL, 0);
+     f7a:	83 ec 08             	sub    $0x8,%esp
+     f7d:	6a 00                	push   $0x0
+     f7f:	6a 03                	push   $0x3
+     f81:	e8 ba fe ff ff       	call   e40 <emit>
+     f86:	83 c4 10             	add    $0x10,%esp
+    break;
+     f89:	e9 09 02 00 00       	jmp    1197 <gen+0x2cd>
+  case EOL:
+    emit(IEOL, 0);
+     f8e:	83 ec 08             	sub    $0x8,%esp
+     f91:	6a 00                	push   $0x0
+     f93:	6a 04                	push   $0x4
+     f95:	e8 a6 fe ff ff       	call   e40 <emit>
+     f9a:	83 c4 10             	add    $0x10,%esp
+    break;
+     f9d:	e9 f5 01 00 00       	jmp    1197 <gen+0x2cd>
+  case EMPTY:
+    break;
+  case ALT:     // split L1, L2; L1: l; jmp L3; L2: r; L3:
+    // Along the chain the jmps to L3 are linked through x
+    // until L3 is known.
+    j = -1;
+     fa2:	c7 45 f4 ff ff ff ff 	movl   $0xffffffff,-0xc(%ebp)
+    for(; n->type == ALT; n = n->r){
+     fa9:	eb 7c                	jmp    1027 <gen+0x15d>
+      a = emit(ISPLIT, 0);
+     fab:	83 ec 08             	sub    $0x8,%esp
+     fae:	6a 00                	push   $0x0
+     fb0:	6a 05                	push   $0x5
+     fb2:	e8 89 fe ff ff       	call   e40 <emit>
+     fb7:	83 c4 10             	add    $0x10,%esp
+     fba:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      prog[a].x = ninst;
+     fbd:	a1 a0 87 00 00       	mov    0x87a0,%eax
+     fc2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     fc5:	c1 e2 04             	shl    $0x4,%edx
+     fc8:	81 c2 a8 67 00 00    	add    $0x67a8,%edx
+     fce:	89 02                	mov    %eax,(%edx)
+      gen(n->l);
+     fd0:	8b 45 08             	mov    0x8(%ebp),%eax
+     fd3:	8b 40 08             	mov    0x8(%eax),%eax
+     fd6:	83 ec 0c             	sub    $0xc,%esp
+     fd9:	50                   	push   %eax
+     fda:	e8 eb fe ff ff       	call   eca <gen>
+     fdf:	83 c4 10             	add    $0x10,%esp
+      b = emit(IJMP, 0);
+     fe2:	83 ec 08             	sub    $0x8,%esp
+     fe5:	6a 00                	push   $0x0
+     fe7:	6a 06                	push   $0x6
+     fe9:	e8 52 fe ff ff       	call   e40 <emit>
+     fee:	83 c4 10             	add    $0x10,%esp
+     ff1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      prog[b].x = j;
+     ff4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ff7:	c1 e0 04             	shl    $0x4,%eax
+     ffa:	8d 90 a8 67 00 00    	lea    0x67a8(%eax),%edx
+    1000:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1003:	89 02                	mov    %eax,(%edx)
+      j = b;
+    1005:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1008:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      prog[a].y = ninst;
+    100b:	a1 a0 87 00 00       	mov    0x87a0,%eax
+    1010:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1013:	c1 e2 04             	shl    $0x4,%edx
+    1016:	81 c2 ac 67 00 00    	add    $0x67ac,%edx
+    101c:	89 02                	mov    %eax,(%edx)
+    for(; n->type == ALT; n = n->r){
+    101e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1021:	8b 40 0c             	mov    0xc(%eax),%eax
+    1024:	89 45 08             	mov    %eax,0x8(%ebp)
+    1027:	8b 45 08             	mov    0x8(%ebp),%eax
+    102a:	8b 00                	mov    (%eax),%eax
+    102c:	83 f8 07             	cmp    $0x7,%eax
+    102f:	0f 84 76 ff ff ff    	je     fab <gen+0xe1>
+    }
+    gen(n);
+    1035:	83 ec 0c             	sub    $0xc,%esp
+    1038:	ff 75 08             	push   0x8(%ebp)
+    103b:	e8 8a fe ff ff       	call   eca <gen>
+    1040:	83 c4 10             	add    $0x10,%esp
+    for(; j >= 0 && !bad; j = b){
+    1043:	eb 29                	jmp    106e <gen+0x1a4>
+      b = prog[j].x;
+    1045:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1048:	c1 e0 04             	shl    $0x4,%eax
+    104b:	05 a8 67 00 00       	add    $0x67a8,%eax
+    1050:	8b 00                	mov    (%eax),%eax
+    1052:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      prog[j].x = ninst;
+    1055:	a1 a0 87 00 00       	mov    0x87a0,%eax
+    105a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    105d:	c1 e2 04             	shl    $0x4,%edx
+    1060:	81 c2 a8 67 00 00    	add    $0x67a8,%edx
+    1066:	89 02                	mov    %eax,(%edx)
+    for(; j >= 0 && !bad; j = b){
+    1068:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    106b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    106e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1072:	0f 88 1e 01 00 00    	js     1196 <gen+0x2cc>
+    1078:	a1 a8 87 00 00       	mov    0x87a8,%eax
+    107d:	85 c0                	test   %eax,%eax
+    107f:	74 c4                	je     1045 <gen+0x17b>
+    }
+    break;
+    1081:	e9 10 01 00 00       	jmp    1196 <gen+0x2cc>
+  case STAR:    // L1: split L2, L3; L2: l; jmp L1; L3:
+    a = emit(ISPLIT, 0);
+    1086:	83 ec 08             	sub    $0x8,%esp
+    1089:	6a 00                	push   $0x0
+    108b:	6a 05                	push   $0x5
+    108d:	e8 ae fd ff ff       	call   e40 <emit>
+    1092:	83 c4 10             	add    $0x10,%esp
+    1095:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    prog[a].x = ninst;
+    1098:	a1 a0 87 00 00       	mov    0x87a0,%eax
+    109d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    10a0:	c1 e2 04             	shl    $0x4,%edx
+    10a3:	81 c2 a8 67 00 00    	add    $0x67a8,%edx
+    10a9:	89 02                	mov    %eax,(%edx)
+    gen(n->l);
+    10ab:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ae:	8b 40 08             	mov    0x8(%eax),%eax
+    10b1:	83 ec 0c             	sub    $0xc,%esp
+    10b4:	50                   	push   %eax
+    10b5:	e8 10 fe ff ff       	call   eca <gen>
+    10ba:	83 c4 10             	add    $0x10,%esp
+    b = emit(IJMP, 0);
+    10bd:	83 ec 08             	sub    $0x8,%esp
+    10c0:	6a 00                	push   $0x0
+    10c2:	6a 06                	push   $0x6
+    10c4:	e8 77 fd ff ff       	call   e40 <emit>
+    10c9:	83 c4 10             	add    $0x10,%esp
+    10cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    prog[b].x = a;
+    10cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10d2:	c1 e0 04             	shl    $0x4,%eax
+    10d5:	8d 90 a8 67 00 00    	lea    0x67a8(%eax),%edx
+    10db:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10de:	89 02                	mov    %eax,(%edx)
+    prog[a].y = ninst;
+    10e0:	a1 a0 87 00 00       	mov    0x87a0,%eax
+    10e5:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    10e8:	c1 e2 04             	shl    $0x4,%edx
+    10eb:	81 c2 ac 67 00 00    	add    $0x67ac,%edx
+    10f1:	89 02                	mov    %eax,(%edx)
+    break;
+    10f3:	e9 9f 00 00 00       	jmp    1197 <gen+0x2cd>
+  case PLUS:    // L1: l; split L1, L2; L2:
+    a = ninst;
+    10f8:	a1 a0 87 00 00       	mov    0x87a0,%eax
+    10fd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    gen(n->l);
+    1100:	8b 45 08             	mov    0x8(%ebp),%eax
+    1103:	8b 40 08             	mov    0x8(%eax),%eax
+    1106:	83 ec 0c             	sub    $0xc,%esp
+    1109:	50                   	push   %eax
+    110a:	e8 bb fd ff ff       	call   eca <gen>
+    110f:	83 c4 10             	add    $0x10,%esp
+    b = emit(ISPLIT, 0);
+    1112:	83 ec 08             	sub    $0x8,%esp
+    1115:	6a 00                	push   $0x0
+    1117:	6a 05                	push   $0x5
+    1119:	e8 22 fd ff ff       	call   e40 <emit>
+    111e:	83 c4 10             	add    $0x10,%esp
+    1121:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    prog[b].x = a;
+    1124:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1127:	c1 e0 04             	shl    $0x4,%eax
+    112a:	8d 90 a8 67 00 00    	lea    0x67a8(%eax),%edx
+    1130:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1133:	89 02                	mov    %eax,(%edx)
+    prog[b].y = ninst;
+    1135:	a1 a0 87 00 00       	mov    0x87a0,%eax
+    113a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    113d:	c1 e2 04             	shl    $0x4,%edx
+    1140:	81 c2 ac 67 00 00    	add    $0x67ac,%edx
+    1146:	89 02                	mov    %eax,(%edx)
+    break;
+    1148:	eb 4d                	jmp    1197 <gen+0x2cd>
+  case QUEST:   // split L1, L2; L1: l; L2:
+    a = emit(ISPLIT, 0);
+    114a:	83 ec 08             	sub    $0x8,%esp
+    114d:	6a 00                	push   $0x0
+    114f:	6a 05                	push   $0x5
+    1151:	e8 ea fc ff ff       	call   e40 <emit>
+    1156:	83 c4 10             	add    $0x10,%esp
+    1159:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    prog[a].x = ninst;
+    115c:	a1 a0 87 00 00       	mov    0x87a0,%eax
+    1161:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1164:	c1 e2 04             	shl    $0x4,%edx
+    1167:	81 c2 a8 67 00 00    	add    $0x67a8,%edx
+    116d:	89 02                	mov    %eax,(%edx)
+    gen(n->l);
+    116f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1172:	8b 40 08             	mov    0x8(%eax),%eax
+    1175:	83 ec 0c             	sub    $0xc,%esp
+    1178:	50                   	push   %eax
+    1179:	e8 4c fd ff ff       	call   eca <gen>
+    117e:	83 c4 10             	add    $0x10,%esp
+    prog[a].y = ninst;
+    1181:	a1 a0 87 00 00       	mov    0x87a0,%eax
+    1186:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1189:	c1 e2 04             	shl    $0x4,%edx
+    118c:	81 c2 ac 67 00 00    	add    $0x67ac,%edx
+    1192:	89 02                	mov    %eax,(%edx)
+    break;
+    1194:	eb 01                	jmp    1197 <gen+0x2cd>
+    break;
+    1196:	90                   	nop
+  }
+  gdepth--;
+    1197:	a1 b0 87 00 00       	mov    0x87b0,%eax
+    119c:	83 e8 01             	sub    $0x1,%eax
+    119f:	a3 b0 87 00 00       	mov    %eax,0x87b0
+}
+    11a4:	c9                   	leave
+    11a5:	c3                   	ret
+
+000011a6 <prefix>:
+
+// Append n's leading literal characters to pre[].
+// Return 1 if all of n was literal (a leading ^ is allowed).
+static int
+prefix(struct node *n)
+{
+    11a6:	55                   	push   %ebp
+    11a7:	89 e5                	mov    %esp,%ebp
+    11a9:	83 ec 08             	sub    $0x8,%esp
+  for(; n->type == CAT; n = n->r)
+    11ac:	eb 26                	jmp    11d4 <prefix+0x2e>
+    if(!prefix(n->l))
+    11ae:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b1:	8b 40 08             	mov    0x8(%eax),%eax
+    11b4:	83 ec 0c             	sub    $0xc,%esp
+    11b7:	50                   	push   %eax
+    11b8:	e8 e9 ff ff ff       	call   11a6 <prefix>
+    11bd:	83 c4 10             	add    $0x10,%esp
+    11c0:	85 c0                	test   %eax,%eax
+    11c2:	75 07                	jne    11cb <prefix+0x25>
+      return 0;
+    11c4:	b8 00 00 00 00       	mov    $0x0,%eax
+    11c9:	eb 75                	jmp    1240 <prefix+0x9a>
+  for(; n->type == CAT; n = n->r)
+    11cb:	8b 45 08             	mov    0x8(%ebp),%eax
+    11ce:	8b 40 0c             	mov    0xc(%eax),%eax
+    11d1:	89 45 08             	mov    %eax,0x8(%ebp)
+    11d4:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d7:	8b 00                	mov    (%eax),%eax
+    11d9:	83 f8 06             	cmp    $0x6,%eax
+    11dc:	74 d0                	je     11ae <prefix+0x8>
+  switch(n->type){
+    11de:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e1:	8b 00                	mov    (%eax),%eax
+    11e3:	85 c0                	test   %eax,%eax
+    11e5:	74 07                	je     11ee <prefix+0x48>
+    11e7:	83 f8 03             	cmp    $0x3,%eax
+    11ea:	74 36                	je     1222 <prefix+0x7c>
+    11ec:	eb 4d                	jmp    123b <prefix+0x95>
+  case LIT:
+    if(npre >= MAXPRE)
+    11ee:	a1 e0 87 00 00       	mov    0x87e0,%eax
+    11f3:	83 f8 1f             	cmp    $0x1f,%eax
+    11f6:	7e 07                	jle    11ff <prefix+0x59>
+      return 0;
+    11f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    11fd:	eb 41                	jmp    1240 <prefix+0x9a>
+    pre[npre++] = n->c;
+    11ff:	8b 45 08             	mov    0x8(%ebp),%eax
+    1202:	8b 48 04             	mov    0x4(%eax),%ecx
+    1205:	a1 e0 87 00 00       	mov    0x87e0,%eax
+    120a:	8d 50 01             	lea    0x1(%eax),%edx
+    120d:	89 15 e0 87 00 00    	mov    %edx,0x87e0
+    1213:	89 ca                	mov    %ecx,%edx
+    1215:	88 90 c0 87 00 00    	mov    %dl,0x87c0(%eax)
+    return 1;
+    121b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1220:	eb 1e                	jmp    1240 <prefix+0x9a>
+  case BOL:
+    literal = 0;
+    1222:	c7 05 e4 87 00 00 00 	movl   $0x0,0x87e4
+    1229:	00 00 00 
+    return npre == 0;
+    122c:	a1 e0 87 00 00       	mov    0x87e0,%eax
+    1231:	85 c0                	test   %eax,%eax
+    1233:	0f 94 c0             	sete   %al
+    1236:	0f b6 c0             	movzbl %al,%eax
+    1239:	eb 05                	jmp    1240 <prefix+0x9a>
+  }
+  return 0;
+    123b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1240:	c9                   	leave
+    1241:	c3                   	ret
+
+00001242 <compile>:
+
+int
+compile(char *re)
+{
+    1242:	55                   	push   %ebp
+    1243:	89 e5                	mov    %esp,%ebp
+    1245:	83 ec 18             	sub    $0x18,%esp
+  struct node *n;
+
+  rp = re;
+    1248:	8b 45 08             	mov    0x8(%ebp),%eax
+    124b:	a3 a4 87 00 00       	mov    %eax,0x87a4
+  n = parsealt();
+    1250:	e8 66 fb ff ff       	call   dbb <parsealt>
+    1255:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(*rp != 0 && !bad)  // unbalanced )
+    1258:	a1 a4 87 00 00       	mov    0x87a4,%eax
+    125d:	0f b6 00             	movzbl (%eax),%eax
+    1260:	84 c0                	test   %al,%al
+    1262:	74 13                	je     1277 <compile+0x35>
+    1264:	a1 a8 87 00 00       	mov    0x87a8,%eax
+    1269:	85 c0                	test   %eax,%eax
+    126b:	75 0a                	jne    1277 <compile+0x35>
+    bad = MALFORMED;
+    126d:	c7 05 a8 87 00 00 ff 	movl   $0xffffffff,0x87a8
+    1274:	ff ff ff 
+  if(bad)
+    1277:	a1 a8 87 00 00       	mov    0x87a8,%eax
+    127c:	85 c0                	test   %eax,%eax
+    127e:	74 07                	je     1287 <compile+0x45>
+    return bad;
+    1280:	a1 a8 87 00 00       	mov    0x87a8,%eax
+    1285:	eb 58                	jmp    12df <compile+0x9d>
+  gen(n);
+    1287:	83 ec 0c             	sub    $0xc,%esp
+    128a:	ff 75 f4             	push   -0xc(%ebp)
+    128d:	e8 38 fc ff ff       	call   eca <gen>
+    1292:	83 c4 10             	add    $0x10,%esp
+  emit(IMATCH, 0);
+    1295:	83 ec 08             	sub    $0x8,%esp
+    1298:	6a 00                	push   $0x0
+    129a:	6a 07                	push   $0x7
+    129c:	e8 9f fb ff ff       	call   e40 <emit>
+    12a1:	83 c4 10             	add    $0x10,%esp
+  if(bad)
+    12a4:	a1 a8 87 00 00       	mov    0x87a8,%eax
+    12a9:	85 c0                	test   %eax,%eax
+    12ab:	74 07                	je     12b4 <compile+0x72>
+    return bad;
+    12ad:	a1 a8 87 00 00       	mov    0x87a8,%eax
+    12b2:	eb 2b                	jmp    12df <compile+0x9d>
+  literal = 1;
+    12b4:	c7 05 e4 87 00 00 01 	movl   $0x1,0x87e4
+    12bb:	00 00 00 
+  if(!prefix(n))
+    12be:	83 ec 0c             	sub    $0xc,%esp
+    12c1:	ff 75 f4             	push   -0xc(%ebp)
+    12c4:	e8 dd fe ff ff       	call   11a6 <prefix>
+    12c9:	83 c4 10             	add    $0x10,%esp
+    12cc:	85 c0                	test   %eax,%eax
+    12ce:	75 0a                	jne    12da <compile+0x98>
+    literal = 0;
+    12d0:	c7 05 e4 87 00 00 00 	movl   $0x0,0x87e4
+    12d7:	00 00 00 
+  return bad;
+    12da:	a1 a8 87 00 00       	mov    0x87a8,%eax
+}
+    12df:	c9                   	leave
+    12e0:	c3                   	ret
+
+000012e1 <addthread>:
+
+// Add the thread at pc, following jumps, splits and anchors,
+// to l at text position i of n.  Return 1 if it reaches IMATCH.
+static int
+addthread(int *l, int *nl, int pc, int i, int n)
+{
+    12e1:	55                   	push   %ebp
+    12e2:	89 e5                	mov    %esp,%ebp
+    12e4:	83 ec 10             	sub    $0x10,%esp
+  int sp;
+  struct inst *ip;
+
+  sp = 0;
+    12e7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  stack[sp++] = pc;
+    12ee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    12f1:	8d 50 01             	lea    0x1(%eax),%edx
+    12f4:	89 55 fc             	mov    %edx,-0x4(%ebp)
+    12f7:	8b 55 10             	mov    0x10(%ebp),%edx
+    12fa:	89 14 85 20 a0 00 00 	mov    %edx,0xa020(,%eax,4)
+  while(sp > 0){
+    1301:	e9 15 01 00 00       	jmp    141b <addthread+0x13a>
+    pc = stack[--sp];
+    1306:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+    130a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    130d:	8b 04 85 20 a0 00 00 	mov    0xa020(,%eax,4),%eax
+    1314:	89 45 10             	mov    %eax,0x10(%ebp)
+    if(mark[pc] == step)
+    1317:	8b 45 10             	mov    0x10(%ebp),%eax
+    131a:	8b 14 85 00 98 00 00 	mov    0x9800(,%eax,4),%edx
+    1321:	a1 00 a0 00 00       	mov    0xa000,%eax
+    1326:	39 c2                	cmp    %eax,%edx
+    1328:	0f 84 e6 00 00 00    	je     1414 <addthread+0x133>
+      continue;
+    mark[pc] = step;
+    132e:	8b 15 00 a0 00 00    	mov    0xa000,%edx
+    1334:	8b 45 10             	mov    0x10(%ebp),%eax
+    1337:	89 14 85 00 98 00 00 	mov    %edx,0x9800(,%eax,4)
+    ip = &prog[pc];
+    133e:	8b 45 10             	mov    0x10(%ebp),%eax
+    1341:	c1 e0 04             	shl    $0x4,%eax
+    1344:	05 a0 67 00 00       	add    $0x67a0,%eax
+    1349:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    switch(ip->op){
+    134c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    134f:	8b 00                	mov    (%eax),%eax
+    1351:	83 e8 03             	sub    $0x3,%eax
+    1354:	83 f8 04             	cmp    $0x4,%eax
+    1357:	0f 87 97 00 00 00    	ja     13f4 <addthread+0x113>
+    135d:	8b 04 85 f0 1f 00 00 	mov    0x1ff0(,%eax,4),%eax
+    1364:	ff e0                	jmp    *%eax
+    case IJMP:
+      stack[sp++] = ip->x;
+    1366:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1369:	8d 50 01             	lea    0x1(%eax),%edx
+    136c:	89 55 fc             	mov    %edx,-0x4(%ebp)
+    136f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    1372:	8b 52 08             	mov    0x8(%edx),%edx
+    1375:	89 14 85 20 a0 00 00 	mov    %edx,0xa020(,%eax,4)
+      break;
+    137c:	e9 9a 00 00 00       	jmp    141b <addthread+0x13a>
+    case ISPLIT:
+      stack[sp++] = ip->y;
+    1381:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1384:	8d 50 01             	lea    0x1(%eax),%edx
+    1387:	89 55 fc             	mov    %edx,-0x4(%ebp)
+    138a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    138d:	8b 52 0c             	mov    0xc(%edx),%edx
+    1390:	89 14 85 20 a0 00 00 	mov    %edx,0xa020(,%eax,4)
+      stack[sp++] = ip->x;
+    1397:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    139a:	8d 50 01             	lea    0x1(%eax),%edx
+    139d:	89 55 fc             	mov    %edx,-0x4(%ebp)
+    13a0:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    13a3:	8b 52 08             	mov    0x8(%edx),%edx
+    13a6:	89 14 85 20 a0 00 00 	mov    %edx,0xa020(,%eax,4)
+      break;
+    13ad:	eb 6c                	jmp    141b <addthread+0x13a>
+    case IBOL:
+      if(i == 0)
+    13af:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    13b3:	75 62                	jne    1417 <addthread+0x136>
+        stack[sp++] = pc+1;
+    13b5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    13b8:	8d 50 01             	lea    0x1(%eax),%edx
+    13bb:	89 55 fc             	mov    %edx,-0x4(%ebp)
+    13be:	8b 55 10             	mov    0x10(%ebp),%edx
+    13c1:	83 c2 01             	add    $0x1,%edx
+    13c4:	89 14 85 20 a0 00 00 	mov    %edx,0xa020(,%eax,4)
+      break;
+    13cb:	eb 4a                	jmp    1417 <addthread+0x136>
+    case IEOL:
+      if(i == n)
+    13cd:	8b 45 14             	mov    0x14(%ebp),%eax
+    13d0:	3b 45 18             	cmp    0x18(%ebp),%eax
+    13d3:	75 45                	jne    141a <addthread+0x139>
+        stack[sp++] = pc+1;
+    13d5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    13d8:	8d 50 01             	lea    0x1(%eax),%edx
+    13db:	89 55 fc             	mov    %edx,-0x4(%ebp)
+    13de:	8b 55 10             	mov    0x10(%ebp),%edx
+    13e1:	83 c2 01             	add    $0x1,%edx
+    13e4:	89 14 85 20 a0 00 00 	mov    %edx,0xa020(,%eax,4)
+      break;
+    13eb:	eb 2d                	jmp    141a <addthread+0x139>
+    case IMATCH:
+      return 1;
+    13ed:	b8 01 00 00 00       	mov    $0x1,%eax
+    13f2:	eb 36                	jmp    142a <addthread+0x149>
+    default:
+      l[(*nl)++] = pc;
+    13f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    13f7:	8b 00                	mov    (%eax),%eax
+    13f9:	8d 48 01             	lea    0x1(%eax),%ecx
+    13fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+    13ff:	89 0a                	mov    %ecx,(%edx)
+    1401:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    1408:	8b 45 08             	mov    0x8(%ebp),%eax
+    140b:	01 c2                	add    %eax,%edx
+    140d:	8b 45 10             	mov    0x10(%ebp),%eax
+    1410:	89 02                	mov    %eax,(%edx)
+    1412:	eb 07                	jmp    141b <addthread+0x13a>
+      continue;
+    1414:	90                   	nop
+    1415:	eb 04                	jmp    141b <addthread+0x13a>
+      break;
+    1417:	90                   	nop
+    1418:	eb 01                	jmp    141b <addthread+0x13a>
+      break;
+    141a:	90                   	nop
+  while(sp > 0){
+    141b:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+    141f:	0f 8f e1 fe ff ff    	jg     1306 <addthread+0x25>
+    }
+  }
+  return 0;
+    1425:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    142a:	c9                   	leave
+    142b:	c3                   	ret
+
+0000142c <findpre>:
+
+// Position of the literal prefix in s[i..n), or -1.
+static int
+findpre(char *s, int i, int n)
+{
+    142c:	55                   	push   %ebp
+    142d:	89 e5                	mov    %esp,%ebp
+    142f:	83 ec 10             	sub    $0x10,%esp
+  char *p, *e;
+  int j;
+
+  e = s + n - npre + 1;
+    1432:	8b 45 10             	mov    0x10(%ebp),%eax
+    1435:	8b 15 e0 87 00 00    	mov    0x87e0,%edx
+    143b:	29 d0                	sub    %edx,%eax
+    143d:	8d 50 01             	lea    0x1(%eax),%edx
+    1440:	8b 45 08             	mov    0x8(%ebp),%eax
+    1443:	01 d0                	add    %edx,%eax
+    1445:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(p = s + i; p < e && (p = scanc(p, e, pre[0])) != 0; p++){
+    1448:	8b 55 0c             	mov    0xc(%ebp),%edx
+    144b:	8b 45 08             	mov    0x8(%ebp),%eax
+    144e:	01 d0                	add    %edx,%eax
+    1450:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1453:	eb 47                	jmp    149c <findpre+0x70>
+    for(j = 1; j < npre && p[j] == pre[j]; j++)
+    1455:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%ebp)
+    145c:	eb 04                	jmp    1462 <findpre+0x36>
+    145e:	83 45 f8 01          	addl   $0x1,-0x8(%ebp)
+    1462:	a1 e0 87 00 00       	mov    0x87e0,%eax
+    1467:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    146a:	7d 1a                	jge    1486 <findpre+0x5a>
+    146c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    146f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1472:	01 d0                	add    %edx,%eax
+    1474:	0f b6 10             	movzbl (%eax),%edx
+    1477:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    147a:	05 c0 87 00 00       	add    $0x87c0,%eax
+    147f:	0f b6 00             	movzbl (%eax),%eax
+    1482:	38 c2                	cmp    %al,%dl
+    1484:	74 d8                	je     145e <findpre+0x32>
+      ;
+    if(j == npre)
+    1486:	a1 e0 87 00 00       	mov    0x87e0,%eax
+    148b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    148e:	75 08                	jne    1498 <findpre+0x6c>
+      return p - s;
+    1490:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1493:	2b 45 08             	sub    0x8(%ebp),%eax
+    1496:	eb 33                	jmp    14cb <findpre+0x9f>
+  for(p = s + i; p < e && (p = scanc(p, e, pre[0])) != 0; p++){
+    1498:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    149c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    149f:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    14a2:	73 22                	jae    14c6 <findpre+0x9a>
+    14a4:	0f b6 05 c0 87 00 00 	movzbl 0x87c0,%eax
+    14ab:	0f be c0             	movsbl %al,%eax
+    14ae:	50                   	push   %eax
+    14af:	ff 75 f4             	push   -0xc(%ebp)
+    14b2:	ff 75 fc             	push   -0x4(%ebp)
+    14b5:	e8 34 f3 ff ff       	call   7ee <scanc>
+    14ba:	83 c4 0c             	add    $0xc,%esp
+    14bd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    14c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+    14c4:	75 8f                	jne    1455 <findpre+0x29>
+  }
+  return -1;
+    14c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    14cb:	c9                   	leave
+    14cc:	c3                   	ret
+
+000014cd <match>:
+
+// Does the pattern match anywhere in the n bytes at s?
+int
+match(char *s, int n)
+{
+    14cd:	55                   	push   %ebp
+    14ce:	89 e5                	mov    %esp,%ebp
+    14d0:	83 ec 30             	sub    $0x30,%esp
+  int *clist, *nlist, *t, ncl, nnl, i, j, c;
+  struct inst *ip;
+
+  if(npre > 0 && findpre(s, 0, n) < 0)
+    14d3:	a1 e0 87 00 00       	mov    0x87e0,%eax
+    14d8:	85 c0                	test   %eax,%eax
+    14da:	7e 1e                	jle    14fa <match+0x2d>
+    14dc:	ff 75 0c             	push   0xc(%ebp)
+    14df:	6a 00                	push   $0x0
+    14e1:	ff 75 08             	push   0x8(%ebp)
+    14e4:	e8 43 ff ff ff       	call   142c <findpre>
+    14e9:	83 c4 0c             	add    $0xc,%esp
+    14ec:	85 c0                	test   %eax,%eax
+    14ee:	79 0a                	jns    14fa <match+0x2d>
+    return 0;
+    14f0:	b8 00 00 00 00       	mov    $0x0,%eax
+    14f5:	e9 d2 01 00 00       	jmp    16cc <match+0x1ff>
+  if(literal)
+    14fa:	a1 e4 87 00 00       	mov    0x87e4,%eax
+    14ff:	85 c0                	test   %eax,%eax
+    1501:	74 0a                	je     150d <match+0x40>
+    return 1;
+    1503:	b8 01 00 00 00       	mov    $0x1,%eax
+    1508:	e9 bf 01 00 00       	jmp    16cc <match+0x1ff>
+
+  clist = list0;
+    150d:	c7 45 fc 00 88 00 00 	movl   $0x8800,-0x4(%ebp)
+  nlist = list1;
+    1514:	c7 45 f8 00 90 00 00 	movl   $0x9000,-0x8(%ebp)
+  ncl = 0;
+    151b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  step++;
+    1522:	a1 00 a0 00 00       	mov    0xa000,%eax
+    1527:	83 c0 01             	add    $0x1,%eax
+    152a:	a3 00 a0 00 00       	mov    %eax,0xa000
+  for(i = 0; ; i++){
+    152f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(ncl == 0 && npre > 0){
+    1536:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1539:	85 c0                	test   %eax,%eax
+    153b:	75 3a                	jne    1577 <match+0xaa>
+    153d:	a1 e0 87 00 00       	mov    0x87e0,%eax
+    1542:	85 c0                	test   %eax,%eax
+    1544:	7e 31                	jle    1577 <match+0xaa>
+      // No thread alive: skip to where a match could start.
+      if((i = findpre(s, i, n)) < 0)
+    1546:	ff 75 0c             	push   0xc(%ebp)
+    1549:	ff 75 f4             	push   -0xc(%ebp)
+    154c:	ff 75 08             	push   0x8(%ebp)
+    154f:	e8 d8 fe ff ff       	call   142c <findpre>
+    1554:	83 c4 0c             	add    $0xc,%esp
+    1557:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    155a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    155e:	79 0a                	jns    156a <match+0x9d>
+        return 0;
+    1560:	b8 00 00 00 00       	mov    $0x0,%eax
+    1565:	e9 62 01 00 00       	jmp    16cc <match+0x1ff>
+      step++;
+    156a:	a1 00 a0 00 00       	mov    0xa000,%eax
+    156f:	83 c0 01             	add    $0x1,%eax
+    1572:	a3 00 a0 00 00       	mov    %eax,0xa000
+    }
+    // Unanchored search: start a new thread at every position.
+    if(addthread(clist, &ncl, 0, i, n))
+    1577:	ff 75 0c             	push   0xc(%ebp)
+    157a:	ff 75 f4             	push   -0xc(%ebp)
+    157d:	6a 00                	push   $0x0
+    157f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1582:	50                   	push   %eax
+    1583:	ff 75 fc             	push   -0x4(%ebp)
+    1586:	e8 56 fd ff ff       	call   12e1 <addthread>
+    158b:	83 c4 14             	add    $0x14,%esp
+    158e:	85 c0                	test   %eax,%eax
+    1590:	74 0a                	je     159c <match+0xcf>
+      return 1;
+    1592:	b8 01 00 00 00       	mov    $0x1,%eax
+    1597:	e9 30 01 00 00       	jmp    16cc <match+0x1ff>
+    if(i == n)
+    159c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    159f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    15a2:	75 0a                	jne    15ae <match+0xe1>
+      return 0;
+    15a4:	b8 00 00 00 00       	mov    $0x0,%eax
+    15a9:	e9 1e 01 00 00       	jmp    16cc <match+0x1ff>
+
+    step++;
+    15ae:	a1 00 a0 00 00       	mov    0xa000,%eax
+    15b3:	83 c0 01             	add    $0x1,%eax
+    15b6:	a3 00 a0 00 00       	mov    %eax,0xa000
+    nnl = 0;
+    15bb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+    c = (uchar)s[i];
+    15c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    15c5:	8b 45 08             	mov    0x8(%ebp),%eax
+    15c8:	01 d0                	add    %edx,%eax
+    15ca:	0f b6 00             	movzbl (%eax),%eax
+    15cd:	0f b6 c0             	movzbl %al,%eax
+    15d0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    for(j = 0; j < ncl; j++){
+    15d3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    15da:	e9 c0 00 00 00       	jmp    169f <match+0x1d2>
+      ip = &prog[clist[j]];
+    15df:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15e2:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    15e9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    15ec:	01 d0                	add    %edx,%eax
+    15ee:	8b 00                	mov    (%eax),%eax
+    15f0:	c1 e0 04             	shl    $0x4,%eax
+    15f3:	05 a0 67 00 00       	add    $0x67a0,%eax
+    15f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      switch(ip->op){
+    15fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    15fe:	8b 00                	mov    (%eax),%eax
+    1600:	83 f8 02             	cmp    $0x2,%eax
+    1603:	74 1e                	je     1623 <match+0x156>
+    1605:	83 f8 02             	cmp    $0x2,%eax
+    1608:	7f 57                	jg     1661 <match+0x194>
+    160a:	85 c0                	test   %eax,%eax
+    160c:	74 05                	je     1613 <match+0x146>
+    160e:	83 f8 01             	cmp    $0x1,%eax
+      case ICHAR:
+        if(c != (uchar)ip->c)
+          continue;
+        break;
+      case IANY:
+        break;
+    1611:	eb 4e                	jmp    1661 <match+0x194>
+        if(c != (uchar)ip->c)
+    1613:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1616:	8b 40 04             	mov    0x4(%eax),%eax
+    1619:	0f b6 c0             	movzbl %al,%eax
+    161c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    161f:	74 3f                	je     1660 <match+0x193>
+          continue;
+    1621:	eb 78                	jmp    169b <match+0x1ce>
+      case ICLASS:
+        if(!(cls[ip->c][c/8] & (1 << (c%8))))
+    1623:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1626:	8b 50 04             	mov    0x4(%eax),%edx
+    1629:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    162c:	8d 48 07             	lea    0x7(%eax),%ecx
+    162f:	85 c0                	test   %eax,%eax
+    1631:	0f 48 c1             	cmovs  %ecx,%eax
+    1634:	c1 f8 03             	sar    $0x3,%eax
+    1637:	89 c1                	mov    %eax,%ecx
+    1639:	89 d0                	mov    %edx,%eax
+    163b:	c1 e0 05             	shl    $0x5,%eax
+    163e:	01 c8                	add    %ecx,%eax
+    1640:	05 80 65 00 00       	add    $0x6580,%eax
+    1645:	0f b6 00             	movzbl (%eax),%eax
+    1648:	0f b6 d0             	movzbl %al,%edx
+    164b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    164e:	83 e0 07             	and    $0x7,%eax
+    1651:	89 c1                	mov    %eax,%ecx
+    1653:	d3 fa                	sar    %cl,%edx
+    1655:	89 d0                	mov    %edx,%eax
+    1657:	83 e0 01             	and    $0x1,%eax
+    165a:	85 c0                	test   %eax,%eax
+    165c:	74 3c                	je     169a <match+0x1cd>
+          continue;
+        break;
+    165e:	eb 01                	jmp    1661 <match+0x194>
+        break;
+    1660:	90                   	nop
+      }
+      if(addthread(nlist, &nnl, clist[j]+1, i+1, n))
+    1661:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1664:	8d 50 01             	lea    0x1(%eax),%edx
+    1667:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    166a:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+    1671:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1674:	01 c8                	add    %ecx,%eax
+    1676:	8b 00                	mov    (%eax),%eax
+    1678:	83 c0 01             	add    $0x1,%eax
+    167b:	ff 75 0c             	push   0xc(%ebp)
+    167e:	52                   	push   %edx
+    167f:	50                   	push   %eax
+    1680:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    1683:	50                   	push   %eax
+    1684:	ff 75 f8             	push   -0x8(%ebp)
+    1687:	e8 55 fc ff ff       	call   12e1 <addthread>
+    168c:	83 c4 14             	add    $0x14,%esp
+    168f:	85 c0                	test   %eax,%eax
+    1691:	74 08                	je     169b <match+0x1ce>
+        return 1;
+    1693:	b8 01 00 00 00       	mov    $0x1,%eax
+    1698:	eb 32                	jmp    16cc <match+0x1ff>
+          continue;
+    169a:	90                   	nop
+    for(j = 0; j < ncl; j++){
+    169b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    169f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    16a2:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    16a5:	0f 8c 34 ff ff ff    	jl     15df <match+0x112>
+    }
+    t = clist;
+    16ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    16ae:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    clist = nlist;
+    16b1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    16b4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    nlist = t;
+    16b7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    16ba:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    ncl = nnl;
+    16bd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    16c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; ; i++){
+    16c3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(ncl == 0 && npre > 0){
+    16c7:	e9 6a fe ff ff       	jmp    1536 <match+0x69>
+  }
+}
+    16cc:	c9                   	leave
+    16cd:	c3                   	ret
+
+000016ce <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+    16ce:	55                   	push   %ebp
+    16cf:	89 e5                	mov    %esp,%ebp
+    16d1:	57                   	push   %edi
+    16d2:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+    16d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    16d6:	8b 55 10             	mov    0x10(%ebp),%edx
+    16d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    16dc:	89 cb                	mov    %ecx,%ebx
+    16de:	89 df                	mov    %ebx,%edi
+    16e0:	89 d1                	mov    %edx,%ecx
+    16e2:	fc                   	cld
+    16e3:	f3 aa                	rep stos %al,%es:(%edi)
+    16e5:	89 ca                	mov    %ecx,%edx
+    16e7:	89 fb                	mov    %edi,%ebx
+    16e9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    16ec:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    16ef:	90                   	nop
+    16f0:	5b                   	pop    %ebx
+    16f1:	5f                   	pop    %edi
+    16f2:	5d                   	pop    %ebp
+    16f3:	c3                   	ret
+
+000016f4 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    16f4:	55                   	push   %ebp
+    16f5:	89 e5                	mov    %esp,%ebp
+    16f7:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+    16fa:	8b 45 08             	mov    0x8(%ebp),%eax
+    16fd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    1700:	90                   	nop
+    1701:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1704:	8d 42 01             	lea    0x1(%edx),%eax
+    1707:	89 45 0c             	mov    %eax,0xc(%ebp)
+    170a:	8b 45 08             	mov    0x8(%ebp),%eax
+    170d:	8d 48 01             	lea    0x1(%eax),%ecx
+    1710:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    1713:	0f b6 12             	movzbl (%edx),%edx
+    1716:	88 10                	mov    %dl,(%eax)
+    1718:	0f b6 00             	movzbl (%eax),%eax
+    171b:	84 c0                	test   %al,%al
+    171d:	75 e2                	jne    1701 <strcpy+0xd>
+    ;
+  return os;
+    171f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    1722:	c9                   	leave
+    1723:	c3                   	ret
+
+00001724 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    1724:	55                   	push   %ebp
+    1725:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    1727:	eb 08                	jmp    1731 <strcmp+0xd>
+    p++, q++;
+    1729:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    172d:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    1731:	8b 45 08             	mov    0x8(%ebp),%eax
+    1734:	0f b6 00             	movzbl (%eax),%eax
+    1737:	84 c0                	test   %al,%al
+    1739:	74 10                	je     174b <strcmp+0x27>
+    173b:	8b 45 08             	mov    0x8(%ebp),%eax
+    173e:	0f b6 10             	movzbl (%eax),%edx
+    1741:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1744:	0f b6 00             	movzbl (%eax),%eax
+    1747:	38 c2                	cmp    %al,%dl
+    1749:	74 de                	je     1729 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    174b:	8b 45 08             	mov    0x8(%ebp),%eax
+    174e:	0f b6 00             	movzbl (%eax),%eax
+    1751:	0f b6 d0             	movzbl %al,%edx
+    1754:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1757:	0f b6 00             	movzbl (%eax),%eax
+    175a:	0f b6 c0             	movzbl %al,%eax
+    175d:	29 c2                	sub    %eax,%edx
+    175f:	89 d0                	mov    %edx,%eax
+}
+    1761:	5d                   	pop    %ebp
+    1762:	c3                   	ret
+
+00001763 <strlen>:
+
+uint
+strlen(char *s)
+{
+    1763:	55                   	push   %ebp
+    1764:	89 e5                	mov    %esp,%ebp
+    1766:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+    1769:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    1770:	eb 04                	jmp    1776 <strlen+0x13>
+    1772:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1776:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    1779:	8b 45 08             	mov    0x8(%ebp),%eax
+    177c:	01 d0                	add    %edx,%eax
+    177e:	0f b6 00             	movzbl (%eax),%eax
+    1781:	84 c0                	test   %al,%al
+    1783:	75 ed                	jne    1772 <strlen+0xf>
+    ;
+  return n;
+    1785:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    1788:	c9                   	leave
+    1789:	c3                   	ret
+
+0000178a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    178a:	55                   	push   %ebp
+    178b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    178d:	8b 45 10             	mov    0x10(%ebp),%eax
+    1790:	50                   	push   %eax
+    1791:	ff 75 0c             	push   0xc(%ebp)
+    1794:	ff 75 08             	push   0x8(%ebp)
+    1797:	e8 32 ff ff ff       	call   16ce <stosb>
+    179c:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    179f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    17a2:	c9                   	leave
+    17a3:	c3                   	ret
+
+000017a4 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    17a4:	55                   	push   %ebp
+    17a5:	89 e5                	mov    %esp,%ebp
+    17a7:	83 ec 04             	sub    $0x4,%esp
+    17aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+    17ad:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    17b0:	eb 14                	jmp    17c6 <strchr+0x22>
+    if(*s == c)
+    17b2:	8b 45 08             	mov    0x8(%ebp),%eax
+    17b5:	0f b6 00             	movzbl (%eax),%eax
+    17b8:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    17bb:	75 05                	jne    17c2 <strchr+0x1e>
+      return (char*)s;
+    17bd:	8b 45 08             	mov    0x8(%ebp),%eax
+    17c0:	eb 13                	jmp    17d5 <strchr+0x31>
+  for(; *s; s++)
+    17c2:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    17c6:	8b 45 08             	mov    0x8(%ebp),%eax
+    17c9:	0f b6 00             	movzbl (%eax),%eax
+    17cc:	84 c0                	test   %al,%al
+    17ce:	75 e2                	jne    17b2 <strchr+0xe>
+  return 0;
+    17d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    17d5:	c9                   	leave
+    17d6:	c3                   	ret
+
+000017d7 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    17d7:	55                   	push   %ebp
+    17d8:	89 e5                	mov    %esp,%ebp
+    17da:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    17dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    17e4:	eb 42                	jmp    1828 <gets+0x51>
+    cc = read(0, &c, 1);
+    17e6:	83 ec 04             	sub    $0x4,%esp
+    17e9:	6a 01                	push   $0x1
+    17eb:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    17ee:	50                   	push   %eax
+    17ef:	6a 00                	push   $0x0
+    17f1:	e8 85 01 00 00       	call   197b <read>
+    17f6:	83 c4 10             	add    $0x10,%esp
+    17f9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    17fc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1800:	7e 33                	jle    1835 <gets+0x5e>
+      break;
+    buf[i++] = c;
+    1802:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1805:	8d 50 01             	lea    0x1(%eax),%edx
+    1808:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    180b:	89 c2                	mov    %eax,%edx
+    180d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1810:	01 c2                	add    %eax,%edx
+    1812:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1816:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    1818:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    181c:	3c 0a                	cmp    $0xa,%al
+    181e:	74 16                	je     1836 <gets+0x5f>
+    1820:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1824:	3c 0d                	cmp    $0xd,%al
+    1826:	74 0e                	je     1836 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    1828:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    182b:	83 c0 01             	add    $0x1,%eax
+    182e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    1831:	7f b3                	jg     17e6 <gets+0xf>
+    1833:	eb 01                	jmp    1836 <gets+0x5f>
+      break;
+    1835:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    1836:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1839:	8b 45 08             	mov    0x8(%ebp),%eax
+    183c:	01 d0                	add    %edx,%eax
+    183e:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    1841:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1844:	c9                   	leave
+    1845:	c3                   	ret
+
+00001846 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    1846:	55                   	push   %ebp
+    1847:	89 e5                	mov    %esp,%ebp
+    1849:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    184c:	83 ec 08             	sub    $0x8,%esp
+    184f:	6a 00                	push   $0x0
+    1851:	ff 75 08             	push   0x8(%ebp)
+    1854:	e8 4a 01 00 00       	call   19a3 <open>
+    1859:	83 c4 10             	add    $0x10,%esp
+    185c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    185f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1863:	79 07                	jns    186c <stat+0x26>
+    return -1;
+    1865:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    186a:	eb 25                	jmp    1891 <stat+0x4b>
+  r = fstat(fd, st);
+    186c:	83 ec 08             	sub    $0x8,%esp
+    186f:	ff 75 0c             	push   0xc(%ebp)
+    1872:	ff 75 f4             	push   -0xc(%ebp)
+    1875:	e8 41 01 00 00       	call   19bb <fstat>
+    187a:	83 c4 10             	add    $0x10,%esp
+    187d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    1880:	83 ec 0c             	sub    $0xc,%esp
+    1883:	ff 75 f4             	push   -0xc(%ebp)
+    1886:	e8 00 01 00 00       	call   198b <close>
+    188b:	83 c4 10             	add    $0x10,%esp
+  return r;
+    188e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1891:	c9                   	leave
+    1892:	c3                   	ret
+
+00001893 <atoi>:
+
+int
+atoi(const char *s)
+{
+    1893:	55                   	push   %ebp
+    1894:	89 e5                	mov    %esp,%ebp
+    1896:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    1899:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    18a0:	eb 25                	jmp    18c7 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    18a2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    18a5:	89 d0                	mov    %edx,%eax
+    18a7:	c1 e0 02             	shl    $0x2,%eax
+    18aa:	01 d0                	add    %edx,%eax
+    18ac:	01 c0                	add    %eax,%eax
+    18ae:	89 c1                	mov    %eax,%ecx
+    18b0:	8b 45 08             	mov    0x8(%ebp),%eax
+    18b3:	8d 50 01             	lea    0x1(%eax),%edx
+    18b6:	89 55 08             	mov    %edx,0x8(%ebp)
+    18b9:	0f b6 00             	movzbl (%eax),%eax
+    18bc:	0f be c0             	movsbl %al,%eax
+    18bf:	01 c8                	add    %ecx,%eax
+    18c1:	83 e8 30             	sub    $0x30,%eax
+    18c4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    18c7:	8b 45 08             	mov    0x8(%ebp),%eax
+    18ca:	0f b6 00             	movzbl (%eax),%eax
+    18cd:	3c 2f                	cmp    $0x2f,%al
+    18cf:	7e 0a                	jle    18db <atoi+0x48>
+    18d1:	8b 45 08             	mov    0x8(%ebp),%eax
+    18d4:	0f b6 00             	movzbl (%eax),%eax
+    18d7:	3c 39                	cmp    $0x39,%al
+    18d9:	7e c7                	jle    18a2 <atoi+0xf>
+  return n;
+    18db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    18de:	c9                   	leave
+    18df:	c3                   	ret
+
+000018e0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    18e0:	55                   	push   %ebp
+    18e1:	89 e5                	mov    %esp,%ebp
+    18e3:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+    18e6:	8b 45 08             	mov    0x8(%ebp),%eax
+    18e9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    18ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+    18ef:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    18f2:	eb 17                	jmp    190b <memmove+0x2b>
+    *dst++ = *src++;
+    18f4:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    18f7:	8d 42 01             	lea    0x1(%edx),%eax
+    18fa:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    18fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1900:	8d 48 01             	lea    0x1(%eax),%ecx
+    1903:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    1906:	0f b6 12             	movzbl (%edx),%edx
+    1909:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    190b:	8b 45 10             	mov    0x10(%ebp),%eax
+    190e:	8d 50 ff             	lea    -0x1(%eax),%edx
+    1911:	89 55 10             	mov    %edx,0x10(%ebp)
+    1914:	85 c0                	test   %eax,%eax
+    1916:	7f dc                	jg     18f4 <memmove+0x14>
+  return vdst;
+    1918:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    191b:	c9                   	leave
+    191c:	c3                   	ret
+
+0000191d <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+    191d:	55                   	push   %ebp
+    191e:	89 e5                	mov    %esp,%ebp
+    1920:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+    1923:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    192a:	eb 04                	jmp    1930 <ncpus+0x13>
+    192c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1930:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+    1934:	7f 16                	jg     194c <ncpus+0x2f>
+    1936:	83 ec 08             	sub    $0x8,%esp
+    1939:	8d 45 8c             	lea    -0x74(%ebp),%eax
+    193c:	50                   	push   %eax
+    193d:	ff 75 f4             	push   -0xc(%ebp)
+    1940:	e8 d6 00 00 00       	call   1a1b <intrstat>
+    1945:	83 c4 10             	add    $0x10,%esp
+    1948:	85 c0                	test   %eax,%eax
+    194a:	74 e0                	je     192c <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+    194c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    194f:	ba 01 00 00 00       	mov    $0x1,%edx
+    1954:	85 c0                	test   %eax,%eax
+    1956:	0f 4e c2             	cmovle %edx,%eax
+}
+    1959:	c9                   	leave
+    195a:	c3                   	ret
+
+0000195b <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+    195b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1960:	cd 40                	int    $0x40
+    1962:	c3                   	ret
+
+00001963 <exit>:
+SYSCALL(exit)
+    1963:	b8 02 00 00 00       	mov    $0x2,%eax
+    1968:	cd 40                	int    $0x40
+    196a:	c3                   	ret
+
+0000196b <wait>:
+SYSCALL(wait)
+    196b:	b8 03 00 00 00       	mov    $0x3,%eax
+    1970:	cd 40                	int    $0x40
+    1972:	c3                   	ret
+
+00001973 <pipe>:
+SYSCALL(pipe)
+    1973:	b8 04 00 00 00       	mov    $0x4,%eax
+    1978:	cd 40                	int    $0x40
+    197a:	c3                   	ret
+
+0000197b <read>:
+SYSCALL(read)
+    197b:	b8 05 00 00 00       	mov    $0x5,%eax
+    1980:	cd 40                	int    $0x40
+    1982:	c3                   	ret
+
+00001983 <write>:
+SYSCALL(write)
+    1983:	b8 10 00 00 00       	mov    $0x10,%eax
+    1988:	cd 40                	int    $0x40
+    198a:	c3                   	ret
+
+0000198b <close>:
+SYSCALL(close)
+    198b:	b8 15 00 00 00       	mov    $0x15,%eax
+    1990:	cd 40                	int    $0x40
+    1992:	c3                   	ret
+
+00001993 <kill>:
+SYSCALL(kill)
+    1993:	b8 06 00 00 00       	mov    $0x6,%eax
+    1998:	cd 40                	int    $0x40
+    199a:	c3                   	ret
+
+0000199b <exec>:
+SYSCALL(exec)
+    199b:	b8 07 00 00 00       	mov    $0x7,%eax
+    19a0:	cd 40                	int    $0x40
+    19a2:	c3                   	ret
+
+000019a3 <open>:
+SYSCALL(open)
+    19a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    19a8:	cd 40                	int    $0x40
+    19aa:	c3                   	ret
+
+000019ab <mknod>:
+SYSCALL(mknod)
+    19ab:	b8 11 00 00 00       	mov    $0x11,%eax
+    19b0:	cd 40                	int    $0x40
+    19b2:	c3                   	ret
+
+000019b3 <unlink>:
+SYSCALL(unlink)
+    19b3:	b8 12 00 00 00       	mov    $0x12,%eax
+    19b8:	cd 40                	int    $0x40
+    19ba:	c3                   	ret
+
+000019bb <fstat>:
+SYSCALL(fstat)
+    19bb:	b8 08 00 00 00       	mov    $0x8,%eax
+    19c0:	cd 40                	int    $0x40
+    19c2:	c3                   	ret
+
+000019c3 <link>:
+SYSCALL(link)
+    19c3:	b8 13 00 00 00       	mov    $0x13,%eax
+    19c8:	cd 40                	int    $0x40
+    19ca:	c3                   	ret
+
+000019cb <mkdir>:
+SYSCALL(mkdir)
+    19cb:	b8 14 00 00 00       	mov    $0x14,%eax
+    19d0:	cd 40                	int    $0x40
+    19d2:	c3                   	ret
+
+000019d3 <chdir>:
+SYSCALL(chdir)
+    19d3:	b8 09 00 00 00       	mov    $0x9,%eax
+    19d8:	cd 40                	int    $0x40
+    19da:	c3                   	ret
+
+000019db <dup>:
+SYSCALL(dup)
+    19db:	b8 0a 00 00 00       	mov    $0xa,%eax
+    19e0:	cd 40                	int    $0x40
+    19e2:	c3                   	ret
+
+000019e3 <getpid>:
+SYSCALL(getpid)
+    19e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    19e8:	cd 40                	int    $0x40
+    19ea:	c3                   	ret
+
+000019eb <sbrk>:
+SYSCALL(sbrk)
+    19eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    19f0:	cd 40                	int    $0x40
+    19f2:	c3                   	ret
+
+000019f3 <sleep>:
+SYSCALL(sleep)
+    19f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    19f8:	cd 40                	int    $0x40
+    19fa:	c3                   	ret
+
+000019fb <uptime>:
+SYSCALL(uptime)
+    19fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1a00:	cd 40                	int    $0x40
+    1a02:	c3                   	ret
+
+00001a03 <poll>:
+SYSCALL(poll)
+    1a03:	b8 16 00 00 00       	mov    $0x16,%eax
+    1a08:	cd 40                	int    $0x40
+    1a0a:	c3                   	ret
+
+00001a0b <fcntl>:
+SYSCALL(fcntl)
+    1a0b:	b8 17 00 00 00       	mov    $0x17,%eax
+    1a10:	cd 40                	int    $0x40
+    1a12:	c3                   	ret
+
+00001a13 <irqroute>:
+SYSCALL(irqroute)
+    1a13:	b8 18 00 00 00       	mov    $0x18,%eax
+    1a18:	cd 40                	int    $0x40
+    1a1a:	c3                   	ret
+
+00001a1b <intrstat>:
+SYSCALL(intrstat)
+    1a1b:	b8 19 00 00 00       	mov    $0x19,%eax
+    1a20:	cd 40                	int    $0x40
+    1a22:	c3                   	ret
+
+00001a23 <pread>:
+SYSCALL(pread)
+    1a23:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1a28:	cd 40                	int    $0x40
+    1a2a:	c3                   	ret
+
+00001a2b <getdents>:
+SYSCALL(getdents)
+    1a2b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1a30:	cd 40                	int    $0x40
+    1a32:	c3                   	ret
+
+00001a33 <fstatat>:
+SYSCALL(fstatat)
+    1a33:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1a38:	cd 40                	int    $0x40
+    1a3a:	c3                   	ret
+
+00001a3b <openat>:
+SYSCALL(openat)
+    1a3b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1a40:	cd 40                	int    $0x40
+    1a42:	c3                   	ret
+
+00001a43 <unlinkat>:
+SYSCALL(unlinkat)
+    1a43:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1a48:	cd 40                	int    $0x40
+    1a4a:	c3                   	ret
+
+00001a4b <mkdirat>:
+SYSCALL(mkdirat)
+    1a4b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1a50:	cd 40                	int    $0x40
+    1a52:	c3                   	ret
+
+00001a53 <linkat>:
+SYSCALL(linkat)
+    1a53:	b8 20 00 00 00       	mov    $0x20,%eax
+    1a58:	cd 40                	int    $0x40
+    1a5a:	c3                   	ret
+
+00001a5b <exits>:
+SYSCALL(exits)
+    1a5b:	b8 21 00 00 00       	mov    $0x21,%eax
+    1a60:	cd 40                	int    $0x40
+    1a62:	c3                   	ret
+
+00001a63 <waitstatus>:
+SYSCALL(waitstatus)
+    1a63:	b8 22 00 00 00       	mov    $0x22,%eax
+    1a68:	cd 40                	int    $0x40
+    1a6a:	c3                   	ret
+
+00001a6b <pwrite>:
+SYSCALL(pwrite)
+    1a6b:	b8 23 00 00 00       	mov    $0x23,%eax
+    1a70:	cd 40                	int    $0x40
+    1a72:	c3                   	ret
+
+00001a73 <lseek>:
+SYSCALL(lseek)
+    1a73:	b8 24 00 00 00       	mov    $0x24,%eax
+    1a78:	cd 40                	int    $0x40
+    1a7a:	c3                   	ret
+
+00001a7b <copyfilerange>:
+SYSCALL(copyfilerange)
+    1a7b:	b8 25 00 00 00       	mov    $0x25,%eax
+    1a80:	cd 40                	int    $0x40
+    1a82:	c3                   	ret
+
+00001a83 <fsctl>:
+SYSCALL(fsctl)
+    1a83:	b8 26 00 00 00       	mov    $0x26,%eax
+    1a88:	cd 40                	int    $0x40
+    1a8a:	c3                   	ret
+
+00001a8b <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    1a8b:	55                   	push   %ebp
+    1a8c:	89 e5                	mov    %esp,%ebp
+    1a8e:	83 ec 18             	sub    $0x18,%esp
+    1a91:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1a94:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    1a97:	83 ec 04             	sub    $0x4,%esp
+    1a9a:	6a 01                	push   $0x1
+    1a9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1a9f:	50                   	push   %eax
+    1aa0:	ff 75 08             	push   0x8(%ebp)
+    1aa3:	e8 db fe ff ff       	call   1983 <write>
+    1aa8:	83 c4 10             	add    $0x10,%esp
+}
+    1aab:	90                   	nop
+    1aac:	c9                   	leave
+    1aad:	c3                   	ret
+
+00001aae <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    1aae:	55                   	push   %ebp
+    1aaf:	89 e5                	mov    %esp,%ebp
+    1ab1:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    1ab4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    1abb:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    1abf:	74 17                	je     1ad8 <printint+0x2a>
+    1ac1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    1ac5:	79 11                	jns    1ad8 <printint+0x2a>
+    neg = 1;
+    1ac7:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    1ace:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1ad1:	f7 d8                	neg    %eax
+    1ad3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1ad6:	eb 06                	jmp    1ade <printint+0x30>
+  } else {
+    x = xx;
+    1ad8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1adb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    1ade:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    1ae5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1ae8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1aeb:	ba 00 00 00 00       	mov    $0x0,%edx
+    1af0:	f7 f1                	div    %ecx
+    1af2:	89 d1                	mov    %edx,%ecx
+    1af4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1af7:	8d 50 01             	lea    0x1(%eax),%edx
+    1afa:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1afd:	0f b6 91 04 25 00 00 	movzbl 0x2504(%ecx),%edx
+    1b04:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    1b08:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1b0b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1b0e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1b13:	f7 f1                	div    %ecx
+    1b15:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1b18:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1b1c:	75 c7                	jne    1ae5 <printint+0x37>
+  if(neg)
+    1b1e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1b22:	74 2d                	je     1b51 <printint+0xa3>
+    buf[i++] = '-';
+    1b24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b27:	8d 50 01             	lea    0x1(%eax),%edx
+    1b2a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1b2d:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    1b32:	eb 1d                	jmp    1b51 <printint+0xa3>
+    putc(fd, buf[i]);
+    1b34:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    1b37:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b3a:	01 d0                	add    %edx,%eax
+    1b3c:	0f b6 00             	movzbl (%eax),%eax
+    1b3f:	0f be c0             	movsbl %al,%eax
+    1b42:	83 ec 08             	sub    $0x8,%esp
+    1b45:	50                   	push   %eax
+    1b46:	ff 75 08             	push   0x8(%ebp)
+    1b49:	e8 3d ff ff ff       	call   1a8b <putc>
+    1b4e:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    1b51:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    1b55:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1b59:	79 d9                	jns    1b34 <printint+0x86>
+}
+    1b5b:	90                   	nop
+    1b5c:	90                   	nop
+    1b5d:	c9                   	leave
+    1b5e:	c3                   	ret
+
+00001b5f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    1b5f:	55                   	push   %ebp
+    1b60:	89 e5                	mov    %esp,%ebp
+    1b62:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    1b65:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    1b6c:	8d 45 0c             	lea    0xc(%ebp),%eax
+    1b6f:	83 c0 04             	add    $0x4,%eax
+    1b72:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1b75:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1b7c:	e9 59 01 00 00       	jmp    1cda <printf+0x17b>
+    c = fmt[i] & 0xff;
+    1b81:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1b84:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1b87:	01 d0                	add    %edx,%eax
+    1b89:	0f b6 00             	movzbl (%eax),%eax
+    1b8c:	0f be c0             	movsbl %al,%eax
+    1b8f:	25 ff 00 00 00       	and    $0xff,%eax
+    1b94:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    1b97:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1b9b:	75 2c                	jne    1bc9 <printf+0x6a>
+      if(c == '%'){
+    1b9d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1ba1:	75 0c                	jne    1baf <printf+0x50>
+        state = '%';
+    1ba3:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    1baa:	e9 27 01 00 00       	jmp    1cd6 <printf+0x177>
+      } else {
+        putc(fd, c);
+    1baf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1bb2:	0f be c0             	movsbl %al,%eax
+    1bb5:	83 ec 08             	sub    $0x8,%esp
+    1bb8:	50                   	push   %eax
+    1bb9:	ff 75 08             	push   0x8(%ebp)
+    1bbc:	e8 ca fe ff ff       	call   1a8b <putc>
+    1bc1:	83 c4 10             	add    $0x10,%esp
+    1bc4:	e9 0d 01 00 00       	jmp    1cd6 <printf+0x177>
+      }
+    } else if(state == '%'){
+    1bc9:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    1bcd:	0f 85 03 01 00 00    	jne    1cd6 <printf+0x177>
+      if(c == 'd'){
+    1bd3:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    1bd7:	75 1e                	jne    1bf7 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    1bd9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1bdc:	8b 00                	mov    (%eax),%eax
+    1bde:	6a 01                	push   $0x1
+    1be0:	6a 0a                	push   $0xa
+    1be2:	50                   	push   %eax
+    1be3:	ff 75 08             	push   0x8(%ebp)
+    1be6:	e8 c3 fe ff ff       	call   1aae <printint>
+    1beb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1bee:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1bf2:	e9 d8 00 00 00       	jmp    1ccf <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    1bf7:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    1bfb:	74 06                	je     1c03 <printf+0xa4>
+    1bfd:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    1c01:	75 1e                	jne    1c21 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    1c03:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1c06:	8b 00                	mov    (%eax),%eax
+    1c08:	6a 00                	push   $0x0
+    1c0a:	6a 10                	push   $0x10
+    1c0c:	50                   	push   %eax
+    1c0d:	ff 75 08             	push   0x8(%ebp)
+    1c10:	e8 99 fe ff ff       	call   1aae <printint>
+    1c15:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1c18:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1c1c:	e9 ae 00 00 00       	jmp    1ccf <printf+0x170>
+      } else if(c == 's'){
+    1c21:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    1c25:	75 43                	jne    1c6a <printf+0x10b>
+        s = (char*)*ap;
+    1c27:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1c2a:	8b 00                	mov    (%eax),%eax
+    1c2c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    1c2f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    1c33:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1c37:	75 25                	jne    1c5e <printf+0xff>
+          s = "(null)";
+    1c39:	c7 45 f4 04 20 00 00 	movl   $0x2004,-0xc(%ebp)
+        while(*s != 0){
+    1c40:	eb 1c                	jmp    1c5e <printf+0xff>
+          putc(fd, *s);
+    1c42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c45:	0f b6 00             	movzbl (%eax),%eax
+    1c48:	0f be c0             	movsbl %al,%eax
+    1c4b:	83 ec 08             	sub    $0x8,%esp
+    1c4e:	50                   	push   %eax
+    1c4f:	ff 75 08             	push   0x8(%ebp)
+    1c52:	e8 34 fe ff ff       	call   1a8b <putc>
+    1c57:	83 c4 10             	add    $0x10,%esp
+          s++;
+    1c5a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    1c5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1c61:	0f b6 00             	movzbl (%eax),%eax
+    1c64:	84 c0                	test   %al,%al
+    1c66:	75 da                	jne    1c42 <printf+0xe3>
+    1c68:	eb 65                	jmp    1ccf <printf+0x170>
+        }
+      } else if(c == 'c'){
+    1c6a:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    1c6e:	75 1d                	jne    1c8d <printf+0x12e>
+        putc(fd, *ap);
+    1c70:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1c73:	8b 00                	mov    (%eax),%eax
+    1c75:	0f be c0             	movsbl %al,%eax
+    1c78:	83 ec 08             	sub    $0x8,%esp
+    1c7b:	50                   	push   %eax
+    1c7c:	ff 75 08             	push   0x8(%ebp)
+    1c7f:	e8 07 fe ff ff       	call   1a8b <putc>
+    1c84:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1c87:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1c8b:	eb 42                	jmp    1ccf <printf+0x170>
+      } else if(c == '%'){
+    1c8d:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    1c91:	75 17                	jne    1caa <printf+0x14b>
+        putc(fd, c);
+    1c93:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1c96:	0f be c0             	movsbl %al,%eax
+    1c99:	83 ec 08             	sub    $0x8,%esp
+    1c9c:	50                   	push   %eax
+    1c9d:	ff 75 08             	push   0x8(%ebp)
+    1ca0:	e8 e6 fd ff ff       	call   1a8b <putc>
+    1ca5:	83 c4 10             	add    $0x10,%esp
+    1ca8:	eb 25                	jmp    1ccf <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    1caa:	83 ec 08             	sub    $0x8,%esp
+    1cad:	6a 25                	push   $0x25
+    1caf:	ff 75 08             	push   0x8(%ebp)
+    1cb2:	e8 d4 fd ff ff       	call   1a8b <putc>
+    1cb7:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    1cba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1cbd:	0f be c0             	movsbl %al,%eax
+    1cc0:	83 ec 08             	sub    $0x8,%esp
+    1cc3:	50                   	push   %eax
+    1cc4:	ff 75 08             	push   0x8(%ebp)
+    1cc7:	e8 bf fd ff ff       	call   1a8b <putc>
+    1ccc:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    1ccf:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1cd6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1cda:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1cdd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1ce0:	01 d0                	add    %edx,%eax
+    1ce2:	0f b6 00             	movzbl (%eax),%eax
+    1ce5:	84 c0                	test   %al,%al
+    1ce7:	0f 85 94 fe ff ff    	jne    1b81 <printf+0x22>
+    }
+  }
+}
+    1ced:	90                   	nop
+    1cee:	90                   	nop
+    1cef:	c9                   	leave
+    1cf0:	c3                   	ret
+
+00001cf1 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1cf1:	55                   	push   %ebp
+    1cf2:	89 e5                	mov    %esp,%ebp
+    1cf4:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    1cf7:	8b 45 08             	mov    0x8(%ebp),%eax
+    1cfa:	83 e8 08             	sub    $0x8,%eax
+    1cfd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1d00:	a1 2c b0 00 00       	mov    0xb02c,%eax
+    1d05:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1d08:	eb 24                	jmp    1d2e <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1d0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d0d:	8b 00                	mov    (%eax),%eax
+    1d0f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1d12:	72 12                	jb     1d26 <free+0x35>
+    1d14:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1d17:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1d1a:	72 24                	jb     1d40 <free+0x4f>
+    1d1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d1f:	8b 00                	mov    (%eax),%eax
+    1d21:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1d24:	72 1a                	jb     1d40 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1d26:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d29:	8b 00                	mov    (%eax),%eax
+    1d2b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1d2e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1d31:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    1d34:	73 d4                	jae    1d0a <free+0x19>
+    1d36:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d39:	8b 00                	mov    (%eax),%eax
+    1d3b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1d3e:	73 ca                	jae    1d0a <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1d40:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1d43:	8b 40 04             	mov    0x4(%eax),%eax
+    1d46:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1d4d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1d50:	01 c2                	add    %eax,%edx
+    1d52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d55:	8b 00                	mov    (%eax),%eax
+    1d57:	39 c2                	cmp    %eax,%edx
+    1d59:	75 24                	jne    1d7f <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    1d5b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1d5e:	8b 50 04             	mov    0x4(%eax),%edx
+    1d61:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d64:	8b 00                	mov    (%eax),%eax
+    1d66:	8b 40 04             	mov    0x4(%eax),%eax
+    1d69:	01 c2                	add    %eax,%edx
+    1d6b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1d6e:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1d71:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d74:	8b 00                	mov    (%eax),%eax
+    1d76:	8b 10                	mov    (%eax),%edx
+    1d78:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1d7b:	89 10                	mov    %edx,(%eax)
+    1d7d:	eb 0a                	jmp    1d89 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    1d7f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d82:	8b 10                	mov    (%eax),%edx
+    1d84:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1d87:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    1d89:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d8c:	8b 40 04             	mov    0x4(%eax),%eax
+    1d8f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    1d96:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1d99:	01 d0                	add    %edx,%eax
+    1d9b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    1d9e:	75 20                	jne    1dc0 <free+0xcf>
+    p->s.size += bp->s.size;
+    1da0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1da3:	8b 50 04             	mov    0x4(%eax),%edx
+    1da6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1da9:	8b 40 04             	mov    0x4(%eax),%eax
+    1dac:	01 c2                	add    %eax,%edx
+    1dae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1db1:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    1db4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    1db7:	8b 10                	mov    (%eax),%edx
+    1db9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1dbc:	89 10                	mov    %edx,(%eax)
+    1dbe:	eb 08                	jmp    1dc8 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    1dc0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1dc3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    1dc6:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    1dc8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1dcb:	a3 2c b0 00 00       	mov    %eax,0xb02c
+}
+    1dd0:	90                   	nop
+    1dd1:	c9                   	leave
+    1dd2:	c3                   	ret
+
+00001dd3 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    1dd3:	55                   	push   %ebp
+    1dd4:	89 e5                	mov    %esp,%ebp
+    1dd6:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    1dd9:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    1de0:	77 07                	ja     1de9 <morecore+0x16>
+    nu = 4096;
+    1de2:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    1de9:	8b 45 08             	mov    0x8(%ebp),%eax
+    1dec:	c1 e0 03             	shl    $0x3,%eax
+    1def:	83 ec 0c             	sub    $0xc,%esp
+    1df2:	50                   	push   %eax
+    1df3:	e8 f3 fb ff ff       	call   19eb <sbrk>
+    1df8:	83 c4 10             	add    $0x10,%esp
+    1dfb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    1dfe:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    1e02:	75 07                	jne    1e0b <morecore+0x38>
+    return 0;
+    1e04:	b8 00 00 00 00       	mov    $0x0,%eax
+    1e09:	eb 26                	jmp    1e31 <morecore+0x5e>
+  hp = (Header*)p;
+    1e0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e0e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    1e11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1e14:	8b 55 08             	mov    0x8(%ebp),%edx
+    1e17:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    1e1a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1e1d:	83 c0 08             	add    $0x8,%eax
+    1e20:	83 ec 0c             	sub    $0xc,%esp
+    1e23:	50                   	push   %eax
+    1e24:	e8 c8 fe ff ff       	call   1cf1 <free>
+    1e29:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    1e2c:	a1 2c b0 00 00       	mov    0xb02c,%eax
+}
+    1e31:	c9                   	leave
+    1e32:	c3                   	ret
+
+00001e33 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1e33:	55                   	push   %ebp
+    1e34:	89 e5                	mov    %esp,%ebp
+    1e36:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1e39:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e3c:	83 c0 07             	add    $0x7,%eax
+    1e3f:	c1 e8 03             	shr    $0x3,%eax
+    1e42:	83 c0 01             	add    $0x1,%eax
+    1e45:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    1e48:	a1 2c b0 00 00       	mov    0xb02c,%eax
+    1e4d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1e50:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1e54:	75 23                	jne    1e79 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    1e56:	c7 45 f0 24 b0 00 00 	movl   $0xb024,-0x10(%ebp)
+    1e5d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1e60:	a3 2c b0 00 00       	mov    %eax,0xb02c
+    1e65:	a1 2c b0 00 00       	mov    0xb02c,%eax
+    1e6a:	a3 24 b0 00 00       	mov    %eax,0xb024
+    base.s.size = 0;
+    1e6f:	c7 05 28 b0 00 00 00 	movl   $0x0,0xb028
+    1e76:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1e79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1e7c:	8b 00                	mov    (%eax),%eax
+    1e7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1e81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e84:	8b 40 04             	mov    0x4(%eax),%eax
+    1e87:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    1e8a:	72 4d                	jb     1ed9 <malloc+0xa6>
+      if(p->s.size == nunits)
+    1e8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e8f:	8b 40 04             	mov    0x4(%eax),%eax
+    1e92:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    1e95:	75 0c                	jne    1ea3 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    1e97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e9a:	8b 10                	mov    (%eax),%edx
+    1e9c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1e9f:	89 10                	mov    %edx,(%eax)
+    1ea1:	eb 26                	jmp    1ec9 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    1ea3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ea6:	8b 40 04             	mov    0x4(%eax),%eax
+    1ea9:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    1eac:	89 c2                	mov    %eax,%edx
+    1eae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1eb1:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    1eb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1eb7:	8b 40 04             	mov    0x4(%eax),%eax
+    1eba:	c1 e0 03             	shl    $0x3,%eax
+    1ebd:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    1ec0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ec3:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1ec6:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    1ec9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1ecc:	a3 2c b0 00 00       	mov    %eax,0xb02c
+      return (void*)(p + 1);
+    1ed1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ed4:	83 c0 08             	add    $0x8,%eax
+    1ed7:	eb 3b                	jmp    1f14 <malloc+0xe1>
+    }
+    if(p == freep)
+    1ed9:	a1 2c b0 00 00       	mov    0xb02c,%eax
+    1ede:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1ee1:	75 1e                	jne    1f01 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    1ee3:	83 ec 0c             	sub    $0xc,%esp
+    1ee6:	ff 75 ec             	push   -0x14(%ebp)
+    1ee9:	e8 e5 fe ff ff       	call   1dd3 <morecore>
+    1eee:	83 c4 10             	add    $0x10,%esp
+    1ef1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1ef4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1ef8:	75 07                	jne    1f01 <malloc+0xce>
+        return 0;
+    1efa:	b8 00 00 00 00       	mov    $0x0,%eax
+    1eff:	eb 13                	jmp    1f14 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1f01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f04:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1f07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f0a:	8b 00                	mov    (%eax),%eax
+    1f0c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    1f0f:	e9 6d ff ff ff       	jmp    1e81 <malloc+0x4e>
+  }
+}
+    1f14:	c9                   	leave
+    1f15:	c3                   	ret
@@ -1,27 +1,93 @@
-// Simple grep.  Only supports ^ . * $ operators.
+// Simple grep.
+//   grep [-c] [-j n | -P] pattern [file ...]
+// Patterns are POSIX-style extended regular expressions:
+// . [class] [^class] * + ? | ( ) ^ $ and \c to quote c.
+// -c prints the number of matching lines instead of the lines.
+// -j n searches the files in n worker processes, -P in one per
+// CPU; output still comes out in argument order.
 
 #include "types.h"
 #include "stat.h"
+#include "param.h"
 #include "user.h"
 
-char buf[1024];
-int match(char*, char*);
+char buf[8192];
+int cflag;
+
+enum { MALFORMED = -1, TOOBIG = -2 };  // compile errors
+
+int compile(char*);
+int match(char*, int);
+char *scanc(char*, char*, int);
+
+// Output is collected in obuf and written in large pieces.  A
+// worker writes each piece to its pipe as a record: an int
+// length followed by the bytes; a zero length ends a file.
+char obuf[4096];
+int nobuf;
+int outfd = 1;
+int framed;
+
+void
+flush(void)
+{
+  if(nobuf == 0)
+    return;
+  if(framed)
+    write(outfd, &nobuf, sizeof(nobuf));
+  write(outfd, obuf, nobuf);
+  nobuf = 0;
+}
+
+void
+output(char *p, int n)
+{
+  int m;
+
+  while(n > 0){
+    if(nobuf == sizeof(obuf))
+      flush();
+    m = sizeof(obuf) - nobuf;
+    if(m > n)
+      m = n;
+    memmove(obuf+nobuf, p, m);
+    nobuf += m;
+    p += m;
+    n -= m;
+  }
+}
+
+void
+outint(int x)
+{
+  char s[12];
+  int i;
+
+  i = sizeof(s);
+  do {
+    s[--i] = '0' + x % 10;
+    x /= 10;
+  } while(x > 0);
+  output(s+i, sizeof(s)-i);
+}
 
 void
-grep(char *pattern, int fd)
+grep(int fd)
 {
-  int n, m;
-  char *p, *q;
-  
+  int n, m, count;
+  char *p, *q, *e;
+
   m = 0;
+  count = 0;
   while((n = read(fd, buf+m, sizeof(buf)-m)) > 0){
     m += n;
     p = buf;
-    while((q = strchr(p, '\n')) != 0){
-      *q = 0;
-      if(match(pattern, p)){
-        *q = '\n';
-        write(1, p, q+1 - p);
+    e = buf + m;
+    while((q = scanc(p, e, '\n')) != 0){
+      if(match(p, q - p)){
+        count++;
+        if(!cflag)
+          output(p, q+1 - p);
       }
       p = q+1;
     }
@@ -32,75 +98,611 @@ grep(char *pattern, int fd)
       memmove(buf, p, m);
     }
   }
+  if(cflag){
+    outint(count);
+    output("\n", 1);
+  }
+}
+
+// Read exactly n bytes from a worker's pipe.
+int
+readn(int fd, void *p, int n)
+{
+  int m, r;
+
+  for(m = 0; m < n; m += r)
+    if((r = read(fd, (char*)p + m, n - m)) <= 0)
+      return -1;
+  return 0;
+}
+
+// Worker i greps files i, i+nproc, ...; the parent copies their
+// records to standard output one file at a time, in order.
+void
+pargrep(char **files, int nfile, int nproc)
+{
+  int i, j, k, n, fd, pfd[NCPU][2];
+
+  if(nproc > NCPU)
+    nproc = NCPU;
+  if(nproc > nfile)
+    nproc = nfile;
+  for(i = 0; i < nproc; i++){
+    if(pipe(pfd[i]) < 0){
+      printf(2, "grep: pipe failed\n");
+      exit();
+    }
+    if(fork() == 0){
+      for(j = 0; j <= i; j++)
+        close(pfd[j][0]);
+      outfd = pfd[i][1];
+      framed = 1;
+      for(k = i; k < nfile; k += nproc){
+        if((fd = open(files[k], 0)) < 0){
+          output("grep: cannot open ", 18);
+          output(files[k], strlen(files[k]));
+          output("\n", 1);
+        } else {
+          grep(fd);
+          close(fd);
+        }
+        flush();
+        n = 0;
+        write(outfd, &n, sizeof(n));
+      }
+      exit();
+    }
+    close(pfd[i][1]);
+  }
+
+  for(k = 0; k < nfile; k++){
+    fd = pfd[k % nproc][0];
+    while(readn(fd, &n, sizeof(n)) == 0 && n > 0){
+      for(; n > 0; n -= j){
+        j = n < sizeof(buf) ? n : sizeof(buf);
+        if(readn(fd, buf, j) < 0)
+          break;
+        write(1, buf, j);
+      }
+    }
+  }
+  for(i = 0; i < nproc; i++){
+    close(pfd[i][0]);
+    wait();
+  }
 }
 
 int
 main(int argc, char *argv[])
 {
-  int fd, i;
-  char *pattern;
-  
-  if(argc <= 1){
-    printf(2, "usage: grep pattern [file ...]\n");
+  int fd, i, r, nproc;
+
+  nproc = 1;
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    if(strcmp(argv[i], "-c") == 0)
+      cflag = 1;
+    else if(strcmp(argv[i], "-P") == 0)
+      nproc = ncpus();
+    else if(strcmp(argv[i], "-j") == 0 && i+1 < argc)
+      nproc = atoi(argv[++i]);
+    else
+      break;
+  }
+  if(argc <= i){
+    printf(2, "usage: grep [-c] [-j n | -P] pattern [file ...]\n");
+    exit();
+  }
+  if((r = compile(argv[i])) < 0){
+    if(r == TOOBIG)
+      printf(2, "grep: pattern too long %s\n", argv[i]);
+    else
+      printf(2, "grep: bad pattern %s\n", argv[i]);
+    exit();
+  }
+  i++;
+
+  if(argc <= i){
+    grep(0);
+    flush();
     exit();
   }
-  pattern = argv[1];
-  
-  if(argc <= 2){
-    grep(pattern, 0);
+
+  if(nproc > 1 && argc - i > 1){
+    pargrep(argv+i, argc-i, nproc);
     exit();
   }
 
-  for(i = 2; i < argc; i++){
+  for(; i < argc; i++){
     if((fd = open(argv[i], 0)) < 0){
+      flush();
       printf(1, "grep: cannot open %s\n", argv[i]);
       exit();
     }
-    grep(pattern, fd);
+    grep(fd);
     close(fd);
   }
+  flush();
   exit();
 }
 
-// Regexp matcher from Kernighan & Pike,
-// The Practice of Programming, Chapter 9.
+// memchr: find c in [p, e), a word at a time once p is aligned.
+char*
+scanc(char *p, char *e, int c)
+{
+  uint x, w;
+
+  for(; p < e && ((uint)p & 3) != 0; p++)
+    if(*p == c)
+      return p;
+  x = (uchar)c * 0x01010101;
+  for(; p + 4 <= e; p += 4){
+    w = *(uint*)p ^ x;
+    if((w - 0x01010101) & ~w & 0x80808080)  // some byte of w is 0
+      break;
+  }
+  for(; p < e; p++)
+    if(*p == c)
+      return p;
+  return 0;
+}
+
+//PAGEBREAK!
+// Regular expressions, after Thompson (1968) and Pike's VM as
+// described by Russ Cox, "Regular Expression Matching Can Be
+// Simple And Fast".  The pattern is parsed into a tree, compiled
+// into a program for a non-deterministic machine, and run by
+// following every thread in lock step, so matching is linear in
+// the line length whatever the pattern (no backtracking).
 
-int matchhere(char*, char*);
-int matchstar(int, char*, char*);
+#define MAXNODE  256
+#define MAXINST  512
+#define MAXCLASS 16
+#define MAXPRE   32
+#define MAXDEPTH 16     // nested groups and repetitions
 
-int
-match(char *re, char *text)
+enum { LIT, ANY, CLS, BOL, EOL, EMPTY, CAT, ALT, STAR, PLUS, QUEST };
+
+struct node {
+  int type;
+  int c;              // LIT: character; CLS: class number
+  struct node *l, *r;
+};
+
+enum { ICHAR, IANY, ICLASS, IBOL, IEOL, ISPLIT, IJMP, IMATCH };
+
+struct inst {
+  int op;
+  int c;              // ICHAR: character; ICLASS: class number
+  int x, y;           // ISPLIT, IJMP: targets
+};
+
+static struct node nodes[MAXNODE];
+static int nnode;
+static uchar cls[MAXCLASS][256/8];
+static int ncls;
+static struct inst prog[MAXINST];
+static int ninst;
+static char *rp;      // parse position
+static int bad;       // MALFORMED or TOOBIG
+static int depth;     // of nested groups while parsing
+static int gdepth;    // of nested gen calls
+
+// Literal prefix every match starts with, used to skip to
+// candidate positions; if literal is set it is the whole pattern.
+static char pre[MAXPRE];
+static int npre;
+static int literal;
+
+static struct node*
+mknode(int type, struct node *l, struct node *r)
 {
-  if(re[0] == '^')
-    return matchhere(re+1, text);
-  do{  // must look at empty string
-    if(matchhere(re, text))
-      return 1;
-  }while(*text++ != '\0');
-  return 0;
+  struct node *n;
+
+  if(nnode >= MAXNODE){
+    bad = TOOBIG;
+    nnode = 0;
+  }
+  n = &nodes[nnode++];
+  n->type = type;
+  n->c = 0;
+  n->l = l;
+  n->r = r;
+  return n;
+}
+
+static struct node *parsealt(void);
+
+// [abc], [a-z], [^...]; a ] right after [ or [^ is literal.
+static struct node*
+parseclass(void)
+{
+  struct node *n;
+  uchar *b;
+  int i, neg, lo, hi;
+
+  if(ncls >= MAXCLASS){
+    bad = TOOBIG;
+    ncls = 0;
+  }
+  n = mknode(CLS, 0, 0);
+  n->c = ncls;
+  b = cls[ncls++];
+  memset(b, 0, 256/8);
+  neg = 0;
+  if(*rp == '^'){
+    neg = 1;
+    rp++;
+  }
+  for(i = 0; *rp && (*rp != ']' || i == 0); i++){
+    lo = hi = (uchar)*rp++;
+    if(rp[0] == '-' && rp[1] && rp[1] != ']'){
+      hi = (uchar)rp[1];
+      rp += 2;
+    }
+    for(; lo <= hi; lo++)
+      b[lo/8] |= 1 << (lo%8);
+  }
+  if(*rp != ']')
+    bad = MALFORMED;
+  else
+    rp++;
+  if(neg)
+    for(i = 0; i < 256/8; i++)
+      b[i] = ~b[i];
+  return n;
+}
+
+static struct node*
+parseatom(void)
+{
+  struct node *n;
+  int c;
+
+  c = *rp++;
+  switch(c){
+  case '(':
+    // Each group costs a few stack frames here and in gen, so
+    // limit the nesting rather than overflow the stack.
+    if(depth >= MAXDEPTH){
+      bad = TOOBIG;
+      rp += strlen(rp);
+      return mknode(EMPTY, 0, 0);
+    }
+    depth++;
+    n = parsealt();
+    depth--;
+    if(*rp == ')')
+      rp++;
+    else if(!bad)
+      bad = MALFORMED;
+    return n;
+  case '[':
+    return parseclass();
+  case '.':
+    return mknode(ANY, 0, 0);
+  case '^':
+    return mknode(BOL, 0, 0);
+  case '$':
+    return mknode(EOL, 0, 0);
+  case '\\':
+    if(*rp)
+      c = *rp++;
+    break;
+  }
+  n = mknode(LIT, 0, 0);
+  n->c = c;
+  return n;
+}
+
+// atom followed by any number of * + ?.  A leading * + or ?
+// has nothing to repeat and is taken literally.
+static struct node*
+parserep(void)
+{
+  struct node *n;
+
+  n = parseatom();
+  for(;;){
+    if(*rp == '*')
+      n = mknode(STAR, n, 0);
+    else if(*rp == '+')
+      n = mknode(PLUS, n, 0);
+    else if(*rp == '?')
+      n = mknode(QUEST, n, 0);
+    else
+      return n;
+    rp++;
+  }
+}
+
+// Concatenations and alternations are built as chains down the
+// right, with t the last CAT or ALT node, so gen and prefix can
+// walk them in a loop instead of recursing once per element.
+static struct node*
+parsecat(void)
+{
+  struct node *n, *t, *r;
+
+  n = t = 0;
+  while(*rp && *rp != '|' && *rp != ')'){
+    r = parserep();
+    if(n == 0)
+      n = r;
+    else if(t == 0)
+      n = t = mknode(CAT, n, r);
+    else
+      t = t->r = mknode(CAT, t->r, r);
+  }
+  return n ? n : mknode(EMPTY, 0, 0);
+}
+
+static struct node*
+parsealt(void)
+{
+  struct node *n, *t;
+
+  n = parsecat();
+  t = 0;
+  while(*rp == '|'){
+    rp++;
+    if(t == 0)
+      n = t = mknode(ALT, n, parsecat());
+    else
+      t = t->r = mknode(ALT, t->r, parsecat());
+  }
+  return n;
+}
+
+static int
+emit(int op, int c)
+{
+  if(ninst >= MAXINST){
+    bad = TOOBIG;
+    ninst = 0;
+  }
+  prog[ninst].op = op;
+  prog[ninst].c = c;
+  prog[ninst].x = prog[ninst].y = 0;
+  return ninst++;
+}
+
+// Generate code for n.  Only groups and repetitions nest, and
+// the nesting is limited to MAXDEPTH to stay within the stack.
+static void
+gen(struct node *n)
+{
+  int a, b, j;
+
+  if(gdepth >= MAXDEPTH){
+    bad = TOOBIG;
+    return;
+  }
+  gdepth++;
+  for(; n->type == CAT; n = n->r)
+    gen(n->l);
+  switch(n->type){
+  case LIT:
+    emit(ICHAR, n->c);
+    break;
+  case ANY:
+    emit(IANY, 0);
+    break;
+  case CLS:
+    emit(ICLASS, n->c);
+    break;
+  case BOL:
+    emit(IBOL, 0);
+    break;
+  case EOL:
+    emit(IEOL, 0);
+    break;
+  case EMPTY:
+    break;
+  case ALT:     // split L1, L2; L1: l; jmp L3; L2: r; L3:
+    // Along the chain the jmps to L3 are linked through x
+    // until L3 is known.
+    j = -1;
+    for(; n->type == ALT; n = n->r){
+      a = emit(ISPLIT, 0);
+      prog[a].x = ninst;
+      gen(n->l);
+      b = emit(IJMP, 0);
+      prog[b].x = j;
+      j = b;
+      prog[a].y = ninst;
+    }
+    gen(n);
+    for(; j >= 0 && !bad; j = b){
+      b = prog[j].x;
+      prog[j].x = ninst;
+    }
+    break;
+  case STAR:    // L1: split L2, L3; L2: l; jmp L1; L3:
+    a = emit(ISPLIT, 0);
+    prog[a].x = ninst;
+    gen(n->l);
+    b = emit(IJMP, 0);
+    prog[b].x = a;
+    prog[a].y = ninst;
+    break;
+  case PLUS:    // L1: l; split L1, L2; L2:
+    a = ninst;
+    gen(n->l);
+    b = emit(ISPLIT, 0);
+    prog[b].x = a;
+    prog[b].y = ninst;
+    break;
+  case QUEST:   // split L1, L2; L1: l; L2:
+    a = emit(ISPLIT, 0);
+    prog[a].x = ninst;
+    gen(n->l);
+    prog[a].y = ninst;
+    break;
+  }
+  gdepth--;
 }
 
-// matchhere: search for re at beginning of text
-int matchhere(char *re, char *text)
+// Append n's leading literal characters to pre[].
+// Return 1 if all of n was literal (a leading ^ is allowed).
+static int
+prefix(struct node *n)
 {
-  if(re[0] == '\0')
+  for(; n->type == CAT; n = n->r)
+    if(!prefix(n->l))
+      return 0;
+  switch(n->type){
+  case LIT:
+    if(npre >= MAXPRE)
+      return 0;
+    pre[npre++] = n->c;
     return 1;
-  if(re[1] == '*')
-    return matchstar(re[0], re+2, text);
-  if(re[0] == '$' && re[1] == '\0')
-    return *text == '\0';
-  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
-    return matchhere(re+1, text+1);
+  case BOL:
+    literal = 0;
+    return npre == 0;
+  }
   return 0;
 }
 
-// matchstar: search for c*re at beginning of text
-int matchstar(int c, char *re, char *text)
+int
+compile(char *re)
 {
-  do{  // a * matches zero or more instances
-    if(matchhere(re, text))
+  struct node *n;
+
+  rp = re;
+  n = parsealt();
+  if(*rp != 0 && !bad)  // unbalanced )
+    bad = MALFORMED;
+  if(bad)
+    return bad;
+  gen(n);
+  emit(IMATCH, 0);
+  if(bad)
+    return bad;
+  literal = 1;
+  if(!prefix(n))
+    literal = 0;
+  return bad;
+}
+
+//PAGEBREAK!
+// Thread lists for the current and next position.  mark[pc] ==
+// step means pc is already on the list being built, so each
+// instruction is considered at most once per character.
+static int list0[MAXINST], list1[MAXINST];
+static uint mark[MAXINST];
+static uint step;
+static int stack[2*MAXINST+1];
+
+// Add the thread at pc, following jumps, splits and anchors,
+// to l at text position i of n.  Return 1 if it reaches IMATCH.
+static int
+addthread(int *l, int *nl, int pc, int i, int n)
+{
+  int sp;
+  struct inst *ip;
+
+  sp = 0;
+  stack[sp++] = pc;
+  while(sp > 0){
+    pc = stack[--sp];
+    if(mark[pc] == step)
+      continue;
+    mark[pc] = step;
+    ip = &prog[pc];
+    switch(ip->op){
+    case IJMP:
+      stack[sp++] = ip->x;
+      break;
+    case ISPLIT:
+      stack[sp++] = ip->y;
+      stack[sp++] = ip->x;
+      break;
+    case IBOL:
+      if(i == 0)
+        stack[sp++] = pc+1;
+      break;
+    case IEOL:
+      if(i == n)
+        stack[sp++] = pc+1;
+      break;
+    case IMATCH:
       return 1;
-  }while(*text!='\0' && (*text++==c || c=='.'));
+    default:
+      l[(*nl)++] = pc;
+    }
+  }
   return 0;
 }
 
+// Position of the literal prefix in s[i..n), or -1.
+static int
+findpre(char *s, int i, int n)
+{
+  char *p, *e;
+  int j;
+
+  e = s + n - npre + 1;
+  for(p = s + i; p < e && (p = scanc(p, e, pre[0])) != 0; p++){
+    for(j = 1; j < npre && p[j] == pre[j]; j++)
+      ;
+    if(j == npre)
+      return p - s;
+  }
+  return -1;
+}
+
+// Does the pattern match anywhere in the n bytes at s?
+int
+match(char *s, int n)
+{
+  int *clist, *nlist, *t, ncl, nnl, i, j, c;
+  struct inst *ip;
+
+  if(npre > 0 && findpre(s, 0, n) < 0)
+    return 0;
+  if(literal)
+    return 1;
+
+  clist = list0;
+  nlist = list1;
+  ncl = 0;
+  step++;
+  for(i = 0; ; i++){
+    if(ncl == 0 && npre > 0){
+      // No thread alive: skip to where a match could start.
+      if((i = findpre(s, i, n)) < 0)
+        return 0;
+      step++;
+    }
+    // Unanchored search: start a new thread at every position.
+    if(addthread(clist, &ncl, 0, i, n))
+      return 1;
+    if(i == n)
+      return 0;
+
+    step++;
+    nnl = 0;
+    c = (uchar)s[i];
+    for(j = 0; j < ncl; j++){
+      ip = &prog[clist[j]];
+      switch(ip->op){
+      case ICHAR:
+        if(c != (uchar)ip->c)
+          continue;
+        break;
+      case IANY:
+        break;
+      case ICLASS:
+        if(!(cls[ip->c][c/8] & (1 << (c%8))))
+          continue;
+        break;
+      }
+      if(addthread(nlist, &nnl, clist[j]+1, i+1, n))
+        return 1;
+    }
+    t = clist;
+    clist = nlist;
+    nlist = t;
+    ncl = nnl;
+  }
+}
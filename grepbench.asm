@@ -0,0 +1,1555 @@
+
+_grepbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rnd>:
+
+uint seed = 1;
+
+int
+rnd(int n)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+  seed = seed * 1103515245 + 12345;
+   3:	a1 08 10 00 00       	mov    0x1008,%eax
+   8:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+   e:	05 39 30 00 00       	add    $0x3039,%eax
+  13:	a3 08 10 00 00       	mov    %eax,0x1008
+  return (seed >> 16) % n;
+  18:	a1 08 10 00 00       	mov    0x1008,%eax
+  1d:	c1 e8 10             	shr    $0x10,%eax
+  20:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  23:	ba 00 00 00 00       	mov    $0x0,%edx
+  28:	f7 f1                	div    %ecx
+  2a:	89 d0                	mov    %edx,%eax
+}
+  2c:	5d                   	pop    %ebp
+  2d:	c3                   	ret
+
+0000002e <mkfile>:
+
+char line[128];
+
+void
+mkfile(int nline)
+{
+  2e:	55                   	push   %ebp
+  2f:	89 e5                	mov    %esp,%ebp
+  31:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, n, w;
+
+  if((fd = open(FILE, O_CREATE|O_RDWR)) < 0){
+  34:	83 ec 08             	sub    $0x8,%esp
+  37:	68 02 02 00 00       	push   $0x202
+  3c:	68 45 0c 00 00       	push   $0xc45
+  41:	e8 e9 05 00 00       	call   62f <open>
+  46:	83 c4 10             	add    $0x10,%esp
+  49:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  4c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  50:	79 1c                	jns    6e <mkfile+0x40>
+    printf(2, "grepbench: cannot create %s\n", FILE);
+  52:	83 ec 04             	sub    $0x4,%esp
+  55:	68 45 0c 00 00       	push   $0xc45
+  5a:	68 53 0c 00 00       	push   $0xc53
+  5f:	6a 02                	push   $0x2
+  61:	e8 85 07 00 00       	call   7eb <printf>
+  66:	83 c4 10             	add    $0x10,%esp
+    exit();
+  69:	e8 81 05 00 00       	call   5ef <exit>
+  }
+  for(i = 0; i < nline; i++){
+  6e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  75:	e9 f7 00 00 00       	jmp    171 <mkfile+0x143>
+    n = 0;
+  7a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    if(i % 50 == 49){
+  81:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+  84:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+  89:	89 c8                	mov    %ecx,%eax
+  8b:	f7 ea                	imul   %edx
+  8d:	89 d0                	mov    %edx,%eax
+  8f:	c1 f8 04             	sar    $0x4,%eax
+  92:	89 ca                	mov    %ecx,%edx
+  94:	c1 fa 1f             	sar    $0x1f,%edx
+  97:	29 d0                	sub    %edx,%eax
+  99:	6b d0 32             	imul   $0x32,%eax,%edx
+  9c:	89 c8                	mov    %ecx,%eax
+  9e:	29 d0                	sub    %edx,%eax
+  a0:	83 f8 31             	cmp    $0x31,%eax
+  a3:	75 1d                	jne    c2 <mkfile+0x94>
+      // Long run of a's with no b.
+      memset(line, 'a', 100);
+  a5:	83 ec 04             	sub    $0x4,%esp
+  a8:	6a 64                	push   $0x64
+  aa:	6a 61                	push   $0x61
+  ac:	68 20 10 00 00       	push   $0x1020
+  b1:	e8 60 03 00 00       	call   416 <memset>
+  b6:	83 c4 10             	add    $0x10,%esp
+      n = 100;
+  b9:	c7 45 f0 64 00 00 00 	movl   $0x64,-0x10(%ebp)
+  c0:	eb 69                	jmp    12b <mkfile+0xfd>
+    } else {
+      for(w = 0; w < 8; w++){
+  c2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  c9:	eb 5a                	jmp    125 <mkfile+0xf7>
+        strcpy(line+n, words[rnd(sizeof(words)/sizeof(words[0]))]);
+  cb:	83 ec 0c             	sub    $0xc,%esp
+  ce:	6a 14                	push   $0x14
+  d0:	e8 2b ff ff ff       	call   0 <rnd>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	8b 04 85 a0 0f 00 00 	mov    0xfa0(,%eax,4),%eax
+  df:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  e2:	81 c2 20 10 00 00    	add    $0x1020,%edx
+  e8:	83 ec 08             	sub    $0x8,%esp
+  eb:	50                   	push   %eax
+  ec:	52                   	push   %edx
+  ed:	e8 8e 02 00 00       	call   380 <strcpy>
+  f2:	83 c4 10             	add    $0x10,%esp
+        n += strlen(line+n);
+  f5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  f8:	05 20 10 00 00       	add    $0x1020,%eax
+  fd:	83 ec 0c             	sub    $0xc,%esp
+ 100:	50                   	push   %eax
+ 101:	e8 e9 02 00 00       	call   3ef <strlen>
+ 106:	83 c4 10             	add    $0x10,%esp
+ 109:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 10c:	01 d0                	add    %edx,%eax
+ 10e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        line[n++] = ' ';
+ 111:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 114:	8d 50 01             	lea    0x1(%eax),%edx
+ 117:	89 55 f0             	mov    %edx,-0x10(%ebp)
+ 11a:	c6 80 20 10 00 00 20 	movb   $0x20,0x1020(%eax)
+      for(w = 0; w < 8; w++){
+ 121:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+ 125:	83 7d ec 07          	cmpl   $0x7,-0x14(%ebp)
+ 129:	7e a0                	jle    cb <mkfile+0x9d>
+      }
+    }
+    line[n++] = '\n';
+ 12b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 12e:	8d 50 01             	lea    0x1(%eax),%edx
+ 131:	89 55 f0             	mov    %edx,-0x10(%ebp)
+ 134:	c6 80 20 10 00 00 0a 	movb   $0xa,0x1020(%eax)
+    if(write(fd, line, n) != n){
+ 13b:	83 ec 04             	sub    $0x4,%esp
+ 13e:	ff 75 f0             	push   -0x10(%ebp)
+ 141:	68 20 10 00 00       	push   $0x1020
+ 146:	ff 75 e8             	push   -0x18(%ebp)
+ 149:	e8 c1 04 00 00       	call   60f <write>
+ 14e:	83 c4 10             	add    $0x10,%esp
+ 151:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+ 154:	74 17                	je     16d <mkfile+0x13f>
+      printf(2, "grepbench: write failed\n");
+ 156:	83 ec 08             	sub    $0x8,%esp
+ 159:	68 70 0c 00 00       	push   $0xc70
+ 15e:	6a 02                	push   $0x2
+ 160:	e8 86 06 00 00       	call   7eb <printf>
+ 165:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 168:	e8 82 04 00 00       	call   5ef <exit>
+  for(i = 0; i < nline; i++){
+ 16d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 171:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 174:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 177:	0f 8c fd fe ff ff    	jl     7a <mkfile+0x4c>
+    }
+  }
+  close(fd);
+ 17d:	83 ec 0c             	sub    $0xc,%esp
+ 180:	ff 75 e8             	push   -0x18(%ebp)
+ 183:	e8 8f 04 00 00       	call   617 <close>
+ 188:	83 c4 10             	add    $0x10,%esp
+}
+ 18b:	90                   	nop
+ 18c:	c9                   	leave
+ 18d:	c3                   	ret
+
+0000018e <rungrep>:
+
+// Run grep with args (argv[0] is filled in); return ticks taken.
+int
+rungrep(char **args)
+{
+ 18e:	55                   	push   %ebp
+ 18f:	89 e5                	mov    %esp,%ebp
+ 191:	83 ec 18             	sub    $0x18,%esp
+  uint t0;
+
+  t0 = uptime();
+ 194:	e8 ee 04 00 00       	call   687 <uptime>
+ 199:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fork() == 0){
+ 19c:	e8 46 04 00 00       	call   5e7 <fork>
+ 1a1:	85 c0                	test   %eax,%eax
+ 1a3:	75 33                	jne    1d8 <rungrep+0x4a>
+    args[0] = "grep";
+ 1a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a8:	c7 00 89 0c 00 00    	movl   $0xc89,(%eax)
+    exec("grep", args);
+ 1ae:	83 ec 08             	sub    $0x8,%esp
+ 1b1:	ff 75 08             	push   0x8(%ebp)
+ 1b4:	68 89 0c 00 00       	push   $0xc89
+ 1b9:	e8 69 04 00 00       	call   627 <exec>
+ 1be:	83 c4 10             	add    $0x10,%esp
+    printf(2, "grepbench: exec grep failed\n");
+ 1c1:	83 ec 08             	sub    $0x8,%esp
+ 1c4:	68 8e 0c 00 00       	push   $0xc8e
+ 1c9:	6a 02                	push   $0x2
+ 1cb:	e8 1b 06 00 00       	call   7eb <printf>
+ 1d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1d3:	e8 17 04 00 00       	call   5ef <exit>
+  }
+  wait();
+ 1d8:	e8 1a 04 00 00       	call   5f7 <wait>
+  return uptime() - t0;
+ 1dd:	e8 a5 04 00 00       	call   687 <uptime>
+ 1e2:	2b 45 f4             	sub    -0xc(%ebp),%eax
+}
+ 1e5:	c9                   	leave
+ 1e6:	c3                   	ret
+
+000001e7 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 1e7:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1eb:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1ee:	ff 71 fc             	push   -0x4(%ecx)
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	51                   	push   %ecx
+ 1f5:	83 ec 34             	sub    $0x34,%esp
+ 1f8:	89 c8                	mov    %ecx,%eax
+  int i, nline;
+  char *args[9];
+
+  nline = 1000;
+ 1fa:	c7 45 f0 e8 03 00 00 	movl   $0x3e8,-0x10(%ebp)
+  if(argc > 1)
+ 201:	83 38 01             	cmpl   $0x1,(%eax)
+ 204:	7e 17                	jle    21d <main+0x36>
+    nline = atoi(argv[1]);
+ 206:	8b 40 04             	mov    0x4(%eax),%eax
+ 209:	83 c0 04             	add    $0x4,%eax
+ 20c:	8b 00                	mov    (%eax),%eax
+ 20e:	83 ec 0c             	sub    $0xc,%esp
+ 211:	50                   	push   %eax
+ 212:	e8 08 03 00 00       	call   51f <atoi>
+ 217:	83 c4 10             	add    $0x10,%esp
+ 21a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  mkfile(nline);
+ 21d:	83 ec 0c             	sub    $0xc,%esp
+ 220:	ff 75 f0             	push   -0x10(%ebp)
+ 223:	e8 06 fe ff ff       	call   2e <mkfile>
+ 228:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < sizeof(patterns)/sizeof(patterns[0]); i++){
+ 22b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 232:	eb 65                	jmp    299 <main+0xb2>
+    printf(1, "%s: ", patterns[i]);
+ 234:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 237:	8b 04 85 f0 0f 00 00 	mov    0xff0(,%eax,4),%eax
+ 23e:	83 ec 04             	sub    $0x4,%esp
+ 241:	50                   	push   %eax
+ 242:	68 ab 0c 00 00       	push   $0xcab
+ 247:	6a 01                	push   $0x1
+ 249:	e8 9d 05 00 00       	call   7eb <printf>
+ 24e:	83 c4 10             	add    $0x10,%esp
+    args[1] = "-c";
+ 251:	c7 45 d0 b0 0c 00 00 	movl   $0xcb0,-0x30(%ebp)
+    args[2] = patterns[i];
+ 258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 25b:	8b 04 85 f0 0f 00 00 	mov    0xff0(,%eax,4),%eax
+ 262:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    args[3] = FILE;
+ 265:	c7 45 d8 45 0c 00 00 	movl   $0xc45,-0x28(%ebp)
+    args[4] = 0;
+ 26c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+    printf(1, "%d ticks\n", rungrep(args));
+ 273:	83 ec 0c             	sub    $0xc,%esp
+ 276:	8d 45 cc             	lea    -0x34(%ebp),%eax
+ 279:	50                   	push   %eax
+ 27a:	e8 0f ff ff ff       	call   18e <rungrep>
+ 27f:	83 c4 10             	add    $0x10,%esp
+ 282:	83 ec 04             	sub    $0x4,%esp
+ 285:	50                   	push   %eax
+ 286:	68 b3 0c 00 00       	push   $0xcb3
+ 28b:	6a 01                	push   $0x1
+ 28d:	e8 59 05 00 00       	call   7eb <printf>
+ 292:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(patterns)/sizeof(patterns[0]); i++){
+ 295:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 299:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 29c:	83 f8 05             	cmp    $0x5,%eax
+ 29f:	76 93                	jbe    234 <main+0x4d>
+  }
+
+  for(i = 0; i < 2; i++){
+ 2a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2a8:	e9 8e 00 00 00       	jmp    33b <main+0x154>
+    printf(1, "%s x4:\n", i ? "-P" : "sequential");
+ 2ad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2b1:	74 07                	je     2ba <main+0xd3>
+ 2b3:	b8 bd 0c 00 00       	mov    $0xcbd,%eax
+ 2b8:	eb 05                	jmp    2bf <main+0xd8>
+ 2ba:	b8 c0 0c 00 00       	mov    $0xcc0,%eax
+ 2bf:	83 ec 04             	sub    $0x4,%esp
+ 2c2:	50                   	push   %eax
+ 2c3:	68 cb 0c 00 00       	push   $0xccb
+ 2c8:	6a 01                	push   $0x1
+ 2ca:	e8 1c 05 00 00       	call   7eb <printf>
+ 2cf:	83 c4 10             	add    $0x10,%esp
+    args[1] = i ? "-P" : "-c";
+ 2d2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2d6:	74 07                	je     2df <main+0xf8>
+ 2d8:	b8 bd 0c 00 00       	mov    $0xcbd,%eax
+ 2dd:	eb 05                	jmp    2e4 <main+0xfd>
+ 2df:	b8 b0 0c 00 00       	mov    $0xcb0,%eax
+ 2e4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    args[2] = "-c";
+ 2e7:	c7 45 d4 b0 0c 00 00 	movl   $0xcb0,-0x2c(%ebp)
+    args[3] = "k[aeiou]+t";
+ 2ee:	c7 45 d8 19 0c 00 00 	movl   $0xc19,-0x28(%ebp)
+    args[4] = args[5] = args[6] = args[7] = FILE;
+ 2f5:	c7 45 e8 45 0c 00 00 	movl   $0xc45,-0x18(%ebp)
+ 2fc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 302:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 305:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 308:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 30b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    args[8] = 0;
+ 30e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    printf(1, "%d ticks\n", rungrep(args));
+ 315:	83 ec 0c             	sub    $0xc,%esp
+ 318:	8d 45 cc             	lea    -0x34(%ebp),%eax
+ 31b:	50                   	push   %eax
+ 31c:	e8 6d fe ff ff       	call   18e <rungrep>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	83 ec 04             	sub    $0x4,%esp
+ 327:	50                   	push   %eax
+ 328:	68 b3 0c 00 00       	push   $0xcb3
+ 32d:	6a 01                	push   $0x1
+ 32f:	e8 b7 04 00 00       	call   7eb <printf>
+ 334:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+ 337:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 33b:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+ 33f:	0f 8e 68 ff ff ff    	jle    2ad <main+0xc6>
+  }
+  unlink(FILE);
+ 345:	83 ec 0c             	sub    $0xc,%esp
+ 348:	68 45 0c 00 00       	push   $0xc45
+ 34d:	e8 ed 02 00 00       	call   63f <unlink>
+ 352:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 355:	e8 95 02 00 00       	call   5ef <exit>
+
+0000035a <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 35a:	55                   	push   %ebp
+ 35b:	89 e5                	mov    %esp,%ebp
+ 35d:	57                   	push   %edi
+ 35e:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 35f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 362:	8b 55 10             	mov    0x10(%ebp),%edx
+ 365:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 368:	89 cb                	mov    %ecx,%ebx
+ 36a:	89 df                	mov    %ebx,%edi
+ 36c:	89 d1                	mov    %edx,%ecx
+ 36e:	fc                   	cld
+ 36f:	f3 aa                	rep stos %al,%es:(%edi)
+ 371:	89 ca                	mov    %ecx,%edx
+ 373:	89 fb                	mov    %edi,%ebx
+ 375:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 378:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 37b:	90                   	nop
+ 37c:	5b                   	pop    %ebx
+ 37d:	5f                   	pop    %edi
+ 37e:	5d                   	pop    %ebp
+ 37f:	c3                   	ret
+
+00000380 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 386:	8b 45 08             	mov    0x8(%ebp),%eax
+ 389:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 38c:	90                   	nop
+ 38d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 390:	8d 42 01             	lea    0x1(%edx),%eax
+ 393:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 396:	8b 45 08             	mov    0x8(%ebp),%eax
+ 399:	8d 48 01             	lea    0x1(%eax),%ecx
+ 39c:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 39f:	0f b6 12             	movzbl (%edx),%edx
+ 3a2:	88 10                	mov    %dl,(%eax)
+ 3a4:	0f b6 00             	movzbl (%eax),%eax
+ 3a7:	84 c0                	test   %al,%al
+ 3a9:	75 e2                	jne    38d <strcpy+0xd>
+    ;
+  return os;
+ 3ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3ae:	c9                   	leave
+ 3af:	c3                   	ret
+
+000003b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3b3:	eb 08                	jmp    3bd <strcmp+0xd>
+    p++, q++;
+ 3b5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3b9:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c0:	0f b6 00             	movzbl (%eax),%eax
+ 3c3:	84 c0                	test   %al,%al
+ 3c5:	74 10                	je     3d7 <strcmp+0x27>
+ 3c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ca:	0f b6 10             	movzbl (%eax),%edx
+ 3cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d0:	0f b6 00             	movzbl (%eax),%eax
+ 3d3:	38 c2                	cmp    %al,%dl
+ 3d5:	74 de                	je     3b5 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3da:	0f b6 00             	movzbl (%eax),%eax
+ 3dd:	0f b6 d0             	movzbl %al,%edx
+ 3e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e3:	0f b6 00             	movzbl (%eax),%eax
+ 3e6:	0f b6 c0             	movzbl %al,%eax
+ 3e9:	29 c2                	sub    %eax,%edx
+ 3eb:	89 d0                	mov    %edx,%eax
+}
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+
+000003ef <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3ef:	55                   	push   %ebp
+ 3f0:	89 e5                	mov    %esp,%ebp
+ 3f2:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3f5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3fc:	eb 04                	jmp    402 <strlen+0x13>
+ 3fe:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 402:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 405:	8b 45 08             	mov    0x8(%ebp),%eax
+ 408:	01 d0                	add    %edx,%eax
+ 40a:	0f b6 00             	movzbl (%eax),%eax
+ 40d:	84 c0                	test   %al,%al
+ 40f:	75 ed                	jne    3fe <strlen+0xf>
+    ;
+  return n;
+ 411:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 414:	c9                   	leave
+ 415:	c3                   	ret
+
+00000416 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 416:	55                   	push   %ebp
+ 417:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 419:	8b 45 10             	mov    0x10(%ebp),%eax
+ 41c:	50                   	push   %eax
+ 41d:	ff 75 0c             	push   0xc(%ebp)
+ 420:	ff 75 08             	push   0x8(%ebp)
+ 423:	e8 32 ff ff ff       	call   35a <stosb>
+ 428:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 42b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 42e:	c9                   	leave
+ 42f:	c3                   	ret
+
+00000430 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	83 ec 04             	sub    $0x4,%esp
+ 436:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 439:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 43c:	eb 14                	jmp    452 <strchr+0x22>
+    if(*s == c)
+ 43e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 441:	0f b6 00             	movzbl (%eax),%eax
+ 444:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 447:	75 05                	jne    44e <strchr+0x1e>
+      return (char*)s;
+ 449:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44c:	eb 13                	jmp    461 <strchr+0x31>
+  for(; *s; s++)
+ 44e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 452:	8b 45 08             	mov    0x8(%ebp),%eax
+ 455:	0f b6 00             	movzbl (%eax),%eax
+ 458:	84 c0                	test   %al,%al
+ 45a:	75 e2                	jne    43e <strchr+0xe>
+  return 0;
+ 45c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 461:	c9                   	leave
+ 462:	c3                   	ret
+
+00000463 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 463:	55                   	push   %ebp
+ 464:	89 e5                	mov    %esp,%ebp
+ 466:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 469:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 470:	eb 42                	jmp    4b4 <gets+0x51>
+    cc = read(0, &c, 1);
+ 472:	83 ec 04             	sub    $0x4,%esp
+ 475:	6a 01                	push   $0x1
+ 477:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 47a:	50                   	push   %eax
+ 47b:	6a 00                	push   $0x0
+ 47d:	e8 85 01 00 00       	call   607 <read>
+ 482:	83 c4 10             	add    $0x10,%esp
+ 485:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 488:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 48c:	7e 33                	jle    4c1 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 48e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 491:	8d 50 01             	lea    0x1(%eax),%edx
+ 494:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 497:	89 c2                	mov    %eax,%edx
+ 499:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49c:	01 c2                	add    %eax,%edx
+ 49e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4a2:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 4a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4a8:	3c 0a                	cmp    $0xa,%al
+ 4aa:	74 16                	je     4c2 <gets+0x5f>
+ 4ac:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4b0:	3c 0d                	cmp    $0xd,%al
+ 4b2:	74 0e                	je     4c2 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 4b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4b7:	83 c0 01             	add    $0x1,%eax
+ 4ba:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4bd:	7f b3                	jg     472 <gets+0xf>
+ 4bf:	eb 01                	jmp    4c2 <gets+0x5f>
+      break;
+ 4c1:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 4c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c8:	01 d0                	add    %edx,%eax
+ 4ca:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4cd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4d0:	c9                   	leave
+ 4d1:	c3                   	ret
+
+000004d2 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4d2:	55                   	push   %ebp
+ 4d3:	89 e5                	mov    %esp,%ebp
+ 4d5:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4d8:	83 ec 08             	sub    $0x8,%esp
+ 4db:	6a 00                	push   $0x0
+ 4dd:	ff 75 08             	push   0x8(%ebp)
+ 4e0:	e8 4a 01 00 00       	call   62f <open>
+ 4e5:	83 c4 10             	add    $0x10,%esp
+ 4e8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4eb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4ef:	79 07                	jns    4f8 <stat+0x26>
+    return -1;
+ 4f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4f6:	eb 25                	jmp    51d <stat+0x4b>
+  r = fstat(fd, st);
+ 4f8:	83 ec 08             	sub    $0x8,%esp
+ 4fb:	ff 75 0c             	push   0xc(%ebp)
+ 4fe:	ff 75 f4             	push   -0xc(%ebp)
+ 501:	e8 41 01 00 00       	call   647 <fstat>
+ 506:	83 c4 10             	add    $0x10,%esp
+ 509:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 50c:	83 ec 0c             	sub    $0xc,%esp
+ 50f:	ff 75 f4             	push   -0xc(%ebp)
+ 512:	e8 00 01 00 00       	call   617 <close>
+ 517:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 51a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 51d:	c9                   	leave
+ 51e:	c3                   	ret
+
+0000051f <atoi>:
+
+int
+atoi(const char *s)
+{
+ 51f:	55                   	push   %ebp
+ 520:	89 e5                	mov    %esp,%ebp
+ 522:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 525:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 52c:	eb 25                	jmp    553 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 52e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 531:	89 d0                	mov    %edx,%eax
+ 533:	c1 e0 02             	shl    $0x2,%eax
+ 536:	01 d0                	add    %edx,%eax
+ 538:	01 c0                	add    %eax,%eax
+ 53a:	89 c1                	mov    %eax,%ecx
+ 53c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53f:	8d 50 01             	lea    0x1(%eax),%edx
+ 542:	89 55 08             	mov    %edx,0x8(%ebp)
+ 545:	0f b6 00             	movzbl (%eax),%eax
+ 548:	0f be c0             	movsbl %al,%eax
+ 54b:	01 c8                	add    %ecx,%eax
+ 54d:	83 e8 30             	sub    $0x30,%eax
+ 550:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	0f b6 00             	movzbl (%eax),%eax
+ 559:	3c 2f                	cmp    $0x2f,%al
+ 55b:	7e 0a                	jle    567 <atoi+0x48>
+ 55d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 560:	0f b6 00             	movzbl (%eax),%eax
+ 563:	3c 39                	cmp    $0x39,%al
+ 565:	7e c7                	jle    52e <atoi+0xf>
+  return n;
+ 567:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 56a:	c9                   	leave
+ 56b:	c3                   	ret
+
+0000056c <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 56c:	55                   	push   %ebp
+ 56d:	89 e5                	mov    %esp,%ebp
+ 56f:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 572:	8b 45 08             	mov    0x8(%ebp),%eax
+ 575:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 578:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 57b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 57e:	eb 17                	jmp    597 <memmove+0x2b>
+    *dst++ = *src++;
+ 580:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 583:	8d 42 01             	lea    0x1(%edx),%eax
+ 586:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 589:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 58c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 58f:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 592:	0f b6 12             	movzbl (%edx),%edx
+ 595:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 597:	8b 45 10             	mov    0x10(%ebp),%eax
+ 59a:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 59d:	89 55 10             	mov    %edx,0x10(%ebp)
+ 5a0:	85 c0                	test   %eax,%eax
+ 5a2:	7f dc                	jg     580 <memmove+0x14>
+  return vdst;
+ 5a4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5a7:	c9                   	leave
+ 5a8:	c3                   	ret
+
+000005a9 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 5a9:	55                   	push   %ebp
+ 5aa:	89 e5                	mov    %esp,%ebp
+ 5ac:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 5af:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 5b6:	eb 04                	jmp    5bc <ncpus+0x13>
+ 5b8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 5bc:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 5c0:	7f 16                	jg     5d8 <ncpus+0x2f>
+ 5c2:	83 ec 08             	sub    $0x8,%esp
+ 5c5:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 5c8:	50                   	push   %eax
+ 5c9:	ff 75 f4             	push   -0xc(%ebp)
+ 5cc:	e8 d6 00 00 00       	call   6a7 <intrstat>
+ 5d1:	83 c4 10             	add    $0x10,%esp
+ 5d4:	85 c0                	test   %eax,%eax
+ 5d6:	74 e0                	je     5b8 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 5d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5db:	ba 01 00 00 00       	mov    $0x1,%edx
+ 5e0:	85 c0                	test   %eax,%eax
+ 5e2:	0f 4e c2             	cmovle %edx,%eax
+}
+ 5e5:	c9                   	leave
+ 5e6:	c3                   	ret
+
+000005e7 <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 5e7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ec:	cd 40                	int    $0x40
+ 5ee:	c3                   	ret
+
+000005ef <exit>:
+SYSCALL(exit)
+ 5ef:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5f4:	cd 40                	int    $0x40
+ 5f6:	c3                   	ret
+
+000005f7 <wait>:
+SYSCALL(wait)
+ 5f7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5fc:	cd 40                	int    $0x40
+ 5fe:	c3                   	ret
+
+000005ff <pipe>:
+SYSCALL(pipe)
+ 5ff:	b8 04 00 00 00       	mov    $0x4,%eax
+ 604:	cd 40                	int    $0x40
+ 606:	c3                   	ret
+
+00000607 <read>:
+SYSCALL(read)
+ 607:	b8 05 00 00 00       	mov    $0x5,%eax
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <write>:
+SYSCALL(write)
+ 60f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 614:	cd 40                	int    $0x40
+ 616:	c3                   	ret
+
+00000617 <close>:
+SYSCALL(close)
+ 617:	b8 15 00 00 00       	mov    $0x15,%eax
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <kill>:
+SYSCALL(kill)
+ 61f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <exec>:
+SYSCALL(exec)
+ 627:	b8 07 00 00 00       	mov    $0x7,%eax
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <open>:
+SYSCALL(open)
+ 62f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <mknod>:
+SYSCALL(mknod)
+ 637:	b8 11 00 00 00       	mov    $0x11,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <unlink>:
+SYSCALL(unlink)
+ 63f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <fstat>:
+SYSCALL(fstat)
+ 647:	b8 08 00 00 00       	mov    $0x8,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <link>:
+SYSCALL(link)
+ 64f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <mkdir>:
+SYSCALL(mkdir)
+ 657:	b8 14 00 00 00       	mov    $0x14,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <chdir>:
+SYSCALL(chdir)
+ 65f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <dup>:
+SYSCALL(dup)
+ 667:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <getpid>:
+SYSCALL(getpid)
+ 66f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <sbrk>:
+SYSCALL(sbrk)
+ 677:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <sleep>:
+SYSCALL(sleep)
+ 67f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <uptime>:
+SYSCALL(uptime)
+ 687:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <poll>:
+SYSCALL(poll)
+ 68f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <fcntl>:
+SYSCALL(fcntl)
+ 697:	b8 17 00 00 00       	mov    $0x17,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <irqroute>:
+SYSCALL(irqroute)
+ 69f:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <intrstat>:
+SYSCALL(intrstat)
+ 6a7:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <pread>:
+SYSCALL(pread)
+ 6af:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <getdents>:
+SYSCALL(getdents)
+ 6b7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <fstatat>:
+SYSCALL(fstatat)
+ 6bf:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+
+000006c7 <openat>:
+SYSCALL(openat)
+ 6c7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <unlinkat>:
+SYSCALL(unlinkat)
+ 6cf:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6d4:	cd 40                	int    $0x40
+ 6d6:	c3                   	ret
+
+000006d7 <mkdirat>:
+SYSCALL(mkdirat)
+ 6d7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6dc:	cd 40                	int    $0x40
+ 6de:	c3                   	ret
+
+000006df <linkat>:
+SYSCALL(linkat)
+ 6df:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6e4:	cd 40                	int    $0x40
+ 6e6:	c3                   	ret
+
+000006e7 <exits>:
+SYSCALL(exits)
+ 6e7:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6ec:	cd 40                	int    $0x40
+ 6ee:	c3                   	ret
+
+000006ef <waitstatus>:
+SYSCALL(waitstatus)
+ 6ef:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6f4:	cd 40                	int    $0x40
+ 6f6:	c3                   	ret
+
+000006f7 <pwrite>:
+SYSCALL(pwrite)
+ 6f7:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <lseek>:
+SYSCALL(lseek)
+ 6ff:	b8 24 00 00 00       	mov    $0x24,%eax
+ 704:	cd 40                	int    $0x40
+ 706:	c3                   	ret
+
+00000707 <copyfilerange>:
+SYSCALL(copyfilerange)
+ 707:	b8 25 00 00 00       	mov    $0x25,%eax
+ 70c:	cd 40                	int    $0x40
+ 70e:	c3                   	ret
+
+0000070f <fsctl>:
+SYSCALL(fsctl)
+ 70f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 714:	cd 40                	int    $0x40
+ 716:	c3                   	ret
+
+00000717 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 717:	55                   	push   %ebp
+ 718:	89 e5                	mov    %esp,%ebp
+ 71a:	83 ec 18             	sub    $0x18,%esp
+ 71d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 720:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 723:	83 ec 04             	sub    $0x4,%esp
+ 726:	6a 01                	push   $0x1
+ 728:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 72b:	50                   	push   %eax
+ 72c:	ff 75 08             	push   0x8(%ebp)
+ 72f:	e8 db fe ff ff       	call   60f <write>
+ 734:	83 c4 10             	add    $0x10,%esp
+}
+ 737:	90                   	nop
+ 738:	c9                   	leave
+ 739:	c3                   	ret
+
+0000073a <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 73a:	55                   	push   %ebp
+ 73b:	89 e5                	mov    %esp,%ebp
+ 73d:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 740:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 747:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 74b:	74 17                	je     764 <printint+0x2a>
+ 74d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 751:	79 11                	jns    764 <printint+0x2a>
+    neg = 1;
+ 753:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 75a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 75d:	f7 d8                	neg    %eax
+ 75f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 762:	eb 06                	jmp    76a <printint+0x30>
+  } else {
+    x = xx;
+ 764:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 767:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 76a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 771:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 774:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 777:	ba 00 00 00 00       	mov    $0x0,%edx
+ 77c:	f7 f1                	div    %ecx
+ 77e:	89 d1                	mov    %edx,%ecx
+ 780:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 783:	8d 50 01             	lea    0x1(%eax),%edx
+ 786:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 789:	0f b6 91 0c 10 00 00 	movzbl 0x100c(%ecx),%edx
+ 790:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 794:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 797:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 79a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 79f:	f7 f1                	div    %ecx
+ 7a1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7a8:	75 c7                	jne    771 <printint+0x37>
+  if(neg)
+ 7aa:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7ae:	74 2d                	je     7dd <printint+0xa3>
+    buf[i++] = '-';
+ 7b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b3:	8d 50 01             	lea    0x1(%eax),%edx
+ 7b6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7b9:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 7be:	eb 1d                	jmp    7dd <printint+0xa3>
+    putc(fd, buf[i]);
+ 7c0:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7c6:	01 d0                	add    %edx,%eax
+ 7c8:	0f b6 00             	movzbl (%eax),%eax
+ 7cb:	0f be c0             	movsbl %al,%eax
+ 7ce:	83 ec 08             	sub    $0x8,%esp
+ 7d1:	50                   	push   %eax
+ 7d2:	ff 75 08             	push   0x8(%ebp)
+ 7d5:	e8 3d ff ff ff       	call   717 <putc>
+ 7da:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 7dd:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7e1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7e5:	79 d9                	jns    7c0 <printint+0x86>
+}
+ 7e7:	90                   	nop
+ 7e8:	90                   	nop
+ 7e9:	c9                   	leave
+ 7ea:	c3                   	ret
+
+000007eb <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7eb:	55                   	push   %ebp
+ 7ec:	89 e5                	mov    %esp,%ebp
+ 7ee:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 7f1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7f8:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7fb:	83 c0 04             	add    $0x4,%eax
+ 7fe:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 801:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 808:	e9 59 01 00 00       	jmp    966 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 80d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 810:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 813:	01 d0                	add    %edx,%eax
+ 815:	0f b6 00             	movzbl (%eax),%eax
+ 818:	0f be c0             	movsbl %al,%eax
+ 81b:	25 ff 00 00 00       	and    $0xff,%eax
+ 820:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 823:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 827:	75 2c                	jne    855 <printf+0x6a>
+      if(c == '%'){
+ 829:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 82d:	75 0c                	jne    83b <printf+0x50>
+        state = '%';
+ 82f:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 836:	e9 27 01 00 00       	jmp    962 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 83b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 83e:	0f be c0             	movsbl %al,%eax
+ 841:	83 ec 08             	sub    $0x8,%esp
+ 844:	50                   	push   %eax
+ 845:	ff 75 08             	push   0x8(%ebp)
+ 848:	e8 ca fe ff ff       	call   717 <putc>
+ 84d:	83 c4 10             	add    $0x10,%esp
+ 850:	e9 0d 01 00 00       	jmp    962 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 855:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 859:	0f 85 03 01 00 00    	jne    962 <printf+0x177>
+      if(c == 'd'){
+ 85f:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 863:	75 1e                	jne    883 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 865:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	6a 01                	push   $0x1
+ 86c:	6a 0a                	push   $0xa
+ 86e:	50                   	push   %eax
+ 86f:	ff 75 08             	push   0x8(%ebp)
+ 872:	e8 c3 fe ff ff       	call   73a <printint>
+ 877:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 87a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 87e:	e9 d8 00 00 00       	jmp    95b <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 883:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 887:	74 06                	je     88f <printf+0xa4>
+ 889:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 88d:	75 1e                	jne    8ad <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 88f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 892:	8b 00                	mov    (%eax),%eax
+ 894:	6a 00                	push   $0x0
+ 896:	6a 10                	push   $0x10
+ 898:	50                   	push   %eax
+ 899:	ff 75 08             	push   0x8(%ebp)
+ 89c:	e8 99 fe ff ff       	call   73a <printint>
+ 8a1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8a4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8a8:	e9 ae 00 00 00       	jmp    95b <printf+0x170>
+      } else if(c == 's'){
+ 8ad:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8b1:	75 43                	jne    8f6 <printf+0x10b>
+        s = (char*)*ap;
+ 8b3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8b6:	8b 00                	mov    (%eax),%eax
+ 8b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8bb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 8bf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8c3:	75 25                	jne    8ea <printf+0xff>
+          s = "(null)";
+ 8c5:	c7 45 f4 d3 0c 00 00 	movl   $0xcd3,-0xc(%ebp)
+        while(*s != 0){
+ 8cc:	eb 1c                	jmp    8ea <printf+0xff>
+          putc(fd, *s);
+ 8ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d1:	0f b6 00             	movzbl (%eax),%eax
+ 8d4:	0f be c0             	movsbl %al,%eax
+ 8d7:	83 ec 08             	sub    $0x8,%esp
+ 8da:	50                   	push   %eax
+ 8db:	ff 75 08             	push   0x8(%ebp)
+ 8de:	e8 34 fe ff ff       	call   717 <putc>
+ 8e3:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 8e6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 8ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ed:	0f b6 00             	movzbl (%eax),%eax
+ 8f0:	84 c0                	test   %al,%al
+ 8f2:	75 da                	jne    8ce <printf+0xe3>
+ 8f4:	eb 65                	jmp    95b <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 8f6:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8fa:	75 1d                	jne    919 <printf+0x12e>
+        putc(fd, *ap);
+ 8fc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8ff:	8b 00                	mov    (%eax),%eax
+ 901:	0f be c0             	movsbl %al,%eax
+ 904:	83 ec 08             	sub    $0x8,%esp
+ 907:	50                   	push   %eax
+ 908:	ff 75 08             	push   0x8(%ebp)
+ 90b:	e8 07 fe ff ff       	call   717 <putc>
+ 910:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 913:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 917:	eb 42                	jmp    95b <printf+0x170>
+      } else if(c == '%'){
+ 919:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 91d:	75 17                	jne    936 <printf+0x14b>
+        putc(fd, c);
+ 91f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 922:	0f be c0             	movsbl %al,%eax
+ 925:	83 ec 08             	sub    $0x8,%esp
+ 928:	50                   	push   %eax
+ 929:	ff 75 08             	push   0x8(%ebp)
+ 92c:	e8 e6 fd ff ff       	call   717 <putc>
+ 931:	83 c4 10             	add    $0x10,%esp
+ 934:	eb 25                	jmp    95b <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 936:	83 ec 08             	sub    $0x8,%esp
+ 939:	6a 25                	push   $0x25
+ 93b:	ff 75 08             	push   0x8(%ebp)
+ 93e:	e8 d4 fd ff ff       	call   717 <putc>
+ 943:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 946:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 949:	0f be c0             	movsbl %al,%eax
+ 94c:	83 ec 08             	sub    $0x8,%esp
+ 94f:	50                   	push   %eax
+ 950:	ff 75 08             	push   0x8(%ebp)
+ 953:	e8 bf fd ff ff       	call   717 <putc>
+ 958:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 95b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 962:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 966:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 969:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 96c:	01 d0                	add    %edx,%eax
+ 96e:	0f b6 00             	movzbl (%eax),%eax
+ 971:	84 c0                	test   %al,%al
+ 973:	0f 85 94 fe ff ff    	jne    80d <printf+0x22>
+    }
+  }
+}
+ 979:	90                   	nop
+ 97a:	90                   	nop
+ 97b:	c9                   	leave
+ 97c:	c3                   	ret
+
+0000097d <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 97d:	55                   	push   %ebp
+ 97e:	89 e5                	mov    %esp,%ebp
+ 980:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 983:	8b 45 08             	mov    0x8(%ebp),%eax
+ 986:	83 e8 08             	sub    $0x8,%eax
+ 989:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 98c:	a1 a8 10 00 00       	mov    0x10a8,%eax
+ 991:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 994:	eb 24                	jmp    9ba <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 996:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 999:	8b 00                	mov    (%eax),%eax
+ 99b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 99e:	72 12                	jb     9b2 <free+0x35>
+ 9a0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9a6:	72 24                	jb     9cc <free+0x4f>
+ 9a8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ab:	8b 00                	mov    (%eax),%eax
+ 9ad:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9b0:	72 1a                	jb     9cc <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b5:	8b 00                	mov    (%eax),%eax
+ 9b7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9ba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9bd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 9c0:	73 d4                	jae    996 <free+0x19>
+ 9c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c5:	8b 00                	mov    (%eax),%eax
+ 9c7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9ca:	73 ca                	jae    996 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9cc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9cf:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d2:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9d9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9dc:	01 c2                	add    %eax,%edx
+ 9de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e1:	8b 00                	mov    (%eax),%eax
+ 9e3:	39 c2                	cmp    %eax,%edx
+ 9e5:	75 24                	jne    a0b <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 9e7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9ea:	8b 50 04             	mov    0x4(%eax),%edx
+ 9ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f0:	8b 00                	mov    (%eax),%eax
+ 9f2:	8b 40 04             	mov    0x4(%eax),%eax
+ 9f5:	01 c2                	add    %eax,%edx
+ 9f7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9fa:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a00:	8b 00                	mov    (%eax),%eax
+ a02:	8b 10                	mov    (%eax),%edx
+ a04:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a07:	89 10                	mov    %edx,(%eax)
+ a09:	eb 0a                	jmp    a15 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a0b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a0e:	8b 10                	mov    (%eax),%edx
+ a10:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a13:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a15:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a18:	8b 40 04             	mov    0x4(%eax),%eax
+ a1b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a25:	01 d0                	add    %edx,%eax
+ a27:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a2a:	75 20                	jne    a4c <free+0xcf>
+    p->s.size += bp->s.size;
+ a2c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a2f:	8b 50 04             	mov    0x4(%eax),%edx
+ a32:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a35:	8b 40 04             	mov    0x4(%eax),%eax
+ a38:	01 c2                	add    %eax,%edx
+ a3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ a40:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a43:	8b 10                	mov    (%eax),%edx
+ a45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a48:	89 10                	mov    %edx,(%eax)
+ a4a:	eb 08                	jmp    a54 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ a4c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ a52:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ a54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a57:	a3 a8 10 00 00       	mov    %eax,0x10a8
+}
+ a5c:	90                   	nop
+ a5d:	c9                   	leave
+ a5e:	c3                   	ret
+
+00000a5f <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ a5f:	55                   	push   %ebp
+ a60:	89 e5                	mov    %esp,%ebp
+ a62:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a65:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a6c:	77 07                	ja     a75 <morecore+0x16>
+    nu = 4096;
+ a6e:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a75:	8b 45 08             	mov    0x8(%ebp),%eax
+ a78:	c1 e0 03             	shl    $0x3,%eax
+ a7b:	83 ec 0c             	sub    $0xc,%esp
+ a7e:	50                   	push   %eax
+ a7f:	e8 f3 fb ff ff       	call   677 <sbrk>
+ a84:	83 c4 10             	add    $0x10,%esp
+ a87:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ a8a:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a8e:	75 07                	jne    a97 <morecore+0x38>
+    return 0;
+ a90:	b8 00 00 00 00       	mov    $0x0,%eax
+ a95:	eb 26                	jmp    abd <morecore+0x5e>
+  hp = (Header*)p;
+ a97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a9a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a9d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aa0:	8b 55 08             	mov    0x8(%ebp),%edx
+ aa3:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ aa6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aa9:	83 c0 08             	add    $0x8,%eax
+ aac:	83 ec 0c             	sub    $0xc,%esp
+ aaf:	50                   	push   %eax
+ ab0:	e8 c8 fe ff ff       	call   97d <free>
+ ab5:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ ab8:	a1 a8 10 00 00       	mov    0x10a8,%eax
+}
+ abd:	c9                   	leave
+ abe:	c3                   	ret
+
+00000abf <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ abf:	55                   	push   %ebp
+ ac0:	89 e5                	mov    %esp,%ebp
+ ac2:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac8:	83 c0 07             	add    $0x7,%eax
+ acb:	c1 e8 03             	shr    $0x3,%eax
+ ace:	83 c0 01             	add    $0x1,%eax
+ ad1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ ad4:	a1 a8 10 00 00       	mov    0x10a8,%eax
+ ad9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ adc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ae0:	75 23                	jne    b05 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ ae2:	c7 45 f0 a0 10 00 00 	movl   $0x10a0,-0x10(%ebp)
+ ae9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aec:	a3 a8 10 00 00       	mov    %eax,0x10a8
+ af1:	a1 a8 10 00 00       	mov    0x10a8,%eax
+ af6:	a3 a0 10 00 00       	mov    %eax,0x10a0
+    base.s.size = 0;
+ afb:	c7 05 a4 10 00 00 00 	movl   $0x0,0x10a4
+ b02:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b05:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b08:	8b 00                	mov    (%eax),%eax
+ b0a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b10:	8b 40 04             	mov    0x4(%eax),%eax
+ b13:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b16:	72 4d                	jb     b65 <malloc+0xa6>
+      if(p->s.size == nunits)
+ b18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b1b:	8b 40 04             	mov    0x4(%eax),%eax
+ b1e:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b21:	75 0c                	jne    b2f <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b26:	8b 10                	mov    (%eax),%edx
+ b28:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b2b:	89 10                	mov    %edx,(%eax)
+ b2d:	eb 26                	jmp    b55 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b32:	8b 40 04             	mov    0x4(%eax),%eax
+ b35:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ b38:	89 c2                	mov    %eax,%edx
+ b3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3d:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ b40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b43:	8b 40 04             	mov    0x4(%eax),%eax
+ b46:	c1 e0 03             	shl    $0x3,%eax
+ b49:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ b4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b4f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ b52:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ b55:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b58:	a3 a8 10 00 00       	mov    %eax,0x10a8
+      return (void*)(p + 1);
+ b5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b60:	83 c0 08             	add    $0x8,%eax
+ b63:	eb 3b                	jmp    ba0 <malloc+0xe1>
+    }
+    if(p == freep)
+ b65:	a1 a8 10 00 00       	mov    0x10a8,%eax
+ b6a:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b6d:	75 1e                	jne    b8d <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b6f:	83 ec 0c             	sub    $0xc,%esp
+ b72:	ff 75 ec             	push   -0x14(%ebp)
+ b75:	e8 e5 fe ff ff       	call   a5f <morecore>
+ b7a:	83 c4 10             	add    $0x10,%esp
+ b7d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b80:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b84:	75 07                	jne    b8d <malloc+0xce>
+        return 0;
+ b86:	b8 00 00 00 00       	mov    $0x0,%eax
+ b8b:	eb 13                	jmp    ba0 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b90:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b96:	8b 00                	mov    (%eax),%eax
+ b98:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b9b:	e9 6d ff ff ff       	jmp    b0d <malloc+0x4e>
+  }
+}
+ ba0:	c9                   	leave
+ ba1:	c3                   	ret
@@ -0,0 +1,120 @@
+// Time grep on a generated file.
+//   grepbench [lines]
+// Writes grepbench.txt (pseudo-random words plus a few long
+// lines of a's), runs grep -c over it for each pattern below
+// and prints the elapsed ticks; then greps four copies of the
+// file sequentially and with -P (one worker per CPU).
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define FILE "grepbench.txt"
+
+char *words[] = {
+  "the", "kernel", "process", "file", "inode", "pipe", "trap", "lock",
+  "sleep", "wakeup", "buffer", "disk", "log", "page", "table", "xv6",
+  "foobaz", "barbaz", "kit", "kaeout",
+};
+
+char *patterns[] = {
+  "xv6",               // literal: prefix skip only
+  "^the",              // anchored
+  "k[aeiou]+t",        // class and repetition
+  "(foo|bar)baz",      // alternation
+  "q.*z$",             // no match; literal prefix rejects lines
+  "a*a*a*a*a*a*b",     // exponential for a backtracking matcher
+};
+
+uint seed = 1;
+
+int
+rnd(int n)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) % n;
+}
+
+char line[128];
+
+void
+mkfile(int nline)
+{
+  int fd, i, n, w;
+
+  if((fd = open(FILE, O_CREATE|O_RDWR)) < 0){
+    printf(2, "grepbench: cannot create %s\n", FILE);
+    exit();
+  }
+  for(i = 0; i < nline; i++){
+    n = 0;
+    if(i % 50 == 49){
+      // Long run of a's with no b.
+      memset(line, 'a', 100);
+      n = 100;
+    } else {
+      for(w = 0; w < 8; w++){
+        strcpy(line+n, words[rnd(sizeof(words)/sizeof(words[0]))]);
+        n += strlen(line+n);
+        line[n++] = ' ';
+      }
+    }
+    line[n++] = '\n';
+    if(write(fd, line, n) != n){
+      printf(2, "grepbench: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+}
+
+// Run grep with args (argv[0] is filled in); return ticks taken.
+int
+rungrep(char **args)
+{
+  uint t0;
+
+  t0 = uptime();
+  if(fork() == 0){
+    args[0] = "grep";
+    exec("grep", args);
+    printf(2, "grepbench: exec grep failed\n");
+    exit();
+  }
+  wait();
+  return uptime() - t0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, nline;
+  char *args[9];
+
+  nline = 1000;
+  if(argc > 1)
+    nline = atoi(argv[1]);
+  mkfile(nline);
+
+  for(i = 0; i < sizeof(patterns)/sizeof(patterns[0]); i++){
+    printf(1, "%s: ", patterns[i]);
+    args[1] = "-c";
+    args[2] = patterns[i];
+    args[3] = FILE;
+    args[4] = 0;
+    printf(1, "%d ticks\n", rungrep(args));
+  }
+
+  for(i = 0; i < 2; i++){
+    printf(1, "%s x4:\n", i ? "-P" : "sequential");
+    args[1] = i ? "-P" : "-c";
+    args[2] = "-c";
+    args[3] = "k[aeiou]+t";
+    args[4] = args[5] = args[6] = args[7] = FILE;
+    args[8] = 0;
+    printf(1, "%d ticks\n", rungrep(args));
+  }
+  unlink(FILE);
+  exit();
+}
@@ -0,0 +1,348 @@
+// Run fs.c, log.c and bio.c as an ordinary host program.
+//
+// Built with -DHOSTFS, which gives struct spinlock a pthread
+// mutex and makes cpu and proc thread-local (see spinlock.h and
+// proc.h).  This file supplies the rest of the kernel those
+// files call: locks, sleep and wakeup, panic, and an iderw()
+// that works on an in-memory disk image like memide.c.  Each
+// host thread that uses the file system acts as one process.
+
+#include <stdio.h>
+#include <stdarg.h>
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "buf.h"
+#include "fs.h"
+#include "file.h"
+#include "hostfs.h"
+
+void abort(void) __attribute__((noreturn));
+void *malloc(unsigned long);
+void free(void*);
+
+struct devsw devsw[NDEV];  // no devices
+
+uchar *hostdisk;
+uint hostnsector;
+unsigned long hostreads, hostwrites;
+void (*hostwritehook)(uint, uchar*);
+
+__thread struct cpu *cpu;
+__thread struct proc *proc;
+
+// sleep() and wakeup() share one condition variable: a sleeper
+// takes hostsleep.mu before releasing its lock, so a wakeup()
+// cannot slip in between.
+static struct {
+  pthread_mutex_t mu;
+  pthread_cond_t cv;
+} hostsleep = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER };
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+  lk->name = name;
+  lk->locked = 0;
+  lk->cpu = 0;
+  pthread_mutex_init(&lk->mu, 0);
+}
+
+int
+holding(struct spinlock *lk)
+{
+  return lk->locked && lk->cpu == cpu;
+}
+
+void
+acquire(struct spinlock *lk)
+{
+  if(holding(lk))
+    panic("acquire");
+  pthread_mutex_lock(&lk->mu);
+  lk->locked = 1;
+  lk->cpu = cpu;
+}
+
+void
+release(struct spinlock *lk)
+{
+  if(!holding(lk))
+    panic("release");
+  lk->cpu = 0;
+  lk->locked = 0;
+  pthread_mutex_unlock(&lk->mu);
+}
+
+// Callers loop until their condition holds, so waking every
+// sleeper on any wakeup() is correct, just not precise.
+void
+sleep(void *chan, struct spinlock *lk)
+{
+  pthread_mutex_lock(&hostsleep.mu);
+  release(lk);
+  pthread_cond_wait(&hostsleep.cv, &hostsleep.mu);
+  pthread_mutex_unlock(&hostsleep.mu);
+  acquire(lk);
+}
+
+void
+wakeup(void *chan)
+{
+  pthread_mutex_lock(&hostsleep.mu);
+  pthread_cond_broadcast(&hostsleep.cv);
+  pthread_mutex_unlock(&hostsleep.mu);
+}
+
+void
+cprintf(char *fmt, ...)
+{
+  va_list ap;
+
+  va_start(ap, fmt);
+  vfprintf(stderr, fmt, ap);
+  va_end(ap);
+}
+
+void
+panic(char *s)
+{
+  fprintf(stderr, "panic: %s\n", s);
+  abort();
+}
+
+// Pages for compressed clusters.
+char*
+kalloc(void)
+{
+  return malloc(PGSIZE);
+}
+
+void
+kfree(char *p)
+{
+  free(p);
+}
+
+void
+iderw(struct buf *b)
+{
+  uchar *p;
+
+  if(!(b->flags & B_BUSY))
+    panic("iderw: buf not busy");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+    panic("iderw: nothing to do");
+  if(b->sector >= hostnsector)
+    panic("iderw: sector out of range");
+
+  p = hostdisk + b->sector*BSIZE;
+  if(b->flags & B_DIRTY){
+    if(hostwritehook)
+      hostwritehook(b->sector, b->data);
+    __sync_fetch_and_add(&hostwrites, 1);
+    b->flags &= ~B_DIRTY;
+    memmove(p, b->data, BSIZE);
+  } else {
+    __sync_fetch_and_add(&hostreads, 1);
+    memmove(b->data, p, BSIZE);
+  }
+  b->flags |= B_VALID;
+}
+
+// Start the file system on hostdisk, as forkret() does the
+// kernel's.  The calling thread becomes the first process.
+void
+hostinit(void)
+{
+  hostrecover();
+  hostreclaim();
+}
+
+// Recover from the log.
+void
+hostrecover(void)
+{
+  binit();
+  iinit();
+  initlog();
+  hostthread();
+}
+
+static void*
+reclaimthread(void *arg)
+{
+  hostthread();
+  reclaimer();
+}
+
+// Free orphaned inodes and start the reclaimer on its own thread.
+void
+hostreclaim(void)
+{
+  pthread_t tid;
+
+  ireclaim(ROOTDEV);
+  pthread_create(&tid, 0, reclaimthread, 0);
+}
+
+// Wait until the reclaimer is idle.
+void
+hostidle(void)
+{
+  reclaimwait();
+}
+
+// Give the calling thread a cpu and a proc, with cwd at the root.
+void
+hostthread(void)
+{
+  static struct cpu cpus[NPROC];
+  static struct proc procs[NPROC];
+  static int n;
+  int i;
+
+  i = __sync_fetch_and_add(&n, 1);
+  if(i >= NPROC)
+    panic("hostthread: too many threads");
+  cpu = &cpus[i];
+  cpu->id = i;
+  proc = &procs[i];
+  proc->cwd = namei("/");
+}
+
+// The calls below run the kernel's own code in transactions of
+// the kernel's sizes: dircreate() and dirunlink() from fs.c with
+// the reservations in param.h, and fileiwrite()'s WRITEBLOCKS().
+struct inode*
+hcreate(char *path, int dir)
+{
+  struct inode *ip;
+
+  begin_op(dir ? MKDIRBLOCKS : CREATEBLOCKS);
+  if((ip = dircreate(proc->cwd, path, dir ? T_DIR : T_FILE, 0, 0)) != 0)
+    iunlock(ip);
+  end_op();
+  return ip;
+}
+
+struct inode*
+hopen(char *path)
+{
+  struct inode *ip;
+
+  begin_op(IPUTBLOCKS);
+  ip = namei(path);
+  end_op();
+  return ip;
+}
+
+void
+hclose(struct inode *ip)
+{
+  begin_op(IPUTBLOCKS);
+  iput(ip);
+  end_op();
+}
+
+int
+hread(struct inode *ip, char *dst, uint off, int n)
+{
+  ilock(ip);
+  n = readi(ip, dst, off, n);
+  iunlock(ip);
+  return n;
+}
+
+// As fileiwrite() in file.c: a few blocks per transaction.
+int
+hwrite(struct inode *ip, char *src, uint off, int n)
+{
+  int r, max, i, n1;
+
+  max = WRITEMAX;
+  for(i = 0; i < n; i += r){
+    n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+    begin_op(WRITEBLOCKS(n1));
+    ilock(ip);
+    r = writei(ip, src + i, off + i, n1);
+    iunlock(ip);
+    end_op();
+    if(r < 0 || (r != n1 && iexpand(ip, off + i + r) < 0))
+      return -1;
+  }
+  return n;
+}
+
+// As filecopy() in file.c.
+int
+hcopy(struct inode *dst, uint doff, struct inode *src, uint soff, int n)
+{
+  struct inode *a, *b;
+  int r, i, n1, eof;
+
+  a = src->inum < dst->inum ? src : dst;
+  b = a == src ? dst : src;
+  for(i = 0; i < n; i += r){
+    n1 = n - i;
+    if(n1 > WRITEMAX)
+      n1 = WRITEMAX;
+    begin_op(WRITEBLOCKS(n1));
+    ilock(a);
+    if(b != a)
+      ilock(b);
+    r = copyi(dst, doff + i, src, soff + i, n1);
+    eof = soff + i + r >= src->size;
+    if(b != a)
+      iunlock(b);
+    iunlock(a);
+    end_op();
+    if(r < 0)
+      return -1;
+    if(r < n1 && (eof || iexpand(dst, doff + i + r) < 0))
+      return i + r;
+  }
+  return n;
+}
+
+// As sys_fsctl(FS_DEFRAG) and sys_fsctl(FS_COMPRESS).
+int
+hdefrag(struct inode *ip)
+{
+  return idefrag(ip);
+}
+
+int
+hcompress(struct inode *ip)
+{
+  return icompress(ip);
+}
+
+int
+hunlink(char *path)
+{
+  int r;
+
+  begin_op(UNLINKBLOCKS);
+  r = dirunlink(proc->cwd, path);
+  end_op();
+  return r;
+}
+
+uint
+hsize(struct inode *ip)
+{
+  uint n;
+
+  ilock(ip);
+  n = ip->size;
+  iunlock(ip);
+  return n;
+}
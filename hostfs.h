@@ -0,0 +1,42 @@
+// Interface to the host build of the file system (hostfs.c).
+// Programs using it include only this and the host's headers:
+// defs.h declares kernel functions (exit, sleep, ...) whose
+// names clash with the C library's.
+
+struct inode;
+
+// The disk: hostnsector 512-byte sectors at hostdisk, set up by
+// the caller before hostinit().
+extern unsigned char *hostdisk;
+extern unsigned int hostnsector;
+
+// Sectors read and written through iderw().
+extern unsigned long hostreads, hostwrites;
+
+// If set, called with every sector iderw() is about to write.
+extern void (*hostwritehook)(unsigned int sector, unsigned char *data);
+
+// hostinit() is hostrecover(), recovery from the log, then
+// hostreclaim(), which frees orphaned inodes and starts the
+// reclaimer thread that frees large unlinked files.
+void hostinit(void);
+void hostrecover(void);
+void hostreclaim(void);
+void hostthread(void);
+
+// Wait until the reclaimer has nothing left to free.
+void hostidle(void);
+
+// File operations, following sysfile.c.  Inodes are returned
+// referenced and unlocked; release them with hclose().
+struct inode* hcreate(char *path, int dir);
+struct inode* hopen(char *path);
+void hclose(struct inode *ip);
+int hread(struct inode *ip, char *dst, unsigned int off, int n);
+int hwrite(struct inode *ip, char *src, unsigned int off, int n);
+int hcopy(struct inode *dst, unsigned int doff, struct inode *src,
+          unsigned int soff, int n);
+int hdefrag(struct inode *ip);
+int hcompress(struct inode *ip);
+int hunlink(char *path);
+unsigned int hsize(struct inode *ip);
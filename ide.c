@@ -25,9 +25,11 @@
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idebusy;  // idesoftirq() is transferring idequeue's data
 
 static int havedisk1;
 static void idestart(struct buf*);
+static void idesoftirq(void);
 
 
 // idewait関数は、ビジービット（IDE_BSY）がクリアされ準備完了ビット（IDE_DRDY）がセットされるまで、その状態ビットをポーリングする。
@@ -52,6 +54,7 @@ ideinit(void)
 
    // ideロックを初期化する
   initlock(&idelock, "ide");
+  setsoftirq(SOFTIRQ_IDE, idesoftirq);
 
   // ユニプロセッサ上で割り込みを有効にする
   picenable(IRQ_IDE);
@@ -121,35 +124,52 @@ idestart(struct buf *b)
   }
 }
 
-// Interrupt handler.
+// Interrupt handler.  Reading the status register acknowledges
+// the interrupt; the 512-byte transfer and the wakeup are left to
+// idesoftirq(), which runs with interrupts enabled.
 void
 ideintr(void)
+{
+  inb(0x1f7);
+  raisesoftirq(SOFTIRQ_IDE);
+}
+
+// Finish the active request.  The disk does nothing more until
+// idestart() is called, so the data can be copied without idelock
+// held; idebusy keeps a second (spurious) interrupt on another CPU
+// from finishing the same request twice.
+static void
+idesoftirq(void)
 {
   struct buf *b;
 
   // First queued buffer is the active request.
   acquire(&idelock);
-  if((b = idequeue) == 0){
+  if((b = idequeue) == 0 || idebusy){
     release(&idelock);
     // cprintf("spurious IDE interrupt\n");
     return;
   }
-  idequeue = b->qnext;
+  idebusy = 1;
+  release(&idelock);
 
   // Read data if needed.
   if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
     insl(0x1f0, b->data, 512/4);   // 必要あればディスクからデータ読み込みのために512/4回ループする 
-  
-  // Wake process waiting for this buf.
+
+  acquire(&idelock);
+  idequeue = b->qnext;
+  idebusy = 0;
   b->flags |= B_VALID;
   b->flags &= ~B_DIRTY;
-  wakeup(b);
-  
+
   // Start disk on next buf in queue.
   if(idequeue != 0)
     idestart(idequeue);
-
   release(&idelock);
+
+  // Wake process waiting for this buf.
+  wakeup(b);
 }
 
 //PAGEBREAK!
@@ -0,0 +1,1315 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 4c 09 00 00       	push   $0x94c
+  1b:	e8 b6 03 00 00       	call   3d6 <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 4c 09 00 00       	push   $0x94c
+  33:	e8 a6 03 00 00       	call   3de <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 4c 09 00 00       	push   $0x94c
+  45:	e8 8c 03 00 00       	call   3d6 <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 b7 03 00 00       	call   40e <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 aa 03 00 00       	call   40e <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 54 09 00 00       	push   $0x954
+  6f:	6a 01                	push   $0x1
+  71:	e8 1c 05 00 00       	call   592 <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  79:	e8 10 03 00 00       	call   38e <fork>
+  7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+  81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  85:	79 17                	jns    9e <main+0x9e>
+      printf(1, "init: fork failed\n");
+  87:	83 ec 08             	sub    $0x8,%esp
+  8a:	68 67 09 00 00       	push   $0x967
+  8f:	6a 01                	push   $0x1
+  91:	e8 fc 04 00 00       	call   592 <printf>
+  96:	83 c4 10             	add    $0x10,%esp
+      exit();
+  99:	e8 f8 02 00 00       	call   396 <exit>
+    }
+    if(pid == 0){
+  9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a2:	75 3e                	jne    e2 <main+0xe2>
+      exec("sh", argv);
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	68 04 0c 00 00       	push   $0xc04
+  ac:	68 49 09 00 00       	push   $0x949
+  b1:	e8 18 03 00 00       	call   3ce <exec>
+  b6:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+  b9:	83 ec 08             	sub    $0x8,%esp
+  bc:	68 7a 09 00 00       	push   $0x97a
+  c1:	6a 01                	push   $0x1
+  c3:	e8 ca 04 00 00       	call   592 <printf>
+  c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+  cb:	e8 c6 02 00 00       	call   396 <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 90 09 00 00       	push   $0x990
+  d8:	6a 01                	push   $0x1
+  da:	e8 b3 04 00 00       	call   592 <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  e2:	e8 b7 02 00 00       	call   39e <wait>
+  e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  ee:	0f 88 73 ff ff ff    	js     67 <main+0x67>
+  f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  f7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  fa:	75 d4                	jne    d0 <main+0xd0>
+    printf(1, "init: starting sh\n");
+  fc:	e9 66 ff ff ff       	jmp    67 <main+0x67>
+
+00000101 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 101:	55                   	push   %ebp
+ 102:	89 e5                	mov    %esp,%ebp
+ 104:	57                   	push   %edi
+ 105:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 55 10             	mov    0x10(%ebp),%edx
+ 10c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10f:	89 cb                	mov    %ecx,%ebx
+ 111:	89 df                	mov    %ebx,%edi
+ 113:	89 d1                	mov    %edx,%ecx
+ 115:	fc                   	cld
+ 116:	f3 aa                	rep stos %al,%es:(%edi)
+ 118:	89 ca                	mov    %ecx,%edx
+ 11a:	89 fb                	mov    %edi,%ebx
+ 11c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 11f:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 122:	90                   	nop
+ 123:	5b                   	pop    %ebx
+ 124:	5f                   	pop    %edi
+ 125:	5d                   	pop    %ebp
+ 126:	c3                   	ret
+
+00000127 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 12d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 130:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 133:	90                   	nop
+ 134:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 137:	8d 42 01             	lea    0x1(%edx),%eax
+ 13a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 13d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 140:	8d 48 01             	lea    0x1(%eax),%ecx
+ 143:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 146:	0f b6 12             	movzbl (%edx),%edx
+ 149:	88 10                	mov    %dl,(%eax)
+ 14b:	0f b6 00             	movzbl (%eax),%eax
+ 14e:	84 c0                	test   %al,%al
+ 150:	75 e2                	jne    134 <strcpy+0xd>
+    ;
+  return os;
+ 152:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 155:	c9                   	leave
+ 156:	c3                   	ret
+
+00000157 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 157:	55                   	push   %ebp
+ 158:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 15a:	eb 08                	jmp    164 <strcmp+0xd>
+    p++, q++;
+ 15c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 160:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 164:	8b 45 08             	mov    0x8(%ebp),%eax
+ 167:	0f b6 00             	movzbl (%eax),%eax
+ 16a:	84 c0                	test   %al,%al
+ 16c:	74 10                	je     17e <strcmp+0x27>
+ 16e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 171:	0f b6 10             	movzbl (%eax),%edx
+ 174:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 c2                	cmp    %al,%dl
+ 17c:	74 de                	je     15c <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	0f b6 00             	movzbl (%eax),%eax
+ 184:	0f b6 d0             	movzbl %al,%edx
+ 187:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18a:	0f b6 00             	movzbl (%eax),%eax
+ 18d:	0f b6 c0             	movzbl %al,%eax
+ 190:	29 c2                	sub    %eax,%edx
+ 192:	89 d0                	mov    %edx,%eax
+}
+ 194:	5d                   	pop    %ebp
+ 195:	c3                   	ret
+
+00000196 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 196:	55                   	push   %ebp
+ 197:	89 e5                	mov    %esp,%ebp
+ 199:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 19c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1a3:	eb 04                	jmp    1a9 <strlen+0x13>
+ 1a5:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1a9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1af:	01 d0                	add    %edx,%eax
+ 1b1:	0f b6 00             	movzbl (%eax),%eax
+ 1b4:	84 c0                	test   %al,%al
+ 1b6:	75 ed                	jne    1a5 <strlen+0xf>
+    ;
+  return n;
+ 1b8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1bb:	c9                   	leave
+ 1bc:	c3                   	ret
+
+000001bd <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1c0:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1c3:	50                   	push   %eax
+ 1c4:	ff 75 0c             	push   0xc(%ebp)
+ 1c7:	ff 75 08             	push   0x8(%ebp)
+ 1ca:	e8 32 ff ff ff       	call   101 <stosb>
+ 1cf:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1d5:	c9                   	leave
+ 1d6:	c3                   	ret
+
+000001d7 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d7:	55                   	push   %ebp
+ 1d8:	89 e5                	mov    %esp,%ebp
+ 1da:	83 ec 04             	sub    $0x4,%esp
+ 1dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e0:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1e3:	eb 14                	jmp    1f9 <strchr+0x22>
+    if(*s == c)
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e8:	0f b6 00             	movzbl (%eax),%eax
+ 1eb:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1ee:	75 05                	jne    1f5 <strchr+0x1e>
+      return (char*)s;
+ 1f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f3:	eb 13                	jmp    208 <strchr+0x31>
+  for(; *s; s++)
+ 1f5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	0f b6 00             	movzbl (%eax),%eax
+ 1ff:	84 c0                	test   %al,%al
+ 201:	75 e2                	jne    1e5 <strchr+0xe>
+  return 0;
+ 203:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 208:	c9                   	leave
+ 209:	c3                   	ret
+
+0000020a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 20a:	55                   	push   %ebp
+ 20b:	89 e5                	mov    %esp,%ebp
+ 20d:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 210:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 217:	eb 42                	jmp    25b <gets+0x51>
+    cc = read(0, &c, 1);
+ 219:	83 ec 04             	sub    $0x4,%esp
+ 21c:	6a 01                	push   $0x1
+ 21e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 221:	50                   	push   %eax
+ 222:	6a 00                	push   $0x0
+ 224:	e8 85 01 00 00       	call   3ae <read>
+ 229:	83 c4 10             	add    $0x10,%esp
+ 22c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 22f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 233:	7e 33                	jle    268 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 235:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 238:	8d 50 01             	lea    0x1(%eax),%edx
+ 23b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 23e:	89 c2                	mov    %eax,%edx
+ 240:	8b 45 08             	mov    0x8(%ebp),%eax
+ 243:	01 c2                	add    %eax,%edx
+ 245:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 249:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 24b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 24f:	3c 0a                	cmp    $0xa,%al
+ 251:	74 16                	je     269 <gets+0x5f>
+ 253:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 257:	3c 0d                	cmp    $0xd,%al
+ 259:	74 0e                	je     269 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 25b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 25e:	83 c0 01             	add    $0x1,%eax
+ 261:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 264:	7f b3                	jg     219 <gets+0xf>
+ 266:	eb 01                	jmp    269 <gets+0x5f>
+      break;
+ 268:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 269:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 26c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26f:	01 d0                	add    %edx,%eax
+ 271:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 274:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+ 27c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 27f:	83 ec 08             	sub    $0x8,%esp
+ 282:	6a 00                	push   $0x0
+ 284:	ff 75 08             	push   0x8(%ebp)
+ 287:	e8 4a 01 00 00       	call   3d6 <open>
+ 28c:	83 c4 10             	add    $0x10,%esp
+ 28f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 292:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 296:	79 07                	jns    29f <stat+0x26>
+    return -1;
+ 298:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 29d:	eb 25                	jmp    2c4 <stat+0x4b>
+  r = fstat(fd, st);
+ 29f:	83 ec 08             	sub    $0x8,%esp
+ 2a2:	ff 75 0c             	push   0xc(%ebp)
+ 2a5:	ff 75 f4             	push   -0xc(%ebp)
+ 2a8:	e8 41 01 00 00       	call   3ee <fstat>
+ 2ad:	83 c4 10             	add    $0x10,%esp
+ 2b0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 2b3:	83 ec 0c             	sub    $0xc,%esp
+ 2b6:	ff 75 f4             	push   -0xc(%ebp)
+ 2b9:	e8 00 01 00 00       	call   3be <close>
+ 2be:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 2cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2d3:	eb 25                	jmp    2fa <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2d5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2d8:	89 d0                	mov    %edx,%eax
+ 2da:	c1 e0 02             	shl    $0x2,%eax
+ 2dd:	01 d0                	add    %edx,%eax
+ 2df:	01 c0                	add    %eax,%eax
+ 2e1:	89 c1                	mov    %eax,%ecx
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	8d 50 01             	lea    0x1(%eax),%edx
+ 2e9:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2ec:	0f b6 00             	movzbl (%eax),%eax
+ 2ef:	0f be c0             	movsbl %al,%eax
+ 2f2:	01 c8                	add    %ecx,%eax
+ 2f4:	83 e8 30             	sub    $0x30,%eax
+ 2f7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fd:	0f b6 00             	movzbl (%eax),%eax
+ 300:	3c 2f                	cmp    $0x2f,%al
+ 302:	7e 0a                	jle    30e <atoi+0x48>
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+ 307:	0f b6 00             	movzbl (%eax),%eax
+ 30a:	3c 39                	cmp    $0x39,%al
+ 30c:	7e c7                	jle    2d5 <atoi+0xf>
+  return n;
+ 30e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 311:	c9                   	leave
+ 312:	c3                   	ret
+
+00000313 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 313:	55                   	push   %ebp
+ 314:	89 e5                	mov    %esp,%ebp
+ 316:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 31f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 322:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 325:	eb 17                	jmp    33e <memmove+0x2b>
+    *dst++ = *src++;
+ 327:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 32a:	8d 42 01             	lea    0x1(%edx),%eax
+ 32d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 330:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 333:	8d 48 01             	lea    0x1(%eax),%ecx
+ 336:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 339:	0f b6 12             	movzbl (%edx),%edx
+ 33c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 33e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 341:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 344:	89 55 10             	mov    %edx,0x10(%ebp)
+ 347:	85 c0                	test   %eax,%eax
+ 349:	7f dc                	jg     327 <memmove+0x14>
+  return vdst;
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 34e:	c9                   	leave
+ 34f:	c3                   	ret
+
+00000350 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 356:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 35d:	eb 04                	jmp    363 <ncpus+0x13>
+ 35f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 363:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 367:	7f 16                	jg     37f <ncpus+0x2f>
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 36f:	50                   	push   %eax
+ 370:	ff 75 f4             	push   -0xc(%ebp)
+ 373:	e8 d6 00 00 00       	call   44e <intrstat>
+ 378:	83 c4 10             	add    $0x10,%esp
+ 37b:	85 c0                	test   %eax,%eax
+ 37d:	74 e0                	je     35f <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 37f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 382:	ba 01 00 00 00       	mov    $0x1,%edx
+ 387:	85 c0                	test   %eax,%eax
+ 389:	0f 4e c2             	cmovle %edx,%eax
+}
+ 38c:	c9                   	leave
+ 38d:	c3                   	ret
+
+0000038e <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 38e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 393:	cd 40                	int    $0x40
+ 395:	c3                   	ret
+
+00000396 <exit>:
+SYSCALL(exit)
+ 396:	b8 02 00 00 00       	mov    $0x2,%eax
+ 39b:	cd 40                	int    $0x40
+ 39d:	c3                   	ret
+
+0000039e <wait>:
+SYSCALL(wait)
+ 39e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3a3:	cd 40                	int    $0x40
+ 3a5:	c3                   	ret
+
+000003a6 <pipe>:
+SYSCALL(pipe)
+ 3a6:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3ab:	cd 40                	int    $0x40
+ 3ad:	c3                   	ret
+
+000003ae <read>:
+SYSCALL(read)
+ 3ae:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3b3:	cd 40                	int    $0x40
+ 3b5:	c3                   	ret
+
+000003b6 <write>:
+SYSCALL(write)
+ 3b6:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3bb:	cd 40                	int    $0x40
+ 3bd:	c3                   	ret
+
+000003be <close>:
+SYSCALL(close)
+ 3be:	b8 15 00 00 00       	mov    $0x15,%eax
+ 3c3:	cd 40                	int    $0x40
+ 3c5:	c3                   	ret
+
+000003c6 <kill>:
+SYSCALL(kill)
+ 3c6:	b8 06 00 00 00       	mov    $0x6,%eax
+ 3cb:	cd 40                	int    $0x40
+ 3cd:	c3                   	ret
+
+000003ce <exec>:
+SYSCALL(exec)
+ 3ce:	b8 07 00 00 00       	mov    $0x7,%eax
+ 3d3:	cd 40                	int    $0x40
+ 3d5:	c3                   	ret
+
+000003d6 <open>:
+SYSCALL(open)
+ 3d6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 3db:	cd 40                	int    $0x40
+ 3dd:	c3                   	ret
+
+000003de <mknod>:
+SYSCALL(mknod)
+ 3de:	b8 11 00 00 00       	mov    $0x11,%eax
+ 3e3:	cd 40                	int    $0x40
+ 3e5:	c3                   	ret
+
+000003e6 <unlink>:
+SYSCALL(unlink)
+ 3e6:	b8 12 00 00 00       	mov    $0x12,%eax
+ 3eb:	cd 40                	int    $0x40
+ 3ed:	c3                   	ret
+
+000003ee <fstat>:
+SYSCALL(fstat)
+ 3ee:	b8 08 00 00 00       	mov    $0x8,%eax
+ 3f3:	cd 40                	int    $0x40
+ 3f5:	c3                   	ret
+
+000003f6 <link>:
+SYSCALL(link)
+ 3f6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3fb:	cd 40                	int    $0x40
+ 3fd:	c3                   	ret
+
+000003fe <mkdir>:
+SYSCALL(mkdir)
+ 3fe:	b8 14 00 00 00       	mov    $0x14,%eax
+ 403:	cd 40                	int    $0x40
+ 405:	c3                   	ret
+
+00000406 <chdir>:
+SYSCALL(chdir)
+ 406:	b8 09 00 00 00       	mov    $0x9,%eax
+ 40b:	cd 40                	int    $0x40
+ 40d:	c3                   	ret
+
+0000040e <dup>:
+SYSCALL(dup)
+ 40e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 413:	cd 40                	int    $0x40
+ 415:	c3                   	ret
+
+00000416 <getpid>:
+SYSCALL(getpid)
+ 416:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 41b:	cd 40                	int    $0x40
+ 41d:	c3                   	ret
+
+0000041e <sbrk>:
+SYSCALL(sbrk)
+ 41e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 423:	cd 40                	int    $0x40
+ 425:	c3                   	ret
+
+00000426 <sleep>:
+SYSCALL(sleep)
+ 426:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 42b:	cd 40                	int    $0x40
+ 42d:	c3                   	ret
+
+0000042e <uptime>:
+SYSCALL(uptime)
+ 42e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 433:	cd 40                	int    $0x40
+ 435:	c3                   	ret
+
+00000436 <poll>:
+SYSCALL(poll)
+ 436:	b8 16 00 00 00       	mov    $0x16,%eax
+ 43b:	cd 40                	int    $0x40
+ 43d:	c3                   	ret
+
+0000043e <fcntl>:
+SYSCALL(fcntl)
+ 43e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 443:	cd 40                	int    $0x40
+ 445:	c3                   	ret
+
+00000446 <irqroute>:
+SYSCALL(irqroute)
+ 446:	b8 18 00 00 00       	mov    $0x18,%eax
+ 44b:	cd 40                	int    $0x40
+ 44d:	c3                   	ret
+
+0000044e <intrstat>:
+SYSCALL(intrstat)
+ 44e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 453:	cd 40                	int    $0x40
+ 455:	c3                   	ret
+
+00000456 <pread>:
+SYSCALL(pread)
+ 456:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 45b:	cd 40                	int    $0x40
+ 45d:	c3                   	ret
+
+0000045e <getdents>:
+SYSCALL(getdents)
+ 45e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 463:	cd 40                	int    $0x40
+ 465:	c3                   	ret
+
+00000466 <fstatat>:
+SYSCALL(fstatat)
+ 466:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 46b:	cd 40                	int    $0x40
+ 46d:	c3                   	ret
+
+0000046e <openat>:
+SYSCALL(openat)
+ 46e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 473:	cd 40                	int    $0x40
+ 475:	c3                   	ret
+
+00000476 <unlinkat>:
+SYSCALL(unlinkat)
+ 476:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 47b:	cd 40                	int    $0x40
+ 47d:	c3                   	ret
+
+0000047e <mkdirat>:
+SYSCALL(mkdirat)
+ 47e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 483:	cd 40                	int    $0x40
+ 485:	c3                   	ret
+
+00000486 <linkat>:
+SYSCALL(linkat)
+ 486:	b8 20 00 00 00       	mov    $0x20,%eax
+ 48b:	cd 40                	int    $0x40
+ 48d:	c3                   	ret
+
+0000048e <exits>:
+SYSCALL(exits)
+ 48e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 493:	cd 40                	int    $0x40
+ 495:	c3                   	ret
+
+00000496 <waitstatus>:
+SYSCALL(waitstatus)
+ 496:	b8 22 00 00 00       	mov    $0x22,%eax
+ 49b:	cd 40                	int    $0x40
+ 49d:	c3                   	ret
+
+0000049e <pwrite>:
+SYSCALL(pwrite)
+ 49e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4a3:	cd 40                	int    $0x40
+ 4a5:	c3                   	ret
+
+000004a6 <lseek>:
+SYSCALL(lseek)
+ 4a6:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4ab:	cd 40                	int    $0x40
+ 4ad:	c3                   	ret
+
+000004ae <copyfilerange>:
+SYSCALL(copyfilerange)
+ 4ae:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4b3:	cd 40                	int    $0x40
+ 4b5:	c3                   	ret
+
+000004b6 <fsctl>:
+SYSCALL(fsctl)
+ 4b6:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4bb:	cd 40                	int    $0x40
+ 4bd:	c3                   	ret
+
+000004be <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 4be:	55                   	push   %ebp
+ 4bf:	89 e5                	mov    %esp,%ebp
+ 4c1:	83 ec 18             	sub    $0x18,%esp
+ 4c4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c7:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 4ca:	83 ec 04             	sub    $0x4,%esp
+ 4cd:	6a 01                	push   $0x1
+ 4cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 4d2:	50                   	push   %eax
+ 4d3:	ff 75 08             	push   0x8(%ebp)
+ 4d6:	e8 db fe ff ff       	call   3b6 <write>
+ 4db:	83 c4 10             	add    $0x10,%esp
+}
+ 4de:	90                   	nop
+ 4df:	c9                   	leave
+ 4e0:	c3                   	ret
+
+000004e1 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e1:	55                   	push   %ebp
+ 4e2:	89 e5                	mov    %esp,%ebp
+ 4e4:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 4e7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4ee:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4f2:	74 17                	je     50b <printint+0x2a>
+ 4f4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4f8:	79 11                	jns    50b <printint+0x2a>
+    neg = 1;
+ 4fa:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 501:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 504:	f7 d8                	neg    %eax
+ 506:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 509:	eb 06                	jmp    511 <printint+0x30>
+  } else {
+    x = xx;
+ 50b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 50e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 511:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 518:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 51b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 51e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 523:	f7 f1                	div    %ecx
+ 525:	89 d1                	mov    %edx,%ecx
+ 527:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 52a:	8d 50 01             	lea    0x1(%eax),%edx
+ 52d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 530:	0f b6 91 0c 0c 00 00 	movzbl 0xc0c(%ecx),%edx
+ 537:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 53b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 53e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 541:	ba 00 00 00 00       	mov    $0x0,%edx
+ 546:	f7 f1                	div    %ecx
+ 548:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 54b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 54f:	75 c7                	jne    518 <printint+0x37>
+  if(neg)
+ 551:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 555:	74 2d                	je     584 <printint+0xa3>
+    buf[i++] = '-';
+ 557:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 55a:	8d 50 01             	lea    0x1(%eax),%edx
+ 55d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 560:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 565:	eb 1d                	jmp    584 <printint+0xa3>
+    putc(fd, buf[i]);
+ 567:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 56a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 56d:	01 d0                	add    %edx,%eax
+ 56f:	0f b6 00             	movzbl (%eax),%eax
+ 572:	0f be c0             	movsbl %al,%eax
+ 575:	83 ec 08             	sub    $0x8,%esp
+ 578:	50                   	push   %eax
+ 579:	ff 75 08             	push   0x8(%ebp)
+ 57c:	e8 3d ff ff ff       	call   4be <putc>
+ 581:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 584:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 588:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 58c:	79 d9                	jns    567 <printint+0x86>
+}
+ 58e:	90                   	nop
+ 58f:	90                   	nop
+ 590:	c9                   	leave
+ 591:	c3                   	ret
+
+00000592 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 592:	55                   	push   %ebp
+ 593:	89 e5                	mov    %esp,%ebp
+ 595:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 598:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 59f:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5a2:	83 c0 04             	add    $0x4,%eax
+ 5a5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5a8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 5af:	e9 59 01 00 00       	jmp    70d <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 5b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5ba:	01 d0                	add    %edx,%eax
+ 5bc:	0f b6 00             	movzbl (%eax),%eax
+ 5bf:	0f be c0             	movsbl %al,%eax
+ 5c2:	25 ff 00 00 00       	and    $0xff,%eax
+ 5c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 5ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5ce:	75 2c                	jne    5fc <printf+0x6a>
+      if(c == '%'){
+ 5d0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5d4:	75 0c                	jne    5e2 <printf+0x50>
+        state = '%';
+ 5d6:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 5dd:	e9 27 01 00 00       	jmp    709 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 5e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5e5:	0f be c0             	movsbl %al,%eax
+ 5e8:	83 ec 08             	sub    $0x8,%esp
+ 5eb:	50                   	push   %eax
+ 5ec:	ff 75 08             	push   0x8(%ebp)
+ 5ef:	e8 ca fe ff ff       	call   4be <putc>
+ 5f4:	83 c4 10             	add    $0x10,%esp
+ 5f7:	e9 0d 01 00 00       	jmp    709 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5fc:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 600:	0f 85 03 01 00 00    	jne    709 <printf+0x177>
+      if(c == 'd'){
+ 606:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 60a:	75 1e                	jne    62a <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 60c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 60f:	8b 00                	mov    (%eax),%eax
+ 611:	6a 01                	push   $0x1
+ 613:	6a 0a                	push   $0xa
+ 615:	50                   	push   %eax
+ 616:	ff 75 08             	push   0x8(%ebp)
+ 619:	e8 c3 fe ff ff       	call   4e1 <printint>
+ 61e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 621:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 625:	e9 d8 00 00 00       	jmp    702 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 62a:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 62e:	74 06                	je     636 <printf+0xa4>
+ 630:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 634:	75 1e                	jne    654 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 636:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 639:	8b 00                	mov    (%eax),%eax
+ 63b:	6a 00                	push   $0x0
+ 63d:	6a 10                	push   $0x10
+ 63f:	50                   	push   %eax
+ 640:	ff 75 08             	push   0x8(%ebp)
+ 643:	e8 99 fe ff ff       	call   4e1 <printint>
+ 648:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 64b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 64f:	e9 ae 00 00 00       	jmp    702 <printf+0x170>
+      } else if(c == 's'){
+ 654:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 658:	75 43                	jne    69d <printf+0x10b>
+        s = (char*)*ap;
+ 65a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 65d:	8b 00                	mov    (%eax),%eax
+ 65f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 662:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 666:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 66a:	75 25                	jne    691 <printf+0xff>
+          s = "(null)";
+ 66c:	c7 45 f4 99 09 00 00 	movl   $0x999,-0xc(%ebp)
+        while(*s != 0){
+ 673:	eb 1c                	jmp    691 <printf+0xff>
+          putc(fd, *s);
+ 675:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 678:	0f b6 00             	movzbl (%eax),%eax
+ 67b:	0f be c0             	movsbl %al,%eax
+ 67e:	83 ec 08             	sub    $0x8,%esp
+ 681:	50                   	push   %eax
+ 682:	ff 75 08             	push   0x8(%ebp)
+ 685:	e8 34 fe ff ff       	call   4be <putc>
+ 68a:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 68d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 691:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 694:	0f b6 00             	movzbl (%eax),%eax
+ 697:	84 c0                	test   %al,%al
+ 699:	75 da                	jne    675 <printf+0xe3>
+ 69b:	eb 65                	jmp    702 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 69d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6a1:	75 1d                	jne    6c0 <printf+0x12e>
+        putc(fd, *ap);
+ 6a3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a6:	8b 00                	mov    (%eax),%eax
+ 6a8:	0f be c0             	movsbl %al,%eax
+ 6ab:	83 ec 08             	sub    $0x8,%esp
+ 6ae:	50                   	push   %eax
+ 6af:	ff 75 08             	push   0x8(%ebp)
+ 6b2:	e8 07 fe ff ff       	call   4be <putc>
+ 6b7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6ba:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6be:	eb 42                	jmp    702 <printf+0x170>
+      } else if(c == '%'){
+ 6c0:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6c4:	75 17                	jne    6dd <printf+0x14b>
+        putc(fd, c);
+ 6c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6c9:	0f be c0             	movsbl %al,%eax
+ 6cc:	83 ec 08             	sub    $0x8,%esp
+ 6cf:	50                   	push   %eax
+ 6d0:	ff 75 08             	push   0x8(%ebp)
+ 6d3:	e8 e6 fd ff ff       	call   4be <putc>
+ 6d8:	83 c4 10             	add    $0x10,%esp
+ 6db:	eb 25                	jmp    702 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 6dd:	83 ec 08             	sub    $0x8,%esp
+ 6e0:	6a 25                	push   $0x25
+ 6e2:	ff 75 08             	push   0x8(%ebp)
+ 6e5:	e8 d4 fd ff ff       	call   4be <putc>
+ 6ea:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 6ed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6f0:	0f be c0             	movsbl %al,%eax
+ 6f3:	83 ec 08             	sub    $0x8,%esp
+ 6f6:	50                   	push   %eax
+ 6f7:	ff 75 08             	push   0x8(%ebp)
+ 6fa:	e8 bf fd ff ff       	call   4be <putc>
+ 6ff:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 702:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 709:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 70d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 710:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 713:	01 d0                	add    %edx,%eax
+ 715:	0f b6 00             	movzbl (%eax),%eax
+ 718:	84 c0                	test   %al,%al
+ 71a:	0f 85 94 fe ff ff    	jne    5b4 <printf+0x22>
+    }
+  }
+}
+ 720:	90                   	nop
+ 721:	90                   	nop
+ 722:	c9                   	leave
+ 723:	c3                   	ret
+
+00000724 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 724:	55                   	push   %ebp
+ 725:	89 e5                	mov    %esp,%ebp
+ 727:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 72a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72d:	83 e8 08             	sub    $0x8,%eax
+ 730:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 733:	a1 28 0c 00 00       	mov    0xc28,%eax
+ 738:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 73b:	eb 24                	jmp    761 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 73d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 740:	8b 00                	mov    (%eax),%eax
+ 742:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 745:	72 12                	jb     759 <free+0x35>
+ 747:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 74d:	72 24                	jb     773 <free+0x4f>
+ 74f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 752:	8b 00                	mov    (%eax),%eax
+ 754:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 757:	72 1a                	jb     773 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 759:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75c:	8b 00                	mov    (%eax),%eax
+ 75e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 761:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 764:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 767:	73 d4                	jae    73d <free+0x19>
+ 769:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76c:	8b 00                	mov    (%eax),%eax
+ 76e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 771:	73 ca                	jae    73d <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 773:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 776:	8b 40 04             	mov    0x4(%eax),%eax
+ 779:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 780:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 783:	01 c2                	add    %eax,%edx
+ 785:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 788:	8b 00                	mov    (%eax),%eax
+ 78a:	39 c2                	cmp    %eax,%edx
+ 78c:	75 24                	jne    7b2 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 78e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 791:	8b 50 04             	mov    0x4(%eax),%edx
+ 794:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 797:	8b 00                	mov    (%eax),%eax
+ 799:	8b 40 04             	mov    0x4(%eax),%eax
+ 79c:	01 c2                	add    %eax,%edx
+ 79e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7a1:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a7:	8b 00                	mov    (%eax),%eax
+ 7a9:	8b 10                	mov    (%eax),%edx
+ 7ab:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ae:	89 10                	mov    %edx,(%eax)
+ 7b0:	eb 0a                	jmp    7bc <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 7b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7b5:	8b 10                	mov    (%eax),%edx
+ 7b7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ba:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 7bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7bf:	8b 40 04             	mov    0x4(%eax),%eax
+ 7c2:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7cc:	01 d0                	add    %edx,%eax
+ 7ce:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7d1:	75 20                	jne    7f3 <free+0xcf>
+    p->s.size += bp->s.size;
+ 7d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d6:	8b 50 04             	mov    0x4(%eax),%edx
+ 7d9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7dc:	8b 40 04             	mov    0x4(%eax),%eax
+ 7df:	01 c2                	add    %eax,%edx
+ 7e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e4:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 7e7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ea:	8b 10                	mov    (%eax),%edx
+ 7ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ef:	89 10                	mov    %edx,(%eax)
+ 7f1:	eb 08                	jmp    7fb <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 7f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 7f9:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 7fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fe:	a3 28 0c 00 00       	mov    %eax,0xc28
+}
+ 803:	90                   	nop
+ 804:	c9                   	leave
+ 805:	c3                   	ret
+
+00000806 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 806:	55                   	push   %ebp
+ 807:	89 e5                	mov    %esp,%ebp
+ 809:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 80c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 813:	77 07                	ja     81c <morecore+0x16>
+    nu = 4096;
+ 815:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 81c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 81f:	c1 e0 03             	shl    $0x3,%eax
+ 822:	83 ec 0c             	sub    $0xc,%esp
+ 825:	50                   	push   %eax
+ 826:	e8 f3 fb ff ff       	call   41e <sbrk>
+ 82b:	83 c4 10             	add    $0x10,%esp
+ 82e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 831:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 835:	75 07                	jne    83e <morecore+0x38>
+    return 0;
+ 837:	b8 00 00 00 00       	mov    $0x0,%eax
+ 83c:	eb 26                	jmp    864 <morecore+0x5e>
+  hp = (Header*)p;
+ 83e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 841:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 844:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 847:	8b 55 08             	mov    0x8(%ebp),%edx
+ 84a:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 84d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 850:	83 c0 08             	add    $0x8,%eax
+ 853:	83 ec 0c             	sub    $0xc,%esp
+ 856:	50                   	push   %eax
+ 857:	e8 c8 fe ff ff       	call   724 <free>
+ 85c:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 85f:	a1 28 0c 00 00       	mov    0xc28,%eax
+}
+ 864:	c9                   	leave
+ 865:	c3                   	ret
+
+00000866 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 866:	55                   	push   %ebp
+ 867:	89 e5                	mov    %esp,%ebp
+ 869:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 86c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 86f:	83 c0 07             	add    $0x7,%eax
+ 872:	c1 e8 03             	shr    $0x3,%eax
+ 875:	83 c0 01             	add    $0x1,%eax
+ 878:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 87b:	a1 28 0c 00 00       	mov    0xc28,%eax
+ 880:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 883:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 887:	75 23                	jne    8ac <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 889:	c7 45 f0 20 0c 00 00 	movl   $0xc20,-0x10(%ebp)
+ 890:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 893:	a3 28 0c 00 00       	mov    %eax,0xc28
+ 898:	a1 28 0c 00 00       	mov    0xc28,%eax
+ 89d:	a3 20 0c 00 00       	mov    %eax,0xc20
+    base.s.size = 0;
+ 8a2:	c7 05 24 0c 00 00 00 	movl   $0x0,0xc24
+ 8a9:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8af:	8b 00                	mov    (%eax),%eax
+ 8b1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b7:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ba:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 8bd:	72 4d                	jb     90c <malloc+0xa6>
+      if(p->s.size == nunits)
+ 8bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c2:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c5:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 8c8:	75 0c                	jne    8d6 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 8ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cd:	8b 10                	mov    (%eax),%edx
+ 8cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8d2:	89 10                	mov    %edx,(%eax)
+ 8d4:	eb 26                	jmp    8fc <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 8d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d9:	8b 40 04             	mov    0x4(%eax),%eax
+ 8dc:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 8df:	89 c2                	mov    %eax,%edx
+ 8e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e4:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 8e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ea:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ed:	c1 e0 03             	shl    $0x3,%eax
+ 8f0:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 8f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f6:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 8f9:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 8fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8ff:	a3 28 0c 00 00       	mov    %eax,0xc28
+      return (void*)(p + 1);
+ 904:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 907:	83 c0 08             	add    $0x8,%eax
+ 90a:	eb 3b                	jmp    947 <malloc+0xe1>
+    }
+    if(p == freep)
+ 90c:	a1 28 0c 00 00       	mov    0xc28,%eax
+ 911:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 914:	75 1e                	jne    934 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 916:	83 ec 0c             	sub    $0xc,%esp
+ 919:	ff 75 ec             	push   -0x14(%ebp)
+ 91c:	e8 e5 fe ff ff       	call   806 <morecore>
+ 921:	83 c4 10             	add    $0x10,%esp
+ 924:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 927:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 92b:	75 07                	jne    934 <malloc+0xce>
+        return 0;
+ 92d:	b8 00 00 00 00       	mov    $0x0,%eax
+ 932:	eb 13                	jmp    947 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 934:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 937:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 93a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93d:	8b 00                	mov    (%eax),%eax
+ 93f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 942:	e9 6d ff ff ff       	jmp    8b4 <malloc+0x4e>
+  }
+}
+ 947:	c9                   	leave
+ 948:	c3                   	ret
@@ -0,0 +1,7 @@
+// Per-CPU interrupt statistics, returned by intrstat().
+// Needs param.h for NIRQ.
+struct intrstat {
+  uint nirq[NIRQ];  // Interrupts taken, by IRQ line
+  uint nsoftirq;    // Softirq handlers run
+  uint maxcli;      // Longest interrupts-off stretch, in TSC cycles
+};
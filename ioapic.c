@@ -4,7 +4,11 @@
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "traps.h"
+#include "spinlock.h"
 
 #define IOAPIC  0xFEC00000   // Default physical address of IO APIC
 
@@ -21,9 +25,16 @@
 #define INT_LEVEL      0x00008000  // Level-triggered (vs edge-)
 #define INT_ACTIVELOW  0x00002000  // Active low (vs high)
 #define INT_LOGICAL    0x00000800  // Destination is CPU id (vs APIC ID)
+#define INT_LOWEST     0x00000100  // Lowest-priority delivery (vs fixed)
 
 volatile struct ioapic *ioapic;
 
+// Serializes use of the reg/data register window and
+// remembers the CPU mask each IRQ is routed to.
+static struct spinlock ioapiclock;
+static int maxintr;
+static uint routes[NIRQ];
+
 // IO APIC MMIO structure: write reg, then read or write data.
 struct ioapic {
   uint reg;
@@ -48,8 +59,9 @@ ioapicwrite(int reg, uint data)
 void
 ioapicinit(void)
 {
-  int i, id, maxintr;
+  int i, id;
 
+  initlock(&ioapiclock, "ioapic");
   if(!ismp)
     return;
 
@@ -67,15 +79,66 @@ ioapicinit(void)
   }
 }
 
+// Program irq's redirection entry, enabled, for the CPUs in
+// cpumask.  Called with ioapiclock held.
+static void
+setroute(int irq, uint cpumask)
+{
+  int cpunum;
+
+  routes[irq] = cpumask;
+  if((cpumask & (cpumask - 1)) == 0){
+    // Mark interrupt edge-triggered, active high,
+    // enabled, and routed to the given cpunum,
+    // which happens to be that cpu's APIC ID.
+    for(cpunum = 0; (cpumask & (1 << cpunum)) == 0; cpunum++)
+      ;
+    ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+    ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+  } else {
+    ioapicwrite(REG_TABLE+2*irq, INT_LOGICAL | INT_LOWEST | (T_IRQ0 + irq));
+    ioapicwrite(REG_TABLE+2*irq+1, cpumask << 24);
+  }
+}
+
 void
 ioapicenable(int irq, int cpunum)
 {
-  if(!ismp)
+  if(!ismp || irq < 0 || irq > maxintr || irq >= NIRQ)
     return;
+  acquire(&ioapiclock);
+  setroute(irq, 1 << cpunum);
+  release(&ioapiclock);
+}
+
+// Route irq to the CPUs in cpumask (bit i is cpus[i]).
+// A single CPU gets fixed delivery to its APIC ID; a larger
+// set uses lowest-priority delivery to the matching logical
+// APIC IDs (see lapicinit), letting the hardware spread the
+// interrupts over those CPUs.  Only lines a driver has enabled
+// with ioapicenable() can be moved: the others stay masked,
+// since nothing would handle their interrupts.
+// Returns the previous mask, or -1 if the request is invalid.
+int
+ioapicroute(int irq, uint cpumask)
+{
+  int old;
 
-  // Mark interrupt edge-triggered, active high,
-  // enabled, and routed to the given cpunum,
-  // which happens to be that cpu's APIC ID.
-  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
-  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+  if(!ismp)
+    return -1;
+  if(irq < 0 || irq > maxintr || irq >= NIRQ)
+    return -1;
+  cpumask &= (1 << ncpu) - 1;
+  if(cpumask == 0)
+    return -1;
+
+  acquire(&ioapiclock);
+  old = routes[irq];
+  if(old == 0){
+    release(&ioapiclock);
+    return -1;
+  }
+  setroute(irq, cpumask);
+  release(&ioapiclock);
+  return old;
 }
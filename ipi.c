@@ -0,0 +1,155 @@
+// Inter-processor interrupts: run a function on another CPU,
+// wake an idle CPU's scheduler, and TLB shootdown.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+
+// A pending smpcall().  Lives on the caller's stack; the caller
+// spins until the target CPU sets done.
+struct call {
+  void (*fn)(void*);
+  void *arg;
+  volatile int done;
+  struct call *next;
+};
+
+static struct {
+  struct spinlock lock;
+  struct call *head;
+} callq[NCPU];
+
+void
+ipiinit(void)
+{
+  int i;
+
+  for(i = 0; i < NCPU; i++)
+    initlock(&callq[i].lock, "smpcall");
+}
+
+// Run the calls queued for this CPU.  Called from trap() on
+// T_IPICALL, and by smpcall() while it waits so that two CPUs
+// calling each other with interrupts off cannot deadlock.
+void
+ipicall(void)
+{
+  struct call *c, *next;
+
+  acquire(&callq[cpu->id].lock);
+  c = callq[cpu->id].head;
+  callq[cpu->id].head = 0;
+  release(&callq[cpu->id].lock);
+
+  for(; c; c = next){
+    next = c->next;
+    c->fn(c->arg);
+    c->done = 1;  // c may be gone after this
+  }
+}
+
+// Run fn(arg) on CPU n with interrupts off and wait for it to
+// finish.  fn must not sleep or take a lock the caller may hold.
+void
+smpcall(int n, void (*fn)(void*), void *arg)
+{
+  struct call c;
+
+  pushcli();  // stay on this CPU
+  if(n == cpu->id){
+    fn(arg);
+    popcli();
+    return;
+  }
+  if(n < 0 || n >= ncpu || !cpus[n].started){
+    popcli();
+    return;
+  }
+
+  c.fn = fn;
+  c.arg = arg;
+  c.done = 0;
+  acquire(&callq[n].lock);
+  c.next = callq[n].head;
+  callq[n].head = &c;
+  release(&callq[n].lock);
+
+  lapicipi(cpus[n].id, T_IPICALL);
+  while(!c.done)
+    ipicall();
+  popcli();
+}
+
+// Wake one idle CPU to run a process that just became
+// RUNNABLE.  Caller holds ptable.lock, which guards cpu->idle.
+void
+ipiresched(void)
+{
+  struct cpu *c;
+
+  for(c = cpus; c < cpus+ncpu; c++){
+    if(c != cpu && c->idle){
+      c->idle = 0;
+      lapicipi(c->id, T_IPIRESCHED);
+      return;
+    }
+  }
+}
+
+// TLB shootdown.  Callers that unmap pages collect them in a
+// tlbbatch and flush once at the end, so a CPU sharing the
+// address space takes one IPI per batch instead of one per page.
+void
+tlbstart(struct tlbbatch *b, pde_t *pgdir)
+{
+  b->pgdir = pgdir;
+  b->n = 0;
+}
+
+void
+tlbadd(struct tlbbatch *b, uint va)
+{
+  if(b->n < NTLBBATCH)
+    b->va[b->n] = va;
+  if(b->n <= NTLBBATCH)
+    b->n++;
+}
+
+static void
+tlbflushlocal(void *arg)
+{
+  struct tlbbatch *b;
+  int i;
+
+  b = arg;
+  if(cpu->pgdir != b->pgdir)
+    return;
+  if(b->n > NTLBBATCH){
+    lcr3(v2p(b->pgdir));
+    return;
+  }
+  for(i = 0; i < b->n; i++)
+    invlpg((void*)b->va[i]);
+}
+
+// Flush the batched pages on every CPU that has b->pgdir loaded.
+void
+tlbflush(struct tlbbatch *b)
+{
+  int i;
+
+  if(b->n == 0)
+    return;
+  pushcli();
+  for(i = 0; i < ncpu; i++)
+    if(cpus[i].pgdir == b->pgdir)
+      smpcall(i, tlbflushlocal, b);
+  popcli();
+  b->n = 0;
+}
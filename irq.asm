@@ -0,0 +1,1465 @@
+
+_irq:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct intrstat st[NCPU];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 20             	sub    $0x20,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i, n, irq, old;
+  uint tot;
+
+  if(argc == 3){
+  14:	83 3b 03             	cmpl   $0x3,(%ebx)
+  17:	0f 85 8f 00 00 00    	jne    ac <main+0xac>
+    irq = atoi(argv[1]);
+  1d:	8b 43 04             	mov    0x4(%ebx),%eax
+  20:	83 c0 04             	add    $0x4,%eax
+  23:	8b 00                	mov    (%eax),%eax
+  25:	83 ec 0c             	sub    $0xc,%esp
+  28:	50                   	push   %eax
+  29:	e8 38 04 00 00       	call   466 <atoi>
+  2e:	83 c4 10             	add    $0x10,%esp
+  31:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((old = irqroute(irq, atoi(argv[2]))) < 0){
+  34:	8b 43 04             	mov    0x4(%ebx),%eax
+  37:	83 c0 08             	add    $0x8,%eax
+  3a:	8b 00                	mov    (%eax),%eax
+  3c:	83 ec 0c             	sub    $0xc,%esp
+  3f:	50                   	push   %eax
+  40:	e8 21 04 00 00       	call   466 <atoi>
+  45:	83 c4 10             	add    $0x10,%esp
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	50                   	push   %eax
+  4c:	ff 75 ec             	push   -0x14(%ebp)
+  4f:	e8 92 05 00 00       	call   5e6 <irqroute>
+  54:	83 c4 10             	add    $0x10,%esp
+  57:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  5a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  5e:	79 1a                	jns    7a <main+0x7a>
+      printf(2, "irq: cannot route irq %d\n", irq);
+  60:	83 ec 04             	sub    $0x4,%esp
+  63:	ff 75 ec             	push   -0x14(%ebp)
+  66:	68 e9 0a 00 00       	push   $0xae9
+  6b:	6a 02                	push   $0x2
+  6d:	e8 c0 06 00 00       	call   732 <printf>
+  72:	83 c4 10             	add    $0x10,%esp
+      exit();
+  75:	e8 bc 04 00 00       	call   536 <exit>
+    }
+    printf(1, "irq %d: cpumask %d -> %d\n", irq, old, atoi(argv[2]));
+  7a:	8b 43 04             	mov    0x4(%ebx),%eax
+  7d:	83 c0 08             	add    $0x8,%eax
+  80:	8b 00                	mov    (%eax),%eax
+  82:	83 ec 0c             	sub    $0xc,%esp
+  85:	50                   	push   %eax
+  86:	e8 db 03 00 00       	call   466 <atoi>
+  8b:	83 c4 10             	add    $0x10,%esp
+  8e:	83 ec 0c             	sub    $0xc,%esp
+  91:	50                   	push   %eax
+  92:	ff 75 e4             	push   -0x1c(%ebp)
+  95:	ff 75 ec             	push   -0x14(%ebp)
+  98:	68 03 0b 00 00       	push   $0xb03
+  9d:	6a 01                	push   $0x1
+  9f:	e8 8e 06 00 00       	call   732 <printf>
+  a4:	83 c4 20             	add    $0x20,%esp
+    exit();
+  a7:	e8 8a 04 00 00       	call   536 <exit>
+  }
+  if(argc != 1){
+  ac:	83 3b 01             	cmpl   $0x1,(%ebx)
+  af:	74 17                	je     c8 <main+0xc8>
+    printf(2, "usage: irq [irq cpumask]\n");
+  b1:	83 ec 08             	sub    $0x8,%esp
+  b4:	68 1d 0b 00 00       	push   $0xb1d
+  b9:	6a 02                	push   $0x2
+  bb:	e8 72 06 00 00       	call   732 <printf>
+  c0:	83 c4 10             	add    $0x10,%esp
+    exit();
+  c3:	e8 6e 04 00 00       	call   536 <exit>
+  }
+
+  for(n = 0; n < NCPU && intrstat(n, &st[n]) == 0; n++)
+  c8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  cf:	eb 04                	jmp    d5 <main+0xd5>
+  d1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  d5:	83 7d f0 07          	cmpl   $0x7,-0x10(%ebp)
+  d9:	7f 1e                	jg     f9 <main+0xf9>
+  db:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  de:	6b c0 68             	imul   $0x68,%eax,%eax
+  e1:	05 e0 0d 00 00       	add    $0xde0,%eax
+  e6:	83 ec 08             	sub    $0x8,%esp
+  e9:	50                   	push   %eax
+  ea:	ff 75 f0             	push   -0x10(%ebp)
+  ed:	e8 fc 04 00 00       	call   5ee <intrstat>
+  f2:	83 c4 10             	add    $0x10,%esp
+  f5:	85 c0                	test   %eax,%eax
+  f7:	74 d8                	je     d1 <main+0xd1>
+    ;
+  printf(1, "irq");
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	68 37 0b 00 00       	push   $0xb37
+ 101:	6a 01                	push   $0x1
+ 103:	e8 2a 06 00 00       	call   732 <printf>
+ 108:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 10b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 112:	eb 19                	jmp    12d <main+0x12d>
+    printf(1, "\tcpu%d", i);
+ 114:	83 ec 04             	sub    $0x4,%esp
+ 117:	ff 75 f4             	push   -0xc(%ebp)
+ 11a:	68 3b 0b 00 00       	push   $0xb3b
+ 11f:	6a 01                	push   $0x1
+ 121:	e8 0c 06 00 00       	call   732 <printf>
+ 126:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 129:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 12d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 130:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 133:	7c df                	jl     114 <main+0x114>
+  printf(1, "\n");
+ 135:	83 ec 08             	sub    $0x8,%esp
+ 138:	68 42 0b 00 00       	push   $0xb42
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 ee 05 00 00       	call   732 <printf>
+ 144:	83 c4 10             	add    $0x10,%esp
+  for(irq = 0; irq < NIRQ; irq++){
+ 147:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 14e:	e9 9f 00 00 00       	jmp    1f2 <main+0x1f2>
+    tot = 0;
+ 153:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    for(i = 0; i < n; i++)
+ 15a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 161:	eb 19                	jmp    17c <main+0x17c>
+      tot += st[i].nirq[irq];
+ 163:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 166:	6b d0 1a             	imul   $0x1a,%eax,%edx
+ 169:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 16c:	01 d0                	add    %edx,%eax
+ 16e:	8b 04 85 e0 0d 00 00 	mov    0xde0(,%eax,4),%eax
+ 175:	01 45 e8             	add    %eax,-0x18(%ebp)
+    for(i = 0; i < n; i++)
+ 178:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 17c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17f:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 182:	7c df                	jl     163 <main+0x163>
+    if(tot == 0)
+ 184:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 188:	74 63                	je     1ed <main+0x1ed>
+      continue;
+    printf(1, "%d", irq);
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	ff 75 ec             	push   -0x14(%ebp)
+ 190:	68 44 0b 00 00       	push   $0xb44
+ 195:	6a 01                	push   $0x1
+ 197:	e8 96 05 00 00       	call   732 <printf>
+ 19c:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++)
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 29                	jmp    1d1 <main+0x1d1>
+      printf(1, "\t%d", st[i].nirq[irq]);
+ 1a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ab:	6b d0 1a             	imul   $0x1a,%eax,%edx
+ 1ae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 1b1:	01 d0                	add    %edx,%eax
+ 1b3:	8b 04 85 e0 0d 00 00 	mov    0xde0(,%eax,4),%eax
+ 1ba:	83 ec 04             	sub    $0x4,%esp
+ 1bd:	50                   	push   %eax
+ 1be:	68 47 0b 00 00       	push   $0xb47
+ 1c3:	6a 01                	push   $0x1
+ 1c5:	e8 68 05 00 00       	call   732 <printf>
+ 1ca:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++)
+ 1cd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d4:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 1d7:	7c cf                	jl     1a8 <main+0x1a8>
+    printf(1, "\n");
+ 1d9:	83 ec 08             	sub    $0x8,%esp
+ 1dc:	68 42 0b 00 00       	push   $0xb42
+ 1e1:	6a 01                	push   $0x1
+ 1e3:	e8 4a 05 00 00       	call   732 <printf>
+ 1e8:	83 c4 10             	add    $0x10,%esp
+ 1eb:	eb 01                	jmp    1ee <main+0x1ee>
+      continue;
+ 1ed:	90                   	nop
+  for(irq = 0; irq < NIRQ; irq++){
+ 1ee:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+ 1f2:	83 7d ec 17          	cmpl   $0x17,-0x14(%ebp)
+ 1f6:	0f 8e 57 ff ff ff    	jle    153 <main+0x153>
+  }
+  printf(1, "soft");
+ 1fc:	83 ec 08             	sub    $0x8,%esp
+ 1ff:	68 4b 0b 00 00       	push   $0xb4b
+ 204:	6a 01                	push   $0x1
+ 206:	e8 27 05 00 00       	call   732 <printf>
+ 20b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 20e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 215:	eb 24                	jmp    23b <main+0x23b>
+    printf(1, "\t%d", st[i].nsoftirq);
+ 217:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 21a:	6b c0 68             	imul   $0x68,%eax,%eax
+ 21d:	05 40 0e 00 00       	add    $0xe40,%eax
+ 222:	8b 00                	mov    (%eax),%eax
+ 224:	83 ec 04             	sub    $0x4,%esp
+ 227:	50                   	push   %eax
+ 228:	68 47 0b 00 00       	push   $0xb47
+ 22d:	6a 01                	push   $0x1
+ 22f:	e8 fe 04 00 00       	call   732 <printf>
+ 234:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 237:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 23b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 23e:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 241:	7c d4                	jl     217 <main+0x217>
+  printf(1, "\nmaxcli");
+ 243:	83 ec 08             	sub    $0x8,%esp
+ 246:	68 50 0b 00 00       	push   $0xb50
+ 24b:	6a 01                	push   $0x1
+ 24d:	e8 e0 04 00 00       	call   732 <printf>
+ 252:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 255:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 25c:	eb 24                	jmp    282 <main+0x282>
+    printf(1, "\t%d", st[i].maxcli);
+ 25e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 261:	6b c0 68             	imul   $0x68,%eax,%eax
+ 264:	05 44 0e 00 00       	add    $0xe44,%eax
+ 269:	8b 00                	mov    (%eax),%eax
+ 26b:	83 ec 04             	sub    $0x4,%esp
+ 26e:	50                   	push   %eax
+ 26f:	68 47 0b 00 00       	push   $0xb47
+ 274:	6a 01                	push   $0x1
+ 276:	e8 b7 04 00 00       	call   732 <printf>
+ 27b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 27e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 282:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 285:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 288:	7c d4                	jl     25e <main+0x25e>
+  printf(1, "\n");
+ 28a:	83 ec 08             	sub    $0x8,%esp
+ 28d:	68 42 0b 00 00       	push   $0xb42
+ 292:	6a 01                	push   $0x1
+ 294:	e8 99 04 00 00       	call   732 <printf>
+ 299:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 29c:	e8 95 02 00 00       	call   536 <exit>
+
+000002a1 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 2a1:	55                   	push   %ebp
+ 2a2:	89 e5                	mov    %esp,%ebp
+ 2a4:	57                   	push   %edi
+ 2a5:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 2a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2a9:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2af:	89 cb                	mov    %ecx,%ebx
+ 2b1:	89 df                	mov    %ebx,%edi
+ 2b3:	89 d1                	mov    %edx,%ecx
+ 2b5:	fc                   	cld
+ 2b6:	f3 aa                	rep stos %al,%es:(%edi)
+ 2b8:	89 ca                	mov    %ecx,%edx
+ 2ba:	89 fb                	mov    %edi,%ebx
+ 2bc:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2bf:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 2c2:	90                   	nop
+ 2c3:	5b                   	pop    %ebx
+ 2c4:	5f                   	pop    %edi
+ 2c5:	5d                   	pop    %ebp
+ 2c6:	c3                   	ret
+
+000002c7 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2c7:	55                   	push   %ebp
+ 2c8:	89 e5                	mov    %esp,%ebp
+ 2ca:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 2cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 2d3:	90                   	nop
+ 2d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2d7:	8d 42 01             	lea    0x1(%edx),%eax
+ 2da:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2e3:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2e6:	0f b6 12             	movzbl (%edx),%edx
+ 2e9:	88 10                	mov    %dl,(%eax)
+ 2eb:	0f b6 00             	movzbl (%eax),%eax
+ 2ee:	84 c0                	test   %al,%al
+ 2f0:	75 e2                	jne    2d4 <strcpy+0xd>
+    ;
+  return os;
+ 2f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2f5:	c9                   	leave
+ 2f6:	c3                   	ret
+
+000002f7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2f7:	55                   	push   %ebp
+ 2f8:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2fa:	eb 08                	jmp    304 <strcmp+0xd>
+    p++, q++;
+ 2fc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 300:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+ 307:	0f b6 00             	movzbl (%eax),%eax
+ 30a:	84 c0                	test   %al,%al
+ 30c:	74 10                	je     31e <strcmp+0x27>
+ 30e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 311:	0f b6 10             	movzbl (%eax),%edx
+ 314:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 317:	0f b6 00             	movzbl (%eax),%eax
+ 31a:	38 c2                	cmp    %al,%dl
+ 31c:	74 de                	je     2fc <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 31e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 321:	0f b6 00             	movzbl (%eax),%eax
+ 324:	0f b6 d0             	movzbl %al,%edx
+ 327:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32a:	0f b6 00             	movzbl (%eax),%eax
+ 32d:	0f b6 c0             	movzbl %al,%eax
+ 330:	29 c2                	sub    %eax,%edx
+ 332:	89 d0                	mov    %edx,%eax
+}
+ 334:	5d                   	pop    %ebp
+ 335:	c3                   	ret
+
+00000336 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 336:	55                   	push   %ebp
+ 337:	89 e5                	mov    %esp,%ebp
+ 339:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 33c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 343:	eb 04                	jmp    349 <strlen+0x13>
+ 345:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 349:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 34c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34f:	01 d0                	add    %edx,%eax
+ 351:	0f b6 00             	movzbl (%eax),%eax
+ 354:	84 c0                	test   %al,%al
+ 356:	75 ed                	jne    345 <strlen+0xf>
+    ;
+  return n;
+ 358:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 35b:	c9                   	leave
+ 35c:	c3                   	ret
+
+0000035d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 35d:	55                   	push   %ebp
+ 35e:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 360:	8b 45 10             	mov    0x10(%ebp),%eax
+ 363:	50                   	push   %eax
+ 364:	ff 75 0c             	push   0xc(%ebp)
+ 367:	ff 75 08             	push   0x8(%ebp)
+ 36a:	e8 32 ff ff ff       	call   2a1 <stosb>
+ 36f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 372:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 375:	c9                   	leave
+ 376:	c3                   	ret
+
+00000377 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 377:	55                   	push   %ebp
+ 378:	89 e5                	mov    %esp,%ebp
+ 37a:	83 ec 04             	sub    $0x4,%esp
+ 37d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 380:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 383:	eb 14                	jmp    399 <strchr+0x22>
+    if(*s == c)
+ 385:	8b 45 08             	mov    0x8(%ebp),%eax
+ 388:	0f b6 00             	movzbl (%eax),%eax
+ 38b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 38e:	75 05                	jne    395 <strchr+0x1e>
+      return (char*)s;
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+ 393:	eb 13                	jmp    3a8 <strchr+0x31>
+  for(; *s; s++)
+ 395:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 399:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39c:	0f b6 00             	movzbl (%eax),%eax
+ 39f:	84 c0                	test   %al,%al
+ 3a1:	75 e2                	jne    385 <strchr+0xe>
+  return 0;
+ 3a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3a8:	c9                   	leave
+ 3a9:	c3                   	ret
+
+000003aa <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3aa:	55                   	push   %ebp
+ 3ab:	89 e5                	mov    %esp,%ebp
+ 3ad:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3b7:	eb 42                	jmp    3fb <gets+0x51>
+    cc = read(0, &c, 1);
+ 3b9:	83 ec 04             	sub    $0x4,%esp
+ 3bc:	6a 01                	push   $0x1
+ 3be:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3c1:	50                   	push   %eax
+ 3c2:	6a 00                	push   $0x0
+ 3c4:	e8 85 01 00 00       	call   54e <read>
+ 3c9:	83 c4 10             	add    $0x10,%esp
+ 3cc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3cf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3d3:	7e 33                	jle    408 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 3d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3d8:	8d 50 01             	lea    0x1(%eax),%edx
+ 3db:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3de:	89 c2                	mov    %eax,%edx
+ 3e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e3:	01 c2                	add    %eax,%edx
+ 3e5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3e9:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 3eb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3ef:	3c 0a                	cmp    $0xa,%al
+ 3f1:	74 16                	je     409 <gets+0x5f>
+ 3f3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3f7:	3c 0d                	cmp    $0xd,%al
+ 3f9:	74 0e                	je     409 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 3fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3fe:	83 c0 01             	add    $0x1,%eax
+ 401:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 404:	7f b3                	jg     3b9 <gets+0xf>
+ 406:	eb 01                	jmp    409 <gets+0x5f>
+      break;
+ 408:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 409:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 40c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40f:	01 d0                	add    %edx,%eax
+ 411:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 414:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+
+00000419 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 419:	55                   	push   %ebp
+ 41a:	89 e5                	mov    %esp,%ebp
+ 41c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 41f:	83 ec 08             	sub    $0x8,%esp
+ 422:	6a 00                	push   $0x0
+ 424:	ff 75 08             	push   0x8(%ebp)
+ 427:	e8 4a 01 00 00       	call   576 <open>
+ 42c:	83 c4 10             	add    $0x10,%esp
+ 42f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 432:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 436:	79 07                	jns    43f <stat+0x26>
+    return -1;
+ 438:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 43d:	eb 25                	jmp    464 <stat+0x4b>
+  r = fstat(fd, st);
+ 43f:	83 ec 08             	sub    $0x8,%esp
+ 442:	ff 75 0c             	push   0xc(%ebp)
+ 445:	ff 75 f4             	push   -0xc(%ebp)
+ 448:	e8 41 01 00 00       	call   58e <fstat>
+ 44d:	83 c4 10             	add    $0x10,%esp
+ 450:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 453:	83 ec 0c             	sub    $0xc,%esp
+ 456:	ff 75 f4             	push   -0xc(%ebp)
+ 459:	e8 00 01 00 00       	call   55e <close>
+ 45e:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 461:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 464:	c9                   	leave
+ 465:	c3                   	ret
+
+00000466 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 466:	55                   	push   %ebp
+ 467:	89 e5                	mov    %esp,%ebp
+ 469:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 46c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 473:	eb 25                	jmp    49a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 475:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 478:	89 d0                	mov    %edx,%eax
+ 47a:	c1 e0 02             	shl    $0x2,%eax
+ 47d:	01 d0                	add    %edx,%eax
+ 47f:	01 c0                	add    %eax,%eax
+ 481:	89 c1                	mov    %eax,%ecx
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	8d 50 01             	lea    0x1(%eax),%edx
+ 489:	89 55 08             	mov    %edx,0x8(%ebp)
+ 48c:	0f b6 00             	movzbl (%eax),%eax
+ 48f:	0f be c0             	movsbl %al,%eax
+ 492:	01 c8                	add    %ecx,%eax
+ 494:	83 e8 30             	sub    $0x30,%eax
+ 497:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 49a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49d:	0f b6 00             	movzbl (%eax),%eax
+ 4a0:	3c 2f                	cmp    $0x2f,%al
+ 4a2:	7e 0a                	jle    4ae <atoi+0x48>
+ 4a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a7:	0f b6 00             	movzbl (%eax),%eax
+ 4aa:	3c 39                	cmp    $0x39,%al
+ 4ac:	7e c7                	jle    475 <atoi+0xf>
+  return n;
+ 4ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4b1:	c9                   	leave
+ 4b2:	c3                   	ret
+
+000004b3 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4b3:	55                   	push   %ebp
+ 4b4:	89 e5                	mov    %esp,%ebp
+ 4b6:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 4b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4bc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4c5:	eb 17                	jmp    4de <memmove+0x2b>
+    *dst++ = *src++;
+ 4c7:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4ca:	8d 42 01             	lea    0x1(%edx),%eax
+ 4cd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4d3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4d6:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4d9:	0f b6 12             	movzbl (%edx),%edx
+ 4dc:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4de:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e1:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4e4:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4e7:	85 c0                	test   %eax,%eax
+ 4e9:	7f dc                	jg     4c7 <memmove+0x14>
+  return vdst;
+ 4eb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4ee:	c9                   	leave
+ 4ef:	c3                   	ret
+
+000004f0 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 4f6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 4fd:	eb 04                	jmp    503 <ncpus+0x13>
+ 4ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 503:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 507:	7f 16                	jg     51f <ncpus+0x2f>
+ 509:	83 ec 08             	sub    $0x8,%esp
+ 50c:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 50f:	50                   	push   %eax
+ 510:	ff 75 f4             	push   -0xc(%ebp)
+ 513:	e8 d6 00 00 00       	call   5ee <intrstat>
+ 518:	83 c4 10             	add    $0x10,%esp
+ 51b:	85 c0                	test   %eax,%eax
+ 51d:	74 e0                	je     4ff <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 51f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 522:	ba 01 00 00 00       	mov    $0x1,%edx
+ 527:	85 c0                	test   %eax,%eax
+ 529:	0f 4e c2             	cmovle %edx,%eax
+}
+ 52c:	c9                   	leave
+ 52d:	c3                   	ret
+
+0000052e <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 52e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <exit>:
+SYSCALL(exit)
+ 536:	b8 02 00 00 00       	mov    $0x2,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <wait>:
+SYSCALL(wait)
+ 53e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <pipe>:
+SYSCALL(pipe)
+ 546:	b8 04 00 00 00       	mov    $0x4,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <read>:
+SYSCALL(read)
+ 54e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <write>:
+SYSCALL(write)
+ 556:	b8 10 00 00 00       	mov    $0x10,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <close>:
+SYSCALL(close)
+ 55e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <kill>:
+SYSCALL(kill)
+ 566:	b8 06 00 00 00       	mov    $0x6,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <exec>:
+SYSCALL(exec)
+ 56e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <open>:
+SYSCALL(open)
+ 576:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <mknod>:
+SYSCALL(mknod)
+ 57e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <unlink>:
+SYSCALL(unlink)
+ 586:	b8 12 00 00 00       	mov    $0x12,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <fstat>:
+SYSCALL(fstat)
+ 58e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <link>:
+SYSCALL(link)
+ 596:	b8 13 00 00 00       	mov    $0x13,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <mkdir>:
+SYSCALL(mkdir)
+ 59e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <chdir>:
+SYSCALL(chdir)
+ 5a6:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <dup>:
+SYSCALL(dup)
+ 5ae:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <getpid>:
+SYSCALL(getpid)
+ 5b6:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <sbrk>:
+SYSCALL(sbrk)
+ 5be:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <sleep>:
+SYSCALL(sleep)
+ 5c6:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <uptime>:
+SYSCALL(uptime)
+ 5ce:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <poll>:
+SYSCALL(poll)
+ 5d6:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <fcntl>:
+SYSCALL(fcntl)
+ 5de:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <irqroute>:
+SYSCALL(irqroute)
+ 5e6:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <intrstat>:
+SYSCALL(intrstat)
+ 5ee:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <pread>:
+SYSCALL(pread)
+ 5f6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <getdents>:
+SYSCALL(getdents)
+ 5fe:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <fstatat>:
+SYSCALL(fstatat)
+ 606:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 60b:	cd 40                	int    $0x40
+ 60d:	c3                   	ret
+
+0000060e <openat>:
+SYSCALL(openat)
+ 60e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 613:	cd 40                	int    $0x40
+ 615:	c3                   	ret
+
+00000616 <unlinkat>:
+SYSCALL(unlinkat)
+ 616:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 61b:	cd 40                	int    $0x40
+ 61d:	c3                   	ret
+
+0000061e <mkdirat>:
+SYSCALL(mkdirat)
+ 61e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 623:	cd 40                	int    $0x40
+ 625:	c3                   	ret
+
+00000626 <linkat>:
+SYSCALL(linkat)
+ 626:	b8 20 00 00 00       	mov    $0x20,%eax
+ 62b:	cd 40                	int    $0x40
+ 62d:	c3                   	ret
+
+0000062e <exits>:
+SYSCALL(exits)
+ 62e:	b8 21 00 00 00       	mov    $0x21,%eax
+ 633:	cd 40                	int    $0x40
+ 635:	c3                   	ret
+
+00000636 <waitstatus>:
+SYSCALL(waitstatus)
+ 636:	b8 22 00 00 00       	mov    $0x22,%eax
+ 63b:	cd 40                	int    $0x40
+ 63d:	c3                   	ret
+
+0000063e <pwrite>:
+SYSCALL(pwrite)
+ 63e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 643:	cd 40                	int    $0x40
+ 645:	c3                   	ret
+
+00000646 <lseek>:
+SYSCALL(lseek)
+ 646:	b8 24 00 00 00       	mov    $0x24,%eax
+ 64b:	cd 40                	int    $0x40
+ 64d:	c3                   	ret
+
+0000064e <copyfilerange>:
+SYSCALL(copyfilerange)
+ 64e:	b8 25 00 00 00       	mov    $0x25,%eax
+ 653:	cd 40                	int    $0x40
+ 655:	c3                   	ret
+
+00000656 <fsctl>:
+SYSCALL(fsctl)
+ 656:	b8 26 00 00 00       	mov    $0x26,%eax
+ 65b:	cd 40                	int    $0x40
+ 65d:	c3                   	ret
+
+0000065e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 65e:	55                   	push   %ebp
+ 65f:	89 e5                	mov    %esp,%ebp
+ 661:	83 ec 18             	sub    $0x18,%esp
+ 664:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 667:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 66a:	83 ec 04             	sub    $0x4,%esp
+ 66d:	6a 01                	push   $0x1
+ 66f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 672:	50                   	push   %eax
+ 673:	ff 75 08             	push   0x8(%ebp)
+ 676:	e8 db fe ff ff       	call   556 <write>
+ 67b:	83 c4 10             	add    $0x10,%esp
+}
+ 67e:	90                   	nop
+ 67f:	c9                   	leave
+ 680:	c3                   	ret
+
+00000681 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 681:	55                   	push   %ebp
+ 682:	89 e5                	mov    %esp,%ebp
+ 684:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 687:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 68e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 692:	74 17                	je     6ab <printint+0x2a>
+ 694:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 698:	79 11                	jns    6ab <printint+0x2a>
+    neg = 1;
+ 69a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6a4:	f7 d8                	neg    %eax
+ 6a6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6a9:	eb 06                	jmp    6b1 <printint+0x30>
+  } else {
+    x = xx;
+ 6ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6ae:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6b1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6b8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6be:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6c3:	f7 f1                	div    %ecx
+ 6c5:	89 d1                	mov    %edx,%ecx
+ 6c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6ca:	8d 50 01             	lea    0x1(%eax),%edx
+ 6cd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6d0:	0f b6 91 c8 0d 00 00 	movzbl 0xdc8(%ecx),%edx
+ 6d7:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6db:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6de:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6e1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6e6:	f7 f1                	div    %ecx
+ 6e8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6eb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6ef:	75 c7                	jne    6b8 <printint+0x37>
+  if(neg)
+ 6f1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6f5:	74 2d                	je     724 <printint+0xa3>
+    buf[i++] = '-';
+ 6f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6fa:	8d 50 01             	lea    0x1(%eax),%edx
+ 6fd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 700:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 705:	eb 1d                	jmp    724 <printint+0xa3>
+    putc(fd, buf[i]);
+ 707:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 70a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 70d:	01 d0                	add    %edx,%eax
+ 70f:	0f b6 00             	movzbl (%eax),%eax
+ 712:	0f be c0             	movsbl %al,%eax
+ 715:	83 ec 08             	sub    $0x8,%esp
+ 718:	50                   	push   %eax
+ 719:	ff 75 08             	push   0x8(%ebp)
+ 71c:	e8 3d ff ff ff       	call   65e <putc>
+ 721:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 724:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 728:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 72c:	79 d9                	jns    707 <printint+0x86>
+}
+ 72e:	90                   	nop
+ 72f:	90                   	nop
+ 730:	c9                   	leave
+ 731:	c3                   	ret
+
+00000732 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 732:	55                   	push   %ebp
+ 733:	89 e5                	mov    %esp,%ebp
+ 735:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 738:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 73f:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 742:	83 c0 04             	add    $0x4,%eax
+ 745:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 748:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 74f:	e9 59 01 00 00       	jmp    8ad <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 754:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 757:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 75a:	01 d0                	add    %edx,%eax
+ 75c:	0f b6 00             	movzbl (%eax),%eax
+ 75f:	0f be c0             	movsbl %al,%eax
+ 762:	25 ff 00 00 00       	and    $0xff,%eax
+ 767:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 76a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 76e:	75 2c                	jne    79c <printf+0x6a>
+      if(c == '%'){
+ 770:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 774:	75 0c                	jne    782 <printf+0x50>
+        state = '%';
+ 776:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 77d:	e9 27 01 00 00       	jmp    8a9 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 782:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 785:	0f be c0             	movsbl %al,%eax
+ 788:	83 ec 08             	sub    $0x8,%esp
+ 78b:	50                   	push   %eax
+ 78c:	ff 75 08             	push   0x8(%ebp)
+ 78f:	e8 ca fe ff ff       	call   65e <putc>
+ 794:	83 c4 10             	add    $0x10,%esp
+ 797:	e9 0d 01 00 00       	jmp    8a9 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 79c:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7a0:	0f 85 03 01 00 00    	jne    8a9 <printf+0x177>
+      if(c == 'd'){
+ 7a6:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7aa:	75 1e                	jne    7ca <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 7ac:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7af:	8b 00                	mov    (%eax),%eax
+ 7b1:	6a 01                	push   $0x1
+ 7b3:	6a 0a                	push   $0xa
+ 7b5:	50                   	push   %eax
+ 7b6:	ff 75 08             	push   0x8(%ebp)
+ 7b9:	e8 c3 fe ff ff       	call   681 <printint>
+ 7be:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7c1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7c5:	e9 d8 00 00 00       	jmp    8a2 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 7ca:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7ce:	74 06                	je     7d6 <printf+0xa4>
+ 7d0:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7d4:	75 1e                	jne    7f4 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 7d6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7d9:	8b 00                	mov    (%eax),%eax
+ 7db:	6a 00                	push   $0x0
+ 7dd:	6a 10                	push   $0x10
+ 7df:	50                   	push   %eax
+ 7e0:	ff 75 08             	push   0x8(%ebp)
+ 7e3:	e8 99 fe ff ff       	call   681 <printint>
+ 7e8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7eb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7ef:	e9 ae 00 00 00       	jmp    8a2 <printf+0x170>
+      } else if(c == 's'){
+ 7f4:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7f8:	75 43                	jne    83d <printf+0x10b>
+        s = (char*)*ap;
+ 7fa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7fd:	8b 00                	mov    (%eax),%eax
+ 7ff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 802:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 806:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 80a:	75 25                	jne    831 <printf+0xff>
+          s = "(null)";
+ 80c:	c7 45 f4 58 0b 00 00 	movl   $0xb58,-0xc(%ebp)
+        while(*s != 0){
+ 813:	eb 1c                	jmp    831 <printf+0xff>
+          putc(fd, *s);
+ 815:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 818:	0f b6 00             	movzbl (%eax),%eax
+ 81b:	0f be c0             	movsbl %al,%eax
+ 81e:	83 ec 08             	sub    $0x8,%esp
+ 821:	50                   	push   %eax
+ 822:	ff 75 08             	push   0x8(%ebp)
+ 825:	e8 34 fe ff ff       	call   65e <putc>
+ 82a:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 82d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 831:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 834:	0f b6 00             	movzbl (%eax),%eax
+ 837:	84 c0                	test   %al,%al
+ 839:	75 da                	jne    815 <printf+0xe3>
+ 83b:	eb 65                	jmp    8a2 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 83d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 841:	75 1d                	jne    860 <printf+0x12e>
+        putc(fd, *ap);
+ 843:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 846:	8b 00                	mov    (%eax),%eax
+ 848:	0f be c0             	movsbl %al,%eax
+ 84b:	83 ec 08             	sub    $0x8,%esp
+ 84e:	50                   	push   %eax
+ 84f:	ff 75 08             	push   0x8(%ebp)
+ 852:	e8 07 fe ff ff       	call   65e <putc>
+ 857:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 85a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 85e:	eb 42                	jmp    8a2 <printf+0x170>
+      } else if(c == '%'){
+ 860:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 864:	75 17                	jne    87d <printf+0x14b>
+        putc(fd, c);
+ 866:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 869:	0f be c0             	movsbl %al,%eax
+ 86c:	83 ec 08             	sub    $0x8,%esp
+ 86f:	50                   	push   %eax
+ 870:	ff 75 08             	push   0x8(%ebp)
+ 873:	e8 e6 fd ff ff       	call   65e <putc>
+ 878:	83 c4 10             	add    $0x10,%esp
+ 87b:	eb 25                	jmp    8a2 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 87d:	83 ec 08             	sub    $0x8,%esp
+ 880:	6a 25                	push   $0x25
+ 882:	ff 75 08             	push   0x8(%ebp)
+ 885:	e8 d4 fd ff ff       	call   65e <putc>
+ 88a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 88d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 890:	0f be c0             	movsbl %al,%eax
+ 893:	83 ec 08             	sub    $0x8,%esp
+ 896:	50                   	push   %eax
+ 897:	ff 75 08             	push   0x8(%ebp)
+ 89a:	e8 bf fd ff ff       	call   65e <putc>
+ 89f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8a2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8a9:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 8ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8b0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b3:	01 d0                	add    %edx,%eax
+ 8b5:	0f b6 00             	movzbl (%eax),%eax
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	0f 85 94 fe ff ff    	jne    754 <printf+0x22>
+    }
+  }
+}
+ 8c0:	90                   	nop
+ 8c1:	90                   	nop
+ 8c2:	c9                   	leave
+ 8c3:	c3                   	ret
+
+000008c4 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8c4:	55                   	push   %ebp
+ 8c5:	89 e5                	mov    %esp,%ebp
+ 8c7:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 8ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8cd:	83 e8 08             	sub    $0x8,%eax
+ 8d0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d3:	a1 28 11 00 00       	mov    0x1128,%eax
+ 8d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8db:	eb 24                	jmp    901 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e0:	8b 00                	mov    (%eax),%eax
+ 8e2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8e5:	72 12                	jb     8f9 <free+0x35>
+ 8e7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 8ea:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 8ed:	72 24                	jb     913 <free+0x4f>
+ 8ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f2:	8b 00                	mov    (%eax),%eax
+ 8f4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 8f7:	72 1a                	jb     913 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8f9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8fc:	8b 00                	mov    (%eax),%eax
+ 8fe:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 901:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 904:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 907:	73 d4                	jae    8dd <free+0x19>
+ 909:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 90c:	8b 00                	mov    (%eax),%eax
+ 90e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 911:	73 ca                	jae    8dd <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 913:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 916:	8b 40 04             	mov    0x4(%eax),%eax
+ 919:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 920:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 923:	01 c2                	add    %eax,%edx
+ 925:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 928:	8b 00                	mov    (%eax),%eax
+ 92a:	39 c2                	cmp    %eax,%edx
+ 92c:	75 24                	jne    952 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 92e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 931:	8b 50 04             	mov    0x4(%eax),%edx
+ 934:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 937:	8b 00                	mov    (%eax),%eax
+ 939:	8b 40 04             	mov    0x4(%eax),%eax
+ 93c:	01 c2                	add    %eax,%edx
+ 93e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 941:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 944:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 947:	8b 00                	mov    (%eax),%eax
+ 949:	8b 10                	mov    (%eax),%edx
+ 94b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 94e:	89 10                	mov    %edx,(%eax)
+ 950:	eb 0a                	jmp    95c <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 952:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 955:	8b 10                	mov    (%eax),%edx
+ 957:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 95a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 95c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 95f:	8b 40 04             	mov    0x4(%eax),%eax
+ 962:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 969:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 96c:	01 d0                	add    %edx,%eax
+ 96e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 971:	75 20                	jne    993 <free+0xcf>
+    p->s.size += bp->s.size;
+ 973:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 976:	8b 50 04             	mov    0x4(%eax),%edx
+ 979:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 97c:	8b 40 04             	mov    0x4(%eax),%eax
+ 97f:	01 c2                	add    %eax,%edx
+ 981:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 984:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 987:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 98a:	8b 10                	mov    (%eax),%edx
+ 98c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98f:	89 10                	mov    %edx,(%eax)
+ 991:	eb 08                	jmp    99b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 993:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 996:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 999:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 99b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99e:	a3 28 11 00 00       	mov    %eax,0x1128
+}
+ 9a3:	90                   	nop
+ 9a4:	c9                   	leave
+ 9a5:	c3                   	ret
+
+000009a6 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9a6:	55                   	push   %ebp
+ 9a7:	89 e5                	mov    %esp,%ebp
+ 9a9:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 9ac:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 9b3:	77 07                	ja     9bc <morecore+0x16>
+    nu = 4096;
+ 9b5:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 9bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9bf:	c1 e0 03             	shl    $0x3,%eax
+ 9c2:	83 ec 0c             	sub    $0xc,%esp
+ 9c5:	50                   	push   %eax
+ 9c6:	e8 f3 fb ff ff       	call   5be <sbrk>
+ 9cb:	83 c4 10             	add    $0x10,%esp
+ 9ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 9d1:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 9d5:	75 07                	jne    9de <morecore+0x38>
+    return 0;
+ 9d7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 9dc:	eb 26                	jmp    a04 <morecore+0x5e>
+  hp = (Header*)p;
+ 9de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 9e4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9e7:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9ea:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9ed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f0:	83 c0 08             	add    $0x8,%eax
+ 9f3:	83 ec 0c             	sub    $0xc,%esp
+ 9f6:	50                   	push   %eax
+ 9f7:	e8 c8 fe ff ff       	call   8c4 <free>
+ 9fc:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 9ff:	a1 28 11 00 00       	mov    0x1128,%eax
+}
+ a04:	c9                   	leave
+ a05:	c3                   	ret
+
+00000a06 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a06:	55                   	push   %ebp
+ a07:	89 e5                	mov    %esp,%ebp
+ a09:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a0c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a0f:	83 c0 07             	add    $0x7,%eax
+ a12:	c1 e8 03             	shr    $0x3,%eax
+ a15:	83 c0 01             	add    $0x1,%eax
+ a18:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a1b:	a1 28 11 00 00       	mov    0x1128,%eax
+ a20:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a23:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a27:	75 23                	jne    a4c <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a29:	c7 45 f0 20 11 00 00 	movl   $0x1120,-0x10(%ebp)
+ a30:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a33:	a3 28 11 00 00       	mov    %eax,0x1128
+ a38:	a1 28 11 00 00       	mov    0x1128,%eax
+ a3d:	a3 20 11 00 00       	mov    %eax,0x1120
+    base.s.size = 0;
+ a42:	c7 05 24 11 00 00 00 	movl   $0x0,0x1124
+ a49:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a4c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a4f:	8b 00                	mov    (%eax),%eax
+ a51:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ a54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a57:	8b 40 04             	mov    0x4(%eax),%eax
+ a5a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ a5d:	72 4d                	jb     aac <malloc+0xa6>
+      if(p->s.size == nunits)
+ a5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a62:	8b 40 04             	mov    0x4(%eax),%eax
+ a65:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ a68:	75 0c                	jne    a76 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ a6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a6d:	8b 10                	mov    (%eax),%edx
+ a6f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a72:	89 10                	mov    %edx,(%eax)
+ a74:	eb 26                	jmp    a9c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ a76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a79:	8b 40 04             	mov    0x4(%eax),%eax
+ a7c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ a7f:	89 c2                	mov    %eax,%edx
+ a81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a84:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8a:	8b 40 04             	mov    0x4(%eax),%eax
+ a8d:	c1 e0 03             	shl    $0x3,%eax
+ a90:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ a93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a96:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a99:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ a9c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9f:	a3 28 11 00 00       	mov    %eax,0x1128
+      return (void*)(p + 1);
+ aa4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa7:	83 c0 08             	add    $0x8,%eax
+ aaa:	eb 3b                	jmp    ae7 <malloc+0xe1>
+    }
+    if(p == freep)
+ aac:	a1 28 11 00 00       	mov    0x1128,%eax
+ ab1:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ ab4:	75 1e                	jne    ad4 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ ab6:	83 ec 0c             	sub    $0xc,%esp
+ ab9:	ff 75 ec             	push   -0x14(%ebp)
+ abc:	e8 e5 fe ff ff       	call   9a6 <morecore>
+ ac1:	83 c4 10             	add    $0x10,%esp
+ ac4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ac7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ acb:	75 07                	jne    ad4 <malloc+0xce>
+        return 0;
+ acd:	b8 00 00 00 00       	mov    $0x0,%eax
+ ad2:	eb 13                	jmp    ae7 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ada:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ add:	8b 00                	mov    (%eax),%eax
+ adf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ae2:	e9 6d ff ff ff       	jmp    a54 <malloc+0x4e>
+  }
+}
+ ae7:	c9                   	leave
+ ae8:	c3                   	ret
@@ -0,0 +1,58 @@
+// Show per-CPU interrupt counts, or route an IRQ:
+//   irq                 print counts for each CPU, softirq runs
+//                       and the longest interrupts-off stretch
+//   irq IRQ CPUMASK     route IRQ to the CPUs in CPUMASK
+
+#include "types.h"
+#include "param.h"
+#include "user.h"
+#include "intr.h"
+
+struct intrstat st[NCPU];
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, irq, old;
+  uint tot;
+
+  if(argc == 3){
+    irq = atoi(argv[1]);
+    if((old = irqroute(irq, atoi(argv[2]))) < 0){
+      printf(2, "irq: cannot route irq %d\n", irq);
+      exit();
+    }
+    printf(1, "irq %d: cpumask %d -> %d\n", irq, old, atoi(argv[2]));
+    exit();
+  }
+  if(argc != 1){
+    printf(2, "usage: irq [irq cpumask]\n");
+    exit();
+  }
+
+  for(n = 0; n < NCPU && intrstat(n, &st[n]) == 0; n++)
+    ;
+  printf(1, "irq");
+  for(i = 0; i < n; i++)
+    printf(1, "\tcpu%d", i);
+  printf(1, "\n");
+  for(irq = 0; irq < NIRQ; irq++){
+    tot = 0;
+    for(i = 0; i < n; i++)
+      tot += st[i].nirq[irq];
+    if(tot == 0)
+      continue;
+    printf(1, "%d", irq);
+    for(i = 0; i < n; i++)
+      printf(1, "\t%d", st[i].nirq[irq]);
+    printf(1, "\n");
+  }
+  printf(1, "soft");
+  for(i = 0; i < n; i++)
+    printf(1, "\t%d", st[i].nsoftirq);
+  printf(1, "\nmaxcli");
+  for(i = 0; i < n; i++)
+    printf(1, "\t%d", st[i].maxcli);
+  printf(1, "\n");
+  exit();
+}
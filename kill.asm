@@ -0,0 +1,1263 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 1){
+  14:	83 3b 00             	cmpl   $0x0,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 ba 08 00 00       	push   $0x8ba
+  21:	6a 02                	push   $0x2
+  23:	e8 db 04 00 00       	call   503 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 d7 02 00 00       	call   307 <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 01 00 00       	call   237 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 d8 02 00 00       	call   337 <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+  6d:	e8 95 02 00 00       	call   307 <exit>
+
+00000072 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a4:	90                   	nop
+  a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a8:	8d 42 01             	lea    0x1(%edx),%eax
+  ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	8d 48 01             	lea    0x1(%eax),%ecx
+  b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b7:	0f b6 12             	movzbl (%edx),%edx
+  ba:	88 10                	mov    %dl,(%eax)
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	84 c0                	test   %al,%al
+  c1:	75 e2                	jne    a5 <strcpy+0xd>
+    ;
+  return os;
+  c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c6:	c9                   	leave
+  c7:	c3                   	ret
+
+000000c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cb:	eb 08                	jmp    d5 <strcmp+0xd>
+    p++, q++;
+  cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  d8:	0f b6 00             	movzbl (%eax),%eax
+  db:	84 c0                	test   %al,%al
+  dd:	74 10                	je     ef <strcmp+0x27>
+  df:	8b 45 08             	mov    0x8(%ebp),%eax
+  e2:	0f b6 10             	movzbl (%eax),%edx
+  e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e8:	0f b6 00             	movzbl (%eax),%eax
+  eb:	38 c2                	cmp    %al,%dl
+  ed:	74 de                	je     cd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  f2:	0f b6 00             	movzbl (%eax),%eax
+  f5:	0f b6 d0             	movzbl %al,%edx
+  f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fb:	0f b6 00             	movzbl (%eax),%eax
+  fe:	0f b6 c0             	movzbl %al,%eax
+ 101:	29 c2                	sub    %eax,%edx
+ 103:	89 d0                	mov    %edx,%eax
+}
+ 105:	5d                   	pop    %ebp
+ 106:	c3                   	ret
+
+00000107 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 10d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 114:	eb 04                	jmp    11a <strlen+0x13>
+ 116:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	01 d0                	add    %edx,%eax
+ 122:	0f b6 00             	movzbl (%eax),%eax
+ 125:	84 c0                	test   %al,%al
+ 127:	75 ed                	jne    116 <strlen+0xf>
+    ;
+  return n;
+ 129:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12c:	c9                   	leave
+ 12d:	c3                   	ret
+
+0000012e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 131:	8b 45 10             	mov    0x10(%ebp),%eax
+ 134:	50                   	push   %eax
+ 135:	ff 75 0c             	push   0xc(%ebp)
+ 138:	ff 75 08             	push   0x8(%ebp)
+ 13b:	e8 32 ff ff ff       	call   72 <stosb>
+ 140:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 146:	c9                   	leave
+ 147:	c3                   	ret
+
+00000148 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 151:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 154:	eb 14                	jmp    16a <strchr+0x22>
+    if(*s == c)
+ 156:	8b 45 08             	mov    0x8(%ebp),%eax
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 15f:	75 05                	jne    166 <strchr+0x1e>
+      return (char*)s;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+ 164:	eb 13                	jmp    179 <strchr+0x31>
+  for(; *s; s++)
+ 166:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16d:	0f b6 00             	movzbl (%eax),%eax
+ 170:	84 c0                	test   %al,%al
+ 172:	75 e2                	jne    156 <strchr+0xe>
+  return 0;
+ 174:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 179:	c9                   	leave
+ 17a:	c3                   	ret
+
+0000017b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17b:	55                   	push   %ebp
+ 17c:	89 e5                	mov    %esp,%ebp
+ 17e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 181:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 188:	eb 42                	jmp    1cc <gets+0x51>
+    cc = read(0, &c, 1);
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	6a 01                	push   $0x1
+ 18f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 192:	50                   	push   %eax
+ 193:	6a 00                	push   $0x0
+ 195:	e8 85 01 00 00       	call   31f <read>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a4:	7e 33                	jle    1d9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1af:	89 c2                	mov    %eax,%edx
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	01 c2                	add    %eax,%edx
+ 1b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ba:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c0:	3c 0a                	cmp    $0xa,%al
+ 1c2:	74 16                	je     1da <gets+0x5f>
+ 1c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c8:	3c 0d                	cmp    $0xd,%al
+ 1ca:	74 0e                	je     1da <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1cf:	83 c0 01             	add    $0x1,%eax
+ 1d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d5:	7f b3                	jg     18a <gets+0xf>
+ 1d7:	eb 01                	jmp    1da <gets+0x5f>
+      break;
+ 1d9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e0:	01 d0                	add    %edx,%eax
+ 1e2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e8:	c9                   	leave
+ 1e9:	c3                   	ret
+
+000001ea <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	ff 75 08             	push   0x8(%ebp)
+ 1f8:	e8 4a 01 00 00       	call   347 <open>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 207:	79 07                	jns    210 <stat+0x26>
+    return -1;
+ 209:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20e:	eb 25                	jmp    235 <stat+0x4b>
+  r = fstat(fd, st);
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	ff 75 0c             	push   0xc(%ebp)
+ 216:	ff 75 f4             	push   -0xc(%ebp)
+ 219:	e8 41 01 00 00       	call   35f <fstat>
+ 21e:	83 c4 10             	add    $0x10,%esp
+ 221:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 224:	83 ec 0c             	sub    $0xc,%esp
+ 227:	ff 75 f4             	push   -0xc(%ebp)
+ 22a:	e8 00 01 00 00       	call   32f <close>
+ 22f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 232:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 244:	eb 25                	jmp    26b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 246:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 249:	89 d0                	mov    %edx,%eax
+ 24b:	c1 e0 02             	shl    $0x2,%eax
+ 24e:	01 d0                	add    %edx,%eax
+ 250:	01 c0                	add    %eax,%eax
+ 252:	89 c1                	mov    %eax,%ecx
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	8d 50 01             	lea    0x1(%eax),%edx
+ 25a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f be c0             	movsbl %al,%eax
+ 263:	01 c8                	add    %ecx,%eax
+ 265:	83 e8 30             	sub    $0x30,%eax
+ 268:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	0f b6 00             	movzbl (%eax),%eax
+ 271:	3c 2f                	cmp    $0x2f,%al
+ 273:	7e 0a                	jle    27f <atoi+0x48>
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 00             	movzbl (%eax),%eax
+ 27b:	3c 39                	cmp    $0x39,%al
+ 27d:	7e c7                	jle    246 <atoi+0xf>
+  return n;
+ 27f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 282:	c9                   	leave
+ 283:	c3                   	ret
+
+00000284 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 284:	55                   	push   %ebp
+ 285:	89 e5                	mov    %esp,%ebp
+ 287:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 296:	eb 17                	jmp    2af <memmove+0x2b>
+    *dst++ = *src++;
+ 298:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29b:	8d 42 01             	lea    0x1(%edx),%eax
+ 29e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2aa:	0f b6 12             	movzbl (%edx),%edx
+ 2ad:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2af:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b5:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b8:	85 c0                	test   %eax,%eax
+ 2ba:	7f dc                	jg     298 <memmove+0x14>
+  return vdst;
+ 2bc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2bf:	c9                   	leave
+ 2c0:	c3                   	ret
+
+000002c1 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 2c1:	55                   	push   %ebp
+ 2c2:	89 e5                	mov    %esp,%ebp
+ 2c4:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 2c7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2ce:	eb 04                	jmp    2d4 <ncpus+0x13>
+ 2d0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2d4:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 2d8:	7f 16                	jg     2f0 <ncpus+0x2f>
+ 2da:	83 ec 08             	sub    $0x8,%esp
+ 2dd:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 2e0:	50                   	push   %eax
+ 2e1:	ff 75 f4             	push   -0xc(%ebp)
+ 2e4:	e8 d6 00 00 00       	call   3bf <intrstat>
+ 2e9:	83 c4 10             	add    $0x10,%esp
+ 2ec:	85 c0                	test   %eax,%eax
+ 2ee:	74 e0                	je     2d0 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 2f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2f8:	85 c0                	test   %eax,%eax
+ 2fa:	0f 4e c2             	cmovle %edx,%eax
+}
+ 2fd:	c9                   	leave
+ 2fe:	c3                   	ret
+
+000002ff <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 2ff:	b8 01 00 00 00       	mov    $0x1,%eax
+ 304:	cd 40                	int    $0x40
+ 306:	c3                   	ret
+
+00000307 <exit>:
+SYSCALL(exit)
+ 307:	b8 02 00 00 00       	mov    $0x2,%eax
+ 30c:	cd 40                	int    $0x40
+ 30e:	c3                   	ret
+
+0000030f <wait>:
+SYSCALL(wait)
+ 30f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 314:	cd 40                	int    $0x40
+ 316:	c3                   	ret
+
+00000317 <pipe>:
+SYSCALL(pipe)
+ 317:	b8 04 00 00 00       	mov    $0x4,%eax
+ 31c:	cd 40                	int    $0x40
+ 31e:	c3                   	ret
+
+0000031f <read>:
+SYSCALL(read)
+ 31f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 324:	cd 40                	int    $0x40
+ 326:	c3                   	ret
+
+00000327 <write>:
+SYSCALL(write)
+ 327:	b8 10 00 00 00       	mov    $0x10,%eax
+ 32c:	cd 40                	int    $0x40
+ 32e:	c3                   	ret
+
+0000032f <close>:
+SYSCALL(close)
+ 32f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 334:	cd 40                	int    $0x40
+ 336:	c3                   	ret
+
+00000337 <kill>:
+SYSCALL(kill)
+ 337:	b8 06 00 00 00       	mov    $0x6,%eax
+ 33c:	cd 40                	int    $0x40
+ 33e:	c3                   	ret
+
+0000033f <exec>:
+SYSCALL(exec)
+ 33f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 344:	cd 40                	int    $0x40
+ 346:	c3                   	ret
+
+00000347 <open>:
+SYSCALL(open)
+ 347:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 34c:	cd 40                	int    $0x40
+ 34e:	c3                   	ret
+
+0000034f <mknod>:
+SYSCALL(mknod)
+ 34f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 354:	cd 40                	int    $0x40
+ 356:	c3                   	ret
+
+00000357 <unlink>:
+SYSCALL(unlink)
+ 357:	b8 12 00 00 00       	mov    $0x12,%eax
+ 35c:	cd 40                	int    $0x40
+ 35e:	c3                   	ret
+
+0000035f <fstat>:
+SYSCALL(fstat)
+ 35f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 364:	cd 40                	int    $0x40
+ 366:	c3                   	ret
+
+00000367 <link>:
+SYSCALL(link)
+ 367:	b8 13 00 00 00       	mov    $0x13,%eax
+ 36c:	cd 40                	int    $0x40
+ 36e:	c3                   	ret
+
+0000036f <mkdir>:
+SYSCALL(mkdir)
+ 36f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 374:	cd 40                	int    $0x40
+ 376:	c3                   	ret
+
+00000377 <chdir>:
+SYSCALL(chdir)
+ 377:	b8 09 00 00 00       	mov    $0x9,%eax
+ 37c:	cd 40                	int    $0x40
+ 37e:	c3                   	ret
+
+0000037f <dup>:
+SYSCALL(dup)
+ 37f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 384:	cd 40                	int    $0x40
+ 386:	c3                   	ret
+
+00000387 <getpid>:
+SYSCALL(getpid)
+ 387:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 38c:	cd 40                	int    $0x40
+ 38e:	c3                   	ret
+
+0000038f <sbrk>:
+SYSCALL(sbrk)
+ 38f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 394:	cd 40                	int    $0x40
+ 396:	c3                   	ret
+
+00000397 <sleep>:
+SYSCALL(sleep)
+ 397:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 39c:	cd 40                	int    $0x40
+ 39e:	c3                   	ret
+
+0000039f <uptime>:
+SYSCALL(uptime)
+ 39f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3a4:	cd 40                	int    $0x40
+ 3a6:	c3                   	ret
+
+000003a7 <poll>:
+SYSCALL(poll)
+ 3a7:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3ac:	cd 40                	int    $0x40
+ 3ae:	c3                   	ret
+
+000003af <fcntl>:
+SYSCALL(fcntl)
+ 3af:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3b4:	cd 40                	int    $0x40
+ 3b6:	c3                   	ret
+
+000003b7 <irqroute>:
+SYSCALL(irqroute)
+ 3b7:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3bc:	cd 40                	int    $0x40
+ 3be:	c3                   	ret
+
+000003bf <intrstat>:
+SYSCALL(intrstat)
+ 3bf:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3c4:	cd 40                	int    $0x40
+ 3c6:	c3                   	ret
+
+000003c7 <pread>:
+SYSCALL(pread)
+ 3c7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3cc:	cd 40                	int    $0x40
+ 3ce:	c3                   	ret
+
+000003cf <getdents>:
+SYSCALL(getdents)
+ 3cf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3d4:	cd 40                	int    $0x40
+ 3d6:	c3                   	ret
+
+000003d7 <fstatat>:
+SYSCALL(fstatat)
+ 3d7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3dc:	cd 40                	int    $0x40
+ 3de:	c3                   	ret
+
+000003df <openat>:
+SYSCALL(openat)
+ 3df:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3e4:	cd 40                	int    $0x40
+ 3e6:	c3                   	ret
+
+000003e7 <unlinkat>:
+SYSCALL(unlinkat)
+ 3e7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3ec:	cd 40                	int    $0x40
+ 3ee:	c3                   	ret
+
+000003ef <mkdirat>:
+SYSCALL(mkdirat)
+ 3ef:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3f4:	cd 40                	int    $0x40
+ 3f6:	c3                   	ret
+
+000003f7 <linkat>:
+SYSCALL(linkat)
+ 3f7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3fc:	cd 40                	int    $0x40
+ 3fe:	c3                   	ret
+
+000003ff <exits>:
+SYSCALL(exits)
+ 3ff:	b8 21 00 00 00       	mov    $0x21,%eax
+ 404:	cd 40                	int    $0x40
+ 406:	c3                   	ret
+
+00000407 <waitstatus>:
+SYSCALL(waitstatus)
+ 407:	b8 22 00 00 00       	mov    $0x22,%eax
+ 40c:	cd 40                	int    $0x40
+ 40e:	c3                   	ret
+
+0000040f <pwrite>:
+SYSCALL(pwrite)
+ 40f:	b8 23 00 00 00       	mov    $0x23,%eax
+ 414:	cd 40                	int    $0x40
+ 416:	c3                   	ret
+
+00000417 <lseek>:
+SYSCALL(lseek)
+ 417:	b8 24 00 00 00       	mov    $0x24,%eax
+ 41c:	cd 40                	int    $0x40
+ 41e:	c3                   	ret
+
+0000041f <copyfilerange>:
+SYSCALL(copyfilerange)
+ 41f:	b8 25 00 00 00       	mov    $0x25,%eax
+ 424:	cd 40                	int    $0x40
+ 426:	c3                   	ret
+
+00000427 <fsctl>:
+SYSCALL(fsctl)
+ 427:	b8 26 00 00 00       	mov    $0x26,%eax
+ 42c:	cd 40                	int    $0x40
+ 42e:	c3                   	ret
+
+0000042f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 42f:	55                   	push   %ebp
+ 430:	89 e5                	mov    %esp,%ebp
+ 432:	83 ec 18             	sub    $0x18,%esp
+ 435:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 438:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 43b:	83 ec 04             	sub    $0x4,%esp
+ 43e:	6a 01                	push   $0x1
+ 440:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 443:	50                   	push   %eax
+ 444:	ff 75 08             	push   0x8(%ebp)
+ 447:	e8 db fe ff ff       	call   327 <write>
+ 44c:	83 c4 10             	add    $0x10,%esp
+}
+ 44f:	90                   	nop
+ 450:	c9                   	leave
+ 451:	c3                   	ret
+
+00000452 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 452:	55                   	push   %ebp
+ 453:	89 e5                	mov    %esp,%ebp
+ 455:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 458:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 45f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 463:	74 17                	je     47c <printint+0x2a>
+ 465:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 469:	79 11                	jns    47c <printint+0x2a>
+    neg = 1;
+ 46b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 472:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 475:	f7 d8                	neg    %eax
+ 477:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 47a:	eb 06                	jmp    482 <printint+0x30>
+  } else {
+    x = xx;
+ 47c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 482:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 489:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 48c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 48f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 494:	f7 f1                	div    %ecx
+ 496:	89 d1                	mov    %edx,%ecx
+ 498:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 49b:	8d 50 01             	lea    0x1(%eax),%edx
+ 49e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4a1:	0f b6 91 40 0b 00 00 	movzbl 0xb40(%ecx),%edx
+ 4a8:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4ac:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4b2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b7:	f7 f1                	div    %ecx
+ 4b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4c0:	75 c7                	jne    489 <printint+0x37>
+  if(neg)
+ 4c2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4c6:	74 2d                	je     4f5 <printint+0xa3>
+    buf[i++] = '-';
+ 4c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4cb:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ce:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4d1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 4d6:	eb 1d                	jmp    4f5 <printint+0xa3>
+    putc(fd, buf[i]);
+ 4d8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 4db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4de:	01 d0                	add    %edx,%eax
+ 4e0:	0f b6 00             	movzbl (%eax),%eax
+ 4e3:	0f be c0             	movsbl %al,%eax
+ 4e6:	83 ec 08             	sub    $0x8,%esp
+ 4e9:	50                   	push   %eax
+ 4ea:	ff 75 08             	push   0x8(%ebp)
+ 4ed:	e8 3d ff ff ff       	call   42f <putc>
+ 4f2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 4f5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4f9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4fd:	79 d9                	jns    4d8 <printint+0x86>
+}
+ 4ff:	90                   	nop
+ 500:	90                   	nop
+ 501:	c9                   	leave
+ 502:	c3                   	ret
+
+00000503 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 503:	55                   	push   %ebp
+ 504:	89 e5                	mov    %esp,%ebp
+ 506:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 509:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 510:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 513:	83 c0 04             	add    $0x4,%eax
+ 516:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 519:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 520:	e9 59 01 00 00       	jmp    67e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 525:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 528:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 52b:	01 d0                	add    %edx,%eax
+ 52d:	0f b6 00             	movzbl (%eax),%eax
+ 530:	0f be c0             	movsbl %al,%eax
+ 533:	25 ff 00 00 00       	and    $0xff,%eax
+ 538:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 53b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 53f:	75 2c                	jne    56d <printf+0x6a>
+      if(c == '%'){
+ 541:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 545:	75 0c                	jne    553 <printf+0x50>
+        state = '%';
+ 547:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 54e:	e9 27 01 00 00       	jmp    67a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 553:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 556:	0f be c0             	movsbl %al,%eax
+ 559:	83 ec 08             	sub    $0x8,%esp
+ 55c:	50                   	push   %eax
+ 55d:	ff 75 08             	push   0x8(%ebp)
+ 560:	e8 ca fe ff ff       	call   42f <putc>
+ 565:	83 c4 10             	add    $0x10,%esp
+ 568:	e9 0d 01 00 00       	jmp    67a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 56d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 571:	0f 85 03 01 00 00    	jne    67a <printf+0x177>
+      if(c == 'd'){
+ 577:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 57b:	75 1e                	jne    59b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 57d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 580:	8b 00                	mov    (%eax),%eax
+ 582:	6a 01                	push   $0x1
+ 584:	6a 0a                	push   $0xa
+ 586:	50                   	push   %eax
+ 587:	ff 75 08             	push   0x8(%ebp)
+ 58a:	e8 c3 fe ff ff       	call   452 <printint>
+ 58f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 592:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 596:	e9 d8 00 00 00       	jmp    673 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 59b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 59f:	74 06                	je     5a7 <printf+0xa4>
+ 5a1:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5a5:	75 1e                	jne    5c5 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5aa:	8b 00                	mov    (%eax),%eax
+ 5ac:	6a 00                	push   $0x0
+ 5ae:	6a 10                	push   $0x10
+ 5b0:	50                   	push   %eax
+ 5b1:	ff 75 08             	push   0x8(%ebp)
+ 5b4:	e8 99 fe ff ff       	call   452 <printint>
+ 5b9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5bc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5c0:	e9 ae 00 00 00       	jmp    673 <printf+0x170>
+      } else if(c == 's'){
+ 5c5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5c9:	75 43                	jne    60e <printf+0x10b>
+        s = (char*)*ap;
+ 5cb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ce:	8b 00                	mov    (%eax),%eax
+ 5d0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 5d3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 5d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5db:	75 25                	jne    602 <printf+0xff>
+          s = "(null)";
+ 5dd:	c7 45 f4 ce 08 00 00 	movl   $0x8ce,-0xc(%ebp)
+        while(*s != 0){
+ 5e4:	eb 1c                	jmp    602 <printf+0xff>
+          putc(fd, *s);
+ 5e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5e9:	0f b6 00             	movzbl (%eax),%eax
+ 5ec:	0f be c0             	movsbl %al,%eax
+ 5ef:	83 ec 08             	sub    $0x8,%esp
+ 5f2:	50                   	push   %eax
+ 5f3:	ff 75 08             	push   0x8(%ebp)
+ 5f6:	e8 34 fe ff ff       	call   42f <putc>
+ 5fb:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 5fe:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 602:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 605:	0f b6 00             	movzbl (%eax),%eax
+ 608:	84 c0                	test   %al,%al
+ 60a:	75 da                	jne    5e6 <printf+0xe3>
+ 60c:	eb 65                	jmp    673 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 60e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 612:	75 1d                	jne    631 <printf+0x12e>
+        putc(fd, *ap);
+ 614:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 617:	8b 00                	mov    (%eax),%eax
+ 619:	0f be c0             	movsbl %al,%eax
+ 61c:	83 ec 08             	sub    $0x8,%esp
+ 61f:	50                   	push   %eax
+ 620:	ff 75 08             	push   0x8(%ebp)
+ 623:	e8 07 fe ff ff       	call   42f <putc>
+ 628:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 62b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 62f:	eb 42                	jmp    673 <printf+0x170>
+      } else if(c == '%'){
+ 631:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 635:	75 17                	jne    64e <printf+0x14b>
+        putc(fd, c);
+ 637:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 63a:	0f be c0             	movsbl %al,%eax
+ 63d:	83 ec 08             	sub    $0x8,%esp
+ 640:	50                   	push   %eax
+ 641:	ff 75 08             	push   0x8(%ebp)
+ 644:	e8 e6 fd ff ff       	call   42f <putc>
+ 649:	83 c4 10             	add    $0x10,%esp
+ 64c:	eb 25                	jmp    673 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 64e:	83 ec 08             	sub    $0x8,%esp
+ 651:	6a 25                	push   $0x25
+ 653:	ff 75 08             	push   0x8(%ebp)
+ 656:	e8 d4 fd ff ff       	call   42f <putc>
+ 65b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 65e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 661:	0f be c0             	movsbl %al,%eax
+ 664:	83 ec 08             	sub    $0x8,%esp
+ 667:	50                   	push   %eax
+ 668:	ff 75 08             	push   0x8(%ebp)
+ 66b:	e8 bf fd ff ff       	call   42f <putc>
+ 670:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 673:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 67a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 67e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 681:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 684:	01 d0                	add    %edx,%eax
+ 686:	0f b6 00             	movzbl (%eax),%eax
+ 689:	84 c0                	test   %al,%al
+ 68b:	0f 85 94 fe ff ff    	jne    525 <printf+0x22>
+    }
+  }
+}
+ 691:	90                   	nop
+ 692:	90                   	nop
+ 693:	c9                   	leave
+ 694:	c3                   	ret
+
+00000695 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 695:	55                   	push   %ebp
+ 696:	89 e5                	mov    %esp,%ebp
+ 698:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 69b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69e:	83 e8 08             	sub    $0x8,%eax
+ 6a1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a4:	a1 5c 0b 00 00       	mov    0xb5c,%eax
+ 6a9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6ac:	eb 24                	jmp    6d2 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b1:	8b 00                	mov    (%eax),%eax
+ 6b3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6b6:	72 12                	jb     6ca <free+0x35>
+ 6b8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6bb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6be:	72 24                	jb     6e4 <free+0x4f>
+ 6c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c3:	8b 00                	mov    (%eax),%eax
+ 6c5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6c8:	72 1a                	jb     6e4 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6cd:	8b 00                	mov    (%eax),%eax
+ 6cf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6d2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6d5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6d8:	73 d4                	jae    6ae <free+0x19>
+ 6da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6dd:	8b 00                	mov    (%eax),%eax
+ 6df:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6e2:	73 ca                	jae    6ae <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ea:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6f1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f4:	01 c2                	add    %eax,%edx
+ 6f6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f9:	8b 00                	mov    (%eax),%eax
+ 6fb:	39 c2                	cmp    %eax,%edx
+ 6fd:	75 24                	jne    723 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 6ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 702:	8b 50 04             	mov    0x4(%eax),%edx
+ 705:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 708:	8b 00                	mov    (%eax),%eax
+ 70a:	8b 40 04             	mov    0x4(%eax),%eax
+ 70d:	01 c2                	add    %eax,%edx
+ 70f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 712:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 715:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 718:	8b 00                	mov    (%eax),%eax
+ 71a:	8b 10                	mov    (%eax),%edx
+ 71c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 71f:	89 10                	mov    %edx,(%eax)
+ 721:	eb 0a                	jmp    72d <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 723:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 726:	8b 10                	mov    (%eax),%edx
+ 728:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 72b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 72d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 730:	8b 40 04             	mov    0x4(%eax),%eax
+ 733:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 73a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73d:	01 d0                	add    %edx,%eax
+ 73f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 742:	75 20                	jne    764 <free+0xcf>
+    p->s.size += bp->s.size;
+ 744:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 747:	8b 50 04             	mov    0x4(%eax),%edx
+ 74a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74d:	8b 40 04             	mov    0x4(%eax),%eax
+ 750:	01 c2                	add    %eax,%edx
+ 752:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 755:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 758:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 75b:	8b 10                	mov    (%eax),%edx
+ 75d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 760:	89 10                	mov    %edx,(%eax)
+ 762:	eb 08                	jmp    76c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 764:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 767:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 76a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 76c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 76f:	a3 5c 0b 00 00       	mov    %eax,0xb5c
+}
+ 774:	90                   	nop
+ 775:	c9                   	leave
+ 776:	c3                   	ret
+
+00000777 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 777:	55                   	push   %ebp
+ 778:	89 e5                	mov    %esp,%ebp
+ 77a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 77d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 784:	77 07                	ja     78d <morecore+0x16>
+    nu = 4096;
+ 786:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 78d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 790:	c1 e0 03             	shl    $0x3,%eax
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	50                   	push   %eax
+ 797:	e8 f3 fb ff ff       	call   38f <sbrk>
+ 79c:	83 c4 10             	add    $0x10,%esp
+ 79f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7a2:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7a6:	75 07                	jne    7af <morecore+0x38>
+    return 0;
+ 7a8:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7ad:	eb 26                	jmp    7d5 <morecore+0x5e>
+  hp = (Header*)p;
+ 7af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7b5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7bb:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7c1:	83 c0 08             	add    $0x8,%eax
+ 7c4:	83 ec 0c             	sub    $0xc,%esp
+ 7c7:	50                   	push   %eax
+ 7c8:	e8 c8 fe ff ff       	call   695 <free>
+ 7cd:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 7d0:	a1 5c 0b 00 00       	mov    0xb5c,%eax
+}
+ 7d5:	c9                   	leave
+ 7d6:	c3                   	ret
+
+000007d7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7d7:	55                   	push   %ebp
+ 7d8:	89 e5                	mov    %esp,%ebp
+ 7da:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e0:	83 c0 07             	add    $0x7,%eax
+ 7e3:	c1 e8 03             	shr    $0x3,%eax
+ 7e6:	83 c0 01             	add    $0x1,%eax
+ 7e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 7ec:	a1 5c 0b 00 00       	mov    0xb5c,%eax
+ 7f1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7f4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7f8:	75 23                	jne    81d <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 7fa:	c7 45 f0 54 0b 00 00 	movl   $0xb54,-0x10(%ebp)
+ 801:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 804:	a3 5c 0b 00 00       	mov    %eax,0xb5c
+ 809:	a1 5c 0b 00 00       	mov    0xb5c,%eax
+ 80e:	a3 54 0b 00 00       	mov    %eax,0xb54
+    base.s.size = 0;
+ 813:	c7 05 58 0b 00 00 00 	movl   $0x0,0xb58
+ 81a:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 81d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 820:	8b 00                	mov    (%eax),%eax
+ 822:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 825:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 828:	8b 40 04             	mov    0x4(%eax),%eax
+ 82b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 82e:	72 4d                	jb     87d <malloc+0xa6>
+      if(p->s.size == nunits)
+ 830:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 833:	8b 40 04             	mov    0x4(%eax),%eax
+ 836:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 839:	75 0c                	jne    847 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 83b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 83e:	8b 10                	mov    (%eax),%edx
+ 840:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 843:	89 10                	mov    %edx,(%eax)
+ 845:	eb 26                	jmp    86d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 847:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84a:	8b 40 04             	mov    0x4(%eax),%eax
+ 84d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 850:	89 c2                	mov    %eax,%edx
+ 852:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 855:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 858:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85b:	8b 40 04             	mov    0x4(%eax),%eax
+ 85e:	c1 e0 03             	shl    $0x3,%eax
+ 861:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 864:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 867:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 86a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 86d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 870:	a3 5c 0b 00 00       	mov    %eax,0xb5c
+      return (void*)(p + 1);
+ 875:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 878:	83 c0 08             	add    $0x8,%eax
+ 87b:	eb 3b                	jmp    8b8 <malloc+0xe1>
+    }
+    if(p == freep)
+ 87d:	a1 5c 0b 00 00       	mov    0xb5c,%eax
+ 882:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 885:	75 1e                	jne    8a5 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 887:	83 ec 0c             	sub    $0xc,%esp
+ 88a:	ff 75 ec             	push   -0x14(%ebp)
+ 88d:	e8 e5 fe ff ff       	call   777 <morecore>
+ 892:	83 c4 10             	add    $0x10,%esp
+ 895:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 898:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89c:	75 07                	jne    8a5 <malloc+0xce>
+        return 0;
+ 89e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8a3:	eb 13                	jmp    8b8 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8a8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ae:	8b 00                	mov    (%eax),%eax
+ 8b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8b3:	e9 6d ff ff ff       	jmp    825 <malloc+0x4e>
+  }
+}
+ 8b8:	c9                   	leave
+ 8b9:	c3                   	ret
@@ -14,6 +14,9 @@
 #define VER     (0x0030/4)   // Version
 #define TPR     (0x0080/4)   // Task Priority
 #define EOI     (0x00B0/4)   // EOI
+#define LDR     (0x00D0/4)   // Logical Destination
+#define DFR     (0x00E0/4)   // Destination Format
+  #define FLAT       0xFFFFFFFF   // Flat model: LDR is a CPU bitmask
 #define SVR     (0x00F0/4)   // Spurious Interrupt Vector
   #define ENABLE     0x00000100   // Unit Enable
 #define ESR     (0x0280/4)   // Error Status
@@ -59,6 +62,11 @@ lapicinit(void)
   // Enable local APIC; set spurious interrupt vector.
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
+  // Give each CPU logical ID bit (1 << APIC ID) so that the
+  // I/O APIC can address a set of CPUs (see ioapicroute).
+  lapicw(DFR, FLAT);
+  lapicw(LDR, (1 << ((lapic[ID] >> 24) & 7)) << 24);
+
   // The timer repeatedly counts down at bus frequency
   // from lapic[TICR] and then issues an interrupt.  
   // If xv6 cared more about precise timekeeping,
@@ -124,6 +132,24 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+
+  // ICRHI and ICRLO must be written as a pair.
+  pushcli();
+  while(lapic[ICRLO] & DELIVS)
+    ;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+  popcli();
+}
+
 // Spin for a given number of microseconds.
 // On real hardware would want to tune this dynamically.
 void
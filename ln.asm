@@ -0,0 +1,1265 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+  if(argc != 3){
+  11:	83 3b 03             	cmpl   $0x3,(%ebx)
+  14:	74 17                	je     2d <main+0x2d>
+    printf(2, "Usage: ln old new\n");
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	68 bc 08 00 00       	push   $0x8bc
+  1e:	6a 02                	push   $0x2
+  20:	e8 e0 04 00 00       	call   505 <printf>
+  25:	83 c4 10             	add    $0x10,%esp
+    exit();
+  28:	e8 dc 02 00 00       	call   309 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  30:	83 c0 08             	add    $0x8,%eax
+  33:	8b 10                	mov    (%eax),%edx
+  35:	8b 43 04             	mov    0x4(%ebx),%eax
+  38:	83 c0 04             	add    $0x4,%eax
+  3b:	8b 00                	mov    (%eax),%eax
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	52                   	push   %edx
+  41:	50                   	push   %eax
+  42:	e8 22 03 00 00       	call   369 <link>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	79 21                	jns    6f <main+0x6f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  51:	83 c0 08             	add    $0x8,%eax
+  54:	8b 10                	mov    (%eax),%edx
+  56:	8b 43 04             	mov    0x4(%ebx),%eax
+  59:	83 c0 04             	add    $0x4,%eax
+  5c:	8b 00                	mov    (%eax),%eax
+  5e:	52                   	push   %edx
+  5f:	50                   	push   %eax
+  60:	68 cf 08 00 00       	push   $0x8cf
+  65:	6a 02                	push   $0x2
+  67:	e8 99 04 00 00       	call   505 <printf>
+  6c:	83 c4 10             	add    $0x10,%esp
+  exit();
+  6f:	e8 95 02 00 00       	call   309 <exit>
+
+00000074 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+  77:	57                   	push   %edi
+  78:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7c:	8b 55 10             	mov    0x10(%ebp),%edx
+  7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  82:	89 cb                	mov    %ecx,%ebx
+  84:	89 df                	mov    %ebx,%edi
+  86:	89 d1                	mov    %edx,%ecx
+  88:	fc                   	cld
+  89:	f3 aa                	rep stos %al,%es:(%edi)
+  8b:	89 ca                	mov    %ecx,%edx
+  8d:	89 fb                	mov    %edi,%ebx
+  8f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  92:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  95:	90                   	nop
+  96:	5b                   	pop    %ebx
+  97:	5f                   	pop    %edi
+  98:	5d                   	pop    %ebp
+  99:	c3                   	ret
+
+0000009a <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  9a:	55                   	push   %ebp
+  9b:	89 e5                	mov    %esp,%ebp
+  9d:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  a3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a6:	90                   	nop
+  a7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  aa:	8d 42 01             	lea    0x1(%edx),%eax
+  ad:	89 45 0c             	mov    %eax,0xc(%ebp)
+  b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  b3:	8d 48 01             	lea    0x1(%eax),%ecx
+  b6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b9:	0f b6 12             	movzbl (%edx),%edx
+  bc:	88 10                	mov    %dl,(%eax)
+  be:	0f b6 00             	movzbl (%eax),%eax
+  c1:	84 c0                	test   %al,%al
+  c3:	75 e2                	jne    a7 <strcpy+0xd>
+    ;
+  return os;
+  c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c8:	c9                   	leave
+  c9:	c3                   	ret
+
+000000ca <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  ca:	55                   	push   %ebp
+  cb:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cd:	eb 08                	jmp    d7 <strcmp+0xd>
+    p++, q++;
+  cf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	74 10                	je     f1 <strcmp+0x27>
+  e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  e4:	0f b6 10             	movzbl (%eax),%edx
+  e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  ea:	0f b6 00             	movzbl (%eax),%eax
+  ed:	38 c2                	cmp    %al,%dl
+  ef:	74 de                	je     cf <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  f1:	8b 45 08             	mov    0x8(%ebp),%eax
+  f4:	0f b6 00             	movzbl (%eax),%eax
+  f7:	0f b6 d0             	movzbl %al,%edx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	0f b6 00             	movzbl (%eax),%eax
+ 100:	0f b6 c0             	movzbl %al,%eax
+ 103:	29 c2                	sub    %eax,%edx
+ 105:	89 d0                	mov    %edx,%eax
+}
+ 107:	5d                   	pop    %ebp
+ 108:	c3                   	ret
+
+00000109 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 109:	55                   	push   %ebp
+ 10a:	89 e5                	mov    %esp,%ebp
+ 10c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 10f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 116:	eb 04                	jmp    11c <strlen+0x13>
+ 118:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 122:	01 d0                	add    %edx,%eax
+ 124:	0f b6 00             	movzbl (%eax),%eax
+ 127:	84 c0                	test   %al,%al
+ 129:	75 ed                	jne    118 <strlen+0xf>
+    ;
+  return n;
+ 12b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12e:	c9                   	leave
+ 12f:	c3                   	ret
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 133:	8b 45 10             	mov    0x10(%ebp),%eax
+ 136:	50                   	push   %eax
+ 137:	ff 75 0c             	push   0xc(%ebp)
+ 13a:	ff 75 08             	push   0x8(%ebp)
+ 13d:	e8 32 ff ff ff       	call   74 <stosb>
+ 142:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 145:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 148:	c9                   	leave
+ 149:	c3                   	ret
+
+0000014a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 14a:	55                   	push   %ebp
+ 14b:	89 e5                	mov    %esp,%ebp
+ 14d:	83 ec 04             	sub    $0x4,%esp
+ 150:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 153:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 156:	eb 14                	jmp    16c <strchr+0x22>
+    if(*s == c)
+ 158:	8b 45 08             	mov    0x8(%ebp),%eax
+ 15b:	0f b6 00             	movzbl (%eax),%eax
+ 15e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 161:	75 05                	jne    168 <strchr+0x1e>
+      return (char*)s;
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	eb 13                	jmp    17b <strchr+0x31>
+  for(; *s; s++)
+ 168:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16f:	0f b6 00             	movzbl (%eax),%eax
+ 172:	84 c0                	test   %al,%al
+ 174:	75 e2                	jne    158 <strchr+0xe>
+  return 0;
+ 176:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 17b:	c9                   	leave
+ 17c:	c3                   	ret
+
+0000017d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17d:	55                   	push   %ebp
+ 17e:	89 e5                	mov    %esp,%ebp
+ 180:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 183:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 18a:	eb 42                	jmp    1ce <gets+0x51>
+    cc = read(0, &c, 1);
+ 18c:	83 ec 04             	sub    $0x4,%esp
+ 18f:	6a 01                	push   $0x1
+ 191:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 194:	50                   	push   %eax
+ 195:	6a 00                	push   $0x0
+ 197:	e8 85 01 00 00       	call   321 <read>
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a6:	7e 33                	jle    1db <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ab:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ae:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1b1:	89 c2                	mov    %eax,%edx
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	01 c2                	add    %eax,%edx
+ 1b8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1bc:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1be:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c2:	3c 0a                	cmp    $0xa,%al
+ 1c4:	74 16                	je     1dc <gets+0x5f>
+ 1c6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ca:	3c 0d                	cmp    $0xd,%al
+ 1cc:	74 0e                	je     1dc <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d1:	83 c0 01             	add    $0x1,%eax
+ 1d4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d7:	7f b3                	jg     18c <gets+0xf>
+ 1d9:	eb 01                	jmp    1dc <gets+0x5f>
+      break;
+ 1db:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e2:	01 d0                	add    %edx,%eax
+ 1e4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1ea:	c9                   	leave
+ 1eb:	c3                   	ret
+
+000001ec <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ec:	55                   	push   %ebp
+ 1ed:	89 e5                	mov    %esp,%ebp
+ 1ef:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f2:	83 ec 08             	sub    $0x8,%esp
+ 1f5:	6a 00                	push   $0x0
+ 1f7:	ff 75 08             	push   0x8(%ebp)
+ 1fa:	e8 4a 01 00 00       	call   349 <open>
+ 1ff:	83 c4 10             	add    $0x10,%esp
+ 202:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 205:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 209:	79 07                	jns    212 <stat+0x26>
+    return -1;
+ 20b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 210:	eb 25                	jmp    237 <stat+0x4b>
+  r = fstat(fd, st);
+ 212:	83 ec 08             	sub    $0x8,%esp
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 f4             	push   -0xc(%ebp)
+ 21b:	e8 41 01 00 00       	call   361 <fstat>
+ 220:	83 c4 10             	add    $0x10,%esp
+ 223:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 226:	83 ec 0c             	sub    $0xc,%esp
+ 229:	ff 75 f4             	push   -0xc(%ebp)
+ 22c:	e8 00 01 00 00       	call   331 <close>
+ 231:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 234:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 237:	c9                   	leave
+ 238:	c3                   	ret
+
+00000239 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 239:	55                   	push   %ebp
+ 23a:	89 e5                	mov    %esp,%ebp
+ 23c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 246:	eb 25                	jmp    26d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 248:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 24b:	89 d0                	mov    %edx,%eax
+ 24d:	c1 e0 02             	shl    $0x2,%eax
+ 250:	01 d0                	add    %edx,%eax
+ 252:	01 c0                	add    %eax,%eax
+ 254:	89 c1                	mov    %eax,%ecx
+ 256:	8b 45 08             	mov    0x8(%ebp),%eax
+ 259:	8d 50 01             	lea    0x1(%eax),%edx
+ 25c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25f:	0f b6 00             	movzbl (%eax),%eax
+ 262:	0f be c0             	movsbl %al,%eax
+ 265:	01 c8                	add    %ecx,%eax
+ 267:	83 e8 30             	sub    $0x30,%eax
+ 26a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 270:	0f b6 00             	movzbl (%eax),%eax
+ 273:	3c 2f                	cmp    $0x2f,%al
+ 275:	7e 0a                	jle    281 <atoi+0x48>
+ 277:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27a:	0f b6 00             	movzbl (%eax),%eax
+ 27d:	3c 39                	cmp    $0x39,%al
+ 27f:	7e c7                	jle    248 <atoi+0xf>
+  return n;
+ 281:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+
+00000286 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 286:	55                   	push   %ebp
+ 287:	89 e5                	mov    %esp,%ebp
+ 289:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 28c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 292:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 295:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 298:	eb 17                	jmp    2b1 <memmove+0x2b>
+    *dst++ = *src++;
+ 29a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29d:	8d 42 01             	lea    0x1(%edx),%eax
+ 2a0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2ac:	0f b6 12             	movzbl (%edx),%edx
+ 2af:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2b1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2ba:	85 c0                	test   %eax,%eax
+ 2bc:	7f dc                	jg     29a <memmove+0x14>
+  return vdst;
+ 2be:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c1:	c9                   	leave
+ 2c2:	c3                   	ret
+
+000002c3 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 2c3:	55                   	push   %ebp
+ 2c4:	89 e5                	mov    %esp,%ebp
+ 2c6:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 2c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2d0:	eb 04                	jmp    2d6 <ncpus+0x13>
+ 2d2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2d6:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 2da:	7f 16                	jg     2f2 <ncpus+0x2f>
+ 2dc:	83 ec 08             	sub    $0x8,%esp
+ 2df:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 2e2:	50                   	push   %eax
+ 2e3:	ff 75 f4             	push   -0xc(%ebp)
+ 2e6:	e8 d6 00 00 00       	call   3c1 <intrstat>
+ 2eb:	83 c4 10             	add    $0x10,%esp
+ 2ee:	85 c0                	test   %eax,%eax
+ 2f0:	74 e0                	je     2d2 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 2f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f5:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2fa:	85 c0                	test   %eax,%eax
+ 2fc:	0f 4e c2             	cmovle %edx,%eax
+}
+ 2ff:	c9                   	leave
+ 300:	c3                   	ret
+
+00000301 <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 301:	b8 01 00 00 00       	mov    $0x1,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <exit>:
+SYSCALL(exit)
+ 309:	b8 02 00 00 00       	mov    $0x2,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <wait>:
+SYSCALL(wait)
+ 311:	b8 03 00 00 00       	mov    $0x3,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <pipe>:
+SYSCALL(pipe)
+ 319:	b8 04 00 00 00       	mov    $0x4,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <read>:
+SYSCALL(read)
+ 321:	b8 05 00 00 00       	mov    $0x5,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <write>:
+SYSCALL(write)
+ 329:	b8 10 00 00 00       	mov    $0x10,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <close>:
+SYSCALL(close)
+ 331:	b8 15 00 00 00       	mov    $0x15,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <kill>:
+SYSCALL(kill)
+ 339:	b8 06 00 00 00       	mov    $0x6,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <exec>:
+SYSCALL(exec)
+ 341:	b8 07 00 00 00       	mov    $0x7,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <open>:
+SYSCALL(open)
+ 349:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <mknod>:
+SYSCALL(mknod)
+ 351:	b8 11 00 00 00       	mov    $0x11,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <unlink>:
+SYSCALL(unlink)
+ 359:	b8 12 00 00 00       	mov    $0x12,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <fstat>:
+SYSCALL(fstat)
+ 361:	b8 08 00 00 00       	mov    $0x8,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <link>:
+SYSCALL(link)
+ 369:	b8 13 00 00 00       	mov    $0x13,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <mkdir>:
+SYSCALL(mkdir)
+ 371:	b8 14 00 00 00       	mov    $0x14,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <chdir>:
+SYSCALL(chdir)
+ 379:	b8 09 00 00 00       	mov    $0x9,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <dup>:
+SYSCALL(dup)
+ 381:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <getpid>:
+SYSCALL(getpid)
+ 389:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <sbrk>:
+SYSCALL(sbrk)
+ 391:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <sleep>:
+SYSCALL(sleep)
+ 399:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <uptime>:
+SYSCALL(uptime)
+ 3a1:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <poll>:
+SYSCALL(poll)
+ 3a9:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <fcntl>:
+SYSCALL(fcntl)
+ 3b1:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <irqroute>:
+SYSCALL(irqroute)
+ 3b9:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <intrstat>:
+SYSCALL(intrstat)
+ 3c1:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <pread>:
+SYSCALL(pread)
+ 3c9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <getdents>:
+SYSCALL(getdents)
+ 3d1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <fstatat>:
+SYSCALL(fstatat)
+ 3d9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <openat>:
+SYSCALL(openat)
+ 3e1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <unlinkat>:
+SYSCALL(unlinkat)
+ 3e9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3ee:	cd 40                	int    $0x40
+ 3f0:	c3                   	ret
+
+000003f1 <mkdirat>:
+SYSCALL(mkdirat)
+ 3f1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3f6:	cd 40                	int    $0x40
+ 3f8:	c3                   	ret
+
+000003f9 <linkat>:
+SYSCALL(linkat)
+ 3f9:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3fe:	cd 40                	int    $0x40
+ 400:	c3                   	ret
+
+00000401 <exits>:
+SYSCALL(exits)
+ 401:	b8 21 00 00 00       	mov    $0x21,%eax
+ 406:	cd 40                	int    $0x40
+ 408:	c3                   	ret
+
+00000409 <waitstatus>:
+SYSCALL(waitstatus)
+ 409:	b8 22 00 00 00       	mov    $0x22,%eax
+ 40e:	cd 40                	int    $0x40
+ 410:	c3                   	ret
+
+00000411 <pwrite>:
+SYSCALL(pwrite)
+ 411:	b8 23 00 00 00       	mov    $0x23,%eax
+ 416:	cd 40                	int    $0x40
+ 418:	c3                   	ret
+
+00000419 <lseek>:
+SYSCALL(lseek)
+ 419:	b8 24 00 00 00       	mov    $0x24,%eax
+ 41e:	cd 40                	int    $0x40
+ 420:	c3                   	ret
+
+00000421 <copyfilerange>:
+SYSCALL(copyfilerange)
+ 421:	b8 25 00 00 00       	mov    $0x25,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <fsctl>:
+SYSCALL(fsctl)
+ 429:	b8 26 00 00 00       	mov    $0x26,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 431:	55                   	push   %ebp
+ 432:	89 e5                	mov    %esp,%ebp
+ 434:	83 ec 18             	sub    $0x18,%esp
+ 437:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 43a:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 43d:	83 ec 04             	sub    $0x4,%esp
+ 440:	6a 01                	push   $0x1
+ 442:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 445:	50                   	push   %eax
+ 446:	ff 75 08             	push   0x8(%ebp)
+ 449:	e8 db fe ff ff       	call   329 <write>
+ 44e:	83 c4 10             	add    $0x10,%esp
+}
+ 451:	90                   	nop
+ 452:	c9                   	leave
+ 453:	c3                   	ret
+
+00000454 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 454:	55                   	push   %ebp
+ 455:	89 e5                	mov    %esp,%ebp
+ 457:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 45a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 461:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 465:	74 17                	je     47e <printint+0x2a>
+ 467:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 46b:	79 11                	jns    47e <printint+0x2a>
+    neg = 1;
+ 46d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 474:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 477:	f7 d8                	neg    %eax
+ 479:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 47c:	eb 06                	jmp    484 <printint+0x30>
+  } else {
+    x = xx;
+ 47e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 481:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 484:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 48b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 48e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 491:	ba 00 00 00 00       	mov    $0x0,%edx
+ 496:	f7 f1                	div    %ecx
+ 498:	89 d1                	mov    %edx,%ecx
+ 49a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 49d:	8d 50 01             	lea    0x1(%eax),%edx
+ 4a0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4a3:	0f b6 91 54 0b 00 00 	movzbl 0xb54(%ecx),%edx
+ 4aa:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4ae:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4b1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4b4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b9:	f7 f1                	div    %ecx
+ 4bb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4be:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4c2:	75 c7                	jne    48b <printint+0x37>
+  if(neg)
+ 4c4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4c8:	74 2d                	je     4f7 <printint+0xa3>
+    buf[i++] = '-';
+ 4ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4cd:	8d 50 01             	lea    0x1(%eax),%edx
+ 4d0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4d3:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 4d8:	eb 1d                	jmp    4f7 <printint+0xa3>
+    putc(fd, buf[i]);
+ 4da:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 4dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4e0:	01 d0                	add    %edx,%eax
+ 4e2:	0f b6 00             	movzbl (%eax),%eax
+ 4e5:	0f be c0             	movsbl %al,%eax
+ 4e8:	83 ec 08             	sub    $0x8,%esp
+ 4eb:	50                   	push   %eax
+ 4ec:	ff 75 08             	push   0x8(%ebp)
+ 4ef:	e8 3d ff ff ff       	call   431 <putc>
+ 4f4:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 4f7:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4ff:	79 d9                	jns    4da <printint+0x86>
+}
+ 501:	90                   	nop
+ 502:	90                   	nop
+ 503:	c9                   	leave
+ 504:	c3                   	ret
+
+00000505 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 505:	55                   	push   %ebp
+ 506:	89 e5                	mov    %esp,%ebp
+ 508:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 50b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 512:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 515:	83 c0 04             	add    $0x4,%eax
+ 518:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 51b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 522:	e9 59 01 00 00       	jmp    680 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 527:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 52a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 52d:	01 d0                	add    %edx,%eax
+ 52f:	0f b6 00             	movzbl (%eax),%eax
+ 532:	0f be c0             	movsbl %al,%eax
+ 535:	25 ff 00 00 00       	and    $0xff,%eax
+ 53a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 53d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 541:	75 2c                	jne    56f <printf+0x6a>
+      if(c == '%'){
+ 543:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 547:	75 0c                	jne    555 <printf+0x50>
+        state = '%';
+ 549:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 550:	e9 27 01 00 00       	jmp    67c <printf+0x177>
+      } else {
+        putc(fd, c);
+ 555:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 558:	0f be c0             	movsbl %al,%eax
+ 55b:	83 ec 08             	sub    $0x8,%esp
+ 55e:	50                   	push   %eax
+ 55f:	ff 75 08             	push   0x8(%ebp)
+ 562:	e8 ca fe ff ff       	call   431 <putc>
+ 567:	83 c4 10             	add    $0x10,%esp
+ 56a:	e9 0d 01 00 00       	jmp    67c <printf+0x177>
+      }
+    } else if(state == '%'){
+ 56f:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 573:	0f 85 03 01 00 00    	jne    67c <printf+0x177>
+      if(c == 'd'){
+ 579:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 57d:	75 1e                	jne    59d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 57f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 582:	8b 00                	mov    (%eax),%eax
+ 584:	6a 01                	push   $0x1
+ 586:	6a 0a                	push   $0xa
+ 588:	50                   	push   %eax
+ 589:	ff 75 08             	push   0x8(%ebp)
+ 58c:	e8 c3 fe ff ff       	call   454 <printint>
+ 591:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 594:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 598:	e9 d8 00 00 00       	jmp    675 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 59d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5a1:	74 06                	je     5a9 <printf+0xa4>
+ 5a3:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5a7:	75 1e                	jne    5c7 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ac:	8b 00                	mov    (%eax),%eax
+ 5ae:	6a 00                	push   $0x0
+ 5b0:	6a 10                	push   $0x10
+ 5b2:	50                   	push   %eax
+ 5b3:	ff 75 08             	push   0x8(%ebp)
+ 5b6:	e8 99 fe ff ff       	call   454 <printint>
+ 5bb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5be:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5c2:	e9 ae 00 00 00       	jmp    675 <printf+0x170>
+      } else if(c == 's'){
+ 5c7:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5cb:	75 43                	jne    610 <printf+0x10b>
+        s = (char*)*ap;
+ 5cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5d0:	8b 00                	mov    (%eax),%eax
+ 5d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 5d5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 5d9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5dd:	75 25                	jne    604 <printf+0xff>
+          s = "(null)";
+ 5df:	c7 45 f4 e3 08 00 00 	movl   $0x8e3,-0xc(%ebp)
+        while(*s != 0){
+ 5e6:	eb 1c                	jmp    604 <printf+0xff>
+          putc(fd, *s);
+ 5e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5eb:	0f b6 00             	movzbl (%eax),%eax
+ 5ee:	0f be c0             	movsbl %al,%eax
+ 5f1:	83 ec 08             	sub    $0x8,%esp
+ 5f4:	50                   	push   %eax
+ 5f5:	ff 75 08             	push   0x8(%ebp)
+ 5f8:	e8 34 fe ff ff       	call   431 <putc>
+ 5fd:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 600:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 604:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 607:	0f b6 00             	movzbl (%eax),%eax
+ 60a:	84 c0                	test   %al,%al
+ 60c:	75 da                	jne    5e8 <printf+0xe3>
+ 60e:	eb 65                	jmp    675 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 610:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 614:	75 1d                	jne    633 <printf+0x12e>
+        putc(fd, *ap);
+ 616:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 619:	8b 00                	mov    (%eax),%eax
+ 61b:	0f be c0             	movsbl %al,%eax
+ 61e:	83 ec 08             	sub    $0x8,%esp
+ 621:	50                   	push   %eax
+ 622:	ff 75 08             	push   0x8(%ebp)
+ 625:	e8 07 fe ff ff       	call   431 <putc>
+ 62a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 62d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 631:	eb 42                	jmp    675 <printf+0x170>
+      } else if(c == '%'){
+ 633:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 637:	75 17                	jne    650 <printf+0x14b>
+        putc(fd, c);
+ 639:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 63c:	0f be c0             	movsbl %al,%eax
+ 63f:	83 ec 08             	sub    $0x8,%esp
+ 642:	50                   	push   %eax
+ 643:	ff 75 08             	push   0x8(%ebp)
+ 646:	e8 e6 fd ff ff       	call   431 <putc>
+ 64b:	83 c4 10             	add    $0x10,%esp
+ 64e:	eb 25                	jmp    675 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 650:	83 ec 08             	sub    $0x8,%esp
+ 653:	6a 25                	push   $0x25
+ 655:	ff 75 08             	push   0x8(%ebp)
+ 658:	e8 d4 fd ff ff       	call   431 <putc>
+ 65d:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 660:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 663:	0f be c0             	movsbl %al,%eax
+ 666:	83 ec 08             	sub    $0x8,%esp
+ 669:	50                   	push   %eax
+ 66a:	ff 75 08             	push   0x8(%ebp)
+ 66d:	e8 bf fd ff ff       	call   431 <putc>
+ 672:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 675:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 67c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 680:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 683:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 686:	01 d0                	add    %edx,%eax
+ 688:	0f b6 00             	movzbl (%eax),%eax
+ 68b:	84 c0                	test   %al,%al
+ 68d:	0f 85 94 fe ff ff    	jne    527 <printf+0x22>
+    }
+  }
+}
+ 693:	90                   	nop
+ 694:	90                   	nop
+ 695:	c9                   	leave
+ 696:	c3                   	ret
+
+00000697 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 697:	55                   	push   %ebp
+ 698:	89 e5                	mov    %esp,%ebp
+ 69a:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 69d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a0:	83 e8 08             	sub    $0x8,%eax
+ 6a3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6a6:	a1 70 0b 00 00       	mov    0xb70,%eax
+ 6ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6ae:	eb 24                	jmp    6d4 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b3:	8b 00                	mov    (%eax),%eax
+ 6b5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6b8:	72 12                	jb     6cc <free+0x35>
+ 6ba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6bd:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6c0:	72 24                	jb     6e6 <free+0x4f>
+ 6c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c5:	8b 00                	mov    (%eax),%eax
+ 6c7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6ca:	72 1a                	jb     6e6 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6cf:	8b 00                	mov    (%eax),%eax
+ 6d1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6d4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6d7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6da:	73 d4                	jae    6b0 <free+0x19>
+ 6dc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6df:	8b 00                	mov    (%eax),%eax
+ 6e1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6e4:	73 ca                	jae    6b0 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 6e6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e9:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ec:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6f3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f6:	01 c2                	add    %eax,%edx
+ 6f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fb:	8b 00                	mov    (%eax),%eax
+ 6fd:	39 c2                	cmp    %eax,%edx
+ 6ff:	75 24                	jne    725 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 701:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 704:	8b 50 04             	mov    0x4(%eax),%edx
+ 707:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 70a:	8b 00                	mov    (%eax),%eax
+ 70c:	8b 40 04             	mov    0x4(%eax),%eax
+ 70f:	01 c2                	add    %eax,%edx
+ 711:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 714:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 717:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 71a:	8b 00                	mov    (%eax),%eax
+ 71c:	8b 10                	mov    (%eax),%edx
+ 71e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 721:	89 10                	mov    %edx,(%eax)
+ 723:	eb 0a                	jmp    72f <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 725:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 728:	8b 10                	mov    (%eax),%edx
+ 72a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 72d:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 72f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 732:	8b 40 04             	mov    0x4(%eax),%eax
+ 735:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 73c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73f:	01 d0                	add    %edx,%eax
+ 741:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 744:	75 20                	jne    766 <free+0xcf>
+    p->s.size += bp->s.size;
+ 746:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 749:	8b 50 04             	mov    0x4(%eax),%edx
+ 74c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 74f:	8b 40 04             	mov    0x4(%eax),%eax
+ 752:	01 c2                	add    %eax,%edx
+ 754:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 757:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 75a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 75d:	8b 10                	mov    (%eax),%edx
+ 75f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 762:	89 10                	mov    %edx,(%eax)
+ 764:	eb 08                	jmp    76e <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 766:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 769:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 76c:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 76e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 771:	a3 70 0b 00 00       	mov    %eax,0xb70
+}
+ 776:	90                   	nop
+ 777:	c9                   	leave
+ 778:	c3                   	ret
+
+00000779 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 779:	55                   	push   %ebp
+ 77a:	89 e5                	mov    %esp,%ebp
+ 77c:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 77f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 786:	77 07                	ja     78f <morecore+0x16>
+    nu = 4096;
+ 788:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 78f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 792:	c1 e0 03             	shl    $0x3,%eax
+ 795:	83 ec 0c             	sub    $0xc,%esp
+ 798:	50                   	push   %eax
+ 799:	e8 f3 fb ff ff       	call   391 <sbrk>
+ 79e:	83 c4 10             	add    $0x10,%esp
+ 7a1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7a4:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7a8:	75 07                	jne    7b1 <morecore+0x38>
+    return 0;
+ 7aa:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7af:	eb 26                	jmp    7d7 <morecore+0x5e>
+  hp = (Header*)p;
+ 7b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7b7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ba:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7bd:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7c0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7c3:	83 c0 08             	add    $0x8,%eax
+ 7c6:	83 ec 0c             	sub    $0xc,%esp
+ 7c9:	50                   	push   %eax
+ 7ca:	e8 c8 fe ff ff       	call   697 <free>
+ 7cf:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 7d2:	a1 70 0b 00 00       	mov    0xb70,%eax
+}
+ 7d7:	c9                   	leave
+ 7d8:	c3                   	ret
+
+000007d9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7d9:	55                   	push   %ebp
+ 7da:	89 e5                	mov    %esp,%ebp
+ 7dc:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e2:	83 c0 07             	add    $0x7,%eax
+ 7e5:	c1 e8 03             	shr    $0x3,%eax
+ 7e8:	83 c0 01             	add    $0x1,%eax
+ 7eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 7ee:	a1 70 0b 00 00       	mov    0xb70,%eax
+ 7f3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7f6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7fa:	75 23                	jne    81f <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 7fc:	c7 45 f0 68 0b 00 00 	movl   $0xb68,-0x10(%ebp)
+ 803:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 806:	a3 70 0b 00 00       	mov    %eax,0xb70
+ 80b:	a1 70 0b 00 00       	mov    0xb70,%eax
+ 810:	a3 68 0b 00 00       	mov    %eax,0xb68
+    base.s.size = 0;
+ 815:	c7 05 6c 0b 00 00 00 	movl   $0x0,0xb6c
+ 81c:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 81f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 822:	8b 00                	mov    (%eax),%eax
+ 824:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 827:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 82a:	8b 40 04             	mov    0x4(%eax),%eax
+ 82d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 830:	72 4d                	jb     87f <malloc+0xa6>
+      if(p->s.size == nunits)
+ 832:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 835:	8b 40 04             	mov    0x4(%eax),%eax
+ 838:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 83b:	75 0c                	jne    849 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 83d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 840:	8b 10                	mov    (%eax),%edx
+ 842:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 845:	89 10                	mov    %edx,(%eax)
+ 847:	eb 26                	jmp    86f <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 849:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84c:	8b 40 04             	mov    0x4(%eax),%eax
+ 84f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 852:	89 c2                	mov    %eax,%edx
+ 854:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 857:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 85a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85d:	8b 40 04             	mov    0x4(%eax),%eax
+ 860:	c1 e0 03             	shl    $0x3,%eax
+ 863:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 866:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 869:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 86c:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 86f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 872:	a3 70 0b 00 00       	mov    %eax,0xb70
+      return (void*)(p + 1);
+ 877:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87a:	83 c0 08             	add    $0x8,%eax
+ 87d:	eb 3b                	jmp    8ba <malloc+0xe1>
+    }
+    if(p == freep)
+ 87f:	a1 70 0b 00 00       	mov    0xb70,%eax
+ 884:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 887:	75 1e                	jne    8a7 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 889:	83 ec 0c             	sub    $0xc,%esp
+ 88c:	ff 75 ec             	push   -0x14(%ebp)
+ 88f:	e8 e5 fe ff ff       	call   779 <morecore>
+ 894:	83 c4 10             	add    $0x10,%esp
+ 897:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 89a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89e:	75 07                	jne    8a7 <malloc+0xce>
+        return 0;
+ 8a0:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8a5:	eb 13                	jmp    8ba <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8aa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b0:	8b 00                	mov    (%eax),%eax
+ 8b2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8b5:	e9 6d ff ff ff       	jmp    827 <malloc+0x4e>
+  }
+}
+ 8ba:	c9                   	leave
+ 8bb:	c3                   	ret
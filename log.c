@@ -1,6 +1,8 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "proc.h"
 #include "spinlock.h"
 #include "fs.h"
 #include "buf.h"
@@ -14,35 +16,69 @@
 // write an uncommitted system call's updates to disk.
 //
 // A system call should call begin_op()/end_op() to mark
-// its start and end. Usually begin_op() just increments
-// the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
+// its start and end, passing begin_op() the most log blocks
+// it can write.  Usually begin_op() just reserves that many
+// and returns.  But if the log lacks room for them, it
 // sleeps until the last outstanding end_op() commits.
+// log_write() uses up the reservation of the calling process;
+// end_op() returns whatever is left.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
-//   header block, containing sector #s for block A, B, C, ...
+//   header blocks, containing sector #s for block A, B, C, ...
 //   block A
 //   block B
 //   block C
 //   ...
 // Log appends are synchronous.
+//
+// The header takes LOGHDRBLOCKS blocks, enough for LOGSIZE
+// sector numbers.  Only the first block holds the count, so
+// writing it is the commit: write_head() writes it last.
+//
+// Blocks changed only through log_writerange(), such as bitmap
+// blocks and i-node blocks, are logged as deltas: the changed
+// byte ranges, packed into delta blocks after the whole blocks.
+// Their header entries have L_DELTA set, and recovery applies
+// the ranges to the blocks' home copies.
 
-// Contents of the header block, used for both the on-disk header block
+// Contents of the header blocks, used for both the on-disk header
 // and to keep track in memory of logged sector #s before commit.
 struct logheader {
   int n;   
-  int sector[LOGSIZE];
+  int nblocks;            // log blocks used, whole and delta
+  uint sector[LOGSIZE];
+};
+
+#define L_DELTA 0x80000000  // in sector[]: logged as a delta
+
+// A range of one block in a delta block.  The bytes follow,
+// padded to a multiple of 4; a zero len ends the delta block.
+struct logdelta {
+  uint sector;
+  ushort off;
+  ushort len;
 };
 
+// log_write() finds a block already in the transaction through
+// a hash table of sector numbers.  Entries are indexes into
+// lh.sector[] plus one; zero ends a chain.
+#define NLOGHASH LOGSIZE
+
 struct log {
   struct spinlock lock;
   int start;
   int size;
   int outstanding; // how many FS sys calls are executing.
+  int reserved;    // log blocks reserved by them and not yet used
   int committing;  // in commit(), please wait.
   int dev;
+  int cap;         // blocks the log has room for
   struct logheader lh;
+  int hash[NLOGHASH];   // heads of the chains
+  int next[LOGSIZE];    // chain link, by lh.sector[] index
+  char whole[LOGSIZE];  // log all of the block, not a delta
+  uchar dirty[LOGSIZE][BSIZE/8];  // bytes changed, for deltas
 };
 struct log log;
 
@@ -52,33 +88,86 @@ static void commit();
 void
 initlog(void)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
   initlock(&log.lock, "log");
   readsb(ROOTDEV, &sb);
   log.start = sb.size - sb.nlog;
   log.size = sb.nlog;
   log.dev = ROOTDEV;
+  if (log.size <= LOGHDRBLOCKS)
+    panic("initlog: log too small");
+  log.cap = log.size - LOGHDRBLOCKS;
+  if (log.cap > LOGSIZE)
+    log.cap = LOGSIZE;
   // ここでloggingのリカバリー処理を行なう(起動時に実施される)
   recover_from_log();
 }
 
+// Apply the ranges in delta block lbuf to their home blocks.
+static void
+install_deltas(struct buf *lbuf)
+{
+  struct logdelta d;
+  struct buf *dbuf;
+  int off;
+
+  for (off = 0; off + sizeof(d) <= BSIZE; off += sizeof(d) + (d.len+3)/4*4) {
+    memmove(&d, lbuf->data + off, sizeof(d));
+    if (d.len == 0)
+      break;
+    if (d.off + d.len > BSIZE || off + sizeof(d) + d.len > BSIZE)
+      panic("install_deltas: bad delta");
+    dbuf = bread(log.dev, d.sector);
+    memmove(dbuf->data + d.off, lbuf->data + off + sizeof(d), d.len);
+    bwrite(dbuf);
+    brelse(dbuf);
+  }
+}
+
 // Copy committed blocks from log to their home location
 static void 
 install_trans(void)
 {
-  int tail;
+  int tail, blk;
 
+  // Whole blocks come first, in header order, then delta blocks.
+  blk = 0;
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+    if (log.lh.sector[tail] & L_DELTA)
+      continue;
+    struct buf *lbuf = bread(log.dev, log.start+LOGHDRBLOCKS+blk++); // read log block
     struct buf *dbuf = bread(log.dev, log.lh.sector[tail]); // read dst
     memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
     bwrite(dbuf);  // write dst to disk
     brelse(lbuf); 
     brelse(dbuf);
   }
+  for (; blk < log.lh.nblocks; blk++) {
+    struct buf *lbuf = bread(log.dev, log.start+LOGHDRBLOCKS+blk);
+    install_deltas(lbuf);
+    brelse(lbuf);
+  }
+}
+
+// After commit, write the logged blocks home from the cache,
+// where they are still pinned.
+static void
+install_cache(void)
+{
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+    struct buf *dbuf = bread(log.dev, log.lh.sector[tail] & ~L_DELTA);
+    bwrite(dbuf);
+    brelse(dbuf);
+  }
+}
+
+// Header blocks needed for n sector numbers.
+static int
+headblocks(int n)
+{
+  return (sizeof(int)*(1+n) + BSIZE-1) / BSIZE;
 }
 
 // この関数はリカバリー時にしか呼ばれない
@@ -87,37 +176,49 @@ static void
 read_head(void)
 {
   // log.startはlogの開始位置を表す。
-  struct buf *buf = bread(log.dev, log.start);
+  struct buf *buf;
+  char *p;
+  int b, n;
 
-  // logのブロックはlogheader構造体で
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-
-  // グローバル変数に書き込みを行う
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.sector[i] = lh->sector[i];
+  // logのブロックはlogheader構造体で、1ブロック目に個数がある
+  p = (char*)&log.lh;
+  for (b = 0; b == 0 || b < headblocks(log.lh.n); b++) {
+    buf = bread(log.dev, log.start+b);
+    n = sizeof(log.lh) - b*BSIZE;
+    if (n > BSIZE)
+      n = BSIZE;
+    // グローバル変数に書き込みを行う
+    memmove(p + b*BSIZE, buf->data, n);
+    brelse(buf);
+    if (log.lh.n < 0 || log.lh.n > log.cap || log.lh.nblocks > log.lh.n)
+      panic("read_head: bad log header");
   }
-  brelse(buf);
 }
 
 // Write in-memory log header to disk.
 // This is the true point at which the
-// current transaction commits.
+// current transaction commits: the first block, with the
+// count, goes last so that the rest of the sector numbers
+// are on disk before it.
 // メモリ中に存在するlogheader構造体をディスクに書き出す。
 // logheader構造体はファイルシステム中のboot, superの次のlogブロック(log.start)の位置に存在する
 static void
 write_head(void)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->sector[i] = log.lh.sector[i];
+  struct buf *buf;
+  char *p;
+  int b, n;
+
+  p = (char*)&log.lh;
+  for (b = headblocks(log.lh.n) - 1; b >= 0; b--) {
+    buf = bread(log.dev, log.start+b);
+    n = sizeof(log.lh) - b*BSIZE;
+    if (n > BSIZE)
+      n = BSIZE;
+    memmove(buf->data, p + b*BSIZE, n);
+    bwrite(buf);
+    brelse(buf);
   }
-  bwrite(buf);
-  brelse(buf);
 }
 
 static void
@@ -126,22 +227,28 @@ recover_from_log(void)
   read_head();      
   install_trans(); // if committed, copy from log to disk
   log.lh.n = 0;
+  log.lh.nblocks = 0;
   write_head(); // clear the log
 }
 
-// called at the start of each FS system call.
+// called at the start of each FS system call, which will
+// write at most nblocks distinct blocks.
 void
-begin_op(void)
+begin_op(int nblocks)
 {
+  if(nblocks > log.cap)
+    panic("begin_op: too many blocks");
   acquire(&log.lock);
   while(1){
     if(log.committing){        // 書き込み中なのでsleepする 
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){  // ログスペース利用超過の場合にもsleep
+    } else if(log.lh.n + log.reserved + nblocks > log.cap){  // ログスペース利用超過の場合にもsleep
       // this op might exhaust log space; wait for commit.
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;   // 実行されているファイルシステムのシステムコール数を保存する
+      log.reserved += nblocks;
+      proc->logres = nblocks;
       release(&log.lock);
       break;
     }
@@ -157,13 +264,16 @@ end_op(void)
 
   acquire(&log.lock);
   log.outstanding -= 1;
+  log.reserved -= proc->logres;
+  proc->logres = 0;
   if(log.committing)            // 終了操作で書き込み中となっているのはおかしいのでpanic扱いとする。
     panic("log.committing");
   if(log.outstanding == 0){     // 実行されているファイルシステムのシステムコールが存在しないことを確認した上でdo_commitフラグを立てる。 
     do_commit = 1;
     log.committing = 1;
   } else {
-    // begin_op() may be waiting for log space.
+    // begin_op() may be waiting for log space, some of which
+    // this op reserved but did not use.
     wakeup(&log);
   }
   release(&log.lock);
@@ -179,20 +289,94 @@ end_op(void)
   }
 }
 
-// Copy modified blocks from cache to log.
+// Find the changed ranges of entry i, joining ranges less than
+// a delta header apart.  Stores up to BSIZE/8 of them in off[]
+// and len[]; returns how many, or -1 if the deltas would not
+// save at least half a block.
+static int
+deltas(int i, ushort *off, ushort *len)
+{
+  uchar *dirty;
+  int b, n, size;
+
+  dirty = log.dirty[i];
+  n = size = 0;
+  for (b = 0; b < BSIZE; b++) {
+    if (!(dirty[b/8] & (1 << (b%8))))
+      continue;
+    if (n > 0 && b - (off[n-1] + len[n-1]) < sizeof(struct logdelta)) {
+      len[n-1] = b + 1 - off[n-1];
+    } else {
+      off[n] = b;
+      len[n++] = 1;
+    }
+  }
+  for (b = 0; b < n; b++)
+    size += sizeof(struct logdelta) + (len[b]+3)/4*4;
+  if (size > BSIZE/2)
+    return -1;
+  return n;
+}
+
+// Copy modified blocks from cache to log: whole blocks one per
+// log block, then the deltas packed into as few as will hold them.
 static void 
 write_log(void)
 {
-  int tail;
+  static ushort off[BSIZE/8], len[BSIZE/8];
+  struct logdelta d;
+  struct buf *to, *from;
+  int tail, blk, pos, n, j;
 
+  blk = 0;
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1);      // log block  log.startはログヘッダなので、log.start+1は0番目のログブロックに対応する
-    struct buf *from = bread(log.dev, log.lh.sector[tail]); // cache block
+    if (!log.whole[tail] && deltas(tail, off, len) >= 0) {
+      log.lh.sector[tail] |= L_DELTA;
+      continue;
+    }
+    to = bread(log.dev, log.start+LOGHDRBLOCKS+blk++); // log block  log.startからLOGHDRBLOCKS個はログヘッダ
+    from = bread(log.dev, log.lh.sector[tail]); // cache block
     memmove(to->data, from->data, BSIZE);
     bwrite(to);  // write the log
     brelse(from); 
     brelse(to);
   }
+
+  to = 0;
+  pos = 0;
+  for (tail = 0; tail < log.lh.n; tail++) {
+    if (!(log.lh.sector[tail] & L_DELTA))
+      continue;
+    d.sector = log.lh.sector[tail] & ~L_DELTA;
+    from = bread(log.dev, d.sector);
+    n = deltas(tail, off, len);
+    for (j = 0; j < n; j++) {
+      d.off = off[j];
+      d.len = len[j];
+      if (to && pos + sizeof(d) + (d.len+3)/4*4 > BSIZE) {
+        if (pos + sizeof(d) <= BSIZE)
+          memset(to->data + pos, 0, sizeof(d));
+        bwrite(to);
+        brelse(to);
+        to = 0;
+      }
+      if (to == 0) {
+        to = bread(log.dev, log.start+LOGHDRBLOCKS+blk++);
+        pos = 0;
+      }
+      memmove(to->data + pos, &d, sizeof(d));
+      memmove(to->data + pos + sizeof(d), from->data + d.off, d.len);
+      pos += sizeof(d) + (d.len+3)/4*4;
+    }
+    brelse(from);
+  }
+  if (to) {
+    if (pos + sizeof(d) <= BSIZE)
+      memset(to->data + pos, 0, sizeof(d));
+    bwrite(to);
+    brelse(to);
+  }
+  log.lh.nblocks = blk;
 }
 
 
@@ -202,6 +386,8 @@ static void
 commit()
 {
   if (log.lh.n > 0) {
+    iflush();        // Copy updated inodes into their logged blocks
+
     // １度目のデータ書き込み(ジャーナルへ書き込み)
     write_log();     // Write modified blocks from cache to log
 
@@ -209,10 +395,12 @@ commit()
     write_head();    // Write header to disk -- the real commit
 
     // ジャーナルにあるデータを実際にディスクに書き込み(2度目の書き込み)
-    install_trans(); // Now install writes to home locations
+    install_cache(); // Now install writes to home locations
 
     // 書き込みブロック数をリセットする。これは次のwrite_head()を呼び出した際に必要
     log.lh.n = 0; 
+    log.lh.nblocks = 0;
+    memset(log.hash, 0, sizeof(log.hash));
 
     write_head();    // Erase the transaction from the log
   }
@@ -227,28 +415,68 @@ commit()
 //   modify bp->data[]
 //   log_write(bp)
 //   brelse(bp)
-void
-log_write(struct buf *b)
+//
+// log_writerange(b, off, n) says that only bytes [off, off+n)
+// of b->data changed, letting commit() log just those bytes.
+static int
+logblock(struct buf *b)
 {
-  int i;
+  int i, h;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
-    panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
 
-  // バッファ中のセクター番号とログに記録セクター番号が一致していたら、その時点でbreakする
+  // バッファ中のセクター番号がすでにログに記録されていれば、その位置をiとする
   // 一致しなければ、i == log.lh.nとなる (***)
-  for (i = 0; i < log.lh.n; i++) {
+  h = b->sector % NLOGHASH;
+  for (i = log.hash[h] - 1; i >= 0; i = log.next[i] - 1) {
     if (log.lh.sector[i] == b->sector)   // log absorbtion
       break;
   }
-  log.lh.sector[i] = b->sector;
 
   // (***)で一致しない状態なので、書き込みするバッファが増えるのでインクリメントする。
   // このlog.lh.n++は書き込まれるとcommit()で0に変更される
-  if (i == log.lh.n)
-    log.lh.n++;
+  // A new block comes out of this op's reservation.  An op that
+  // overruns its reservation eats into the log's slack and then
+  // into other ops' reservations, which can end in the panic
+  // below.
+  if (i < 0){
+    if (log.lh.n >= log.cap)
+      panic("too big a transaction");
+    i = log.lh.n++;
+    log.lh.sector[i] = b->sector;
+    log.next[i] = log.hash[h];
+    log.hash[h] = i + 1;
+    log.whole[i] = 0;
+    memset(log.dirty[i], 0, sizeof(log.dirty[i]));
+    if (proc->logres > 0){
+      proc->logres--;
+      log.reserved--;
+    }
+  }
   b->flags |= B_DIRTY; // prevent eviction
+  return i;
+}
+
+void
+log_write(struct buf *b)
+{
+  acquire(&log.lock);
+  log.whole[logblock(b)] = 1;
+  release(&log.lock);
+}
+
+void
+log_writerange(struct buf *b, uint off, uint n)
+{
+  uchar *dirty;
+
+  if (off + n > BSIZE)
+    panic("log_writerange");
+  acquire(&log.lock);
+  dirty = log.dirty[logblock(b)];
+  for (; n > 0; off++, n--)
+    dirty[off/8] |= 1 << (off%8);
+  release(&log.lock);
 }
 
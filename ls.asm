@@ -0,0 +1,1529 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+  static char buf[DIRSIZ+1];
+  char *p;
+  
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	ff 75 08             	push   0x8(%ebp)
+   d:	e8 7b 03 00 00       	call   38d <strlen>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	8b 55 08             	mov    0x8(%ebp),%edx
+  18:	01 d0                	add    %edx,%eax
+  1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1d:	eb 04                	jmp    23 <fmtname+0x23>
+  1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  26:	3b 45 08             	cmp    0x8(%ebp),%eax
+  29:	72 0a                	jb     35 <fmtname+0x35>
+  2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  2e:	0f b6 00             	movzbl (%eax),%eax
+  31:	3c 2f                	cmp    $0x2f,%al
+  33:	75 ea                	jne    1f <fmtname+0x1f>
+    ;
+  p++;
+  35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 75 f4             	push   -0xc(%ebp)
+  3f:	e8 49 03 00 00       	call   38d <strlen>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	83 f8 0d             	cmp    $0xd,%eax
+  4a:	76 05                	jbe    51 <fmtname+0x51>
+    return p;
+  4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+  memmove(buf, p, strlen(p));
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 75 f4             	push   -0xc(%ebp)
+  57:	e8 31 03 00 00       	call   38d <strlen>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	50                   	push   %eax
+  63:	ff 75 f4             	push   -0xc(%ebp)
+  66:	68 68 0e 00 00       	push   $0xe68
+  6b:	e8 9a 04 00 00       	call   50a <memmove>
+  70:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  73:	83 ec 0c             	sub    $0xc,%esp
+  76:	ff 75 f4             	push   -0xc(%ebp)
+  79:	e8 0f 03 00 00       	call   38d <strlen>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	ba 0e 00 00 00       	mov    $0xe,%edx
+  86:	89 d3                	mov    %edx,%ebx
+  88:	29 c3                	sub    %eax,%ebx
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 f4             	push   -0xc(%ebp)
+  90:	e8 f8 02 00 00       	call   38d <strlen>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	05 68 0e 00 00       	add    $0xe68,%eax
+  9d:	83 ec 04             	sub    $0x4,%esp
+  a0:	53                   	push   %ebx
+  a1:	6a 20                	push   $0x20
+  a3:	50                   	push   %eax
+  a4:	e8 0b 03 00 00       	call   3b4 <memset>
+  a9:	83 c4 10             	add    $0x10,%esp
+  return buf;
+  ac:	b8 68 0e 00 00       	mov    $0xe68,%eax
+}
+  b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b4:	c9                   	leave
+  b5:	c3                   	ret
+
+000000b6 <ls>:
+// and each one is stat()ed relative to the open directory with
+// fstatat(), so a listing costs about one system call per entry
+// rather than a read, open, fstat and close.
+void
+ls(char *path)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	57                   	push   %edi
+  ba:	56                   	push   %esi
+  bb:	53                   	push   %ebx
+  bc:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  struct dirent de[32];
+  char name[DIRSIZ+1];
+  int fd, i, n;
+  struct stat st;
+  
+  if((fd = open(path, 0)) < 0){
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	6a 00                	push   $0x0
+  c7:	ff 75 08             	push   0x8(%ebp)
+  ca:	e8 fe 04 00 00       	call   5cd <open>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  d5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  d9:	79 1a                	jns    f5 <ls+0x3f>
+    printf(2, "ls: cannot open %s\n", path);
+  db:	83 ec 04             	sub    $0x4,%esp
+  de:	ff 75 08             	push   0x8(%ebp)
+  e1:	68 40 0b 00 00       	push   $0xb40
+  e6:	6a 02                	push   $0x2
+  e8:	e8 9c 06 00 00       	call   789 <printf>
+  ed:	83 c4 10             	add    $0x10,%esp
+    return;
+  f0:	e9 97 01 00 00       	jmp    28c <ls+0x1d6>
+  }
+  
+  if(fstat(fd, &st) < 0){
+  f5:	83 ec 08             	sub    $0x8,%esp
+  f8:	8d 85 b8 fd ff ff    	lea    -0x248(%ebp),%eax
+  fe:	50                   	push   %eax
+  ff:	ff 75 e0             	push   -0x20(%ebp)
+ 102:	e8 de 04 00 00       	call   5e5 <fstat>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	79 28                	jns    136 <ls+0x80>
+    printf(2, "ls: cannot stat %s\n", path);
+ 10e:	83 ec 04             	sub    $0x4,%esp
+ 111:	ff 75 08             	push   0x8(%ebp)
+ 114:	68 54 0b 00 00       	push   $0xb54
+ 119:	6a 02                	push   $0x2
+ 11b:	e8 69 06 00 00       	call   789 <printf>
+ 120:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 123:	83 ec 0c             	sub    $0xc,%esp
+ 126:	ff 75 e0             	push   -0x20(%ebp)
+ 129:	e8 87 04 00 00       	call   5b5 <close>
+ 12e:	83 c4 10             	add    $0x10,%esp
+    return;
+ 131:	e9 56 01 00 00       	jmp    28c <ls+0x1d6>
+  }
+  
+  switch(st.type){
+ 136:	0f b7 85 b8 fd ff ff 	movzwl -0x248(%ebp),%eax
+ 13d:	98                   	cwtl
+ 13e:	83 f8 01             	cmp    $0x1,%eax
+ 141:	0f 84 0f 01 00 00    	je     256 <ls+0x1a0>
+ 147:	83 f8 02             	cmp    $0x2,%eax
+ 14a:	0f 85 2e 01 00 00    	jne    27e <ls+0x1c8>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 150:	8b bd c8 fd ff ff    	mov    -0x238(%ebp),%edi
+ 156:	8b b5 c0 fd ff ff    	mov    -0x240(%ebp),%esi
+ 15c:	0f b7 85 b8 fd ff ff 	movzwl -0x248(%ebp),%eax
+ 163:	0f bf d8             	movswl %ax,%ebx
+ 166:	83 ec 0c             	sub    $0xc,%esp
+ 169:	ff 75 08             	push   0x8(%ebp)
+ 16c:	e8 8f fe ff ff       	call   0 <fmtname>
+ 171:	83 c4 10             	add    $0x10,%esp
+ 174:	83 ec 08             	sub    $0x8,%esp
+ 177:	57                   	push   %edi
+ 178:	56                   	push   %esi
+ 179:	53                   	push   %ebx
+ 17a:	50                   	push   %eax
+ 17b:	68 68 0b 00 00       	push   $0xb68
+ 180:	6a 01                	push   $0x1
+ 182:	e8 02 06 00 00       	call   789 <printf>
+ 187:	83 c4 20             	add    $0x20,%esp
+    break;
+ 18a:	e9 ef 00 00 00       	jmp    27e <ls+0x1c8>
+  
+  case T_DIR:
+    while((n = getdents(fd, de, sizeof(de))) > 0){
+      for(i = 0; i < n/sizeof(de[0]); i++){
+ 18f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 196:	e9 aa 00 00 00       	jmp    245 <ls+0x18f>
+        memmove(name, de[i].name, DIRSIZ);
+ 19b:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+ 1a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1a4:	c1 e2 04             	shl    $0x4,%edx
+ 1a7:	01 d0                	add    %edx,%eax
+ 1a9:	83 c0 02             	add    $0x2,%eax
+ 1ac:	83 ec 04             	sub    $0x4,%esp
+ 1af:	6a 0e                	push   $0xe
+ 1b1:	50                   	push   %eax
+ 1b2:	8d 85 cd fd ff ff    	lea    -0x233(%ebp),%eax
+ 1b8:	50                   	push   %eax
+ 1b9:	e8 4c 03 00 00       	call   50a <memmove>
+ 1be:	83 c4 10             	add    $0x10,%esp
+        name[DIRSIZ] = 0;
+ 1c1:	c6 85 db fd ff ff 00 	movb   $0x0,-0x225(%ebp)
+        if(fstatat(fd, name, &st) < 0){
+ 1c8:	83 ec 04             	sub    $0x4,%esp
+ 1cb:	8d 85 b8 fd ff ff    	lea    -0x248(%ebp),%eax
+ 1d1:	50                   	push   %eax
+ 1d2:	8d 85 cd fd ff ff    	lea    -0x233(%ebp),%eax
+ 1d8:	50                   	push   %eax
+ 1d9:	ff 75 e0             	push   -0x20(%ebp)
+ 1dc:	e8 7c 04 00 00       	call   65d <fstatat>
+ 1e1:	83 c4 10             	add    $0x10,%esp
+ 1e4:	85 c0                	test   %eax,%eax
+ 1e6:	79 1b                	jns    203 <ls+0x14d>
+          printf(1, "ls: cannot stat %s/%s\n", path, name);
+ 1e8:	8d 85 cd fd ff ff    	lea    -0x233(%ebp),%eax
+ 1ee:	50                   	push   %eax
+ 1ef:	ff 75 08             	push   0x8(%ebp)
+ 1f2:	68 75 0b 00 00       	push   $0xb75
+ 1f7:	6a 01                	push   $0x1
+ 1f9:	e8 8b 05 00 00       	call   789 <printf>
+ 1fe:	83 c4 10             	add    $0x10,%esp
+          continue;
+ 201:	eb 3e                	jmp    241 <ls+0x18b>
+        }
+        printf(1, "%s %d %d %d\n", fmtname(name), st.type, st.ino, st.size);
+ 203:	8b bd c8 fd ff ff    	mov    -0x238(%ebp),%edi
+ 209:	8b b5 c0 fd ff ff    	mov    -0x240(%ebp),%esi
+ 20f:	0f b7 85 b8 fd ff ff 	movzwl -0x248(%ebp),%eax
+ 216:	0f bf d8             	movswl %ax,%ebx
+ 219:	83 ec 0c             	sub    $0xc,%esp
+ 21c:	8d 85 cd fd ff ff    	lea    -0x233(%ebp),%eax
+ 222:	50                   	push   %eax
+ 223:	e8 d8 fd ff ff       	call   0 <fmtname>
+ 228:	83 c4 10             	add    $0x10,%esp
+ 22b:	83 ec 08             	sub    $0x8,%esp
+ 22e:	57                   	push   %edi
+ 22f:	56                   	push   %esi
+ 230:	53                   	push   %ebx
+ 231:	50                   	push   %eax
+ 232:	68 68 0b 00 00       	push   $0xb68
+ 237:	6a 01                	push   $0x1
+ 239:	e8 4b 05 00 00       	call   789 <printf>
+ 23e:	83 c4 20             	add    $0x20,%esp
+      for(i = 0; i < n/sizeof(de[0]); i++){
+ 241:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 245:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 248:	c1 e8 04             	shr    $0x4,%eax
+ 24b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 24e:	39 c2                	cmp    %eax,%edx
+ 250:	0f 82 45 ff ff ff    	jb     19b <ls+0xe5>
+    while((n = getdents(fd, de, sizeof(de))) > 0){
+ 256:	83 ec 04             	sub    $0x4,%esp
+ 259:	68 00 02 00 00       	push   $0x200
+ 25e:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+ 264:	50                   	push   %eax
+ 265:	ff 75 e0             	push   -0x20(%ebp)
+ 268:	e8 e8 03 00 00       	call   655 <getdents>
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 273:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+ 277:	0f 8f 12 ff ff ff    	jg     18f <ls+0xd9>
+      }
+    }
+    break;
+ 27d:	90                   	nop
+  }
+  close(fd);
+ 27e:	83 ec 0c             	sub    $0xc,%esp
+ 281:	ff 75 e0             	push   -0x20(%ebp)
+ 284:	e8 2c 03 00 00       	call   5b5 <close>
+ 289:	83 c4 10             	add    $0x10,%esp
+}
+ 28c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28f:	5b                   	pop    %ebx
+ 290:	5e                   	pop    %esi
+ 291:	5f                   	pop    %edi
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+
+00000294 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 294:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 298:	83 e4 f0             	and    $0xfffffff0,%esp
+ 29b:	ff 71 fc             	push   -0x4(%ecx)
+ 29e:	55                   	push   %ebp
+ 29f:	89 e5                	mov    %esp,%ebp
+ 2a1:	53                   	push   %ebx
+ 2a2:	51                   	push   %ecx
+ 2a3:	83 ec 10             	sub    $0x10,%esp
+ 2a6:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){          // 引数がなければカレントディレクトリをlsして終了
+ 2a8:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 2ab:	7f 15                	jg     2c2 <main+0x2e>
+    ls(".");   
+ 2ad:	83 ec 0c             	sub    $0xc,%esp
+ 2b0:	68 8c 0b 00 00       	push   $0xb8c
+ 2b5:	e8 fc fd ff ff       	call   b6 <ls>
+ 2ba:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2bd:	e8 cb 02 00 00       	call   58d <exit>
+  }
+  for(i=1; i<argc; i++)  // 引数があればその個数分だけlsを実行して終了
+ 2c2:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 2c9:	eb 21                	jmp    2ec <main+0x58>
+    ls(argv[i]);
+ 2cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ce:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 2d5:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2d8:	01 d0                	add    %edx,%eax
+ 2da:	8b 00                	mov    (%eax),%eax
+ 2dc:	83 ec 0c             	sub    $0xc,%esp
+ 2df:	50                   	push   %eax
+ 2e0:	e8 d1 fd ff ff       	call   b6 <ls>
+ 2e5:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)  // 引数があればその個数分だけlsを実行して終了
+ 2e8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ef:	3b 03                	cmp    (%ebx),%eax
+ 2f1:	7c d8                	jl     2cb <main+0x37>
+  exit();
+ 2f3:	e8 95 02 00 00       	call   58d <exit>
+
+000002f8 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 2f8:	55                   	push   %ebp
+ 2f9:	89 e5                	mov    %esp,%ebp
+ 2fb:	57                   	push   %edi
+ 2fc:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 2fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 300:	8b 55 10             	mov    0x10(%ebp),%edx
+ 303:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 306:	89 cb                	mov    %ecx,%ebx
+ 308:	89 df                	mov    %ebx,%edi
+ 30a:	89 d1                	mov    %edx,%ecx
+ 30c:	fc                   	cld
+ 30d:	f3 aa                	rep stos %al,%es:(%edi)
+ 30f:	89 ca                	mov    %ecx,%edx
+ 311:	89 fb                	mov    %edi,%ebx
+ 313:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 316:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 319:	90                   	nop
+ 31a:	5b                   	pop    %ebx
+ 31b:	5f                   	pop    %edi
+ 31c:	5d                   	pop    %ebp
+ 31d:	c3                   	ret
+
+0000031e <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 31e:	55                   	push   %ebp
+ 31f:	89 e5                	mov    %esp,%ebp
+ 321:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 324:	8b 45 08             	mov    0x8(%ebp),%eax
+ 327:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 32a:	90                   	nop
+ 32b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 32e:	8d 42 01             	lea    0x1(%edx),%eax
+ 331:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 334:	8b 45 08             	mov    0x8(%ebp),%eax
+ 337:	8d 48 01             	lea    0x1(%eax),%ecx
+ 33a:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 33d:	0f b6 12             	movzbl (%edx),%edx
+ 340:	88 10                	mov    %dl,(%eax)
+ 342:	0f b6 00             	movzbl (%eax),%eax
+ 345:	84 c0                	test   %al,%al
+ 347:	75 e2                	jne    32b <strcpy+0xd>
+    ;
+  return os;
+ 349:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 34c:	c9                   	leave
+ 34d:	c3                   	ret
+
+0000034e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 34e:	55                   	push   %ebp
+ 34f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 351:	eb 08                	jmp    35b <strcmp+0xd>
+    p++, q++;
+ 353:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 357:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 35b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35e:	0f b6 00             	movzbl (%eax),%eax
+ 361:	84 c0                	test   %al,%al
+ 363:	74 10                	je     375 <strcmp+0x27>
+ 365:	8b 45 08             	mov    0x8(%ebp),%eax
+ 368:	0f b6 10             	movzbl (%eax),%edx
+ 36b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36e:	0f b6 00             	movzbl (%eax),%eax
+ 371:	38 c2                	cmp    %al,%dl
+ 373:	74 de                	je     353 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 375:	8b 45 08             	mov    0x8(%ebp),%eax
+ 378:	0f b6 00             	movzbl (%eax),%eax
+ 37b:	0f b6 d0             	movzbl %al,%edx
+ 37e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 381:	0f b6 00             	movzbl (%eax),%eax
+ 384:	0f b6 c0             	movzbl %al,%eax
+ 387:	29 c2                	sub    %eax,%edx
+ 389:	89 d0                	mov    %edx,%eax
+}
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+
+0000038d <strlen>:
+
+uint
+strlen(char *s)
+{
+ 38d:	55                   	push   %ebp
+ 38e:	89 e5                	mov    %esp,%ebp
+ 390:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 393:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 39a:	eb 04                	jmp    3a0 <strlen+0x13>
+ 39c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3a0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	01 d0                	add    %edx,%eax
+ 3a8:	0f b6 00             	movzbl (%eax),%eax
+ 3ab:	84 c0                	test   %al,%al
+ 3ad:	75 ed                	jne    39c <strlen+0xf>
+    ;
+  return n;
+ 3af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3b2:	c9                   	leave
+ 3b3:	c3                   	ret
+
+000003b4 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3b4:	55                   	push   %ebp
+ 3b5:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3b7:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3ba:	50                   	push   %eax
+ 3bb:	ff 75 0c             	push   0xc(%ebp)
+ 3be:	ff 75 08             	push   0x8(%ebp)
+ 3c1:	e8 32 ff ff ff       	call   2f8 <stosb>
+ 3c6:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3c9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3cc:	c9                   	leave
+ 3cd:	c3                   	ret
+
+000003ce <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3ce:	55                   	push   %ebp
+ 3cf:	89 e5                	mov    %esp,%ebp
+ 3d1:	83 ec 04             	sub    $0x4,%esp
+ 3d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d7:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3da:	eb 14                	jmp    3f0 <strchr+0x22>
+    if(*s == c)
+ 3dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3df:	0f b6 00             	movzbl (%eax),%eax
+ 3e2:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3e5:	75 05                	jne    3ec <strchr+0x1e>
+      return (char*)s;
+ 3e7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ea:	eb 13                	jmp    3ff <strchr+0x31>
+  for(; *s; s++)
+ 3ec:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f3:	0f b6 00             	movzbl (%eax),%eax
+ 3f6:	84 c0                	test   %al,%al
+ 3f8:	75 e2                	jne    3dc <strchr+0xe>
+  return 0;
+ 3fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3ff:	c9                   	leave
+ 400:	c3                   	ret
+
+00000401 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 401:	55                   	push   %ebp
+ 402:	89 e5                	mov    %esp,%ebp
+ 404:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 407:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 40e:	eb 42                	jmp    452 <gets+0x51>
+    cc = read(0, &c, 1);
+ 410:	83 ec 04             	sub    $0x4,%esp
+ 413:	6a 01                	push   $0x1
+ 415:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 418:	50                   	push   %eax
+ 419:	6a 00                	push   $0x0
+ 41b:	e8 85 01 00 00       	call   5a5 <read>
+ 420:	83 c4 10             	add    $0x10,%esp
+ 423:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 426:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 42a:	7e 33                	jle    45f <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 42c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 42f:	8d 50 01             	lea    0x1(%eax),%edx
+ 432:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 435:	89 c2                	mov    %eax,%edx
+ 437:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43a:	01 c2                	add    %eax,%edx
+ 43c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 440:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 442:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 446:	3c 0a                	cmp    $0xa,%al
+ 448:	74 16                	je     460 <gets+0x5f>
+ 44a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 44e:	3c 0d                	cmp    $0xd,%al
+ 450:	74 0e                	je     460 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 452:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 455:	83 c0 01             	add    $0x1,%eax
+ 458:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 45b:	7f b3                	jg     410 <gets+0xf>
+ 45d:	eb 01                	jmp    460 <gets+0x5f>
+      break;
+ 45f:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 460:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	01 d0                	add    %edx,%eax
+ 468:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 46b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 46e:	c9                   	leave
+ 46f:	c3                   	ret
+
+00000470 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 476:	83 ec 08             	sub    $0x8,%esp
+ 479:	6a 00                	push   $0x0
+ 47b:	ff 75 08             	push   0x8(%ebp)
+ 47e:	e8 4a 01 00 00       	call   5cd <open>
+ 483:	83 c4 10             	add    $0x10,%esp
+ 486:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 489:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 48d:	79 07                	jns    496 <stat+0x26>
+    return -1;
+ 48f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 494:	eb 25                	jmp    4bb <stat+0x4b>
+  r = fstat(fd, st);
+ 496:	83 ec 08             	sub    $0x8,%esp
+ 499:	ff 75 0c             	push   0xc(%ebp)
+ 49c:	ff 75 f4             	push   -0xc(%ebp)
+ 49f:	e8 41 01 00 00       	call   5e5 <fstat>
+ 4a4:	83 c4 10             	add    $0x10,%esp
+ 4a7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4aa:	83 ec 0c             	sub    $0xc,%esp
+ 4ad:	ff 75 f4             	push   -0xc(%ebp)
+ 4b0:	e8 00 01 00 00       	call   5b5 <close>
+ 4b5:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4b8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4bb:	c9                   	leave
+ 4bc:	c3                   	ret
+
+000004bd <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4bd:	55                   	push   %ebp
+ 4be:	89 e5                	mov    %esp,%ebp
+ 4c0:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 4c3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4ca:	eb 25                	jmp    4f1 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4cc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4cf:	89 d0                	mov    %edx,%eax
+ 4d1:	c1 e0 02             	shl    $0x2,%eax
+ 4d4:	01 d0                	add    %edx,%eax
+ 4d6:	01 c0                	add    %eax,%eax
+ 4d8:	89 c1                	mov    %eax,%ecx
+ 4da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4dd:	8d 50 01             	lea    0x1(%eax),%edx
+ 4e0:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4e3:	0f b6 00             	movzbl (%eax),%eax
+ 4e6:	0f be c0             	movsbl %al,%eax
+ 4e9:	01 c8                	add    %ecx,%eax
+ 4eb:	83 e8 30             	sub    $0x30,%eax
+ 4ee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f4:	0f b6 00             	movzbl (%eax),%eax
+ 4f7:	3c 2f                	cmp    $0x2f,%al
+ 4f9:	7e 0a                	jle    505 <atoi+0x48>
+ 4fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fe:	0f b6 00             	movzbl (%eax),%eax
+ 501:	3c 39                	cmp    $0x39,%al
+ 503:	7e c7                	jle    4cc <atoi+0xf>
+  return n;
+ 505:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 508:	c9                   	leave
+ 509:	c3                   	ret
+
+0000050a <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 50a:	55                   	push   %ebp
+ 50b:	89 e5                	mov    %esp,%ebp
+ 50d:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 510:	8b 45 08             	mov    0x8(%ebp),%eax
+ 513:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 516:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 519:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 51c:	eb 17                	jmp    535 <memmove+0x2b>
+    *dst++ = *src++;
+ 51e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 521:	8d 42 01             	lea    0x1(%edx),%eax
+ 524:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 527:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 52a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 52d:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 530:	0f b6 12             	movzbl (%edx),%edx
+ 533:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 535:	8b 45 10             	mov    0x10(%ebp),%eax
+ 538:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 53b:	89 55 10             	mov    %edx,0x10(%ebp)
+ 53e:	85 c0                	test   %eax,%eax
+ 540:	7f dc                	jg     51e <memmove+0x14>
+  return vdst;
+ 542:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 545:	c9                   	leave
+ 546:	c3                   	ret
+
+00000547 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 547:	55                   	push   %ebp
+ 548:	89 e5                	mov    %esp,%ebp
+ 54a:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 54d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 554:	eb 04                	jmp    55a <ncpus+0x13>
+ 556:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 55a:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 55e:	7f 16                	jg     576 <ncpus+0x2f>
+ 560:	83 ec 08             	sub    $0x8,%esp
+ 563:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 566:	50                   	push   %eax
+ 567:	ff 75 f4             	push   -0xc(%ebp)
+ 56a:	e8 d6 00 00 00       	call   645 <intrstat>
+ 56f:	83 c4 10             	add    $0x10,%esp
+ 572:	85 c0                	test   %eax,%eax
+ 574:	74 e0                	je     556 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 576:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 579:	ba 01 00 00 00       	mov    $0x1,%edx
+ 57e:	85 c0                	test   %eax,%eax
+ 580:	0f 4e c2             	cmovle %edx,%eax
+}
+ 583:	c9                   	leave
+ 584:	c3                   	ret
+
+00000585 <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 585:	b8 01 00 00 00       	mov    $0x1,%eax
+ 58a:	cd 40                	int    $0x40
+ 58c:	c3                   	ret
+
+0000058d <exit>:
+SYSCALL(exit)
+ 58d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 592:	cd 40                	int    $0x40
+ 594:	c3                   	ret
+
+00000595 <wait>:
+SYSCALL(wait)
+ 595:	b8 03 00 00 00       	mov    $0x3,%eax
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <pipe>:
+SYSCALL(pipe)
+ 59d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5a2:	cd 40                	int    $0x40
+ 5a4:	c3                   	ret
+
+000005a5 <read>:
+SYSCALL(read)
+ 5a5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <write>:
+SYSCALL(write)
+ 5ad:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <close>:
+SYSCALL(close)
+ 5b5:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5ba:	cd 40                	int    $0x40
+ 5bc:	c3                   	ret
+
+000005bd <kill>:
+SYSCALL(kill)
+ 5bd:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	c3                   	ret
+
+000005c5 <exec>:
+SYSCALL(exec)
+ 5c5:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <open>:
+SYSCALL(open)
+ 5cd:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <mknod>:
+SYSCALL(mknod)
+ 5d5:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <unlink>:
+SYSCALL(unlink)
+ 5dd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <fstat>:
+SYSCALL(fstat)
+ 5e5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <link>:
+SYSCALL(link)
+ 5ed:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <mkdir>:
+SYSCALL(mkdir)
+ 5f5:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <chdir>:
+SYSCALL(chdir)
+ 5fd:	b8 09 00 00 00       	mov    $0x9,%eax
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <dup>:
+SYSCALL(dup)
+ 605:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <getpid>:
+SYSCALL(getpid)
+ 60d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <sbrk>:
+SYSCALL(sbrk)
+ 615:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <sleep>:
+SYSCALL(sleep)
+ 61d:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 622:	cd 40                	int    $0x40
+ 624:	c3                   	ret
+
+00000625 <uptime>:
+SYSCALL(uptime)
+ 625:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <poll>:
+SYSCALL(poll)
+ 62d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <fcntl>:
+SYSCALL(fcntl)
+ 635:	b8 17 00 00 00       	mov    $0x17,%eax
+ 63a:	cd 40                	int    $0x40
+ 63c:	c3                   	ret
+
+0000063d <irqroute>:
+SYSCALL(irqroute)
+ 63d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 642:	cd 40                	int    $0x40
+ 644:	c3                   	ret
+
+00000645 <intrstat>:
+SYSCALL(intrstat)
+ 645:	b8 19 00 00 00       	mov    $0x19,%eax
+ 64a:	cd 40                	int    $0x40
+ 64c:	c3                   	ret
+
+0000064d <pread>:
+SYSCALL(pread)
+ 64d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 652:	cd 40                	int    $0x40
+ 654:	c3                   	ret
+
+00000655 <getdents>:
+SYSCALL(getdents)
+ 655:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 65a:	cd 40                	int    $0x40
+ 65c:	c3                   	ret
+
+0000065d <fstatat>:
+SYSCALL(fstatat)
+ 65d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 662:	cd 40                	int    $0x40
+ 664:	c3                   	ret
+
+00000665 <openat>:
+SYSCALL(openat)
+ 665:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 66a:	cd 40                	int    $0x40
+ 66c:	c3                   	ret
+
+0000066d <unlinkat>:
+SYSCALL(unlinkat)
+ 66d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 672:	cd 40                	int    $0x40
+ 674:	c3                   	ret
+
+00000675 <mkdirat>:
+SYSCALL(mkdirat)
+ 675:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <linkat>:
+SYSCALL(linkat)
+ 67d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <exits>:
+SYSCALL(exits)
+ 685:	b8 21 00 00 00       	mov    $0x21,%eax
+ 68a:	cd 40                	int    $0x40
+ 68c:	c3                   	ret
+
+0000068d <waitstatus>:
+SYSCALL(waitstatus)
+ 68d:	b8 22 00 00 00       	mov    $0x22,%eax
+ 692:	cd 40                	int    $0x40
+ 694:	c3                   	ret
+
+00000695 <pwrite>:
+SYSCALL(pwrite)
+ 695:	b8 23 00 00 00       	mov    $0x23,%eax
+ 69a:	cd 40                	int    $0x40
+ 69c:	c3                   	ret
+
+0000069d <lseek>:
+SYSCALL(lseek)
+ 69d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6a2:	cd 40                	int    $0x40
+ 6a4:	c3                   	ret
+
+000006a5 <copyfilerange>:
+SYSCALL(copyfilerange)
+ 6a5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6aa:	cd 40                	int    $0x40
+ 6ac:	c3                   	ret
+
+000006ad <fsctl>:
+SYSCALL(fsctl)
+ 6ad:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6b2:	cd 40                	int    $0x40
+ 6b4:	c3                   	ret
+
+000006b5 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6b5:	55                   	push   %ebp
+ 6b6:	89 e5                	mov    %esp,%ebp
+ 6b8:	83 ec 18             	sub    $0x18,%esp
+ 6bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6be:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6c1:	83 ec 04             	sub    $0x4,%esp
+ 6c4:	6a 01                	push   $0x1
+ 6c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6c9:	50                   	push   %eax
+ 6ca:	ff 75 08             	push   0x8(%ebp)
+ 6cd:	e8 db fe ff ff       	call   5ad <write>
+ 6d2:	83 c4 10             	add    $0x10,%esp
+}
+ 6d5:	90                   	nop
+ 6d6:	c9                   	leave
+ 6d7:	c3                   	ret
+
+000006d8 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6d8:	55                   	push   %ebp
+ 6d9:	89 e5                	mov    %esp,%ebp
+ 6db:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6de:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6e5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6e9:	74 17                	je     702 <printint+0x2a>
+ 6eb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6ef:	79 11                	jns    702 <printint+0x2a>
+    neg = 1;
+ 6f1:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6fb:	f7 d8                	neg    %eax
+ 6fd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 700:	eb 06                	jmp    708 <printint+0x30>
+  } else {
+    x = xx;
+ 702:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 705:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 708:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 70f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 712:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 715:	ba 00 00 00 00       	mov    $0x0,%edx
+ 71a:	f7 f1                	div    %ecx
+ 71c:	89 d1                	mov    %edx,%ecx
+ 71e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 721:	8d 50 01             	lea    0x1(%eax),%edx
+ 724:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 727:	0f b6 91 54 0e 00 00 	movzbl 0xe54(%ecx),%edx
+ 72e:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 732:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 735:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 738:	ba 00 00 00 00       	mov    $0x0,%edx
+ 73d:	f7 f1                	div    %ecx
+ 73f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 742:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 746:	75 c7                	jne    70f <printint+0x37>
+  if(neg)
+ 748:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 74c:	74 2d                	je     77b <printint+0xa3>
+    buf[i++] = '-';
+ 74e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 751:	8d 50 01             	lea    0x1(%eax),%edx
+ 754:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 757:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 75c:	eb 1d                	jmp    77b <printint+0xa3>
+    putc(fd, buf[i]);
+ 75e:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 761:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 764:	01 d0                	add    %edx,%eax
+ 766:	0f b6 00             	movzbl (%eax),%eax
+ 769:	0f be c0             	movsbl %al,%eax
+ 76c:	83 ec 08             	sub    $0x8,%esp
+ 76f:	50                   	push   %eax
+ 770:	ff 75 08             	push   0x8(%ebp)
+ 773:	e8 3d ff ff ff       	call   6b5 <putc>
+ 778:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 77b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 77f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 783:	79 d9                	jns    75e <printint+0x86>
+}
+ 785:	90                   	nop
+ 786:	90                   	nop
+ 787:	c9                   	leave
+ 788:	c3                   	ret
+
+00000789 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 789:	55                   	push   %ebp
+ 78a:	89 e5                	mov    %esp,%ebp
+ 78c:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 78f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 796:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 799:	83 c0 04             	add    $0x4,%eax
+ 79c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 79f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7a6:	e9 59 01 00 00       	jmp    904 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 7ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7b1:	01 d0                	add    %edx,%eax
+ 7b3:	0f b6 00             	movzbl (%eax),%eax
+ 7b6:	0f be c0             	movsbl %al,%eax
+ 7b9:	25 ff 00 00 00       	and    $0xff,%eax
+ 7be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7c1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7c5:	75 2c                	jne    7f3 <printf+0x6a>
+      if(c == '%'){
+ 7c7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7cb:	75 0c                	jne    7d9 <printf+0x50>
+        state = '%';
+ 7cd:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7d4:	e9 27 01 00 00       	jmp    900 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 7d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7dc:	0f be c0             	movsbl %al,%eax
+ 7df:	83 ec 08             	sub    $0x8,%esp
+ 7e2:	50                   	push   %eax
+ 7e3:	ff 75 08             	push   0x8(%ebp)
+ 7e6:	e8 ca fe ff ff       	call   6b5 <putc>
+ 7eb:	83 c4 10             	add    $0x10,%esp
+ 7ee:	e9 0d 01 00 00       	jmp    900 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 7f3:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7f7:	0f 85 03 01 00 00    	jne    900 <printf+0x177>
+      if(c == 'd'){
+ 7fd:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 801:	75 1e                	jne    821 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 803:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 806:	8b 00                	mov    (%eax),%eax
+ 808:	6a 01                	push   $0x1
+ 80a:	6a 0a                	push   $0xa
+ 80c:	50                   	push   %eax
+ 80d:	ff 75 08             	push   0x8(%ebp)
+ 810:	e8 c3 fe ff ff       	call   6d8 <printint>
+ 815:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 818:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 81c:	e9 d8 00 00 00       	jmp    8f9 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 821:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 825:	74 06                	je     82d <printf+0xa4>
+ 827:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 82b:	75 1e                	jne    84b <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 82d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 830:	8b 00                	mov    (%eax),%eax
+ 832:	6a 00                	push   $0x0
+ 834:	6a 10                	push   $0x10
+ 836:	50                   	push   %eax
+ 837:	ff 75 08             	push   0x8(%ebp)
+ 83a:	e8 99 fe ff ff       	call   6d8 <printint>
+ 83f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 842:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 846:	e9 ae 00 00 00       	jmp    8f9 <printf+0x170>
+      } else if(c == 's'){
+ 84b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 84f:	75 43                	jne    894 <printf+0x10b>
+        s = (char*)*ap;
+ 851:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 854:	8b 00                	mov    (%eax),%eax
+ 856:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 859:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 85d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 861:	75 25                	jne    888 <printf+0xff>
+          s = "(null)";
+ 863:	c7 45 f4 8e 0b 00 00 	movl   $0xb8e,-0xc(%ebp)
+        while(*s != 0){
+ 86a:	eb 1c                	jmp    888 <printf+0xff>
+          putc(fd, *s);
+ 86c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86f:	0f b6 00             	movzbl (%eax),%eax
+ 872:	0f be c0             	movsbl %al,%eax
+ 875:	83 ec 08             	sub    $0x8,%esp
+ 878:	50                   	push   %eax
+ 879:	ff 75 08             	push   0x8(%ebp)
+ 87c:	e8 34 fe ff ff       	call   6b5 <putc>
+ 881:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 884:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 888:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 88b:	0f b6 00             	movzbl (%eax),%eax
+ 88e:	84 c0                	test   %al,%al
+ 890:	75 da                	jne    86c <printf+0xe3>
+ 892:	eb 65                	jmp    8f9 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 894:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 898:	75 1d                	jne    8b7 <printf+0x12e>
+        putc(fd, *ap);
+ 89a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 89d:	8b 00                	mov    (%eax),%eax
+ 89f:	0f be c0             	movsbl %al,%eax
+ 8a2:	83 ec 08             	sub    $0x8,%esp
+ 8a5:	50                   	push   %eax
+ 8a6:	ff 75 08             	push   0x8(%ebp)
+ 8a9:	e8 07 fe ff ff       	call   6b5 <putc>
+ 8ae:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8b1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8b5:	eb 42                	jmp    8f9 <printf+0x170>
+      } else if(c == '%'){
+ 8b7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8bb:	75 17                	jne    8d4 <printf+0x14b>
+        putc(fd, c);
+ 8bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8c0:	0f be c0             	movsbl %al,%eax
+ 8c3:	83 ec 08             	sub    $0x8,%esp
+ 8c6:	50                   	push   %eax
+ 8c7:	ff 75 08             	push   0x8(%ebp)
+ 8ca:	e8 e6 fd ff ff       	call   6b5 <putc>
+ 8cf:	83 c4 10             	add    $0x10,%esp
+ 8d2:	eb 25                	jmp    8f9 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 8d4:	83 ec 08             	sub    $0x8,%esp
+ 8d7:	6a 25                	push   $0x25
+ 8d9:	ff 75 08             	push   0x8(%ebp)
+ 8dc:	e8 d4 fd ff ff       	call   6b5 <putc>
+ 8e1:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e7:	0f be c0             	movsbl %al,%eax
+ 8ea:	83 ec 08             	sub    $0x8,%esp
+ 8ed:	50                   	push   %eax
+ 8ee:	ff 75 08             	push   0x8(%ebp)
+ 8f1:	e8 bf fd ff ff       	call   6b5 <putc>
+ 8f6:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8f9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 900:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 904:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 907:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 90a:	01 d0                	add    %edx,%eax
+ 90c:	0f b6 00             	movzbl (%eax),%eax
+ 90f:	84 c0                	test   %al,%al
+ 911:	0f 85 94 fe ff ff    	jne    7ab <printf+0x22>
+    }
+  }
+}
+ 917:	90                   	nop
+ 918:	90                   	nop
+ 919:	c9                   	leave
+ 91a:	c3                   	ret
+
+0000091b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 91b:	55                   	push   %ebp
+ 91c:	89 e5                	mov    %esp,%ebp
+ 91e:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 921:	8b 45 08             	mov    0x8(%ebp),%eax
+ 924:	83 e8 08             	sub    $0x8,%eax
+ 927:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 92a:	a1 80 0e 00 00       	mov    0xe80,%eax
+ 92f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 932:	eb 24                	jmp    958 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 934:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 937:	8b 00                	mov    (%eax),%eax
+ 939:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 93c:	72 12                	jb     950 <free+0x35>
+ 93e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 941:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 944:	72 24                	jb     96a <free+0x4f>
+ 946:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 949:	8b 00                	mov    (%eax),%eax
+ 94b:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 94e:	72 1a                	jb     96a <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 950:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 953:	8b 00                	mov    (%eax),%eax
+ 955:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 958:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 95b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 95e:	73 d4                	jae    934 <free+0x19>
+ 960:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 963:	8b 00                	mov    (%eax),%eax
+ 965:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 968:	73 ca                	jae    934 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 96a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 96d:	8b 40 04             	mov    0x4(%eax),%eax
+ 970:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 977:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 97a:	01 c2                	add    %eax,%edx
+ 97c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 97f:	8b 00                	mov    (%eax),%eax
+ 981:	39 c2                	cmp    %eax,%edx
+ 983:	75 24                	jne    9a9 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 985:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 988:	8b 50 04             	mov    0x4(%eax),%edx
+ 98b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 98e:	8b 00                	mov    (%eax),%eax
+ 990:	8b 40 04             	mov    0x4(%eax),%eax
+ 993:	01 c2                	add    %eax,%edx
+ 995:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 998:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 99b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 99e:	8b 00                	mov    (%eax),%eax
+ 9a0:	8b 10                	mov    (%eax),%edx
+ 9a2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9a5:	89 10                	mov    %edx,(%eax)
+ 9a7:	eb 0a                	jmp    9b3 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 9a9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ac:	8b 10                	mov    (%eax),%edx
+ 9ae:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9b1:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 9b3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9b6:	8b 40 04             	mov    0x4(%eax),%eax
+ 9b9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 9c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9c3:	01 d0                	add    %edx,%eax
+ 9c5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 9c8:	75 20                	jne    9ea <free+0xcf>
+    p->s.size += bp->s.size;
+ 9ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9cd:	8b 50 04             	mov    0x4(%eax),%edx
+ 9d0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9d3:	8b 40 04             	mov    0x4(%eax),%eax
+ 9d6:	01 c2                	add    %eax,%edx
+ 9d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9db:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 9de:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 9e1:	8b 10                	mov    (%eax),%edx
+ 9e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9e6:	89 10                	mov    %edx,(%eax)
+ 9e8:	eb 08                	jmp    9f2 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 9ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9ed:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 9f0:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 9f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 9f5:	a3 80 0e 00 00       	mov    %eax,0xe80
+}
+ 9fa:	90                   	nop
+ 9fb:	c9                   	leave
+ 9fc:	c3                   	ret
+
+000009fd <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 9fd:	55                   	push   %ebp
+ 9fe:	89 e5                	mov    %esp,%ebp
+ a00:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ a03:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ a0a:	77 07                	ja     a13 <morecore+0x16>
+    nu = 4096;
+ a0c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ a13:	8b 45 08             	mov    0x8(%ebp),%eax
+ a16:	c1 e0 03             	shl    $0x3,%eax
+ a19:	83 ec 0c             	sub    $0xc,%esp
+ a1c:	50                   	push   %eax
+ a1d:	e8 f3 fb ff ff       	call   615 <sbrk>
+ a22:	83 c4 10             	add    $0x10,%esp
+ a25:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ a28:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a2c:	75 07                	jne    a35 <morecore+0x38>
+    return 0;
+ a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+ a33:	eb 26                	jmp    a5b <morecore+0x5e>
+  hp = (Header*)p;
+ a35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a38:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ a3b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a3e:	8b 55 08             	mov    0x8(%ebp),%edx
+ a41:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ a44:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a47:	83 c0 08             	add    $0x8,%eax
+ a4a:	83 ec 0c             	sub    $0xc,%esp
+ a4d:	50                   	push   %eax
+ a4e:	e8 c8 fe ff ff       	call   91b <free>
+ a53:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ a56:	a1 80 0e 00 00       	mov    0xe80,%eax
+}
+ a5b:	c9                   	leave
+ a5c:	c3                   	ret
+
+00000a5d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ a5d:	55                   	push   %ebp
+ a5e:	89 e5                	mov    %esp,%ebp
+ a60:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a63:	8b 45 08             	mov    0x8(%ebp),%eax
+ a66:	83 c0 07             	add    $0x7,%eax
+ a69:	c1 e8 03             	shr    $0x3,%eax
+ a6c:	83 c0 01             	add    $0x1,%eax
+ a6f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ a72:	a1 80 0e 00 00       	mov    0xe80,%eax
+ a77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ a7a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a7e:	75 23                	jne    aa3 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ a80:	c7 45 f0 78 0e 00 00 	movl   $0xe78,-0x10(%ebp)
+ a87:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a8a:	a3 80 0e 00 00       	mov    %eax,0xe80
+ a8f:	a1 80 0e 00 00       	mov    0xe80,%eax
+ a94:	a3 78 0e 00 00       	mov    %eax,0xe78
+    base.s.size = 0;
+ a99:	c7 05 7c 0e 00 00 00 	movl   $0x0,0xe7c
+ aa0:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aa6:	8b 00                	mov    (%eax),%eax
+ aa8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ aab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aae:	8b 40 04             	mov    0x4(%eax),%eax
+ ab1:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ab4:	72 4d                	jb     b03 <malloc+0xa6>
+      if(p->s.size == nunits)
+ ab6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab9:	8b 40 04             	mov    0x4(%eax),%eax
+ abc:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ abf:	75 0c                	jne    acd <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ ac1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ac4:	8b 10                	mov    (%eax),%edx
+ ac6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ac9:	89 10                	mov    %edx,(%eax)
+ acb:	eb 26                	jmp    af3 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ acd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ad0:	8b 40 04             	mov    0x4(%eax),%eax
+ ad3:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ad6:	89 c2                	mov    %eax,%edx
+ ad8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ adb:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ade:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae1:	8b 40 04             	mov    0x4(%eax),%eax
+ ae4:	c1 e0 03             	shl    $0x3,%eax
+ ae7:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ aea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aed:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ af0:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ af3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af6:	a3 80 0e 00 00       	mov    %eax,0xe80
+      return (void*)(p + 1);
+ afb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ afe:	83 c0 08             	add    $0x8,%eax
+ b01:	eb 3b                	jmp    b3e <malloc+0xe1>
+    }
+    if(p == freep)
+ b03:	a1 80 0e 00 00       	mov    0xe80,%eax
+ b08:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b0b:	75 1e                	jne    b2b <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ b0d:	83 ec 0c             	sub    $0xc,%esp
+ b10:	ff 75 ec             	push   -0x14(%ebp)
+ b13:	e8 e5 fe ff ff       	call   9fd <morecore>
+ b18:	83 c4 10             	add    $0x10,%esp
+ b1b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b1e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b22:	75 07                	jne    b2b <malloc+0xce>
+        return 0;
+ b24:	b8 00 00 00 00       	mov    $0x0,%eax
+ b29:	eb 13                	jmp    b3e <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b2e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b34:	8b 00                	mov    (%eax),%eax
+ b36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b39:	e9 6d ff ff ff       	jmp    aab <malloc+0x4e>
+  }
+}
+ b3e:	c9                   	leave
+ b3f:	c3                   	ret
@@ -0,0 +1,166 @@
+// LZ4-style compression, for compressed file clusters.
+//
+// The compressed data is a series of sequences, as in LZ4: a
+// token byte whose high nibble is the number of literal bytes
+// and low nibble the match length less MINMATCH, a nibble of 15
+// meaning that more follows in bytes of 255 and a final smaller
+// one; then the literal bytes; then a 2-byte little-endian
+// offset back to the match.  The last sequence ends after its
+// literals.
+
+#include "types.h"
+#include "defs.h"
+
+#define MINMATCH 4
+#define HASHBITS 8
+#define MAXOFF   0xffff
+
+static uint
+get32(uchar *p)
+{
+  return p[0] | p[1]<<8 | p[2]<<16 | p[3]<<24;
+}
+
+static uint
+hash(uchar *p)
+{
+  return (get32(p) * 2654435761U) >> (32 - HASHBITS);
+}
+
+// Append a length of n beyond a nibble of 15 at dst[*d].
+static int
+putlen(uchar *dst, int *d, int max, int n)
+{
+  for(; n >= 255; n -= 255){
+    if(*d >= max)
+      return -1;
+    dst[(*d)++] = 255;
+  }
+  if(*d >= max)
+    return -1;
+  dst[(*d)++] = n;
+  return 0;
+}
+
+// Append a sequence: the literals src[0..nlit), then a match of
+// len bytes off back, or none if len is 0.
+static int
+putseq(uchar *dst, int *d, int max, uchar *src, int nlit, int off, int len)
+{
+  int t;
+
+  if(*d >= max)
+    return -1;
+  t = *d;
+  (*d)++;
+  dst[t] = (nlit < 15 ? nlit : 15) << 4;
+  if(nlit >= 15 && putlen(dst, d, max, nlit - 15) < 0)
+    return -1;
+  if(*d + nlit > max)
+    return -1;
+  memmove(dst + *d, src, nlit);
+  *d += nlit;
+  if(len == 0)
+    return 0;
+  len -= MINMATCH;
+  dst[t] |= len < 15 ? len : 15;
+  if(*d + 2 > max)
+    return -1;
+  dst[(*d)++] = off;
+  dst[(*d)++] = off >> 8;
+  if(len >= 15 && putlen(dst, d, max, len - 15) < 0)
+    return -1;
+  return 0;
+}
+
+// Compress src[0..n) into dst, using the 1<<HASHBITS entries of
+// tab as scratch.  Returns the compressed length, or -1 if it
+// would be more than max.
+int
+lzcompress(uchar *src, int n, uchar *dst, int max, ushort *tab)
+{
+  int i, anchor, cand, len, d;
+  uint h;
+
+  memset(tab, 0, sizeof(ushort) << HASHBITS);
+  d = 0;
+  anchor = 0;
+  i = 0;
+  while(i + MINMATCH <= n){
+    h = hash(src + i);
+    cand = tab[h] - 1;  // entries are positions plus one
+    tab[h] = i + 1;
+    if(cand < 0 || i - cand > MAXOFF || get32(src + cand) != get32(src + i)){
+      i++;
+      continue;
+    }
+    for(len = MINMATCH; i + len < n && src[cand + len] == src[i + len]; len++)
+      ;
+    if(putseq(dst, &d, max, src + anchor, i - anchor, i - cand, len) < 0)
+      return -1;
+    i += len;
+    anchor = i;
+  }
+  if(putseq(dst, &d, max, src + anchor, n - anchor, 0, 0) < 0)
+    return -1;
+  return d;
+}
+
+// Read a length of n beyond a nibble of 15 from src[*s].
+static int
+getlen(uchar *src, int *s, int n)
+{
+  int len, b;
+
+  len = 0;
+  do {
+    if(*s >= n)
+      return -1;
+    b = src[(*s)++];
+    len += b;
+  } while(b == 255);
+  return len;
+}
+
+// Decompress src[0..n) into dst.  Returns the decompressed
+// length, or -1 if the data is corrupt or would be more than max.
+int
+lzdecompress(uchar *src, int n, uchar *dst, int max)
+{
+  int s, d, t, nlit, off, len;
+
+  s = d = 0;
+  while(s < n){
+    t = src[s++];
+    nlit = t >> 4;
+    if(nlit == 15){
+      if((len = getlen(src, &s, n)) < 0)
+        return -1;
+      nlit += len;
+    }
+    if(s + nlit > n || d + nlit > max)
+      return -1;
+    memmove(dst + d, src + s, nlit);
+    s += nlit;
+    d += nlit;
+    if(s == n)
+      break;
+    if(s + 2 > n)
+      return -1;
+    off = src[s] | src[s+1]<<8;
+    s += 2;
+    len = t & 15;
+    if(len == 15){
+      if((t = getlen(src, &s, n)) < 0)
+        return -1;
+      len += t;
+    }
+    len += MINMATCH;
+    if(off == 0 || off > d || d + len > max)
+      return -1;
+    // Byte by byte: the match may overlap what it produces.
+    for(; len > 0; len--, d++)
+      dst[d] = dst[d - off];
+  }
+  return d;
+}
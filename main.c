@@ -105,6 +105,8 @@ main(void)
   // 割り込みベクタの設定
   tvinit();        // trap vectors
 
+  ipiinit();       // inter-processor calls
+
   // bcacheのロック初期化 + buf構造体を利用したNBUF個のバッファ(固定長配列)を初期化する。バッファキャッシュへのアクセスはbcache.head経由で行われる
   binit();         // buffer cache
 
@@ -0,0 +1,1279 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: mkdir files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 d8 08 00 00       	push   $0x8d8
+  21:	6a 02                	push   $0x2
+  23:	e8 f9 04 00 00       	call   521 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 f5 02 00 00       	call   325 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(mkdir(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 3a 03 00 00       	call   38d <mkdir>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 ef 08 00 00       	push   $0x8ef
+  74:	6a 02                	push   $0x2
+  76:	e8 a6 04 00 00       	call   521 <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 95 02 00 00       	call   325 <exit>
+
+00000090 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  c2:	90                   	nop
+  c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  c6:	8d 42 01             	lea    0x1(%edx),%eax
+  c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+  cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  cf:	8d 48 01             	lea    0x1(%eax),%ecx
+  d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  d5:	0f b6 12             	movzbl (%edx),%edx
+  d8:	88 10                	mov    %dl,(%eax)
+  da:	0f b6 00             	movzbl (%eax),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 e2                	jne    c3 <strcpy+0xd>
+    ;
+  return os;
+  e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+
+000000e6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  e6:	55                   	push   %ebp
+  e7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  e9:	eb 08                	jmp    f3 <strcmp+0xd>
+    p++, q++;
+  eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	0f b6 00             	movzbl (%eax),%eax
+  f9:	84 c0                	test   %al,%al
+  fb:	74 10                	je     10d <strcmp+0x27>
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 100:	0f b6 10             	movzbl (%eax),%edx
+ 103:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 106:	0f b6 00             	movzbl (%eax),%eax
+ 109:	38 c2                	cmp    %al,%dl
+ 10b:	74 de                	je     eb <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 10d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	0f b6 d0             	movzbl %al,%edx
+ 116:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 119:	0f b6 00             	movzbl (%eax),%eax
+ 11c:	0f b6 c0             	movzbl %al,%eax
+ 11f:	29 c2                	sub    %eax,%edx
+ 121:	89 d0                	mov    %edx,%eax
+}
+ 123:	5d                   	pop    %ebp
+ 124:	c3                   	ret
+
+00000125 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 12b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 132:	eb 04                	jmp    138 <strlen+0x13>
+ 134:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 138:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 13b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 13e:	01 d0                	add    %edx,%eax
+ 140:	0f b6 00             	movzbl (%eax),%eax
+ 143:	84 c0                	test   %al,%al
+ 145:	75 ed                	jne    134 <strlen+0xf>
+    ;
+  return n;
+ 147:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 14a:	c9                   	leave
+ 14b:	c3                   	ret
+
+0000014c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 14f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 152:	50                   	push   %eax
+ 153:	ff 75 0c             	push   0xc(%ebp)
+ 156:	ff 75 08             	push   0x8(%ebp)
+ 159:	e8 32 ff ff ff       	call   90 <stosb>
+ 15e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	83 ec 04             	sub    $0x4,%esp
+ 16c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 172:	eb 14                	jmp    188 <strchr+0x22>
+    if(*s == c)
+ 174:	8b 45 08             	mov    0x8(%ebp),%eax
+ 177:	0f b6 00             	movzbl (%eax),%eax
+ 17a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 17d:	75 05                	jne    184 <strchr+0x1e>
+      return (char*)s;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	eb 13                	jmp    197 <strchr+0x31>
+  for(; *s; s++)
+ 184:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18b:	0f b6 00             	movzbl (%eax),%eax
+ 18e:	84 c0                	test   %al,%al
+ 190:	75 e2                	jne    174 <strchr+0xe>
+  return 0;
+ 192:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 19f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1a6:	eb 42                	jmp    1ea <gets+0x51>
+    cc = read(0, &c, 1);
+ 1a8:	83 ec 04             	sub    $0x4,%esp
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1b0:	50                   	push   %eax
+ 1b1:	6a 00                	push   $0x0
+ 1b3:	e8 85 01 00 00       	call   33d <read>
+ 1b8:	83 c4 10             	add    $0x10,%esp
+ 1bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1c2:	7e 33                	jle    1f7 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1cd:	89 c2                	mov    %eax,%edx
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	01 c2                	add    %eax,%edx
+ 1d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1de:	3c 0a                	cmp    $0xa,%al
+ 1e0:	74 16                	je     1f8 <gets+0x5f>
+ 1e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1e6:	3c 0d                	cmp    $0xd,%al
+ 1e8:	74 0e                	je     1f8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ed:	83 c0 01             	add    $0x1,%eax
+ 1f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1f3:	7f b3                	jg     1a8 <gets+0xf>
+ 1f5:	eb 01                	jmp    1f8 <gets+0x5f>
+      break;
+ 1f7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fe:	01 d0                	add    %edx,%eax
+ 200:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 206:	c9                   	leave
+ 207:	c3                   	ret
+
+00000208 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 208:	55                   	push   %ebp
+ 209:	89 e5                	mov    %esp,%ebp
+ 20b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 20e:	83 ec 08             	sub    $0x8,%esp
+ 211:	6a 00                	push   $0x0
+ 213:	ff 75 08             	push   0x8(%ebp)
+ 216:	e8 4a 01 00 00       	call   365 <open>
+ 21b:	83 c4 10             	add    $0x10,%esp
+ 21e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 221:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 225:	79 07                	jns    22e <stat+0x26>
+    return -1;
+ 227:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 22c:	eb 25                	jmp    253 <stat+0x4b>
+  r = fstat(fd, st);
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	ff 75 0c             	push   0xc(%ebp)
+ 234:	ff 75 f4             	push   -0xc(%ebp)
+ 237:	e8 41 01 00 00       	call   37d <fstat>
+ 23c:	83 c4 10             	add    $0x10,%esp
+ 23f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 242:	83 ec 0c             	sub    $0xc,%esp
+ 245:	ff 75 f4             	push   -0xc(%ebp)
+ 248:	e8 00 01 00 00       	call   34d <close>
+ 24d:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 250:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+
+00000255 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 255:	55                   	push   %ebp
+ 256:	89 e5                	mov    %esp,%ebp
+ 258:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 25b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 262:	eb 25                	jmp    289 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 264:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 267:	89 d0                	mov    %edx,%eax
+ 269:	c1 e0 02             	shl    $0x2,%eax
+ 26c:	01 d0                	add    %edx,%eax
+ 26e:	01 c0                	add    %eax,%eax
+ 270:	89 c1                	mov    %eax,%ecx
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+ 275:	8d 50 01             	lea    0x1(%eax),%edx
+ 278:	89 55 08             	mov    %edx,0x8(%ebp)
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	0f be c0             	movsbl %al,%eax
+ 281:	01 c8                	add    %ecx,%eax
+ 283:	83 e8 30             	sub    $0x30,%eax
+ 286:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	3c 2f                	cmp    $0x2f,%al
+ 291:	7e 0a                	jle    29d <atoi+0x48>
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	0f b6 00             	movzbl (%eax),%eax
+ 299:	3c 39                	cmp    $0x39,%al
+ 29b:	7e c7                	jle    264 <atoi+0xf>
+  return n;
+ 29d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2a0:	c9                   	leave
+ 2a1:	c3                   	ret
+
+000002a2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2a2:	55                   	push   %ebp
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2b4:	eb 17                	jmp    2cd <memmove+0x2b>
+    *dst++ = *src++;
+ 2b6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2b9:	8d 42 01             	lea    0x1(%edx),%eax
+ 2bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2c2:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2c5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2c8:	0f b6 12             	movzbl (%edx),%edx
+ 2cb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2cd:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2d3:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2d6:	85 c0                	test   %eax,%eax
+ 2d8:	7f dc                	jg     2b6 <memmove+0x14>
+  return vdst;
+ 2da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2dd:	c9                   	leave
+ 2de:	c3                   	ret
+
+000002df <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 2df:	55                   	push   %ebp
+ 2e0:	89 e5                	mov    %esp,%ebp
+ 2e2:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 2e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2ec:	eb 04                	jmp    2f2 <ncpus+0x13>
+ 2ee:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2f2:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 2f6:	7f 16                	jg     30e <ncpus+0x2f>
+ 2f8:	83 ec 08             	sub    $0x8,%esp
+ 2fb:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 2fe:	50                   	push   %eax
+ 2ff:	ff 75 f4             	push   -0xc(%ebp)
+ 302:	e8 d6 00 00 00       	call   3dd <intrstat>
+ 307:	83 c4 10             	add    $0x10,%esp
+ 30a:	85 c0                	test   %eax,%eax
+ 30c:	74 e0                	je     2ee <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 30e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 311:	ba 01 00 00 00       	mov    $0x1,%edx
+ 316:	85 c0                	test   %eax,%eax
+ 318:	0f 4e c2             	cmovle %edx,%eax
+}
+ 31b:	c9                   	leave
+ 31c:	c3                   	ret
+
+0000031d <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 31d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 322:	cd 40                	int    $0x40
+ 324:	c3                   	ret
+
+00000325 <exit>:
+SYSCALL(exit)
+ 325:	b8 02 00 00 00       	mov    $0x2,%eax
+ 32a:	cd 40                	int    $0x40
+ 32c:	c3                   	ret
+
+0000032d <wait>:
+SYSCALL(wait)
+ 32d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 332:	cd 40                	int    $0x40
+ 334:	c3                   	ret
+
+00000335 <pipe>:
+SYSCALL(pipe)
+ 335:	b8 04 00 00 00       	mov    $0x4,%eax
+ 33a:	cd 40                	int    $0x40
+ 33c:	c3                   	ret
+
+0000033d <read>:
+SYSCALL(read)
+ 33d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 342:	cd 40                	int    $0x40
+ 344:	c3                   	ret
+
+00000345 <write>:
+SYSCALL(write)
+ 345:	b8 10 00 00 00       	mov    $0x10,%eax
+ 34a:	cd 40                	int    $0x40
+ 34c:	c3                   	ret
+
+0000034d <close>:
+SYSCALL(close)
+ 34d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 352:	cd 40                	int    $0x40
+ 354:	c3                   	ret
+
+00000355 <kill>:
+SYSCALL(kill)
+ 355:	b8 06 00 00 00       	mov    $0x6,%eax
+ 35a:	cd 40                	int    $0x40
+ 35c:	c3                   	ret
+
+0000035d <exec>:
+SYSCALL(exec)
+ 35d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 362:	cd 40                	int    $0x40
+ 364:	c3                   	ret
+
+00000365 <open>:
+SYSCALL(open)
+ 365:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 36a:	cd 40                	int    $0x40
+ 36c:	c3                   	ret
+
+0000036d <mknod>:
+SYSCALL(mknod)
+ 36d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 372:	cd 40                	int    $0x40
+ 374:	c3                   	ret
+
+00000375 <unlink>:
+SYSCALL(unlink)
+ 375:	b8 12 00 00 00       	mov    $0x12,%eax
+ 37a:	cd 40                	int    $0x40
+ 37c:	c3                   	ret
+
+0000037d <fstat>:
+SYSCALL(fstat)
+ 37d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 382:	cd 40                	int    $0x40
+ 384:	c3                   	ret
+
+00000385 <link>:
+SYSCALL(link)
+ 385:	b8 13 00 00 00       	mov    $0x13,%eax
+ 38a:	cd 40                	int    $0x40
+ 38c:	c3                   	ret
+
+0000038d <mkdir>:
+SYSCALL(mkdir)
+ 38d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 392:	cd 40                	int    $0x40
+ 394:	c3                   	ret
+
+00000395 <chdir>:
+SYSCALL(chdir)
+ 395:	b8 09 00 00 00       	mov    $0x9,%eax
+ 39a:	cd 40                	int    $0x40
+ 39c:	c3                   	ret
+
+0000039d <dup>:
+SYSCALL(dup)
+ 39d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3a2:	cd 40                	int    $0x40
+ 3a4:	c3                   	ret
+
+000003a5 <getpid>:
+SYSCALL(getpid)
+ 3a5:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3aa:	cd 40                	int    $0x40
+ 3ac:	c3                   	ret
+
+000003ad <sbrk>:
+SYSCALL(sbrk)
+ 3ad:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3b2:	cd 40                	int    $0x40
+ 3b4:	c3                   	ret
+
+000003b5 <sleep>:
+SYSCALL(sleep)
+ 3b5:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3ba:	cd 40                	int    $0x40
+ 3bc:	c3                   	ret
+
+000003bd <uptime>:
+SYSCALL(uptime)
+ 3bd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3c2:	cd 40                	int    $0x40
+ 3c4:	c3                   	ret
+
+000003c5 <poll>:
+SYSCALL(poll)
+ 3c5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3ca:	cd 40                	int    $0x40
+ 3cc:	c3                   	ret
+
+000003cd <fcntl>:
+SYSCALL(fcntl)
+ 3cd:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3d2:	cd 40                	int    $0x40
+ 3d4:	c3                   	ret
+
+000003d5 <irqroute>:
+SYSCALL(irqroute)
+ 3d5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3da:	cd 40                	int    $0x40
+ 3dc:	c3                   	ret
+
+000003dd <intrstat>:
+SYSCALL(intrstat)
+ 3dd:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3e2:	cd 40                	int    $0x40
+ 3e4:	c3                   	ret
+
+000003e5 <pread>:
+SYSCALL(pread)
+ 3e5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3ea:	cd 40                	int    $0x40
+ 3ec:	c3                   	ret
+
+000003ed <getdents>:
+SYSCALL(getdents)
+ 3ed:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f2:	cd 40                	int    $0x40
+ 3f4:	c3                   	ret
+
+000003f5 <fstatat>:
+SYSCALL(fstatat)
+ 3f5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3fa:	cd 40                	int    $0x40
+ 3fc:	c3                   	ret
+
+000003fd <openat>:
+SYSCALL(openat)
+ 3fd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 402:	cd 40                	int    $0x40
+ 404:	c3                   	ret
+
+00000405 <unlinkat>:
+SYSCALL(unlinkat)
+ 405:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 40a:	cd 40                	int    $0x40
+ 40c:	c3                   	ret
+
+0000040d <mkdirat>:
+SYSCALL(mkdirat)
+ 40d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 412:	cd 40                	int    $0x40
+ 414:	c3                   	ret
+
+00000415 <linkat>:
+SYSCALL(linkat)
+ 415:	b8 20 00 00 00       	mov    $0x20,%eax
+ 41a:	cd 40                	int    $0x40
+ 41c:	c3                   	ret
+
+0000041d <exits>:
+SYSCALL(exits)
+ 41d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 422:	cd 40                	int    $0x40
+ 424:	c3                   	ret
+
+00000425 <waitstatus>:
+SYSCALL(waitstatus)
+ 425:	b8 22 00 00 00       	mov    $0x22,%eax
+ 42a:	cd 40                	int    $0x40
+ 42c:	c3                   	ret
+
+0000042d <pwrite>:
+SYSCALL(pwrite)
+ 42d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 432:	cd 40                	int    $0x40
+ 434:	c3                   	ret
+
+00000435 <lseek>:
+SYSCALL(lseek)
+ 435:	b8 24 00 00 00       	mov    $0x24,%eax
+ 43a:	cd 40                	int    $0x40
+ 43c:	c3                   	ret
+
+0000043d <copyfilerange>:
+SYSCALL(copyfilerange)
+ 43d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 442:	cd 40                	int    $0x40
+ 444:	c3                   	ret
+
+00000445 <fsctl>:
+SYSCALL(fsctl)
+ 445:	b8 26 00 00 00       	mov    $0x26,%eax
+ 44a:	cd 40                	int    $0x40
+ 44c:	c3                   	ret
+
+0000044d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+ 450:	83 ec 18             	sub    $0x18,%esp
+ 453:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 456:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 459:	83 ec 04             	sub    $0x4,%esp
+ 45c:	6a 01                	push   $0x1
+ 45e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 461:	50                   	push   %eax
+ 462:	ff 75 08             	push   0x8(%ebp)
+ 465:	e8 db fe ff ff       	call   345 <write>
+ 46a:	83 c4 10             	add    $0x10,%esp
+}
+ 46d:	90                   	nop
+ 46e:	c9                   	leave
+ 46f:	c3                   	ret
+
+00000470 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 476:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 47d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 481:	74 17                	je     49a <printint+0x2a>
+ 483:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 487:	79 11                	jns    49a <printint+0x2a>
+    neg = 1;
+ 489:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 490:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 493:	f7 d8                	neg    %eax
+ 495:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 498:	eb 06                	jmp    4a0 <printint+0x30>
+  } else {
+    x = xx;
+ 49a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 49d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4a0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4ad:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b2:	f7 f1                	div    %ecx
+ 4b4:	89 d1                	mov    %edx,%ecx
+ 4b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4b9:	8d 50 01             	lea    0x1(%eax),%edx
+ 4bc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4bf:	0f b6 91 7c 0b 00 00 	movzbl 0xb7c(%ecx),%edx
+ 4c6:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4cd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4d0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4d5:	f7 f1                	div    %ecx
+ 4d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4da:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4de:	75 c7                	jne    4a7 <printint+0x37>
+  if(neg)
+ 4e0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4e4:	74 2d                	je     513 <printint+0xa3>
+    buf[i++] = '-';
+ 4e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4e9:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ec:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4ef:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 4f4:	eb 1d                	jmp    513 <printint+0xa3>
+    putc(fd, buf[i]);
+ 4f6:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 4f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4fc:	01 d0                	add    %edx,%eax
+ 4fe:	0f b6 00             	movzbl (%eax),%eax
+ 501:	0f be c0             	movsbl %al,%eax
+ 504:	83 ec 08             	sub    $0x8,%esp
+ 507:	50                   	push   %eax
+ 508:	ff 75 08             	push   0x8(%ebp)
+ 50b:	e8 3d ff ff ff       	call   44d <putc>
+ 510:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 513:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 517:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 51b:	79 d9                	jns    4f6 <printint+0x86>
+}
+ 51d:	90                   	nop
+ 51e:	90                   	nop
+ 51f:	c9                   	leave
+ 520:	c3                   	ret
+
+00000521 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 521:	55                   	push   %ebp
+ 522:	89 e5                	mov    %esp,%ebp
+ 524:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 527:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 52e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 531:	83 c0 04             	add    $0x4,%eax
+ 534:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 537:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 53e:	e9 59 01 00 00       	jmp    69c <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 543:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 546:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 549:	01 d0                	add    %edx,%eax
+ 54b:	0f b6 00             	movzbl (%eax),%eax
+ 54e:	0f be c0             	movsbl %al,%eax
+ 551:	25 ff 00 00 00       	and    $0xff,%eax
+ 556:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 559:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 55d:	75 2c                	jne    58b <printf+0x6a>
+      if(c == '%'){
+ 55f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 563:	75 0c                	jne    571 <printf+0x50>
+        state = '%';
+ 565:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 56c:	e9 27 01 00 00       	jmp    698 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 571:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 574:	0f be c0             	movsbl %al,%eax
+ 577:	83 ec 08             	sub    $0x8,%esp
+ 57a:	50                   	push   %eax
+ 57b:	ff 75 08             	push   0x8(%ebp)
+ 57e:	e8 ca fe ff ff       	call   44d <putc>
+ 583:	83 c4 10             	add    $0x10,%esp
+ 586:	e9 0d 01 00 00       	jmp    698 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 58b:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 58f:	0f 85 03 01 00 00    	jne    698 <printf+0x177>
+      if(c == 'd'){
+ 595:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 599:	75 1e                	jne    5b9 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 59b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 59e:	8b 00                	mov    (%eax),%eax
+ 5a0:	6a 01                	push   $0x1
+ 5a2:	6a 0a                	push   $0xa
+ 5a4:	50                   	push   %eax
+ 5a5:	ff 75 08             	push   0x8(%ebp)
+ 5a8:	e8 c3 fe ff ff       	call   470 <printint>
+ 5ad:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5b0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5b4:	e9 d8 00 00 00       	jmp    691 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5b9:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5bd:	74 06                	je     5c5 <printf+0xa4>
+ 5bf:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5c3:	75 1e                	jne    5e3 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5c5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c8:	8b 00                	mov    (%eax),%eax
+ 5ca:	6a 00                	push   $0x0
+ 5cc:	6a 10                	push   $0x10
+ 5ce:	50                   	push   %eax
+ 5cf:	ff 75 08             	push   0x8(%ebp)
+ 5d2:	e8 99 fe ff ff       	call   470 <printint>
+ 5d7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5da:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5de:	e9 ae 00 00 00       	jmp    691 <printf+0x170>
+      } else if(c == 's'){
+ 5e3:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5e7:	75 43                	jne    62c <printf+0x10b>
+        s = (char*)*ap;
+ 5e9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5ec:	8b 00                	mov    (%eax),%eax
+ 5ee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 5f1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 5f5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5f9:	75 25                	jne    620 <printf+0xff>
+          s = "(null)";
+ 5fb:	c7 45 f4 0b 09 00 00 	movl   $0x90b,-0xc(%ebp)
+        while(*s != 0){
+ 602:	eb 1c                	jmp    620 <printf+0xff>
+          putc(fd, *s);
+ 604:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 607:	0f b6 00             	movzbl (%eax),%eax
+ 60a:	0f be c0             	movsbl %al,%eax
+ 60d:	83 ec 08             	sub    $0x8,%esp
+ 610:	50                   	push   %eax
+ 611:	ff 75 08             	push   0x8(%ebp)
+ 614:	e8 34 fe ff ff       	call   44d <putc>
+ 619:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 61c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 620:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 623:	0f b6 00             	movzbl (%eax),%eax
+ 626:	84 c0                	test   %al,%al
+ 628:	75 da                	jne    604 <printf+0xe3>
+ 62a:	eb 65                	jmp    691 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 62c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 630:	75 1d                	jne    64f <printf+0x12e>
+        putc(fd, *ap);
+ 632:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 635:	8b 00                	mov    (%eax),%eax
+ 637:	0f be c0             	movsbl %al,%eax
+ 63a:	83 ec 08             	sub    $0x8,%esp
+ 63d:	50                   	push   %eax
+ 63e:	ff 75 08             	push   0x8(%ebp)
+ 641:	e8 07 fe ff ff       	call   44d <putc>
+ 646:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 649:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 64d:	eb 42                	jmp    691 <printf+0x170>
+      } else if(c == '%'){
+ 64f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 653:	75 17                	jne    66c <printf+0x14b>
+        putc(fd, c);
+ 655:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 658:	0f be c0             	movsbl %al,%eax
+ 65b:	83 ec 08             	sub    $0x8,%esp
+ 65e:	50                   	push   %eax
+ 65f:	ff 75 08             	push   0x8(%ebp)
+ 662:	e8 e6 fd ff ff       	call   44d <putc>
+ 667:	83 c4 10             	add    $0x10,%esp
+ 66a:	eb 25                	jmp    691 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 66c:	83 ec 08             	sub    $0x8,%esp
+ 66f:	6a 25                	push   $0x25
+ 671:	ff 75 08             	push   0x8(%ebp)
+ 674:	e8 d4 fd ff ff       	call   44d <putc>
+ 679:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 67c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 67f:	0f be c0             	movsbl %al,%eax
+ 682:	83 ec 08             	sub    $0x8,%esp
+ 685:	50                   	push   %eax
+ 686:	ff 75 08             	push   0x8(%ebp)
+ 689:	e8 bf fd ff ff       	call   44d <putc>
+ 68e:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 691:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 698:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 69c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 69f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6a2:	01 d0                	add    %edx,%eax
+ 6a4:	0f b6 00             	movzbl (%eax),%eax
+ 6a7:	84 c0                	test   %al,%al
+ 6a9:	0f 85 94 fe ff ff    	jne    543 <printf+0x22>
+    }
+  }
+}
+ 6af:	90                   	nop
+ 6b0:	90                   	nop
+ 6b1:	c9                   	leave
+ 6b2:	c3                   	ret
+
+000006b3 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 6b3:	55                   	push   %ebp
+ 6b4:	89 e5                	mov    %esp,%ebp
+ 6b6:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bc:	83 e8 08             	sub    $0x8,%eax
+ 6bf:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6c2:	a1 98 0b 00 00       	mov    0xb98,%eax
+ 6c7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6ca:	eb 24                	jmp    6f0 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6cf:	8b 00                	mov    (%eax),%eax
+ 6d1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6d4:	72 12                	jb     6e8 <free+0x35>
+ 6d6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6d9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6dc:	72 24                	jb     702 <free+0x4f>
+ 6de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e1:	8b 00                	mov    (%eax),%eax
+ 6e3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6e6:	72 1a                	jb     702 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 6e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6eb:	8b 00                	mov    (%eax),%eax
+ 6ed:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 6f0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6f3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6f6:	73 d4                	jae    6cc <free+0x19>
+ 6f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6fb:	8b 00                	mov    (%eax),%eax
+ 6fd:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 700:	73 ca                	jae    6cc <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 702:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 705:	8b 40 04             	mov    0x4(%eax),%eax
+ 708:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 70f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 712:	01 c2                	add    %eax,%edx
+ 714:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 717:	8b 00                	mov    (%eax),%eax
+ 719:	39 c2                	cmp    %eax,%edx
+ 71b:	75 24                	jne    741 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 71d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 720:	8b 50 04             	mov    0x4(%eax),%edx
+ 723:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 726:	8b 00                	mov    (%eax),%eax
+ 728:	8b 40 04             	mov    0x4(%eax),%eax
+ 72b:	01 c2                	add    %eax,%edx
+ 72d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 730:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 733:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 736:	8b 00                	mov    (%eax),%eax
+ 738:	8b 10                	mov    (%eax),%edx
+ 73a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 73d:	89 10                	mov    %edx,(%eax)
+ 73f:	eb 0a                	jmp    74b <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 741:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 744:	8b 10                	mov    (%eax),%edx
+ 746:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 749:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 74b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 74e:	8b 40 04             	mov    0x4(%eax),%eax
+ 751:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 758:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 75b:	01 d0                	add    %edx,%eax
+ 75d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 760:	75 20                	jne    782 <free+0xcf>
+    p->s.size += bp->s.size;
+ 762:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 765:	8b 50 04             	mov    0x4(%eax),%edx
+ 768:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 76b:	8b 40 04             	mov    0x4(%eax),%eax
+ 76e:	01 c2                	add    %eax,%edx
+ 770:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 773:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 776:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 779:	8b 10                	mov    (%eax),%edx
+ 77b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 77e:	89 10                	mov    %edx,(%eax)
+ 780:	eb 08                	jmp    78a <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 782:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 785:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 788:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 78a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 78d:	a3 98 0b 00 00       	mov    %eax,0xb98
+}
+ 792:	90                   	nop
+ 793:	c9                   	leave
+ 794:	c3                   	ret
+
+00000795 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 795:	55                   	push   %ebp
+ 796:	89 e5                	mov    %esp,%ebp
+ 798:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 79b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 7a2:	77 07                	ja     7ab <morecore+0x16>
+    nu = 4096;
+ 7a4:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 7ab:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ae:	c1 e0 03             	shl    $0x3,%eax
+ 7b1:	83 ec 0c             	sub    $0xc,%esp
+ 7b4:	50                   	push   %eax
+ 7b5:	e8 f3 fb ff ff       	call   3ad <sbrk>
+ 7ba:	83 c4 10             	add    $0x10,%esp
+ 7bd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 7c0:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 7c4:	75 07                	jne    7cd <morecore+0x38>
+    return 0;
+ 7c6:	b8 00 00 00 00       	mov    $0x0,%eax
+ 7cb:	eb 26                	jmp    7f3 <morecore+0x5e>
+  hp = (Header*)p;
+ 7cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 7d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7d6:	8b 55 08             	mov    0x8(%ebp),%edx
+ 7d9:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7df:	83 c0 08             	add    $0x8,%eax
+ 7e2:	83 ec 0c             	sub    $0xc,%esp
+ 7e5:	50                   	push   %eax
+ 7e6:	e8 c8 fe ff ff       	call   6b3 <free>
+ 7eb:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 7ee:	a1 98 0b 00 00       	mov    0xb98,%eax
+}
+ 7f3:	c9                   	leave
+ 7f4:	c3                   	ret
+
+000007f5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 7f5:	55                   	push   %ebp
+ 7f6:	89 e5                	mov    %esp,%ebp
+ 7f8:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7fe:	83 c0 07             	add    $0x7,%eax
+ 801:	c1 e8 03             	shr    $0x3,%eax
+ 804:	83 c0 01             	add    $0x1,%eax
+ 807:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 80a:	a1 98 0b 00 00       	mov    0xb98,%eax
+ 80f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 812:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 816:	75 23                	jne    83b <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 818:	c7 45 f0 90 0b 00 00 	movl   $0xb90,-0x10(%ebp)
+ 81f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 822:	a3 98 0b 00 00       	mov    %eax,0xb98
+ 827:	a1 98 0b 00 00       	mov    0xb98,%eax
+ 82c:	a3 90 0b 00 00       	mov    %eax,0xb90
+    base.s.size = 0;
+ 831:	c7 05 94 0b 00 00 00 	movl   $0x0,0xb94
+ 838:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 83b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 83e:	8b 00                	mov    (%eax),%eax
+ 840:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 843:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 846:	8b 40 04             	mov    0x4(%eax),%eax
+ 849:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 84c:	72 4d                	jb     89b <malloc+0xa6>
+      if(p->s.size == nunits)
+ 84e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 851:	8b 40 04             	mov    0x4(%eax),%eax
+ 854:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 857:	75 0c                	jne    865 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 85c:	8b 10                	mov    (%eax),%edx
+ 85e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 861:	89 10                	mov    %edx,(%eax)
+ 863:	eb 26                	jmp    88b <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 868:	8b 40 04             	mov    0x4(%eax),%eax
+ 86b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 86e:	89 c2                	mov    %eax,%edx
+ 870:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 873:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 879:	8b 40 04             	mov    0x4(%eax),%eax
+ 87c:	c1 e0 03             	shl    $0x3,%eax
+ 87f:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 882:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 885:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 888:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 88b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 88e:	a3 98 0b 00 00       	mov    %eax,0xb98
+      return (void*)(p + 1);
+ 893:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 896:	83 c0 08             	add    $0x8,%eax
+ 899:	eb 3b                	jmp    8d6 <malloc+0xe1>
+    }
+    if(p == freep)
+ 89b:	a1 98 0b 00 00       	mov    0xb98,%eax
+ 8a0:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 8a3:	75 1e                	jne    8c3 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 8a5:	83 ec 0c             	sub    $0xc,%esp
+ 8a8:	ff 75 ec             	push   -0x14(%ebp)
+ 8ab:	e8 e5 fe ff ff       	call   795 <morecore>
+ 8b0:	83 c4 10             	add    $0x10,%esp
+ 8b3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 8b6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ba:	75 07                	jne    8c3 <malloc+0xce>
+        return 0;
+ 8bc:	b8 00 00 00 00       	mov    $0x0,%eax
+ 8c1:	eb 13                	jmp    8d6 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cc:	8b 00                	mov    (%eax),%eax
+ 8ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 8d1:	e9 6d ff ff ff       	jmp    843 <malloc+0x4e>
+  }
+}
+ 8d6:	c9                   	leave
+ 8d7:	c3                   	ret
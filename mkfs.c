@@ -13,8 +13,8 @@
 
 #define static_assert(a, b) do { switch (0) case 0: case (a): ; } while (0)
 
-int nblocks = (995-LOGSIZE);
-int nlog = LOGSIZE;
+int nblocks = (992-LOGHDRBLOCKS-LOGSIZE);
+int nlog = LOGHDRBLOCKS+LOGSIZE;
 int ninodes = 200;
 int size = 1024;
 
@@ -24,6 +24,7 @@ char zeroes[512];
 uint freeblock;
 uint usedblocks;
 uint bitblocks;
+uint refblocks;
 uint freeinode = 1;
 
 void balloc(int);
@@ -89,11 +90,12 @@ main(int argc, char *argv[])
   sb.nlog = xint(nlog);
 
   bitblocks = size/(512*8) + 1;
-  usedblocks = ninodes / IPB + 3 + bitblocks;
+  refblocks = size/RPB + 1;
+  usedblocks = ninodes / IPB + 3 + bitblocks + refblocks;
   freeblock = usedblocks;
 
-  printf("used %d (bit %d ninode %zu) free %u log %u total %d\n", usedblocks,
-         bitblocks, ninodes/IPB + 1, freeblock, nlog, nblocks+usedblocks+nlog);
+  printf("used %d (bit %d ref %d ninode %zu) free %u log %u total %d\n", usedblocks,
+         bitblocks, refblocks, ninodes/IPB + 1, freeblock, nlog, nblocks+usedblocks+nlog);
 
   assert(nblocks + usedblocks + nlog == size);
 
@@ -188,6 +188,15 @@ struct taskstate {
   ushort iomb;       // I/O map base address
 };
 
+// Pages of one address space whose TLB entries must be flushed
+// on every CPU using it; see tlbflush().
+#define NTLBBATCH 16
+struct tlbbatch {
+  pde_t *pgdir;
+  int n;                  // > NTLBBATCH: flush the whole TLB
+  uint va[NTLBBATCH];
+};
+
 // PAGEBREAK: 12
 // Gate descriptors for interrupts and traps
 struct gatedesc {
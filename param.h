@@ -1,13 +1,20 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
-#define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
+#define NOFILE       16  // open files per process before its table grows
+#define MAXOFILE   1024  // open files per process: a page of pointers
 #define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
+#define NIRQ         24  // I/O APIC interrupt lines counted per CPU
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data sectors in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define IPUTBLOCKS    3  // blocks iput() writes freeing a file: inode, bitmap, refcount
+#define TRUNCBLOCKS   4  // blocks one itrunc() step writes: those and indirect
+#define LINKBLOCKS    4  // adding a dirent: its block, bitmap, indirect, dir i-node
+#define CREATEBLOCKS (LINKBLOCKS+1)  // dircreate(): and the new i-node
+#define MKDIRBLOCKS  (CREATEBLOCKS+2)  // and the block of "." and "..", its bitmap
+#define UNLINKBLOCKS (2+IPUTBLOCKS)  // dirunlink(): dirent block, dir i-node, iput()
+#define LOGSIZE      (MAXOPBLOCKS*4)  // max data sectors in on-disk log
+#define NBUF         (LOGSIZE+MAXOPBLOCKS)  // size of disk block cache
 
@@ -6,6 +6,8 @@
 #include "fs.h"
 #include "file.h"
 #include "spinlock.h"
+#include "poll.h"
+#include "fcntl.h"
 
 #define PIPESIZE 512
 
@@ -37,10 +39,12 @@ pipealloc(struct file **f0, struct file **f1)
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
   (*f0)->writable = 0;
+  (*f0)->nonblock = 0;
   (*f0)->pipe = p;
   (*f1)->type = FD_PIPE;
   (*f1)->readable = 0;
   (*f1)->writable = 1;
+  (*f1)->nonblock = 0;
   (*f1)->pipe = p;
   return 0;
 
@@ -66,6 +70,7 @@ pipeclose(struct pipe *p, int writable)
     p->readopen = 0;
     wakeup(&p->nwrite);
   }
+  pollwakeup();
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
     kfree((char*)p);
@@ -74,8 +79,10 @@ pipeclose(struct pipe *p, int writable)
 }
 
 //PAGEBREAK: 40
+// If nonblock is set, write as much as fits without sleeping
+// and return the count, or -EAGAIN if the pipe was full.
 int
-pipewrite(struct pipe *p, char *addr, int n)
+pipewrite(struct pipe *p, char *addr, int n, int nonblock)
 {
   int i;
 
@@ -86,18 +93,28 @@ pipewrite(struct pipe *p, char *addr, int n)
         release(&p->lock);
         return -1;
       }
+      if(nonblock){
+        if(i > 0){
+          wakeup(&p->nread);
+          pollwakeup();
+        }
+        release(&p->lock);
+        return i > 0 ? i : -EAGAIN;
+      }
       wakeup(&p->nread);
+      pollwakeup();
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
     p->data[p->nwrite++ % PIPESIZE] = addr[i];
   }
   wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  pollwakeup();
   release(&p->lock);
   return n;
 }
 
 int
-piperead(struct pipe *p, char *addr, int n)
+piperead(struct pipe *p, char *addr, int n, int nonblock)
 {
   int i;
 
@@ -107,6 +124,10 @@ piperead(struct pipe *p, char *addr, int n)
       release(&p->lock);
       return -1;
     }
+    if(nonblock){
+      release(&p->lock);
+      return -EAGAIN;
+    }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
   for(i = 0; i < n; i++){  //DOC: piperead-copy
@@ -115,6 +136,31 @@ piperead(struct pipe *p, char *addr, int n)
     addr[i] = p->data[p->nread++ % PIPESIZE];
   }
   wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  pollwakeup();
   release(&p->lock);
   return i;
 }
+
+// Report readiness of the read end (writable == 0)
+// or the write end of p, for poll().
+int
+pipepoll(struct pipe *p, int writable)
+{
+  int r;
+
+  r = 0;
+  acquire(&p->lock);
+  if(writable){
+    if(p->nwrite < p->nread + PIPESIZE)
+      r |= POLLOUT;
+    if(p->readopen == 0)
+      r |= POLLERR;
+  } else {
+    if(p->nread != p->nwrite)
+      r |= POLLIN;
+    if(p->writeopen == 0)
+      r |= POLLHUP;
+  }
+  release(&p->lock);
+  return r;
+}
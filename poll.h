@@ -0,0 +1,13 @@
+// poll() interface, shared by the kernel and user programs.
+
+struct pollfd {
+  int fd;         // File descriptor to watch (ignored if negative)
+  short events;   // Requested events
+  short revents;  // Returned events
+};
+
+#define POLLIN   0x001  // Data may be read without blocking
+#define POLLOUT  0x004  // Data may be written without blocking
+#define POLLERR  0x008  // Write end of a pipe whose reader is gone
+#define POLLHUP  0x010  // Read end of a pipe whose writer is gone
+#define POLLNVAL 0x020  // fd is not open
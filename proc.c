@@ -48,6 +48,7 @@ found:
   p->state = EMBRYO;
   p->pid = nextpid++;
   release(&ptable.lock);
+  fdinit(p);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
@@ -108,23 +109,58 @@ userinit(void)
   p->state = RUNNABLE;
 }
 
+// Start a kernel process running fn(), which must not return.
+// It has the kernel's mappings only and never enters user space.
+void
+kproc(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kproc");
+  // Have forkret() return to fn rather than trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&ptable.lock);
+  p->state = RUNNABLE;
+  ipiresched();
+  release(&ptable.lock);
+}
+
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
 int
 growproc(int n)
 {
-  uint sz;
+  uint sz, a;
+  struct tlbbatch b;
+  char *pages[NTLBBATCH];
+  int i, k;
   
+  // New mappings need no flush: the TLB does not cache
+  // non-present entries.  Removed ones are shot down page by
+  // page rather than by reloading %cr3, NTLBBATCH at a time,
+  // and freed only after their flush: until then a CPU sharing
+  // the page table can still reach them through its TLB.
   sz = proc->sz;
   if(n > 0){
     if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
       return -1;
   } else if(n < 0){
-    if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
+    if(sz + n > sz)
       return -1;
+    a = PGROUNDUP(sz + n);
+    while(a < sz){
+      tlbstart(&b, proc->pgdir);
+      k = unmapuvm(proc->pgdir, &a, sz, pages, NTLBBATCH, &b);
+      tlbflush(&b);
+      for(i = 0; i < k; i++)
+        kfree(pages[i]);
+    }
+    sz += n;
   }
   proc->sz = sz;
-  switchuvm(proc);
   return 0;
 }
 
@@ -134,7 +170,7 @@ growproc(int n)
 int
 fork(void)
 {
-  int i, pid;
+  int pid;
   struct proc *np;
 
   // Allocate process.
@@ -155,9 +191,13 @@ fork(void)
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(proc->ofile[i])
-      np->ofile[i] = filedup(proc->ofile[i]);
+  if(fdcopy(np) < 0){
+    freevm(np->pgdir);
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
   np->cwd = idup(proc->cwd);
 
   safestrcpy(np->name, proc->name, sizeof(proc->name));
@@ -167,6 +207,7 @@ fork(void)
   // lock to force the compiler to emit the np->state write last.
   acquire(&ptable.lock);
   np->state = RUNNABLE;
+  ipiresched();
   release(&ptable.lock);
   
   return pid;
@@ -179,20 +220,16 @@ void
 exit(void)
 {
   struct proc *p;
-  int fd;
 
   if(proc == initproc)
     panic("init exiting");
+  if(proc->killed)
+    proc->xstate = -1;
 
   // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
-    if(proc->ofile[fd]){
-      fileclose(proc->ofile[fd]);
-      proc->ofile[fd] = 0;
-    }
-  }
+  fdcloseall();
 
-  begin_op();
+  begin_op(IPUTBLOCKS);
   iput(proc->cwd);
   end_op();
   proc->cwd = 0;
@@ -220,7 +257,7 @@ exit(void)
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
 int
-wait(void)
+wait(int *status)
 {
   struct proc *p;
   int havekids, pid;
@@ -236,6 +273,8 @@ wait(void)
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
+        if(status)
+          *status = p->xstate;
         kfree(p->kstack);
         p->kstack = 0;
         freevm(p->pgdir);
@@ -244,6 +283,7 @@ wait(void)
         p->parent = 0;
         p->name[0] = 0;
         p->killed = 0;
+        p->xstate = 0;
         release(&ptable.lock);
         return pid;
       }
@@ -279,6 +319,7 @@ scheduler(void)
 
     // Loop over process table looking for process to run.
     acquire(&ptable.lock);
+    cpu->idle = 1;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
       if(p->state != RUNNABLE)
         continue;
@@ -289,8 +330,10 @@ scheduler(void)
       proc = p;
       switchuvm(p);
       p->state = RUNNING;
+      cpu->idle = 0;
       swtch(&cpu->scheduler, proc->context);  // swtch.S 内にこの関数swtchが定義されている
       switchkvm();
+      cpu->pgdir = 0;
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
@@ -298,6 +341,13 @@ scheduler(void)
     }
     release(&ptable.lock);
 
+    // Nothing was runnable: halt until an interrupt instead of
+    // spinning.  wakeup() clears idle and sends a reschedule IPI;
+    // testing idle with interrupts off means an IPI sent after
+    // the test is still pending at the hlt and ends it.
+    cli();
+    if(cpu->idle)
+      stihlt();
   }
 }
 
@@ -346,6 +396,8 @@ forkret(void)
     // be run from main().
     first = 0;
     initlog();
+    ireclaim(ROOTDEV);
+    kproc("reclaim", reclaimer);
   }
   
   // Return to "caller", actually trapret (see allocproc).
@@ -397,8 +449,10 @@ wakeup1(void *chan)
   struct proc *p;
 
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
+    if(p->state == SLEEPING && p->chan == chan){
       p->state = RUNNABLE;
+      ipiresched();
+    }
 }
 
 // Wake up all processes sleeping on chan.
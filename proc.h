@@ -10,6 +10,14 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
+  uint nirq[NIRQ];             // Interrupts taken, by IRQ line
+  uint softirq;                // Pending softirqs (bitmask)
+  int insoftirq;               // Running softirq handlers?
+  uint nsoftirq;               // Softirq handlers run
+  uint clistart;               // rdtsc() when interrupts were last turned off
+  uint maxcli;                 // Longest interrupts-off stretch, in cycles
+  volatile int idle;           // Halted in scheduler; kick with ipiresched()
+  pde_t *pgdir;                // Page table loaded in %cr3 (0 if kpgdir)
   
   // Cpu-local storage variables; see below
   struct cpu *cpu;
@@ -27,8 +35,15 @@ extern int ncpu;
 // holding those two variables in the local cpu's struct cpu.
 // This is similar to how thread-local variables are implemented
 // in thread libraries such as Linux pthreads.
+// The host build of the file system (see hostfs.c) has no %gs
+// and uses thread-local variables instead.
+#ifdef HOSTFS
+extern __thread struct cpu *cpu;
+extern __thread struct proc *proc;
+#else
 extern struct cpu *cpu asm("%gs:0");       // &cpus[cpunum()]
 extern struct proc *proc asm("%gs:4");     // cpus[cpunum()].proc
+#endif
 
 //PAGEBREAK: 17
 // Saved registers for kernel context switches.
@@ -63,8 +78,13 @@ struct proc {
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
+  int xstate;                  // Exit status, for waitstatus()
+  struct file **ofile;         // Open files: ofile0 or a page
+  int nofile;                  // Size of ofile
+  uint fdmap[MAXOFILE/32];     // Bit set for each descriptor in use
+  struct file *ofile0[NOFILE]; // Table a process starts with
   struct inode *cwd;           // Current directory
+  int logres;                  // Log blocks reserved by begin_op(), unused
   char name[16];               // Process name (debugging)
 };
 
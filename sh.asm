@@ -0,0 +1,5159 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <runcmd>:
+
+// Execute cmd.  Never returns; exits with the status of the
+// last command run (the right end of a pipe or list).
+void
+runcmd(struct cmd *cmd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 48             	sub    $0x48,%esp
+  struct parcmd *prcmd;
+  struct cmd *c;
+  int i, n;
+  uint t0;
+
+  if(cmd == 0)
+       6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+       a:	75 05                	jne    11 <runcmd+0x11>
+    exit();
+       c:	e8 14 25 00 00       	call   2525 <exit>
+  status = 0;
+      11:	c7 45 b8 00 00 00 00 	movl   $0x0,-0x48(%ebp)
+  
+  switch(cmd->type){
+      18:	8b 45 08             	mov    0x8(%ebp),%eax
+      1b:	8b 00                	mov    (%eax),%eax
+      1d:	83 f8 07             	cmp    $0x7,%eax
+      20:	77 09                	ja     2b <runcmd+0x2b>
+      22:	8b 04 85 14 2b 00 00 	mov    0x2b14(,%eax,4),%eax
+      29:	ff e0                	jmp    *%eax
+  default:
+    panic("runcmd");
+      2b:	83 ec 0c             	sub    $0xc,%esp
+      2e:	68 d8 2a 00 00       	push   $0x2ad8
+      33:	e8 4d 17 00 00       	call   1785 <panic>
+      38:	83 c4 10             	add    $0x10,%esp
+
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+      3b:	8b 45 08             	mov    0x8(%ebp),%eax
+      3e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    if(ecmd->argv[0] == 0)
+      41:	8b 45 c8             	mov    -0x38(%ebp),%eax
+      44:	8b 40 04             	mov    0x4(%eax),%eax
+      47:	85 c0                	test   %eax,%eax
+      49:	75 05                	jne    50 <runcmd+0x50>
+      exit();
+      4b:	e8 d5 24 00 00       	call   2525 <exit>
+    exec(ecmd->argv[0], ecmd->argv);
+      50:	8b 45 c8             	mov    -0x38(%ebp),%eax
+      53:	8d 50 04             	lea    0x4(%eax),%edx
+      56:	8b 45 c8             	mov    -0x38(%ebp),%eax
+      59:	8b 40 04             	mov    0x4(%eax),%eax
+      5c:	83 ec 08             	sub    $0x8,%esp
+      5f:	52                   	push   %edx
+      60:	50                   	push   %eax
+      61:	e8 f7 24 00 00       	call   255d <exec>
+      66:	83 c4 10             	add    $0x10,%esp
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      69:	8b 45 c8             	mov    -0x38(%ebp),%eax
+      6c:	8b 40 04             	mov    0x4(%eax),%eax
+      6f:	83 ec 04             	sub    $0x4,%esp
+      72:	50                   	push   %eax
+      73:	68 df 2a 00 00       	push   $0x2adf
+      78:	6a 02                	push   $0x2
+      7a:	e8 a2 26 00 00       	call   2721 <printf>
+      7f:	83 c4 10             	add    $0x10,%esp
+    status = 1;
+      82:	c7 45 b8 01 00 00 00 	movl   $0x1,-0x48(%ebp)
+    break;
+      89:	e9 04 03 00 00       	jmp    392 <runcmd+0x392>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+      8e:	8b 45 08             	mov    0x8(%ebp),%eax
+      91:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    close(rcmd->fd);
+      94:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      97:	8b 40 14             	mov    0x14(%eax),%eax
+      9a:	83 ec 0c             	sub    $0xc,%esp
+      9d:	50                   	push   %eax
+      9e:	e8 aa 24 00 00       	call   254d <close>
+      a3:	83 c4 10             	add    $0x10,%esp
+    if(open(rcmd->file, rcmd->mode) < 0){
+      a6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      a9:	8b 50 10             	mov    0x10(%eax),%edx
+      ac:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      af:	8b 40 08             	mov    0x8(%eax),%eax
+      b2:	83 ec 08             	sub    $0x8,%esp
+      b5:	52                   	push   %edx
+      b6:	50                   	push   %eax
+      b7:	e8 a9 24 00 00       	call   2565 <open>
+      bc:	83 c4 10             	add    $0x10,%esp
+      bf:	85 c0                	test   %eax,%eax
+      c1:	79 23                	jns    e6 <runcmd+0xe6>
+      printf(2, "open %s failed\n", rcmd->file);
+      c3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      c6:	8b 40 08             	mov    0x8(%eax),%eax
+      c9:	83 ec 04             	sub    $0x4,%esp
+      cc:	50                   	push   %eax
+      cd:	68 ef 2a 00 00       	push   $0x2aef
+      d2:	6a 02                	push   $0x2
+      d4:	e8 48 26 00 00       	call   2721 <printf>
+      d9:	83 c4 10             	add    $0x10,%esp
+      exits(1);
+      dc:	83 ec 0c             	sub    $0xc,%esp
+      df:	6a 01                	push   $0x1
+      e1:	e8 37 25 00 00       	call   261d <exits>
+    }
+    runcmd(rcmd->cmd);
+      e6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+      e9:	8b 40 04             	mov    0x4(%eax),%eax
+      ec:	83 ec 0c             	sub    $0xc,%esp
+      ef:	50                   	push   %eax
+      f0:	e8 0b ff ff ff       	call   0 <runcmd>
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+      f5:	8b 45 08             	mov    0x8(%ebp),%eax
+      f8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(fork1() == 0)
+      fb:	e8 a5 16 00 00       	call   17a5 <fork1>
+     100:	85 c0                	test   %eax,%eax
+     102:	75 0f                	jne    113 <runcmd+0x113>
+      runcmd(lcmd->left);
+     104:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     107:	8b 40 04             	mov    0x4(%eax),%eax
+     10a:	83 ec 0c             	sub    $0xc,%esp
+     10d:	50                   	push   %eax
+     10e:	e8 ed fe ff ff       	call   0 <runcmd>
+    wait();
+     113:	e8 15 24 00 00       	call   252d <wait>
+    runcmd(lcmd->right);
+     118:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     11b:	8b 40 08             	mov    0x8(%eax),%eax
+     11e:	83 ec 0c             	sub    $0xc,%esp
+     121:	50                   	push   %eax
+     122:	e8 d9 fe ff ff       	call   0 <runcmd>
+    break;
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     127:	8b 45 08             	mov    0x8(%ebp),%eax
+     12a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    if(pipe(p) < 0)
+     12d:	83 ec 0c             	sub    $0xc,%esp
+     130:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     133:	50                   	push   %eax
+     134:	e8 fc 23 00 00       	call   2535 <pipe>
+     139:	83 c4 10             	add    $0x10,%esp
+     13c:	85 c0                	test   %eax,%eax
+     13e:	79 10                	jns    150 <runcmd+0x150>
+      panic("pipe");
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 ff 2a 00 00       	push   $0x2aff
+     148:	e8 38 16 00 00       	call   1785 <panic>
+     14d:	83 c4 10             	add    $0x10,%esp
+    if(fork1() == 0){
+     150:	e8 50 16 00 00       	call   17a5 <fork1>
+     155:	85 c0                	test   %eax,%eax
+     157:	75 49                	jne    1a2 <runcmd+0x1a2>
+      close(1);
+     159:	83 ec 0c             	sub    $0xc,%esp
+     15c:	6a 01                	push   $0x1
+     15e:	e8 ea 23 00 00       	call   254d <close>
+     163:	83 c4 10             	add    $0x10,%esp
+      dup(p[1]);
+     166:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	50                   	push   %eax
+     16d:	e8 2b 24 00 00       	call   259d <dup>
+     172:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     175:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     178:	83 ec 0c             	sub    $0xc,%esp
+     17b:	50                   	push   %eax
+     17c:	e8 cc 23 00 00       	call   254d <close>
+     181:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     184:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     187:	83 ec 0c             	sub    $0xc,%esp
+     18a:	50                   	push   %eax
+     18b:	e8 bd 23 00 00       	call   254d <close>
+     190:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->left);
+     193:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     196:	8b 40 04             	mov    0x4(%eax),%eax
+     199:	83 ec 0c             	sub    $0xc,%esp
+     19c:	50                   	push   %eax
+     19d:	e8 5e fe ff ff       	call   0 <runcmd>
+    }
+    if((pid = fork1()) == 0){
+     1a2:	e8 fe 15 00 00       	call   17a5 <fork1>
+     1a7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     1aa:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+     1ae:	75 49                	jne    1f9 <runcmd+0x1f9>
+      close(0);
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	6a 00                	push   $0x0
+     1b5:	e8 93 23 00 00       	call   254d <close>
+     1ba:	83 c4 10             	add    $0x10,%esp
+      dup(p[0]);
+     1bd:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     1c0:	83 ec 0c             	sub    $0xc,%esp
+     1c3:	50                   	push   %eax
+     1c4:	e8 d4 23 00 00       	call   259d <dup>
+     1c9:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     1cc:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     1cf:	83 ec 0c             	sub    $0xc,%esp
+     1d2:	50                   	push   %eax
+     1d3:	e8 75 23 00 00       	call   254d <close>
+     1d8:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     1db:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     1de:	83 ec 0c             	sub    $0xc,%esp
+     1e1:	50                   	push   %eax
+     1e2:	e8 66 23 00 00       	call   254d <close>
+     1e7:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->right);
+     1ea:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     1ed:	8b 40 08             	mov    0x8(%eax),%eax
+     1f0:	83 ec 0c             	sub    $0xc,%esp
+     1f3:	50                   	push   %eax
+     1f4:	e8 07 fe ff ff       	call   0 <runcmd>
+    }
+    close(p[0]);
+     1f9:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     1fc:	83 ec 0c             	sub    $0xc,%esp
+     1ff:	50                   	push   %eax
+     200:	e8 48 23 00 00       	call   254d <close>
+     205:	83 c4 10             	add    $0x10,%esp
+    close(p[1]);
+     208:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     20b:	83 ec 0c             	sub    $0xc,%esp
+     20e:	50                   	push   %eax
+     20f:	e8 39 23 00 00       	call   254d <close>
+     214:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 2; i++)
+     217:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     21e:	eb 1e                	jmp    23e <runcmd+0x23e>
+      if(waitstatus(&st) == pid)
+     220:	83 ec 0c             	sub    $0xc,%esp
+     223:	8d 45 bc             	lea    -0x44(%ebp),%eax
+     226:	50                   	push   %eax
+     227:	e8 f9 23 00 00       	call   2625 <waitstatus>
+     22c:	83 c4 10             	add    $0x10,%esp
+     22f:	39 45 d0             	cmp    %eax,-0x30(%ebp)
+     232:	75 06                	jne    23a <runcmd+0x23a>
+        status = st;
+     234:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     237:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    for(i = 0; i < 2; i++)
+     23a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     23e:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+     242:	7e dc                	jle    220 <runcmd+0x220>
+    break;
+     244:	e9 49 01 00 00       	jmp    392 <runcmd+0x392>
+    
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     249:	8b 45 08             	mov    0x8(%ebp),%eax
+     24c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(fork1() == 0)
+     24f:	e8 51 15 00 00       	call   17a5 <fork1>
+     254:	85 c0                	test   %eax,%eax
+     256:	0f 85 35 01 00 00    	jne    391 <runcmd+0x391>
+      runcmd(bcmd->cmd);
+     25c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     25f:	8b 40 04             	mov    0x4(%eax),%eax
+     262:	83 ec 0c             	sub    $0xc,%esp
+     265:	50                   	push   %eax
+     266:	e8 95 fd ff ff       	call   0 <runcmd>
+    break;
+
+  case TIME:
+    tcmd = (struct timecmd*)cmd;
+     26b:	8b 45 08             	mov    0x8(%ebp),%eax
+     26e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    t0 = uptime();
+     271:	e8 47 23 00 00       	call   25bd <uptime>
+     276:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    if(fork1() == 0)
+     279:	e8 27 15 00 00       	call   17a5 <fork1>
+     27e:	85 c0                	test   %eax,%eax
+     280:	75 0f                	jne    291 <runcmd+0x291>
+      runcmd(tcmd->cmd);
+     282:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     285:	8b 40 04             	mov    0x4(%eax),%eax
+     288:	83 ec 0c             	sub    $0xc,%esp
+     28b:	50                   	push   %eax
+     28c:	e8 6f fd ff ff       	call   0 <runcmd>
+    waitstatus(&status);
+     291:	83 ec 0c             	sub    $0xc,%esp
+     294:	8d 45 b8             	lea    -0x48(%ebp),%eax
+     297:	50                   	push   %eax
+     298:	e8 88 23 00 00       	call   2625 <waitstatus>
+     29d:	83 c4 10             	add    $0x10,%esp
+    printf(2, "real %d ticks\n", uptime() - t0);
+     2a0:	e8 18 23 00 00       	call   25bd <uptime>
+     2a5:	2b 45 dc             	sub    -0x24(%ebp),%eax
+     2a8:	83 ec 04             	sub    $0x4,%esp
+     2ab:	50                   	push   %eax
+     2ac:	68 04 2b 00 00       	push   $0x2b04
+     2b1:	6a 02                	push   $0x2
+     2b3:	e8 69 24 00 00       	call   2721 <printf>
+     2b8:	83 c4 10             	add    $0x10,%esp
+    break;
+     2bb:	e9 d2 00 00 00       	jmp    392 <runcmd+0x392>
+
+  case PAR:
+    prcmd = (struct parcmd*)cmd;
+     2c0:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    n = 0;
+     2c6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    if(prcmd->n > 0){
+     2cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     2d0:	8b 40 04             	mov    0x4(%eax),%eax
+     2d3:	85 c0                	test   %eax,%eax
+     2d5:	7e 2b                	jle    302 <runcmd+0x302>
+      for(; n < prcmd->n; n++)
+     2d7:	eb 1c                	jmp    2f5 <runcmd+0x2f5>
+        if(fork1() == 0)
+     2d9:	e8 c7 14 00 00       	call   17a5 <fork1>
+     2de:	85 c0                	test   %eax,%eax
+     2e0:	75 0f                	jne    2f1 <runcmd+0x2f1>
+          runcmd(prcmd->cmd);
+     2e2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     2e5:	8b 40 08             	mov    0x8(%eax),%eax
+     2e8:	83 ec 0c             	sub    $0xc,%esp
+     2eb:	50                   	push   %eax
+     2ec:	e8 0f fd ff ff       	call   0 <runcmd>
+      for(; n < prcmd->n; n++)
+     2f1:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     2f5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     2f8:	8b 40 04             	mov    0x4(%eax),%eax
+     2fb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     2fe:	7c d9                	jl     2d9 <runcmd+0x2d9>
+     300:	eb 58                	jmp    35a <runcmd+0x35a>
+    } else {
+      for(c = prcmd->cmd; c->type == LIST; c = lcmd->right){
+     302:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     305:	8b 40 08             	mov    0x8(%eax),%eax
+     308:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     30b:	eb 2b                	jmp    338 <runcmd+0x338>
+        lcmd = (struct listcmd*)c;
+     30d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     310:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+        if(fork1() == 0)
+     313:	e8 8d 14 00 00       	call   17a5 <fork1>
+     318:	85 c0                	test   %eax,%eax
+     31a:	75 0f                	jne    32b <runcmd+0x32b>
+          runcmd(lcmd->left);
+     31c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     31f:	8b 40 04             	mov    0x4(%eax),%eax
+     322:	83 ec 0c             	sub    $0xc,%esp
+     325:	50                   	push   %eax
+     326:	e8 d5 fc ff ff       	call   0 <runcmd>
+        n++;
+     32b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+      for(c = prcmd->cmd; c->type == LIST; c = lcmd->right){
+     32f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     332:	8b 40 08             	mov    0x8(%eax),%eax
+     335:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     33b:	8b 00                	mov    (%eax),%eax
+     33d:	83 f8 04             	cmp    $0x4,%eax
+     340:	74 cb                	je     30d <runcmd+0x30d>
+      }
+      if(fork1() == 0)
+     342:	e8 5e 14 00 00       	call   17a5 <fork1>
+     347:	85 c0                	test   %eax,%eax
+     349:	75 0b                	jne    356 <runcmd+0x356>
+        runcmd(c);
+     34b:	83 ec 0c             	sub    $0xc,%esp
+     34e:	ff 75 f4             	push   -0xc(%ebp)
+     351:	e8 aa fc ff ff       	call   0 <runcmd>
+      n++;
+     356:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    }
+    // Fail if any of them did.
+    for(i = 0; i < n; i++)
+     35a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     361:	eb 24                	jmp    387 <runcmd+0x387>
+      if(waitstatus(&st) >= 0 && st != 0)
+     363:	83 ec 0c             	sub    $0xc,%esp
+     366:	8d 45 bc             	lea    -0x44(%ebp),%eax
+     369:	50                   	push   %eax
+     36a:	e8 b6 22 00 00       	call   2625 <waitstatus>
+     36f:	83 c4 10             	add    $0x10,%esp
+     372:	85 c0                	test   %eax,%eax
+     374:	78 0d                	js     383 <runcmd+0x383>
+     376:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     379:	85 c0                	test   %eax,%eax
+     37b:	74 06                	je     383 <runcmd+0x383>
+        status = st;
+     37d:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     380:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    for(i = 0; i < n; i++)
+     383:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     387:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     38a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     38d:	7c d4                	jl     363 <runcmd+0x363>
+    break;
+     38f:	eb 01                	jmp    392 <runcmd+0x392>
+    break;
+     391:	90                   	nop
+  }
+  exits(status);
+     392:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     395:	83 ec 0c             	sub    $0xc,%esp
+     398:	50                   	push   %eax
+     399:	e8 7f 22 00 00       	call   261d <exits>
+
+0000039e <getvar>:
+int infd;         // Commands come from here
+int interactive;  // Prompt for input?
+
+char*
+getvar(char *name)
+{
+     39e:	55                   	push   %ebp
+     39f:	89 e5                	mov    %esp,%ebp
+     3a1:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < NVAR; i++)
+     3a4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     3ab:	eb 59                	jmp    406 <getvar+0x68>
+    if(vars[i].name[0] && strcmp(vars[i].name, name) == 0)
+     3ad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     3b0:	89 d0                	mov    %edx,%eax
+     3b2:	c1 e0 03             	shl    $0x3,%eax
+     3b5:	01 d0                	add    %edx,%eax
+     3b7:	c1 e0 04             	shl    $0x4,%eax
+     3ba:	05 60 34 00 00       	add    $0x3460,%eax
+     3bf:	0f b6 00             	movzbl (%eax),%eax
+     3c2:	84 c0                	test   %al,%al
+     3c4:	74 3c                	je     402 <getvar+0x64>
+     3c6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     3c9:	89 d0                	mov    %edx,%eax
+     3cb:	c1 e0 03             	shl    $0x3,%eax
+     3ce:	01 d0                	add    %edx,%eax
+     3d0:	c1 e0 04             	shl    $0x4,%eax
+     3d3:	05 60 34 00 00       	add    $0x3460,%eax
+     3d8:	83 ec 08             	sub    $0x8,%esp
+     3db:	ff 75 08             	push   0x8(%ebp)
+     3de:	50                   	push   %eax
+     3df:	e8 02 1f 00 00       	call   22e6 <strcmp>
+     3e4:	83 c4 10             	add    $0x10,%esp
+     3e7:	85 c0                	test   %eax,%eax
+     3e9:	75 17                	jne    402 <getvar+0x64>
+      return vars[i].val;
+     3eb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     3ee:	89 d0                	mov    %edx,%eax
+     3f0:	c1 e0 03             	shl    $0x3,%eax
+     3f3:	01 d0                	add    %edx,%eax
+     3f5:	c1 e0 04             	shl    $0x4,%eax
+     3f8:	83 c0 10             	add    $0x10,%eax
+     3fb:	05 60 34 00 00       	add    $0x3460,%eax
+     400:	eb 0f                	jmp    411 <getvar+0x73>
+  for(i = 0; i < NVAR; i++)
+     402:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     406:	83 7d f4 1f          	cmpl   $0x1f,-0xc(%ebp)
+     40a:	7e a1                	jle    3ad <getvar+0xf>
+  return "";
+     40c:	b8 34 2b 00 00       	mov    $0x2b34,%eax
+}
+     411:	c9                   	leave
+     412:	c3                   	ret
+
+00000413 <setvar>:
+
+void
+setvar(char *name, char *val)
+{
+     413:	55                   	push   %ebp
+     414:	89 e5                	mov    %esp,%ebp
+     416:	83 ec 18             	sub    $0x18,%esp
+  struct var *v, *unused;
+
+  unused = 0;
+     419:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(v = vars; v < vars+NVAR; v++){
+     420:	c7 45 f4 60 34 00 00 	movl   $0x3460,-0xc(%ebp)
+     427:	eb 3d                	jmp    466 <setvar+0x53>
+    if(v->name[0] && strcmp(v->name, name) == 0)
+     429:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     42c:	0f b6 00             	movzbl (%eax),%eax
+     42f:	84 c0                	test   %al,%al
+     431:	74 16                	je     449 <setvar+0x36>
+     433:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     436:	83 ec 08             	sub    $0x8,%esp
+     439:	ff 75 08             	push   0x8(%ebp)
+     43c:	50                   	push   %eax
+     43d:	e8 a4 1e 00 00       	call   22e6 <strcmp>
+     442:	83 c4 10             	add    $0x10,%esp
+     445:	85 c0                	test   %eax,%eax
+     447:	74 29                	je     472 <setvar+0x5f>
+      break;
+    if(!v->name[0] && !unused)
+     449:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     44c:	0f b6 00             	movzbl (%eax),%eax
+     44f:	84 c0                	test   %al,%al
+     451:	75 0c                	jne    45f <setvar+0x4c>
+     453:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     457:	75 06                	jne    45f <setvar+0x4c>
+      unused = v;
+     459:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     45c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(v = vars; v < vars+NVAR; v++){
+     45f:	81 45 f4 90 00 00 00 	addl   $0x90,-0xc(%ebp)
+     466:	b8 60 46 00 00       	mov    $0x4660,%eax
+     46b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     46e:	72 b9                	jb     429 <setvar+0x16>
+     470:	eb 01                	jmp    473 <setvar+0x60>
+      break;
+     472:	90                   	nop
+  }
+  if(v == vars+NVAR && (v = unused) == 0){
+     473:	b8 60 46 00 00       	mov    $0x4660,%eax
+     478:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     47b:	75 20                	jne    49d <setvar+0x8a>
+     47d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     480:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     483:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     487:	75 14                	jne    49d <setvar+0x8a>
+    printf(2, "sh: too many variables\n");
+     489:	83 ec 08             	sub    $0x8,%esp
+     48c:	68 35 2b 00 00       	push   $0x2b35
+     491:	6a 02                	push   $0x2
+     493:	e8 89 22 00 00       	call   2721 <printf>
+     498:	83 c4 10             	add    $0x10,%esp
+    return;
+     49b:	eb 64                	jmp    501 <setvar+0xee>
+  }
+  if(strlen(name) >= sizeof(v->name) || strlen(val) >= sizeof(v->val)){
+     49d:	83 ec 0c             	sub    $0xc,%esp
+     4a0:	ff 75 08             	push   0x8(%ebp)
+     4a3:	e8 7d 1e 00 00       	call   2325 <strlen>
+     4a8:	83 c4 10             	add    $0x10,%esp
+     4ab:	83 f8 0f             	cmp    $0xf,%eax
+     4ae:	77 13                	ja     4c3 <setvar+0xb0>
+     4b0:	83 ec 0c             	sub    $0xc,%esp
+     4b3:	ff 75 0c             	push   0xc(%ebp)
+     4b6:	e8 6a 1e 00 00       	call   2325 <strlen>
+     4bb:	83 c4 10             	add    $0x10,%esp
+     4be:	83 f8 7f             	cmp    $0x7f,%eax
+     4c1:	76 17                	jbe    4da <setvar+0xc7>
+    printf(2, "sh: variable %s too long\n", name);
+     4c3:	83 ec 04             	sub    $0x4,%esp
+     4c6:	ff 75 08             	push   0x8(%ebp)
+     4c9:	68 4d 2b 00 00       	push   $0x2b4d
+     4ce:	6a 02                	push   $0x2
+     4d0:	e8 4c 22 00 00       	call   2721 <printf>
+     4d5:	83 c4 10             	add    $0x10,%esp
+    return;
+     4d8:	eb 27                	jmp    501 <setvar+0xee>
+  }
+  strcpy(v->name, name);
+     4da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4dd:	83 ec 08             	sub    $0x8,%esp
+     4e0:	ff 75 08             	push   0x8(%ebp)
+     4e3:	50                   	push   %eax
+     4e4:	e8 cd 1d 00 00       	call   22b6 <strcpy>
+     4e9:	83 c4 10             	add    $0x10,%esp
+  strcpy(v->val, val);
+     4ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ef:	83 c0 10             	add    $0x10,%eax
+     4f2:	83 ec 08             	sub    $0x8,%esp
+     4f5:	ff 75 0c             	push   0xc(%ebp)
+     4f8:	50                   	push   %eax
+     4f9:	e8 b8 1d 00 00       	call   22b6 <strcpy>
+     4fe:	83 c4 10             	add    $0x10,%esp
+}
+     501:	c9                   	leave
+     502:	c3                   	ret
+
+00000503 <isnamec>:
+
+int
+isnamec(int c, int first)
+{
+     503:	55                   	push   %ebp
+     504:	89 e5                	mov    %esp,%ebp
+  return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+     506:	83 7d 08 5f          	cmpl   $0x5f,0x8(%ebp)
+     50a:	74 2a                	je     536 <isnamec+0x33>
+     50c:	83 7d 08 60          	cmpl   $0x60,0x8(%ebp)
+     510:	7e 06                	jle    518 <isnamec+0x15>
+     512:	83 7d 08 7a          	cmpl   $0x7a,0x8(%ebp)
+     516:	7e 1e                	jle    536 <isnamec+0x33>
+     518:	83 7d 08 40          	cmpl   $0x40,0x8(%ebp)
+     51c:	7e 06                	jle    524 <isnamec+0x21>
+     51e:	83 7d 08 5a          	cmpl   $0x5a,0x8(%ebp)
+     522:	7e 12                	jle    536 <isnamec+0x33>
+     524:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     528:	75 13                	jne    53d <isnamec+0x3a>
+    (!first && c >= '0' && c <= '9');
+     52a:	83 7d 08 2f          	cmpl   $0x2f,0x8(%ebp)
+     52e:	7e 0d                	jle    53d <isnamec+0x3a>
+     530:	83 7d 08 39          	cmpl   $0x39,0x8(%ebp)
+     534:	7f 07                	jg     53d <isnamec+0x3a>
+  return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+     536:	b8 01 00 00 00       	mov    $0x1,%eax
+     53b:	eb 05                	jmp    542 <isnamec+0x3f>
+     53d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     542:	5d                   	pop    %ebp
+     543:	c3                   	ret
+
+00000544 <getname>:
+
+// Copy a variable name from *ps to name and advance *ps.
+void
+getname(char **ps, char *name, int n)
+{
+     544:	55                   	push   %ebp
+     545:	89 e5                	mov    %esp,%ebp
+     547:	83 ec 10             	sub    $0x10,%esp
+  char *s;
+  int i;
+
+  s = *ps;
+     54a:	8b 45 08             	mov    0x8(%ebp),%eax
+     54d:	8b 00                	mov    (%eax),%eax
+     54f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  for(i = 0; isnamec(*s, i == 0); s++)
+     552:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+     559:	eb 27                	jmp    582 <getname+0x3e>
+    if(i < n-1)
+     55b:	8b 45 10             	mov    0x10(%ebp),%eax
+     55e:	83 e8 01             	sub    $0x1,%eax
+     561:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     564:	7d 18                	jge    57e <getname+0x3a>
+      name[i++] = *s;
+     566:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     569:	8d 50 01             	lea    0x1(%eax),%edx
+     56c:	89 55 f8             	mov    %edx,-0x8(%ebp)
+     56f:	89 c2                	mov    %eax,%edx
+     571:	8b 45 0c             	mov    0xc(%ebp),%eax
+     574:	01 c2                	add    %eax,%edx
+     576:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     579:	0f b6 00             	movzbl (%eax),%eax
+     57c:	88 02                	mov    %al,(%edx)
+  for(i = 0; isnamec(*s, i == 0); s++)
+     57e:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     582:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+     586:	0f 94 c0             	sete   %al
+     589:	0f b6 d0             	movzbl %al,%edx
+     58c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     58f:	0f b6 00             	movzbl (%eax),%eax
+     592:	0f be c0             	movsbl %al,%eax
+     595:	52                   	push   %edx
+     596:	50                   	push   %eax
+     597:	e8 67 ff ff ff       	call   503 <isnamec>
+     59c:	83 c4 08             	add    $0x8,%esp
+     59f:	85 c0                	test   %eax,%eax
+     5a1:	75 b8                	jne    55b <getname+0x17>
+  name[i] = 0;
+     5a3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     5a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5a9:	01 d0                	add    %edx,%eax
+     5ab:	c6 00 00             	movb   $0x0,(%eax)
+  *ps = s;
+     5ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     5b4:	89 10                	mov    %edx,(%eax)
+}
+     5b6:	90                   	nop
+     5b7:	c9                   	leave
+     5b8:	c3                   	ret
+
+000005b9 <itoa>:
+
+// Put the decimal form of x in buf.
+char*
+itoa(int x, char *buf)
+{
+     5b9:	55                   	push   %ebp
+     5ba:	89 e5                	mov    %esp,%ebp
+     5bc:	83 ec 20             	sub    $0x20,%esp
+  char tmp[12];
+  int i, neg;
+
+  neg = x < 0;
+     5bf:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c2:	c1 e8 1f             	shr    $0x1f,%eax
+     5c5:	0f b6 c0             	movzbl %al,%eax
+     5c8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  if(neg)
+     5cb:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+     5cf:	74 03                	je     5d4 <itoa+0x1b>
+    x = -x;
+     5d1:	f7 5d 08             	negl   0x8(%ebp)
+  i = 0;
+     5d4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  do {
+    tmp[i++] = '0' + x % 10;
+     5db:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     5de:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     5e3:	89 c8                	mov    %ecx,%eax
+     5e5:	f7 ea                	imul   %edx
+     5e7:	c1 fa 02             	sar    $0x2,%edx
+     5ea:	89 c8                	mov    %ecx,%eax
+     5ec:	c1 f8 1f             	sar    $0x1f,%eax
+     5ef:	29 c2                	sub    %eax,%edx
+     5f1:	89 d0                	mov    %edx,%eax
+     5f3:	c1 e0 02             	shl    $0x2,%eax
+     5f6:	01 d0                	add    %edx,%eax
+     5f8:	01 c0                	add    %eax,%eax
+     5fa:	29 c1                	sub    %eax,%ecx
+     5fc:	89 ca                	mov    %ecx,%edx
+     5fe:	89 d0                	mov    %edx,%eax
+     600:	8d 48 30             	lea    0x30(%eax),%ecx
+     603:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     606:	8d 50 01             	lea    0x1(%eax),%edx
+     609:	89 55 fc             	mov    %edx,-0x4(%ebp)
+     60c:	89 ca                	mov    %ecx,%edx
+     60e:	88 54 05 ec          	mov    %dl,-0x14(%ebp,%eax,1)
+    x /= 10;
+     612:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     615:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     61a:	89 c8                	mov    %ecx,%eax
+     61c:	f7 ea                	imul   %edx
+     61e:	89 d0                	mov    %edx,%eax
+     620:	c1 f8 02             	sar    $0x2,%eax
+     623:	c1 f9 1f             	sar    $0x1f,%ecx
+     626:	89 ca                	mov    %ecx,%edx
+     628:	29 d0                	sub    %edx,%eax
+     62a:	89 45 08             	mov    %eax,0x8(%ebp)
+  } while(x > 0);
+     62d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     631:	7f a8                	jg     5db <itoa+0x22>
+  if(neg)
+     633:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+     637:	74 0e                	je     647 <itoa+0x8e>
+    tmp[i++] = '-';
+     639:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     63c:	8d 50 01             	lea    0x1(%eax),%edx
+     63f:	89 55 fc             	mov    %edx,-0x4(%ebp)
+     642:	c6 44 05 ec 2d       	movb   $0x2d,-0x14(%ebp,%eax,1)
+  for(neg = 0; i > 0; )
+     647:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+     64e:	eb 21                	jmp    671 <itoa+0xb8>
+    buf[neg++] = tmp[--i];
+     650:	83 6d fc 01          	subl   $0x1,-0x4(%ebp)
+     654:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     657:	8d 50 01             	lea    0x1(%eax),%edx
+     65a:	89 55 f8             	mov    %edx,-0x8(%ebp)
+     65d:	89 c2                	mov    %eax,%edx
+     65f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     662:	01 c2                	add    %eax,%edx
+     664:	8d 4d ec             	lea    -0x14(%ebp),%ecx
+     667:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     66a:	01 c8                	add    %ecx,%eax
+     66c:	0f b6 00             	movzbl (%eax),%eax
+     66f:	88 02                	mov    %al,(%edx)
+  for(neg = 0; i > 0; )
+     671:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+     675:	7f d9                	jg     650 <itoa+0x97>
+  buf[neg] = 0;
+     677:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     67a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     67d:	01 d0                	add    %edx,%eax
+     67f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     682:	8b 45 0c             	mov    0xc(%ebp),%eax
+}
+     685:	c9                   	leave
+     686:	c3                   	ret
+
+00000687 <arith>:
+
+// $((expr)): numbers and variable names joined by + - * / %,
+// evaluated left to right.  *ps points after "$((".
+int
+arith(char **ps)
+{
+     687:	55                   	push   %ebp
+     688:	89 e5                	mov    %esp,%ebp
+     68a:	83 ec 28             	sub    $0x28,%esp
+  char *s, name[16];
+  int v, x, op;
+
+  s = *ps;
+     68d:	8b 45 08             	mov    0x8(%ebp),%eax
+     690:	8b 00                	mov    (%eax),%eax
+     692:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  v = 0;
+     695:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  op = '+';
+     69c:	c7 45 ec 2b 00 00 00 	movl   $0x2b,-0x14(%ebp)
+  for(;;){
+    while(*s == ' ')
+     6a3:	eb 09                	jmp    6ae <arith+0x27>
+      s++;
+     6a5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6a8:	83 c0 01             	add    $0x1,%eax
+     6ab:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    while(*s == ' ')
+     6ae:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6b1:	0f b6 00             	movzbl (%eax),%eax
+     6b4:	3c 20                	cmp    $0x20,%al
+     6b6:	74 ed                	je     6a5 <arith+0x1e>
+    if(*s >= '0' && *s <= '9'){
+     6b8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6bb:	0f b6 00             	movzbl (%eax),%eax
+     6be:	3c 2f                	cmp    $0x2f,%al
+     6c0:	7e 3d                	jle    6ff <arith+0x78>
+     6c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6c5:	0f b6 00             	movzbl (%eax),%eax
+     6c8:	3c 39                	cmp    $0x39,%al
+     6ca:	7f 33                	jg     6ff <arith+0x78>
+      x = atoi(s);
+     6cc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6cf:	83 ec 0c             	sub    $0xc,%esp
+     6d2:	50                   	push   %eax
+     6d3:	e8 7d 1d 00 00       	call   2455 <atoi>
+     6d8:	83 c4 10             	add    $0x10,%esp
+     6db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      while(*s >= '0' && *s <= '9')
+     6de:	eb 09                	jmp    6e9 <arith+0x62>
+        s++;
+     6e0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6e3:	83 c0 01             	add    $0x1,%eax
+     6e6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      while(*s >= '0' && *s <= '9')
+     6e9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6ec:	0f b6 00             	movzbl (%eax),%eax
+     6ef:	3c 2f                	cmp    $0x2f,%al
+     6f1:	7e 41                	jle    734 <arith+0xad>
+     6f3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     6f6:	0f b6 00             	movzbl (%eax),%eax
+     6f9:	3c 39                	cmp    $0x39,%al
+     6fb:	7e e3                	jle    6e0 <arith+0x59>
+    if(*s >= '0' && *s <= '9'){
+     6fd:	eb 35                	jmp    734 <arith+0xad>
+    } else {
+      getname(&s, name, sizeof(name));
+     6ff:	83 ec 04             	sub    $0x4,%esp
+     702:	6a 10                	push   $0x10
+     704:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     707:	50                   	push   %eax
+     708:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     70b:	50                   	push   %eax
+     70c:	e8 33 fe ff ff       	call   544 <getname>
+     711:	83 c4 10             	add    $0x10,%esp
+      x = atoi(getvar(name));
+     714:	83 ec 0c             	sub    $0xc,%esp
+     717:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     71a:	50                   	push   %eax
+     71b:	e8 7e fc ff ff       	call   39e <getvar>
+     720:	83 c4 10             	add    $0x10,%esp
+     723:	83 ec 0c             	sub    $0xc,%esp
+     726:	50                   	push   %eax
+     727:	e8 29 1d 00 00       	call   2455 <atoi>
+     72c:	83 c4 10             	add    $0x10,%esp
+     72f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     732:	eb 01                	jmp    735 <arith+0xae>
+    if(*s >= '0' && *s <= '9'){
+     734:	90                   	nop
+    }
+    switch(op){
+     735:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     738:	83 e8 25             	sub    $0x25,%eax
+     73b:	83 f8 0a             	cmp    $0xa,%eax
+     73e:	77 63                	ja     7a3 <arith+0x11c>
+     740:	8b 04 85 68 2b 00 00 	mov    0x2b68(,%eax,4),%eax
+     747:	ff e0                	jmp    *%eax
+    case '+': v += x; break;
+     749:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     74c:	01 45 f4             	add    %eax,-0xc(%ebp)
+     74f:	eb 47                	jmp    798 <arith+0x111>
+    case '-': v -= x; break;
+     751:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     754:	29 45 f4             	sub    %eax,-0xc(%ebp)
+     757:	eb 3f                	jmp    798 <arith+0x111>
+    case '*': v *= x; break;
+     759:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     75c:	0f af 45 f0          	imul   -0x10(%ebp),%eax
+     760:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     763:	eb 33                	jmp    798 <arith+0x111>
+    case '/': v = x ? v / x : 0; break;
+     765:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     769:	74 09                	je     774 <arith+0xed>
+     76b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     76e:	99                   	cltd
+     76f:	f7 7d f0             	idivl  -0x10(%ebp)
+     772:	eb 05                	jmp    779 <arith+0xf2>
+     774:	b8 00 00 00 00       	mov    $0x0,%eax
+     779:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     77c:	eb 1a                	jmp    798 <arith+0x111>
+    case '%': v = x ? v % x : 0; break;
+     77e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     782:	74 0b                	je     78f <arith+0x108>
+     784:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     787:	99                   	cltd
+     788:	f7 7d f0             	idivl  -0x10(%ebp)
+     78b:	89 d0                	mov    %edx,%eax
+     78d:	eb 05                	jmp    794 <arith+0x10d>
+     78f:	b8 00 00 00 00       	mov    $0x0,%eax
+     794:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     797:	90                   	nop
+    }
+    while(*s == ' ')
+     798:	eb 09                	jmp    7a3 <arith+0x11c>
+      s++;
+     79a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     79d:	83 c0 01             	add    $0x1,%eax
+     7a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    while(*s == ' ')
+     7a3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     7a6:	0f b6 00             	movzbl (%eax),%eax
+     7a9:	3c 20                	cmp    $0x20,%al
+     7ab:	74 ed                	je     79a <arith+0x113>
+    if(*s == 0 || *s == ')')
+     7ad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     7b0:	0f b6 00             	movzbl (%eax),%eax
+     7b3:	84 c0                	test   %al,%al
+     7b5:	74 2a                	je     7e1 <arith+0x15a>
+     7b7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     7ba:	0f b6 00             	movzbl (%eax),%eax
+     7bd:	3c 29                	cmp    $0x29,%al
+     7bf:	74 20                	je     7e1 <arith+0x15a>
+      break;
+    op = *s++;
+     7c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     7c4:	8d 50 01             	lea    0x1(%eax),%edx
+     7c7:	89 55 e8             	mov    %edx,-0x18(%ebp)
+     7ca:	0f b6 00             	movzbl (%eax),%eax
+     7cd:	0f be c0             	movsbl %al,%eax
+     7d0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    while(*s == ' ')
+     7d3:	e9 d6 fe ff ff       	jmp    6ae <arith+0x27>
+  }
+  while(*s == ')')
+    s++;
+     7d8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     7db:	83 c0 01             	add    $0x1,%eax
+     7de:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  while(*s == ')')
+     7e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     7e4:	0f b6 00             	movzbl (%eax),%eax
+     7e7:	3c 29                	cmp    $0x29,%al
+     7e9:	74 ed                	je     7d8 <arith+0x151>
+  *ps = s;
+     7eb:	8b 55 e8             	mov    -0x18(%ebp),%edx
+     7ee:	8b 45 08             	mov    0x8(%ebp),%eax
+     7f1:	89 10                	mov    %edx,(%eax)
+  return v;
+     7f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     7f6:	c9                   	leave
+     7f7:	c3                   	ret
+
+000007f8 <expand>:
+
+// Copy line to buf, expanding $ forms.
+void
+expand(char *line, char *buf, int n)
+{
+     7f8:	55                   	push   %ebp
+     7f9:	89 e5                	mov    %esp,%ebp
+     7fb:	83 ec 38             	sub    $0x38,%esp
+  char *s, *v, name[16], num[12];
+  int i;
+
+  i = 0;
+     7fe:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(s = line; *s && i < n-1; ){
+     805:	8b 45 08             	mov    0x8(%ebp),%eax
+     808:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     80b:	e9 81 01 00 00       	jmp    991 <expand+0x199>
+    if(*s != '$'){
+     810:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     813:	0f b6 00             	movzbl (%eax),%eax
+     816:	3c 24                	cmp    $0x24,%al
+     818:	74 23                	je     83d <expand+0x45>
+      buf[i++] = *s++;
+     81a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     81d:	8d 50 01             	lea    0x1(%eax),%edx
+     820:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     823:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     826:	8d 4a 01             	lea    0x1(%edx),%ecx
+     829:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     82c:	89 d1                	mov    %edx,%ecx
+     82e:	8b 55 0c             	mov    0xc(%ebp),%edx
+     831:	01 ca                	add    %ecx,%edx
+     833:	0f b6 00             	movzbl (%eax),%eax
+     836:	88 02                	mov    %al,(%edx)
+      continue;
+     838:	e9 54 01 00 00       	jmp    991 <expand+0x199>
+    }
+    s++;
+     83d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     840:	83 c0 01             	add    $0x1,%eax
+     843:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(*s == '?'){
+     846:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     849:	0f b6 00             	movzbl (%eax),%eax
+     84c:	3c 3f                	cmp    $0x3f,%al
+     84e:	75 23                	jne    873 <expand+0x7b>
+      v = itoa(status, num);
+     850:	a1 60 46 00 00       	mov    0x4660,%eax
+     855:	8d 55 d0             	lea    -0x30(%ebp),%edx
+     858:	52                   	push   %edx
+     859:	50                   	push   %eax
+     85a:	e8 5a fd ff ff       	call   5b9 <itoa>
+     85f:	83 c4 08             	add    $0x8,%esp
+     862:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      s++;
+     865:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     868:	83 c0 01             	add    $0x1,%eax
+     86b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     86e:	e9 09 01 00 00       	jmp    97c <expand+0x184>
+    } else if(*s >= '0' && *s <= '9'){
+     873:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     876:	0f b6 00             	movzbl (%eax),%eax
+     879:	3c 2f                	cmp    $0x2f,%al
+     87b:	7e 52                	jle    8cf <expand+0xd7>
+     87d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     880:	0f b6 00             	movzbl (%eax),%eax
+     883:	3c 39                	cmp    $0x39,%al
+     885:	7f 48                	jg     8cf <expand+0xd7>
+      v = *s - '0' < nargs ? args[*s - '0'] : "";
+     887:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     88a:	0f b6 00             	movzbl (%eax),%eax
+     88d:	0f be c0             	movsbl %al,%eax
+     890:	8d 50 d1             	lea    -0x2f(%eax),%edx
+     893:	a1 68 46 00 00       	mov    0x4668,%eax
+     898:	39 c2                	cmp    %eax,%edx
+     89a:	7f 1d                	jg     8b9 <expand+0xc1>
+     89c:	8b 15 64 46 00 00    	mov    0x4664,%edx
+     8a2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8a5:	0f b6 00             	movzbl (%eax),%eax
+     8a8:	0f be c0             	movsbl %al,%eax
+     8ab:	05 d0 ff ff 3f       	add    $0x3fffffd0,%eax
+     8b0:	c1 e0 02             	shl    $0x2,%eax
+     8b3:	01 d0                	add    %edx,%eax
+     8b5:	8b 00                	mov    (%eax),%eax
+     8b7:	eb 05                	jmp    8be <expand+0xc6>
+     8b9:	b8 34 2b 00 00       	mov    $0x2b34,%eax
+     8be:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      s++;
+     8c1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8c4:	83 c0 01             	add    $0x1,%eax
+     8c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     8ca:	e9 8f 00 00 00       	jmp    95e <expand+0x166>
+    } else if(s[0] == '(' && s[1] == '('){
+     8cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8d2:	0f b6 00             	movzbl (%eax),%eax
+     8d5:	3c 28                	cmp    $0x28,%al
+     8d7:	75 3a                	jne    913 <expand+0x11b>
+     8d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8dc:	83 c0 01             	add    $0x1,%eax
+     8df:	0f b6 00             	movzbl (%eax),%eax
+     8e2:	3c 28                	cmp    $0x28,%al
+     8e4:	75 2d                	jne    913 <expand+0x11b>
+      s += 2;
+     8e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8e9:	83 c0 02             	add    $0x2,%eax
+     8ec:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      v = itoa(arith(&s), num);
+     8ef:	83 ec 0c             	sub    $0xc,%esp
+     8f2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     8f5:	50                   	push   %eax
+     8f6:	e8 8c fd ff ff       	call   687 <arith>
+     8fb:	83 c4 10             	add    $0x10,%esp
+     8fe:	83 ec 08             	sub    $0x8,%esp
+     901:	8d 55 d0             	lea    -0x30(%ebp),%edx
+     904:	52                   	push   %edx
+     905:	50                   	push   %eax
+     906:	e8 ae fc ff ff       	call   5b9 <itoa>
+     90b:	83 c4 10             	add    $0x10,%esp
+     90e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     911:	eb 4b                	jmp    95e <expand+0x166>
+    } else if(isnamec(*s, 1)){
+     913:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     916:	0f b6 00             	movzbl (%eax),%eax
+     919:	0f be c0             	movsbl %al,%eax
+     91c:	83 ec 08             	sub    $0x8,%esp
+     91f:	6a 01                	push   $0x1
+     921:	50                   	push   %eax
+     922:	e8 dc fb ff ff       	call   503 <isnamec>
+     927:	83 c4 10             	add    $0x10,%esp
+     92a:	85 c0                	test   %eax,%eax
+     92c:	74 29                	je     957 <expand+0x15f>
+      getname(&s, name, sizeof(name));
+     92e:	83 ec 04             	sub    $0x4,%esp
+     931:	6a 10                	push   $0x10
+     933:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     936:	50                   	push   %eax
+     937:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     93a:	50                   	push   %eax
+     93b:	e8 04 fc ff ff       	call   544 <getname>
+     940:	83 c4 10             	add    $0x10,%esp
+      v = getvar(name);
+     943:	83 ec 0c             	sub    $0xc,%esp
+     946:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     949:	50                   	push   %eax
+     94a:	e8 4f fa ff ff       	call   39e <getvar>
+     94f:	83 c4 10             	add    $0x10,%esp
+     952:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     955:	eb 25                	jmp    97c <expand+0x184>
+    } else
+      v = "$";
+     957:	c7 45 f4 94 2b 00 00 	movl   $0x2b94,-0xc(%ebp)
+    for(; *v && i < n-1; v++)
+     95e:	eb 1c                	jmp    97c <expand+0x184>
+      buf[i++] = *v;
+     960:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     963:	8d 50 01             	lea    0x1(%eax),%edx
+     966:	89 55 f0             	mov    %edx,-0x10(%ebp)
+     969:	89 c2                	mov    %eax,%edx
+     96b:	8b 45 0c             	mov    0xc(%ebp),%eax
+     96e:	01 c2                	add    %eax,%edx
+     970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     973:	0f b6 00             	movzbl (%eax),%eax
+     976:	88 02                	mov    %al,(%edx)
+    for(; *v && i < n-1; v++)
+     978:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     97c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     97f:	0f b6 00             	movzbl (%eax),%eax
+     982:	84 c0                	test   %al,%al
+     984:	74 0b                	je     991 <expand+0x199>
+     986:	8b 45 10             	mov    0x10(%ebp),%eax
+     989:	83 e8 01             	sub    $0x1,%eax
+     98c:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     98f:	7c cf                	jl     960 <expand+0x168>
+  for(s = line; *s && i < n-1; ){
+     991:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     994:	0f b6 00             	movzbl (%eax),%eax
+     997:	84 c0                	test   %al,%al
+     999:	74 0f                	je     9aa <expand+0x1b2>
+     99b:	8b 45 10             	mov    0x10(%ebp),%eax
+     99e:	83 e8 01             	sub    $0x1,%eax
+     9a1:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     9a4:	0f 8c 66 fe ff ff    	jl     810 <expand+0x18>
+  }
+  buf[i] = 0;
+     9aa:	8b 55 f0             	mov    -0x10(%ebp),%edx
+     9ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+     9b0:	01 d0                	add    %edx,%eax
+     9b2:	c6 00 00             	movb   $0x0,(%eax)
+}
+     9b5:	90                   	nop
+     9b6:	c9                   	leave
+     9b7:	c3                   	ret
+
+000009b8 <split>:
+
+// Split s into words in place.
+int
+split(char *s, char **w, int max)
+{
+     9b8:	55                   	push   %ebp
+     9b9:	89 e5                	mov    %esp,%ebp
+     9bb:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  n = 0;
+     9be:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  for(;;){
+    while(*s && strchr(whitespace, *s))
+     9c5:	eb 0c                	jmp    9d3 <split+0x1b>
+      *s++ = 0;
+     9c7:	8b 45 08             	mov    0x8(%ebp),%eax
+     9ca:	8d 50 01             	lea    0x1(%eax),%edx
+     9cd:	89 55 08             	mov    %edx,0x8(%ebp)
+     9d0:	c6 00 00             	movb   $0x0,(%eax)
+    while(*s && strchr(whitespace, *s))
+     9d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d6:	0f b6 00             	movzbl (%eax),%eax
+     9d9:	84 c0                	test   %al,%al
+     9db:	74 1e                	je     9fb <split+0x43>
+     9dd:	8b 45 08             	mov    0x8(%ebp),%eax
+     9e0:	0f b6 00             	movzbl (%eax),%eax
+     9e3:	0f be c0             	movsbl %al,%eax
+     9e6:	83 ec 08             	sub    $0x8,%esp
+     9e9:	50                   	push   %eax
+     9ea:	68 38 34 00 00       	push   $0x3438
+     9ef:	e8 72 19 00 00       	call   2366 <strchr>
+     9f4:	83 c4 10             	add    $0x10,%esp
+     9f7:	85 c0                	test   %eax,%eax
+     9f9:	75 cc                	jne    9c7 <split+0xf>
+    if(*s == 0 || n == max)
+     9fb:	8b 45 08             	mov    0x8(%ebp),%eax
+     9fe:	0f b6 00             	movzbl (%eax),%eax
+     a01:	84 c0                	test   %al,%al
+     a03:	74 08                	je     a0d <split+0x55>
+     a05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a08:	3b 45 10             	cmp    0x10(%ebp),%eax
+     a0b:	75 05                	jne    a12 <split+0x5a>
+      return n;
+     a0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a10:	eb 4d                	jmp    a5f <split+0xa7>
+    w[n++] = s;
+     a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a15:	8d 50 01             	lea    0x1(%eax),%edx
+     a18:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a1b:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     a22:	8b 45 0c             	mov    0xc(%ebp),%eax
+     a25:	01 c2                	add    %eax,%edx
+     a27:	8b 45 08             	mov    0x8(%ebp),%eax
+     a2a:	89 02                	mov    %eax,(%edx)
+    while(*s && !strchr(whitespace, *s))
+     a2c:	eb 04                	jmp    a32 <split+0x7a>
+      s++;
+     a2e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    while(*s && !strchr(whitespace, *s))
+     a32:	8b 45 08             	mov    0x8(%ebp),%eax
+     a35:	0f b6 00             	movzbl (%eax),%eax
+     a38:	84 c0                	test   %al,%al
+     a3a:	74 97                	je     9d3 <split+0x1b>
+     a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+     a3f:	0f b6 00             	movzbl (%eax),%eax
+     a42:	0f be c0             	movsbl %al,%eax
+     a45:	83 ec 08             	sub    $0x8,%esp
+     a48:	50                   	push   %eax
+     a49:	68 38 34 00 00       	push   $0x3438
+     a4e:	e8 13 19 00 00       	call   2366 <strchr>
+     a53:	83 c4 10             	add    $0x10,%esp
+     a56:	85 c0                	test   %eax,%eax
+     a58:	74 d4                	je     a2e <split+0x76>
+    while(*s && strchr(whitespace, *s))
+     a5a:	e9 74 ff ff ff       	jmp    9d3 <split+0x1b>
+  }
+}
+     a5f:	c9                   	leave
+     a60:	c3                   	ret
+
+00000a61 <firstword>:
+
+// Is the first word of line w?  Return what follows it.
+char*
+firstword(char *line, char *w)
+{
+     a61:	55                   	push   %ebp
+     a62:	89 e5                	mov    %esp,%ebp
+     a64:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+
+  for(s = line; *s && strchr(whitespace, *s); s++)
+     a67:	8b 45 08             	mov    0x8(%ebp),%eax
+     a6a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     a6d:	eb 04                	jmp    a73 <firstword+0x12>
+     a6f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     a73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a76:	0f b6 00             	movzbl (%eax),%eax
+     a79:	84 c0                	test   %al,%al
+     a7b:	74 28                	je     aa5 <firstword+0x44>
+     a7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a80:	0f b6 00             	movzbl (%eax),%eax
+     a83:	0f be c0             	movsbl %al,%eax
+     a86:	83 ec 08             	sub    $0x8,%esp
+     a89:	50                   	push   %eax
+     a8a:	68 38 34 00 00       	push   $0x3438
+     a8f:	e8 d2 18 00 00       	call   2366 <strchr>
+     a94:	83 c4 10             	add    $0x10,%esp
+     a97:	85 c0                	test   %eax,%eax
+     a99:	75 d4                	jne    a6f <firstword+0xe>
+    ;
+  for(; *w && *s == *w; s++, w++)
+     a9b:	eb 08                	jmp    aa5 <firstword+0x44>
+     a9d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     aa1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+     aa5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     aa8:	0f b6 00             	movzbl (%eax),%eax
+     aab:	84 c0                	test   %al,%al
+     aad:	74 10                	je     abf <firstword+0x5e>
+     aaf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ab2:	0f b6 10             	movzbl (%eax),%edx
+     ab5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ab8:	0f b6 00             	movzbl (%eax),%eax
+     abb:	38 c2                	cmp    %al,%dl
+     abd:	74 de                	je     a9d <firstword+0x3c>
+    ;
+  if(*w || (*s && !strchr(whitespace, *s)))
+     abf:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ac2:	0f b6 00             	movzbl (%eax),%eax
+     ac5:	84 c0                	test   %al,%al
+     ac7:	75 28                	jne    af1 <firstword+0x90>
+     ac9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     acc:	0f b6 00             	movzbl (%eax),%eax
+     acf:	84 c0                	test   %al,%al
+     ad1:	74 25                	je     af8 <firstword+0x97>
+     ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ad6:	0f b6 00             	movzbl (%eax),%eax
+     ad9:	0f be c0             	movsbl %al,%eax
+     adc:	83 ec 08             	sub    $0x8,%esp
+     adf:	50                   	push   %eax
+     ae0:	68 38 34 00 00       	push   $0x3438
+     ae5:	e8 7c 18 00 00       	call   2366 <strchr>
+     aea:	83 c4 10             	add    $0x10,%esp
+     aed:	85 c0                	test   %eax,%eax
+     aef:	75 07                	jne    af8 <firstword+0x97>
+    return 0;
+     af1:	b8 00 00 00 00       	mov    $0x0,%eax
+     af6:	eb 03                	jmp    afb <firstword+0x9a>
+  return s;
+     af8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     afb:	c9                   	leave
+     afc:	c3                   	ret
+
+00000afd <test>:
+
+int
+test(int argc, char **argv)
+{
+     afd:	55                   	push   %ebp
+     afe:	89 e5                	mov    %esp,%ebp
+     b00:	83 ec 18             	sub    $0x18,%esp
+  int a, b;
+
+  if(argc == 0)
+     b03:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b07:	75 0a                	jne    b13 <test+0x16>
+    return 1;
+     b09:	b8 01 00 00 00       	mov    $0x1,%eax
+     b0e:	e9 7c 02 00 00       	jmp    d8f <test+0x292>
+  if(argc == 1)
+     b13:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     b17:	75 15                	jne    b2e <test+0x31>
+    return argv[0][0] == 0;
+     b19:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b1c:	8b 00                	mov    (%eax),%eax
+     b1e:	0f b6 00             	movzbl (%eax),%eax
+     b21:	84 c0                	test   %al,%al
+     b23:	0f 94 c0             	sete   %al
+     b26:	0f b6 c0             	movzbl %al,%eax
+     b29:	e9 61 02 00 00       	jmp    d8f <test+0x292>
+  if(argc == 2 && strcmp(argv[0], "-e") == 0){
+     b2e:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+     b32:	75 5b                	jne    b8f <test+0x92>
+     b34:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b37:	8b 00                	mov    (%eax),%eax
+     b39:	83 ec 08             	sub    $0x8,%esp
+     b3c:	68 96 2b 00 00       	push   $0x2b96
+     b41:	50                   	push   %eax
+     b42:	e8 9f 17 00 00       	call   22e6 <strcmp>
+     b47:	83 c4 10             	add    $0x10,%esp
+     b4a:	85 c0                	test   %eax,%eax
+     b4c:	75 41                	jne    b8f <test+0x92>
+    if((a = open(argv[1], O_RDONLY)) < 0)
+     b4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b51:	83 c0 04             	add    $0x4,%eax
+     b54:	8b 00                	mov    (%eax),%eax
+     b56:	83 ec 08             	sub    $0x8,%esp
+     b59:	6a 00                	push   $0x0
+     b5b:	50                   	push   %eax
+     b5c:	e8 04 1a 00 00       	call   2565 <open>
+     b61:	83 c4 10             	add    $0x10,%esp
+     b64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     b67:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     b6b:	79 0a                	jns    b77 <test+0x7a>
+      return 1;
+     b6d:	b8 01 00 00 00       	mov    $0x1,%eax
+     b72:	e9 18 02 00 00       	jmp    d8f <test+0x292>
+    close(a);
+     b77:	83 ec 0c             	sub    $0xc,%esp
+     b7a:	ff 75 f4             	push   -0xc(%ebp)
+     b7d:	e8 cb 19 00 00       	call   254d <close>
+     b82:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     b85:	b8 00 00 00 00       	mov    $0x0,%eax
+     b8a:	e9 00 02 00 00       	jmp    d8f <test+0x292>
+  }
+  if(argc != 3){
+     b8f:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+     b93:	74 1c                	je     bb1 <test+0xb4>
+    printf(2, "test: bad expression\n");
+     b95:	83 ec 08             	sub    $0x8,%esp
+     b98:	68 99 2b 00 00       	push   $0x2b99
+     b9d:	6a 02                	push   $0x2
+     b9f:	e8 7d 1b 00 00       	call   2721 <printf>
+     ba4:	83 c4 10             	add    $0x10,%esp
+    return 2;
+     ba7:	b8 02 00 00 00       	mov    $0x2,%eax
+     bac:	e9 de 01 00 00       	jmp    d8f <test+0x292>
+  }
+  if(strcmp(argv[1], "=") == 0)
+     bb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bb4:	83 c0 04             	add    $0x4,%eax
+     bb7:	8b 00                	mov    (%eax),%eax
+     bb9:	83 ec 08             	sub    $0x8,%esp
+     bbc:	68 af 2b 00 00       	push   $0x2baf
+     bc1:	50                   	push   %eax
+     bc2:	e8 1f 17 00 00       	call   22e6 <strcmp>
+     bc7:	83 c4 10             	add    $0x10,%esp
+     bca:	85 c0                	test   %eax,%eax
+     bcc:	75 27                	jne    bf5 <test+0xf8>
+    return strcmp(argv[0], argv[2]) != 0;
+     bce:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bd1:	83 c0 08             	add    $0x8,%eax
+     bd4:	8b 10                	mov    (%eax),%edx
+     bd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bd9:	8b 00                	mov    (%eax),%eax
+     bdb:	83 ec 08             	sub    $0x8,%esp
+     bde:	52                   	push   %edx
+     bdf:	50                   	push   %eax
+     be0:	e8 01 17 00 00       	call   22e6 <strcmp>
+     be5:	83 c4 10             	add    $0x10,%esp
+     be8:	85 c0                	test   %eax,%eax
+     bea:	0f 95 c0             	setne  %al
+     bed:	0f b6 c0             	movzbl %al,%eax
+     bf0:	e9 9a 01 00 00       	jmp    d8f <test+0x292>
+  if(strcmp(argv[1], "!=") == 0)
+     bf5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bf8:	83 c0 04             	add    $0x4,%eax
+     bfb:	8b 00                	mov    (%eax),%eax
+     bfd:	83 ec 08             	sub    $0x8,%esp
+     c00:	68 b1 2b 00 00       	push   $0x2bb1
+     c05:	50                   	push   %eax
+     c06:	e8 db 16 00 00       	call   22e6 <strcmp>
+     c0b:	83 c4 10             	add    $0x10,%esp
+     c0e:	85 c0                	test   %eax,%eax
+     c10:	75 27                	jne    c39 <test+0x13c>
+    return strcmp(argv[0], argv[2]) == 0;
+     c12:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c15:	83 c0 08             	add    $0x8,%eax
+     c18:	8b 10                	mov    (%eax),%edx
+     c1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c1d:	8b 00                	mov    (%eax),%eax
+     c1f:	83 ec 08             	sub    $0x8,%esp
+     c22:	52                   	push   %edx
+     c23:	50                   	push   %eax
+     c24:	e8 bd 16 00 00       	call   22e6 <strcmp>
+     c29:	83 c4 10             	add    $0x10,%esp
+     c2c:	85 c0                	test   %eax,%eax
+     c2e:	0f 94 c0             	sete   %al
+     c31:	0f b6 c0             	movzbl %al,%eax
+     c34:	e9 56 01 00 00       	jmp    d8f <test+0x292>
+  a = atoi(argv[0]);
+     c39:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c3c:	8b 00                	mov    (%eax),%eax
+     c3e:	83 ec 0c             	sub    $0xc,%esp
+     c41:	50                   	push   %eax
+     c42:	e8 0e 18 00 00       	call   2455 <atoi>
+     c47:	83 c4 10             	add    $0x10,%esp
+     c4a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  b = atoi(argv[2]);
+     c4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c50:	83 c0 08             	add    $0x8,%eax
+     c53:	8b 00                	mov    (%eax),%eax
+     c55:	83 ec 0c             	sub    $0xc,%esp
+     c58:	50                   	push   %eax
+     c59:	e8 f7 17 00 00       	call   2455 <atoi>
+     c5e:	83 c4 10             	add    $0x10,%esp
+     c61:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(strcmp(argv[1], "-eq") == 0) return !(a == b);
+     c64:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c67:	83 c0 04             	add    $0x4,%eax
+     c6a:	8b 00                	mov    (%eax),%eax
+     c6c:	83 ec 08             	sub    $0x8,%esp
+     c6f:	68 b4 2b 00 00       	push   $0x2bb4
+     c74:	50                   	push   %eax
+     c75:	e8 6c 16 00 00       	call   22e6 <strcmp>
+     c7a:	83 c4 10             	add    $0x10,%esp
+     c7d:	85 c0                	test   %eax,%eax
+     c7f:	75 11                	jne    c92 <test+0x195>
+     c81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c84:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     c87:	0f 95 c0             	setne  %al
+     c8a:	0f b6 c0             	movzbl %al,%eax
+     c8d:	e9 fd 00 00 00       	jmp    d8f <test+0x292>
+  if(strcmp(argv[1], "-ne") == 0) return !(a != b);
+     c92:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c95:	83 c0 04             	add    $0x4,%eax
+     c98:	8b 00                	mov    (%eax),%eax
+     c9a:	83 ec 08             	sub    $0x8,%esp
+     c9d:	68 b8 2b 00 00       	push   $0x2bb8
+     ca2:	50                   	push   %eax
+     ca3:	e8 3e 16 00 00       	call   22e6 <strcmp>
+     ca8:	83 c4 10             	add    $0x10,%esp
+     cab:	85 c0                	test   %eax,%eax
+     cad:	75 11                	jne    cc0 <test+0x1c3>
+     caf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cb2:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     cb5:	0f 94 c0             	sete   %al
+     cb8:	0f b6 c0             	movzbl %al,%eax
+     cbb:	e9 cf 00 00 00       	jmp    d8f <test+0x292>
+  if(strcmp(argv[1], "-lt") == 0) return !(a < b);
+     cc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cc3:	83 c0 04             	add    $0x4,%eax
+     cc6:	8b 00                	mov    (%eax),%eax
+     cc8:	83 ec 08             	sub    $0x8,%esp
+     ccb:	68 bc 2b 00 00       	push   $0x2bbc
+     cd0:	50                   	push   %eax
+     cd1:	e8 10 16 00 00       	call   22e6 <strcmp>
+     cd6:	83 c4 10             	add    $0x10,%esp
+     cd9:	85 c0                	test   %eax,%eax
+     cdb:	75 11                	jne    cee <test+0x1f1>
+     cdd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ce0:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     ce3:	0f 9d c0             	setge  %al
+     ce6:	0f b6 c0             	movzbl %al,%eax
+     ce9:	e9 a1 00 00 00       	jmp    d8f <test+0x292>
+  if(strcmp(argv[1], "-le") == 0) return !(a <= b);
+     cee:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cf1:	83 c0 04             	add    $0x4,%eax
+     cf4:	8b 00                	mov    (%eax),%eax
+     cf6:	83 ec 08             	sub    $0x8,%esp
+     cf9:	68 c0 2b 00 00       	push   $0x2bc0
+     cfe:	50                   	push   %eax
+     cff:	e8 e2 15 00 00       	call   22e6 <strcmp>
+     d04:	83 c4 10             	add    $0x10,%esp
+     d07:	85 c0                	test   %eax,%eax
+     d09:	75 0e                	jne    d19 <test+0x21c>
+     d0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d0e:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     d11:	0f 9f c0             	setg   %al
+     d14:	0f b6 c0             	movzbl %al,%eax
+     d17:	eb 76                	jmp    d8f <test+0x292>
+  if(strcmp(argv[1], "-gt") == 0) return !(a > b);
+     d19:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d1c:	83 c0 04             	add    $0x4,%eax
+     d1f:	8b 00                	mov    (%eax),%eax
+     d21:	83 ec 08             	sub    $0x8,%esp
+     d24:	68 c4 2b 00 00       	push   $0x2bc4
+     d29:	50                   	push   %eax
+     d2a:	e8 b7 15 00 00       	call   22e6 <strcmp>
+     d2f:	83 c4 10             	add    $0x10,%esp
+     d32:	85 c0                	test   %eax,%eax
+     d34:	75 0e                	jne    d44 <test+0x247>
+     d36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d39:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     d3c:	0f 9e c0             	setle  %al
+     d3f:	0f b6 c0             	movzbl %al,%eax
+     d42:	eb 4b                	jmp    d8f <test+0x292>
+  if(strcmp(argv[1], "-ge") == 0) return !(a >= b);
+     d44:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d47:	83 c0 04             	add    $0x4,%eax
+     d4a:	8b 00                	mov    (%eax),%eax
+     d4c:	83 ec 08             	sub    $0x8,%esp
+     d4f:	68 c8 2b 00 00       	push   $0x2bc8
+     d54:	50                   	push   %eax
+     d55:	e8 8c 15 00 00       	call   22e6 <strcmp>
+     d5a:	83 c4 10             	add    $0x10,%esp
+     d5d:	85 c0                	test   %eax,%eax
+     d5f:	75 0e                	jne    d6f <test+0x272>
+     d61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d64:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     d67:	0f 9c c0             	setl   %al
+     d6a:	0f b6 c0             	movzbl %al,%eax
+     d6d:	eb 20                	jmp    d8f <test+0x292>
+  printf(2, "test: unknown operator %s\n", argv[1]);
+     d6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d72:	83 c0 04             	add    $0x4,%eax
+     d75:	8b 00                	mov    (%eax),%eax
+     d77:	83 ec 04             	sub    $0x4,%esp
+     d7a:	50                   	push   %eax
+     d7b:	68 cc 2b 00 00       	push   $0x2bcc
+     d80:	6a 02                	push   $0x2
+     d82:	e8 9a 19 00 00       	call   2721 <printf>
+     d87:	83 c4 10             	add    $0x10,%esp
+  return 2;
+     d8a:	b8 02 00 00 00       	mov    $0x2,%eax
+}
+     d8f:	c9                   	leave
+     d90:	c3                   	ret
+
+00000d91 <builtin>:
+
+// Run the built-in command in buf, if it is one.
+int
+builtin(char *buf)
+{
+     d91:	55                   	push   %ebp
+     d92:	89 e5                	mov    %esp,%ebp
+     d94:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  char tmp[MAXLINE], *w[MAXARGS], *eq;
+  int n;
+
+  strcpy(tmp, buf);
+     d9a:	83 ec 08             	sub    $0x8,%esp
+     d9d:	ff 75 08             	push   0x8(%ebp)
+     da0:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+     da6:	50                   	push   %eax
+     da7:	e8 0a 15 00 00       	call   22b6 <strcpy>
+     dac:	83 c4 10             	add    $0x10,%esp
+  if((n = split(tmp, w, MAXARGS)) == 0)
+     daf:	83 ec 04             	sub    $0x4,%esp
+     db2:	6a 0a                	push   $0xa
+     db4:	8d 85 48 ff ff ff    	lea    -0xb8(%ebp),%eax
+     dba:	50                   	push   %eax
+     dbb:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+     dc1:	50                   	push   %eax
+     dc2:	e8 f1 fb ff ff       	call   9b8 <split>
+     dc7:	83 c4 10             	add    $0x10,%esp
+     dca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     dcd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     dd1:	75 0a                	jne    ddd <builtin+0x4c>
+    return 1;
+     dd3:	b8 01 00 00 00       	mov    $0x1,%eax
+     dd8:	e9 81 01 00 00       	jmp    f5e <builtin+0x1cd>
+  if(w[0][0] == '#')
+     ddd:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+     de3:	0f b6 00             	movzbl (%eax),%eax
+     de6:	3c 23                	cmp    $0x23,%al
+     de8:	75 0a                	jne    df4 <builtin+0x63>
+    return 1;
+     dea:	b8 01 00 00 00       	mov    $0x1,%eax
+     def:	e9 6a 01 00 00       	jmp    f5e <builtin+0x1cd>
+  if(strcmp(w[0], "cd") == 0){
+     df4:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+     dfa:	83 ec 08             	sub    $0x8,%esp
+     dfd:	68 e7 2b 00 00       	push   $0x2be7
+     e02:	50                   	push   %eax
+     e03:	e8 de 14 00 00       	call   22e6 <strcmp>
+     e08:	83 c4 10             	add    $0x10,%esp
+     e0b:	85 c0                	test   %eax,%eax
+     e0d:	75 66                	jne    e75 <builtin+0xe4>
+    // Chdir has no effect on the parent if run in the child.
+    status = n < 2 || chdir(w[1]) < 0;
+     e0f:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+     e13:	7e 16                	jle    e2b <builtin+0x9a>
+     e15:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+     e1b:	83 ec 0c             	sub    $0xc,%esp
+     e1e:	50                   	push   %eax
+     e1f:	e8 71 17 00 00       	call   2595 <chdir>
+     e24:	83 c4 10             	add    $0x10,%esp
+     e27:	85 c0                	test   %eax,%eax
+     e29:	79 07                	jns    e32 <builtin+0xa1>
+     e2b:	b8 01 00 00 00       	mov    $0x1,%eax
+     e30:	eb 05                	jmp    e37 <builtin+0xa6>
+     e32:	b8 00 00 00 00       	mov    $0x0,%eax
+     e37:	a3 60 46 00 00       	mov    %eax,0x4660
+    if(status)
+     e3c:	a1 60 46 00 00       	mov    0x4660,%eax
+     e41:	85 c0                	test   %eax,%eax
+     e43:	74 26                	je     e6b <builtin+0xda>
+      printf(2, "cannot cd %s\n", n < 2 ? "" : w[1]);
+     e45:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+     e49:	7e 08                	jle    e53 <builtin+0xc2>
+     e4b:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+     e51:	eb 05                	jmp    e58 <builtin+0xc7>
+     e53:	b8 34 2b 00 00       	mov    $0x2b34,%eax
+     e58:	83 ec 04             	sub    $0x4,%esp
+     e5b:	50                   	push   %eax
+     e5c:	68 ea 2b 00 00       	push   $0x2bea
+     e61:	6a 02                	push   $0x2
+     e63:	e8 b9 18 00 00       	call   2721 <printf>
+     e68:	83 c4 10             	add    $0x10,%esp
+    return 1;
+     e6b:	b8 01 00 00 00       	mov    $0x1,%eax
+     e70:	e9 e9 00 00 00       	jmp    f5e <builtin+0x1cd>
+  }
+  if(strcmp(w[0], "exit") == 0)
+     e75:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+     e7b:	83 ec 08             	sub    $0x8,%esp
+     e7e:	68 f8 2b 00 00       	push   $0x2bf8
+     e83:	50                   	push   %eax
+     e84:	e8 5d 14 00 00       	call   22e6 <strcmp>
+     e89:	83 c4 10             	add    $0x10,%esp
+     e8c:	85 c0                	test   %eax,%eax
+     e8e:	75 28                	jne    eb8 <builtin+0x127>
+    exits(n > 1 ? atoi(w[1]) : status);
+     e90:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+     e94:	7e 14                	jle    eaa <builtin+0x119>
+     e96:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+     e9c:	83 ec 0c             	sub    $0xc,%esp
+     e9f:	50                   	push   %eax
+     ea0:	e8 b0 15 00 00       	call   2455 <atoi>
+     ea5:	83 c4 10             	add    $0x10,%esp
+     ea8:	eb 05                	jmp    eaf <builtin+0x11e>
+     eaa:	a1 60 46 00 00       	mov    0x4660,%eax
+     eaf:	83 ec 0c             	sub    $0xc,%esp
+     eb2:	50                   	push   %eax
+     eb3:	e8 65 17 00 00       	call   261d <exits>
+  if(strcmp(w[0], "test") == 0){
+     eb8:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+     ebe:	83 ec 08             	sub    $0x8,%esp
+     ec1:	68 fd 2b 00 00       	push   $0x2bfd
+     ec6:	50                   	push   %eax
+     ec7:	e8 1a 14 00 00       	call   22e6 <strcmp>
+     ecc:	83 c4 10             	add    $0x10,%esp
+     ecf:	85 c0                	test   %eax,%eax
+     ed1:	75 28                	jne    efb <builtin+0x16a>
+    status = test(n-1, w+1);
+     ed3:	8d 85 48 ff ff ff    	lea    -0xb8(%ebp),%eax
+     ed9:	83 c0 04             	add    $0x4,%eax
+     edc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     edf:	83 ea 01             	sub    $0x1,%edx
+     ee2:	83 ec 08             	sub    $0x8,%esp
+     ee5:	50                   	push   %eax
+     ee6:	52                   	push   %edx
+     ee7:	e8 11 fc ff ff       	call   afd <test>
+     eec:	83 c4 10             	add    $0x10,%esp
+     eef:	a3 60 46 00 00       	mov    %eax,0x4660
+    return 1;
+     ef4:	b8 01 00 00 00       	mov    $0x1,%eax
+     ef9:	eb 63                	jmp    f5e <builtin+0x1cd>
+  }
+  if(n == 1 && (eq = strchr(w[0], '=')) != 0 && eq > w[0]){
+     efb:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+     eff:	75 58                	jne    f59 <builtin+0x1c8>
+     f01:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+     f07:	83 ec 08             	sub    $0x8,%esp
+     f0a:	6a 3d                	push   $0x3d
+     f0c:	50                   	push   %eax
+     f0d:	e8 54 14 00 00       	call   2366 <strchr>
+     f12:	83 c4 10             	add    $0x10,%esp
+     f15:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f18:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f1c:	74 3b                	je     f59 <builtin+0x1c8>
+     f1e:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+     f24:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+     f27:	73 30                	jae    f59 <builtin+0x1c8>
+    *eq = 0;
+     f29:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f2c:	c6 00 00             	movb   $0x0,(%eax)
+    setvar(w[0], eq+1);
+     f2f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f32:	8d 50 01             	lea    0x1(%eax),%edx
+     f35:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+     f3b:	83 ec 08             	sub    $0x8,%esp
+     f3e:	52                   	push   %edx
+     f3f:	50                   	push   %eax
+     f40:	e8 ce f4 ff ff       	call   413 <setvar>
+     f45:	83 c4 10             	add    $0x10,%esp
+    status = 0;
+     f48:	c7 05 60 46 00 00 00 	movl   $0x0,0x4660
+     f4f:	00 00 00 
+    return 1;
+     f52:	b8 01 00 00 00       	mov    $0x1,%eax
+     f57:	eb 05                	jmp    f5e <builtin+0x1cd>
+  }
+  return 0;
+     f59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     f5e:	c9                   	leave
+     f5f:	c3                   	ret
+
+00000f60 <runline>:
+
+// Expand and run one command line, setting status.
+void
+runline(char *line)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+     f63:	81 ec 88 00 00 00    	sub    $0x88,%esp
+  char buf[MAXLINE];
+
+  expand(line, buf, sizeof(buf));
+     f69:	83 ec 04             	sub    $0x4,%esp
+     f6c:	68 80 00 00 00       	push   $0x80
+     f71:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+     f77:	50                   	push   %eax
+     f78:	ff 75 08             	push   0x8(%ebp)
+     f7b:	e8 78 f8 ff ff       	call   7f8 <expand>
+     f80:	83 c4 10             	add    $0x10,%esp
+  if(builtin(buf))
+     f83:	83 ec 0c             	sub    $0xc,%esp
+     f86:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+     f8c:	50                   	push   %eax
+     f8d:	e8 ff fd ff ff       	call   d91 <builtin>
+     f92:	83 c4 10             	add    $0x10,%esp
+     f95:	85 c0                	test   %eax,%eax
+     f97:	75 36                	jne    fcf <runline+0x6f>
+    return;
+  if(fork1() == 0)
+     f99:	e8 07 08 00 00       	call   17a5 <fork1>
+     f9e:	85 c0                	test   %eax,%eax
+     fa0:	75 1b                	jne    fbd <runline+0x5d>
+    runcmd(parsecmd(buf));
+     fa2:	83 ec 0c             	sub    $0xc,%esp
+     fa5:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+     fab:	50                   	push   %eax
+     fac:	e8 88 0c 00 00       	call   1c39 <parsecmd>
+     fb1:	83 c4 10             	add    $0x10,%esp
+     fb4:	83 ec 0c             	sub    $0xc,%esp
+     fb7:	50                   	push   %eax
+     fb8:	e8 43 f0 ff ff       	call   0 <runcmd>
+  waitstatus(&status);
+     fbd:	83 ec 0c             	sub    $0xc,%esp
+     fc0:	68 60 46 00 00       	push   $0x4660
+     fc5:	e8 5b 16 00 00       	call   2625 <waitstatus>
+     fca:	83 c4 10             	add    $0x10,%esp
+     fcd:	eb 01                	jmp    fd0 <runline+0x70>
+    return;
+     fcf:	90                   	nop
+}
+     fd0:	c9                   	leave
+     fd1:	c3                   	ret
+
+00000fd2 <nesting>:
+
+// How a line changes the block nesting depth.
+int
+nesting(char *line)
+{
+     fd2:	55                   	push   %ebp
+     fd3:	89 e5                	mov    %esp,%ebp
+     fd5:	83 ec 08             	sub    $0x8,%esp
+  if(firstword(line, "for") || firstword(line, "while") || firstword(line, "if"))
+     fd8:	83 ec 08             	sub    $0x8,%esp
+     fdb:	68 02 2c 00 00       	push   $0x2c02
+     fe0:	ff 75 08             	push   0x8(%ebp)
+     fe3:	e8 79 fa ff ff       	call   a61 <firstword>
+     fe8:	83 c4 10             	add    $0x10,%esp
+     feb:	85 c0                	test   %eax,%eax
+     fed:	75 2e                	jne    101d <nesting+0x4b>
+     fef:	83 ec 08             	sub    $0x8,%esp
+     ff2:	68 06 2c 00 00       	push   $0x2c06
+     ff7:	ff 75 08             	push   0x8(%ebp)
+     ffa:	e8 62 fa ff ff       	call   a61 <firstword>
+     fff:	83 c4 10             	add    $0x10,%esp
+    1002:	85 c0                	test   %eax,%eax
+    1004:	75 17                	jne    101d <nesting+0x4b>
+    1006:	83 ec 08             	sub    $0x8,%esp
+    1009:	68 0c 2c 00 00       	push   $0x2c0c
+    100e:	ff 75 08             	push   0x8(%ebp)
+    1011:	e8 4b fa ff ff       	call   a61 <firstword>
+    1016:	83 c4 10             	add    $0x10,%esp
+    1019:	85 c0                	test   %eax,%eax
+    101b:	74 07                	je     1024 <nesting+0x52>
+    return 1;
+    101d:	b8 01 00 00 00       	mov    $0x1,%eax
+    1022:	eb 3a                	jmp    105e <nesting+0x8c>
+  if(firstword(line, "done") || firstword(line, "fi"))
+    1024:	83 ec 08             	sub    $0x8,%esp
+    1027:	68 0f 2c 00 00       	push   $0x2c0f
+    102c:	ff 75 08             	push   0x8(%ebp)
+    102f:	e8 2d fa ff ff       	call   a61 <firstword>
+    1034:	83 c4 10             	add    $0x10,%esp
+    1037:	85 c0                	test   %eax,%eax
+    1039:	75 17                	jne    1052 <nesting+0x80>
+    103b:	83 ec 08             	sub    $0x8,%esp
+    103e:	68 14 2c 00 00       	push   $0x2c14
+    1043:	ff 75 08             	push   0x8(%ebp)
+    1046:	e8 16 fa ff ff       	call   a61 <firstword>
+    104b:	83 c4 10             	add    $0x10,%esp
+    104e:	85 c0                	test   %eax,%eax
+    1050:	74 07                	je     1059 <nesting+0x87>
+    return -1;
+    1052:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1057:	eb 05                	jmp    105e <nesting+0x8c>
+  return 0;
+    1059:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    105e:	c9                   	leave
+    105f:	c3                   	ret
+
+00001060 <blockend>:
+
+// Index of the done/fi closing the block opened by l[i], and
+// of its else (or -1).
+int
+blockend(char **l, int i, int n, int *pelse)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	83 ec 18             	sub    $0x18,%esp
+  int d;
+
+  *pelse = -1;
+    1066:	8b 45 14             	mov    0x14(%ebp),%eax
+    1069:	c7 00 ff ff ff ff    	movl   $0xffffffff,(%eax)
+  for(d = 0; i < n; i++){
+    106f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1076:	eb 63                	jmp    10db <blockend+0x7b>
+    d += nesting(l[i]);
+    1078:	8b 45 0c             	mov    0xc(%ebp),%eax
+    107b:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    1082:	8b 45 08             	mov    0x8(%ebp),%eax
+    1085:	01 d0                	add    %edx,%eax
+    1087:	8b 00                	mov    (%eax),%eax
+    1089:	83 ec 0c             	sub    $0xc,%esp
+    108c:	50                   	push   %eax
+    108d:	e8 40 ff ff ff       	call   fd2 <nesting>
+    1092:	83 c4 10             	add    $0x10,%esp
+    1095:	01 45 f4             	add    %eax,-0xc(%ebp)
+    if(d == 1 && firstword(l[i], "else"))
+    1098:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    109c:	75 2e                	jne    10cc <blockend+0x6c>
+    109e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10a1:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    10a8:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ab:	01 d0                	add    %edx,%eax
+    10ad:	8b 00                	mov    (%eax),%eax
+    10af:	83 ec 08             	sub    $0x8,%esp
+    10b2:	68 17 2c 00 00       	push   $0x2c17
+    10b7:	50                   	push   %eax
+    10b8:	e8 a4 f9 ff ff       	call   a61 <firstword>
+    10bd:	83 c4 10             	add    $0x10,%esp
+    10c0:	85 c0                	test   %eax,%eax
+    10c2:	74 08                	je     10cc <blockend+0x6c>
+      *pelse = i;
+    10c4:	8b 45 14             	mov    0x14(%ebp),%eax
+    10c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+    10ca:	89 10                	mov    %edx,(%eax)
+    if(d == 0)
+    10cc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10d0:	75 05                	jne    10d7 <blockend+0x77>
+      return i;
+    10d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10d5:	eb 0f                	jmp    10e6 <blockend+0x86>
+  for(d = 0; i < n; i++){
+    10d7:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+    10db:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10de:	3b 45 10             	cmp    0x10(%ebp),%eax
+    10e1:	7c 95                	jl     1078 <blockend+0x18>
+  }
+  return n;
+    10e3:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+    10e6:	c9                   	leave
+    10e7:	c3                   	ret
+
+000010e8 <runblock>:
+
+void
+runblock(char **l, int n)
+{
+    10e8:	55                   	push   %ebp
+    10e9:	89 e5                	mov    %esp,%ebp
+    10eb:	81 ec c8 00 00 00    	sub    $0xc8,%esp
+  char buf[MAXLINE], *w[MAXARGS], *s;
+  int i, j, k, e, nw;
+
+  for(i = 0; i < n; i = j+1){
+    10f1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    10f8:	e9 52 03 00 00       	jmp    144f <runblock+0x367>
+    if(nesting(l[i]) < 0 || firstword(l[i], "else")){
+    10fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1100:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    1107:	8b 45 08             	mov    0x8(%ebp),%eax
+    110a:	01 d0                	add    %edx,%eax
+    110c:	8b 00                	mov    (%eax),%eax
+    110e:	83 ec 0c             	sub    $0xc,%esp
+    1111:	50                   	push   %eax
+    1112:	e8 bb fe ff ff       	call   fd2 <nesting>
+    1117:	83 c4 10             	add    $0x10,%esp
+    111a:	85 c0                	test   %eax,%eax
+    111c:	78 26                	js     1144 <runblock+0x5c>
+    111e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1121:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    1128:	8b 45 08             	mov    0x8(%ebp),%eax
+    112b:	01 d0                	add    %edx,%eax
+    112d:	8b 00                	mov    (%eax),%eax
+    112f:	83 ec 08             	sub    $0x8,%esp
+    1132:	68 17 2c 00 00       	push   $0x2c17
+    1137:	50                   	push   %eax
+    1138:	e8 24 f9 ff ff       	call   a61 <firstword>
+    113d:	83 c4 10             	add    $0x10,%esp
+    1140:	85 c0                	test   %eax,%eax
+    1142:	74 39                	je     117d <runblock+0x95>
+      printf(2, "sh: unexpected %s\n", l[i]);
+    1144:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1147:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    114e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1151:	01 d0                	add    %edx,%eax
+    1153:	8b 00                	mov    (%eax),%eax
+    1155:	83 ec 04             	sub    $0x4,%esp
+    1158:	50                   	push   %eax
+    1159:	68 1c 2c 00 00       	push   $0x2c1c
+    115e:	6a 02                	push   $0x2
+    1160:	e8 bc 15 00 00       	call   2721 <printf>
+    1165:	83 c4 10             	add    $0x10,%esp
+      status = 2;
+    1168:	c7 05 60 46 00 00 02 	movl   $0x2,0x4660
+    116f:	00 00 00 
+      j = i;
+    1172:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1175:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      continue;
+    1178:	e9 c9 02 00 00       	jmp    1446 <runblock+0x35e>
+    }
+    j = blockend(l, i, n, &e);
+    117d:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+    1183:	50                   	push   %eax
+    1184:	ff 75 0c             	push   0xc(%ebp)
+    1187:	ff 75 f4             	push   -0xc(%ebp)
+    118a:	ff 75 08             	push   0x8(%ebp)
+    118d:	e8 ce fe ff ff       	call   1060 <blockend>
+    1192:	83 c4 10             	add    $0x10,%esp
+    1195:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(j == n && nesting(l[i]) > 0){
+    1198:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    119b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    119e:	75 42                	jne    11e2 <runblock+0xfa>
+    11a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11a3:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    11aa:	8b 45 08             	mov    0x8(%ebp),%eax
+    11ad:	01 d0                	add    %edx,%eax
+    11af:	8b 00                	mov    (%eax),%eax
+    11b1:	83 ec 0c             	sub    $0xc,%esp
+    11b4:	50                   	push   %eax
+    11b5:	e8 18 fe ff ff       	call   fd2 <nesting>
+    11ba:	83 c4 10             	add    $0x10,%esp
+    11bd:	85 c0                	test   %eax,%eax
+    11bf:	7e 21                	jle    11e2 <runblock+0xfa>
+      printf(2, "sh: missing done or fi\n");
+    11c1:	83 ec 08             	sub    $0x8,%esp
+    11c4:	68 2f 2c 00 00       	push   $0x2c2f
+    11c9:	6a 02                	push   $0x2
+    11cb:	e8 51 15 00 00       	call   2721 <printf>
+    11d0:	83 c4 10             	add    $0x10,%esp
+      status = 2;
+    11d3:	c7 05 60 46 00 00 02 	movl   $0x2,0x4660
+    11da:	00 00 00 
+      return;
+    11dd:	e9 79 02 00 00       	jmp    145b <runblock+0x373>
+    }
+    if((s = firstword(l[i], "for")) != 0){
+    11e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11e5:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    11ec:	8b 45 08             	mov    0x8(%ebp),%eax
+    11ef:	01 d0                	add    %edx,%eax
+    11f1:	8b 00                	mov    (%eax),%eax
+    11f3:	83 ec 08             	sub    $0x8,%esp
+    11f6:	68 02 2c 00 00       	push   $0x2c02
+    11fb:	50                   	push   %eax
+    11fc:	e8 60 f8 ff ff       	call   a61 <firstword>
+    1201:	83 c4 10             	add    $0x10,%esp
+    1204:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    1207:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    120b:	0f 84 d9 00 00 00    	je     12ea <runblock+0x202>
+      expand(s, buf, sizeof(buf));
+    1211:	83 ec 04             	sub    $0x4,%esp
+    1214:	68 80 00 00 00       	push   $0x80
+    1219:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    121f:	50                   	push   %eax
+    1220:	ff 75 e8             	push   -0x18(%ebp)
+    1223:	e8 d0 f5 ff ff       	call   7f8 <expand>
+    1228:	83 c4 10             	add    $0x10,%esp
+      nw = split(buf, w, MAXARGS);
+    122b:	83 ec 04             	sub    $0x4,%esp
+    122e:	6a 0a                	push   $0xa
+    1230:	8d 85 3c ff ff ff    	lea    -0xc4(%ebp),%eax
+    1236:	50                   	push   %eax
+    1237:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+    123d:	50                   	push   %eax
+    123e:	e8 75 f7 ff ff       	call   9b8 <split>
+    1243:	83 c4 10             	add    $0x10,%esp
+    1246:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(nw < 2 || strcmp(w[1], "in") != 0){
+    1249:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    124d:	7e 1b                	jle    126a <runblock+0x182>
+    124f:	8b 85 40 ff ff ff    	mov    -0xc0(%ebp),%eax
+    1255:	83 ec 08             	sub    $0x8,%esp
+    1258:	68 47 2c 00 00       	push   $0x2c47
+    125d:	50                   	push   %eax
+    125e:	e8 83 10 00 00       	call   22e6 <strcmp>
+    1263:	83 c4 10             	add    $0x10,%esp
+    1266:	85 c0                	test   %eax,%eax
+    1268:	74 21                	je     128b <runblock+0x1a3>
+        printf(2, "sh: for NAME in words\n");
+    126a:	83 ec 08             	sub    $0x8,%esp
+    126d:	68 4a 2c 00 00       	push   $0x2c4a
+    1272:	6a 02                	push   $0x2
+    1274:	e8 a8 14 00 00       	call   2721 <printf>
+    1279:	83 c4 10             	add    $0x10,%esp
+        status = 2;
+    127c:	c7 05 60 46 00 00 02 	movl   $0x2,0x4660
+    1283:	00 00 00 
+        return;
+    1286:	e9 d0 01 00 00       	jmp    145b <runblock+0x373>
+      }
+      for(k = 2; k < nw; k++){
+    128b:	c7 45 ec 02 00 00 00 	movl   $0x2,-0x14(%ebp)
+    1292:	eb 49                	jmp    12dd <runblock+0x1f5>
+        setvar(w[0], w[k]);
+    1294:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1297:	8b 94 85 3c ff ff ff 	mov    -0xc4(%ebp,%eax,4),%edx
+    129e:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+    12a4:	83 ec 08             	sub    $0x8,%esp
+    12a7:	52                   	push   %edx
+    12a8:	50                   	push   %eax
+    12a9:	e8 65 f1 ff ff       	call   413 <setvar>
+    12ae:	83 c4 10             	add    $0x10,%esp
+        runblock(l+i+1, j-i-1);
+    12b1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12b4:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    12b7:	8d 50 ff             	lea    -0x1(%eax),%edx
+    12ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12bd:	83 c0 01             	add    $0x1,%eax
+    12c0:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+    12c7:	8b 45 08             	mov    0x8(%ebp),%eax
+    12ca:	01 c8                	add    %ecx,%eax
+    12cc:	83 ec 08             	sub    $0x8,%esp
+    12cf:	52                   	push   %edx
+    12d0:	50                   	push   %eax
+    12d1:	e8 12 fe ff ff       	call   10e8 <runblock>
+    12d6:	83 c4 10             	add    $0x10,%esp
+      for(k = 2; k < nw; k++){
+    12d9:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    12dd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    12e0:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+    12e3:	7c af                	jl     1294 <runblock+0x1ac>
+    12e5:	e9 5c 01 00 00       	jmp    1446 <runblock+0x35e>
+      }
+    } else if((s = firstword(l[i], "while")) != 0){
+    12ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12ed:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    12f4:	8b 45 08             	mov    0x8(%ebp),%eax
+    12f7:	01 d0                	add    %edx,%eax
+    12f9:	8b 00                	mov    (%eax),%eax
+    12fb:	83 ec 08             	sub    $0x8,%esp
+    12fe:	68 06 2c 00 00       	push   $0x2c06
+    1303:	50                   	push   %eax
+    1304:	e8 58 f7 ff ff       	call   a61 <firstword>
+    1309:	83 c4 10             	add    $0x10,%esp
+    130c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    130f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1313:	74 51                	je     1366 <runblock+0x27e>
+      for(;;){
+        runline(s);
+    1315:	83 ec 0c             	sub    $0xc,%esp
+    1318:	ff 75 e8             	push   -0x18(%ebp)
+    131b:	e8 40 fc ff ff       	call   f60 <runline>
+    1320:	83 c4 10             	add    $0x10,%esp
+        if(status != 0)
+    1323:	a1 60 46 00 00       	mov    0x4660,%eax
+    1328:	85 c0                	test   %eax,%eax
+    132a:	75 2a                	jne    1356 <runblock+0x26e>
+          break;
+        runblock(l+i+1, j-i-1);
+    132c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    132f:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    1332:	8d 50 ff             	lea    -0x1(%eax),%edx
+    1335:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1338:	83 c0 01             	add    $0x1,%eax
+    133b:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+    1342:	8b 45 08             	mov    0x8(%ebp),%eax
+    1345:	01 c8                	add    %ecx,%eax
+    1347:	83 ec 08             	sub    $0x8,%esp
+    134a:	52                   	push   %edx
+    134b:	50                   	push   %eax
+    134c:	e8 97 fd ff ff       	call   10e8 <runblock>
+    1351:	83 c4 10             	add    $0x10,%esp
+        runline(s);
+    1354:	eb bf                	jmp    1315 <runblock+0x22d>
+          break;
+    1356:	90                   	nop
+      }
+      status = 0;
+    1357:	c7 05 60 46 00 00 00 	movl   $0x0,0x4660
+    135e:	00 00 00 
+    1361:	e9 e0 00 00 00       	jmp    1446 <runblock+0x35e>
+    } else if((s = firstword(l[i], "if")) != 0){
+    1366:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1369:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    1370:	8b 45 08             	mov    0x8(%ebp),%eax
+    1373:	01 d0                	add    %edx,%eax
+    1375:	8b 00                	mov    (%eax),%eax
+    1377:	83 ec 08             	sub    $0x8,%esp
+    137a:	68 0c 2c 00 00       	push   $0x2c0c
+    137f:	50                   	push   %eax
+    1380:	e8 dc f6 ff ff       	call   a61 <firstword>
+    1385:	83 c4 10             	add    $0x10,%esp
+    1388:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    138b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    138f:	0f 84 94 00 00 00    	je     1429 <runblock+0x341>
+      runline(s);
+    1395:	83 ec 0c             	sub    $0xc,%esp
+    1398:	ff 75 e8             	push   -0x18(%ebp)
+    139b:	e8 c0 fb ff ff       	call   f60 <runline>
+    13a0:	83 c4 10             	add    $0x10,%esp
+      if(e < 0)
+    13a3:	8b 85 38 ff ff ff    	mov    -0xc8(%ebp),%eax
+    13a9:	85 c0                	test   %eax,%eax
+    13ab:	79 09                	jns    13b6 <runblock+0x2ce>
+        e = j;
+    13ad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    13b0:	89 85 38 ff ff ff    	mov    %eax,-0xc8(%ebp)
+      if(status == 0)
+    13b6:	a1 60 46 00 00       	mov    0x4660,%eax
+    13bb:	85 c0                	test   %eax,%eax
+    13bd:	75 2d                	jne    13ec <runblock+0x304>
+        runblock(l+i+1, e-i-1);
+    13bf:	8b 85 38 ff ff ff    	mov    -0xc8(%ebp),%eax
+    13c5:	2b 45 f4             	sub    -0xc(%ebp),%eax
+    13c8:	8d 50 ff             	lea    -0x1(%eax),%edx
+    13cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13ce:	83 c0 01             	add    $0x1,%eax
+    13d1:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+    13d8:	8b 45 08             	mov    0x8(%ebp),%eax
+    13db:	01 c8                	add    %ecx,%eax
+    13dd:	83 ec 08             	sub    $0x8,%esp
+    13e0:	52                   	push   %edx
+    13e1:	50                   	push   %eax
+    13e2:	e8 01 fd ff ff       	call   10e8 <runblock>
+    13e7:	83 c4 10             	add    $0x10,%esp
+    13ea:	eb 5a                	jmp    1446 <runblock+0x35e>
+      else if(e < j)
+    13ec:	8b 85 38 ff ff ff    	mov    -0xc8(%ebp),%eax
+    13f2:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    13f5:	7e 4f                	jle    1446 <runblock+0x35e>
+        runblock(l+e+1, j-e-1);
+    13f7:	8b 85 38 ff ff ff    	mov    -0xc8(%ebp),%eax
+    13fd:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    1400:	29 c2                	sub    %eax,%edx
+    1402:	83 ea 01             	sub    $0x1,%edx
+    1405:	8b 85 38 ff ff ff    	mov    -0xc8(%ebp),%eax
+    140b:	83 c0 01             	add    $0x1,%eax
+    140e:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+    1415:	8b 45 08             	mov    0x8(%ebp),%eax
+    1418:	01 c8                	add    %ecx,%eax
+    141a:	83 ec 08             	sub    $0x8,%esp
+    141d:	52                   	push   %edx
+    141e:	50                   	push   %eax
+    141f:	e8 c4 fc ff ff       	call   10e8 <runblock>
+    1424:	83 c4 10             	add    $0x10,%esp
+    1427:	eb 1d                	jmp    1446 <runblock+0x35e>
+    } else
+      runline(l[i]);
+    1429:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    142c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    1433:	8b 45 08             	mov    0x8(%ebp),%eax
+    1436:	01 d0                	add    %edx,%eax
+    1438:	8b 00                	mov    (%eax),%eax
+    143a:	83 ec 0c             	sub    $0xc,%esp
+    143d:	50                   	push   %eax
+    143e:	e8 1d fb ff ff       	call   f60 <runline>
+    1443:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i = j+1){
+    1446:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1449:	83 c0 01             	add    $0x1,%eax
+    144c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    144f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1452:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    1455:	0f 8c a2 fc ff ff    	jl     10fd <runblock+0x15>
+  }
+}
+    145b:	c9                   	leave
+    145c:	c3                   	ret
+
+0000145d <getline>:
+
+// Read a line from infd; return 0 at end of input.
+int
+getline(char *buf, int nbuf)
+{
+    145d:	55                   	push   %ebp
+    145e:	89 e5                	mov    %esp,%ebp
+    1460:	83 ec 18             	sub    $0x18,%esp
+  static char rbuf[512];
+  static int r, w;
+  int i;
+
+  for(i = 0; i < nbuf-1; ){
+    1463:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    146a:	e9 97 00 00 00       	jmp    1506 <getline+0xa9>
+    if(r == w){
+    146f:	8b 15 74 46 00 00    	mov    0x4674,%edx
+    1475:	a1 78 46 00 00       	mov    0x4678,%eax
+    147a:	39 c2                	cmp    %eax,%edx
+    147c:	75 5a                	jne    14d8 <getline+0x7b>
+      // Read the console a line at a time so that commands
+      // run in a child get the input meant for them.
+      if((w = read(infd, rbuf, interactive ? 1 : sizeof(rbuf))) <= 0){
+    147e:	a1 70 46 00 00       	mov    0x4670,%eax
+    1483:	85 c0                	test   %eax,%eax
+    1485:	74 07                	je     148e <getline+0x31>
+    1487:	ba 01 00 00 00       	mov    $0x1,%edx
+    148c:	eb 05                	jmp    1493 <getline+0x36>
+    148e:	ba 00 02 00 00       	mov    $0x200,%edx
+    1493:	a1 6c 46 00 00       	mov    0x466c,%eax
+    1498:	83 ec 04             	sub    $0x4,%esp
+    149b:	52                   	push   %edx
+    149c:	68 80 46 00 00       	push   $0x4680
+    14a1:	50                   	push   %eax
+    14a2:	e8 96 10 00 00       	call   253d <read>
+    14a7:	83 c4 10             	add    $0x10,%esp
+    14aa:	a3 78 46 00 00       	mov    %eax,0x4678
+    14af:	a1 78 46 00 00       	mov    0x4678,%eax
+    14b4:	85 c0                	test   %eax,%eax
+    14b6:	7f 16                	jg     14ce <getline+0x71>
+        w = r = 0;
+    14b8:	c7 05 74 46 00 00 00 	movl   $0x0,0x4674
+    14bf:	00 00 00 
+    14c2:	a1 74 46 00 00       	mov    0x4674,%eax
+    14c7:	a3 78 46 00 00       	mov    %eax,0x4678
+        break;
+    14cc:	eb 4a                	jmp    1518 <getline+0xbb>
+      }
+      r = 0;
+    14ce:	c7 05 74 46 00 00 00 	movl   $0x0,0x4674
+    14d5:	00 00 00 
+    }
+    if((buf[i++] = rbuf[r++]) == '\n')
+    14d8:	a1 74 46 00 00       	mov    0x4674,%eax
+    14dd:	8d 50 01             	lea    0x1(%eax),%edx
+    14e0:	89 15 74 46 00 00    	mov    %edx,0x4674
+    14e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    14e9:	8d 4a 01             	lea    0x1(%edx),%ecx
+    14ec:	89 4d f4             	mov    %ecx,-0xc(%ebp)
+    14ef:	89 d1                	mov    %edx,%ecx
+    14f1:	8b 55 08             	mov    0x8(%ebp),%edx
+    14f4:	01 ca                	add    %ecx,%edx
+    14f6:	0f b6 80 80 46 00 00 	movzbl 0x4680(%eax),%eax
+    14fd:	88 02                	mov    %al,(%edx)
+    14ff:	0f b6 02             	movzbl (%edx),%eax
+    1502:	3c 0a                	cmp    $0xa,%al
+    1504:	74 11                	je     1517 <getline+0xba>
+  for(i = 0; i < nbuf-1; ){
+    1506:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1509:	83 e8 01             	sub    $0x1,%eax
+    150c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    150f:	0f 8c 5a ff ff ff    	jl     146f <getline+0x12>
+    1515:	eb 01                	jmp    1518 <getline+0xbb>
+      break;
+    1517:	90                   	nop
+  }
+  buf[i] = 0;
+    1518:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    151b:	8b 45 08             	mov    0x8(%ebp),%eax
+    151e:	01 d0                	add    %edx,%eax
+    1520:	c6 00 00             	movb   $0x0,(%eax)
+  if(i > 0 && buf[i-1] == '\n')
+    1523:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1527:	7e 20                	jle    1549 <getline+0xec>
+    1529:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    152c:	8d 50 ff             	lea    -0x1(%eax),%edx
+    152f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1532:	01 d0                	add    %edx,%eax
+    1534:	0f b6 00             	movzbl (%eax),%eax
+    1537:	3c 0a                	cmp    $0xa,%al
+    1539:	75 0e                	jne    1549 <getline+0xec>
+    buf[i-1] = 0;
+    153b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    153e:	8d 50 ff             	lea    -0x1(%eax),%edx
+    1541:	8b 45 08             	mov    0x8(%ebp),%eax
+    1544:	01 d0                	add    %edx,%eax
+    1546:	c6 00 00             	movb   $0x0,(%eax)
+  return i > 0;
+    1549:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    154d:	0f 9f c0             	setg   %al
+    1550:	0f b6 c0             	movzbl %al,%eax
+}
+    1553:	c9                   	leave
+    1554:	c3                   	ret
+
+00001555 <getstmt>:
+
+// Read one statement: a line, or a whole for/while/if block.
+// Return the number of lines, 0 at end of input.
+int
+getstmt(char **l)
+{
+    1555:	55                   	push   %ebp
+    1556:	89 e5                	mov    %esp,%ebp
+    1558:	53                   	push   %ebx
+    1559:	81 ec 94 00 00 00    	sub    $0x94,%esp
+  char buf[MAXLINE];
+  int n, d;
+
+  d = 0;
+    155f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(n = 0; n < MAXLINES; n++){
+    1566:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    156d:	e9 c4 00 00 00       	jmp    1636 <getstmt+0xe1>
+    if(interactive)
+    1572:	a1 70 46 00 00       	mov    0x4670,%eax
+    1577:	85 c0                	test   %eax,%eax
+    1579:	74 20                	je     159b <getstmt+0x46>
+      printf(2, d > 0 ? "> " : "$ ");
+    157b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    157f:	7e 07                	jle    1588 <getstmt+0x33>
+    1581:	b8 61 2c 00 00       	mov    $0x2c61,%eax
+    1586:	eb 05                	jmp    158d <getstmt+0x38>
+    1588:	b8 64 2c 00 00       	mov    $0x2c64,%eax
+    158d:	83 ec 08             	sub    $0x8,%esp
+    1590:	50                   	push   %eax
+    1591:	6a 02                	push   $0x2
+    1593:	e8 89 11 00 00       	call   2721 <printf>
+    1598:	83 c4 10             	add    $0x10,%esp
+    if(!getline(buf, sizeof(buf)))
+    159b:	83 ec 08             	sub    $0x8,%esp
+    159e:	68 80 00 00 00       	push   $0x80
+    15a3:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+    15a9:	50                   	push   %eax
+    15aa:	e8 ae fe ff ff       	call   145d <getline>
+    15af:	83 c4 10             	add    $0x10,%esp
+    15b2:	85 c0                	test   %eax,%eax
+    15b4:	0f 84 88 00 00 00    	je     1642 <getstmt+0xed>
+      break;
+    l[n] = malloc(strlen(buf)+1);
+    15ba:	83 ec 0c             	sub    $0xc,%esp
+    15bd:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+    15c3:	50                   	push   %eax
+    15c4:	e8 5c 0d 00 00       	call   2325 <strlen>
+    15c9:	83 c4 10             	add    $0x10,%esp
+    15cc:	83 c0 01             	add    $0x1,%eax
+    15cf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    15d2:	8d 0c 95 00 00 00 00 	lea    0x0(,%edx,4),%ecx
+    15d9:	8b 55 08             	mov    0x8(%ebp),%edx
+    15dc:	8d 1c 11             	lea    (%ecx,%edx,1),%ebx
+    15df:	83 ec 0c             	sub    $0xc,%esp
+    15e2:	50                   	push   %eax
+    15e3:	e8 0d 14 00 00       	call   29f5 <malloc>
+    15e8:	83 c4 10             	add    $0x10,%esp
+    15eb:	89 03                	mov    %eax,(%ebx)
+    strcpy(l[n], buf);
+    15ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15f0:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+    15f7:	8b 45 08             	mov    0x8(%ebp),%eax
+    15fa:	01 d0                	add    %edx,%eax
+    15fc:	8b 00                	mov    (%eax),%eax
+    15fe:	83 ec 08             	sub    $0x8,%esp
+    1601:	8d 95 70 ff ff ff    	lea    -0x90(%ebp),%edx
+    1607:	52                   	push   %edx
+    1608:	50                   	push   %eax
+    1609:	e8 a8 0c 00 00       	call   22b6 <strcpy>
+    160e:	83 c4 10             	add    $0x10,%esp
+    if((d += nesting(buf)) <= 0){
+    1611:	83 ec 0c             	sub    $0xc,%esp
+    1614:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+    161a:	50                   	push   %eax
+    161b:	e8 b2 f9 ff ff       	call   fd2 <nesting>
+    1620:	83 c4 10             	add    $0x10,%esp
+    1623:	01 45 f0             	add    %eax,-0x10(%ebp)
+    1626:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    162a:	7f 06                	jg     1632 <getstmt+0xdd>
+      n++;
+    162c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      break;
+    1630:	eb 11                	jmp    1643 <getstmt+0xee>
+  for(n = 0; n < MAXLINES; n++){
+    1632:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1636:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+    163a:	0f 8e 32 ff ff ff    	jle    1572 <getstmt+0x1d>
+    1640:	eb 01                	jmp    1643 <getstmt+0xee>
+      break;
+    1642:	90                   	nop
+    }
+  }
+  return n;
+    1643:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1646:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1649:	c9                   	leave
+    164a:	c3                   	ret
+
+0000164b <main>:
+
+int
+main(int argc, char *argv[])
+{
+    164b:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    164f:	83 e4 f0             	and    $0xfffffff0,%esp
+    1652:	ff 71 fc             	push   -0x4(%ecx)
+    1655:	55                   	push   %ebp
+    1656:	89 e5                	mov    %esp,%ebp
+    1658:	53                   	push   %ebx
+    1659:	51                   	push   %ecx
+    165a:	81 ec 10 01 00 00    	sub    $0x110,%esp
+    1660:	89 cb                	mov    %ecx,%ebx
+  char *lines[MAXLINES];
+  int fd, i, n;
+  
+  // Assumes three file descriptors open.
+  while((fd = open("console", O_RDWR)) >= 0){
+    1662:	eb 16                	jmp    167a <main+0x2f>
+    if(fd >= 3){
+    1664:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    1668:	7e 10                	jle    167a <main+0x2f>
+      close(fd);
+    166a:	83 ec 0c             	sub    $0xc,%esp
+    166d:	ff 75 f0             	push   -0x10(%ebp)
+    1670:	e8 d8 0e 00 00       	call   254d <close>
+    1675:	83 c4 10             	add    $0x10,%esp
+      break;
+    1678:	eb 1b                	jmp    1695 <main+0x4a>
+  while((fd = open("console", O_RDWR)) >= 0){
+    167a:	83 ec 08             	sub    $0x8,%esp
+    167d:	6a 02                	push   $0x2
+    167f:	68 67 2c 00 00       	push   $0x2c67
+    1684:	e8 dc 0e 00 00       	call   2565 <open>
+    1689:	83 c4 10             	add    $0x10,%esp
+    168c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    168f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1693:	79 cf                	jns    1664 <main+0x19>
+    }
+  }
+
+  infd = 0;
+    1695:	c7 05 6c 46 00 00 00 	movl   $0x0,0x466c
+    169c:	00 00 00 
+  interactive = 1;
+    169f:	c7 05 70 46 00 00 01 	movl   $0x1,0x4670
+    16a6:	00 00 00 
+  if(argc > 1){
+    16a9:	83 3b 01             	cmpl   $0x1,(%ebx)
+    16ac:	0f 8e aa 00 00 00    	jle    175c <main+0x111>
+    if((infd = open(argv[1], O_RDONLY)) < 0){
+    16b2:	8b 43 04             	mov    0x4(%ebx),%eax
+    16b5:	83 c0 04             	add    $0x4,%eax
+    16b8:	8b 00                	mov    (%eax),%eax
+    16ba:	83 ec 08             	sub    $0x8,%esp
+    16bd:	6a 00                	push   $0x0
+    16bf:	50                   	push   %eax
+    16c0:	e8 a0 0e 00 00       	call   2565 <open>
+    16c5:	83 c4 10             	add    $0x10,%esp
+    16c8:	a3 6c 46 00 00       	mov    %eax,0x466c
+    16cd:	a1 6c 46 00 00       	mov    0x466c,%eax
+    16d2:	85 c0                	test   %eax,%eax
+    16d4:	79 25                	jns    16fb <main+0xb0>
+      printf(2, "sh: cannot open %s\n", argv[1]);
+    16d6:	8b 43 04             	mov    0x4(%ebx),%eax
+    16d9:	83 c0 04             	add    $0x4,%eax
+    16dc:	8b 00                	mov    (%eax),%eax
+    16de:	83 ec 04             	sub    $0x4,%esp
+    16e1:	50                   	push   %eax
+    16e2:	68 6f 2c 00 00       	push   $0x2c6f
+    16e7:	6a 02                	push   $0x2
+    16e9:	e8 33 10 00 00       	call   2721 <printf>
+    16ee:	83 c4 10             	add    $0x10,%esp
+      exits(1);
+    16f1:	83 ec 0c             	sub    $0xc,%esp
+    16f4:	6a 01                	push   $0x1
+    16f6:	e8 22 0f 00 00       	call   261d <exits>
+    }
+    interactive = 0;
+    16fb:	c7 05 70 46 00 00 00 	movl   $0x0,0x4670
+    1702:	00 00 00 
+    args = argv+1;
+    1705:	8b 43 04             	mov    0x4(%ebx),%eax
+    1708:	83 c0 04             	add    $0x4,%eax
+    170b:	a3 64 46 00 00       	mov    %eax,0x4664
+    nargs = argc-1;
+    1710:	8b 03                	mov    (%ebx),%eax
+    1712:	83 e8 01             	sub    $0x1,%eax
+    1715:	a3 68 46 00 00       	mov    %eax,0x4668
+  }
+  
+  // Read and run input commands.
+  while((n = getstmt(lines)) > 0){
+    171a:	eb 40                	jmp    175c <main+0x111>
+    runblock(lines, n);
+    171c:	83 ec 08             	sub    $0x8,%esp
+    171f:	ff 75 ec             	push   -0x14(%ebp)
+    1722:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+    1728:	50                   	push   %eax
+    1729:	e8 ba f9 ff ff       	call   10e8 <runblock>
+    172e:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++)
+    1731:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1738:	eb 1a                	jmp    1754 <main+0x109>
+      free(lines[i]);
+    173a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    173d:	8b 84 85 ec fe ff ff 	mov    -0x114(%ebp,%eax,4),%eax
+    1744:	83 ec 0c             	sub    $0xc,%esp
+    1747:	50                   	push   %eax
+    1748:	e8 66 11 00 00       	call   28b3 <free>
+    174d:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++)
+    1750:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1754:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1757:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    175a:	7c de                	jl     173a <main+0xef>
+  while((n = getstmt(lines)) > 0){
+    175c:	83 ec 0c             	sub    $0xc,%esp
+    175f:	8d 85 ec fe ff ff    	lea    -0x114(%ebp),%eax
+    1765:	50                   	push   %eax
+    1766:	e8 ea fd ff ff       	call   1555 <getstmt>
+    176b:	83 c4 10             	add    $0x10,%esp
+    176e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1771:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1775:	7f a5                	jg     171c <main+0xd1>
+  }
+  exits(status);
+    1777:	a1 60 46 00 00       	mov    0x4660,%eax
+    177c:	83 ec 0c             	sub    $0xc,%esp
+    177f:	50                   	push   %eax
+    1780:	e8 98 0e 00 00       	call   261d <exits>
+
+00001785 <panic>:
+}
+
+void
+panic(char *s)
+{
+    1785:	55                   	push   %ebp
+    1786:	89 e5                	mov    %esp,%ebp
+    1788:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "%s\n", s);
+    178b:	83 ec 04             	sub    $0x4,%esp
+    178e:	ff 75 08             	push   0x8(%ebp)
+    1791:	68 83 2c 00 00       	push   $0x2c83
+    1796:	6a 02                	push   $0x2
+    1798:	e8 84 0f 00 00       	call   2721 <printf>
+    179d:	83 c4 10             	add    $0x10,%esp
+  exit();
+    17a0:	e8 80 0d 00 00       	call   2525 <exit>
+
+000017a5 <fork1>:
+}
+
+int
+fork1(void)
+{
+    17a5:	55                   	push   %ebp
+    17a6:	89 e5                	mov    %esp,%ebp
+    17a8:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+  
+  pid = fork();
+    17ab:	e8 6d 0d 00 00       	call   251d <fork>
+    17b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid == -1)
+    17b3:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    17b7:	75 10                	jne    17c9 <fork1+0x24>
+    panic("fork");
+    17b9:	83 ec 0c             	sub    $0xc,%esp
+    17bc:	68 87 2c 00 00       	push   $0x2c87
+    17c1:	e8 bf ff ff ff       	call   1785 <panic>
+    17c6:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    17c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    17cc:	c9                   	leave
+    17cd:	c3                   	ret
+
+000017ce <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+    17ce:	55                   	push   %ebp
+    17cf:	89 e5                	mov    %esp,%ebp
+    17d1:	83 ec 18             	sub    $0x18,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    17d4:	83 ec 0c             	sub    $0xc,%esp
+    17d7:	6a 54                	push   $0x54
+    17d9:	e8 17 12 00 00       	call   29f5 <malloc>
+    17de:	83 c4 10             	add    $0x10,%esp
+    17e1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+    17e4:	83 ec 04             	sub    $0x4,%esp
+    17e7:	6a 54                	push   $0x54
+    17e9:	6a 00                	push   $0x0
+    17eb:	ff 75 f4             	push   -0xc(%ebp)
+    17ee:	e8 59 0b 00 00       	call   234c <memset>
+    17f3:	83 c4 10             	add    $0x10,%esp
+  cmd->type = EXEC;
+    17f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    17f9:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  return (struct cmd*)cmd;
+    17ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1802:	c9                   	leave
+    1803:	c3                   	ret
+
+00001804 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+    1804:	55                   	push   %ebp
+    1805:	89 e5                	mov    %esp,%ebp
+    1807:	83 ec 18             	sub    $0x18,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    180a:	83 ec 0c             	sub    $0xc,%esp
+    180d:	6a 18                	push   $0x18
+    180f:	e8 e1 11 00 00       	call   29f5 <malloc>
+    1814:	83 c4 10             	add    $0x10,%esp
+    1817:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+    181a:	83 ec 04             	sub    $0x4,%esp
+    181d:	6a 18                	push   $0x18
+    181f:	6a 00                	push   $0x0
+    1821:	ff 75 f4             	push   -0xc(%ebp)
+    1824:	e8 23 0b 00 00       	call   234c <memset>
+    1829:	83 c4 10             	add    $0x10,%esp
+  cmd->type = REDIR;
+    182c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    182f:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+  cmd->cmd = subcmd;
+    1835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1838:	8b 55 08             	mov    0x8(%ebp),%edx
+    183b:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->file = file;
+    183e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1841:	8b 55 0c             	mov    0xc(%ebp),%edx
+    1844:	89 50 08             	mov    %edx,0x8(%eax)
+  cmd->efile = efile;
+    1847:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    184a:	8b 55 10             	mov    0x10(%ebp),%edx
+    184d:	89 50 0c             	mov    %edx,0xc(%eax)
+  cmd->mode = mode;
+    1850:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1853:	8b 55 14             	mov    0x14(%ebp),%edx
+    1856:	89 50 10             	mov    %edx,0x10(%eax)
+  cmd->fd = fd;
+    1859:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    185c:	8b 55 18             	mov    0x18(%ebp),%edx
+    185f:	89 50 14             	mov    %edx,0x14(%eax)
+  return (struct cmd*)cmd;
+    1862:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1865:	c9                   	leave
+    1866:	c3                   	ret
+
+00001867 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+    1867:	55                   	push   %ebp
+    1868:	89 e5                	mov    %esp,%ebp
+    186a:	83 ec 18             	sub    $0x18,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    186d:	83 ec 0c             	sub    $0xc,%esp
+    1870:	6a 0c                	push   $0xc
+    1872:	e8 7e 11 00 00       	call   29f5 <malloc>
+    1877:	83 c4 10             	add    $0x10,%esp
+    187a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+    187d:	83 ec 04             	sub    $0x4,%esp
+    1880:	6a 0c                	push   $0xc
+    1882:	6a 00                	push   $0x0
+    1884:	ff 75 f4             	push   -0xc(%ebp)
+    1887:	e8 c0 0a 00 00       	call   234c <memset>
+    188c:	83 c4 10             	add    $0x10,%esp
+  cmd->type = PIPE;
+    188f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1892:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+  cmd->left = left;
+    1898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    189b:	8b 55 08             	mov    0x8(%ebp),%edx
+    189e:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+    18a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18a7:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+    18aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    18ad:	c9                   	leave
+    18ae:	c3                   	ret
+
+000018af <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+    18af:	55                   	push   %ebp
+    18b0:	89 e5                	mov    %esp,%ebp
+    18b2:	83 ec 18             	sub    $0x18,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    18b5:	83 ec 0c             	sub    $0xc,%esp
+    18b8:	6a 0c                	push   $0xc
+    18ba:	e8 36 11 00 00       	call   29f5 <malloc>
+    18bf:	83 c4 10             	add    $0x10,%esp
+    18c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+    18c5:	83 ec 04             	sub    $0x4,%esp
+    18c8:	6a 0c                	push   $0xc
+    18ca:	6a 00                	push   $0x0
+    18cc:	ff 75 f4             	push   -0xc(%ebp)
+    18cf:	e8 78 0a 00 00       	call   234c <memset>
+    18d4:	83 c4 10             	add    $0x10,%esp
+  cmd->type = LIST;
+    18d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18da:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+  cmd->left = left;
+    18e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18e3:	8b 55 08             	mov    0x8(%ebp),%edx
+    18e6:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+    18e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+    18ef:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+    18f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    18f5:	c9                   	leave
+    18f6:	c3                   	ret
+
+000018f7 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+    18f7:	55                   	push   %ebp
+    18f8:	89 e5                	mov    %esp,%ebp
+    18fa:	83 ec 18             	sub    $0x18,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    18fd:	83 ec 0c             	sub    $0xc,%esp
+    1900:	6a 08                	push   $0x8
+    1902:	e8 ee 10 00 00       	call   29f5 <malloc>
+    1907:	83 c4 10             	add    $0x10,%esp
+    190a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+    190d:	83 ec 04             	sub    $0x4,%esp
+    1910:	6a 08                	push   $0x8
+    1912:	6a 00                	push   $0x0
+    1914:	ff 75 f4             	push   -0xc(%ebp)
+    1917:	e8 30 0a 00 00       	call   234c <memset>
+    191c:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+    191f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1922:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+  cmd->cmd = subcmd;
+    1928:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    192b:	8b 55 08             	mov    0x8(%ebp),%edx
+    192e:	89 50 04             	mov    %edx,0x4(%eax)
+  return (struct cmd*)cmd;
+    1931:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1934:	c9                   	leave
+    1935:	c3                   	ret
+
+00001936 <timecmd>:
+
+struct cmd*
+timecmd(struct cmd *subcmd)
+{
+    1936:	55                   	push   %ebp
+    1937:	89 e5                	mov    %esp,%ebp
+    1939:	83 ec 18             	sub    $0x18,%esp
+  struct timecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    193c:	83 ec 0c             	sub    $0xc,%esp
+    193f:	6a 08                	push   $0x8
+    1941:	e8 af 10 00 00       	call   29f5 <malloc>
+    1946:	83 c4 10             	add    $0x10,%esp
+    1949:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+    194c:	83 ec 04             	sub    $0x4,%esp
+    194f:	6a 08                	push   $0x8
+    1951:	6a 00                	push   $0x0
+    1953:	ff 75 f4             	push   -0xc(%ebp)
+    1956:	e8 f1 09 00 00       	call   234c <memset>
+    195b:	83 c4 10             	add    $0x10,%esp
+  cmd->type = TIME;
+    195e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1961:	c7 00 06 00 00 00    	movl   $0x6,(%eax)
+  cmd->cmd = subcmd;
+    1967:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    196a:	8b 55 08             	mov    0x8(%ebp),%edx
+    196d:	89 50 04             	mov    %edx,0x4(%eax)
+  return (struct cmd*)cmd;
+    1970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1973:	c9                   	leave
+    1974:	c3                   	ret
+
+00001975 <parcmd>:
+
+struct cmd*
+parcmd(int n, struct cmd *subcmd)
+{
+    1975:	55                   	push   %ebp
+    1976:	89 e5                	mov    %esp,%ebp
+    1978:	83 ec 18             	sub    $0x18,%esp
+  struct parcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+    197b:	83 ec 0c             	sub    $0xc,%esp
+    197e:	6a 0c                	push   $0xc
+    1980:	e8 70 10 00 00       	call   29f5 <malloc>
+    1985:	83 c4 10             	add    $0x10,%esp
+    1988:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+    198b:	83 ec 04             	sub    $0x4,%esp
+    198e:	6a 0c                	push   $0xc
+    1990:	6a 00                	push   $0x0
+    1992:	ff 75 f4             	push   -0xc(%ebp)
+    1995:	e8 b2 09 00 00       	call   234c <memset>
+    199a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = PAR;
+    199d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19a0:	c7 00 07 00 00 00    	movl   $0x7,(%eax)
+  cmd->n = n;
+    19a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19a9:	8b 55 08             	mov    0x8(%ebp),%edx
+    19ac:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->cmd = subcmd;
+    19af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+    19b5:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+    19b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    19bb:	c9                   	leave
+    19bc:	c3                   	ret
+
+000019bd <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+    19bd:	55                   	push   %ebp
+    19be:	89 e5                	mov    %esp,%ebp
+    19c0:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+  int ret;
+  
+  s = *ps;
+    19c3:	8b 45 08             	mov    0x8(%ebp),%eax
+    19c6:	8b 00                	mov    (%eax),%eax
+    19c8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+    19cb:	eb 04                	jmp    19d1 <gettoken+0x14>
+    s++;
+    19cd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+    19d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19d4:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    19d7:	73 1e                	jae    19f7 <gettoken+0x3a>
+    19d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19dc:	0f b6 00             	movzbl (%eax),%eax
+    19df:	0f be c0             	movsbl %al,%eax
+    19e2:	83 ec 08             	sub    $0x8,%esp
+    19e5:	50                   	push   %eax
+    19e6:	68 38 34 00 00       	push   $0x3438
+    19eb:	e8 76 09 00 00       	call   2366 <strchr>
+    19f0:	83 c4 10             	add    $0x10,%esp
+    19f3:	85 c0                	test   %eax,%eax
+    19f5:	75 d6                	jne    19cd <gettoken+0x10>
+  if(q)
+    19f7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    19fb:	74 08                	je     1a05 <gettoken+0x48>
+    *q = s;
+    19fd:	8b 45 10             	mov    0x10(%ebp),%eax
+    1a00:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1a03:	89 10                	mov    %edx,(%eax)
+  ret = *s;
+    1a05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a08:	0f b6 00             	movzbl (%eax),%eax
+    1a0b:	0f be c0             	movsbl %al,%eax
+    1a0e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  switch(*s){
+    1a11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a14:	0f b6 00             	movzbl (%eax),%eax
+    1a17:	0f be c0             	movsbl %al,%eax
+    1a1a:	83 f8 7c             	cmp    $0x7c,%eax
+    1a1d:	74 2c                	je     1a4b <gettoken+0x8e>
+    1a1f:	83 f8 7c             	cmp    $0x7c,%eax
+    1a22:	7f 48                	jg     1a6c <gettoken+0xaf>
+    1a24:	83 f8 3e             	cmp    $0x3e,%eax
+    1a27:	74 28                	je     1a51 <gettoken+0x94>
+    1a29:	83 f8 3e             	cmp    $0x3e,%eax
+    1a2c:	7f 3e                	jg     1a6c <gettoken+0xaf>
+    1a2e:	83 f8 3c             	cmp    $0x3c,%eax
+    1a31:	7f 39                	jg     1a6c <gettoken+0xaf>
+    1a33:	83 f8 3b             	cmp    $0x3b,%eax
+    1a36:	7d 13                	jge    1a4b <gettoken+0x8e>
+    1a38:	83 f8 29             	cmp    $0x29,%eax
+    1a3b:	7f 2f                	jg     1a6c <gettoken+0xaf>
+    1a3d:	83 f8 28             	cmp    $0x28,%eax
+    1a40:	7d 09                	jge    1a4b <gettoken+0x8e>
+    1a42:	85 c0                	test   %eax,%eax
+    1a44:	74 79                	je     1abf <gettoken+0x102>
+    1a46:	83 f8 26             	cmp    $0x26,%eax
+    1a49:	75 21                	jne    1a6c <gettoken+0xaf>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+    1a4b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    break;
+    1a4f:	eb 75                	jmp    1ac6 <gettoken+0x109>
+  case '>':
+    s++;
+    1a51:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(*s == '>'){
+    1a55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a58:	0f b6 00             	movzbl (%eax),%eax
+    1a5b:	3c 3e                	cmp    $0x3e,%al
+    1a5d:	75 63                	jne    1ac2 <gettoken+0x105>
+      ret = '+';
+    1a5f:	c7 45 f0 2b 00 00 00 	movl   $0x2b,-0x10(%ebp)
+      s++;
+    1a66:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    }
+    break;
+    1a6a:	eb 56                	jmp    1ac2 <gettoken+0x105>
+  default:
+    ret = 'a';
+    1a6c:	c7 45 f0 61 00 00 00 	movl   $0x61,-0x10(%ebp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+    1a73:	eb 04                	jmp    1a79 <gettoken+0xbc>
+      s++;
+    1a75:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+    1a79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a7c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    1a7f:	73 44                	jae    1ac5 <gettoken+0x108>
+    1a81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1a84:	0f b6 00             	movzbl (%eax),%eax
+    1a87:	0f be c0             	movsbl %al,%eax
+    1a8a:	83 ec 08             	sub    $0x8,%esp
+    1a8d:	50                   	push   %eax
+    1a8e:	68 38 34 00 00       	push   $0x3438
+    1a93:	e8 ce 08 00 00       	call   2366 <strchr>
+    1a98:	83 c4 10             	add    $0x10,%esp
+    1a9b:	85 c0                	test   %eax,%eax
+    1a9d:	75 26                	jne    1ac5 <gettoken+0x108>
+    1a9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1aa2:	0f b6 00             	movzbl (%eax),%eax
+    1aa5:	0f be c0             	movsbl %al,%eax
+    1aa8:	83 ec 08             	sub    $0x8,%esp
+    1aab:	50                   	push   %eax
+    1aac:	68 40 34 00 00       	push   $0x3440
+    1ab1:	e8 b0 08 00 00       	call   2366 <strchr>
+    1ab6:	83 c4 10             	add    $0x10,%esp
+    1ab9:	85 c0                	test   %eax,%eax
+    1abb:	74 b8                	je     1a75 <gettoken+0xb8>
+    break;
+    1abd:	eb 06                	jmp    1ac5 <gettoken+0x108>
+    break;
+    1abf:	90                   	nop
+    1ac0:	eb 04                	jmp    1ac6 <gettoken+0x109>
+    break;
+    1ac2:	90                   	nop
+    1ac3:	eb 01                	jmp    1ac6 <gettoken+0x109>
+    break;
+    1ac5:	90                   	nop
+  }
+  if(eq)
+    1ac6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    1aca:	74 0e                	je     1ada <gettoken+0x11d>
+    *eq = s;
+    1acc:	8b 45 14             	mov    0x14(%ebp),%eax
+    1acf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1ad2:	89 10                	mov    %edx,(%eax)
+  
+  while(s < es && strchr(whitespace, *s))
+    1ad4:	eb 04                	jmp    1ada <gettoken+0x11d>
+    s++;
+    1ad6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+    1ada:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1add:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    1ae0:	73 1e                	jae    1b00 <gettoken+0x143>
+    1ae2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ae5:	0f b6 00             	movzbl (%eax),%eax
+    1ae8:	0f be c0             	movsbl %al,%eax
+    1aeb:	83 ec 08             	sub    $0x8,%esp
+    1aee:	50                   	push   %eax
+    1aef:	68 38 34 00 00       	push   $0x3438
+    1af4:	e8 6d 08 00 00       	call   2366 <strchr>
+    1af9:	83 c4 10             	add    $0x10,%esp
+    1afc:	85 c0                	test   %eax,%eax
+    1afe:	75 d6                	jne    1ad6 <gettoken+0x119>
+  *ps = s;
+    1b00:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b03:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1b06:	89 10                	mov    %edx,(%eax)
+  return ret;
+    1b08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1b0b:	c9                   	leave
+    1b0c:	c3                   	ret
+
+00001b0d <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+    1b0d:	55                   	push   %ebp
+    1b0e:	89 e5                	mov    %esp,%ebp
+    1b10:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+  
+  s = *ps;
+    1b13:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b16:	8b 00                	mov    (%eax),%eax
+    1b18:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+    1b1b:	eb 04                	jmp    1b21 <peek+0x14>
+    s++;
+    1b1d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+    1b21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b24:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    1b27:	73 1e                	jae    1b47 <peek+0x3a>
+    1b29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b2c:	0f b6 00             	movzbl (%eax),%eax
+    1b2f:	0f be c0             	movsbl %al,%eax
+    1b32:	83 ec 08             	sub    $0x8,%esp
+    1b35:	50                   	push   %eax
+    1b36:	68 38 34 00 00       	push   $0x3438
+    1b3b:	e8 26 08 00 00       	call   2366 <strchr>
+    1b40:	83 c4 10             	add    $0x10,%esp
+    1b43:	85 c0                	test   %eax,%eax
+    1b45:	75 d6                	jne    1b1d <peek+0x10>
+  *ps = s;
+    1b47:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b4a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1b4d:	89 10                	mov    %edx,(%eax)
+  return *s && strchr(toks, *s);
+    1b4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b52:	0f b6 00             	movzbl (%eax),%eax
+    1b55:	84 c0                	test   %al,%al
+    1b57:	74 23                	je     1b7c <peek+0x6f>
+    1b59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b5c:	0f b6 00             	movzbl (%eax),%eax
+    1b5f:	0f be c0             	movsbl %al,%eax
+    1b62:	83 ec 08             	sub    $0x8,%esp
+    1b65:	50                   	push   %eax
+    1b66:	ff 75 10             	push   0x10(%ebp)
+    1b69:	e8 f8 07 00 00       	call   2366 <strchr>
+    1b6e:	83 c4 10             	add    $0x10,%esp
+    1b71:	85 c0                	test   %eax,%eax
+    1b73:	74 07                	je     1b7c <peek+0x6f>
+    1b75:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b7a:	eb 05                	jmp    1b81 <peek+0x74>
+    1b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    1b81:	c9                   	leave
+    1b82:	c3                   	ret
+
+00001b83 <keyword>:
+
+// If the next word is kw, consume it and return 1.
+int
+keyword(char **ps, char *es, char *kw)
+{
+    1b83:	55                   	push   %ebp
+    1b84:	89 e5                	mov    %esp,%ebp
+    1b86:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+
+  s = *ps;
+    1b89:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b8c:	8b 00                	mov    (%eax),%eax
+    1b8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+    1b91:	eb 04                	jmp    1b97 <keyword+0x14>
+    s++;
+    1b93:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+    1b97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b9a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    1b9d:	73 28                	jae    1bc7 <keyword+0x44>
+    1b9f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ba2:	0f b6 00             	movzbl (%eax),%eax
+    1ba5:	0f be c0             	movsbl %al,%eax
+    1ba8:	83 ec 08             	sub    $0x8,%esp
+    1bab:	50                   	push   %eax
+    1bac:	68 38 34 00 00       	push   $0x3438
+    1bb1:	e8 b0 07 00 00       	call   2366 <strchr>
+    1bb6:	83 c4 10             	add    $0x10,%esp
+    1bb9:	85 c0                	test   %eax,%eax
+    1bbb:	75 d6                	jne    1b93 <keyword+0x10>
+  for(; *kw && s < es && *s == *kw; s++, kw++)
+    1bbd:	eb 08                	jmp    1bc7 <keyword+0x44>
+    1bbf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1bc3:	83 45 10 01          	addl   $0x1,0x10(%ebp)
+    1bc7:	8b 45 10             	mov    0x10(%ebp),%eax
+    1bca:	0f b6 00             	movzbl (%eax),%eax
+    1bcd:	84 c0                	test   %al,%al
+    1bcf:	74 18                	je     1be9 <keyword+0x66>
+    1bd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bd4:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    1bd7:	73 10                	jae    1be9 <keyword+0x66>
+    1bd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bdc:	0f b6 10             	movzbl (%eax),%edx
+    1bdf:	8b 45 10             	mov    0x10(%ebp),%eax
+    1be2:	0f b6 00             	movzbl (%eax),%eax
+    1be5:	38 c2                	cmp    %al,%dl
+    1be7:	74 d6                	je     1bbf <keyword+0x3c>
+    ;
+  if(*kw || (s < es && !strchr(whitespace, *s)))
+    1be9:	8b 45 10             	mov    0x10(%ebp),%eax
+    1bec:	0f b6 00             	movzbl (%eax),%eax
+    1bef:	84 c0                	test   %al,%al
+    1bf1:	75 26                	jne    1c19 <keyword+0x96>
+    1bf3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bf6:	3b 45 0c             	cmp    0xc(%ebp),%eax
+    1bf9:	73 25                	jae    1c20 <keyword+0x9d>
+    1bfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bfe:	0f b6 00             	movzbl (%eax),%eax
+    1c01:	0f be c0             	movsbl %al,%eax
+    1c04:	83 ec 08             	sub    $0x8,%esp
+    1c07:	50                   	push   %eax
+    1c08:	68 38 34 00 00       	push   $0x3438
+    1c0d:	e8 54 07 00 00       	call   2366 <strchr>
+    1c12:	83 c4 10             	add    $0x10,%esp
+    1c15:	85 c0                	test   %eax,%eax
+    1c17:	75 07                	jne    1c20 <keyword+0x9d>
+    return 0;
+    1c19:	b8 00 00 00 00       	mov    $0x0,%eax
+    1c1e:	eb 17                	jmp    1c37 <keyword+0xb4>
+  gettoken(ps, es, 0, 0);
+    1c20:	6a 00                	push   $0x0
+    1c22:	6a 00                	push   $0x0
+    1c24:	ff 75 0c             	push   0xc(%ebp)
+    1c27:	ff 75 08             	push   0x8(%ebp)
+    1c2a:	e8 8e fd ff ff       	call   19bd <gettoken>
+    1c2f:	83 c4 10             	add    $0x10,%esp
+  return 1;
+    1c32:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    1c37:	c9                   	leave
+    1c38:	c3                   	ret
+
+00001c39 <parsecmd>:
+struct cmd *parseexec(char**, char*);
+struct cmd *nulterminate(struct cmd*);
+
+struct cmd*
+parsecmd(char *s)
+{
+    1c39:	55                   	push   %ebp
+    1c3a:	89 e5                	mov    %esp,%ebp
+    1c3c:	53                   	push   %ebx
+    1c3d:	83 ec 14             	sub    $0x14,%esp
+  char *es;
+  struct cmd *cmd;
+
+  es = s + strlen(s);
+    1c40:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    1c43:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c46:	83 ec 0c             	sub    $0xc,%esp
+    1c49:	50                   	push   %eax
+    1c4a:	e8 d6 06 00 00       	call   2325 <strlen>
+    1c4f:	83 c4 10             	add    $0x10,%esp
+    1c52:	01 d8                	add    %ebx,%eax
+    1c54:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  cmd = parseline(&s, es);
+    1c57:	83 ec 08             	sub    $0x8,%esp
+    1c5a:	ff 75 f4             	push   -0xc(%ebp)
+    1c5d:	8d 45 08             	lea    0x8(%ebp),%eax
+    1c60:	50                   	push   %eax
+    1c61:	e8 61 00 00 00       	call   1cc7 <parseline>
+    1c66:	83 c4 10             	add    $0x10,%esp
+    1c69:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  peek(&s, es, "");
+    1c6c:	83 ec 04             	sub    $0x4,%esp
+    1c6f:	68 34 2b 00 00       	push   $0x2b34
+    1c74:	ff 75 f4             	push   -0xc(%ebp)
+    1c77:	8d 45 08             	lea    0x8(%ebp),%eax
+    1c7a:	50                   	push   %eax
+    1c7b:	e8 8d fe ff ff       	call   1b0d <peek>
+    1c80:	83 c4 10             	add    $0x10,%esp
+  if(s != es){
+    1c83:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c86:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    1c89:	74 26                	je     1cb1 <parsecmd+0x78>
+    printf(2, "leftovers: %s\n", s);
+    1c8b:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c8e:	83 ec 04             	sub    $0x4,%esp
+    1c91:	50                   	push   %eax
+    1c92:	68 8c 2c 00 00       	push   $0x2c8c
+    1c97:	6a 02                	push   $0x2
+    1c99:	e8 83 0a 00 00       	call   2721 <printf>
+    1c9e:	83 c4 10             	add    $0x10,%esp
+    panic("syntax");
+    1ca1:	83 ec 0c             	sub    $0xc,%esp
+    1ca4:	68 9b 2c 00 00       	push   $0x2c9b
+    1ca9:	e8 d7 fa ff ff       	call   1785 <panic>
+    1cae:	83 c4 10             	add    $0x10,%esp
+  }
+  nulterminate(cmd);
+    1cb1:	83 ec 0c             	sub    $0xc,%esp
+    1cb4:	ff 75 f0             	push   -0x10(%ebp)
+    1cb7:	e8 ad 04 00 00       	call   2169 <nulterminate>
+    1cbc:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+    1cbf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1cc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1cc5:	c9                   	leave
+    1cc6:	c3                   	ret
+
+00001cc7 <parseline>:
+
+struct cmd*
+parseline(char **ps, char *es)
+{
+    1cc7:	55                   	push   %ebp
+    1cc8:	89 e5                	mov    %esp,%ebp
+    1cca:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parsepipe(ps, es);
+    1ccd:	83 ec 08             	sub    $0x8,%esp
+    1cd0:	ff 75 0c             	push   0xc(%ebp)
+    1cd3:	ff 75 08             	push   0x8(%ebp)
+    1cd6:	e8 99 00 00 00       	call   1d74 <parsepipe>
+    1cdb:	83 c4 10             	add    $0x10,%esp
+    1cde:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(peek(ps, es, "&")){
+    1ce1:	eb 23                	jmp    1d06 <parseline+0x3f>
+    gettoken(ps, es, 0, 0);
+    1ce3:	6a 00                	push   $0x0
+    1ce5:	6a 00                	push   $0x0
+    1ce7:	ff 75 0c             	push   0xc(%ebp)
+    1cea:	ff 75 08             	push   0x8(%ebp)
+    1ced:	e8 cb fc ff ff       	call   19bd <gettoken>
+    1cf2:	83 c4 10             	add    $0x10,%esp
+    cmd = backcmd(cmd);
+    1cf5:	83 ec 0c             	sub    $0xc,%esp
+    1cf8:	ff 75 f4             	push   -0xc(%ebp)
+    1cfb:	e8 f7 fb ff ff       	call   18f7 <backcmd>
+    1d00:	83 c4 10             	add    $0x10,%esp
+    1d03:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(peek(ps, es, "&")){
+    1d06:	83 ec 04             	sub    $0x4,%esp
+    1d09:	68 a2 2c 00 00       	push   $0x2ca2
+    1d0e:	ff 75 0c             	push   0xc(%ebp)
+    1d11:	ff 75 08             	push   0x8(%ebp)
+    1d14:	e8 f4 fd ff ff       	call   1b0d <peek>
+    1d19:	83 c4 10             	add    $0x10,%esp
+    1d1c:	85 c0                	test   %eax,%eax
+    1d1e:	75 c3                	jne    1ce3 <parseline+0x1c>
+  }
+  if(peek(ps, es, ";")){
+    1d20:	83 ec 04             	sub    $0x4,%esp
+    1d23:	68 a4 2c 00 00       	push   $0x2ca4
+    1d28:	ff 75 0c             	push   0xc(%ebp)
+    1d2b:	ff 75 08             	push   0x8(%ebp)
+    1d2e:	e8 da fd ff ff       	call   1b0d <peek>
+    1d33:	83 c4 10             	add    $0x10,%esp
+    1d36:	85 c0                	test   %eax,%eax
+    1d38:	74 35                	je     1d6f <parseline+0xa8>
+    gettoken(ps, es, 0, 0);
+    1d3a:	6a 00                	push   $0x0
+    1d3c:	6a 00                	push   $0x0
+    1d3e:	ff 75 0c             	push   0xc(%ebp)
+    1d41:	ff 75 08             	push   0x8(%ebp)
+    1d44:	e8 74 fc ff ff       	call   19bd <gettoken>
+    1d49:	83 c4 10             	add    $0x10,%esp
+    cmd = listcmd(cmd, parseline(ps, es));
+    1d4c:	83 ec 08             	sub    $0x8,%esp
+    1d4f:	ff 75 0c             	push   0xc(%ebp)
+    1d52:	ff 75 08             	push   0x8(%ebp)
+    1d55:	e8 6d ff ff ff       	call   1cc7 <parseline>
+    1d5a:	83 c4 10             	add    $0x10,%esp
+    1d5d:	83 ec 08             	sub    $0x8,%esp
+    1d60:	50                   	push   %eax
+    1d61:	ff 75 f4             	push   -0xc(%ebp)
+    1d64:	e8 46 fb ff ff       	call   18af <listcmd>
+    1d69:	83 c4 10             	add    $0x10,%esp
+    1d6c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+    1d6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1d72:	c9                   	leave
+    1d73:	c3                   	ret
+
+00001d74 <parsepipe>:
+// pipe: [time] [par [N]] exec [| pipe]
+// "time" and "par" apply to the whole pipeline that follows;
+// "par (a; b; c)" runs a, b and c at once.
+struct cmd*
+parsepipe(char **ps, char *es)
+{
+    1d74:	55                   	push   %ebp
+    1d75:	89 e5                	mov    %esp,%ebp
+    1d77:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+  char *q;
+  int n;
+
+  if(keyword(ps, es, "time"))
+    1d7a:	83 ec 04             	sub    $0x4,%esp
+    1d7d:	68 a6 2c 00 00       	push   $0x2ca6
+    1d82:	ff 75 0c             	push   0xc(%ebp)
+    1d85:	ff 75 08             	push   0x8(%ebp)
+    1d88:	e8 f6 fd ff ff       	call   1b83 <keyword>
+    1d8d:	83 c4 10             	add    $0x10,%esp
+    1d90:	85 c0                	test   %eax,%eax
+    1d92:	74 22                	je     1db6 <parsepipe+0x42>
+    return timecmd(parsepipe(ps, es));
+    1d94:	83 ec 08             	sub    $0x8,%esp
+    1d97:	ff 75 0c             	push   0xc(%ebp)
+    1d9a:	ff 75 08             	push   0x8(%ebp)
+    1d9d:	e8 d2 ff ff ff       	call   1d74 <parsepipe>
+    1da2:	83 c4 10             	add    $0x10,%esp
+    1da5:	83 ec 0c             	sub    $0xc,%esp
+    1da8:	50                   	push   %eax
+    1da9:	e8 88 fb ff ff       	call   1936 <timecmd>
+    1dae:	83 c4 10             	add    $0x10,%esp
+    1db1:	e9 e8 00 00 00       	jmp    1e9e <parsepipe+0x12a>
+  if(keyword(ps, es, "par")){
+    1db6:	83 ec 04             	sub    $0x4,%esp
+    1db9:	68 ab 2c 00 00       	push   $0x2cab
+    1dbe:	ff 75 0c             	push   0xc(%ebp)
+    1dc1:	ff 75 08             	push   0x8(%ebp)
+    1dc4:	e8 ba fd ff ff       	call   1b83 <keyword>
+    1dc9:	83 c4 10             	add    $0x10,%esp
+    1dcc:	85 c0                	test   %eax,%eax
+    1dce:	74 68                	je     1e38 <parsepipe+0xc4>
+    n = 0;
+    1dd0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    q = *ps;
+    1dd7:	8b 45 08             	mov    0x8(%ebp),%eax
+    1dda:	8b 00                	mov    (%eax),%eax
+    1ddc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(*q >= '0' && *q <= '9'){
+    1ddf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1de2:	0f b6 00             	movzbl (%eax),%eax
+    1de5:	3c 2f                	cmp    $0x2f,%al
+    1de7:	7e 2d                	jle    1e16 <parsepipe+0xa2>
+    1de9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1dec:	0f b6 00             	movzbl (%eax),%eax
+    1def:	3c 39                	cmp    $0x39,%al
+    1df1:	7f 23                	jg     1e16 <parsepipe+0xa2>
+      n = atoi(q);
+    1df3:	83 ec 0c             	sub    $0xc,%esp
+    1df6:	ff 75 ec             	push   -0x14(%ebp)
+    1df9:	e8 57 06 00 00       	call   2455 <atoi>
+    1dfe:	83 c4 10             	add    $0x10,%esp
+    1e01:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      gettoken(ps, es, 0, 0);
+    1e04:	6a 00                	push   $0x0
+    1e06:	6a 00                	push   $0x0
+    1e08:	ff 75 0c             	push   0xc(%ebp)
+    1e0b:	ff 75 08             	push   0x8(%ebp)
+    1e0e:	e8 aa fb ff ff       	call   19bd <gettoken>
+    1e13:	83 c4 10             	add    $0x10,%esp
+    }
+    return parcmd(n, parsepipe(ps, es));
+    1e16:	83 ec 08             	sub    $0x8,%esp
+    1e19:	ff 75 0c             	push   0xc(%ebp)
+    1e1c:	ff 75 08             	push   0x8(%ebp)
+    1e1f:	e8 50 ff ff ff       	call   1d74 <parsepipe>
+    1e24:	83 c4 10             	add    $0x10,%esp
+    1e27:	83 ec 08             	sub    $0x8,%esp
+    1e2a:	50                   	push   %eax
+    1e2b:	ff 75 f0             	push   -0x10(%ebp)
+    1e2e:	e8 42 fb ff ff       	call   1975 <parcmd>
+    1e33:	83 c4 10             	add    $0x10,%esp
+    1e36:	eb 66                	jmp    1e9e <parsepipe+0x12a>
+  }
+
+  cmd = parseexec(ps, es);
+    1e38:	83 ec 08             	sub    $0x8,%esp
+    1e3b:	ff 75 0c             	push   0xc(%ebp)
+    1e3e:	ff 75 08             	push   0x8(%ebp)
+    1e41:	e8 f0 01 00 00       	call   2036 <parseexec>
+    1e46:	83 c4 10             	add    $0x10,%esp
+    1e49:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(peek(ps, es, "|")){
+    1e4c:	83 ec 04             	sub    $0x4,%esp
+    1e4f:	68 af 2c 00 00       	push   $0x2caf
+    1e54:	ff 75 0c             	push   0xc(%ebp)
+    1e57:	ff 75 08             	push   0x8(%ebp)
+    1e5a:	e8 ae fc ff ff       	call   1b0d <peek>
+    1e5f:	83 c4 10             	add    $0x10,%esp
+    1e62:	85 c0                	test   %eax,%eax
+    1e64:	74 35                	je     1e9b <parsepipe+0x127>
+    gettoken(ps, es, 0, 0);
+    1e66:	6a 00                	push   $0x0
+    1e68:	6a 00                	push   $0x0
+    1e6a:	ff 75 0c             	push   0xc(%ebp)
+    1e6d:	ff 75 08             	push   0x8(%ebp)
+    1e70:	e8 48 fb ff ff       	call   19bd <gettoken>
+    1e75:	83 c4 10             	add    $0x10,%esp
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+    1e78:	83 ec 08             	sub    $0x8,%esp
+    1e7b:	ff 75 0c             	push   0xc(%ebp)
+    1e7e:	ff 75 08             	push   0x8(%ebp)
+    1e81:	e8 ee fe ff ff       	call   1d74 <parsepipe>
+    1e86:	83 c4 10             	add    $0x10,%esp
+    1e89:	83 ec 08             	sub    $0x8,%esp
+    1e8c:	50                   	push   %eax
+    1e8d:	ff 75 f4             	push   -0xc(%ebp)
+    1e90:	e8 d2 f9 ff ff       	call   1867 <pipecmd>
+    1e95:	83 c4 10             	add    $0x10,%esp
+    1e98:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+    1e9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1e9e:	c9                   	leave
+    1e9f:	c3                   	ret
+
+00001ea0 <parseredirs>:
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+    1ea0:	55                   	push   %ebp
+    1ea1:	89 e5                	mov    %esp,%ebp
+    1ea3:	83 ec 18             	sub    $0x18,%esp
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+    1ea6:	e9 ba 00 00 00       	jmp    1f65 <parseredirs+0xc5>
+    tok = gettoken(ps, es, 0, 0);
+    1eab:	6a 00                	push   $0x0
+    1ead:	6a 00                	push   $0x0
+    1eaf:	ff 75 10             	push   0x10(%ebp)
+    1eb2:	ff 75 0c             	push   0xc(%ebp)
+    1eb5:	e8 03 fb ff ff       	call   19bd <gettoken>
+    1eba:	83 c4 10             	add    $0x10,%esp
+    1ebd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(gettoken(ps, es, &q, &eq) != 'a')
+    1ec0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+    1ec3:	50                   	push   %eax
+    1ec4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1ec7:	50                   	push   %eax
+    1ec8:	ff 75 10             	push   0x10(%ebp)
+    1ecb:	ff 75 0c             	push   0xc(%ebp)
+    1ece:	e8 ea fa ff ff       	call   19bd <gettoken>
+    1ed3:	83 c4 10             	add    $0x10,%esp
+    1ed6:	83 f8 61             	cmp    $0x61,%eax
+    1ed9:	74 10                	je     1eeb <parseredirs+0x4b>
+      panic("missing file for redirection");
+    1edb:	83 ec 0c             	sub    $0xc,%esp
+    1ede:	68 b1 2c 00 00       	push   $0x2cb1
+    1ee3:	e8 9d f8 ff ff       	call   1785 <panic>
+    1ee8:	83 c4 10             	add    $0x10,%esp
+    switch(tok){
+    1eeb:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+    1eef:	74 31                	je     1f22 <parseredirs+0x82>
+    1ef1:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+    1ef5:	7f 6e                	jg     1f65 <parseredirs+0xc5>
+    1ef7:	83 7d f4 2b          	cmpl   $0x2b,-0xc(%ebp)
+    1efb:	74 47                	je     1f44 <parseredirs+0xa4>
+    1efd:	83 7d f4 3c          	cmpl   $0x3c,-0xc(%ebp)
+    1f01:	75 62                	jne    1f65 <parseredirs+0xc5>
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+    1f03:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1f06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1f09:	83 ec 0c             	sub    $0xc,%esp
+    1f0c:	6a 00                	push   $0x0
+    1f0e:	6a 00                	push   $0x0
+    1f10:	52                   	push   %edx
+    1f11:	50                   	push   %eax
+    1f12:	ff 75 08             	push   0x8(%ebp)
+    1f15:	e8 ea f8 ff ff       	call   1804 <redircmd>
+    1f1a:	83 c4 20             	add    $0x20,%esp
+    1f1d:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+    1f20:	eb 43                	jmp    1f65 <parseredirs+0xc5>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+    1f22:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1f25:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1f28:	83 ec 0c             	sub    $0xc,%esp
+    1f2b:	6a 01                	push   $0x1
+    1f2d:	68 01 02 00 00       	push   $0x201
+    1f32:	52                   	push   %edx
+    1f33:	50                   	push   %eax
+    1f34:	ff 75 08             	push   0x8(%ebp)
+    1f37:	e8 c8 f8 ff ff       	call   1804 <redircmd>
+    1f3c:	83 c4 20             	add    $0x20,%esp
+    1f3f:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+    1f42:	eb 21                	jmp    1f65 <parseredirs+0xc5>
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+    1f44:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1f47:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1f4a:	83 ec 0c             	sub    $0xc,%esp
+    1f4d:	6a 01                	push   $0x1
+    1f4f:	68 01 02 00 00       	push   $0x201
+    1f54:	52                   	push   %edx
+    1f55:	50                   	push   %eax
+    1f56:	ff 75 08             	push   0x8(%ebp)
+    1f59:	e8 a6 f8 ff ff       	call   1804 <redircmd>
+    1f5e:	83 c4 20             	add    $0x20,%esp
+    1f61:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+    1f64:	90                   	nop
+  while(peek(ps, es, "<>")){
+    1f65:	83 ec 04             	sub    $0x4,%esp
+    1f68:	68 ce 2c 00 00       	push   $0x2cce
+    1f6d:	ff 75 10             	push   0x10(%ebp)
+    1f70:	ff 75 0c             	push   0xc(%ebp)
+    1f73:	e8 95 fb ff ff       	call   1b0d <peek>
+    1f78:	83 c4 10             	add    $0x10,%esp
+    1f7b:	85 c0                	test   %eax,%eax
+    1f7d:	0f 85 28 ff ff ff    	jne    1eab <parseredirs+0xb>
+    }
+  }
+  return cmd;
+    1f83:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    1f86:	c9                   	leave
+    1f87:	c3                   	ret
+
+00001f88 <parseblock>:
+
+struct cmd*
+parseblock(char **ps, char *es)
+{
+    1f88:	55                   	push   %ebp
+    1f89:	89 e5                	mov    %esp,%ebp
+    1f8b:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  if(!peek(ps, es, "("))
+    1f8e:	83 ec 04             	sub    $0x4,%esp
+    1f91:	68 d1 2c 00 00       	push   $0x2cd1
+    1f96:	ff 75 0c             	push   0xc(%ebp)
+    1f99:	ff 75 08             	push   0x8(%ebp)
+    1f9c:	e8 6c fb ff ff       	call   1b0d <peek>
+    1fa1:	83 c4 10             	add    $0x10,%esp
+    1fa4:	85 c0                	test   %eax,%eax
+    1fa6:	75 10                	jne    1fb8 <parseblock+0x30>
+    panic("parseblock");
+    1fa8:	83 ec 0c             	sub    $0xc,%esp
+    1fab:	68 d3 2c 00 00       	push   $0x2cd3
+    1fb0:	e8 d0 f7 ff ff       	call   1785 <panic>
+    1fb5:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+    1fb8:	6a 00                	push   $0x0
+    1fba:	6a 00                	push   $0x0
+    1fbc:	ff 75 0c             	push   0xc(%ebp)
+    1fbf:	ff 75 08             	push   0x8(%ebp)
+    1fc2:	e8 f6 f9 ff ff       	call   19bd <gettoken>
+    1fc7:	83 c4 10             	add    $0x10,%esp
+  cmd = parseline(ps, es);
+    1fca:	83 ec 08             	sub    $0x8,%esp
+    1fcd:	ff 75 0c             	push   0xc(%ebp)
+    1fd0:	ff 75 08             	push   0x8(%ebp)
+    1fd3:	e8 ef fc ff ff       	call   1cc7 <parseline>
+    1fd8:	83 c4 10             	add    $0x10,%esp
+    1fdb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(!peek(ps, es, ")"))
+    1fde:	83 ec 04             	sub    $0x4,%esp
+    1fe1:	68 de 2c 00 00       	push   $0x2cde
+    1fe6:	ff 75 0c             	push   0xc(%ebp)
+    1fe9:	ff 75 08             	push   0x8(%ebp)
+    1fec:	e8 1c fb ff ff       	call   1b0d <peek>
+    1ff1:	83 c4 10             	add    $0x10,%esp
+    1ff4:	85 c0                	test   %eax,%eax
+    1ff6:	75 10                	jne    2008 <parseblock+0x80>
+    panic("syntax - missing )");
+    1ff8:	83 ec 0c             	sub    $0xc,%esp
+    1ffb:	68 e0 2c 00 00       	push   $0x2ce0
+    2000:	e8 80 f7 ff ff       	call   1785 <panic>
+    2005:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+    2008:	6a 00                	push   $0x0
+    200a:	6a 00                	push   $0x0
+    200c:	ff 75 0c             	push   0xc(%ebp)
+    200f:	ff 75 08             	push   0x8(%ebp)
+    2012:	e8 a6 f9 ff ff       	call   19bd <gettoken>
+    2017:	83 c4 10             	add    $0x10,%esp
+  cmd = parseredirs(cmd, ps, es);
+    201a:	83 ec 04             	sub    $0x4,%esp
+    201d:	ff 75 0c             	push   0xc(%ebp)
+    2020:	ff 75 08             	push   0x8(%ebp)
+    2023:	ff 75 f4             	push   -0xc(%ebp)
+    2026:	e8 75 fe ff ff       	call   1ea0 <parseredirs>
+    202b:	83 c4 10             	add    $0x10,%esp
+    202e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  return cmd;
+    2031:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    2034:	c9                   	leave
+    2035:	c3                   	ret
+
+00002036 <parseexec>:
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+    2036:	55                   	push   %ebp
+    2037:	89 e5                	mov    %esp,%ebp
+    2039:	83 ec 28             	sub    $0x28,%esp
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+  
+  if(peek(ps, es, "("))
+    203c:	83 ec 04             	sub    $0x4,%esp
+    203f:	68 d1 2c 00 00       	push   $0x2cd1
+    2044:	ff 75 0c             	push   0xc(%ebp)
+    2047:	ff 75 08             	push   0x8(%ebp)
+    204a:	e8 be fa ff ff       	call   1b0d <peek>
+    204f:	83 c4 10             	add    $0x10,%esp
+    2052:	85 c0                	test   %eax,%eax
+    2054:	74 16                	je     206c <parseexec+0x36>
+    return parseblock(ps, es);
+    2056:	83 ec 08             	sub    $0x8,%esp
+    2059:	ff 75 0c             	push   0xc(%ebp)
+    205c:	ff 75 08             	push   0x8(%ebp)
+    205f:	e8 24 ff ff ff       	call   1f88 <parseblock>
+    2064:	83 c4 10             	add    $0x10,%esp
+    2067:	e9 fb 00 00 00       	jmp    2167 <parseexec+0x131>
+
+  ret = execcmd();
+    206c:	e8 5d f7 ff ff       	call   17ce <execcmd>
+    2071:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  cmd = (struct execcmd*)ret;
+    2074:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2077:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  argc = 0;
+    207a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  ret = parseredirs(ret, ps, es);
+    2081:	83 ec 04             	sub    $0x4,%esp
+    2084:	ff 75 0c             	push   0xc(%ebp)
+    2087:	ff 75 08             	push   0x8(%ebp)
+    208a:	ff 75 f0             	push   -0x10(%ebp)
+    208d:	e8 0e fe ff ff       	call   1ea0 <parseredirs>
+    2092:	83 c4 10             	add    $0x10,%esp
+    2095:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(!peek(ps, es, "|)&;")){
+    2098:	e9 87 00 00 00       	jmp    2124 <parseexec+0xee>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+    209d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    20a0:	50                   	push   %eax
+    20a1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    20a4:	50                   	push   %eax
+    20a5:	ff 75 0c             	push   0xc(%ebp)
+    20a8:	ff 75 08             	push   0x8(%ebp)
+    20ab:	e8 0d f9 ff ff       	call   19bd <gettoken>
+    20b0:	83 c4 10             	add    $0x10,%esp
+    20b3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    20b6:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    20ba:	0f 84 84 00 00 00    	je     2144 <parseexec+0x10e>
+      break;
+    if(tok != 'a')
+    20c0:	83 7d e8 61          	cmpl   $0x61,-0x18(%ebp)
+    20c4:	74 10                	je     20d6 <parseexec+0xa0>
+      panic("syntax");
+    20c6:	83 ec 0c             	sub    $0xc,%esp
+    20c9:	68 9b 2c 00 00       	push   $0x2c9b
+    20ce:	e8 b2 f6 ff ff       	call   1785 <panic>
+    20d3:	83 c4 10             	add    $0x10,%esp
+    cmd->argv[argc] = q;
+    20d6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    20d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    20dc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    20df:	89 4c 90 04          	mov    %ecx,0x4(%eax,%edx,4)
+    cmd->eargv[argc] = eq;
+    20e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+    20e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    20e9:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    20ec:	83 c1 08             	add    $0x8,%ecx
+    20ef:	89 54 88 0c          	mov    %edx,0xc(%eax,%ecx,4)
+    argc++;
+    20f3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(argc >= MAXARGS)
+    20f7:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    20fb:	7e 10                	jle    210d <parseexec+0xd7>
+      panic("too many args");
+    20fd:	83 ec 0c             	sub    $0xc,%esp
+    2100:	68 f3 2c 00 00       	push   $0x2cf3
+    2105:	e8 7b f6 ff ff       	call   1785 <panic>
+    210a:	83 c4 10             	add    $0x10,%esp
+    ret = parseredirs(ret, ps, es);
+    210d:	83 ec 04             	sub    $0x4,%esp
+    2110:	ff 75 0c             	push   0xc(%ebp)
+    2113:	ff 75 08             	push   0x8(%ebp)
+    2116:	ff 75 f0             	push   -0x10(%ebp)
+    2119:	e8 82 fd ff ff       	call   1ea0 <parseredirs>
+    211e:	83 c4 10             	add    $0x10,%esp
+    2121:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(!peek(ps, es, "|)&;")){
+    2124:	83 ec 04             	sub    $0x4,%esp
+    2127:	68 01 2d 00 00       	push   $0x2d01
+    212c:	ff 75 0c             	push   0xc(%ebp)
+    212f:	ff 75 08             	push   0x8(%ebp)
+    2132:	e8 d6 f9 ff ff       	call   1b0d <peek>
+    2137:	83 c4 10             	add    $0x10,%esp
+    213a:	85 c0                	test   %eax,%eax
+    213c:	0f 84 5b ff ff ff    	je     209d <parseexec+0x67>
+    2142:	eb 01                	jmp    2145 <parseexec+0x10f>
+      break;
+    2144:	90                   	nop
+  }
+  cmd->argv[argc] = 0;
+    2145:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2148:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    214b:	c7 44 90 04 00 00 00 	movl   $0x0,0x4(%eax,%edx,4)
+    2152:	00 
+  cmd->eargv[argc] = 0;
+    2153:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2156:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2159:	83 c2 08             	add    $0x8,%edx
+    215c:	c7 44 90 0c 00 00 00 	movl   $0x0,0xc(%eax,%edx,4)
+    2163:	00 
+  return ret;
+    2164:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    2167:	c9                   	leave
+    2168:	c3                   	ret
+
+00002169 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+    2169:	55                   	push   %ebp
+    216a:	89 e5                	mov    %esp,%ebp
+    216c:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+    216f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    2173:	75 0a                	jne    217f <nulterminate+0x16>
+    return 0;
+    2175:	b8 00 00 00 00       	mov    $0x0,%eax
+    217a:	e9 0f 01 00 00       	jmp    228e <nulterminate+0x125>
+  
+  switch(cmd->type){
+    217f:	8b 45 08             	mov    0x8(%ebp),%eax
+    2182:	8b 00                	mov    (%eax),%eax
+    2184:	83 f8 07             	cmp    $0x7,%eax
+    2187:	0f 87 fe 00 00 00    	ja     228b <nulterminate+0x122>
+    218d:	8b 04 85 08 2d 00 00 	mov    0x2d08(,%eax,4),%eax
+    2194:	ff e0                	jmp    *%eax
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    2196:	8b 45 08             	mov    0x8(%ebp),%eax
+    2199:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(i=0; ecmd->argv[i]; i++)
+    219c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    21a3:	eb 14                	jmp    21b9 <nulterminate+0x50>
+      *ecmd->eargv[i] = 0;
+    21a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    21a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    21ab:	83 c2 08             	add    $0x8,%edx
+    21ae:	8b 44 90 0c          	mov    0xc(%eax,%edx,4),%eax
+    21b2:	c6 00 00             	movb   $0x0,(%eax)
+    for(i=0; ecmd->argv[i]; i++)
+    21b5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    21b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    21bc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    21bf:	8b 44 90 04          	mov    0x4(%eax,%edx,4),%eax
+    21c3:	85 c0                	test   %eax,%eax
+    21c5:	75 de                	jne    21a5 <nulterminate+0x3c>
+    break;
+    21c7:	e9 bf 00 00 00       	jmp    228b <nulterminate+0x122>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+    21cc:	8b 45 08             	mov    0x8(%ebp),%eax
+    21cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    nulterminate(rcmd->cmd);
+    21d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    21d5:	8b 40 04             	mov    0x4(%eax),%eax
+    21d8:	83 ec 0c             	sub    $0xc,%esp
+    21db:	50                   	push   %eax
+    21dc:	e8 88 ff ff ff       	call   2169 <nulterminate>
+    21e1:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+    21e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    21e7:	8b 40 0c             	mov    0xc(%eax),%eax
+    21ea:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+    21ed:	e9 99 00 00 00       	jmp    228b <nulterminate+0x122>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+    21f2:	8b 45 08             	mov    0x8(%ebp),%eax
+    21f5:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    nulterminate(pcmd->left);
+    21f8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    21fb:	8b 40 04             	mov    0x4(%eax),%eax
+    21fe:	83 ec 0c             	sub    $0xc,%esp
+    2201:	50                   	push   %eax
+    2202:	e8 62 ff ff ff       	call   2169 <nulterminate>
+    2207:	83 c4 10             	add    $0x10,%esp
+    nulterminate(pcmd->right);
+    220a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    220d:	8b 40 08             	mov    0x8(%eax),%eax
+    2210:	83 ec 0c             	sub    $0xc,%esp
+    2213:	50                   	push   %eax
+    2214:	e8 50 ff ff ff       	call   2169 <nulterminate>
+    2219:	83 c4 10             	add    $0x10,%esp
+    break;
+    221c:	eb 6d                	jmp    228b <nulterminate+0x122>
+    
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    221e:	8b 45 08             	mov    0x8(%ebp),%eax
+    2221:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    nulterminate(lcmd->left);
+    2224:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2227:	8b 40 04             	mov    0x4(%eax),%eax
+    222a:	83 ec 0c             	sub    $0xc,%esp
+    222d:	50                   	push   %eax
+    222e:	e8 36 ff ff ff       	call   2169 <nulterminate>
+    2233:	83 c4 10             	add    $0x10,%esp
+    nulterminate(lcmd->right);
+    2236:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2239:	8b 40 08             	mov    0x8(%eax),%eax
+    223c:	83 ec 0c             	sub    $0xc,%esp
+    223f:	50                   	push   %eax
+    2240:	e8 24 ff ff ff       	call   2169 <nulterminate>
+    2245:	83 c4 10             	add    $0x10,%esp
+    break;
+    2248:	eb 41                	jmp    228b <nulterminate+0x122>
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    224a:	8b 45 08             	mov    0x8(%ebp),%eax
+    224d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    nulterminate(bcmd->cmd);
+    2250:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2253:	8b 40 04             	mov    0x4(%eax),%eax
+    2256:	83 ec 0c             	sub    $0xc,%esp
+    2259:	50                   	push   %eax
+    225a:	e8 0a ff ff ff       	call   2169 <nulterminate>
+    225f:	83 c4 10             	add    $0x10,%esp
+    break;
+    2262:	eb 27                	jmp    228b <nulterminate+0x122>
+
+  case TIME:
+    nulterminate(((struct timecmd*)cmd)->cmd);
+    2264:	8b 45 08             	mov    0x8(%ebp),%eax
+    2267:	8b 40 04             	mov    0x4(%eax),%eax
+    226a:	83 ec 0c             	sub    $0xc,%esp
+    226d:	50                   	push   %eax
+    226e:	e8 f6 fe ff ff       	call   2169 <nulterminate>
+    2273:	83 c4 10             	add    $0x10,%esp
+    break;
+    2276:	eb 13                	jmp    228b <nulterminate+0x122>
+
+  case PAR:
+    nulterminate(((struct parcmd*)cmd)->cmd);
+    2278:	8b 45 08             	mov    0x8(%ebp),%eax
+    227b:	8b 40 08             	mov    0x8(%eax),%eax
+    227e:	83 ec 0c             	sub    $0xc,%esp
+    2281:	50                   	push   %eax
+    2282:	e8 e2 fe ff ff       	call   2169 <nulterminate>
+    2287:	83 c4 10             	add    $0x10,%esp
+    break;
+    228a:	90                   	nop
+  }
+  return cmd;
+    228b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    228e:	c9                   	leave
+    228f:	c3                   	ret
+
+00002290 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+    2290:	55                   	push   %ebp
+    2291:	89 e5                	mov    %esp,%ebp
+    2293:	57                   	push   %edi
+    2294:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+    2295:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    2298:	8b 55 10             	mov    0x10(%ebp),%edx
+    229b:	8b 45 0c             	mov    0xc(%ebp),%eax
+    229e:	89 cb                	mov    %ecx,%ebx
+    22a0:	89 df                	mov    %ebx,%edi
+    22a2:	89 d1                	mov    %edx,%ecx
+    22a4:	fc                   	cld
+    22a5:	f3 aa                	rep stos %al,%es:(%edi)
+    22a7:	89 ca                	mov    %ecx,%edx
+    22a9:	89 fb                	mov    %edi,%ebx
+    22ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    22ae:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    22b1:	90                   	nop
+    22b2:	5b                   	pop    %ebx
+    22b3:	5f                   	pop    %edi
+    22b4:	5d                   	pop    %ebp
+    22b5:	c3                   	ret
+
+000022b6 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    22b6:	55                   	push   %ebp
+    22b7:	89 e5                	mov    %esp,%ebp
+    22b9:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+    22bc:	8b 45 08             	mov    0x8(%ebp),%eax
+    22bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    22c2:	90                   	nop
+    22c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+    22c6:	8d 42 01             	lea    0x1(%edx),%eax
+    22c9:	89 45 0c             	mov    %eax,0xc(%ebp)
+    22cc:	8b 45 08             	mov    0x8(%ebp),%eax
+    22cf:	8d 48 01             	lea    0x1(%eax),%ecx
+    22d2:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    22d5:	0f b6 12             	movzbl (%edx),%edx
+    22d8:	88 10                	mov    %dl,(%eax)
+    22da:	0f b6 00             	movzbl (%eax),%eax
+    22dd:	84 c0                	test   %al,%al
+    22df:	75 e2                	jne    22c3 <strcpy+0xd>
+    ;
+  return os;
+    22e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    22e4:	c9                   	leave
+    22e5:	c3                   	ret
+
+000022e6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    22e6:	55                   	push   %ebp
+    22e7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    22e9:	eb 08                	jmp    22f3 <strcmp+0xd>
+    p++, q++;
+    22eb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    22ef:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    22f3:	8b 45 08             	mov    0x8(%ebp),%eax
+    22f6:	0f b6 00             	movzbl (%eax),%eax
+    22f9:	84 c0                	test   %al,%al
+    22fb:	74 10                	je     230d <strcmp+0x27>
+    22fd:	8b 45 08             	mov    0x8(%ebp),%eax
+    2300:	0f b6 10             	movzbl (%eax),%edx
+    2303:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2306:	0f b6 00             	movzbl (%eax),%eax
+    2309:	38 c2                	cmp    %al,%dl
+    230b:	74 de                	je     22eb <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    230d:	8b 45 08             	mov    0x8(%ebp),%eax
+    2310:	0f b6 00             	movzbl (%eax),%eax
+    2313:	0f b6 d0             	movzbl %al,%edx
+    2316:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2319:	0f b6 00             	movzbl (%eax),%eax
+    231c:	0f b6 c0             	movzbl %al,%eax
+    231f:	29 c2                	sub    %eax,%edx
+    2321:	89 d0                	mov    %edx,%eax
+}
+    2323:	5d                   	pop    %ebp
+    2324:	c3                   	ret
+
+00002325 <strlen>:
+
+uint
+strlen(char *s)
+{
+    2325:	55                   	push   %ebp
+    2326:	89 e5                	mov    %esp,%ebp
+    2328:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+    232b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    2332:	eb 04                	jmp    2338 <strlen+0x13>
+    2334:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    2338:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    233b:	8b 45 08             	mov    0x8(%ebp),%eax
+    233e:	01 d0                	add    %edx,%eax
+    2340:	0f b6 00             	movzbl (%eax),%eax
+    2343:	84 c0                	test   %al,%al
+    2345:	75 ed                	jne    2334 <strlen+0xf>
+    ;
+  return n;
+    2347:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    234a:	c9                   	leave
+    234b:	c3                   	ret
+
+0000234c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    234c:	55                   	push   %ebp
+    234d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    234f:	8b 45 10             	mov    0x10(%ebp),%eax
+    2352:	50                   	push   %eax
+    2353:	ff 75 0c             	push   0xc(%ebp)
+    2356:	ff 75 08             	push   0x8(%ebp)
+    2359:	e8 32 ff ff ff       	call   2290 <stosb>
+    235e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    2361:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2364:	c9                   	leave
+    2365:	c3                   	ret
+
+00002366 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    2366:	55                   	push   %ebp
+    2367:	89 e5                	mov    %esp,%ebp
+    2369:	83 ec 04             	sub    $0x4,%esp
+    236c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    236f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    2372:	eb 14                	jmp    2388 <strchr+0x22>
+    if(*s == c)
+    2374:	8b 45 08             	mov    0x8(%ebp),%eax
+    2377:	0f b6 00             	movzbl (%eax),%eax
+    237a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    237d:	75 05                	jne    2384 <strchr+0x1e>
+      return (char*)s;
+    237f:	8b 45 08             	mov    0x8(%ebp),%eax
+    2382:	eb 13                	jmp    2397 <strchr+0x31>
+  for(; *s; s++)
+    2384:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    2388:	8b 45 08             	mov    0x8(%ebp),%eax
+    238b:	0f b6 00             	movzbl (%eax),%eax
+    238e:	84 c0                	test   %al,%al
+    2390:	75 e2                	jne    2374 <strchr+0xe>
+  return 0;
+    2392:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    2397:	c9                   	leave
+    2398:	c3                   	ret
+
+00002399 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    2399:	55                   	push   %ebp
+    239a:	89 e5                	mov    %esp,%ebp
+    239c:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    239f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    23a6:	eb 42                	jmp    23ea <gets+0x51>
+    cc = read(0, &c, 1);
+    23a8:	83 ec 04             	sub    $0x4,%esp
+    23ab:	6a 01                	push   $0x1
+    23ad:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    23b0:	50                   	push   %eax
+    23b1:	6a 00                	push   $0x0
+    23b3:	e8 85 01 00 00       	call   253d <read>
+    23b8:	83 c4 10             	add    $0x10,%esp
+    23bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    23be:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    23c2:	7e 33                	jle    23f7 <gets+0x5e>
+      break;
+    buf[i++] = c;
+    23c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    23c7:	8d 50 01             	lea    0x1(%eax),%edx
+    23ca:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    23cd:	89 c2                	mov    %eax,%edx
+    23cf:	8b 45 08             	mov    0x8(%ebp),%eax
+    23d2:	01 c2                	add    %eax,%edx
+    23d4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    23d8:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    23da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    23de:	3c 0a                	cmp    $0xa,%al
+    23e0:	74 16                	je     23f8 <gets+0x5f>
+    23e2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    23e6:	3c 0d                	cmp    $0xd,%al
+    23e8:	74 0e                	je     23f8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    23ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    23ed:	83 c0 01             	add    $0x1,%eax
+    23f0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    23f3:	7f b3                	jg     23a8 <gets+0xf>
+    23f5:	eb 01                	jmp    23f8 <gets+0x5f>
+      break;
+    23f7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    23f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    23fb:	8b 45 08             	mov    0x8(%ebp),%eax
+    23fe:	01 d0                	add    %edx,%eax
+    2400:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    2403:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    2406:	c9                   	leave
+    2407:	c3                   	ret
+
+00002408 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    2408:	55                   	push   %ebp
+    2409:	89 e5                	mov    %esp,%ebp
+    240b:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    240e:	83 ec 08             	sub    $0x8,%esp
+    2411:	6a 00                	push   $0x0
+    2413:	ff 75 08             	push   0x8(%ebp)
+    2416:	e8 4a 01 00 00       	call   2565 <open>
+    241b:	83 c4 10             	add    $0x10,%esp
+    241e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    2421:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2425:	79 07                	jns    242e <stat+0x26>
+    return -1;
+    2427:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    242c:	eb 25                	jmp    2453 <stat+0x4b>
+  r = fstat(fd, st);
+    242e:	83 ec 08             	sub    $0x8,%esp
+    2431:	ff 75 0c             	push   0xc(%ebp)
+    2434:	ff 75 f4             	push   -0xc(%ebp)
+    2437:	e8 41 01 00 00       	call   257d <fstat>
+    243c:	83 c4 10             	add    $0x10,%esp
+    243f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    2442:	83 ec 0c             	sub    $0xc,%esp
+    2445:	ff 75 f4             	push   -0xc(%ebp)
+    2448:	e8 00 01 00 00       	call   254d <close>
+    244d:	83 c4 10             	add    $0x10,%esp
+  return r;
+    2450:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    2453:	c9                   	leave
+    2454:	c3                   	ret
+
+00002455 <atoi>:
+
+int
+atoi(const char *s)
+{
+    2455:	55                   	push   %ebp
+    2456:	89 e5                	mov    %esp,%ebp
+    2458:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    245b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    2462:	eb 25                	jmp    2489 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    2464:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    2467:	89 d0                	mov    %edx,%eax
+    2469:	c1 e0 02             	shl    $0x2,%eax
+    246c:	01 d0                	add    %edx,%eax
+    246e:	01 c0                	add    %eax,%eax
+    2470:	89 c1                	mov    %eax,%ecx
+    2472:	8b 45 08             	mov    0x8(%ebp),%eax
+    2475:	8d 50 01             	lea    0x1(%eax),%edx
+    2478:	89 55 08             	mov    %edx,0x8(%ebp)
+    247b:	0f b6 00             	movzbl (%eax),%eax
+    247e:	0f be c0             	movsbl %al,%eax
+    2481:	01 c8                	add    %ecx,%eax
+    2483:	83 e8 30             	sub    $0x30,%eax
+    2486:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    2489:	8b 45 08             	mov    0x8(%ebp),%eax
+    248c:	0f b6 00             	movzbl (%eax),%eax
+    248f:	3c 2f                	cmp    $0x2f,%al
+    2491:	7e 0a                	jle    249d <atoi+0x48>
+    2493:	8b 45 08             	mov    0x8(%ebp),%eax
+    2496:	0f b6 00             	movzbl (%eax),%eax
+    2499:	3c 39                	cmp    $0x39,%al
+    249b:	7e c7                	jle    2464 <atoi+0xf>
+  return n;
+    249d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    24a0:	c9                   	leave
+    24a1:	c3                   	ret
+
+000024a2 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    24a2:	55                   	push   %ebp
+    24a3:	89 e5                	mov    %esp,%ebp
+    24a5:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+    24a8:	8b 45 08             	mov    0x8(%ebp),%eax
+    24ab:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    24ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+    24b1:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    24b4:	eb 17                	jmp    24cd <memmove+0x2b>
+    *dst++ = *src++;
+    24b6:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    24b9:	8d 42 01             	lea    0x1(%edx),%eax
+    24bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    24bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    24c2:	8d 48 01             	lea    0x1(%eax),%ecx
+    24c5:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    24c8:	0f b6 12             	movzbl (%edx),%edx
+    24cb:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    24cd:	8b 45 10             	mov    0x10(%ebp),%eax
+    24d0:	8d 50 ff             	lea    -0x1(%eax),%edx
+    24d3:	89 55 10             	mov    %edx,0x10(%ebp)
+    24d6:	85 c0                	test   %eax,%eax
+    24d8:	7f dc                	jg     24b6 <memmove+0x14>
+  return vdst;
+    24da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    24dd:	c9                   	leave
+    24de:	c3                   	ret
+
+000024df <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+    24df:	55                   	push   %ebp
+    24e0:	89 e5                	mov    %esp,%ebp
+    24e2:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+    24e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    24ec:	eb 04                	jmp    24f2 <ncpus+0x13>
+    24ee:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    24f2:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+    24f6:	7f 16                	jg     250e <ncpus+0x2f>
+    24f8:	83 ec 08             	sub    $0x8,%esp
+    24fb:	8d 45 8c             	lea    -0x74(%ebp),%eax
+    24fe:	50                   	push   %eax
+    24ff:	ff 75 f4             	push   -0xc(%ebp)
+    2502:	e8 d6 00 00 00       	call   25dd <intrstat>
+    2507:	83 c4 10             	add    $0x10,%esp
+    250a:	85 c0                	test   %eax,%eax
+    250c:	74 e0                	je     24ee <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+    250e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2511:	ba 01 00 00 00       	mov    $0x1,%edx
+    2516:	85 c0                	test   %eax,%eax
+    2518:	0f 4e c2             	cmovle %edx,%eax
+}
+    251b:	c9                   	leave
+    251c:	c3                   	ret
+
+0000251d <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+    251d:	b8 01 00 00 00       	mov    $0x1,%eax
+    2522:	cd 40                	int    $0x40
+    2524:	c3                   	ret
+
+00002525 <exit>:
+SYSCALL(exit)
+    2525:	b8 02 00 00 00       	mov    $0x2,%eax
+    252a:	cd 40                	int    $0x40
+    252c:	c3                   	ret
+
+0000252d <wait>:
+SYSCALL(wait)
+    252d:	b8 03 00 00 00       	mov    $0x3,%eax
+    2532:	cd 40                	int    $0x40
+    2534:	c3                   	ret
+
+00002535 <pipe>:
+SYSCALL(pipe)
+    2535:	b8 04 00 00 00       	mov    $0x4,%eax
+    253a:	cd 40                	int    $0x40
+    253c:	c3                   	ret
+
+0000253d <read>:
+SYSCALL(read)
+    253d:	b8 05 00 00 00       	mov    $0x5,%eax
+    2542:	cd 40                	int    $0x40
+    2544:	c3                   	ret
+
+00002545 <write>:
+SYSCALL(write)
+    2545:	b8 10 00 00 00       	mov    $0x10,%eax
+    254a:	cd 40                	int    $0x40
+    254c:	c3                   	ret
+
+0000254d <close>:
+SYSCALL(close)
+    254d:	b8 15 00 00 00       	mov    $0x15,%eax
+    2552:	cd 40                	int    $0x40
+    2554:	c3                   	ret
+
+00002555 <kill>:
+SYSCALL(kill)
+    2555:	b8 06 00 00 00       	mov    $0x6,%eax
+    255a:	cd 40                	int    $0x40
+    255c:	c3                   	ret
+
+0000255d <exec>:
+SYSCALL(exec)
+    255d:	b8 07 00 00 00       	mov    $0x7,%eax
+    2562:	cd 40                	int    $0x40
+    2564:	c3                   	ret
+
+00002565 <open>:
+SYSCALL(open)
+    2565:	b8 0f 00 00 00       	mov    $0xf,%eax
+    256a:	cd 40                	int    $0x40
+    256c:	c3                   	ret
+
+0000256d <mknod>:
+SYSCALL(mknod)
+    256d:	b8 11 00 00 00       	mov    $0x11,%eax
+    2572:	cd 40                	int    $0x40
+    2574:	c3                   	ret
+
+00002575 <unlink>:
+SYSCALL(unlink)
+    2575:	b8 12 00 00 00       	mov    $0x12,%eax
+    257a:	cd 40                	int    $0x40
+    257c:	c3                   	ret
+
+0000257d <fstat>:
+SYSCALL(fstat)
+    257d:	b8 08 00 00 00       	mov    $0x8,%eax
+    2582:	cd 40                	int    $0x40
+    2584:	c3                   	ret
+
+00002585 <link>:
+SYSCALL(link)
+    2585:	b8 13 00 00 00       	mov    $0x13,%eax
+    258a:	cd 40                	int    $0x40
+    258c:	c3                   	ret
+
+0000258d <mkdir>:
+SYSCALL(mkdir)
+    258d:	b8 14 00 00 00       	mov    $0x14,%eax
+    2592:	cd 40                	int    $0x40
+    2594:	c3                   	ret
+
+00002595 <chdir>:
+SYSCALL(chdir)
+    2595:	b8 09 00 00 00       	mov    $0x9,%eax
+    259a:	cd 40                	int    $0x40
+    259c:	c3                   	ret
+
+0000259d <dup>:
+SYSCALL(dup)
+    259d:	b8 0a 00 00 00       	mov    $0xa,%eax
+    25a2:	cd 40                	int    $0x40
+    25a4:	c3                   	ret
+
+000025a5 <getpid>:
+SYSCALL(getpid)
+    25a5:	b8 0b 00 00 00       	mov    $0xb,%eax
+    25aa:	cd 40                	int    $0x40
+    25ac:	c3                   	ret
+
+000025ad <sbrk>:
+SYSCALL(sbrk)
+    25ad:	b8 0c 00 00 00       	mov    $0xc,%eax
+    25b2:	cd 40                	int    $0x40
+    25b4:	c3                   	ret
+
+000025b5 <sleep>:
+SYSCALL(sleep)
+    25b5:	b8 0d 00 00 00       	mov    $0xd,%eax
+    25ba:	cd 40                	int    $0x40
+    25bc:	c3                   	ret
+
+000025bd <uptime>:
+SYSCALL(uptime)
+    25bd:	b8 0e 00 00 00       	mov    $0xe,%eax
+    25c2:	cd 40                	int    $0x40
+    25c4:	c3                   	ret
+
+000025c5 <poll>:
+SYSCALL(poll)
+    25c5:	b8 16 00 00 00       	mov    $0x16,%eax
+    25ca:	cd 40                	int    $0x40
+    25cc:	c3                   	ret
+
+000025cd <fcntl>:
+SYSCALL(fcntl)
+    25cd:	b8 17 00 00 00       	mov    $0x17,%eax
+    25d2:	cd 40                	int    $0x40
+    25d4:	c3                   	ret
+
+000025d5 <irqroute>:
+SYSCALL(irqroute)
+    25d5:	b8 18 00 00 00       	mov    $0x18,%eax
+    25da:	cd 40                	int    $0x40
+    25dc:	c3                   	ret
+
+000025dd <intrstat>:
+SYSCALL(intrstat)
+    25dd:	b8 19 00 00 00       	mov    $0x19,%eax
+    25e2:	cd 40                	int    $0x40
+    25e4:	c3                   	ret
+
+000025e5 <pread>:
+SYSCALL(pread)
+    25e5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    25ea:	cd 40                	int    $0x40
+    25ec:	c3                   	ret
+
+000025ed <getdents>:
+SYSCALL(getdents)
+    25ed:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    25f2:	cd 40                	int    $0x40
+    25f4:	c3                   	ret
+
+000025f5 <fstatat>:
+SYSCALL(fstatat)
+    25f5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    25fa:	cd 40                	int    $0x40
+    25fc:	c3                   	ret
+
+000025fd <openat>:
+SYSCALL(openat)
+    25fd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    2602:	cd 40                	int    $0x40
+    2604:	c3                   	ret
+
+00002605 <unlinkat>:
+SYSCALL(unlinkat)
+    2605:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    260a:	cd 40                	int    $0x40
+    260c:	c3                   	ret
+
+0000260d <mkdirat>:
+SYSCALL(mkdirat)
+    260d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    2612:	cd 40                	int    $0x40
+    2614:	c3                   	ret
+
+00002615 <linkat>:
+SYSCALL(linkat)
+    2615:	b8 20 00 00 00       	mov    $0x20,%eax
+    261a:	cd 40                	int    $0x40
+    261c:	c3                   	ret
+
+0000261d <exits>:
+SYSCALL(exits)
+    261d:	b8 21 00 00 00       	mov    $0x21,%eax
+    2622:	cd 40                	int    $0x40
+    2624:	c3                   	ret
+
+00002625 <waitstatus>:
+SYSCALL(waitstatus)
+    2625:	b8 22 00 00 00       	mov    $0x22,%eax
+    262a:	cd 40                	int    $0x40
+    262c:	c3                   	ret
+
+0000262d <pwrite>:
+SYSCALL(pwrite)
+    262d:	b8 23 00 00 00       	mov    $0x23,%eax
+    2632:	cd 40                	int    $0x40
+    2634:	c3                   	ret
+
+00002635 <lseek>:
+SYSCALL(lseek)
+    2635:	b8 24 00 00 00       	mov    $0x24,%eax
+    263a:	cd 40                	int    $0x40
+    263c:	c3                   	ret
+
+0000263d <copyfilerange>:
+SYSCALL(copyfilerange)
+    263d:	b8 25 00 00 00       	mov    $0x25,%eax
+    2642:	cd 40                	int    $0x40
+    2644:	c3                   	ret
+
+00002645 <fsctl>:
+SYSCALL(fsctl)
+    2645:	b8 26 00 00 00       	mov    $0x26,%eax
+    264a:	cd 40                	int    $0x40
+    264c:	c3                   	ret
+
+0000264d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    264d:	55                   	push   %ebp
+    264e:	89 e5                	mov    %esp,%ebp
+    2650:	83 ec 18             	sub    $0x18,%esp
+    2653:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2656:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    2659:	83 ec 04             	sub    $0x4,%esp
+    265c:	6a 01                	push   $0x1
+    265e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    2661:	50                   	push   %eax
+    2662:	ff 75 08             	push   0x8(%ebp)
+    2665:	e8 db fe ff ff       	call   2545 <write>
+    266a:	83 c4 10             	add    $0x10,%esp
+}
+    266d:	90                   	nop
+    266e:	c9                   	leave
+    266f:	c3                   	ret
+
+00002670 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    2670:	55                   	push   %ebp
+    2671:	89 e5                	mov    %esp,%ebp
+    2673:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    2676:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    267d:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    2681:	74 17                	je     269a <printint+0x2a>
+    2683:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    2687:	79 11                	jns    269a <printint+0x2a>
+    neg = 1;
+    2689:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    2690:	8b 45 0c             	mov    0xc(%ebp),%eax
+    2693:	f7 d8                	neg    %eax
+    2695:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    2698:	eb 06                	jmp    26a0 <printint+0x30>
+  } else {
+    x = xx;
+    269a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    269d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    26a0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    26a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    26aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    26ad:	ba 00 00 00 00       	mov    $0x0,%edx
+    26b2:	f7 f1                	div    %ecx
+    26b4:	89 d1                	mov    %edx,%ecx
+    26b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    26b9:	8d 50 01             	lea    0x1(%eax),%edx
+    26bc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    26bf:	0f b6 91 48 34 00 00 	movzbl 0x3448(%ecx),%edx
+    26c6:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    26ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    26cd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    26d0:	ba 00 00 00 00       	mov    $0x0,%edx
+    26d5:	f7 f1                	div    %ecx
+    26d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    26da:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    26de:	75 c7                	jne    26a7 <printint+0x37>
+  if(neg)
+    26e0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    26e4:	74 2d                	je     2713 <printint+0xa3>
+    buf[i++] = '-';
+    26e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    26e9:	8d 50 01             	lea    0x1(%eax),%edx
+    26ec:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    26ef:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    26f4:	eb 1d                	jmp    2713 <printint+0xa3>
+    putc(fd, buf[i]);
+    26f6:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    26f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    26fc:	01 d0                	add    %edx,%eax
+    26fe:	0f b6 00             	movzbl (%eax),%eax
+    2701:	0f be c0             	movsbl %al,%eax
+    2704:	83 ec 08             	sub    $0x8,%esp
+    2707:	50                   	push   %eax
+    2708:	ff 75 08             	push   0x8(%ebp)
+    270b:	e8 3d ff ff ff       	call   264d <putc>
+    2710:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    2713:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    2717:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    271b:	79 d9                	jns    26f6 <printint+0x86>
+}
+    271d:	90                   	nop
+    271e:	90                   	nop
+    271f:	c9                   	leave
+    2720:	c3                   	ret
+
+00002721 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    2721:	55                   	push   %ebp
+    2722:	89 e5                	mov    %esp,%ebp
+    2724:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    2727:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    272e:	8d 45 0c             	lea    0xc(%ebp),%eax
+    2731:	83 c0 04             	add    $0x4,%eax
+    2734:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    2737:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    273e:	e9 59 01 00 00       	jmp    289c <printf+0x17b>
+    c = fmt[i] & 0xff;
+    2743:	8b 55 0c             	mov    0xc(%ebp),%edx
+    2746:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2749:	01 d0                	add    %edx,%eax
+    274b:	0f b6 00             	movzbl (%eax),%eax
+    274e:	0f be c0             	movsbl %al,%eax
+    2751:	25 ff 00 00 00       	and    $0xff,%eax
+    2756:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    2759:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    275d:	75 2c                	jne    278b <printf+0x6a>
+      if(c == '%'){
+    275f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    2763:	75 0c                	jne    2771 <printf+0x50>
+        state = '%';
+    2765:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    276c:	e9 27 01 00 00       	jmp    2898 <printf+0x177>
+      } else {
+        putc(fd, c);
+    2771:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2774:	0f be c0             	movsbl %al,%eax
+    2777:	83 ec 08             	sub    $0x8,%esp
+    277a:	50                   	push   %eax
+    277b:	ff 75 08             	push   0x8(%ebp)
+    277e:	e8 ca fe ff ff       	call   264d <putc>
+    2783:	83 c4 10             	add    $0x10,%esp
+    2786:	e9 0d 01 00 00       	jmp    2898 <printf+0x177>
+      }
+    } else if(state == '%'){
+    278b:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    278f:	0f 85 03 01 00 00    	jne    2898 <printf+0x177>
+      if(c == 'd'){
+    2795:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    2799:	75 1e                	jne    27b9 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    279b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    279e:	8b 00                	mov    (%eax),%eax
+    27a0:	6a 01                	push   $0x1
+    27a2:	6a 0a                	push   $0xa
+    27a4:	50                   	push   %eax
+    27a5:	ff 75 08             	push   0x8(%ebp)
+    27a8:	e8 c3 fe ff ff       	call   2670 <printint>
+    27ad:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    27b0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    27b4:	e9 d8 00 00 00       	jmp    2891 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    27b9:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    27bd:	74 06                	je     27c5 <printf+0xa4>
+    27bf:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    27c3:	75 1e                	jne    27e3 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    27c5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    27c8:	8b 00                	mov    (%eax),%eax
+    27ca:	6a 00                	push   $0x0
+    27cc:	6a 10                	push   $0x10
+    27ce:	50                   	push   %eax
+    27cf:	ff 75 08             	push   0x8(%ebp)
+    27d2:	e8 99 fe ff ff       	call   2670 <printint>
+    27d7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    27da:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    27de:	e9 ae 00 00 00       	jmp    2891 <printf+0x170>
+      } else if(c == 's'){
+    27e3:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    27e7:	75 43                	jne    282c <printf+0x10b>
+        s = (char*)*ap;
+    27e9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    27ec:	8b 00                	mov    (%eax),%eax
+    27ee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    27f1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    27f5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    27f9:	75 25                	jne    2820 <printf+0xff>
+          s = "(null)";
+    27fb:	c7 45 f4 28 2d 00 00 	movl   $0x2d28,-0xc(%ebp)
+        while(*s != 0){
+    2802:	eb 1c                	jmp    2820 <printf+0xff>
+          putc(fd, *s);
+    2804:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2807:	0f b6 00             	movzbl (%eax),%eax
+    280a:	0f be c0             	movsbl %al,%eax
+    280d:	83 ec 08             	sub    $0x8,%esp
+    2810:	50                   	push   %eax
+    2811:	ff 75 08             	push   0x8(%ebp)
+    2814:	e8 34 fe ff ff       	call   264d <putc>
+    2819:	83 c4 10             	add    $0x10,%esp
+          s++;
+    281c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    2820:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2823:	0f b6 00             	movzbl (%eax),%eax
+    2826:	84 c0                	test   %al,%al
+    2828:	75 da                	jne    2804 <printf+0xe3>
+    282a:	eb 65                	jmp    2891 <printf+0x170>
+        }
+      } else if(c == 'c'){
+    282c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    2830:	75 1d                	jne    284f <printf+0x12e>
+        putc(fd, *ap);
+    2832:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2835:	8b 00                	mov    (%eax),%eax
+    2837:	0f be c0             	movsbl %al,%eax
+    283a:	83 ec 08             	sub    $0x8,%esp
+    283d:	50                   	push   %eax
+    283e:	ff 75 08             	push   0x8(%ebp)
+    2841:	e8 07 fe ff ff       	call   264d <putc>
+    2846:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    2849:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    284d:	eb 42                	jmp    2891 <printf+0x170>
+      } else if(c == '%'){
+    284f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    2853:	75 17                	jne    286c <printf+0x14b>
+        putc(fd, c);
+    2855:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2858:	0f be c0             	movsbl %al,%eax
+    285b:	83 ec 08             	sub    $0x8,%esp
+    285e:	50                   	push   %eax
+    285f:	ff 75 08             	push   0x8(%ebp)
+    2862:	e8 e6 fd ff ff       	call   264d <putc>
+    2867:	83 c4 10             	add    $0x10,%esp
+    286a:	eb 25                	jmp    2891 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    286c:	83 ec 08             	sub    $0x8,%esp
+    286f:	6a 25                	push   $0x25
+    2871:	ff 75 08             	push   0x8(%ebp)
+    2874:	e8 d4 fd ff ff       	call   264d <putc>
+    2879:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    287c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    287f:	0f be c0             	movsbl %al,%eax
+    2882:	83 ec 08             	sub    $0x8,%esp
+    2885:	50                   	push   %eax
+    2886:	ff 75 08             	push   0x8(%ebp)
+    2889:	e8 bf fd ff ff       	call   264d <putc>
+    288e:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    2891:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    2898:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    289c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    289f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    28a2:	01 d0                	add    %edx,%eax
+    28a4:	0f b6 00             	movzbl (%eax),%eax
+    28a7:	84 c0                	test   %al,%al
+    28a9:	0f 85 94 fe ff ff    	jne    2743 <printf+0x22>
+    }
+  }
+}
+    28af:	90                   	nop
+    28b0:	90                   	nop
+    28b1:	c9                   	leave
+    28b2:	c3                   	ret
+
+000028b3 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    28b3:	55                   	push   %ebp
+    28b4:	89 e5                	mov    %esp,%ebp
+    28b6:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    28b9:	8b 45 08             	mov    0x8(%ebp),%eax
+    28bc:	83 e8 08             	sub    $0x8,%eax
+    28bf:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    28c2:	a1 88 48 00 00       	mov    0x4888,%eax
+    28c7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    28ca:	eb 24                	jmp    28f0 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    28cc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    28cf:	8b 00                	mov    (%eax),%eax
+    28d1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    28d4:	72 12                	jb     28e8 <free+0x35>
+    28d6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    28d9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    28dc:	72 24                	jb     2902 <free+0x4f>
+    28de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    28e1:	8b 00                	mov    (%eax),%eax
+    28e3:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    28e6:	72 1a                	jb     2902 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    28e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    28eb:	8b 00                	mov    (%eax),%eax
+    28ed:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    28f0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    28f3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    28f6:	73 d4                	jae    28cc <free+0x19>
+    28f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    28fb:	8b 00                	mov    (%eax),%eax
+    28fd:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    2900:	73 ca                	jae    28cc <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    2902:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    2905:	8b 40 04             	mov    0x4(%eax),%eax
+    2908:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    290f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    2912:	01 c2                	add    %eax,%edx
+    2914:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    2917:	8b 00                	mov    (%eax),%eax
+    2919:	39 c2                	cmp    %eax,%edx
+    291b:	75 24                	jne    2941 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    291d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    2920:	8b 50 04             	mov    0x4(%eax),%edx
+    2923:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    2926:	8b 00                	mov    (%eax),%eax
+    2928:	8b 40 04             	mov    0x4(%eax),%eax
+    292b:	01 c2                	add    %eax,%edx
+    292d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    2930:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    2933:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    2936:	8b 00                	mov    (%eax),%eax
+    2938:	8b 10                	mov    (%eax),%edx
+    293a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    293d:	89 10                	mov    %edx,(%eax)
+    293f:	eb 0a                	jmp    294b <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    2941:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    2944:	8b 10                	mov    (%eax),%edx
+    2946:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    2949:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    294b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    294e:	8b 40 04             	mov    0x4(%eax),%eax
+    2951:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    2958:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    295b:	01 d0                	add    %edx,%eax
+    295d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    2960:	75 20                	jne    2982 <free+0xcf>
+    p->s.size += bp->s.size;
+    2962:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    2965:	8b 50 04             	mov    0x4(%eax),%edx
+    2968:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    296b:	8b 40 04             	mov    0x4(%eax),%eax
+    296e:	01 c2                	add    %eax,%edx
+    2970:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    2973:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    2976:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    2979:	8b 10                	mov    (%eax),%edx
+    297b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    297e:	89 10                	mov    %edx,(%eax)
+    2980:	eb 08                	jmp    298a <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    2982:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    2985:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    2988:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    298a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    298d:	a3 88 48 00 00       	mov    %eax,0x4888
+}
+    2992:	90                   	nop
+    2993:	c9                   	leave
+    2994:	c3                   	ret
+
+00002995 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    2995:	55                   	push   %ebp
+    2996:	89 e5                	mov    %esp,%ebp
+    2998:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    299b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    29a2:	77 07                	ja     29ab <morecore+0x16>
+    nu = 4096;
+    29a4:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    29ab:	8b 45 08             	mov    0x8(%ebp),%eax
+    29ae:	c1 e0 03             	shl    $0x3,%eax
+    29b1:	83 ec 0c             	sub    $0xc,%esp
+    29b4:	50                   	push   %eax
+    29b5:	e8 f3 fb ff ff       	call   25ad <sbrk>
+    29ba:	83 c4 10             	add    $0x10,%esp
+    29bd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    29c0:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    29c4:	75 07                	jne    29cd <morecore+0x38>
+    return 0;
+    29c6:	b8 00 00 00 00       	mov    $0x0,%eax
+    29cb:	eb 26                	jmp    29f3 <morecore+0x5e>
+  hp = (Header*)p;
+    29cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    29d0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    29d3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    29d6:	8b 55 08             	mov    0x8(%ebp),%edx
+    29d9:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    29dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    29df:	83 c0 08             	add    $0x8,%eax
+    29e2:	83 ec 0c             	sub    $0xc,%esp
+    29e5:	50                   	push   %eax
+    29e6:	e8 c8 fe ff ff       	call   28b3 <free>
+    29eb:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    29ee:	a1 88 48 00 00       	mov    0x4888,%eax
+}
+    29f3:	c9                   	leave
+    29f4:	c3                   	ret
+
+000029f5 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    29f5:	55                   	push   %ebp
+    29f6:	89 e5                	mov    %esp,%ebp
+    29f8:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    29fb:	8b 45 08             	mov    0x8(%ebp),%eax
+    29fe:	83 c0 07             	add    $0x7,%eax
+    2a01:	c1 e8 03             	shr    $0x3,%eax
+    2a04:	83 c0 01             	add    $0x1,%eax
+    2a07:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    2a0a:	a1 88 48 00 00       	mov    0x4888,%eax
+    2a0f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    2a12:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2a16:	75 23                	jne    2a3b <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    2a18:	c7 45 f0 80 48 00 00 	movl   $0x4880,-0x10(%ebp)
+    2a1f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2a22:	a3 88 48 00 00       	mov    %eax,0x4888
+    2a27:	a1 88 48 00 00       	mov    0x4888,%eax
+    2a2c:	a3 80 48 00 00       	mov    %eax,0x4880
+    base.s.size = 0;
+    2a31:	c7 05 84 48 00 00 00 	movl   $0x0,0x4884
+    2a38:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2a3b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2a3e:	8b 00                	mov    (%eax),%eax
+    2a40:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    2a43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a46:	8b 40 04             	mov    0x4(%eax),%eax
+    2a49:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    2a4c:	72 4d                	jb     2a9b <malloc+0xa6>
+      if(p->s.size == nunits)
+    2a4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a51:	8b 40 04             	mov    0x4(%eax),%eax
+    2a54:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    2a57:	75 0c                	jne    2a65 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    2a59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a5c:	8b 10                	mov    (%eax),%edx
+    2a5e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2a61:	89 10                	mov    %edx,(%eax)
+    2a63:	eb 26                	jmp    2a8b <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    2a65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a68:	8b 40 04             	mov    0x4(%eax),%eax
+    2a6b:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    2a6e:	89 c2                	mov    %eax,%edx
+    2a70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a73:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    2a76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a79:	8b 40 04             	mov    0x4(%eax),%eax
+    2a7c:	c1 e0 03             	shl    $0x3,%eax
+    2a7f:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    2a82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a85:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    2a88:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    2a8b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2a8e:	a3 88 48 00 00       	mov    %eax,0x4888
+      return (void*)(p + 1);
+    2a93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2a96:	83 c0 08             	add    $0x8,%eax
+    2a99:	eb 3b                	jmp    2ad6 <malloc+0xe1>
+    }
+    if(p == freep)
+    2a9b:	a1 88 48 00 00       	mov    0x4888,%eax
+    2aa0:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    2aa3:	75 1e                	jne    2ac3 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    2aa5:	83 ec 0c             	sub    $0xc,%esp
+    2aa8:	ff 75 ec             	push   -0x14(%ebp)
+    2aab:	e8 e5 fe ff ff       	call   2995 <morecore>
+    2ab0:	83 c4 10             	add    $0x10,%esp
+    2ab3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    2ab6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2aba:	75 07                	jne    2ac3 <malloc+0xce>
+        return 0;
+    2abc:	b8 00 00 00 00       	mov    $0x0,%eax
+    2ac1:	eb 13                	jmp    2ad6 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    2ac3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2ac6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    2ac9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2acc:	8b 00                	mov    (%eax),%eax
+    2ace:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    2ad1:	e9 6d ff ff ff       	jmp    2a43 <malloc+0x4e>
+  }
+}
+    2ad6:	c9                   	leave
+    2ad7:	c3                   	ret
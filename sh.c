@@ -10,6 +10,8 @@
 #define PIPE  3
 #define LIST  4
 #define BACK  5
+#define TIME  6
+#define PAR   7
 
 #define MAXARGS 10
 
@@ -49,23 +51,44 @@ struct backcmd {
   struct cmd *cmd;
 };
 
+struct timecmd {
+  int type;
+  struct cmd *cmd;
+};
+
+// Run n copies of cmd at once, or if n is 0 each command of
+// the list cmd, and wait for all of them.
+struct parcmd {
+  int type;
+  int n;
+  struct cmd *cmd;
+};
+
 int fork1(void);  // Fork but panics on failure.
 void panic(char*);
 struct cmd *parsecmd(char*);
+void runcmd(struct cmd*) __attribute__((noreturn));
 
-// Execute cmd.  Never returns.
+// Execute cmd.  Never returns; exits with the status of the
+// last command run (the right end of a pipe or list).
 void
 runcmd(struct cmd *cmd)
 {
-  int p[2];
+  int p[2], pid, st, status;
   struct backcmd *bcmd;
   struct execcmd *ecmd;
   struct listcmd *lcmd;
   struct pipecmd *pcmd;
   struct redircmd *rcmd;
+  struct timecmd *tcmd;
+  struct parcmd *prcmd;
+  struct cmd *c;
+  int i, n;
+  uint t0;
 
   if(cmd == 0)
     exit();
+  status = 0;
   
   switch(cmd->type){
   default:
@@ -77,6 +100,7 @@ runcmd(struct cmd *cmd)
       exit();
     exec(ecmd->argv[0], ecmd->argv);
     printf(2, "exec %s failed\n", ecmd->argv[0]);
+    status = 1;
     break;
 
   case REDIR:
@@ -84,7 +108,7 @@ runcmd(struct cmd *cmd)
     close(rcmd->fd);
     if(open(rcmd->file, rcmd->mode) < 0){
       printf(2, "open %s failed\n", rcmd->file);
-      exit();
+      exits(1);
     }
     runcmd(rcmd->cmd);
     break;
@@ -108,7 +132,7 @@ runcmd(struct cmd *cmd)
       close(p[1]);
       runcmd(pcmd->left);
     }
-    if(fork1() == 0){
+    if((pid = fork1()) == 0){
       close(0);
       dup(p[0]);
       close(p[0]);
@@ -117,8 +141,9 @@ runcmd(struct cmd *cmd)
     }
     close(p[0]);
     close(p[1]);
-    wait();
-    wait();
+    for(i = 0; i < 2; i++)
+      if(waitstatus(&st) == pid)
+        status = st;
     break;
     
   case BACK:
@@ -126,26 +151,484 @@ runcmd(struct cmd *cmd)
     if(fork1() == 0)
       runcmd(bcmd->cmd);
     break;
+
+  case TIME:
+    tcmd = (struct timecmd*)cmd;
+    t0 = uptime();
+    if(fork1() == 0)
+      runcmd(tcmd->cmd);
+    waitstatus(&status);
+    printf(2, "real %d ticks\n", uptime() - t0);
+    break;
+
+  case PAR:
+    prcmd = (struct parcmd*)cmd;
+    n = 0;
+    if(prcmd->n > 0){
+      for(; n < prcmd->n; n++)
+        if(fork1() == 0)
+          runcmd(prcmd->cmd);
+    } else {
+      for(c = prcmd->cmd; c->type == LIST; c = lcmd->right){
+        lcmd = (struct listcmd*)c;
+        if(fork1() == 0)
+          runcmd(lcmd->left);
+        n++;
+      }
+      if(fork1() == 0)
+        runcmd(c);
+      n++;
+    }
+    // Fail if any of them did.
+    for(i = 0; i < n; i++)
+      if(waitstatus(&st) >= 0 && st != 0)
+        status = st;
+    break;
   }
-  exit();
+  exits(status);
+}
+
+//PAGEBREAK!
+// Scripts.  "sh file [args]" runs the commands in file.  Besides
+// command lines, the shell understands, one per line:
+//   NAME=value             set a variable
+//   for NAME in words      loop over words ...
+//   while command          ... while command exits 0 ...
+//   if command / else      ... choose on command's status ...
+//   done / fi              end a for or while / an if
+//   test a = b, test a != b, test n -eq m (-ne -lt -le -gt -ge),
+//   test -e file, exit [n], cd dir, # comment
+// $NAME, $? (status of the last command), $0-$9 (script
+// arguments) and $((a+b)) (integer arithmetic, evaluated left
+// to right with + - * / %) are expanded before a line is run.
+// The same works interactively; a block is run when its
+// closing line has been typed.
+
+#define MAXLINE  128
+#define MAXLINES 64
+#define NVAR     32
+
+struct var {
+  char name[16];
+  char val[MAXLINE];
+} vars[NVAR];
+
+extern char whitespace[];
+
+int status;       // Exit status of the last command, $?
+char **args;      // $0 ... $9
+int nargs;
+int infd;         // Commands come from here
+int interactive;  // Prompt for input?
+
+char*
+getvar(char *name)
+{
+  int i;
+
+  for(i = 0; i < NVAR; i++)
+    if(vars[i].name[0] && strcmp(vars[i].name, name) == 0)
+      return vars[i].val;
+  return "";
+}
+
+void
+setvar(char *name, char *val)
+{
+  struct var *v, *unused;
+
+  unused = 0;
+  for(v = vars; v < vars+NVAR; v++){
+    if(v->name[0] && strcmp(v->name, name) == 0)
+      break;
+    if(!v->name[0] && !unused)
+      unused = v;
+  }
+  if(v == vars+NVAR && (v = unused) == 0){
+    printf(2, "sh: too many variables\n");
+    return;
+  }
+  if(strlen(name) >= sizeof(v->name) || strlen(val) >= sizeof(v->val)){
+    printf(2, "sh: variable %s too long\n", name);
+    return;
+  }
+  strcpy(v->name, name);
+  strcpy(v->val, val);
+}
+
+int
+isnamec(int c, int first)
+{
+  return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+    (!first && c >= '0' && c <= '9');
+}
+
+// Copy a variable name from *ps to name and advance *ps.
+void
+getname(char **ps, char *name, int n)
+{
+  char *s;
+  int i;
+
+  s = *ps;
+  for(i = 0; isnamec(*s, i == 0); s++)
+    if(i < n-1)
+      name[i++] = *s;
+  name[i] = 0;
+  *ps = s;
+}
+
+// Put the decimal form of x in buf.
+char*
+itoa(int x, char *buf)
+{
+  char tmp[12];
+  int i, neg;
+
+  neg = x < 0;
+  if(neg)
+    x = -x;
+  i = 0;
+  do {
+    tmp[i++] = '0' + x % 10;
+    x /= 10;
+  } while(x > 0);
+  if(neg)
+    tmp[i++] = '-';
+  for(neg = 0; i > 0; )
+    buf[neg++] = tmp[--i];
+  buf[neg] = 0;
+  return buf;
 }
 
+// $((expr)): numbers and variable names joined by + - * / %,
+// evaluated left to right.  *ps points after "$((".
 int
-getcmd(char *buf, int nbuf)
+arith(char **ps)
 {
-  printf(2, "$ ");
-  memset(buf, 0, nbuf);
-  gets(buf, nbuf);
-  if(buf[0] == 0) // EOF
+  char *s, name[16];
+  int v, x, op;
+
+  s = *ps;
+  v = 0;
+  op = '+';
+  for(;;){
+    while(*s == ' ')
+      s++;
+    if(*s >= '0' && *s <= '9'){
+      x = atoi(s);
+      while(*s >= '0' && *s <= '9')
+        s++;
+    } else {
+      getname(&s, name, sizeof(name));
+      x = atoi(getvar(name));
+    }
+    switch(op){
+    case '+': v += x; break;
+    case '-': v -= x; break;
+    case '*': v *= x; break;
+    case '/': v = x ? v / x : 0; break;
+    case '%': v = x ? v % x : 0; break;
+    }
+    while(*s == ' ')
+      s++;
+    if(*s == 0 || *s == ')')
+      break;
+    op = *s++;
+  }
+  while(*s == ')')
+    s++;
+  *ps = s;
+  return v;
+}
+
+// Copy line to buf, expanding $ forms.
+void
+expand(char *line, char *buf, int n)
+{
+  char *s, *v, name[16], num[12];
+  int i;
+
+  i = 0;
+  for(s = line; *s && i < n-1; ){
+    if(*s != '$'){
+      buf[i++] = *s++;
+      continue;
+    }
+    s++;
+    if(*s == '?'){
+      v = itoa(status, num);
+      s++;
+    } else if(*s >= '0' && *s <= '9'){
+      v = *s - '0' < nargs ? args[*s - '0'] : "";
+      s++;
+    } else if(s[0] == '(' && s[1] == '('){
+      s += 2;
+      v = itoa(arith(&s), num);
+    } else if(isnamec(*s, 1)){
+      getname(&s, name, sizeof(name));
+      v = getvar(name);
+    } else
+      v = "$";
+    for(; *v && i < n-1; v++)
+      buf[i++] = *v;
+  }
+  buf[i] = 0;
+}
+
+// Split s into words in place.
+int
+split(char *s, char **w, int max)
+{
+  int n;
+
+  n = 0;
+  for(;;){
+    while(*s && strchr(whitespace, *s))
+      *s++ = 0;
+    if(*s == 0 || n == max)
+      return n;
+    w[n++] = s;
+    while(*s && !strchr(whitespace, *s))
+      s++;
+  }
+}
+
+// Is the first word of line w?  Return what follows it.
+char*
+firstword(char *line, char *w)
+{
+  char *s;
+
+  for(s = line; *s && strchr(whitespace, *s); s++)
+    ;
+  for(; *w && *s == *w; s++, w++)
+    ;
+  if(*w || (*s && !strchr(whitespace, *s)))
+    return 0;
+  return s;
+}
+
+int
+test(int argc, char **argv)
+{
+  int a, b;
+
+  if(argc == 0)
+    return 1;
+  if(argc == 1)
+    return argv[0][0] == 0;
+  if(argc == 2 && strcmp(argv[0], "-e") == 0){
+    if((a = open(argv[1], O_RDONLY)) < 0)
+      return 1;
+    close(a);
+    return 0;
+  }
+  if(argc != 3){
+    printf(2, "test: bad expression\n");
+    return 2;
+  }
+  if(strcmp(argv[1], "=") == 0)
+    return strcmp(argv[0], argv[2]) != 0;
+  if(strcmp(argv[1], "!=") == 0)
+    return strcmp(argv[0], argv[2]) == 0;
+  a = atoi(argv[0]);
+  b = atoi(argv[2]);
+  if(strcmp(argv[1], "-eq") == 0) return !(a == b);
+  if(strcmp(argv[1], "-ne") == 0) return !(a != b);
+  if(strcmp(argv[1], "-lt") == 0) return !(a < b);
+  if(strcmp(argv[1], "-le") == 0) return !(a <= b);
+  if(strcmp(argv[1], "-gt") == 0) return !(a > b);
+  if(strcmp(argv[1], "-ge") == 0) return !(a >= b);
+  printf(2, "test: unknown operator %s\n", argv[1]);
+  return 2;
+}
+
+// Run the built-in command in buf, if it is one.
+int
+builtin(char *buf)
+{
+  char tmp[MAXLINE], *w[MAXARGS], *eq;
+  int n;
+
+  strcpy(tmp, buf);
+  if((n = split(tmp, w, MAXARGS)) == 0)
+    return 1;
+  if(w[0][0] == '#')
+    return 1;
+  if(strcmp(w[0], "cd") == 0){
+    // Chdir has no effect on the parent if run in the child.
+    status = n < 2 || chdir(w[1]) < 0;
+    if(status)
+      printf(2, "cannot cd %s\n", n < 2 ? "" : w[1]);
+    return 1;
+  }
+  if(strcmp(w[0], "exit") == 0)
+    exits(n > 1 ? atoi(w[1]) : status);
+  if(strcmp(w[0], "test") == 0){
+    status = test(n-1, w+1);
+    return 1;
+  }
+  if(n == 1 && (eq = strchr(w[0], '=')) != 0 && eq > w[0]){
+    *eq = 0;
+    setvar(w[0], eq+1);
+    status = 0;
+    return 1;
+  }
+  return 0;
+}
+
+// Expand and run one command line, setting status.
+void
+runline(char *line)
+{
+  char buf[MAXLINE];
+
+  expand(line, buf, sizeof(buf));
+  if(builtin(buf))
+    return;
+  if(fork1() == 0)
+    runcmd(parsecmd(buf));
+  waitstatus(&status);
+}
+
+// How a line changes the block nesting depth.
+int
+nesting(char *line)
+{
+  if(firstword(line, "for") || firstword(line, "while") || firstword(line, "if"))
+    return 1;
+  if(firstword(line, "done") || firstword(line, "fi"))
     return -1;
   return 0;
 }
 
+// Index of the done/fi closing the block opened by l[i], and
+// of its else (or -1).
 int
-main(void)
+blockend(char **l, int i, int n, int *pelse)
 {
-  static char buf[100];
-  int fd;
+  int d;
+
+  *pelse = -1;
+  for(d = 0; i < n; i++){
+    d += nesting(l[i]);
+    if(d == 1 && firstword(l[i], "else"))
+      *pelse = i;
+    if(d == 0)
+      return i;
+  }
+  return n;
+}
+
+void
+runblock(char **l, int n)
+{
+  char buf[MAXLINE], *w[MAXARGS], *s;
+  int i, j, k, e, nw;
+
+  for(i = 0; i < n; i = j+1){
+    if(nesting(l[i]) < 0 || firstword(l[i], "else")){
+      printf(2, "sh: unexpected %s\n", l[i]);
+      status = 2;
+      j = i;
+      continue;
+    }
+    j = blockend(l, i, n, &e);
+    if(j == n && nesting(l[i]) > 0){
+      printf(2, "sh: missing done or fi\n");
+      status = 2;
+      return;
+    }
+    if((s = firstword(l[i], "for")) != 0){
+      expand(s, buf, sizeof(buf));
+      nw = split(buf, w, MAXARGS);
+      if(nw < 2 || strcmp(w[1], "in") != 0){
+        printf(2, "sh: for NAME in words\n");
+        status = 2;
+        return;
+      }
+      for(k = 2; k < nw; k++){
+        setvar(w[0], w[k]);
+        runblock(l+i+1, j-i-1);
+      }
+    } else if((s = firstword(l[i], "while")) != 0){
+      for(;;){
+        runline(s);
+        if(status != 0)
+          break;
+        runblock(l+i+1, j-i-1);
+      }
+      status = 0;
+    } else if((s = firstword(l[i], "if")) != 0){
+      runline(s);
+      if(e < 0)
+        e = j;
+      if(status == 0)
+        runblock(l+i+1, e-i-1);
+      else if(e < j)
+        runblock(l+e+1, j-e-1);
+    } else
+      runline(l[i]);
+  }
+}
+
+// Read a line from infd; return 0 at end of input.
+int
+getline(char *buf, int nbuf)
+{
+  static char rbuf[512];
+  static int r, w;
+  int i;
+
+  for(i = 0; i < nbuf-1; ){
+    if(r == w){
+      // Read the console a line at a time so that commands
+      // run in a child get the input meant for them.
+      if((w = read(infd, rbuf, interactive ? 1 : sizeof(rbuf))) <= 0){
+        w = r = 0;
+        break;
+      }
+      r = 0;
+    }
+    if((buf[i++] = rbuf[r++]) == '\n')
+      break;
+  }
+  buf[i] = 0;
+  if(i > 0 && buf[i-1] == '\n')
+    buf[i-1] = 0;
+  return i > 0;
+}
+
+// Read one statement: a line, or a whole for/while/if block.
+// Return the number of lines, 0 at end of input.
+int
+getstmt(char **l)
+{
+  char buf[MAXLINE];
+  int n, d;
+
+  d = 0;
+  for(n = 0; n < MAXLINES; n++){
+    if(interactive)
+      printf(2, d > 0 ? "> " : "$ ");
+    if(!getline(buf, sizeof(buf)))
+      break;
+    l[n] = malloc(strlen(buf)+1);
+    strcpy(l[n], buf);
+    if((d += nesting(buf)) <= 0){
+      n++;
+      break;
+    }
+  }
+  return n;
+}
+
+int
+main(int argc, char *argv[])
+{
+  char *lines[MAXLINES];
+  int fd, i, n;
   
   // Assumes three file descriptors open.
   while((fd = open("console", O_RDWR)) >= 0){
@@ -154,22 +637,26 @@ main(void)
       break;
     }
   }
+
+  infd = 0;
+  interactive = 1;
+  if(argc > 1){
+    if((infd = open(argv[1], O_RDONLY)) < 0){
+      printf(2, "sh: cannot open %s\n", argv[1]);
+      exits(1);
+    }
+    interactive = 0;
+    args = argv+1;
+    nargs = argc-1;
+  }
   
   // Read and run input commands.
-  while(getcmd(buf, sizeof(buf)) >= 0){
-    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
-      // Clumsy but will have to do for now.
-      // Chdir has no effect on the parent if run in the child.
-      buf[strlen(buf)-1] = 0;  // chop \n
-      if(chdir(buf+3) < 0)
-        printf(2, "cannot cd %s\n", buf+3);
-      continue;
-    }
-    if(fork1() == 0)
-      runcmd(parsecmd(buf));
-    wait();
+  while((n = getstmt(lines)) > 0){
+    runblock(lines, n);
+    for(i = 0; i < n; i++)
+      free(lines[i]);
   }
-  exit();
+  exits(status);
 }
 
 void
@@ -257,6 +744,31 @@ backcmd(struct cmd *subcmd)
   cmd->cmd = subcmd;
   return (struct cmd*)cmd;
 }
+
+struct cmd*
+timecmd(struct cmd *subcmd)
+{
+  struct timecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+  memset(cmd, 0, sizeof(*cmd));
+  cmd->type = TIME;
+  cmd->cmd = subcmd;
+  return (struct cmd*)cmd;
+}
+
+struct cmd*
+parcmd(int n, struct cmd *subcmd)
+{
+  struct parcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+  memset(cmd, 0, sizeof(*cmd));
+  cmd->type = PAR;
+  cmd->n = n;
+  cmd->cmd = subcmd;
+  return (struct cmd*)cmd;
+}
 //PAGEBREAK!
 // Parsing
 
@@ -320,6 +832,23 @@ peek(char **ps, char *es, char *toks)
   return *s && strchr(toks, *s);
 }
 
+// If the next word is kw, consume it and return 1.
+int
+keyword(char **ps, char *es, char *kw)
+{
+  char *s;
+
+  s = *ps;
+  while(s < es && strchr(whitespace, *s))
+    s++;
+  for(; *kw && s < es && *s == *kw; s++, kw++)
+    ;
+  if(*kw || (s < es && !strchr(whitespace, *s)))
+    return 0;
+  gettoken(ps, es, 0, 0);
+  return 1;
+}
+
 struct cmd *parseline(char**, char*);
 struct cmd *parsepipe(char**, char*);
 struct cmd *parseexec(char**, char*);
@@ -359,10 +888,27 @@ parseline(char **ps, char *es)
   return cmd;
 }
 
+// pipe: [time] [par [N]] exec [| pipe]
+// "time" and "par" apply to the whole pipeline that follows;
+// "par (a; b; c)" runs a, b and c at once.
 struct cmd*
 parsepipe(char **ps, char *es)
 {
   struct cmd *cmd;
+  char *q;
+  int n;
+
+  if(keyword(ps, es, "time"))
+    return timecmd(parsepipe(ps, es));
+  if(keyword(ps, es, "par")){
+    n = 0;
+    q = *ps;
+    if(*q >= '0' && *q <= '9'){
+      n = atoi(q);
+      gettoken(ps, es, 0, 0);
+    }
+    return parcmd(n, parsepipe(ps, es));
+  }
 
   cmd = parseexec(ps, es);
   if(peek(ps, es, "|")){
@@ -489,6 +1035,14 @@ nulterminate(struct cmd *cmd)
     bcmd = (struct backcmd*)cmd;
     nulterminate(bcmd->cmd);
     break;
+
+  case TIME:
+    nulterminate(((struct timecmd*)cmd)->cmd);
+    break;
+
+  case PAR:
+    nulterminate(((struct parcmd*)cmd)->cmd);
+    break;
   }
   return cmd;
 }
@@ -100,8 +100,11 @@ pushcli(void)
   
   eflags = readeflags();
   cli();
-  if(cpu->ncli++ == 0)
+  if(cpu->ncli++ == 0){
     cpu->intena = eflags & FL_IF;  // FLAGSレジスタのIF(割り込み可能フラグ)があるかをチェック
+    if(cpu->intena)
+      clibegin();
+  }
 }
 
 void
@@ -111,7 +114,28 @@ popcli(void)
     panic("popcli - interruptible");
   if(--cpu->ncli < 0)
     panic("popcli");
-  if(cpu->ncli == 0 && cpu->intena)
+  if(cpu->ncli == 0 && cpu->intena){
+    cliend();
     sti();
+  }
+}
+
+// Interrupts-off accounting.  clibegin() is called when this
+// CPU turns interrupts off, cliend() just before it turns them
+// back on; the longest stretch is reported by intrstat().
+void
+clibegin(void)
+{
+  cpu->clistart = rdtsc();
+}
+
+void
+cliend(void)
+{
+  uint t;
+
+  t = rdtsc() - cpu->clistart;
+  if(t > cpu->maxcli)
+    cpu->maxcli = t;
 }
 
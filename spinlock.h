@@ -1,3 +1,7 @@
+#ifdef HOSTFS
+#include <pthread.h>
+#endif
+
 // Mutual exclusion lock.
 struct spinlock {
   uint locked;       // Is the lock held?
@@ -7,5 +11,8 @@ struct spinlock {
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+#ifdef HOSTFS
+  pthread_mutex_t mu; // The lock itself, in the host build.
+#endif
 };
 
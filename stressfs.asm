@@ -0,0 +1,1345 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  14:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+  1b:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+  22:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 9a 09 00 00       	push   $0x99a
+  30:	6a 01                	push   $0x1
+  32:	e8 ac 05 00 00       	call   5e3 <printf>
+  37:	83 c4 10             	add    $0x10,%esp
+  memset(data, 'a', sizeof(data));
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	6a 61                	push   $0x61
+  44:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 be 01 00 00       	call   20e <memset>
+  50:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  53:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  5a:	eb 0d                	jmp    69 <main+0x69>
+    if(fork() > 0)
+  5c:	e8 7e 03 00 00       	call   3df <fork>
+  61:	85 c0                	test   %eax,%eax
+  63:	7f 0c                	jg     71 <main+0x71>
+  for(i = 0; i < 4; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  6d:	7e ed                	jle    5c <main+0x5c>
+  6f:	eb 01                	jmp    72 <main+0x72>
+      break;
+  71:	90                   	nop
+
+  printf(1, "write %d\n", i);
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	68 ad 09 00 00       	push   $0x9ad
+  7d:	6a 01                	push   $0x1
+  7f:	e8 5f 05 00 00       	call   5e3 <printf>
+  84:	83 c4 10             	add    $0x10,%esp
+
+  path[8] += i;
+  87:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  90:	01 d0                	add    %edx,%eax
+  92:	88 45 ee             	mov    %al,-0x12(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 02 02 00 00       	push   $0x202
+  9d:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  a0:	50                   	push   %eax
+  a1:	e8 81 03 00 00       	call   427 <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 20; i++)
+  ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b3:	eb 1e                	jmp    d3 <main+0xd3>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  b5:	83 ec 04             	sub    $0x4,%esp
+  b8:	68 00 02 00 00       	push   $0x200
+  bd:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  c3:	50                   	push   %eax
+  c4:	ff 75 f0             	push   -0x10(%ebp)
+  c7:	e8 3b 03 00 00       	call   407 <write>
+  cc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 20; i++)
+  cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  d7:	7e dc                	jle    b5 <main+0xb5>
+  close(fd);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  dc:	ff 75 f0             	push   -0x10(%ebp)
+  df:	e8 2b 03 00 00       	call   40f <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "read\n");
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	68 b7 09 00 00       	push   $0x9b7
+  ef:	6a 01                	push   $0x1
+  f1:	e8 ed 04 00 00       	call   5e3 <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+
+  fd = open(path, O_RDONLY);
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	6a 00                	push   $0x0
+  fe:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+ 101:	50                   	push   %eax
+ 102:	e8 20 03 00 00       	call   427 <open>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for (i = 0; i < 20; i++)
+ 10d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 114:	eb 1e                	jmp    134 <main+0x134>
+    read(fd, data, sizeof(data));
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	68 00 02 00 00       	push   $0x200
+ 11e:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+ 124:	50                   	push   %eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	e8 d2 02 00 00       	call   3ff <read>
+ 12d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 20; i++)
+ 130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 138:	7e dc                	jle    116 <main+0x116>
+  close(fd);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	ff 75 f0             	push   -0x10(%ebp)
+ 140:	e8 ca 02 00 00       	call   40f <close>
+ 145:	83 c4 10             	add    $0x10,%esp
+
+  wait();
+ 148:	e8 a2 02 00 00       	call   3ef <wait>
+  
+  exit();
+ 14d:	e8 95 02 00 00       	call   3e7 <exit>
+
+00000152 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 160:	89 cb                	mov    %ecx,%ebx
+ 162:	89 df                	mov    %ebx,%edi
+ 164:	89 d1                	mov    %edx,%ecx
+ 166:	fc                   	cld
+ 167:	f3 aa                	rep stos %al,%es:(%edi)
+ 169:	89 ca                	mov    %ecx,%edx
+ 16b:	89 fb                	mov    %edi,%ebx
+ 16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 170:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 173:	90                   	nop
+ 174:	5b                   	pop    %ebx
+ 175:	5f                   	pop    %edi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 184:	90                   	nop
+ 185:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 188:	8d 42 01             	lea    0x1(%edx),%eax
+ 18b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	8d 48 01             	lea    0x1(%eax),%ecx
+ 194:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 197:	0f b6 12             	movzbl (%edx),%edx
+ 19a:	88 10                	mov    %dl,(%eax)
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	84 c0                	test   %al,%al
+ 1a1:	75 e2                	jne    185 <strcpy+0xd>
+    ;
+  return os;
+ 1a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1ab:	eb 08                	jmp    1b5 <strcmp+0xd>
+    p++, q++;
+ 1ad:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	74 10                	je     1cf <strcmp+0x27>
+ 1bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c2:	0f b6 10             	movzbl (%eax),%edx
+ 1c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c8:	0f b6 00             	movzbl (%eax),%eax
+ 1cb:	38 c2                	cmp    %al,%dl
+ 1cd:	74 de                	je     1ad <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	0f b6 00             	movzbl (%eax),%eax
+ 1d5:	0f b6 d0             	movzbl %al,%edx
+ 1d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1db:	0f b6 00             	movzbl (%eax),%eax
+ 1de:	0f b6 c0             	movzbl %al,%eax
+ 1e1:	29 c2                	sub    %eax,%edx
+ 1e3:	89 d0                	mov    %edx,%eax
+}
+ 1e5:	5d                   	pop    %ebp
+ 1e6:	c3                   	ret
+
+000001e7 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f4:	eb 04                	jmp    1fa <strlen+0x13>
+ 1f6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1fa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	01 d0                	add    %edx,%eax
+ 202:	0f b6 00             	movzbl (%eax),%eax
+ 205:	84 c0                	test   %al,%al
+ 207:	75 ed                	jne    1f6 <strlen+0xf>
+    ;
+  return n;
+ 209:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 211:	8b 45 10             	mov    0x10(%ebp),%eax
+ 214:	50                   	push   %eax
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 08             	push   0x8(%ebp)
+ 21b:	e8 32 ff ff ff       	call   152 <stosb>
+ 220:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+
+00000228 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 231:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 234:	eb 14                	jmp    24a <strchr+0x22>
+    if(*s == c)
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	0f b6 00             	movzbl (%eax),%eax
+ 23c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 23f:	75 05                	jne    246 <strchr+0x1e>
+      return (char*)s;
+ 241:	8b 45 08             	mov    0x8(%ebp),%eax
+ 244:	eb 13                	jmp    259 <strchr+0x31>
+  for(; *s; s++)
+ 246:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24d:	0f b6 00             	movzbl (%eax),%eax
+ 250:	84 c0                	test   %al,%al
+ 252:	75 e2                	jne    236 <strchr+0xe>
+  return 0;
+ 254:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 259:	c9                   	leave
+ 25a:	c3                   	ret
+
+0000025b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 261:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 268:	eb 42                	jmp    2ac <gets+0x51>
+    cc = read(0, &c, 1);
+ 26a:	83 ec 04             	sub    $0x4,%esp
+ 26d:	6a 01                	push   $0x1
+ 26f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 272:	50                   	push   %eax
+ 273:	6a 00                	push   $0x0
+ 275:	e8 85 01 00 00       	call   3ff <read>
+ 27a:	83 c4 10             	add    $0x10,%esp
+ 27d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 280:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 284:	7e 33                	jle    2b9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 286:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 289:	8d 50 01             	lea    0x1(%eax),%edx
+ 28c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 28f:	89 c2                	mov    %eax,%edx
+ 291:	8b 45 08             	mov    0x8(%ebp),%eax
+ 294:	01 c2                	add    %eax,%edx
+ 296:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 29c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a0:	3c 0a                	cmp    $0xa,%al
+ 2a2:	74 16                	je     2ba <gets+0x5f>
+ 2a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a8:	3c 0d                	cmp    $0xd,%al
+ 2aa:	74 0e                	je     2ba <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2af:	83 c0 01             	add    $0x1,%eax
+ 2b2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b5:	7f b3                	jg     26a <gets+0xf>
+ 2b7:	eb 01                	jmp    2ba <gets+0x5f>
+      break;
+ 2b9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	01 d0                	add    %edx,%eax
+ 2c2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+000002ca <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	6a 00                	push   $0x0
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 4a 01 00 00       	call   427 <open>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e7:	79 07                	jns    2f0 <stat+0x26>
+    return -1;
+ 2e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ee:	eb 25                	jmp    315 <stat+0x4b>
+  r = fstat(fd, st);
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	ff 75 0c             	push   0xc(%ebp)
+ 2f6:	ff 75 f4             	push   -0xc(%ebp)
+ 2f9:	e8 41 01 00 00       	call   43f <fstat>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 304:	83 ec 0c             	sub    $0xc,%esp
+ 307:	ff 75 f4             	push   -0xc(%ebp)
+ 30a:	e8 00 01 00 00       	call   40f <close>
+ 30f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 312:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 315:	c9                   	leave
+ 316:	c3                   	ret
+
+00000317 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 317:	55                   	push   %ebp
+ 318:	89 e5                	mov    %esp,%ebp
+ 31a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 31d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 324:	eb 25                	jmp    34b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 326:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 329:	89 d0                	mov    %edx,%eax
+ 32b:	c1 e0 02             	shl    $0x2,%eax
+ 32e:	01 d0                	add    %edx,%eax
+ 330:	01 c0                	add    %eax,%eax
+ 332:	89 c1                	mov    %eax,%ecx
+ 334:	8b 45 08             	mov    0x8(%ebp),%eax
+ 337:	8d 50 01             	lea    0x1(%eax),%edx
+ 33a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 33d:	0f b6 00             	movzbl (%eax),%eax
+ 340:	0f be c0             	movsbl %al,%eax
+ 343:	01 c8                	add    %ecx,%eax
+ 345:	83 e8 30             	sub    $0x30,%eax
+ 348:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	0f b6 00             	movzbl (%eax),%eax
+ 351:	3c 2f                	cmp    $0x2f,%al
+ 353:	7e 0a                	jle    35f <atoi+0x48>
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+ 358:	0f b6 00             	movzbl (%eax),%eax
+ 35b:	3c 39                	cmp    $0x39,%al
+ 35d:	7e c7                	jle    326 <atoi+0xf>
+  return n;
+ 35f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 362:	c9                   	leave
+ 363:	c3                   	ret
+
+00000364 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 370:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 373:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 376:	eb 17                	jmp    38f <memmove+0x2b>
+    *dst++ = *src++;
+ 378:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 37b:	8d 42 01             	lea    0x1(%edx),%eax
+ 37e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 381:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 384:	8d 48 01             	lea    0x1(%eax),%ecx
+ 387:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 38a:	0f b6 12             	movzbl (%edx),%edx
+ 38d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 38f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 392:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 395:	89 55 10             	mov    %edx,0x10(%ebp)
+ 398:	85 c0                	test   %eax,%eax
+ 39a:	7f dc                	jg     378 <memmove+0x14>
+  return vdst;
+ 39c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 39f:	c9                   	leave
+ 3a0:	c3                   	ret
+
+000003a1 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 3a1:	55                   	push   %ebp
+ 3a2:	89 e5                	mov    %esp,%ebp
+ 3a4:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 3a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3ae:	eb 04                	jmp    3b4 <ncpus+0x13>
+ 3b0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 3b4:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 3b8:	7f 16                	jg     3d0 <ncpus+0x2f>
+ 3ba:	83 ec 08             	sub    $0x8,%esp
+ 3bd:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 3c0:	50                   	push   %eax
+ 3c1:	ff 75 f4             	push   -0xc(%ebp)
+ 3c4:	e8 d6 00 00 00       	call   49f <intrstat>
+ 3c9:	83 c4 10             	add    $0x10,%esp
+ 3cc:	85 c0                	test   %eax,%eax
+ 3ce:	74 e0                	je     3b0 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 3d0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3d3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3d8:	85 c0                	test   %eax,%eax
+ 3da:	0f 4e c2             	cmovle %edx,%eax
+}
+ 3dd:	c9                   	leave
+ 3de:	c3                   	ret
+
+000003df <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 3df:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3e4:	cd 40                	int    $0x40
+ 3e6:	c3                   	ret
+
+000003e7 <exit>:
+SYSCALL(exit)
+ 3e7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3ec:	cd 40                	int    $0x40
+ 3ee:	c3                   	ret
+
+000003ef <wait>:
+SYSCALL(wait)
+ 3ef:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3f4:	cd 40                	int    $0x40
+ 3f6:	c3                   	ret
+
+000003f7 <pipe>:
+SYSCALL(pipe)
+ 3f7:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3fc:	cd 40                	int    $0x40
+ 3fe:	c3                   	ret
+
+000003ff <read>:
+SYSCALL(read)
+ 3ff:	b8 05 00 00 00       	mov    $0x5,%eax
+ 404:	cd 40                	int    $0x40
+ 406:	c3                   	ret
+
+00000407 <write>:
+SYSCALL(write)
+ 407:	b8 10 00 00 00       	mov    $0x10,%eax
+ 40c:	cd 40                	int    $0x40
+ 40e:	c3                   	ret
+
+0000040f <close>:
+SYSCALL(close)
+ 40f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 414:	cd 40                	int    $0x40
+ 416:	c3                   	ret
+
+00000417 <kill>:
+SYSCALL(kill)
+ 417:	b8 06 00 00 00       	mov    $0x6,%eax
+ 41c:	cd 40                	int    $0x40
+ 41e:	c3                   	ret
+
+0000041f <exec>:
+SYSCALL(exec)
+ 41f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 424:	cd 40                	int    $0x40
+ 426:	c3                   	ret
+
+00000427 <open>:
+SYSCALL(open)
+ 427:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 42c:	cd 40                	int    $0x40
+ 42e:	c3                   	ret
+
+0000042f <mknod>:
+SYSCALL(mknod)
+ 42f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 434:	cd 40                	int    $0x40
+ 436:	c3                   	ret
+
+00000437 <unlink>:
+SYSCALL(unlink)
+ 437:	b8 12 00 00 00       	mov    $0x12,%eax
+ 43c:	cd 40                	int    $0x40
+ 43e:	c3                   	ret
+
+0000043f <fstat>:
+SYSCALL(fstat)
+ 43f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 444:	cd 40                	int    $0x40
+ 446:	c3                   	ret
+
+00000447 <link>:
+SYSCALL(link)
+ 447:	b8 13 00 00 00       	mov    $0x13,%eax
+ 44c:	cd 40                	int    $0x40
+ 44e:	c3                   	ret
+
+0000044f <mkdir>:
+SYSCALL(mkdir)
+ 44f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 454:	cd 40                	int    $0x40
+ 456:	c3                   	ret
+
+00000457 <chdir>:
+SYSCALL(chdir)
+ 457:	b8 09 00 00 00       	mov    $0x9,%eax
+ 45c:	cd 40                	int    $0x40
+ 45e:	c3                   	ret
+
+0000045f <dup>:
+SYSCALL(dup)
+ 45f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 464:	cd 40                	int    $0x40
+ 466:	c3                   	ret
+
+00000467 <getpid>:
+SYSCALL(getpid)
+ 467:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 46c:	cd 40                	int    $0x40
+ 46e:	c3                   	ret
+
+0000046f <sbrk>:
+SYSCALL(sbrk)
+ 46f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 474:	cd 40                	int    $0x40
+ 476:	c3                   	ret
+
+00000477 <sleep>:
+SYSCALL(sleep)
+ 477:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+0000047f <uptime>:
+SYSCALL(uptime)
+ 47f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+
+00000487 <poll>:
+SYSCALL(poll)
+ 487:	b8 16 00 00 00       	mov    $0x16,%eax
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+0000048f <fcntl>:
+SYSCALL(fcntl)
+ 48f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+00000497 <irqroute>:
+SYSCALL(irqroute)
+ 497:	b8 18 00 00 00       	mov    $0x18,%eax
+ 49c:	cd 40                	int    $0x40
+ 49e:	c3                   	ret
+
+0000049f <intrstat>:
+SYSCALL(intrstat)
+ 49f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4a4:	cd 40                	int    $0x40
+ 4a6:	c3                   	ret
+
+000004a7 <pread>:
+SYSCALL(pread)
+ 4a7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+000004af <getdents>:
+SYSCALL(getdents)
+ 4af:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+000004b7 <fstatat>:
+SYSCALL(fstatat)
+ 4b7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <openat>:
+SYSCALL(openat)
+ 4bf:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4c4:	cd 40                	int    $0x40
+ 4c6:	c3                   	ret
+
+000004c7 <unlinkat>:
+SYSCALL(unlinkat)
+ 4c7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4cc:	cd 40                	int    $0x40
+ 4ce:	c3                   	ret
+
+000004cf <mkdirat>:
+SYSCALL(mkdirat)
+ 4cf:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4d4:	cd 40                	int    $0x40
+ 4d6:	c3                   	ret
+
+000004d7 <linkat>:
+SYSCALL(linkat)
+ 4d7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4dc:	cd 40                	int    $0x40
+ 4de:	c3                   	ret
+
+000004df <exits>:
+SYSCALL(exits)
+ 4df:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4e4:	cd 40                	int    $0x40
+ 4e6:	c3                   	ret
+
+000004e7 <waitstatus>:
+SYSCALL(waitstatus)
+ 4e7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+000004ef <pwrite>:
+SYSCALL(pwrite)
+ 4ef:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+000004f7 <lseek>:
+SYSCALL(lseek)
+ 4f7:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+000004ff <copyfilerange>:
+SYSCALL(copyfilerange)
+ 4ff:	b8 25 00 00 00       	mov    $0x25,%eax
+ 504:	cd 40                	int    $0x40
+ 506:	c3                   	ret
+
+00000507 <fsctl>:
+SYSCALL(fsctl)
+ 507:	b8 26 00 00 00       	mov    $0x26,%eax
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+0000050f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 50f:	55                   	push   %ebp
+ 510:	89 e5                	mov    %esp,%ebp
+ 512:	83 ec 18             	sub    $0x18,%esp
+ 515:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 518:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 51b:	83 ec 04             	sub    $0x4,%esp
+ 51e:	6a 01                	push   $0x1
+ 520:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 523:	50                   	push   %eax
+ 524:	ff 75 08             	push   0x8(%ebp)
+ 527:	e8 db fe ff ff       	call   407 <write>
+ 52c:	83 c4 10             	add    $0x10,%esp
+}
+ 52f:	90                   	nop
+ 530:	c9                   	leave
+ 531:	c3                   	ret
+
+00000532 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 532:	55                   	push   %ebp
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 538:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 53f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 543:	74 17                	je     55c <printint+0x2a>
+ 545:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 549:	79 11                	jns    55c <printint+0x2a>
+    neg = 1;
+ 54b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 552:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 555:	f7 d8                	neg    %eax
+ 557:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 55a:	eb 06                	jmp    562 <printint+0x30>
+  } else {
+    x = xx;
+ 55c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 562:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 569:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 56c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 56f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 574:	f7 f1                	div    %ecx
+ 576:	89 d1                	mov    %edx,%ecx
+ 578:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 57b:	8d 50 01             	lea    0x1(%eax),%edx
+ 57e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 581:	0f b6 91 28 0c 00 00 	movzbl 0xc28(%ecx),%edx
+ 588:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 58c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 58f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 592:	ba 00 00 00 00       	mov    $0x0,%edx
+ 597:	f7 f1                	div    %ecx
+ 599:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 59c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5a0:	75 c7                	jne    569 <printint+0x37>
+  if(neg)
+ 5a2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5a6:	74 2d                	je     5d5 <printint+0xa3>
+    buf[i++] = '-';
+ 5a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ab:	8d 50 01             	lea    0x1(%eax),%edx
+ 5ae:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5b1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5b6:	eb 1d                	jmp    5d5 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5b8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5be:	01 d0                	add    %edx,%eax
+ 5c0:	0f b6 00             	movzbl (%eax),%eax
+ 5c3:	0f be c0             	movsbl %al,%eax
+ 5c6:	83 ec 08             	sub    $0x8,%esp
+ 5c9:	50                   	push   %eax
+ 5ca:	ff 75 08             	push   0x8(%ebp)
+ 5cd:	e8 3d ff ff ff       	call   50f <putc>
+ 5d2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 5d5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 5d9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5dd:	79 d9                	jns    5b8 <printint+0x86>
+}
+ 5df:	90                   	nop
+ 5e0:	90                   	nop
+ 5e1:	c9                   	leave
+ 5e2:	c3                   	ret
+
+000005e3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5e3:	55                   	push   %ebp
+ 5e4:	89 e5                	mov    %esp,%ebp
+ 5e6:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 5e9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 5f0:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5f3:	83 c0 04             	add    $0x4,%eax
+ 5f6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5f9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 600:	e9 59 01 00 00       	jmp    75e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 605:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 608:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 60b:	01 d0                	add    %edx,%eax
+ 60d:	0f b6 00             	movzbl (%eax),%eax
+ 610:	0f be c0             	movsbl %al,%eax
+ 613:	25 ff 00 00 00       	and    $0xff,%eax
+ 618:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 61b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 61f:	75 2c                	jne    64d <printf+0x6a>
+      if(c == '%'){
+ 621:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 625:	75 0c                	jne    633 <printf+0x50>
+        state = '%';
+ 627:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 62e:	e9 27 01 00 00       	jmp    75a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 633:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 636:	0f be c0             	movsbl %al,%eax
+ 639:	83 ec 08             	sub    $0x8,%esp
+ 63c:	50                   	push   %eax
+ 63d:	ff 75 08             	push   0x8(%ebp)
+ 640:	e8 ca fe ff ff       	call   50f <putc>
+ 645:	83 c4 10             	add    $0x10,%esp
+ 648:	e9 0d 01 00 00       	jmp    75a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 64d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 651:	0f 85 03 01 00 00    	jne    75a <printf+0x177>
+      if(c == 'd'){
+ 657:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 65b:	75 1e                	jne    67b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 65d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 660:	8b 00                	mov    (%eax),%eax
+ 662:	6a 01                	push   $0x1
+ 664:	6a 0a                	push   $0xa
+ 666:	50                   	push   %eax
+ 667:	ff 75 08             	push   0x8(%ebp)
+ 66a:	e8 c3 fe ff ff       	call   532 <printint>
+ 66f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 672:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 676:	e9 d8 00 00 00       	jmp    753 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 67b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 67f:	74 06                	je     687 <printf+0xa4>
+ 681:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 685:	75 1e                	jne    6a5 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 687:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 68a:	8b 00                	mov    (%eax),%eax
+ 68c:	6a 00                	push   $0x0
+ 68e:	6a 10                	push   $0x10
+ 690:	50                   	push   %eax
+ 691:	ff 75 08             	push   0x8(%ebp)
+ 694:	e8 99 fe ff ff       	call   532 <printint>
+ 699:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 69c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6a0:	e9 ae 00 00 00       	jmp    753 <printf+0x170>
+      } else if(c == 's'){
+ 6a5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6a9:	75 43                	jne    6ee <printf+0x10b>
+        s = (char*)*ap;
+ 6ab:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ae:	8b 00                	mov    (%eax),%eax
+ 6b0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6b3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6b7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6bb:	75 25                	jne    6e2 <printf+0xff>
+          s = "(null)";
+ 6bd:	c7 45 f4 bd 09 00 00 	movl   $0x9bd,-0xc(%ebp)
+        while(*s != 0){
+ 6c4:	eb 1c                	jmp    6e2 <printf+0xff>
+          putc(fd, *s);
+ 6c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c9:	0f b6 00             	movzbl (%eax),%eax
+ 6cc:	0f be c0             	movsbl %al,%eax
+ 6cf:	83 ec 08             	sub    $0x8,%esp
+ 6d2:	50                   	push   %eax
+ 6d3:	ff 75 08             	push   0x8(%ebp)
+ 6d6:	e8 34 fe ff ff       	call   50f <putc>
+ 6db:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 6de:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 6e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e5:	0f b6 00             	movzbl (%eax),%eax
+ 6e8:	84 c0                	test   %al,%al
+ 6ea:	75 da                	jne    6c6 <printf+0xe3>
+ 6ec:	eb 65                	jmp    753 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 6ee:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6f2:	75 1d                	jne    711 <printf+0x12e>
+        putc(fd, *ap);
+ 6f4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f7:	8b 00                	mov    (%eax),%eax
+ 6f9:	0f be c0             	movsbl %al,%eax
+ 6fc:	83 ec 08             	sub    $0x8,%esp
+ 6ff:	50                   	push   %eax
+ 700:	ff 75 08             	push   0x8(%ebp)
+ 703:	e8 07 fe ff ff       	call   50f <putc>
+ 708:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 70b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 70f:	eb 42                	jmp    753 <printf+0x170>
+      } else if(c == '%'){
+ 711:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 715:	75 17                	jne    72e <printf+0x14b>
+        putc(fd, c);
+ 717:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 71a:	0f be c0             	movsbl %al,%eax
+ 71d:	83 ec 08             	sub    $0x8,%esp
+ 720:	50                   	push   %eax
+ 721:	ff 75 08             	push   0x8(%ebp)
+ 724:	e8 e6 fd ff ff       	call   50f <putc>
+ 729:	83 c4 10             	add    $0x10,%esp
+ 72c:	eb 25                	jmp    753 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 72e:	83 ec 08             	sub    $0x8,%esp
+ 731:	6a 25                	push   $0x25
+ 733:	ff 75 08             	push   0x8(%ebp)
+ 736:	e8 d4 fd ff ff       	call   50f <putc>
+ 73b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 73e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 741:	0f be c0             	movsbl %al,%eax
+ 744:	83 ec 08             	sub    $0x8,%esp
+ 747:	50                   	push   %eax
+ 748:	ff 75 08             	push   0x8(%ebp)
+ 74b:	e8 bf fd ff ff       	call   50f <putc>
+ 750:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 753:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 75a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 75e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 761:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 764:	01 d0                	add    %edx,%eax
+ 766:	0f b6 00             	movzbl (%eax),%eax
+ 769:	84 c0                	test   %al,%al
+ 76b:	0f 85 94 fe ff ff    	jne    605 <printf+0x22>
+    }
+  }
+}
+ 771:	90                   	nop
+ 772:	90                   	nop
+ 773:	c9                   	leave
+ 774:	c3                   	ret
+
+00000775 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 775:	55                   	push   %ebp
+ 776:	89 e5                	mov    %esp,%ebp
+ 778:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 77b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 77e:	83 e8 08             	sub    $0x8,%eax
+ 781:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 784:	a1 44 0c 00 00       	mov    0xc44,%eax
+ 789:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 78c:	eb 24                	jmp    7b2 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 78e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 791:	8b 00                	mov    (%eax),%eax
+ 793:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 796:	72 12                	jb     7aa <free+0x35>
+ 798:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 79b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 79e:	72 24                	jb     7c4 <free+0x4f>
+ 7a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7a3:	8b 00                	mov    (%eax),%eax
+ 7a5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7a8:	72 1a                	jb     7c4 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7aa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7ad:	8b 00                	mov    (%eax),%eax
+ 7af:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 7b2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7b5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 7b8:	73 d4                	jae    78e <free+0x19>
+ 7ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7bd:	8b 00                	mov    (%eax),%eax
+ 7bf:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 7c2:	73 ca                	jae    78e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7c4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7c7:	8b 40 04             	mov    0x4(%eax),%eax
+ 7ca:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 7d1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7d4:	01 c2                	add    %eax,%edx
+ 7d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7d9:	8b 00                	mov    (%eax),%eax
+ 7db:	39 c2                	cmp    %eax,%edx
+ 7dd:	75 24                	jne    803 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 7df:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7e2:	8b 50 04             	mov    0x4(%eax),%edx
+ 7e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e8:	8b 00                	mov    (%eax),%eax
+ 7ea:	8b 40 04             	mov    0x4(%eax),%eax
+ 7ed:	01 c2                	add    %eax,%edx
+ 7ef:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7f2:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f8:	8b 00                	mov    (%eax),%eax
+ 7fa:	8b 10                	mov    (%eax),%edx
+ 7fc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 7ff:	89 10                	mov    %edx,(%eax)
+ 801:	eb 0a                	jmp    80d <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 803:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 806:	8b 10                	mov    (%eax),%edx
+ 808:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 80b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 80d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 810:	8b 40 04             	mov    0x4(%eax),%eax
+ 813:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 81a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 81d:	01 d0                	add    %edx,%eax
+ 81f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 822:	75 20                	jne    844 <free+0xcf>
+    p->s.size += bp->s.size;
+ 824:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 827:	8b 50 04             	mov    0x4(%eax),%edx
+ 82a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 82d:	8b 40 04             	mov    0x4(%eax),%eax
+ 830:	01 c2                	add    %eax,%edx
+ 832:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 835:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 838:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 83b:	8b 10                	mov    (%eax),%edx
+ 83d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 840:	89 10                	mov    %edx,(%eax)
+ 842:	eb 08                	jmp    84c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 844:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 847:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 84a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 84c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 84f:	a3 44 0c 00 00       	mov    %eax,0xc44
+}
+ 854:	90                   	nop
+ 855:	c9                   	leave
+ 856:	c3                   	ret
+
+00000857 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 857:	55                   	push   %ebp
+ 858:	89 e5                	mov    %esp,%ebp
+ 85a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 85d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 864:	77 07                	ja     86d <morecore+0x16>
+    nu = 4096;
+ 866:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 86d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 870:	c1 e0 03             	shl    $0x3,%eax
+ 873:	83 ec 0c             	sub    $0xc,%esp
+ 876:	50                   	push   %eax
+ 877:	e8 f3 fb ff ff       	call   46f <sbrk>
+ 87c:	83 c4 10             	add    $0x10,%esp
+ 87f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 882:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 886:	75 07                	jne    88f <morecore+0x38>
+    return 0;
+ 888:	b8 00 00 00 00       	mov    $0x0,%eax
+ 88d:	eb 26                	jmp    8b5 <morecore+0x5e>
+  hp = (Header*)p;
+ 88f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 892:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 895:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 898:	8b 55 08             	mov    0x8(%ebp),%edx
+ 89b:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 89e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8a1:	83 c0 08             	add    $0x8,%eax
+ 8a4:	83 ec 0c             	sub    $0xc,%esp
+ 8a7:	50                   	push   %eax
+ 8a8:	e8 c8 fe ff ff       	call   775 <free>
+ 8ad:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 8b0:	a1 44 0c 00 00       	mov    0xc44,%eax
+}
+ 8b5:	c9                   	leave
+ 8b6:	c3                   	ret
+
+000008b7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 8b7:	55                   	push   %ebp
+ 8b8:	89 e5                	mov    %esp,%ebp
+ 8ba:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c0:	83 c0 07             	add    $0x7,%eax
+ 8c3:	c1 e8 03             	shr    $0x3,%eax
+ 8c6:	83 c0 01             	add    $0x1,%eax
+ 8c9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 8cc:	a1 44 0c 00 00       	mov    0xc44,%eax
+ 8d1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 8d4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8d8:	75 23                	jne    8fd <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 8da:	c7 45 f0 3c 0c 00 00 	movl   $0xc3c,-0x10(%ebp)
+ 8e1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e4:	a3 44 0c 00 00       	mov    %eax,0xc44
+ 8e9:	a1 44 0c 00 00       	mov    0xc44,%eax
+ 8ee:	a3 3c 0c 00 00       	mov    %eax,0xc3c
+    base.s.size = 0;
+ 8f3:	c7 05 40 0c 00 00 00 	movl   $0x0,0xc40
+ 8fa:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8fd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 900:	8b 00                	mov    (%eax),%eax
+ 902:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 905:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 908:	8b 40 04             	mov    0x4(%eax),%eax
+ 90b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 90e:	72 4d                	jb     95d <malloc+0xa6>
+      if(p->s.size == nunits)
+ 910:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 913:	8b 40 04             	mov    0x4(%eax),%eax
+ 916:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 919:	75 0c                	jne    927 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 91b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 91e:	8b 10                	mov    (%eax),%edx
+ 920:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 923:	89 10                	mov    %edx,(%eax)
+ 925:	eb 26                	jmp    94d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 927:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 92a:	8b 40 04             	mov    0x4(%eax),%eax
+ 92d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 930:	89 c2                	mov    %eax,%edx
+ 932:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 935:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 938:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93b:	8b 40 04             	mov    0x4(%eax),%eax
+ 93e:	c1 e0 03             	shl    $0x3,%eax
+ 941:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 944:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 947:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 94a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 94d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 950:	a3 44 0c 00 00       	mov    %eax,0xc44
+      return (void*)(p + 1);
+ 955:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 958:	83 c0 08             	add    $0x8,%eax
+ 95b:	eb 3b                	jmp    998 <malloc+0xe1>
+    }
+    if(p == freep)
+ 95d:	a1 44 0c 00 00       	mov    0xc44,%eax
+ 962:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 965:	75 1e                	jne    985 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 967:	83 ec 0c             	sub    $0xc,%esp
+ 96a:	ff 75 ec             	push   -0x14(%ebp)
+ 96d:	e8 e5 fe ff ff       	call   857 <morecore>
+ 972:	83 c4 10             	add    $0x10,%esp
+ 975:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 978:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 97c:	75 07                	jne    985 <malloc+0xce>
+        return 0;
+ 97e:	b8 00 00 00 00       	mov    $0x0,%eax
+ 983:	eb 13                	jmp    998 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 985:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 988:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 98b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98e:	8b 00                	mov    (%eax),%eax
+ 990:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 993:	e9 6d ff ff ff       	jmp    905 <malloc+0x4e>
+  }
+}
+ 998:	c9                   	leave
+ 999:	c3                   	ret
@@ -98,6 +98,23 @@ extern int sys_unlink(void);
 extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
+extern int sys_poll(void);
+extern int sys_fcntl(void);
+extern int sys_irqroute(void);
+extern int sys_intrstat(void);
+extern int sys_pread(void);
+extern int sys_getdents(void);
+extern int sys_fstatat(void);
+extern int sys_openat(void);
+extern int sys_unlinkat(void);
+extern int sys_mkdirat(void);
+extern int sys_linkat(void);
+extern int sys_exits(void);
+extern int sys_waitstatus(void);
+extern int sys_pwrite(void);
+extern int sys_lseek(void);
+extern int sys_copyfilerange(void);
+extern int sys_fsctl(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -121,6 +138,23 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
+[SYS_poll]    sys_poll,
+[SYS_fcntl]   sys_fcntl,
+[SYS_irqroute] sys_irqroute,
+[SYS_intrstat] sys_intrstat,
+[SYS_pread]   sys_pread,
+[SYS_getdents] sys_getdents,
+[SYS_fstatat] sys_fstatat,
+[SYS_openat]  sys_openat,
+[SYS_unlinkat] sys_unlinkat,
+[SYS_mkdirat] sys_mkdirat,
+[SYS_linkat]  sys_linkat,
+[SYS_exits]   sys_exits,
+[SYS_waitstatus] sys_waitstatus,
+[SYS_pwrite]  sys_pwrite,
+[SYS_lseek]   sys_lseek,
+[SYS_copyfilerange] sys_copyfilerange,
+[SYS_fsctl]   sys_fsctl,
 };
 
 void
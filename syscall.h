@@ -20,3 +20,20 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_poll   22
+#define SYS_fcntl  23
+#define SYS_irqroute 24
+#define SYS_intrstat 25
+#define SYS_pread  26
+#define SYS_getdents 27
+#define SYS_fstatat 28
+#define SYS_openat 29
+#define SYS_unlinkat 30
+#define SYS_mkdirat 31
+#define SYS_linkat 32
+#define SYS_exits  33
+#define SYS_waitstatus 34
+#define SYS_pwrite 35
+#define SYS_lseek  36
+#define SYS_copyfilerange 37
+#define SYS_fsctl  38
@@ -13,6 +13,9 @@
 #include "fs.h"
 #include "file.h"
 #include "fcntl.h"
+#include "fsctl.h"
+#include "poll.h"
+#include "spinlock.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -24,7 +27,7 @@ argfd(int n, int *pfd, struct file **pf)
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+  if(fd < 0 || fd >= proc->nofile || (f=proc->ofile[fd]) == 0)
     return -1;
   if(pfd)
     *pfd = fd;
@@ -33,20 +36,25 @@ argfd(int n, int *pfd, struct file **pf)
   return 0;
 }
 
-// Allocate a file descriptor for the given file.
-// Takes over file reference from caller on success.
+// Fetch the nth word-sized system call argument as a directory
+// file descriptor for the *at() calls and return its inode
+// (not referenced); AT_FDCWD means the current directory.
 static int
-fdalloc(struct file *f)
+argdirfd(int n, struct inode **pdp)
 {
   int fd;
+  struct file *f;
 
-  for(fd = 0; fd < NOFILE; fd++){
-    if(proc->ofile[fd] == 0){
-      proc->ofile[fd] = f;
-      return fd;
-    }
+  if(argint(n, &fd) < 0)
+    return -1;
+  if(fd == AT_FDCWD){
+    *pdp = proc->cwd;
+    return 0;
   }
-  return -1;
+  if(fd < 0 || fd >= proc->nofile || (f=proc->ofile[fd]) == 0 || f->type != FD_INODE)
+    return -1;
+  *pdp = f->ip;
+  return 0;
 }
 
 int
@@ -95,11 +103,122 @@ sys_close(void)
   
   if(argfd(0, &fd, &f) < 0)
     return -1;
-  proc->ofile[fd] = 0;
-  fileclose(f);
+  fileclose(fdfree(fd));
   return 0;
 }
 
+// Read at an offset without moving the file offset, so that
+// several processes can read one open file independently.
+int
+sys_pread(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepread(f, p, n, off);
+}
+
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  int n, off;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  return filepwrite(f, p, n, off);
+}
+
+// Copy n bytes from fdin at offin to fdout at offout inside the
+// kernel, leaving both file offsets alone.  Aligned whole blocks
+// are shared copy-on-write (see copyi()).
+int
+sys_copyfilerange(void)
+{
+  struct file *fin, *fout;
+  int offin, offout, n;
+
+  if(argfd(0, 0, &fin) < 0 || argint(1, &offin) < 0 ||
+     argfd(2, 0, &fout) < 0 || argint(3, &offout) < 0 ||
+     argint(4, &n) < 0 || offin < 0 || offout < 0 || n < 0)
+    return -1;
+  return filecopy(fin, offin, fout, offout, n);
+}
+
+// File system control for support tools; see fsctl.h.
+int
+sys_fsctl(void)
+{
+  struct file *f;
+  struct extents *e;
+  int cmd;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &cmd) < 0 || f->type != FD_INODE)
+    return -1;
+  switch(cmd){
+  case FS_EXTENTS:
+    if(argptr(2, (void*)&e, sizeof(*e)) < 0)
+      return -1;
+    ilock(f->ip);
+    iextents(f->ip, e);
+    iunlock(f->ip);
+    return 0;
+  case FS_DEFRAG:
+    if(!f->writable)
+      return -1;
+    return idefrag(f->ip);
+  case FS_COMPRESS:
+    if(!f->writable)
+      return -1;
+    return icompress(f->ip);
+  }
+  return -1;
+}
+
+int
+sys_lseek(void)
+{
+  struct file *f;
+  int off, whence;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &off) < 0 || argint(2, &whence) < 0)
+    return -1;
+  return fileseek(f, off, whence);
+}
+
+// Get or set descriptor flags; only O_NONBLOCK can be changed.
+int
+sys_fcntl(void)
+{
+  struct file *f;
+  int cmd, arg, mode;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &cmd) < 0 || argint(2, &arg) < 0)
+    return -1;
+  switch(cmd){
+  case F_GETFL:
+    if(f->readable && f->writable)
+      mode = O_RDWR;
+    else if(f->writable)
+      mode = O_WRONLY;
+    else
+      mode = O_RDONLY;
+    if(f->nonblock)
+      mode |= O_NONBLOCK;
+    return mode;
+  case F_SETFL:
+    f->nonblock = (arg & O_NONBLOCK) != 0;
+    return 0;
+  }
+  return -1;
+}
+
 int
 sys_fstat(void)
 {
@@ -111,18 +230,73 @@ sys_fstat(void)
   return filestat(f, st);
 }
 
-// Create the path new as a link to the same inode as old.
+// stat() a path relative to a directory fd, without the
+// open and close that ulib's stat() needs.
 int
-sys_link(void)
+sys_fstatat(void)
 {
-  char name[DIRSIZ], *new, *old;
+  char *path;
   struct inode *dp, *ip;
+  struct stat *st;
 
-  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+  if(argdirfd(0, &dp) < 0 || argstr(1, &path) < 0 ||
+     argptr(2, (void*)&st, sizeof(*st)) < 0)
     return -1;
+  begin_op(IPUTBLOCKS);
+  if((ip = nameiat(dp, path)) == 0){
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+  stati(ip, st);
+  iunlockput(ip);
+  end_op();
+  return 0;
+}
+
+// Copy as many in-use directory entries as fit in n bytes,
+// starting at the directory's file offset.  Returns the number
+// of bytes stored, 0 at the end of the directory.
+int
+sys_getdents(void)
+{
+  struct file *f;
+  struct dirent de;
+  int n, m;
+  char *p;
 
-  begin_op();
-  if((ip = namei(old)) == 0){
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || n < 0 || argptr(1, &p, n) < 0)
+    return -1;
+  if(f->type != FD_INODE || !f->readable)
+    return -1;
+  ilock(f->ip);
+  if(f->ip->type != T_DIR){
+    iunlock(f->ip);
+    return -1;
+  }
+  for(m = 0; m + sizeof(de) <= n && f->off + sizeof(de) <= f->ip->size; ){
+    if(readi(f->ip, (char*)&de, f->off, sizeof(de)) != sizeof(de))
+      break;
+    f->off += sizeof(de);
+    if(de.inum == 0)
+      continue;
+    memmove(p + m, &de, sizeof(de));
+    m += sizeof(de);
+  }
+  iunlock(f->ip);
+  return m;
+}
+
+// Create the path new as a link to the same inode as old.
+// Relative paths start at olddp and newdp respectively.
+static int
+linkat(struct inode *olddp, char *old, struct inode *newdp, char *new)
+{
+  char name[DIRSIZ];
+  struct inode *dp, *ip;
+
+  begin_op(LINKBLOCKS+1);
+  if((ip = nameiat(olddp, old)) == 0){
     end_op();
     return -1;
   }
@@ -138,7 +312,7 @@ sys_link(void)
   iupdate(ip);
   iunlock(ip);
 
-  if((dp = nameiparent(new, name)) == 0)
+  if((dp = nameiparentat(newdp, new, name)) == 0)
     goto bad;
   ilock(dp);
   if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
@@ -161,151 +335,83 @@ bad:
   return -1;
 }
 
-// Is the directory dp empty except for "." and ".." ?
-static int
-isdirempty(struct inode *dp)
+int
+sys_link(void)
 {
-  int off;
-  struct dirent de;
+  char *new, *old;
 
-  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("isdirempty: readi");
-    if(de.inum != 0)
-      return 0;
-  }
-  return 1;
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+    return -1;
+  return linkat(proc->cwd, old, proc->cwd, new);
 }
 
-//PAGEBREAK!
 int
-sys_unlink(void)
+sys_linkat(void)
 {
-  struct inode *ip, *dp;
-  struct dirent de;
-  char name[DIRSIZ], *path;
-  uint off;
+  char *new, *old;
+  struct inode *olddp, *newdp;
 
-  if(argstr(0, &path) < 0)
+  if(argdirfd(0, &olddp) < 0 || argstr(1, &old) < 0 ||
+     argdirfd(2, &newdp) < 0 || argstr(3, &new) < 0)
     return -1;
+  return linkat(olddp, old, newdp, new);
+}
 
-  begin_op();
-  if((dp = nameiparent(path, name)) == 0){
-    end_op();
-    return -1;
-  }
-
-  ilock(dp);
-
-  // Cannot unlink "." or "..".
-  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
-    goto bad;
-
-  if((ip = dirlookup(dp, name, &off)) == 0)
-    goto bad;
-  ilock(ip);
-
-  if(ip->nlink < 1)
-    panic("unlink: nlink < 1");
-  if(ip->type == T_DIR && !isdirempty(ip)){
-    iunlockput(ip);
-    goto bad;
-  }
-
-  memset(&de, 0, sizeof(de));
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("unlink: writei");
-  if(ip->type == T_DIR){
-    dp->nlink--;
-    iupdate(dp);
-  }
-  iunlockput(dp);
-
-  ip->nlink--;
-  iupdate(ip);
-  iunlockput(ip);
-
-  end_op();
-
-  return 0;
+//PAGEBREAK!
+static int
+unlinkat(struct inode *pdp, char *path)
+{
+  int r;
 
-bad:
-  iunlockput(dp);
+  begin_op(UNLINKBLOCKS);
+  r = dirunlink(pdp, path);
   end_op();
-  return -1;
+  return r;
 }
 
-static struct inode*
-create(char *path, short type, short major, short minor)
+int
+sys_unlink(void)
 {
-  uint off;
-  struct inode *ip, *dp;
-  char name[DIRSIZ];
-
-  if((dp = nameiparent(path, name)) == 0)
-    return 0;
-  ilock(dp);
-
-  if((ip = dirlookup(dp, name, &off)) != 0){
-    iunlockput(dp);
-    ilock(ip);
-    if(type == T_FILE && ip->type == T_FILE)
-      return ip;
-    iunlockput(ip);
-    return 0;
-  }
-
-  if((ip = ialloc(dp->dev, type)) == 0)
-    panic("create: ialloc");
-
-  ilock(ip);
-  ip->major = major;
-  ip->minor = minor;
-  ip->nlink = 1;
-  iupdate(ip);
-
-  if(type == T_DIR){  // Create . and .. entries.
-    dp->nlink++;  // for ".."
-    iupdate(dp);
-    // No ip->nlink++ for ".": avoid cyclic ref count.
-    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
-      panic("create dots");
-  }
-
-  if(dirlink(dp, name, ip->inum) < 0)
-    panic("create: dirlink");
-
-  iunlockput(dp);
+  char *path;
 
-  return ip;
+  if(argstr(0, &path) < 0)
+    return -1;
+  return unlinkat(proc->cwd, path);
 }
 
 int
-sys_open(void)
+sys_unlinkat(void)
 {
   char *path;
-  int fd, omode;
-  struct file *f;
-  struct inode *ip;
+  struct inode *dp;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+  if(argdirfd(0, &dp) < 0 || argstr(1, &path) < 0)
     return -1;
+  return unlinkat(dp, path);
+}
+
+static int
+openat(struct inode *dp, char *path, int omode)
+{
+  int fd;
+  struct file *f;
+  struct inode *ip;
 
-  begin_op();
+  begin_op(omode & O_CREATE ? CREATEBLOCKS : IPUTBLOCKS);
 
   if(omode & O_CREATE){
-    ip = create(path, T_FILE, 0, 0);
+    ip = dircreate(dp, path, T_FILE, 0, 0);
     if(ip == 0){
       end_op();
       return -1;
     }
   } else {
-    if((ip = namei(path)) == 0){
+    if((ip = nameiat(dp, path)) == 0){
       end_op();
       return -1;
     }
     ilock(ip);
-    if(ip->type == T_DIR && omode != O_RDONLY){
+    if(ip->type == T_DIR && (omode & (O_WRONLY|O_RDWR))){
       iunlockput(ip);
       end_op();
       return -1;
@@ -327,17 +433,40 @@ sys_open(void)
   f->off = 0;
   f->readable = !(omode & O_WRONLY);
   f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+  f->nonblock = (omode & O_NONBLOCK) != 0;
   return fd;
 }
 
 int
-sys_mkdir(void)
+sys_open(void)
+{
+  char *path;
+  int omode;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+    return -1;
+  return openat(proc->cwd, path, omode);
+}
+
+int
+sys_openat(void)
 {
   char *path;
+  int omode;
+  struct inode *dp;
+
+  if(argdirfd(0, &dp) < 0 || argstr(1, &path) < 0 || argint(2, &omode) < 0)
+    return -1;
+  return openat(dp, path, omode);
+}
+
+static int
+mkdirat(struct inode *dp, char *path)
+{
   struct inode *ip;
 
-  begin_op();
-  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+  begin_op(MKDIRBLOCKS);
+  if((ip = dircreate(dp, path, T_DIR, 0, 0)) == 0){
     end_op();
     return -1;
   }
@@ -346,6 +475,27 @@ sys_mkdir(void)
   return 0;
 }
 
+int
+sys_mkdir(void)
+{
+  char *path;
+
+  if(argstr(0, &path) < 0)
+    return -1;
+  return mkdirat(proc->cwd, path);
+}
+
+int
+sys_mkdirat(void)
+{
+  char *path;
+  struct inode *dp;
+
+  if(argdirfd(0, &dp) < 0 || argstr(1, &path) < 0)
+    return -1;
+  return mkdirat(dp, path);
+}
+
 int
 sys_mknod(void)
 {
@@ -354,11 +504,11 @@ sys_mknod(void)
   int len;
   int major, minor;
   
-  begin_op();
+  begin_op(CREATEBLOCKS);
   if((len=argstr(0, &path)) < 0 ||
      argint(1, &major) < 0 ||
      argint(2, &minor) < 0 ||
-     (ip = create(path, T_DEV, major, minor)) == 0){
+     (ip = dircreate(proc->cwd, path, T_DEV, major, minor)) == 0){
     end_op();
     return -1;
   }
@@ -373,7 +523,7 @@ sys_chdir(void)
   char *path;
   struct inode *ip;
 
-  begin_op();
+  begin_op(IPUTBLOCKS);
   if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
     end_op();
     return -1;
@@ -431,7 +581,7 @@ sys_pipe(void)
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
     if(fd0 >= 0)
-      proc->ofile[fd0] = 0;
+      fdfree(fd0);
     fileclose(rf);
     fileclose(wf);
     return -1;
@@ -440,3 +590,52 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Wait for one of nfds descriptors to become ready.
+// timeout is in clock ticks; -1 waits forever and 0 just polls.
+// Returns the number of descriptors with non-zero revents.
+int
+sys_poll(void)
+{
+  struct pollfd *fds;
+  struct file *f;
+  int nfds, timeout, i, n;
+  uint seq, ticks0;
+
+  if(argint(1, &nfds) < 0 || argint(2, &timeout) < 0)
+    return -1;
+  if(nfds < 0 || nfds > MAXOFILE)
+    return -1;
+  if(argptr(0, (void*)&fds, nfds*sizeof(fds[0])) < 0)
+    return -1;
+
+  acquire(&tickslock);
+  ticks0 = ticks;
+  release(&tickslock);
+
+  seq = pollstart(timeout > 0);
+  for(;;){
+    n = 0;
+    for(i = 0; i < nfds; i++){
+      fds[i].revents = 0;
+      if(fds[i].fd < 0)
+        continue;
+      if(fds[i].fd >= proc->nofile || (f = proc->ofile[fds[i].fd]) == 0)
+        fds[i].revents = POLLNVAL;
+      else
+        fds[i].revents = filepoll(f, fds[i].events);
+      if(fds[i].revents)
+        n++;
+    }
+    if(n > 0 || timeout == 0 || proc->killed)
+      break;
+    if(timeout > 0 && ticks - ticks0 >= timeout)
+      break;
+    seq = pollwait(seq);
+  }
+  polldone(timeout > 0);
+
+  if(proc->killed)
+    return -1;
+  return n;
+}
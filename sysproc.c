@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "intr.h"
 
 int
 sys_fork(void)
@@ -16,6 +17,20 @@ sys_fork(void)
 int
 sys_exit(void)
 {
+  proc->xstate = 0;
+  exit();
+  return 0;  // not reached
+}
+
+// exit() with a status for the parent's waitstatus().
+int
+sys_exits(void)
+{
+  int status;
+
+  if(argint(0, &status) < 0)
+    return -1;
+  proc->xstate = status;
   exit();
   return 0;  // not reached
 }
@@ -23,7 +38,19 @@ sys_exit(void)
 int
 sys_wait(void)
 {
-  return wait();
+  return wait(0);
+}
+
+// wait() that also returns the child's exit status: the
+// argument to exits(), 0 for exit(), -1 if it was killed.
+int
+sys_waitstatus(void)
+{
+  int *status;
+
+  if(argptr(0, (void*)&status, sizeof(*status)) < 0)
+    return -1;
+  return wait(status);
 }
 
 int
@@ -89,3 +116,33 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+// Route an I/O APIC interrupt line to a set of CPUs.
+// Returns the previous CPU mask.
+int
+sys_irqroute(void)
+{
+  int irq, mask;
+
+  if(argint(0, &irq) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return ioapicroute(irq, mask);
+}
+
+// Copy CPU n's interrupt counters to user space.
+// Returns -1 once n runs past the last CPU.
+int
+sys_intrstat(void)
+{
+  int n;
+  struct intrstat *st;
+
+  if(argint(0, &n) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  if(n < 0 || n >= ncpu)
+    return -1;
+  memmove(st->nirq, cpus[n].nirq, sizeof(st->nirq));
+  st->nsoftirq = cpus[n].nsoftirq;
+  st->maxcli = cpus[n].maxcli;
+  return 0;
+}
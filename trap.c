@@ -35,6 +35,54 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Deferred interrupt work.  A hardware interrupt handler does
+// only what the device needs right away and calls raisesoftirq()
+// for the rest; trap() runs the pending handlers with interrupts
+// enabled before returning, so a slow handler no longer delays
+// every other interrupt on the CPU.
+static void (*softirqs[NSOFTIRQ])(void);
+
+void
+setsoftirq(int n, void (*fn)(void))
+{
+  softirqs[n] = fn;
+}
+
+// Mark softirq n pending on this CPU.  Called with interrupts off.
+void
+raisesoftirq(int n)
+{
+  cpu->softirq |= 1 << n;
+}
+
+// Run pending softirqs.  Only when the interrupted code had
+// interrupts on (so it holds no spinlock) and is not itself a
+// softirq; handlers raised meanwhile are picked up by the loop.
+static void
+runsoftirq(struct trapframe *tf)
+{
+  uint pending;
+  int n;
+
+  if(!(tf->eflags & FL_IF) || cpu->insoftirq)
+    return;
+  cpu->insoftirq = 1;
+  while((pending = cpu->softirq) != 0){
+    cpu->softirq = 0;
+    cliend();
+    sti();
+    for(n = 0; n < NSOFTIRQ; n++){
+      if((pending & (1 << n)) && softirqs[n]){
+        softirqs[n]();
+        cpu->nsoftirq++;
+      }
+    }
+    cli();
+    clibegin();
+  }
+  cpu->insoftirq = 0;
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
@@ -51,6 +99,13 @@ trap(struct trapframe *tf)
     return;
   }
 
+  // The hardware turned interrupts off on the way in.
+  if(tf->eflags & FL_IF)
+    clibegin();
+
+  if(tf->trapno >= T_IRQ0 && tf->trapno < T_IRQ0 + NIRQ)
+    cpu->nirq[tf->trapno - T_IRQ0]++;
+
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
     if(cpu->id == 0){
@@ -58,6 +113,7 @@ trap(struct trapframe *tf)
       ticks++;
       wakeup(&ticks);
       release(&tickslock);
+      polltick();
     }
     lapiceoi();
     break;
@@ -76,6 +132,15 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_IPICALL:
+    ipicall();
+    lapiceoi();
+    break;
+  case T_IPIRESCHED:
+    // Nothing to do: the interrupt itself ends the idle
+    // scheduler's hlt.
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -99,6 +164,8 @@ trap(struct trapframe *tf)
     proc->killed = 1;
   }
 
+  runsoftirq(tf);
+
   // Force process exit if it has been killed and is in user space.
   // (If it is still executing in the kernel, let it keep running 
   // until it gets to the regular system call return.)
@@ -108,10 +175,17 @@ trap(struct trapframe *tf)
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
   // 実行しているプロセスのCPU利用時間がIRQ Timerで指定されていた時間で検知されたので、別のプロセスへとスイッチする。
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  // Not from inside a softirq, though: it would leave this CPU's
+  // insoftirq set while the process runs elsewhere.
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+     !cpu->insoftirq)
     yield();
 
   // Check if the process has been killed since we yielded
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
+
+  // trapret's iret turns interrupts back on.
+  if(tf->eflags & FL_IF)
+    cliend();
 }
@@ -25,6 +25,8 @@
 // These are arbitrarily chosen, but with care not to overlap
 // processor defined exceptions or interrupt vectors.
 #define T_SYSCALL       64      // system call
+#define T_IPICALL       65      // run queued smpcall()s
+#define T_IPIRESCHED    66      // wake an idle CPU's scheduler
 #define T_DEFAULT      500      // catchall
 
 #define T_IRQ0          32      // IRQ 0 corresponds to int T_IRQ
@@ -36,3 +38,9 @@
 #define IRQ_ERROR       19
 #define IRQ_SPURIOUS    31
 
+
+// Softirqs: deferred halves of interrupt handlers, run by trap()
+// with interrupts enabled.  See raisesoftirq().
+#define SOFTIRQ_IDE      0
+#define SOFTIRQ_CONSOLE  1
+#define NSOFTIRQ         2
@@ -1,7 +1,9 @@
 #include "types.h"
 #include "stat.h"
 #include "fcntl.h"
+#include "param.h"
 #include "user.h"
+#include "intr.h"
 #include "x86.h"
 
 char*
@@ -103,3 +105,16 @@ memmove(void *vdst, void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+    ;
+  return n > 0 ? n : 1;
+}
@@ -1,5 +1,9 @@
 struct stat;
 struct rtcdate;
+struct pollfd;
+struct intrstat;
+struct dirent;
+struct extents;
 
 // system calls
 int fork(void);
@@ -23,6 +27,23 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int poll(struct pollfd*, int, int);
+int fcntl(int, int, int);
+int irqroute(int, int);
+int intrstat(int, struct intrstat*);
+int pread(int, void*, int, int);
+int getdents(int, struct dirent*, int);
+int fstatat(int, char*, struct stat*);
+int openat(int, char*, int);
+int unlinkat(int, char*);
+int mkdirat(int, char*);
+int linkat(int, char*, int, char*);
+int exits(int) __attribute__((noreturn));
+int waitstatus(int*);
+int pwrite(int, void*, int, int);
+int lseek(int, int, int);
+int copyfilerange(int, int, int, int, int);
+int fsctl(int, int, void*);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -37,3 +58,4 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+int ncpus(void);
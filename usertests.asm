@@ -0,0 +1,10759 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "iput test\n");
+       6:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 c2 64 00 00       	push   $0x64c2
+      13:	50                   	push   %eax
+      14:	e8 da 60 00 00       	call   60f3 <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("iputdir") < 0){
+      1c:	83 ec 0c             	sub    $0xc,%esp
+      1f:	68 cd 64 00 00       	push   $0x64cd
+      24:	e8 36 5f 00 00       	call   5f5f <mkdir>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	85 c0                	test   %eax,%eax
+      2e:	79 1b                	jns    4b <iputtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+      30:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+      35:	83 ec 08             	sub    $0x8,%esp
+      38:	68 d5 64 00 00       	push   $0x64d5
+      3d:	50                   	push   %eax
+      3e:	e8 b0 60 00 00       	call   60f3 <printf>
+      43:	83 c4 10             	add    $0x10,%esp
+    exit();
+      46:	e8 ac 5e 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("iputdir") < 0){
+      4b:	83 ec 0c             	sub    $0xc,%esp
+      4e:	68 cd 64 00 00       	push   $0x64cd
+      53:	e8 0f 5f 00 00       	call   5f67 <chdir>
+      58:	83 c4 10             	add    $0x10,%esp
+      5b:	85 c0                	test   %eax,%eax
+      5d:	79 1b                	jns    7a <iputtest+0x7a>
+    printf(stdout, "chdir iputdir failed\n");
+      5f:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+      64:	83 ec 08             	sub    $0x8,%esp
+      67:	68 e3 64 00 00       	push   $0x64e3
+      6c:	50                   	push   %eax
+      6d:	e8 81 60 00 00       	call   60f3 <printf>
+      72:	83 c4 10             	add    $0x10,%esp
+    exit();
+      75:	e8 7d 5e 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("../iputdir") < 0){
+      7a:	83 ec 0c             	sub    $0xc,%esp
+      7d:	68 f9 64 00 00       	push   $0x64f9
+      82:	e8 c0 5e 00 00       	call   5f47 <unlink>
+      87:	83 c4 10             	add    $0x10,%esp
+      8a:	85 c0                	test   %eax,%eax
+      8c:	79 1b                	jns    a9 <iputtest+0xa9>
+    printf(stdout, "unlink ../iputdir failed\n");
+      8e:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+      93:	83 ec 08             	sub    $0x8,%esp
+      96:	68 04 65 00 00       	push   $0x6504
+      9b:	50                   	push   %eax
+      9c:	e8 52 60 00 00       	call   60f3 <printf>
+      a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a4:	e8 4e 5e 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("/") < 0){
+      a9:	83 ec 0c             	sub    $0xc,%esp
+      ac:	68 1e 65 00 00       	push   $0x651e
+      b1:	e8 b1 5e 00 00       	call   5f67 <chdir>
+      b6:	83 c4 10             	add    $0x10,%esp
+      b9:	85 c0                	test   %eax,%eax
+      bb:	79 1b                	jns    d8 <iputtest+0xd8>
+    printf(stdout, "chdir / failed\n");
+      bd:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	68 20 65 00 00       	push   $0x6520
+      ca:	50                   	push   %eax
+      cb:	e8 23 60 00 00       	call   60f3 <printf>
+      d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+      d3:	e8 1f 5e 00 00       	call   5ef7 <exit>
+  }
+  printf(stdout, "iput test ok\n");
+      d8:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+      dd:	83 ec 08             	sub    $0x8,%esp
+      e0:	68 30 65 00 00       	push   $0x6530
+      e5:	50                   	push   %eax
+      e6:	e8 08 60 00 00       	call   60f3 <printf>
+      eb:	83 c4 10             	add    $0x10,%esp
+}
+      ee:	90                   	nop
+      ef:	c9                   	leave
+      f0:	c3                   	ret
+
+000000f1 <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      f1:	55                   	push   %ebp
+      f2:	89 e5                	mov    %esp,%ebp
+      f4:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      f7:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+      fc:	83 ec 08             	sub    $0x8,%esp
+      ff:	68 3e 65 00 00       	push   $0x653e
+     104:	50                   	push   %eax
+     105:	e8 e9 5f 00 00       	call   60f3 <printf>
+     10a:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+     10d:	e8 dd 5d 00 00       	call   5eef <fork>
+     112:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     115:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     119:	79 1b                	jns    136 <exitiputtest+0x45>
+    printf(stdout, "fork failed\n");
+     11b:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 4d 65 00 00       	push   $0x654d
+     128:	50                   	push   %eax
+     129:	e8 c5 5f 00 00       	call   60f3 <printf>
+     12e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     131:	e8 c1 5d 00 00       	call   5ef7 <exit>
+  }
+  if(pid == 0){
+     136:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     13a:	0f 85 92 00 00 00    	jne    1d2 <exitiputtest+0xe1>
+    if(mkdir("iputdir") < 0){
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 cd 64 00 00       	push   $0x64cd
+     148:	e8 12 5e 00 00       	call   5f5f <mkdir>
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 c0                	test   %eax,%eax
+     152:	79 1b                	jns    16f <exitiputtest+0x7e>
+      printf(stdout, "mkdir failed\n");
+     154:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     159:	83 ec 08             	sub    $0x8,%esp
+     15c:	68 d5 64 00 00       	push   $0x64d5
+     161:	50                   	push   %eax
+     162:	e8 8c 5f 00 00       	call   60f3 <printf>
+     167:	83 c4 10             	add    $0x10,%esp
+      exit();
+     16a:	e8 88 5d 00 00       	call   5ef7 <exit>
+    }
+    if(chdir("iputdir") < 0){
+     16f:	83 ec 0c             	sub    $0xc,%esp
+     172:	68 cd 64 00 00       	push   $0x64cd
+     177:	e8 eb 5d 00 00       	call   5f67 <chdir>
+     17c:	83 c4 10             	add    $0x10,%esp
+     17f:	85 c0                	test   %eax,%eax
+     181:	79 1b                	jns    19e <exitiputtest+0xad>
+      printf(stdout, "child chdir failed\n");
+     183:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     188:	83 ec 08             	sub    $0x8,%esp
+     18b:	68 5a 65 00 00       	push   $0x655a
+     190:	50                   	push   %eax
+     191:	e8 5d 5f 00 00       	call   60f3 <printf>
+     196:	83 c4 10             	add    $0x10,%esp
+      exit();
+     199:	e8 59 5d 00 00       	call   5ef7 <exit>
+    }
+    if(unlink("../iputdir") < 0){
+     19e:	83 ec 0c             	sub    $0xc,%esp
+     1a1:	68 f9 64 00 00       	push   $0x64f9
+     1a6:	e8 9c 5d 00 00       	call   5f47 <unlink>
+     1ab:	83 c4 10             	add    $0x10,%esp
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	79 1b                	jns    1cd <exitiputtest+0xdc>
+      printf(stdout, "unlink ../iputdir failed\n");
+     1b2:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     1b7:	83 ec 08             	sub    $0x8,%esp
+     1ba:	68 04 65 00 00       	push   $0x6504
+     1bf:	50                   	push   %eax
+     1c0:	e8 2e 5f 00 00       	call   60f3 <printf>
+     1c5:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1c8:	e8 2a 5d 00 00       	call   5ef7 <exit>
+    }
+    exit();
+     1cd:	e8 25 5d 00 00       	call   5ef7 <exit>
+  }
+  wait();
+     1d2:	e8 28 5d 00 00       	call   5eff <wait>
+  printf(stdout, "exitiput test ok\n");
+     1d7:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     1dc:	83 ec 08             	sub    $0x8,%esp
+     1df:	68 6e 65 00 00       	push   $0x656e
+     1e4:	50                   	push   %eax
+     1e5:	e8 09 5f 00 00       	call   60f3 <printf>
+     1ea:	83 c4 10             	add    $0x10,%esp
+}
+     1ed:	90                   	nop
+     1ee:	c9                   	leave
+     1ef:	c3                   	ret
+
+000001f0 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1f6:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     1fb:	83 ec 08             	sub    $0x8,%esp
+     1fe:	68 80 65 00 00       	push   $0x6580
+     203:	50                   	push   %eax
+     204:	e8 ea 5e 00 00       	call   60f3 <printf>
+     209:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("oidir") < 0){
+     20c:	83 ec 0c             	sub    $0xc,%esp
+     20f:	68 8f 65 00 00       	push   $0x658f
+     214:	e8 46 5d 00 00       	call   5f5f <mkdir>
+     219:	83 c4 10             	add    $0x10,%esp
+     21c:	85 c0                	test   %eax,%eax
+     21e:	79 1b                	jns    23b <openiputtest+0x4b>
+    printf(stdout, "mkdir oidir failed\n");
+     220:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 95 65 00 00       	push   $0x6595
+     22d:	50                   	push   %eax
+     22e:	e8 c0 5e 00 00       	call   60f3 <printf>
+     233:	83 c4 10             	add    $0x10,%esp
+    exit();
+     236:	e8 bc 5c 00 00       	call   5ef7 <exit>
+  }
+  pid = fork();
+     23b:	e8 af 5c 00 00       	call   5eef <fork>
+     240:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     243:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     247:	79 1b                	jns    264 <openiputtest+0x74>
+    printf(stdout, "fork failed\n");
+     249:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     24e:	83 ec 08             	sub    $0x8,%esp
+     251:	68 4d 65 00 00       	push   $0x654d
+     256:	50                   	push   %eax
+     257:	e8 97 5e 00 00       	call   60f3 <printf>
+     25c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     25f:	e8 93 5c 00 00       	call   5ef7 <exit>
+  }
+  if(pid == 0){
+     264:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     268:	75 3b                	jne    2a5 <openiputtest+0xb5>
+    int fd = open("oidir", O_RDWR);
+     26a:	83 ec 08             	sub    $0x8,%esp
+     26d:	6a 02                	push   $0x2
+     26f:	68 8f 65 00 00       	push   $0x658f
+     274:	e8 be 5c 00 00       	call   5f37 <open>
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     27f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     283:	78 1b                	js     2a0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     285:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     28a:	83 ec 08             	sub    $0x8,%esp
+     28d:	68 ac 65 00 00       	push   $0x65ac
+     292:	50                   	push   %eax
+     293:	e8 5b 5e 00 00       	call   60f3 <printf>
+     298:	83 c4 10             	add    $0x10,%esp
+      exit();
+     29b:	e8 57 5c 00 00       	call   5ef7 <exit>
+    }
+    exit();
+     2a0:	e8 52 5c 00 00       	call   5ef7 <exit>
+  }
+  sleep(1);
+     2a5:	83 ec 0c             	sub    $0xc,%esp
+     2a8:	6a 01                	push   $0x1
+     2aa:	e8 d8 5c 00 00       	call   5f87 <sleep>
+     2af:	83 c4 10             	add    $0x10,%esp
+  if(unlink("oidir") != 0){
+     2b2:	83 ec 0c             	sub    $0xc,%esp
+     2b5:	68 8f 65 00 00       	push   $0x658f
+     2ba:	e8 88 5c 00 00       	call   5f47 <unlink>
+     2bf:	83 c4 10             	add    $0x10,%esp
+     2c2:	85 c0                	test   %eax,%eax
+     2c4:	74 1b                	je     2e1 <openiputtest+0xf1>
+    printf(stdout, "unlink failed\n");
+     2c6:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     2cb:	83 ec 08             	sub    $0x8,%esp
+     2ce:	68 d0 65 00 00       	push   $0x65d0
+     2d3:	50                   	push   %eax
+     2d4:	e8 1a 5e 00 00       	call   60f3 <printf>
+     2d9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2dc:	e8 16 5c 00 00       	call   5ef7 <exit>
+  }
+  wait();
+     2e1:	e8 19 5c 00 00       	call   5eff <wait>
+  printf(stdout, "openiput test ok\n");
+     2e6:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     2eb:	83 ec 08             	sub    $0x8,%esp
+     2ee:	68 df 65 00 00       	push   $0x65df
+     2f3:	50                   	push   %eax
+     2f4:	e8 fa 5d 00 00       	call   60f3 <printf>
+     2f9:	83 c4 10             	add    $0x10,%esp
+}
+     2fc:	90                   	nop
+     2fd:	c9                   	leave
+     2fe:	c3                   	ret
+
+000002ff <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ff:	55                   	push   %ebp
+     300:	89 e5                	mov    %esp,%ebp
+     302:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     305:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     30a:	83 ec 08             	sub    $0x8,%esp
+     30d:	68 f1 65 00 00       	push   $0x65f1
+     312:	50                   	push   %eax
+     313:	e8 db 5d 00 00       	call   60f3 <printf>
+     318:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+     31b:	83 ec 08             	sub    $0x8,%esp
+     31e:	6a 00                	push   $0x0
+     320:	68 ac 64 00 00       	push   $0x64ac
+     325:	e8 0d 5c 00 00       	call   5f37 <open>
+     32a:	83 c4 10             	add    $0x10,%esp
+     32d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+     330:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     334:	79 1b                	jns    351 <opentest+0x52>
+    printf(stdout, "open echo failed!\n");
+     336:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     33b:	83 ec 08             	sub    $0x8,%esp
+     33e:	68 fc 65 00 00       	push   $0x65fc
+     343:	50                   	push   %eax
+     344:	e8 aa 5d 00 00       	call   60f3 <printf>
+     349:	83 c4 10             	add    $0x10,%esp
+    exit();
+     34c:	e8 a6 5b 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+     351:	83 ec 0c             	sub    $0xc,%esp
+     354:	ff 75 f4             	push   -0xc(%ebp)
+     357:	e8 c3 5b 00 00       	call   5f1f <close>
+     35c:	83 c4 10             	add    $0x10,%esp
+  fd = open("doesnotexist", 0);
+     35f:	83 ec 08             	sub    $0x8,%esp
+     362:	6a 00                	push   $0x0
+     364:	68 0f 66 00 00       	push   $0x660f
+     369:	e8 c9 5b 00 00       	call   5f37 <open>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+     374:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     378:	78 1b                	js     395 <opentest+0x96>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     37a:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     37f:	83 ec 08             	sub    $0x8,%esp
+     382:	68 1c 66 00 00       	push   $0x661c
+     387:	50                   	push   %eax
+     388:	e8 66 5d 00 00       	call   60f3 <printf>
+     38d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     390:	e8 62 5b 00 00       	call   5ef7 <exit>
+  }
+  printf(stdout, "open test ok\n");
+     395:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     39a:	83 ec 08             	sub    $0x8,%esp
+     39d:	68 3a 66 00 00       	push   $0x663a
+     3a2:	50                   	push   %eax
+     3a3:	e8 4b 5d 00 00       	call   60f3 <printf>
+     3a8:	83 c4 10             	add    $0x10,%esp
+}
+     3ab:	90                   	nop
+     3ac:	c9                   	leave
+     3ad:	c3                   	ret
+
+000003ae <writetest>:
+
+void
+writetest(void)
+{
+     3ae:	55                   	push   %ebp
+     3af:	89 e5                	mov    %esp,%ebp
+     3b1:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     3b4:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     3b9:	83 ec 08             	sub    $0x8,%esp
+     3bc:	68 48 66 00 00       	push   $0x6648
+     3c1:	50                   	push   %eax
+     3c2:	e8 2c 5d 00 00       	call   60f3 <printf>
+     3c7:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_CREATE|O_RDWR);
+     3ca:	83 ec 08             	sub    $0x8,%esp
+     3cd:	68 02 02 00 00       	push   $0x202
+     3d2:	68 59 66 00 00       	push   $0x6659
+     3d7:	e8 5b 5b 00 00       	call   5f37 <open>
+     3dc:	83 c4 10             	add    $0x10,%esp
+     3df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     3e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3e6:	78 22                	js     40a <writetest+0x5c>
+    printf(stdout, "creat small succeeded; ok\n");
+     3e8:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     3ed:	83 ec 08             	sub    $0x8,%esp
+     3f0:	68 5f 66 00 00       	push   $0x665f
+     3f5:	50                   	push   %eax
+     3f6:	e8 f8 5c 00 00       	call   60f3 <printf>
+     3fb:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     3fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     405:	e9 8f 00 00 00       	jmp    499 <writetest+0xeb>
+    printf(stdout, "error: creat small failed!\n");
+     40a:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     40f:	83 ec 08             	sub    $0x8,%esp
+     412:	68 7a 66 00 00       	push   $0x667a
+     417:	50                   	push   %eax
+     418:	e8 d6 5c 00 00       	call   60f3 <printf>
+     41d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     420:	e8 d2 5a 00 00       	call   5ef7 <exit>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     425:	83 ec 04             	sub    $0x4,%esp
+     428:	6a 0a                	push   $0xa
+     42a:	68 96 66 00 00       	push   $0x6696
+     42f:	ff 75 f0             	push   -0x10(%ebp)
+     432:	e8 e0 5a 00 00       	call   5f17 <write>
+     437:	83 c4 10             	add    $0x10,%esp
+     43a:	83 f8 0a             	cmp    $0xa,%eax
+     43d:	74 1e                	je     45d <writetest+0xaf>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     43f:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     444:	83 ec 04             	sub    $0x4,%esp
+     447:	ff 75 f4             	push   -0xc(%ebp)
+     44a:	68 a4 66 00 00       	push   $0x66a4
+     44f:	50                   	push   %eax
+     450:	e8 9e 5c 00 00       	call   60f3 <printf>
+     455:	83 c4 10             	add    $0x10,%esp
+      exit();
+     458:	e8 9a 5a 00 00       	call   5ef7 <exit>
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     45d:	83 ec 04             	sub    $0x4,%esp
+     460:	6a 0a                	push   $0xa
+     462:	68 c8 66 00 00       	push   $0x66c8
+     467:	ff 75 f0             	push   -0x10(%ebp)
+     46a:	e8 a8 5a 00 00       	call   5f17 <write>
+     46f:	83 c4 10             	add    $0x10,%esp
+     472:	83 f8 0a             	cmp    $0xa,%eax
+     475:	74 1e                	je     495 <writetest+0xe7>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     477:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     47c:	83 ec 04             	sub    $0x4,%esp
+     47f:	ff 75 f4             	push   -0xc(%ebp)
+     482:	68 d4 66 00 00       	push   $0x66d4
+     487:	50                   	push   %eax
+     488:	e8 66 5c 00 00       	call   60f3 <printf>
+     48d:	83 c4 10             	add    $0x10,%esp
+      exit();
+     490:	e8 62 5a 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 100; i++){
+     495:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     499:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     49d:	7e 86                	jle    425 <writetest+0x77>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     49f:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     4a4:	83 ec 08             	sub    $0x8,%esp
+     4a7:	68 f8 66 00 00       	push   $0x66f8
+     4ac:	50                   	push   %eax
+     4ad:	e8 41 5c 00 00       	call   60f3 <printf>
+     4b2:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     4b5:	83 ec 0c             	sub    $0xc,%esp
+     4b8:	ff 75 f0             	push   -0x10(%ebp)
+     4bb:	e8 5f 5a 00 00       	call   5f1f <close>
+     4c0:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     4c3:	83 ec 08             	sub    $0x8,%esp
+     4c6:	6a 00                	push   $0x0
+     4c8:	68 59 66 00 00       	push   $0x6659
+     4cd:	e8 65 5a 00 00       	call   5f37 <open>
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     4d8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4dc:	78 3c                	js     51a <writetest+0x16c>
+    printf(stdout, "open small succeeded ok\n");
+     4de:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     4e3:	83 ec 08             	sub    $0x8,%esp
+     4e6:	68 03 67 00 00       	push   $0x6703
+     4eb:	50                   	push   %eax
+     4ec:	e8 02 5c 00 00       	call   60f3 <printf>
+     4f1:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     4f4:	83 ec 04             	sub    $0x4,%esp
+     4f7:	68 d0 07 00 00       	push   $0x7d0
+     4fc:	68 e0 8e 00 00       	push   $0x8ee0
+     501:	ff 75 f0             	push   -0x10(%ebp)
+     504:	e8 06 5a 00 00       	call   5f0f <read>
+     509:	83 c4 10             	add    $0x10,%esp
+     50c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(i == 2000){
+     50f:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     516:	75 57                	jne    56f <writetest+0x1c1>
+     518:	eb 1b                	jmp    535 <writetest+0x187>
+    printf(stdout, "error: open small failed!\n");
+     51a:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     51f:	83 ec 08             	sub    $0x8,%esp
+     522:	68 1c 67 00 00       	push   $0x671c
+     527:	50                   	push   %eax
+     528:	e8 c6 5b 00 00       	call   60f3 <printf>
+     52d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     530:	e8 c2 59 00 00       	call   5ef7 <exit>
+    printf(stdout, "read succeeded ok\n");
+     535:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     53a:	83 ec 08             	sub    $0x8,%esp
+     53d:	68 37 67 00 00       	push   $0x6737
+     542:	50                   	push   %eax
+     543:	e8 ab 5b 00 00       	call   60f3 <printf>
+     548:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     54b:	83 ec 0c             	sub    $0xc,%esp
+     54e:	ff 75 f0             	push   -0x10(%ebp)
+     551:	e8 c9 59 00 00       	call   5f1f <close>
+     556:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("small") < 0){
+     559:	83 ec 0c             	sub    $0xc,%esp
+     55c:	68 59 66 00 00       	push   $0x6659
+     561:	e8 e1 59 00 00       	call   5f47 <unlink>
+     566:	83 c4 10             	add    $0x10,%esp
+     569:	85 c0                	test   %eax,%eax
+     56b:	79 38                	jns    5a5 <writetest+0x1f7>
+     56d:	eb 1b                	jmp    58a <writetest+0x1dc>
+    printf(stdout, "read failed\n");
+     56f:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     574:	83 ec 08             	sub    $0x8,%esp
+     577:	68 4a 67 00 00       	push   $0x674a
+     57c:	50                   	push   %eax
+     57d:	e8 71 5b 00 00       	call   60f3 <printf>
+     582:	83 c4 10             	add    $0x10,%esp
+    exit();
+     585:	e8 6d 59 00 00       	call   5ef7 <exit>
+    printf(stdout, "unlink small failed\n");
+     58a:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     58f:	83 ec 08             	sub    $0x8,%esp
+     592:	68 57 67 00 00       	push   $0x6757
+     597:	50                   	push   %eax
+     598:	e8 56 5b 00 00       	call   60f3 <printf>
+     59d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5a0:	e8 52 59 00 00       	call   5ef7 <exit>
+  }
+  printf(stdout, "small file test ok\n");
+     5a5:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     5aa:	83 ec 08             	sub    $0x8,%esp
+     5ad:	68 6c 67 00 00       	push   $0x676c
+     5b2:	50                   	push   %eax
+     5b3:	e8 3b 5b 00 00       	call   60f3 <printf>
+     5b8:	83 c4 10             	add    $0x10,%esp
+}
+     5bb:	90                   	nop
+     5bc:	c9                   	leave
+     5bd:	c3                   	ret
+
+000005be <writetest1>:
+
+void
+writetest1(void)
+{
+     5be:	55                   	push   %ebp
+     5bf:	89 e5                	mov    %esp,%ebp
+     5c1:	83 ec 18             	sub    $0x18,%esp
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     5c4:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     5c9:	83 ec 08             	sub    $0x8,%esp
+     5cc:	68 80 67 00 00       	push   $0x6780
+     5d1:	50                   	push   %eax
+     5d2:	e8 1c 5b 00 00       	call   60f3 <printf>
+     5d7:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_CREATE|O_RDWR);
+     5da:	83 ec 08             	sub    $0x8,%esp
+     5dd:	68 02 02 00 00       	push   $0x202
+     5e2:	68 90 67 00 00       	push   $0x6790
+     5e7:	e8 4b 59 00 00       	call   5f37 <open>
+     5ec:	83 c4 10             	add    $0x10,%esp
+     5ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     5f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     5f6:	79 1b                	jns    613 <writetest1+0x55>
+    printf(stdout, "error: creat big failed!\n");
+     5f8:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     5fd:	83 ec 08             	sub    $0x8,%esp
+     600:	68 94 67 00 00       	push   $0x6794
+     605:	50                   	push   %eax
+     606:	e8 e8 5a 00 00       	call   60f3 <printf>
+     60b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     60e:	e8 e4 58 00 00       	call   5ef7 <exit>
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     613:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     61a:	eb 4b                	jmp    667 <writetest1+0xa9>
+    ((int*)buf)[0] = i;
+     61c:	ba e0 8e 00 00       	mov    $0x8ee0,%edx
+     621:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     624:	89 02                	mov    %eax,(%edx)
+    if(write(fd, buf, 512) != 512){
+     626:	83 ec 04             	sub    $0x4,%esp
+     629:	68 00 02 00 00       	push   $0x200
+     62e:	68 e0 8e 00 00       	push   $0x8ee0
+     633:	ff 75 ec             	push   -0x14(%ebp)
+     636:	e8 dc 58 00 00       	call   5f17 <write>
+     63b:	83 c4 10             	add    $0x10,%esp
+     63e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     643:	74 1e                	je     663 <writetest1+0xa5>
+      printf(stdout, "error: write big file failed\n", i);
+     645:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     64a:	83 ec 04             	sub    $0x4,%esp
+     64d:	ff 75 f4             	push   -0xc(%ebp)
+     650:	68 ae 67 00 00       	push   $0x67ae
+     655:	50                   	push   %eax
+     656:	e8 98 5a 00 00       	call   60f3 <printf>
+     65b:	83 c4 10             	add    $0x10,%esp
+      exit();
+     65e:	e8 94 58 00 00       	call   5ef7 <exit>
+  for(i = 0; i < MAXFILE; i++){
+     663:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     66a:	3d 8b 00 00 00       	cmp    $0x8b,%eax
+     66f:	76 ab                	jbe    61c <writetest1+0x5e>
+    }
+  }
+
+  close(fd);
+     671:	83 ec 0c             	sub    $0xc,%esp
+     674:	ff 75 ec             	push   -0x14(%ebp)
+     677:	e8 a3 58 00 00       	call   5f1f <close>
+     67c:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_RDONLY);
+     67f:	83 ec 08             	sub    $0x8,%esp
+     682:	6a 00                	push   $0x0
+     684:	68 90 67 00 00       	push   $0x6790
+     689:	e8 a9 58 00 00       	call   5f37 <open>
+     68e:	83 c4 10             	add    $0x10,%esp
+     691:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     694:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     698:	79 1b                	jns    6b5 <writetest1+0xf7>
+    printf(stdout, "error: open big failed!\n");
+     69a:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     69f:	83 ec 08             	sub    $0x8,%esp
+     6a2:	68 cc 67 00 00       	push   $0x67cc
+     6a7:	50                   	push   %eax
+     6a8:	e8 46 5a 00 00       	call   60f3 <printf>
+     6ad:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6b0:	e8 42 58 00 00       	call   5ef7 <exit>
+  }
+
+  n = 0;
+     6b5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(;;){
+    i = read(fd, buf, 512);
+     6bc:	83 ec 04             	sub    $0x4,%esp
+     6bf:	68 00 02 00 00       	push   $0x200
+     6c4:	68 e0 8e 00 00       	push   $0x8ee0
+     6c9:	ff 75 ec             	push   -0x14(%ebp)
+     6cc:	e8 3e 58 00 00       	call   5f0f <read>
+     6d1:	83 c4 10             	add    $0x10,%esp
+     6d4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(i == 0){
+     6d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     6db:	75 27                	jne    704 <writetest1+0x146>
+      if(n == MAXFILE - 1){
+     6dd:	81 7d f0 8b 00 00 00 	cmpl   $0x8b,-0x10(%ebp)
+     6e4:	75 7d                	jne    763 <writetest1+0x1a5>
+        printf(stdout, "read only %d blocks from big", n);
+     6e6:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     6eb:	83 ec 04             	sub    $0x4,%esp
+     6ee:	ff 75 f0             	push   -0x10(%ebp)
+     6f1:	68 e5 67 00 00       	push   $0x67e5
+     6f6:	50                   	push   %eax
+     6f7:	e8 f7 59 00 00       	call   60f3 <printf>
+     6fc:	83 c4 10             	add    $0x10,%esp
+        exit();
+     6ff:	e8 f3 57 00 00       	call   5ef7 <exit>
+      }
+      break;
+    } else if(i != 512){
+     704:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     70b:	74 1e                	je     72b <writetest1+0x16d>
+      printf(stdout, "read failed %d\n", i);
+     70d:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     712:	83 ec 04             	sub    $0x4,%esp
+     715:	ff 75 f4             	push   -0xc(%ebp)
+     718:	68 02 68 00 00       	push   $0x6802
+     71d:	50                   	push   %eax
+     71e:	e8 d0 59 00 00       	call   60f3 <printf>
+     723:	83 c4 10             	add    $0x10,%esp
+      exit();
+     726:	e8 cc 57 00 00       	call   5ef7 <exit>
+    }
+    if(((int*)buf)[0] != n){
+     72b:	b8 e0 8e 00 00       	mov    $0x8ee0,%eax
+     730:	8b 00                	mov    (%eax),%eax
+     732:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     735:	74 23                	je     75a <writetest1+0x19c>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+     737:	b8 e0 8e 00 00       	mov    $0x8ee0,%eax
+      printf(stdout, "read content of block %d is %d\n",
+     73c:	8b 10                	mov    (%eax),%edx
+     73e:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     743:	52                   	push   %edx
+     744:	ff 75 f0             	push   -0x10(%ebp)
+     747:	68 14 68 00 00       	push   $0x6814
+     74c:	50                   	push   %eax
+     74d:	e8 a1 59 00 00       	call   60f3 <printf>
+     752:	83 c4 10             	add    $0x10,%esp
+      exit();
+     755:	e8 9d 57 00 00       	call   5ef7 <exit>
+    }
+    n++;
+     75a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    i = read(fd, buf, 512);
+     75e:	e9 59 ff ff ff       	jmp    6bc <writetest1+0xfe>
+      break;
+     763:	90                   	nop
+  }
+  close(fd);
+     764:	83 ec 0c             	sub    $0xc,%esp
+     767:	ff 75 ec             	push   -0x14(%ebp)
+     76a:	e8 b0 57 00 00       	call   5f1f <close>
+     76f:	83 c4 10             	add    $0x10,%esp
+  if(unlink("big") < 0){
+     772:	83 ec 0c             	sub    $0xc,%esp
+     775:	68 90 67 00 00       	push   $0x6790
+     77a:	e8 c8 57 00 00       	call   5f47 <unlink>
+     77f:	83 c4 10             	add    $0x10,%esp
+     782:	85 c0                	test   %eax,%eax
+     784:	79 1b                	jns    7a1 <writetest1+0x1e3>
+    printf(stdout, "unlink big failed\n");
+     786:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     78b:	83 ec 08             	sub    $0x8,%esp
+     78e:	68 34 68 00 00       	push   $0x6834
+     793:	50                   	push   %eax
+     794:	e8 5a 59 00 00       	call   60f3 <printf>
+     799:	83 c4 10             	add    $0x10,%esp
+    exit();
+     79c:	e8 56 57 00 00       	call   5ef7 <exit>
+  }
+  printf(stdout, "big files ok\n");
+     7a1:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     7a6:	83 ec 08             	sub    $0x8,%esp
+     7a9:	68 47 68 00 00       	push   $0x6847
+     7ae:	50                   	push   %eax
+     7af:	e8 3f 59 00 00       	call   60f3 <printf>
+     7b4:	83 c4 10             	add    $0x10,%esp
+}
+     7b7:	90                   	nop
+     7b8:	c9                   	leave
+     7b9:	c3                   	ret
+
+000007ba <createtest>:
+
+void
+createtest(void)
+{
+     7ba:	55                   	push   %ebp
+     7bb:	89 e5                	mov    %esp,%ebp
+     7bd:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     7c0:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     7c5:	83 ec 08             	sub    $0x8,%esp
+     7c8:	68 58 68 00 00       	push   $0x6858
+     7cd:	50                   	push   %eax
+     7ce:	e8 20 59 00 00       	call   60f3 <printf>
+     7d3:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'a';
+     7d6:	c6 05 e0 ae 00 00 61 	movb   $0x61,0xaee0
+  name[2] = '\0';
+     7dd:	c6 05 e2 ae 00 00 00 	movb   $0x0,0xaee2
+  for(i = 0; i < 52; i++){
+     7e4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     7eb:	eb 35                	jmp    822 <createtest+0x68>
+    name[1] = '0' + i;
+     7ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f0:	83 c0 30             	add    $0x30,%eax
+     7f3:	a2 e1 ae 00 00       	mov    %al,0xaee1
+    fd = open(name, O_CREATE|O_RDWR);
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	68 02 02 00 00       	push   $0x202
+     800:	68 e0 ae 00 00       	push   $0xaee0
+     805:	e8 2d 57 00 00       	call   5f37 <open>
+     80a:	83 c4 10             	add    $0x10,%esp
+     80d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     810:	83 ec 0c             	sub    $0xc,%esp
+     813:	ff 75 f0             	push   -0x10(%ebp)
+     816:	e8 04 57 00 00       	call   5f1f <close>
+     81b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     81e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     822:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     826:	7e c5                	jle    7ed <createtest+0x33>
+  }
+  name[0] = 'a';
+     828:	c6 05 e0 ae 00 00 61 	movb   $0x61,0xaee0
+  name[2] = '\0';
+     82f:	c6 05 e2 ae 00 00 00 	movb   $0x0,0xaee2
+  for(i = 0; i < 52; i++){
+     836:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     83d:	eb 1f                	jmp    85e <createtest+0xa4>
+    name[1] = '0' + i;
+     83f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     842:	83 c0 30             	add    $0x30,%eax
+     845:	a2 e1 ae 00 00       	mov    %al,0xaee1
+    unlink(name);
+     84a:	83 ec 0c             	sub    $0xc,%esp
+     84d:	68 e0 ae 00 00       	push   $0xaee0
+     852:	e8 f0 56 00 00       	call   5f47 <unlink>
+     857:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     85a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     85e:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     862:	7e db                	jle    83f <createtest+0x85>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     864:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     869:	83 ec 08             	sub    $0x8,%esp
+     86c:	68 80 68 00 00       	push   $0x6880
+     871:	50                   	push   %eax
+     872:	e8 7c 58 00 00       	call   60f3 <printf>
+     877:	83 c4 10             	add    $0x10,%esp
+}
+     87a:	90                   	nop
+     87b:	c9                   	leave
+     87c:	c3                   	ret
+
+0000087d <dirtest>:
+
+void dirtest(void)
+{
+     87d:	55                   	push   %ebp
+     87e:	89 e5                	mov    %esp,%ebp
+     880:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "mkdir test\n");
+     883:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     888:	83 ec 08             	sub    $0x8,%esp
+     88b:	68 a6 68 00 00       	push   $0x68a6
+     890:	50                   	push   %eax
+     891:	e8 5d 58 00 00       	call   60f3 <printf>
+     896:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("dir0") < 0){
+     899:	83 ec 0c             	sub    $0xc,%esp
+     89c:	68 b2 68 00 00       	push   $0x68b2
+     8a1:	e8 b9 56 00 00       	call   5f5f <mkdir>
+     8a6:	83 c4 10             	add    $0x10,%esp
+     8a9:	85 c0                	test   %eax,%eax
+     8ab:	79 1b                	jns    8c8 <dirtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+     8ad:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     8b2:	83 ec 08             	sub    $0x8,%esp
+     8b5:	68 d5 64 00 00       	push   $0x64d5
+     8ba:	50                   	push   %eax
+     8bb:	e8 33 58 00 00       	call   60f3 <printf>
+     8c0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8c3:	e8 2f 56 00 00       	call   5ef7 <exit>
+  }
+
+  if(chdir("dir0") < 0){
+     8c8:	83 ec 0c             	sub    $0xc,%esp
+     8cb:	68 b2 68 00 00       	push   $0x68b2
+     8d0:	e8 92 56 00 00       	call   5f67 <chdir>
+     8d5:	83 c4 10             	add    $0x10,%esp
+     8d8:	85 c0                	test   %eax,%eax
+     8da:	79 1b                	jns    8f7 <dirtest+0x7a>
+    printf(stdout, "chdir dir0 failed\n");
+     8dc:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     8e1:	83 ec 08             	sub    $0x8,%esp
+     8e4:	68 b7 68 00 00       	push   $0x68b7
+     8e9:	50                   	push   %eax
+     8ea:	e8 04 58 00 00       	call   60f3 <printf>
+     8ef:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8f2:	e8 00 56 00 00       	call   5ef7 <exit>
+  }
+
+  if(chdir("..") < 0){
+     8f7:	83 ec 0c             	sub    $0xc,%esp
+     8fa:	68 ca 68 00 00       	push   $0x68ca
+     8ff:	e8 63 56 00 00       	call   5f67 <chdir>
+     904:	83 c4 10             	add    $0x10,%esp
+     907:	85 c0                	test   %eax,%eax
+     909:	79 1b                	jns    926 <dirtest+0xa9>
+    printf(stdout, "chdir .. failed\n");
+     90b:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     910:	83 ec 08             	sub    $0x8,%esp
+     913:	68 cd 68 00 00       	push   $0x68cd
+     918:	50                   	push   %eax
+     919:	e8 d5 57 00 00       	call   60f3 <printf>
+     91e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     921:	e8 d1 55 00 00       	call   5ef7 <exit>
+  }
+
+  if(unlink("dir0") < 0){
+     926:	83 ec 0c             	sub    $0xc,%esp
+     929:	68 b2 68 00 00       	push   $0x68b2
+     92e:	e8 14 56 00 00       	call   5f47 <unlink>
+     933:	83 c4 10             	add    $0x10,%esp
+     936:	85 c0                	test   %eax,%eax
+     938:	79 1b                	jns    955 <dirtest+0xd8>
+    printf(stdout, "unlink dir0 failed\n");
+     93a:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     93f:	83 ec 08             	sub    $0x8,%esp
+     942:	68 de 68 00 00       	push   $0x68de
+     947:	50                   	push   %eax
+     948:	e8 a6 57 00 00       	call   60f3 <printf>
+     94d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     950:	e8 a2 55 00 00       	call   5ef7 <exit>
+  }
+  printf(stdout, "mkdir test ok\n");
+     955:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     95a:	83 ec 08             	sub    $0x8,%esp
+     95d:	68 f2 68 00 00       	push   $0x68f2
+     962:	50                   	push   %eax
+     963:	e8 8b 57 00 00       	call   60f3 <printf>
+     968:	83 c4 10             	add    $0x10,%esp
+}
+     96b:	90                   	nop
+     96c:	c9                   	leave
+     96d:	c3                   	ret
+
+0000096e <exectest>:
+
+void
+exectest(void)
+{
+     96e:	55                   	push   %ebp
+     96f:	89 e5                	mov    %esp,%ebp
+     971:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "exec test\n");
+     974:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     979:	83 ec 08             	sub    $0x8,%esp
+     97c:	68 01 69 00 00       	push   $0x6901
+     981:	50                   	push   %eax
+     982:	e8 6c 57 00 00       	call   60f3 <printf>
+     987:	83 c4 10             	add    $0x10,%esp
+  if(exec("echo", echoargv) < 0){
+     98a:	83 ec 08             	sub    $0x8,%esp
+     98d:	68 ac 8e 00 00       	push   $0x8eac
+     992:	68 ac 64 00 00       	push   $0x64ac
+     997:	e8 93 55 00 00       	call   5f2f <exec>
+     99c:	83 c4 10             	add    $0x10,%esp
+     99f:	85 c0                	test   %eax,%eax
+     9a1:	79 1b                	jns    9be <exectest+0x50>
+    printf(stdout, "exec echo failed\n");
+     9a3:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+     9a8:	83 ec 08             	sub    $0x8,%esp
+     9ab:	68 0c 69 00 00       	push   $0x690c
+     9b0:	50                   	push   %eax
+     9b1:	e8 3d 57 00 00       	call   60f3 <printf>
+     9b6:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9b9:	e8 39 55 00 00       	call   5ef7 <exit>
+  }
+}
+     9be:	90                   	nop
+     9bf:	c9                   	leave
+     9c0:	c3                   	ret
+
+000009c1 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     9c1:	55                   	push   %ebp
+     9c2:	89 e5                	mov    %esp,%ebp
+     9c4:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     9c7:	83 ec 0c             	sub    $0xc,%esp
+     9ca:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     9cd:	50                   	push   %eax
+     9ce:	e8 34 55 00 00       	call   5f07 <pipe>
+     9d3:	83 c4 10             	add    $0x10,%esp
+     9d6:	85 c0                	test   %eax,%eax
+     9d8:	74 17                	je     9f1 <pipe1+0x30>
+    printf(1, "pipe() failed\n");
+     9da:	83 ec 08             	sub    $0x8,%esp
+     9dd:	68 1e 69 00 00       	push   $0x691e
+     9e2:	6a 01                	push   $0x1
+     9e4:	e8 0a 57 00 00       	call   60f3 <printf>
+     9e9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9ec:	e8 06 55 00 00       	call   5ef7 <exit>
+  }
+  pid = fork();
+     9f1:	e8 f9 54 00 00       	call   5eef <fork>
+     9f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  seq = 0;
+     9f9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pid == 0){
+     a00:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a04:	0f 85 89 00 00 00    	jne    a93 <pipe1+0xd2>
+    close(fds[0]);
+     a0a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     a0d:	83 ec 0c             	sub    $0xc,%esp
+     a10:	50                   	push   %eax
+     a11:	e8 09 55 00 00       	call   5f1f <close>
+     a16:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < 5; n++){
+     a19:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     a20:	eb 66                	jmp    a88 <pipe1+0xc7>
+      for(i = 0; i < 1033; i++)
+     a22:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a29:	eb 19                	jmp    a44 <pipe1+0x83>
+        buf[i] = seq++;
+     a2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a2e:	8d 50 01             	lea    0x1(%eax),%edx
+     a31:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a34:	89 c2                	mov    %eax,%edx
+     a36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a39:	05 e0 8e 00 00       	add    $0x8ee0,%eax
+     a3e:	88 10                	mov    %dl,(%eax)
+      for(i = 0; i < 1033; i++)
+     a40:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a44:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+     a4b:	7e de                	jle    a2b <pipe1+0x6a>
+      if(write(fds[1], buf, 1033) != 1033){
+     a4d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     a50:	83 ec 04             	sub    $0x4,%esp
+     a53:	68 09 04 00 00       	push   $0x409
+     a58:	68 e0 8e 00 00       	push   $0x8ee0
+     a5d:	50                   	push   %eax
+     a5e:	e8 b4 54 00 00       	call   5f17 <write>
+     a63:	83 c4 10             	add    $0x10,%esp
+     a66:	3d 09 04 00 00       	cmp    $0x409,%eax
+     a6b:	74 17                	je     a84 <pipe1+0xc3>
+        printf(1, "pipe1 oops 1\n");
+     a6d:	83 ec 08             	sub    $0x8,%esp
+     a70:	68 2d 69 00 00       	push   $0x692d
+     a75:	6a 01                	push   $0x1
+     a77:	e8 77 56 00 00       	call   60f3 <printf>
+     a7c:	83 c4 10             	add    $0x10,%esp
+        exit();
+     a7f:	e8 73 54 00 00       	call   5ef7 <exit>
+    for(n = 0; n < 5; n++){
+     a84:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     a88:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+     a8c:	7e 94                	jle    a22 <pipe1+0x61>
+      }
+    }
+    exit();
+     a8e:	e8 64 54 00 00       	call   5ef7 <exit>
+  } else if(pid > 0){
+     a93:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a97:	0f 8e f4 00 00 00    	jle    b91 <pipe1+0x1d0>
+    close(fds[1]);
+     a9d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     aa0:	83 ec 0c             	sub    $0xc,%esp
+     aa3:	50                   	push   %eax
+     aa4:	e8 76 54 00 00       	call   5f1f <close>
+     aa9:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     aac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    cc = 1;
+     ab3:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     aba:	eb 66                	jmp    b22 <pipe1+0x161>
+      for(i = 0; i < n; i++){
+     abc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     ac3:	eb 3b                	jmp    b00 <pipe1+0x13f>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     ac5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ac8:	05 e0 8e 00 00       	add    $0x8ee0,%eax
+     acd:	0f b6 00             	movzbl (%eax),%eax
+     ad0:	0f be c8             	movsbl %al,%ecx
+     ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ad6:	8d 50 01             	lea    0x1(%eax),%edx
+     ad9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     adc:	31 c8                	xor    %ecx,%eax
+     ade:	0f b6 c0             	movzbl %al,%eax
+     ae1:	85 c0                	test   %eax,%eax
+     ae3:	74 17                	je     afc <pipe1+0x13b>
+          printf(1, "pipe1 oops 2\n");
+     ae5:	83 ec 08             	sub    $0x8,%esp
+     ae8:	68 3b 69 00 00       	push   $0x693b
+     aed:	6a 01                	push   $0x1
+     aef:	e8 ff 55 00 00       	call   60f3 <printf>
+     af4:	83 c4 10             	add    $0x10,%esp
+     af7:	e9 ac 00 00 00       	jmp    ba8 <pipe1+0x1e7>
+      for(i = 0; i < n; i++){
+     afc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b03:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     b06:	7c bd                	jl     ac5 <pipe1+0x104>
+          return;
+        }
+      }
+      total += n;
+     b08:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b0b:	01 45 e4             	add    %eax,-0x1c(%ebp)
+      cc = cc * 2;
+     b0e:	d1 65 e8             	shll   -0x18(%ebp)
+      if(cc > sizeof(buf))
+     b11:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b14:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     b19:	76 07                	jbe    b22 <pipe1+0x161>
+        cc = sizeof(buf);
+     b1b:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     b22:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b25:	83 ec 04             	sub    $0x4,%esp
+     b28:	ff 75 e8             	push   -0x18(%ebp)
+     b2b:	68 e0 8e 00 00       	push   $0x8ee0
+     b30:	50                   	push   %eax
+     b31:	e8 d9 53 00 00       	call   5f0f <read>
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b40:	0f 8f 76 ff ff ff    	jg     abc <pipe1+0xfb>
+    }
+    if(total != 5 * 1033){
+     b46:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+     b4d:	74 1a                	je     b69 <pipe1+0x1a8>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b4f:	83 ec 04             	sub    $0x4,%esp
+     b52:	ff 75 e4             	push   -0x1c(%ebp)
+     b55:	68 49 69 00 00       	push   $0x6949
+     b5a:	6a 01                	push   $0x1
+     b5c:	e8 92 55 00 00       	call   60f3 <printf>
+     b61:	83 c4 10             	add    $0x10,%esp
+      exit();
+     b64:	e8 8e 53 00 00       	call   5ef7 <exit>
+    }
+    close(fds[0]);
+     b69:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b6c:	83 ec 0c             	sub    $0xc,%esp
+     b6f:	50                   	push   %eax
+     b70:	e8 aa 53 00 00       	call   5f1f <close>
+     b75:	83 c4 10             	add    $0x10,%esp
+    wait();
+     b78:	e8 82 53 00 00       	call   5eff <wait>
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+     b7d:	83 ec 08             	sub    $0x8,%esp
+     b80:	68 6f 69 00 00       	push   $0x696f
+     b85:	6a 01                	push   $0x1
+     b87:	e8 67 55 00 00       	call   60f3 <printf>
+     b8c:	83 c4 10             	add    $0x10,%esp
+     b8f:	eb 17                	jmp    ba8 <pipe1+0x1e7>
+    printf(1, "fork() failed\n");
+     b91:	83 ec 08             	sub    $0x8,%esp
+     b94:	68 60 69 00 00       	push   $0x6960
+     b99:	6a 01                	push   $0x1
+     b9b:	e8 53 55 00 00       	call   60f3 <printf>
+     ba0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     ba3:	e8 4f 53 00 00       	call   5ef7 <exit>
+}
+     ba8:	c9                   	leave
+     ba9:	c3                   	ret
+
+00000baa <polltest>:
+
+// poll() over several pipes: readiness, EOF, and waking
+// a blocked poller from another process.
+void
+polltest(void)
+{
+     baa:	55                   	push   %ebp
+     bab:	89 e5                	mov    %esp,%ebp
+     bad:	83 ec 38             	sub    $0x38,%esp
+  int p1[2], p2[2], pid;
+  struct pollfd pfd[2];
+  char c;
+
+  printf(1, "poll test\n");
+     bb0:	83 ec 08             	sub    $0x8,%esp
+     bb3:	68 79 69 00 00       	push   $0x6979
+     bb8:	6a 01                	push   $0x1
+     bba:	e8 34 55 00 00       	call   60f3 <printf>
+     bbf:	83 c4 10             	add    $0x10,%esp
+  if(pipe(p1) != 0 || pipe(p2) != 0){
+     bc2:	83 ec 0c             	sub    $0xc,%esp
+     bc5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     bc8:	50                   	push   %eax
+     bc9:	e8 39 53 00 00       	call   5f07 <pipe>
+     bce:	83 c4 10             	add    $0x10,%esp
+     bd1:	85 c0                	test   %eax,%eax
+     bd3:	75 13                	jne    be8 <polltest+0x3e>
+     bd5:	83 ec 0c             	sub    $0xc,%esp
+     bd8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     bdb:	50                   	push   %eax
+     bdc:	e8 26 53 00 00       	call   5f07 <pipe>
+     be1:	83 c4 10             	add    $0x10,%esp
+     be4:	85 c0                	test   %eax,%eax
+     be6:	74 17                	je     bff <polltest+0x55>
+    printf(1, "pipe() failed\n");
+     be8:	83 ec 08             	sub    $0x8,%esp
+     beb:	68 1e 69 00 00       	push   $0x691e
+     bf0:	6a 01                	push   $0x1
+     bf2:	e8 fc 54 00 00       	call   60f3 <printf>
+     bf7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     bfa:	e8 f8 52 00 00       	call   5ef7 <exit>
+  }
+  pfd[0].fd = p1[0];
+     bff:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c02:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  pfd[0].events = POLLIN;
+     c05:	66 c7 45 d8 01 00    	movw   $0x1,-0x28(%ebp)
+  pfd[1].fd = p2[0];
+     c0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c0e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  pfd[1].events = POLLIN;
+     c11:	66 c7 45 e0 01 00    	movw   $0x1,-0x20(%ebp)
+  if(poll(pfd, 2, 0) != 0){
+     c17:	83 ec 04             	sub    $0x4,%esp
+     c1a:	6a 00                	push   $0x0
+     c1c:	6a 02                	push   $0x2
+     c1e:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c21:	50                   	push   %eax
+     c22:	e8 70 53 00 00       	call   5f97 <poll>
+     c27:	83 c4 10             	add    $0x10,%esp
+     c2a:	85 c0                	test   %eax,%eax
+     c2c:	74 17                	je     c45 <polltest+0x9b>
+    printf(1, "poll: empty pipes ready\n");
+     c2e:	83 ec 08             	sub    $0x8,%esp
+     c31:	68 84 69 00 00       	push   $0x6984
+     c36:	6a 01                	push   $0x1
+     c38:	e8 b6 54 00 00       	call   60f3 <printf>
+     c3d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     c40:	e8 b2 52 00 00       	call   5ef7 <exit>
+  }
+  if(poll(pfd, 2, 2) != 0){
+     c45:	83 ec 04             	sub    $0x4,%esp
+     c48:	6a 02                	push   $0x2
+     c4a:	6a 02                	push   $0x2
+     c4c:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     c4f:	50                   	push   %eax
+     c50:	e8 42 53 00 00       	call   5f97 <poll>
+     c55:	83 c4 10             	add    $0x10,%esp
+     c58:	85 c0                	test   %eax,%eax
+     c5a:	74 17                	je     c73 <polltest+0xc9>
+    printf(1, "poll: timeout returned ready\n");
+     c5c:	83 ec 08             	sub    $0x8,%esp
+     c5f:	68 9d 69 00 00       	push   $0x699d
+     c64:	6a 01                	push   $0x1
+     c66:	e8 88 54 00 00       	call   60f3 <printf>
+     c6b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     c6e:	e8 84 52 00 00       	call   5ef7 <exit>
+  }
+
+  pid = fork();
+     c73:	e8 77 52 00 00       	call   5eef <fork>
+     c78:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     c7b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c7f:	79 17                	jns    c98 <polltest+0xee>
+    printf(1, "fork failed\n");
+     c81:	83 ec 08             	sub    $0x8,%esp
+     c84:	68 4d 65 00 00       	push   $0x654d
+     c89:	6a 01                	push   $0x1
+     c8b:	e8 63 54 00 00       	call   60f3 <printf>
+     c90:	83 c4 10             	add    $0x10,%esp
+    exit();
+     c93:	e8 5f 52 00 00       	call   5ef7 <exit>
+  }
+  if(pid == 0){
+     c98:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c9c:	75 28                	jne    cc6 <polltest+0x11c>
+    sleep(5);
+     c9e:	83 ec 0c             	sub    $0xc,%esp
+     ca1:	6a 05                	push   $0x5
+     ca3:	e8 df 52 00 00       	call   5f87 <sleep>
+     ca8:	83 c4 10             	add    $0x10,%esp
+    write(p2[1], "x", 1);
+     cab:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     cae:	83 ec 04             	sub    $0x4,%esp
+     cb1:	6a 01                	push   $0x1
+     cb3:	68 bb 69 00 00       	push   $0x69bb
+     cb8:	50                   	push   %eax
+     cb9:	e8 59 52 00 00       	call   5f17 <write>
+     cbe:	83 c4 10             	add    $0x10,%esp
+    exit();
+     cc1:	e8 31 52 00 00       	call   5ef7 <exit>
+  }
+  if(poll(pfd, 2, -1) != 1 || pfd[0].revents != 0 || pfd[1].revents != POLLIN){
+     cc6:	83 ec 04             	sub    $0x4,%esp
+     cc9:	6a ff                	push   $0xffffffff
+     ccb:	6a 02                	push   $0x2
+     ccd:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     cd0:	50                   	push   %eax
+     cd1:	e8 c1 52 00 00       	call   5f97 <poll>
+     cd6:	83 c4 10             	add    $0x10,%esp
+     cd9:	83 f8 01             	cmp    $0x1,%eax
+     cdc:	75 13                	jne    cf1 <polltest+0x147>
+     cde:	0f b7 45 da          	movzwl -0x26(%ebp),%eax
+     ce2:	66 85 c0             	test   %ax,%ax
+     ce5:	75 0a                	jne    cf1 <polltest+0x147>
+     ce7:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     ceb:	66 83 f8 01          	cmp    $0x1,%ax
+     cef:	74 22                	je     d13 <polltest+0x169>
+    printf(1, "poll: wrong revents %d %d\n", pfd[0].revents, pfd[1].revents);
+     cf1:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     cf5:	0f bf d0             	movswl %ax,%edx
+     cf8:	0f b7 45 da          	movzwl -0x26(%ebp),%eax
+     cfc:	98                   	cwtl
+     cfd:	52                   	push   %edx
+     cfe:	50                   	push   %eax
+     cff:	68 bd 69 00 00       	push   $0x69bd
+     d04:	6a 01                	push   $0x1
+     d06:	e8 e8 53 00 00       	call   60f3 <printf>
+     d0b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     d0e:	e8 e4 51 00 00       	call   5ef7 <exit>
+  }
+  if(read(p2[0], &c, 1) != 1 || c != 'x'){
+     d13:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d16:	83 ec 04             	sub    $0x4,%esp
+     d19:	6a 01                	push   $0x1
+     d1b:	8d 55 d3             	lea    -0x2d(%ebp),%edx
+     d1e:	52                   	push   %edx
+     d1f:	50                   	push   %eax
+     d20:	e8 ea 51 00 00       	call   5f0f <read>
+     d25:	83 c4 10             	add    $0x10,%esp
+     d28:	83 f8 01             	cmp    $0x1,%eax
+     d2b:	75 08                	jne    d35 <polltest+0x18b>
+     d2d:	0f b6 45 d3          	movzbl -0x2d(%ebp),%eax
+     d31:	3c 78                	cmp    $0x78,%al
+     d33:	74 17                	je     d4c <polltest+0x1a2>
+    printf(1, "poll: read failed\n");
+     d35:	83 ec 08             	sub    $0x8,%esp
+     d38:	68 d8 69 00 00       	push   $0x69d8
+     d3d:	6a 01                	push   $0x1
+     d3f:	e8 af 53 00 00       	call   60f3 <printf>
+     d44:	83 c4 10             	add    $0x10,%esp
+    exit();
+     d47:	e8 ab 51 00 00       	call   5ef7 <exit>
+  }
+  wait();
+     d4c:	e8 ae 51 00 00       	call   5eff <wait>
+
+  close(p1[1]);
+     d51:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d54:	83 ec 0c             	sub    $0xc,%esp
+     d57:	50                   	push   %eax
+     d58:	e8 c2 51 00 00       	call   5f1f <close>
+     d5d:	83 c4 10             	add    $0x10,%esp
+  if(poll(pfd, 2, 0) != 1 || pfd[0].revents != POLLHUP){
+     d60:	83 ec 04             	sub    $0x4,%esp
+     d63:	6a 00                	push   $0x0
+     d65:	6a 02                	push   $0x2
+     d67:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     d6a:	50                   	push   %eax
+     d6b:	e8 27 52 00 00       	call   5f97 <poll>
+     d70:	83 c4 10             	add    $0x10,%esp
+     d73:	83 f8 01             	cmp    $0x1,%eax
+     d76:	75 0a                	jne    d82 <polltest+0x1d8>
+     d78:	0f b7 45 da          	movzwl -0x26(%ebp),%eax
+     d7c:	66 83 f8 10          	cmp    $0x10,%ax
+     d80:	74 17                	je     d99 <polltest+0x1ef>
+    printf(1, "poll: no POLLHUP\n");
+     d82:	83 ec 08             	sub    $0x8,%esp
+     d85:	68 eb 69 00 00       	push   $0x69eb
+     d8a:	6a 01                	push   $0x1
+     d8c:	e8 62 53 00 00       	call   60f3 <printf>
+     d91:	83 c4 10             	add    $0x10,%esp
+    exit();
+     d94:	e8 5e 51 00 00       	call   5ef7 <exit>
+  }
+  pfd[0].fd = p2[1];
+     d99:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d9c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  pfd[0].events = POLLOUT;
+     d9f:	66 c7 45 d8 04 00    	movw   $0x4,-0x28(%ebp)
+  pfd[1].fd = 99;
+     da5:	c7 45 dc 63 00 00 00 	movl   $0x63,-0x24(%ebp)
+  if(poll(pfd, 2, 0) != 2 || pfd[0].revents != POLLOUT || pfd[1].revents != POLLNVAL){
+     dac:	83 ec 04             	sub    $0x4,%esp
+     daf:	6a 00                	push   $0x0
+     db1:	6a 02                	push   $0x2
+     db3:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     db6:	50                   	push   %eax
+     db7:	e8 db 51 00 00       	call   5f97 <poll>
+     dbc:	83 c4 10             	add    $0x10,%esp
+     dbf:	83 f8 02             	cmp    $0x2,%eax
+     dc2:	75 14                	jne    dd8 <polltest+0x22e>
+     dc4:	0f b7 45 da          	movzwl -0x26(%ebp),%eax
+     dc8:	66 83 f8 04          	cmp    $0x4,%ax
+     dcc:	75 0a                	jne    dd8 <polltest+0x22e>
+     dce:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     dd2:	66 83 f8 20          	cmp    $0x20,%ax
+     dd6:	74 17                	je     def <polltest+0x245>
+    printf(1, "poll: bad POLLOUT/POLLNVAL\n");
+     dd8:	83 ec 08             	sub    $0x8,%esp
+     ddb:	68 fd 69 00 00       	push   $0x69fd
+     de0:	6a 01                	push   $0x1
+     de2:	e8 0c 53 00 00       	call   60f3 <printf>
+     de7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     dea:	e8 08 51 00 00       	call   5ef7 <exit>
+  }
+  close(p1[0]);
+     def:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     df2:	83 ec 0c             	sub    $0xc,%esp
+     df5:	50                   	push   %eax
+     df6:	e8 24 51 00 00       	call   5f1f <close>
+     dfb:	83 c4 10             	add    $0x10,%esp
+  close(p2[0]);
+     dfe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e01:	83 ec 0c             	sub    $0xc,%esp
+     e04:	50                   	push   %eax
+     e05:	e8 15 51 00 00       	call   5f1f <close>
+     e0a:	83 c4 10             	add    $0x10,%esp
+  close(p2[1]);
+     e0d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     e10:	83 ec 0c             	sub    $0xc,%esp
+     e13:	50                   	push   %eax
+     e14:	e8 06 51 00 00       	call   5f1f <close>
+     e19:	83 c4 10             	add    $0x10,%esp
+  printf(1, "poll test ok\n");
+     e1c:	83 ec 08             	sub    $0x8,%esp
+     e1f:	68 19 6a 00 00       	push   $0x6a19
+     e24:	6a 01                	push   $0x1
+     e26:	e8 c8 52 00 00       	call   60f3 <printf>
+     e2b:	83 c4 10             	add    $0x10,%esp
+}
+     e2e:	90                   	nop
+     e2f:	c9                   	leave
+     e30:	c3                   	ret
+
+00000e31 <pollfulltest>:
+
+// A writer blocked on a full pipe must still wake a poller on
+// the read end.
+void
+pollfulltest(void)
+{
+     e31:	55                   	push   %ebp
+     e32:	89 e5                	mov    %esp,%ebp
+     e34:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid, n, tot;
+  struct pollfd pfd;
+
+  printf(1, "poll full pipe test\n");
+     e37:	83 ec 08             	sub    $0x8,%esp
+     e3a:	68 27 6a 00 00       	push   $0x6a27
+     e3f:	6a 01                	push   $0x1
+     e41:	e8 ad 52 00 00       	call   60f3 <printf>
+     e46:	83 c4 10             	add    $0x10,%esp
+  if(pipe(fds) != 0){
+     e49:	83 ec 0c             	sub    $0xc,%esp
+     e4c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     e4f:	50                   	push   %eax
+     e50:	e8 b2 50 00 00       	call   5f07 <pipe>
+     e55:	83 c4 10             	add    $0x10,%esp
+     e58:	85 c0                	test   %eax,%eax
+     e5a:	74 17                	je     e73 <pollfulltest+0x42>
+    printf(1, "pipe() failed\n");
+     e5c:	83 ec 08             	sub    $0x8,%esp
+     e5f:	68 1e 69 00 00       	push   $0x691e
+     e64:	6a 01                	push   $0x1
+     e66:	e8 88 52 00 00       	call   60f3 <printf>
+     e6b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     e6e:	e8 84 50 00 00       	call   5ef7 <exit>
+  }
+  pid = fork();
+     e73:	e8 77 50 00 00       	call   5eef <fork>
+     e78:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid < 0){
+     e7b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e7f:	79 17                	jns    e98 <pollfulltest+0x67>
+    printf(1, "fork failed\n");
+     e81:	83 ec 08             	sub    $0x8,%esp
+     e84:	68 4d 65 00 00       	push   $0x654d
+     e89:	6a 01                	push   $0x1
+     e8b:	e8 63 52 00 00       	call   60f3 <printf>
+     e90:	83 c4 10             	add    $0x10,%esp
+    exit();
+     e93:	e8 5f 50 00 00       	call   5ef7 <exit>
+  }
+  if(pid == 0){
+     e98:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e9c:	75 6a                	jne    f08 <pollfulltest+0xd7>
+    close(fds[0]);
+     e9e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     ea1:	83 ec 0c             	sub    $0xc,%esp
+     ea4:	50                   	push   %eax
+     ea5:	e8 75 50 00 00       	call   5f1f <close>
+     eaa:	83 c4 10             	add    $0x10,%esp
+    sleep(5);
+     ead:	83 ec 0c             	sub    $0xc,%esp
+     eb0:	6a 05                	push   $0x5
+     eb2:	e8 d0 50 00 00       	call   5f87 <sleep>
+     eb7:	83 c4 10             	add    $0x10,%esp
+    memset(buf, 'p', 1000);
+     eba:	83 ec 04             	sub    $0x4,%esp
+     ebd:	68 e8 03 00 00       	push   $0x3e8
+     ec2:	6a 70                	push   $0x70
+     ec4:	68 e0 8e 00 00       	push   $0x8ee0
+     ec9:	e8 50 4e 00 00       	call   5d1e <memset>
+     ece:	83 c4 10             	add    $0x10,%esp
+    if(write(fds[1], buf, 1000) != 1000)
+     ed1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ed4:	83 ec 04             	sub    $0x4,%esp
+     ed7:	68 e8 03 00 00       	push   $0x3e8
+     edc:	68 e0 8e 00 00       	push   $0x8ee0
+     ee1:	50                   	push   %eax
+     ee2:	e8 30 50 00 00       	call   5f17 <write>
+     ee7:	83 c4 10             	add    $0x10,%esp
+     eea:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+     eef:	74 12                	je     f03 <pollfulltest+0xd2>
+      printf(1, "poll full: write failed\n");
+     ef1:	83 ec 08             	sub    $0x8,%esp
+     ef4:	68 3c 6a 00 00       	push   $0x6a3c
+     ef9:	6a 01                	push   $0x1
+     efb:	e8 f3 51 00 00       	call   60f3 <printf>
+     f00:	83 c4 10             	add    $0x10,%esp
+    exit();
+     f03:	e8 ef 4f 00 00       	call   5ef7 <exit>
+  }
+  close(fds[1]);
+     f08:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     f0b:	83 ec 0c             	sub    $0xc,%esp
+     f0e:	50                   	push   %eax
+     f0f:	e8 0b 50 00 00       	call   5f1f <close>
+     f14:	83 c4 10             	add    $0x10,%esp
+  pfd.fd = fds[0];
+     f17:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f1a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  pfd.events = POLLIN;
+     f1d:	66 c7 45 e0 01 00    	movw   $0x1,-0x20(%ebp)
+  for(tot = 0; tot < 1000; tot += n){
+     f23:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f2a:	e9 86 00 00 00       	jmp    fb5 <pollfulltest+0x184>
+    if(poll(&pfd, 1, -1) != 1 || !(pfd.revents & POLLIN)){
+     f2f:	83 ec 04             	sub    $0x4,%esp
+     f32:	6a ff                	push   $0xffffffff
+     f34:	6a 01                	push   $0x1
+     f36:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     f39:	50                   	push   %eax
+     f3a:	e8 58 50 00 00       	call   5f97 <poll>
+     f3f:	83 c4 10             	add    $0x10,%esp
+     f42:	83 f8 01             	cmp    $0x1,%eax
+     f45:	75 0c                	jne    f53 <pollfulltest+0x122>
+     f47:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     f4b:	98                   	cwtl
+     f4c:	83 e0 01             	and    $0x1,%eax
+     f4f:	85 c0                	test   %eax,%eax
+     f51:	75 1d                	jne    f70 <pollfulltest+0x13f>
+      printf(1, "poll full: wrong revents %d\n", pfd.revents);
+     f53:	0f b7 45 e2          	movzwl -0x1e(%ebp),%eax
+     f57:	98                   	cwtl
+     f58:	83 ec 04             	sub    $0x4,%esp
+     f5b:	50                   	push   %eax
+     f5c:	68 55 6a 00 00       	push   $0x6a55
+     f61:	6a 01                	push   $0x1
+     f63:	e8 8b 51 00 00       	call   60f3 <printf>
+     f68:	83 c4 10             	add    $0x10,%esp
+      exit();
+     f6b:	e8 87 4f 00 00       	call   5ef7 <exit>
+    }
+    if((n = read(fds[0], buf, 1000 - tot)) <= 0){
+     f70:	b8 e8 03 00 00       	mov    $0x3e8,%eax
+     f75:	2b 45 f4             	sub    -0xc(%ebp),%eax
+     f78:	89 c2                	mov    %eax,%edx
+     f7a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     f7d:	83 ec 04             	sub    $0x4,%esp
+     f80:	52                   	push   %edx
+     f81:	68 e0 8e 00 00       	push   $0x8ee0
+     f86:	50                   	push   %eax
+     f87:	e8 83 4f 00 00       	call   5f0f <read>
+     f8c:	83 c4 10             	add    $0x10,%esp
+     f8f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     f92:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     f96:	7f 17                	jg     faf <pollfulltest+0x17e>
+      printf(1, "poll full: read failed\n");
+     f98:	83 ec 08             	sub    $0x8,%esp
+     f9b:	68 72 6a 00 00       	push   $0x6a72
+     fa0:	6a 01                	push   $0x1
+     fa2:	e8 4c 51 00 00       	call   60f3 <printf>
+     fa7:	83 c4 10             	add    $0x10,%esp
+      exit();
+     faa:	e8 48 4f 00 00       	call   5ef7 <exit>
+  for(tot = 0; tot < 1000; tot += n){
+     faf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     fb2:	01 45 f4             	add    %eax,-0xc(%ebp)
+     fb5:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+     fbc:	0f 8e 6d ff ff ff    	jle    f2f <pollfulltest+0xfe>
+    }
+  }
+  wait();
+     fc2:	e8 38 4f 00 00       	call   5eff <wait>
+  close(fds[0]);
+     fc7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     fca:	83 ec 0c             	sub    $0xc,%esp
+     fcd:	50                   	push   %eax
+     fce:	e8 4c 4f 00 00       	call   5f1f <close>
+     fd3:	83 c4 10             	add    $0x10,%esp
+  printf(1, "poll full pipe test ok\n");
+     fd6:	83 ec 08             	sub    $0x8,%esp
+     fd9:	68 8a 6a 00 00       	push   $0x6a8a
+     fde:	6a 01                	push   $0x1
+     fe0:	e8 0e 51 00 00       	call   60f3 <printf>
+     fe5:	83 c4 10             	add    $0x10,%esp
+}
+     fe8:	90                   	nop
+     fe9:	c9                   	leave
+     fea:	c3                   	ret
+
+00000feb <nonblocktest>:
+
+// O_NONBLOCK pipe ends return -EAGAIN instead of sleeping.
+void
+nonblocktest(void)
+{
+     feb:	55                   	push   %ebp
+     fec:	89 e5                	mov    %esp,%ebp
+     fee:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], n, tot;
+  char c;
+
+  printf(1, "nonblock test\n");
+     ff1:	83 ec 08             	sub    $0x8,%esp
+     ff4:	68 a2 6a 00 00       	push   $0x6aa2
+     ff9:	6a 01                	push   $0x1
+     ffb:	e8 f3 50 00 00       	call   60f3 <printf>
+    1000:	83 c4 10             	add    $0x10,%esp
+  if(pipe(fds) != 0){
+    1003:	83 ec 0c             	sub    $0xc,%esp
+    1006:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    1009:	50                   	push   %eax
+    100a:	e8 f8 4e 00 00       	call   5f07 <pipe>
+    100f:	83 c4 10             	add    $0x10,%esp
+    1012:	85 c0                	test   %eax,%eax
+    1014:	74 17                	je     102d <nonblocktest+0x42>
+    printf(1, "pipe() failed\n");
+    1016:	83 ec 08             	sub    $0x8,%esp
+    1019:	68 1e 69 00 00       	push   $0x691e
+    101e:	6a 01                	push   $0x1
+    1020:	e8 ce 50 00 00       	call   60f3 <printf>
+    1025:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1028:	e8 ca 4e 00 00       	call   5ef7 <exit>
+  }
+  if(fcntl(fds[0], F_SETFL, O_NONBLOCK) != 0 ||
+    102d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1030:	83 ec 04             	sub    $0x4,%esp
+    1033:	68 00 08 00 00       	push   $0x800
+    1038:	6a 02                	push   $0x2
+    103a:	50                   	push   %eax
+    103b:	e8 5f 4f 00 00       	call   5f9f <fcntl>
+    1040:	83 c4 10             	add    $0x10,%esp
+    1043:	85 c0                	test   %eax,%eax
+    1045:	75 34                	jne    107b <nonblocktest+0x90>
+     fcntl(fds[1], F_SETFL, O_NONBLOCK) != 0 ||
+    1047:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    104a:	83 ec 04             	sub    $0x4,%esp
+    104d:	68 00 08 00 00       	push   $0x800
+    1052:	6a 02                	push   $0x2
+    1054:	50                   	push   %eax
+    1055:	e8 45 4f 00 00       	call   5f9f <fcntl>
+    105a:	83 c4 10             	add    $0x10,%esp
+  if(fcntl(fds[0], F_SETFL, O_NONBLOCK) != 0 ||
+    105d:	85 c0                	test   %eax,%eax
+    105f:	75 1a                	jne    107b <nonblocktest+0x90>
+     fcntl(fds[0], F_GETFL, 0) != (O_RDONLY|O_NONBLOCK)){
+    1061:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1064:	83 ec 04             	sub    $0x4,%esp
+    1067:	6a 00                	push   $0x0
+    1069:	6a 01                	push   $0x1
+    106b:	50                   	push   %eax
+    106c:	e8 2e 4f 00 00       	call   5f9f <fcntl>
+    1071:	83 c4 10             	add    $0x10,%esp
+     fcntl(fds[1], F_SETFL, O_NONBLOCK) != 0 ||
+    1074:	3d 00 08 00 00       	cmp    $0x800,%eax
+    1079:	74 17                	je     1092 <nonblocktest+0xa7>
+    printf(1, "fcntl failed\n");
+    107b:	83 ec 08             	sub    $0x8,%esp
+    107e:	68 b1 6a 00 00       	push   $0x6ab1
+    1083:	6a 01                	push   $0x1
+    1085:	e8 69 50 00 00       	call   60f3 <printf>
+    108a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    108d:	e8 65 4e 00 00       	call   5ef7 <exit>
+  }
+  if(read(fds[0], &c, 1) != -EAGAIN){
+    1092:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1095:	83 ec 04             	sub    $0x4,%esp
+    1098:	6a 01                	push   $0x1
+    109a:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    109d:	52                   	push   %edx
+    109e:	50                   	push   %eax
+    109f:	e8 6b 4e 00 00       	call   5f0f <read>
+    10a4:	83 c4 10             	add    $0x10,%esp
+    10a7:	83 f8 f5             	cmp    $0xfffffff5,%eax
+    10aa:	74 17                	je     10c3 <nonblocktest+0xd8>
+    printf(1, "nonblock: empty read did not fail\n");
+    10ac:	83 ec 08             	sub    $0x8,%esp
+    10af:	68 c0 6a 00 00       	push   $0x6ac0
+    10b4:	6a 01                	push   $0x1
+    10b6:	e8 38 50 00 00       	call   60f3 <printf>
+    10bb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    10be:	e8 34 4e 00 00       	call   5ef7 <exit>
+  }
+  tot = 0;
+    10c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  memset(buf, 'n', 100);
+    10ca:	83 ec 04             	sub    $0x4,%esp
+    10cd:	6a 64                	push   $0x64
+    10cf:	6a 6e                	push   $0x6e
+    10d1:	68 e0 8e 00 00       	push   $0x8ee0
+    10d6:	e8 43 4c 00 00       	call   5d1e <memset>
+    10db:	83 c4 10             	add    $0x10,%esp
+  while((n = write(fds[1], buf, 100)) > 0)
+    10de:	eb 06                	jmp    10e6 <nonblocktest+0xfb>
+    tot += n;
+    10e0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    10e3:	01 45 f4             	add    %eax,-0xc(%ebp)
+  while((n = write(fds[1], buf, 100)) > 0)
+    10e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10e9:	83 ec 04             	sub    $0x4,%esp
+    10ec:	6a 64                	push   $0x64
+    10ee:	68 e0 8e 00 00       	push   $0x8ee0
+    10f3:	50                   	push   %eax
+    10f4:	e8 1e 4e 00 00       	call   5f17 <write>
+    10f9:	83 c4 10             	add    $0x10,%esp
+    10fc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    10ff:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1103:	7f db                	jg     10e0 <nonblocktest+0xf5>
+  if(n != -EAGAIN || tot == 0){
+    1105:	83 7d f0 f5          	cmpl   $0xfffffff5,-0x10(%ebp)
+    1109:	75 06                	jne    1111 <nonblocktest+0x126>
+    110b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    110f:	75 20                	jne    1131 <nonblocktest+0x146>
+    printf(1, "nonblock: full write returned %d after %d\n", n, tot);
+    1111:	ff 75 f4             	push   -0xc(%ebp)
+    1114:	ff 75 f0             	push   -0x10(%ebp)
+    1117:	68 e4 6a 00 00       	push   $0x6ae4
+    111c:	6a 01                	push   $0x1
+    111e:	e8 d0 4f 00 00       	call   60f3 <printf>
+    1123:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1126:	e8 cc 4d 00 00       	call   5ef7 <exit>
+  }
+  while((n = read(fds[0], buf, sizeof(buf))) > 0)
+    tot -= n;
+    112b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    112e:	29 45 f4             	sub    %eax,-0xc(%ebp)
+  while((n = read(fds[0], buf, sizeof(buf))) > 0)
+    1131:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1134:	83 ec 04             	sub    $0x4,%esp
+    1137:	68 00 20 00 00       	push   $0x2000
+    113c:	68 e0 8e 00 00       	push   $0x8ee0
+    1141:	50                   	push   %eax
+    1142:	e8 c8 4d 00 00       	call   5f0f <read>
+    1147:	83 c4 10             	add    $0x10,%esp
+    114a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    114d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1151:	7f d8                	jg     112b <nonblocktest+0x140>
+  if(n != -EAGAIN || tot != 0){
+    1153:	83 7d f0 f5          	cmpl   $0xfffffff5,-0x10(%ebp)
+    1157:	75 06                	jne    115f <nonblocktest+0x174>
+    1159:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    115d:	74 17                	je     1176 <nonblocktest+0x18b>
+    printf(1, "nonblock: drained wrong amount\n");
+    115f:	83 ec 08             	sub    $0x8,%esp
+    1162:	68 10 6b 00 00       	push   $0x6b10
+    1167:	6a 01                	push   $0x1
+    1169:	e8 85 4f 00 00       	call   60f3 <printf>
+    116e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1171:	e8 81 4d 00 00       	call   5ef7 <exit>
+  }
+  close(fds[1]);
+    1176:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1179:	83 ec 0c             	sub    $0xc,%esp
+    117c:	50                   	push   %eax
+    117d:	e8 9d 4d 00 00       	call   5f1f <close>
+    1182:	83 c4 10             	add    $0x10,%esp
+  if(read(fds[0], &c, 1) != 0){
+    1185:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1188:	83 ec 04             	sub    $0x4,%esp
+    118b:	6a 01                	push   $0x1
+    118d:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1190:	52                   	push   %edx
+    1191:	50                   	push   %eax
+    1192:	e8 78 4d 00 00       	call   5f0f <read>
+    1197:	83 c4 10             	add    $0x10,%esp
+    119a:	85 c0                	test   %eax,%eax
+    119c:	74 17                	je     11b5 <nonblocktest+0x1ca>
+    printf(1, "nonblock: no EOF\n");
+    119e:	83 ec 08             	sub    $0x8,%esp
+    11a1:	68 30 6b 00 00       	push   $0x6b30
+    11a6:	6a 01                	push   $0x1
+    11a8:	e8 46 4f 00 00       	call   60f3 <printf>
+    11ad:	83 c4 10             	add    $0x10,%esp
+    exit();
+    11b0:	e8 42 4d 00 00       	call   5ef7 <exit>
+  }
+  close(fds[0]);
+    11b5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11b8:	83 ec 0c             	sub    $0xc,%esp
+    11bb:	50                   	push   %eax
+    11bc:	e8 5e 4d 00 00       	call   5f1f <close>
+    11c1:	83 c4 10             	add    $0x10,%esp
+  printf(1, "nonblock test ok\n");
+    11c4:	83 ec 08             	sub    $0x8,%esp
+    11c7:	68 42 6b 00 00       	push   $0x6b42
+    11cc:	6a 01                	push   $0x1
+    11ce:	e8 20 4f 00 00       	call   60f3 <printf>
+    11d3:	83 c4 10             	add    $0x10,%esp
+}
+    11d6:	90                   	nop
+    11d7:	c9                   	leave
+    11d8:	c3                   	ret
+
+000011d9 <preadtest>:
+
+// pread reads at an offset and leaves the file offset alone.
+void
+preadtest(void)
+{
+    11d9:	55                   	push   %ebp
+    11da:	89 e5                	mov    %esp,%ebp
+    11dc:	83 ec 18             	sub    $0x18,%esp
+  int fd, i;
+  char c;
+
+  printf(1, "pread test\n");
+    11df:	83 ec 08             	sub    $0x8,%esp
+    11e2:	68 54 6b 00 00       	push   $0x6b54
+    11e7:	6a 01                	push   $0x1
+    11e9:	e8 05 4f 00 00       	call   60f3 <printf>
+    11ee:	83 c4 10             	add    $0x10,%esp
+  fd = open("preadfile", O_CREATE|O_RDWR);
+    11f1:	83 ec 08             	sub    $0x8,%esp
+    11f4:	68 02 02 00 00       	push   $0x202
+    11f9:	68 60 6b 00 00       	push   $0x6b60
+    11fe:	e8 34 4d 00 00       	call   5f37 <open>
+    1203:	83 c4 10             	add    $0x10,%esp
+    1206:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    1209:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    120d:	79 17                	jns    1226 <preadtest+0x4d>
+    printf(1, "pread: create failed\n");
+    120f:	83 ec 08             	sub    $0x8,%esp
+    1212:	68 6a 6b 00 00       	push   $0x6b6a
+    1217:	6a 01                	push   $0x1
+    1219:	e8 d5 4e 00 00       	call   60f3 <printf>
+    121e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1221:	e8 d1 4c 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < 100; i++)
+    1226:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    122d:	eb 13                	jmp    1242 <preadtest+0x69>
+    buf[i] = i;
+    122f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1232:	89 c2                	mov    %eax,%edx
+    1234:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1237:	05 e0 8e 00 00       	add    $0x8ee0,%eax
+    123c:	88 10                	mov    %dl,(%eax)
+  for(i = 0; i < 100; i++)
+    123e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1242:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    1246:	7e e7                	jle    122f <preadtest+0x56>
+  if(write(fd, buf, 100) != 100){
+    1248:	83 ec 04             	sub    $0x4,%esp
+    124b:	6a 64                	push   $0x64
+    124d:	68 e0 8e 00 00       	push   $0x8ee0
+    1252:	ff 75 f0             	push   -0x10(%ebp)
+    1255:	e8 bd 4c 00 00       	call   5f17 <write>
+    125a:	83 c4 10             	add    $0x10,%esp
+    125d:	83 f8 64             	cmp    $0x64,%eax
+    1260:	74 17                	je     1279 <preadtest+0xa0>
+    printf(1, "pread: write failed\n");
+    1262:	83 ec 08             	sub    $0x8,%esp
+    1265:	68 80 6b 00 00       	push   $0x6b80
+    126a:	6a 01                	push   $0x1
+    126c:	e8 82 4e 00 00       	call   60f3 <printf>
+    1271:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1274:	e8 7e 4c 00 00       	call   5ef7 <exit>
+  }
+  if(pread(fd, &c, 1, 42) != 1 || c != 42 ||
+    1279:	6a 2a                	push   $0x2a
+    127b:	6a 01                	push   $0x1
+    127d:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1280:	50                   	push   %eax
+    1281:	ff 75 f0             	push   -0x10(%ebp)
+    1284:	e8 2e 4d 00 00       	call   5fb7 <pread>
+    1289:	83 c4 10             	add    $0x10,%esp
+    128c:	83 f8 01             	cmp    $0x1,%eax
+    128f:	75 43                	jne    12d4 <preadtest+0xfb>
+    1291:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1295:	3c 2a                	cmp    $0x2a,%al
+    1297:	75 3b                	jne    12d4 <preadtest+0xfb>
+     pread(fd, buf, 10, 95) != 5 || buf[0] != 95 ||
+    1299:	6a 5f                	push   $0x5f
+    129b:	6a 0a                	push   $0xa
+    129d:	68 e0 8e 00 00       	push   $0x8ee0
+    12a2:	ff 75 f0             	push   -0x10(%ebp)
+    12a5:	e8 0d 4d 00 00       	call   5fb7 <pread>
+    12aa:	83 c4 10             	add    $0x10,%esp
+  if(pread(fd, &c, 1, 42) != 1 || c != 42 ||
+    12ad:	83 f8 05             	cmp    $0x5,%eax
+    12b0:	75 22                	jne    12d4 <preadtest+0xfb>
+     pread(fd, buf, 10, 95) != 5 || buf[0] != 95 ||
+    12b2:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    12b9:	3c 5f                	cmp    $0x5f,%al
+    12bb:	75 17                	jne    12d4 <preadtest+0xfb>
+     pread(fd, &c, 1, 100) != 0){
+    12bd:	6a 64                	push   $0x64
+    12bf:	6a 01                	push   $0x1
+    12c1:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    12c4:	50                   	push   %eax
+    12c5:	ff 75 f0             	push   -0x10(%ebp)
+    12c8:	e8 ea 4c 00 00       	call   5fb7 <pread>
+    12cd:	83 c4 10             	add    $0x10,%esp
+     pread(fd, buf, 10, 95) != 5 || buf[0] != 95 ||
+    12d0:	85 c0                	test   %eax,%eax
+    12d2:	74 17                	je     12eb <preadtest+0x112>
+    printf(1, "pread: wrong data\n");
+    12d4:	83 ec 08             	sub    $0x8,%esp
+    12d7:	68 95 6b 00 00       	push   $0x6b95
+    12dc:	6a 01                	push   $0x1
+    12de:	e8 10 4e 00 00       	call   60f3 <printf>
+    12e3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    12e6:	e8 0c 4c 00 00       	call   5ef7 <exit>
+  }
+  if(pwrite(fd, "xy", 2, 10) != 2 || pwrite(fd, "z", 1, 100) != 1 ||
+    12eb:	6a 0a                	push   $0xa
+    12ed:	6a 02                	push   $0x2
+    12ef:	68 a8 6b 00 00       	push   $0x6ba8
+    12f4:	ff 75 f0             	push   -0x10(%ebp)
+    12f7:	e8 03 4d 00 00       	call   5fff <pwrite>
+    12fc:	83 c4 10             	add    $0x10,%esp
+    12ff:	83 f8 02             	cmp    $0x2,%eax
+    1302:	75 73                	jne    1377 <preadtest+0x19e>
+    1304:	6a 64                	push   $0x64
+    1306:	6a 01                	push   $0x1
+    1308:	68 ab 6b 00 00       	push   $0x6bab
+    130d:	ff 75 f0             	push   -0x10(%ebp)
+    1310:	e8 ea 4c 00 00       	call   5fff <pwrite>
+    1315:	83 c4 10             	add    $0x10,%esp
+    1318:	83 f8 01             	cmp    $0x1,%eax
+    131b:	75 5a                	jne    1377 <preadtest+0x19e>
+     pread(fd, buf, 3, 9) != 3 || buf[0] != 9 || buf[1] != 'x' ||
+    131d:	6a 09                	push   $0x9
+    131f:	6a 03                	push   $0x3
+    1321:	68 e0 8e 00 00       	push   $0x8ee0
+    1326:	ff 75 f0             	push   -0x10(%ebp)
+    1329:	e8 89 4c 00 00       	call   5fb7 <pread>
+    132e:	83 c4 10             	add    $0x10,%esp
+  if(pwrite(fd, "xy", 2, 10) != 2 || pwrite(fd, "z", 1, 100) != 1 ||
+    1331:	83 f8 03             	cmp    $0x3,%eax
+    1334:	75 41                	jne    1377 <preadtest+0x19e>
+     pread(fd, buf, 3, 9) != 3 || buf[0] != 9 || buf[1] != 'x' ||
+    1336:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    133d:	3c 09                	cmp    $0x9,%al
+    133f:	75 36                	jne    1377 <preadtest+0x19e>
+    1341:	0f b6 05 e1 8e 00 00 	movzbl 0x8ee1,%eax
+    1348:	3c 78                	cmp    $0x78,%al
+    134a:	75 2b                	jne    1377 <preadtest+0x19e>
+     buf[2] != 'y' || pread(fd, &c, 1, 100) != 1 || c != 'z'){
+    134c:	0f b6 05 e2 8e 00 00 	movzbl 0x8ee2,%eax
+     pread(fd, buf, 3, 9) != 3 || buf[0] != 9 || buf[1] != 'x' ||
+    1353:	3c 79                	cmp    $0x79,%al
+    1355:	75 20                	jne    1377 <preadtest+0x19e>
+     buf[2] != 'y' || pread(fd, &c, 1, 100) != 1 || c != 'z'){
+    1357:	6a 64                	push   $0x64
+    1359:	6a 01                	push   $0x1
+    135b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    135e:	50                   	push   %eax
+    135f:	ff 75 f0             	push   -0x10(%ebp)
+    1362:	e8 50 4c 00 00       	call   5fb7 <pread>
+    1367:	83 c4 10             	add    $0x10,%esp
+    136a:	83 f8 01             	cmp    $0x1,%eax
+    136d:	75 08                	jne    1377 <preadtest+0x19e>
+    136f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    1373:	3c 7a                	cmp    $0x7a,%al
+    1375:	74 17                	je     138e <preadtest+0x1b5>
+    printf(1, "pwrite: wrong data\n");
+    1377:	83 ec 08             	sub    $0x8,%esp
+    137a:	68 ad 6b 00 00       	push   $0x6bad
+    137f:	6a 01                	push   $0x1
+    1381:	e8 6d 4d 00 00       	call   60f3 <printf>
+    1386:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1389:	e8 69 4b 00 00       	call   5ef7 <exit>
+  }
+  // Still at 100 from the write.
+  if(read(fd, &c, 1) != 1 || c != 'z' || read(fd, &c, 1) != 0){
+    138e:	83 ec 04             	sub    $0x4,%esp
+    1391:	6a 01                	push   $0x1
+    1393:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    1396:	50                   	push   %eax
+    1397:	ff 75 f0             	push   -0x10(%ebp)
+    139a:	e8 70 4b 00 00       	call   5f0f <read>
+    139f:	83 c4 10             	add    $0x10,%esp
+    13a2:	83 f8 01             	cmp    $0x1,%eax
+    13a5:	75 20                	jne    13c7 <preadtest+0x1ee>
+    13a7:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    13ab:	3c 7a                	cmp    $0x7a,%al
+    13ad:	75 18                	jne    13c7 <preadtest+0x1ee>
+    13af:	83 ec 04             	sub    $0x4,%esp
+    13b2:	6a 01                	push   $0x1
+    13b4:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    13b7:	50                   	push   %eax
+    13b8:	ff 75 f0             	push   -0x10(%ebp)
+    13bb:	e8 4f 4b 00 00       	call   5f0f <read>
+    13c0:	83 c4 10             	add    $0x10,%esp
+    13c3:	85 c0                	test   %eax,%eax
+    13c5:	74 17                	je     13de <preadtest+0x205>
+    printf(1, "pread: offset moved\n");
+    13c7:	83 ec 08             	sub    $0x8,%esp
+    13ca:	68 c1 6b 00 00       	push   $0x6bc1
+    13cf:	6a 01                	push   $0x1
+    13d1:	e8 1d 4d 00 00       	call   60f3 <printf>
+    13d6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    13d9:	e8 19 4b 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    13de:	83 ec 0c             	sub    $0xc,%esp
+    13e1:	ff 75 f0             	push   -0x10(%ebp)
+    13e4:	e8 36 4b 00 00       	call   5f1f <close>
+    13e9:	83 c4 10             	add    $0x10,%esp
+  unlink("preadfile");
+    13ec:	83 ec 0c             	sub    $0xc,%esp
+    13ef:	68 60 6b 00 00       	push   $0x6b60
+    13f4:	e8 4e 4b 00 00       	call   5f47 <unlink>
+    13f9:	83 c4 10             	add    $0x10,%esp
+  printf(1, "pread test ok\n");
+    13fc:	83 ec 08             	sub    $0x8,%esp
+    13ff:	68 d6 6b 00 00       	push   $0x6bd6
+    1404:	6a 01                	push   $0x1
+    1406:	e8 e8 4c 00 00       	call   60f3 <printf>
+    140b:	83 c4 10             	add    $0x10,%esp
+}
+    140e:	90                   	nop
+    140f:	c9                   	leave
+    1410:	c3                   	ret
+
+00001411 <sparsetest>:
+
+// lseek past the end and write leaves a hole that reads as zeros.
+void
+sparsetest(void)
+{
+    1411:	55                   	push   %ebp
+    1412:	89 e5                	mov    %esp,%ebp
+    1414:	83 ec 38             	sub    $0x38,%esp
+  int fd, i, off, fds[2];
+  struct stat st;
+
+  printf(1, "sparse test\n");
+    1417:	83 ec 08             	sub    $0x8,%esp
+    141a:	68 e5 6b 00 00       	push   $0x6be5
+    141f:	6a 01                	push   $0x1
+    1421:	e8 cd 4c 00 00       	call   60f3 <printf>
+    1426:	83 c4 10             	add    $0x10,%esp
+  fd = open("sparsefile", O_CREATE|O_RDWR);
+    1429:	83 ec 08             	sub    $0x8,%esp
+    142c:	68 02 02 00 00       	push   $0x202
+    1431:	68 f2 6b 00 00       	push   $0x6bf2
+    1436:	e8 fc 4a 00 00       	call   5f37 <open>
+    143b:	83 c4 10             	add    $0x10,%esp
+    143e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    1441:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1445:	79 17                	jns    145e <sparsetest+0x4d>
+    printf(1, "sparse: create failed\n");
+    1447:	83 ec 08             	sub    $0x8,%esp
+    144a:	68 fd 6b 00 00       	push   $0x6bfd
+    144f:	6a 01                	push   $0x1
+    1451:	e8 9d 4c 00 00       	call   60f3 <printf>
+    1456:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1459:	e8 99 4a 00 00       	call   5ef7 <exit>
+  }
+  // Past the direct blocks, so the hole includes them.
+  off = 20*512 + 7;
+    145e:	c7 45 ec 07 28 00 00 	movl   $0x2807,-0x14(%ebp)
+  if(lseek(fd, off, SEEK_SET) != off || write(fd, "end", 3) != 3 ||
+    1465:	83 ec 04             	sub    $0x4,%esp
+    1468:	6a 00                	push   $0x0
+    146a:	ff 75 ec             	push   -0x14(%ebp)
+    146d:	ff 75 f0             	push   -0x10(%ebp)
+    1470:	e8 92 4b 00 00       	call   6007 <lseek>
+    1475:	83 c4 10             	add    $0x10,%esp
+    1478:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    147b:	75 59                	jne    14d6 <sparsetest+0xc5>
+    147d:	83 ec 04             	sub    $0x4,%esp
+    1480:	6a 03                	push   $0x3
+    1482:	68 14 6c 00 00       	push   $0x6c14
+    1487:	ff 75 f0             	push   -0x10(%ebp)
+    148a:	e8 88 4a 00 00       	call   5f17 <write>
+    148f:	83 c4 10             	add    $0x10,%esp
+    1492:	83 f8 03             	cmp    $0x3,%eax
+    1495:	75 3f                	jne    14d6 <sparsetest+0xc5>
+     lseek(fd, 0, SEEK_CUR) != off+3 || fstat(fd, &st) < 0 ||
+    1497:	83 ec 04             	sub    $0x4,%esp
+    149a:	6a 01                	push   $0x1
+    149c:	6a 00                	push   $0x0
+    149e:	ff 75 f0             	push   -0x10(%ebp)
+    14a1:	e8 61 4b 00 00       	call   6007 <lseek>
+    14a6:	83 c4 10             	add    $0x10,%esp
+    14a9:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    14ac:	83 c2 03             	add    $0x3,%edx
+  if(lseek(fd, off, SEEK_SET) != off || write(fd, "end", 3) != 3 ||
+    14af:	39 d0                	cmp    %edx,%eax
+    14b1:	75 23                	jne    14d6 <sparsetest+0xc5>
+     lseek(fd, 0, SEEK_CUR) != off+3 || fstat(fd, &st) < 0 ||
+    14b3:	83 ec 08             	sub    $0x8,%esp
+    14b6:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    14b9:	50                   	push   %eax
+    14ba:	ff 75 f0             	push   -0x10(%ebp)
+    14bd:	e8 8d 4a 00 00       	call   5f4f <fstat>
+    14c2:	83 c4 10             	add    $0x10,%esp
+    14c5:	85 c0                	test   %eax,%eax
+    14c7:	78 0d                	js     14d6 <sparsetest+0xc5>
+     st.size != off+3){
+    14c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    14cc:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    14cf:	83 c2 03             	add    $0x3,%edx
+     lseek(fd, 0, SEEK_CUR) != off+3 || fstat(fd, &st) < 0 ||
+    14d2:	39 d0                	cmp    %edx,%eax
+    14d4:	74 17                	je     14ed <sparsetest+0xdc>
+    printf(1, "sparse: write past end failed\n");
+    14d6:	83 ec 08             	sub    $0x8,%esp
+    14d9:	68 18 6c 00 00       	push   $0x6c18
+    14de:	6a 01                	push   $0x1
+    14e0:	e8 0e 4c 00 00       	call   60f3 <printf>
+    14e5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    14e8:	e8 0a 4a 00 00       	call   5ef7 <exit>
+  }
+  if(lseek(fd, 0, SEEK_SET) != 0){
+    14ed:	83 ec 04             	sub    $0x4,%esp
+    14f0:	6a 00                	push   $0x0
+    14f2:	6a 00                	push   $0x0
+    14f4:	ff 75 f0             	push   -0x10(%ebp)
+    14f7:	e8 0b 4b 00 00       	call   6007 <lseek>
+    14fc:	83 c4 10             	add    $0x10,%esp
+    14ff:	85 c0                	test   %eax,%eax
+    1501:	74 17                	je     151a <sparsetest+0x109>
+    printf(1, "sparse: lseek failed\n");
+    1503:	83 ec 08             	sub    $0x8,%esp
+    1506:	68 37 6c 00 00       	push   $0x6c37
+    150b:	6a 01                	push   $0x1
+    150d:	e8 e1 4b 00 00       	call   60f3 <printf>
+    1512:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1515:	e8 dd 49 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < off; i += 512){
+    151a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1521:	eb 6a                	jmp    158d <sparsetest+0x17c>
+    memset(buf, 'x', 512);
+    1523:	83 ec 04             	sub    $0x4,%esp
+    1526:	68 00 02 00 00       	push   $0x200
+    152b:	6a 78                	push   $0x78
+    152d:	68 e0 8e 00 00       	push   $0x8ee0
+    1532:	e8 e7 47 00 00       	call   5d1e <memset>
+    1537:	83 c4 10             	add    $0x10,%esp
+    if(read(fd, buf, 512) != 512 || buf[0] != 0 || buf[511] != 0){
+    153a:	83 ec 04             	sub    $0x4,%esp
+    153d:	68 00 02 00 00       	push   $0x200
+    1542:	68 e0 8e 00 00       	push   $0x8ee0
+    1547:	ff 75 f0             	push   -0x10(%ebp)
+    154a:	e8 c0 49 00 00       	call   5f0f <read>
+    154f:	83 c4 10             	add    $0x10,%esp
+    1552:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1557:	75 16                	jne    156f <sparsetest+0x15e>
+    1559:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    1560:	84 c0                	test   %al,%al
+    1562:	75 0b                	jne    156f <sparsetest+0x15e>
+    1564:	0f b6 05 df 90 00 00 	movzbl 0x90df,%eax
+    156b:	84 c0                	test   %al,%al
+    156d:	74 17                	je     1586 <sparsetest+0x175>
+      printf(1, "sparse: hole not zero\n");
+    156f:	83 ec 08             	sub    $0x8,%esp
+    1572:	68 4d 6c 00 00       	push   $0x6c4d
+    1577:	6a 01                	push   $0x1
+    1579:	e8 75 4b 00 00       	call   60f3 <printf>
+    157e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1581:	e8 71 49 00 00       	call   5ef7 <exit>
+  for(i = 0; i < off; i += 512){
+    1586:	81 45 f4 00 02 00 00 	addl   $0x200,-0xc(%ebp)
+    158d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1590:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    1593:	7c 8e                	jl     1523 <sparsetest+0x112>
+    }
+  }
+  if(pread(fd, buf, 10, off) != 3 || buf[0] != 'e' || buf[2] != 'd' ||
+    1595:	ff 75 ec             	push   -0x14(%ebp)
+    1598:	6a 0a                	push   $0xa
+    159a:	68 e0 8e 00 00       	push   $0x8ee0
+    159f:	ff 75 f0             	push   -0x10(%ebp)
+    15a2:	e8 10 4a 00 00       	call   5fb7 <pread>
+    15a7:	83 c4 10             	add    $0x10,%esp
+    15aa:	83 f8 03             	cmp    $0x3,%eax
+    15ad:	75 79                	jne    1628 <sparsetest+0x217>
+    15af:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    15b6:	3c 65                	cmp    $0x65,%al
+    15b8:	75 6e                	jne    1628 <sparsetest+0x217>
+    15ba:	0f b6 05 e2 8e 00 00 	movzbl 0x8ee2,%eax
+    15c1:	3c 64                	cmp    $0x64,%al
+    15c3:	75 63                	jne    1628 <sparsetest+0x217>
+     lseek(fd, 100, SEEK_END) != off+103 || read(fd, buf, 1) != 0 ||
+    15c5:	83 ec 04             	sub    $0x4,%esp
+    15c8:	6a 02                	push   $0x2
+    15ca:	6a 64                	push   $0x64
+    15cc:	ff 75 f0             	push   -0x10(%ebp)
+    15cf:	e8 33 4a 00 00       	call   6007 <lseek>
+    15d4:	83 c4 10             	add    $0x10,%esp
+    15d7:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    15da:	83 c2 67             	add    $0x67,%edx
+  if(pread(fd, buf, 10, off) != 3 || buf[0] != 'e' || buf[2] != 'd' ||
+    15dd:	39 d0                	cmp    %edx,%eax
+    15df:	75 47                	jne    1628 <sparsetest+0x217>
+     lseek(fd, 100, SEEK_END) != off+103 || read(fd, buf, 1) != 0 ||
+    15e1:	83 ec 04             	sub    $0x4,%esp
+    15e4:	6a 01                	push   $0x1
+    15e6:	68 e0 8e 00 00       	push   $0x8ee0
+    15eb:	ff 75 f0             	push   -0x10(%ebp)
+    15ee:	e8 1c 49 00 00       	call   5f0f <read>
+    15f3:	83 c4 10             	add    $0x10,%esp
+    15f6:	85 c0                	test   %eax,%eax
+    15f8:	75 2e                	jne    1628 <sparsetest+0x217>
+     lseek(fd, -1, SEEK_SET) != -1 || lseek(fd, 0, 3) != -1){
+    15fa:	83 ec 04             	sub    $0x4,%esp
+    15fd:	6a 00                	push   $0x0
+    15ff:	6a ff                	push   $0xffffffff
+    1601:	ff 75 f0             	push   -0x10(%ebp)
+    1604:	e8 fe 49 00 00       	call   6007 <lseek>
+    1609:	83 c4 10             	add    $0x10,%esp
+     lseek(fd, 100, SEEK_END) != off+103 || read(fd, buf, 1) != 0 ||
+    160c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    160f:	75 17                	jne    1628 <sparsetest+0x217>
+     lseek(fd, -1, SEEK_SET) != -1 || lseek(fd, 0, 3) != -1){
+    1611:	83 ec 04             	sub    $0x4,%esp
+    1614:	6a 03                	push   $0x3
+    1616:	6a 00                	push   $0x0
+    1618:	ff 75 f0             	push   -0x10(%ebp)
+    161b:	e8 e7 49 00 00       	call   6007 <lseek>
+    1620:	83 c4 10             	add    $0x10,%esp
+    1623:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1626:	74 17                	je     163f <sparsetest+0x22e>
+    printf(1, "sparse: wrong data or offset\n");
+    1628:	83 ec 08             	sub    $0x8,%esp
+    162b:	68 64 6c 00 00       	push   $0x6c64
+    1630:	6a 01                	push   $0x1
+    1632:	e8 bc 4a 00 00       	call   60f3 <printf>
+    1637:	83 c4 10             	add    $0x10,%esp
+    exit();
+    163a:	e8 b8 48 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    163f:	83 ec 0c             	sub    $0xc,%esp
+    1642:	ff 75 f0             	push   -0x10(%ebp)
+    1645:	e8 d5 48 00 00       	call   5f1f <close>
+    164a:	83 c4 10             	add    $0x10,%esp
+  unlink("sparsefile");
+    164d:	83 ec 0c             	sub    $0xc,%esp
+    1650:	68 f2 6b 00 00       	push   $0x6bf2
+    1655:	e8 ed 48 00 00       	call   5f47 <unlink>
+    165a:	83 c4 10             	add    $0x10,%esp
+  if(pipe(fds) < 0 || lseek(fds[0], 0, SEEK_SET) != -1){
+    165d:	83 ec 0c             	sub    $0xc,%esp
+    1660:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    1663:	50                   	push   %eax
+    1664:	e8 9e 48 00 00       	call   5f07 <pipe>
+    1669:	83 c4 10             	add    $0x10,%esp
+    166c:	85 c0                	test   %eax,%eax
+    166e:	78 18                	js     1688 <sparsetest+0x277>
+    1670:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1673:	83 ec 04             	sub    $0x4,%esp
+    1676:	6a 00                	push   $0x0
+    1678:	6a 00                	push   $0x0
+    167a:	50                   	push   %eax
+    167b:	e8 87 49 00 00       	call   6007 <lseek>
+    1680:	83 c4 10             	add    $0x10,%esp
+    1683:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1686:	74 17                	je     169f <sparsetest+0x28e>
+    printf(1, "sparse: lseek on a pipe worked\n");
+    1688:	83 ec 08             	sub    $0x8,%esp
+    168b:	68 84 6c 00 00       	push   $0x6c84
+    1690:	6a 01                	push   $0x1
+    1692:	e8 5c 4a 00 00       	call   60f3 <printf>
+    1697:	83 c4 10             	add    $0x10,%esp
+    exit();
+    169a:	e8 58 48 00 00       	call   5ef7 <exit>
+  }
+  close(fds[0]);
+    169f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    16a2:	83 ec 0c             	sub    $0xc,%esp
+    16a5:	50                   	push   %eax
+    16a6:	e8 74 48 00 00       	call   5f1f <close>
+    16ab:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+    16ae:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    16b1:	83 ec 0c             	sub    $0xc,%esp
+    16b4:	50                   	push   %eax
+    16b5:	e8 65 48 00 00       	call   5f1f <close>
+    16ba:	83 c4 10             	add    $0x10,%esp
+  printf(1, "sparse test ok\n");
+    16bd:	83 ec 08             	sub    $0x8,%esp
+    16c0:	68 a4 6c 00 00       	push   $0x6ca4
+    16c5:	6a 01                	push   $0x1
+    16c7:	e8 27 4a 00 00       	call   60f3 <printf>
+    16cc:	83 c4 10             	add    $0x10,%esp
+}
+    16cf:	90                   	nop
+    16d0:	c9                   	leave
+    16d1:	c3                   	ret
+
+000016d2 <copytest>:
+
+// copyfilerange shares aligned blocks; writes to either copy
+// must not show in the other.
+void
+copytest(void)
+{
+    16d2:	55                   	push   %ebp
+    16d3:	89 e5                	mov    %esp,%ebp
+    16d5:	83 ec 18             	sub    $0x18,%esp
+  int a, b, i, n;
+
+  printf(1, "copy test\n");
+    16d8:	83 ec 08             	sub    $0x8,%esp
+    16db:	68 b4 6c 00 00       	push   $0x6cb4
+    16e0:	6a 01                	push   $0x1
+    16e2:	e8 0c 4a 00 00       	call   60f3 <printf>
+    16e7:	83 c4 10             	add    $0x10,%esp
+  a = open("copya", O_CREATE|O_RDWR);
+    16ea:	83 ec 08             	sub    $0x8,%esp
+    16ed:	68 02 02 00 00       	push   $0x202
+    16f2:	68 bf 6c 00 00       	push   $0x6cbf
+    16f7:	e8 3b 48 00 00       	call   5f37 <open>
+    16fc:	83 c4 10             	add    $0x10,%esp
+    16ff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  b = open("copyb", O_CREATE|O_RDWR);
+    1702:	83 ec 08             	sub    $0x8,%esp
+    1705:	68 02 02 00 00       	push   $0x202
+    170a:	68 c5 6c 00 00       	push   $0x6cc5
+    170f:	e8 23 48 00 00       	call   5f37 <open>
+    1714:	83 c4 10             	add    $0x10,%esp
+    1717:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(a < 0 || b < 0){
+    171a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    171e:	78 06                	js     1726 <copytest+0x54>
+    1720:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1724:	79 17                	jns    173d <copytest+0x6b>
+    printf(1, "copy: create failed\n");
+    1726:	83 ec 08             	sub    $0x8,%esp
+    1729:	68 cb 6c 00 00       	push   $0x6ccb
+    172e:	6a 01                	push   $0x1
+    1730:	e8 be 49 00 00       	call   60f3 <printf>
+    1735:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1738:	e8 ba 47 00 00       	call   5ef7 <exit>
+  }
+  // 20 blocks, past the direct ones, then a partial block.
+  for(i = 0; i < 20; i++){
+    173d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1744:	eb 56                	jmp    179c <copytest+0xca>
+    memset(buf, 'a' + i, 512);
+    1746:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1749:	83 c0 61             	add    $0x61,%eax
+    174c:	83 ec 04             	sub    $0x4,%esp
+    174f:	68 00 02 00 00       	push   $0x200
+    1754:	50                   	push   %eax
+    1755:	68 e0 8e 00 00       	push   $0x8ee0
+    175a:	e8 bf 45 00 00       	call   5d1e <memset>
+    175f:	83 c4 10             	add    $0x10,%esp
+    if(write(a, buf, 512) != 512){
+    1762:	83 ec 04             	sub    $0x4,%esp
+    1765:	68 00 02 00 00       	push   $0x200
+    176a:	68 e0 8e 00 00       	push   $0x8ee0
+    176f:	ff 75 f0             	push   -0x10(%ebp)
+    1772:	e8 a0 47 00 00       	call   5f17 <write>
+    1777:	83 c4 10             	add    $0x10,%esp
+    177a:	3d 00 02 00 00       	cmp    $0x200,%eax
+    177f:	74 17                	je     1798 <copytest+0xc6>
+      printf(1, "copy: write failed\n");
+    1781:	83 ec 08             	sub    $0x8,%esp
+    1784:	68 e0 6c 00 00       	push   $0x6ce0
+    1789:	6a 01                	push   $0x1
+    178b:	e8 63 49 00 00       	call   60f3 <printf>
+    1790:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1793:	e8 5f 47 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 20; i++){
+    1798:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    179c:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    17a0:	7e a4                	jle    1746 <copytest+0x74>
+    }
+  }
+  if(write(a, "tail", 4) != 4){
+    17a2:	83 ec 04             	sub    $0x4,%esp
+    17a5:	6a 04                	push   $0x4
+    17a7:	68 f4 6c 00 00       	push   $0x6cf4
+    17ac:	ff 75 f0             	push   -0x10(%ebp)
+    17af:	e8 63 47 00 00       	call   5f17 <write>
+    17b4:	83 c4 10             	add    $0x10,%esp
+    17b7:	83 f8 04             	cmp    $0x4,%eax
+    17ba:	74 17                	je     17d3 <copytest+0x101>
+    printf(1, "copy: write failed\n");
+    17bc:	83 ec 08             	sub    $0x8,%esp
+    17bf:	68 e0 6c 00 00       	push   $0x6ce0
+    17c4:	6a 01                	push   $0x1
+    17c6:	e8 28 49 00 00       	call   60f3 <printf>
+    17cb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    17ce:	e8 24 47 00 00       	call   5ef7 <exit>
+  }
+  n = 20*512 + 4;
+    17d3:	c7 45 e8 04 28 00 00 	movl   $0x2804,-0x18(%ebp)
+  if(copyfilerange(a, 0, b, 0, n + 100) != n){
+    17da:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    17dd:	83 c0 64             	add    $0x64,%eax
+    17e0:	83 ec 0c             	sub    $0xc,%esp
+    17e3:	50                   	push   %eax
+    17e4:	6a 00                	push   $0x0
+    17e6:	ff 75 ec             	push   -0x14(%ebp)
+    17e9:	6a 00                	push   $0x0
+    17eb:	ff 75 f0             	push   -0x10(%ebp)
+    17ee:	e8 1c 48 00 00       	call   600f <copyfilerange>
+    17f3:	83 c4 20             	add    $0x20,%esp
+    17f6:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+    17f9:	74 17                	je     1812 <copytest+0x140>
+    printf(1, "copy: copyfilerange failed\n");
+    17fb:	83 ec 08             	sub    $0x8,%esp
+    17fe:	68 f9 6c 00 00       	push   $0x6cf9
+    1803:	6a 01                	push   $0x1
+    1805:	e8 e9 48 00 00       	call   60f3 <printf>
+    180a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    180d:	e8 e5 46 00 00       	call   5ef7 <exit>
+  }
+  // Change a shared block in b, and a in a.
+  if(pwrite(b, "B", 1, 3*512 + 5) != 1 || pwrite(a, "A", 1, 15*512) != 1){
+    1812:	68 05 06 00 00       	push   $0x605
+    1817:	6a 01                	push   $0x1
+    1819:	68 15 6d 00 00       	push   $0x6d15
+    181e:	ff 75 ec             	push   -0x14(%ebp)
+    1821:	e8 d9 47 00 00       	call   5fff <pwrite>
+    1826:	83 c4 10             	add    $0x10,%esp
+    1829:	83 f8 01             	cmp    $0x1,%eax
+    182c:	75 1c                	jne    184a <copytest+0x178>
+    182e:	68 00 1e 00 00       	push   $0x1e00
+    1833:	6a 01                	push   $0x1
+    1835:	68 17 6d 00 00       	push   $0x6d17
+    183a:	ff 75 f0             	push   -0x10(%ebp)
+    183d:	e8 bd 47 00 00       	call   5fff <pwrite>
+    1842:	83 c4 10             	add    $0x10,%esp
+    1845:	83 f8 01             	cmp    $0x1,%eax
+    1848:	74 17                	je     1861 <copytest+0x18f>
+    printf(1, "copy: pwrite failed\n");
+    184a:	83 ec 08             	sub    $0x8,%esp
+    184d:	68 19 6d 00 00       	push   $0x6d19
+    1852:	6a 01                	push   $0x1
+    1854:	e8 9a 48 00 00       	call   60f3 <printf>
+    1859:	83 c4 10             	add    $0x10,%esp
+    exit();
+    185c:	e8 96 46 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < 20; i++){
+    1861:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1868:	e9 06 01 00 00       	jmp    1973 <copytest+0x2a1>
+    if(pread(b, buf, 512, i*512) != 512 || buf[0] != 'a' + i ||
+    186d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1870:	c1 e0 09             	shl    $0x9,%eax
+    1873:	50                   	push   %eax
+    1874:	68 00 02 00 00       	push   $0x200
+    1879:	68 e0 8e 00 00       	push   $0x8ee0
+    187e:	ff 75 ec             	push   -0x14(%ebp)
+    1881:	e8 31 47 00 00       	call   5fb7 <pread>
+    1886:	83 c4 10             	add    $0x10,%esp
+    1889:	3d 00 02 00 00       	cmp    $0x200,%eax
+    188e:	75 53                	jne    18e3 <copytest+0x211>
+    1890:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    1897:	0f be d0             	movsbl %al,%edx
+    189a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    189d:	83 c0 61             	add    $0x61,%eax
+    18a0:	39 c2                	cmp    %eax,%edx
+    18a2:	75 3f                	jne    18e3 <copytest+0x211>
+       buf[511] != 'a' + i || (i == 3 && buf[5] != 'B') || (i != 3 && buf[5] != 'a' + i)){
+    18a4:	0f b6 05 df 90 00 00 	movzbl 0x90df,%eax
+    18ab:	0f be d0             	movsbl %al,%edx
+    18ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18b1:	83 c0 61             	add    $0x61,%eax
+    if(pread(b, buf, 512, i*512) != 512 || buf[0] != 'a' + i ||
+    18b4:	39 c2                	cmp    %eax,%edx
+    18b6:	75 2b                	jne    18e3 <copytest+0x211>
+       buf[511] != 'a' + i || (i == 3 && buf[5] != 'B') || (i != 3 && buf[5] != 'a' + i)){
+    18b8:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+    18bc:	75 0b                	jne    18c9 <copytest+0x1f7>
+    18be:	0f b6 05 e5 8e 00 00 	movzbl 0x8ee5,%eax
+    18c5:	3c 42                	cmp    $0x42,%al
+    18c7:	75 1a                	jne    18e3 <copytest+0x211>
+    18c9:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+    18cd:	74 2e                	je     18fd <copytest+0x22b>
+    18cf:	0f b6 05 e5 8e 00 00 	movzbl 0x8ee5,%eax
+    18d6:	0f be d0             	movsbl %al,%edx
+    18d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    18dc:	83 c0 61             	add    $0x61,%eax
+    18df:	39 c2                	cmp    %eax,%edx
+    18e1:	74 1a                	je     18fd <copytest+0x22b>
+      printf(1, "copy: wrong data in copy at block %d\n", i);
+    18e3:	83 ec 04             	sub    $0x4,%esp
+    18e6:	ff 75 f4             	push   -0xc(%ebp)
+    18e9:	68 30 6d 00 00       	push   $0x6d30
+    18ee:	6a 01                	push   $0x1
+    18f0:	e8 fe 47 00 00       	call   60f3 <printf>
+    18f5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    18f8:	e8 fa 45 00 00       	call   5ef7 <exit>
+    }
+    if(pread(a, buf, 512, i*512) != 512 || buf[5] != 'a' + i ||
+    18fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1900:	c1 e0 09             	shl    $0x9,%eax
+    1903:	50                   	push   %eax
+    1904:	68 00 02 00 00       	push   $0x200
+    1909:	68 e0 8e 00 00       	push   $0x8ee0
+    190e:	ff 75 f0             	push   -0x10(%ebp)
+    1911:	e8 a1 46 00 00       	call   5fb7 <pread>
+    1916:	83 c4 10             	add    $0x10,%esp
+    1919:	3d 00 02 00 00       	cmp    $0x200,%eax
+    191e:	75 35                	jne    1955 <copytest+0x283>
+    1920:	0f b6 05 e5 8e 00 00 	movzbl 0x8ee5,%eax
+    1927:	0f be d0             	movsbl %al,%edx
+    192a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    192d:	83 c0 61             	add    $0x61,%eax
+    1930:	39 c2                	cmp    %eax,%edx
+    1932:	75 21                	jne    1955 <copytest+0x283>
+       buf[0] != (i == 15 ? 'A' : 'a' + i)){
+    1934:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    193b:	0f be c0             	movsbl %al,%eax
+    193e:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1942:	74 08                	je     194c <copytest+0x27a>
+    1944:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1947:	83 c2 61             	add    $0x61,%edx
+    194a:	eb 05                	jmp    1951 <copytest+0x27f>
+    194c:	ba 41 00 00 00       	mov    $0x41,%edx
+    if(pread(a, buf, 512, i*512) != 512 || buf[5] != 'a' + i ||
+    1951:	39 c2                	cmp    %eax,%edx
+    1953:	74 1a                	je     196f <copytest+0x29d>
+      printf(1, "copy: wrong data in original at block %d\n", i);
+    1955:	83 ec 04             	sub    $0x4,%esp
+    1958:	ff 75 f4             	push   -0xc(%ebp)
+    195b:	68 58 6d 00 00       	push   $0x6d58
+    1960:	6a 01                	push   $0x1
+    1962:	e8 8c 47 00 00       	call   60f3 <printf>
+    1967:	83 c4 10             	add    $0x10,%esp
+      exit();
+    196a:	e8 88 45 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 20; i++){
+    196f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1973:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    1977:	0f 8e f0 fe ff ff    	jle    186d <copytest+0x19b>
+    }
+  }
+  if(pread(b, buf, 10, 20*512) != 4 || buf[0] != 't' || buf[3] != 'l'){
+    197d:	68 00 28 00 00       	push   $0x2800
+    1982:	6a 0a                	push   $0xa
+    1984:	68 e0 8e 00 00       	push   $0x8ee0
+    1989:	ff 75 ec             	push   -0x14(%ebp)
+    198c:	e8 26 46 00 00       	call   5fb7 <pread>
+    1991:	83 c4 10             	add    $0x10,%esp
+    1994:	83 f8 04             	cmp    $0x4,%eax
+    1997:	75 16                	jne    19af <copytest+0x2dd>
+    1999:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    19a0:	3c 74                	cmp    $0x74,%al
+    19a2:	75 0b                	jne    19af <copytest+0x2dd>
+    19a4:	0f b6 05 e3 8e 00 00 	movzbl 0x8ee3,%eax
+    19ab:	3c 6c                	cmp    $0x6c,%al
+    19ad:	74 17                	je     19c6 <copytest+0x2f4>
+    printf(1, "copy: wrong tail\n");
+    19af:	83 ec 08             	sub    $0x8,%esp
+    19b2:	68 82 6d 00 00       	push   $0x6d82
+    19b7:	6a 01                	push   $0x1
+    19b9:	e8 35 47 00 00       	call   60f3 <printf>
+    19be:	83 c4 10             	add    $0x10,%esp
+    exit();
+    19c1:	e8 31 45 00 00       	call   5ef7 <exit>
+  }
+  // Unaligned: copied, not shared.
+  if(copyfilerange(a, 7, b, 100, 600) != 600 ||
+    19c6:	83 ec 0c             	sub    $0xc,%esp
+    19c9:	68 58 02 00 00       	push   $0x258
+    19ce:	6a 64                	push   $0x64
+    19d0:	ff 75 ec             	push   -0x14(%ebp)
+    19d3:	6a 07                	push   $0x7
+    19d5:	ff 75 f0             	push   -0x10(%ebp)
+    19d8:	e8 32 46 00 00       	call   600f <copyfilerange>
+    19dd:	83 c4 20             	add    $0x20,%esp
+    19e0:	3d 58 02 00 00       	cmp    $0x258,%eax
+    19e5:	75 4a                	jne    1a31 <copytest+0x35f>
+     pread(b, buf, 600, 100) != 600 || buf[0] != 'a' || buf[504] != 'a' ||
+    19e7:	6a 64                	push   $0x64
+    19e9:	68 58 02 00 00       	push   $0x258
+    19ee:	68 e0 8e 00 00       	push   $0x8ee0
+    19f3:	ff 75 ec             	push   -0x14(%ebp)
+    19f6:	e8 bc 45 00 00       	call   5fb7 <pread>
+    19fb:	83 c4 10             	add    $0x10,%esp
+  if(copyfilerange(a, 7, b, 100, 600) != 600 ||
+    19fe:	3d 58 02 00 00       	cmp    $0x258,%eax
+    1a03:	75 2c                	jne    1a31 <copytest+0x35f>
+     pread(b, buf, 600, 100) != 600 || buf[0] != 'a' || buf[504] != 'a' ||
+    1a05:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    1a0c:	3c 61                	cmp    $0x61,%al
+    1a0e:	75 21                	jne    1a31 <copytest+0x35f>
+    1a10:	0f b6 05 d8 90 00 00 	movzbl 0x90d8,%eax
+    1a17:	3c 61                	cmp    $0x61,%al
+    1a19:	75 16                	jne    1a31 <copytest+0x35f>
+     buf[505] != 'b' || buf[599] != 'b'){
+    1a1b:	0f b6 05 d9 90 00 00 	movzbl 0x90d9,%eax
+     pread(b, buf, 600, 100) != 600 || buf[0] != 'a' || buf[504] != 'a' ||
+    1a22:	3c 62                	cmp    $0x62,%al
+    1a24:	75 0b                	jne    1a31 <copytest+0x35f>
+     buf[505] != 'b' || buf[599] != 'b'){
+    1a26:	0f b6 05 37 91 00 00 	movzbl 0x9137,%eax
+    1a2d:	3c 62                	cmp    $0x62,%al
+    1a2f:	74 17                	je     1a48 <copytest+0x376>
+    printf(1, "copy: unaligned copy wrong\n");
+    1a31:	83 ec 08             	sub    $0x8,%esp
+    1a34:	68 94 6d 00 00       	push   $0x6d94
+    1a39:	6a 01                	push   $0x1
+    1a3b:	e8 b3 46 00 00       	call   60f3 <printf>
+    1a40:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a43:	e8 af 44 00 00       	call   5ef7 <exit>
+  }
+  // Overlapping ranges of one file are refused.
+  if(copyfilerange(a, 0, a, 512, 1024) != -1){
+    1a48:	83 ec 0c             	sub    $0xc,%esp
+    1a4b:	68 00 04 00 00       	push   $0x400
+    1a50:	68 00 02 00 00       	push   $0x200
+    1a55:	ff 75 f0             	push   -0x10(%ebp)
+    1a58:	6a 00                	push   $0x0
+    1a5a:	ff 75 f0             	push   -0x10(%ebp)
+    1a5d:	e8 ad 45 00 00       	call   600f <copyfilerange>
+    1a62:	83 c4 20             	add    $0x20,%esp
+    1a65:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1a68:	74 17                	je     1a81 <copytest+0x3af>
+    printf(1, "copy: overlapping copy worked\n");
+    1a6a:	83 ec 08             	sub    $0x8,%esp
+    1a6d:	68 b0 6d 00 00       	push   $0x6db0
+    1a72:	6a 01                	push   $0x1
+    1a74:	e8 7a 46 00 00       	call   60f3 <printf>
+    1a79:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a7c:	e8 76 44 00 00       	call   5ef7 <exit>
+  }
+  close(a);
+    1a81:	83 ec 0c             	sub    $0xc,%esp
+    1a84:	ff 75 f0             	push   -0x10(%ebp)
+    1a87:	e8 93 44 00 00       	call   5f1f <close>
+    1a8c:	83 c4 10             	add    $0x10,%esp
+  close(b);
+    1a8f:	83 ec 0c             	sub    $0xc,%esp
+    1a92:	ff 75 ec             	push   -0x14(%ebp)
+    1a95:	e8 85 44 00 00       	call   5f1f <close>
+    1a9a:	83 c4 10             	add    $0x10,%esp
+  unlink("copya");
+    1a9d:	83 ec 0c             	sub    $0xc,%esp
+    1aa0:	68 bf 6c 00 00       	push   $0x6cbf
+    1aa5:	e8 9d 44 00 00       	call   5f47 <unlink>
+    1aaa:	83 c4 10             	add    $0x10,%esp
+  unlink("copyb");
+    1aad:	83 ec 0c             	sub    $0xc,%esp
+    1ab0:	68 c5 6c 00 00       	push   $0x6cc5
+    1ab5:	e8 8d 44 00 00       	call   5f47 <unlink>
+    1aba:	83 c4 10             	add    $0x10,%esp
+  printf(1, "copy test ok\n");
+    1abd:	83 ec 08             	sub    $0x8,%esp
+    1ac0:	68 cf 6d 00 00       	push   $0x6dcf
+    1ac5:	6a 01                	push   $0x1
+    1ac7:	e8 27 46 00 00       	call   60f3 <printf>
+    1acc:	83 c4 10             	add    $0x10,%esp
+}
+    1acf:	90                   	nop
+    1ad0:	c9                   	leave
+    1ad1:	c3                   	ret
+
+00001ad2 <defragtest>:
+
+// Writing two files a block at a time interleaves their blocks;
+// defragmenting one puts its blocks back in a single run.
+void
+defragtest(void)
+{
+    1ad2:	55                   	push   %ebp
+    1ad3:	89 e5                	mov    %esp,%ebp
+    1ad5:	83 ec 28             	sub    $0x28,%esp
+  struct extents e;
+  int a, b, ro, i;
+
+  printf(1, "defrag test\n");
+    1ad8:	83 ec 08             	sub    $0x8,%esp
+    1adb:	68 dd 6d 00 00       	push   $0x6ddd
+    1ae0:	6a 01                	push   $0x1
+    1ae2:	e8 0c 46 00 00       	call   60f3 <printf>
+    1ae7:	83 c4 10             	add    $0x10,%esp
+  a = open("defraga", O_CREATE|O_RDWR);
+    1aea:	83 ec 08             	sub    $0x8,%esp
+    1aed:	68 02 02 00 00       	push   $0x202
+    1af2:	68 ea 6d 00 00       	push   $0x6dea
+    1af7:	e8 3b 44 00 00       	call   5f37 <open>
+    1afc:	83 c4 10             	add    $0x10,%esp
+    1aff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  b = open("defragb", O_CREATE|O_RDWR);
+    1b02:	83 ec 08             	sub    $0x8,%esp
+    1b05:	68 02 02 00 00       	push   $0x202
+    1b0a:	68 f2 6d 00 00       	push   $0x6df2
+    1b0f:	e8 23 44 00 00       	call   5f37 <open>
+    1b14:	83 c4 10             	add    $0x10,%esp
+    1b17:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(a < 0 || b < 0){
+    1b1a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1b1e:	78 06                	js     1b26 <defragtest+0x54>
+    1b20:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1b24:	79 17                	jns    1b3d <defragtest+0x6b>
+    printf(1, "defrag: create failed\n");
+    1b26:	83 ec 08             	sub    $0x8,%esp
+    1b29:	68 fa 6d 00 00       	push   $0x6dfa
+    1b2e:	6a 01                	push   $0x1
+    1b30:	e8 be 45 00 00       	call   60f3 <printf>
+    1b35:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b38:	e8 ba 43 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < 16; i++){
+    1b3d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1b44:	eb 75                	jmp    1bbb <defragtest+0xe9>
+    memset(buf, 'a' + i, 512);
+    1b46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b49:	83 c0 61             	add    $0x61,%eax
+    1b4c:	83 ec 04             	sub    $0x4,%esp
+    1b4f:	68 00 02 00 00       	push   $0x200
+    1b54:	50                   	push   %eax
+    1b55:	68 e0 8e 00 00       	push   $0x8ee0
+    1b5a:	e8 bf 41 00 00       	call   5d1e <memset>
+    1b5f:	83 c4 10             	add    $0x10,%esp
+    if(write(a, buf, 512) != 512 || write(b, buf, 512) != 512){
+    1b62:	83 ec 04             	sub    $0x4,%esp
+    1b65:	68 00 02 00 00       	push   $0x200
+    1b6a:	68 e0 8e 00 00       	push   $0x8ee0
+    1b6f:	ff 75 f0             	push   -0x10(%ebp)
+    1b72:	e8 a0 43 00 00       	call   5f17 <write>
+    1b77:	83 c4 10             	add    $0x10,%esp
+    1b7a:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1b7f:	75 1f                	jne    1ba0 <defragtest+0xce>
+    1b81:	83 ec 04             	sub    $0x4,%esp
+    1b84:	68 00 02 00 00       	push   $0x200
+    1b89:	68 e0 8e 00 00       	push   $0x8ee0
+    1b8e:	ff 75 ec             	push   -0x14(%ebp)
+    1b91:	e8 81 43 00 00       	call   5f17 <write>
+    1b96:	83 c4 10             	add    $0x10,%esp
+    1b99:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1b9e:	74 17                	je     1bb7 <defragtest+0xe5>
+      printf(1, "defrag: write failed\n");
+    1ba0:	83 ec 08             	sub    $0x8,%esp
+    1ba3:	68 11 6e 00 00       	push   $0x6e11
+    1ba8:	6a 01                	push   $0x1
+    1baa:	e8 44 45 00 00       	call   60f3 <printf>
+    1baf:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1bb2:	e8 40 43 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 16; i++){
+    1bb7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1bbb:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1bbf:	7e 85                	jle    1b46 <defragtest+0x74>
+    }
+  }
+  if(fsctl(a, FS_EXTENTS, &e) < 0 || e.nblocks != 17 || e.nextents < 2){
+    1bc1:	83 ec 04             	sub    $0x4,%esp
+    1bc4:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    1bc7:	50                   	push   %eax
+    1bc8:	6a 01                	push   $0x1
+    1bca:	ff 75 f0             	push   -0x10(%ebp)
+    1bcd:	e8 45 44 00 00       	call   6017 <fsctl>
+    1bd2:	83 c4 10             	add    $0x10,%esp
+    1bd5:	85 c0                	test   %eax,%eax
+    1bd7:	78 10                	js     1be9 <defragtest+0x117>
+    1bd9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1bdc:	83 f8 11             	cmp    $0x11,%eax
+    1bdf:	75 08                	jne    1be9 <defragtest+0x117>
+    1be1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1be4:	83 f8 01             	cmp    $0x1,%eax
+    1be7:	7f 17                	jg     1c00 <defragtest+0x12e>
+    printf(1, "defrag: a is not fragmented\n");
+    1be9:	83 ec 08             	sub    $0x8,%esp
+    1bec:	68 27 6e 00 00       	push   $0x6e27
+    1bf1:	6a 01                	push   $0x1
+    1bf3:	e8 fb 44 00 00       	call   60f3 <printf>
+    1bf8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1bfb:	e8 f7 42 00 00       	call   5ef7 <exit>
+  }
+  // Moving blocks needs a descriptor open for writing.
+  if((ro = open("defraga", O_RDONLY)) < 0 || fsctl(ro, FS_DEFRAG, 0) != -1 ||
+    1c00:	83 ec 08             	sub    $0x8,%esp
+    1c03:	6a 00                	push   $0x0
+    1c05:	68 ea 6d 00 00       	push   $0x6dea
+    1c0a:	e8 28 43 00 00       	call   5f37 <open>
+    1c0f:	83 c4 10             	add    $0x10,%esp
+    1c12:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    1c15:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1c19:	78 2e                	js     1c49 <defragtest+0x177>
+    1c1b:	83 ec 04             	sub    $0x4,%esp
+    1c1e:	6a 00                	push   $0x0
+    1c20:	6a 02                	push   $0x2
+    1c22:	ff 75 e8             	push   -0x18(%ebp)
+    1c25:	e8 ed 43 00 00       	call   6017 <fsctl>
+    1c2a:	83 c4 10             	add    $0x10,%esp
+    1c2d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c30:	75 17                	jne    1c49 <defragtest+0x177>
+     fsctl(ro, FS_COMPRESS, 0) != -1){
+    1c32:	83 ec 04             	sub    $0x4,%esp
+    1c35:	6a 00                	push   $0x0
+    1c37:	6a 03                	push   $0x3
+    1c39:	ff 75 e8             	push   -0x18(%ebp)
+    1c3c:	e8 d6 43 00 00       	call   6017 <fsctl>
+    1c41:	83 c4 10             	add    $0x10,%esp
+  if((ro = open("defraga", O_RDONLY)) < 0 || fsctl(ro, FS_DEFRAG, 0) != -1 ||
+    1c44:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1c47:	74 17                	je     1c60 <defragtest+0x18e>
+    printf(1, "defrag: FS_DEFRAG on a read-only fd succeeded\n");
+    1c49:	83 ec 08             	sub    $0x8,%esp
+    1c4c:	68 44 6e 00 00       	push   $0x6e44
+    1c51:	6a 01                	push   $0x1
+    1c53:	e8 9b 44 00 00       	call   60f3 <printf>
+    1c58:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1c5b:	e8 97 42 00 00       	call   5ef7 <exit>
+  }
+  close(ro);
+    1c60:	83 ec 0c             	sub    $0xc,%esp
+    1c63:	ff 75 e8             	push   -0x18(%ebp)
+    1c66:	e8 b4 42 00 00       	call   5f1f <close>
+    1c6b:	83 c4 10             	add    $0x10,%esp
+  if(fsctl(a, FS_DEFRAG, 0) != 17 || fsctl(a, FS_EXTENTS, &e) < 0 ||
+    1c6e:	83 ec 04             	sub    $0x4,%esp
+    1c71:	6a 00                	push   $0x0
+    1c73:	6a 02                	push   $0x2
+    1c75:	ff 75 f0             	push   -0x10(%ebp)
+    1c78:	e8 9a 43 00 00       	call   6017 <fsctl>
+    1c7d:	83 c4 10             	add    $0x10,%esp
+    1c80:	83 f8 11             	cmp    $0x11,%eax
+    1c83:	75 28                	jne    1cad <defragtest+0x1db>
+    1c85:	83 ec 04             	sub    $0x4,%esp
+    1c88:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    1c8b:	50                   	push   %eax
+    1c8c:	6a 01                	push   $0x1
+    1c8e:	ff 75 f0             	push   -0x10(%ebp)
+    1c91:	e8 81 43 00 00       	call   6017 <fsctl>
+    1c96:	83 c4 10             	add    $0x10,%esp
+    1c99:	85 c0                	test   %eax,%eax
+    1c9b:	78 10                	js     1cad <defragtest+0x1db>
+     e.nblocks != 17 || e.nextents != 1){
+    1c9d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  if(fsctl(a, FS_DEFRAG, 0) != 17 || fsctl(a, FS_EXTENTS, &e) < 0 ||
+    1ca0:	83 f8 11             	cmp    $0x11,%eax
+    1ca3:	75 08                	jne    1cad <defragtest+0x1db>
+     e.nblocks != 17 || e.nextents != 1){
+    1ca5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    1ca8:	83 f8 01             	cmp    $0x1,%eax
+    1cab:	74 17                	je     1cc4 <defragtest+0x1f2>
+    printf(1, "defrag: FS_DEFRAG failed\n");
+    1cad:	83 ec 08             	sub    $0x8,%esp
+    1cb0:	68 73 6e 00 00       	push   $0x6e73
+    1cb5:	6a 01                	push   $0x1
+    1cb7:	e8 37 44 00 00       	call   60f3 <printf>
+    1cbc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1cbf:	e8 33 42 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < 16; i++){
+    1cc4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1ccb:	eb 69                	jmp    1d36 <defragtest+0x264>
+    if(pread(a, buf, 512, i*512) != 512 || buf[0] != 'a' + i || buf[511] != 'a' + i){
+    1ccd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cd0:	c1 e0 09             	shl    $0x9,%eax
+    1cd3:	50                   	push   %eax
+    1cd4:	68 00 02 00 00       	push   $0x200
+    1cd9:	68 e0 8e 00 00       	push   $0x8ee0
+    1cde:	ff 75 f0             	push   -0x10(%ebp)
+    1ce1:	e8 d1 42 00 00       	call   5fb7 <pread>
+    1ce6:	83 c4 10             	add    $0x10,%esp
+    1ce9:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1cee:	75 28                	jne    1d18 <defragtest+0x246>
+    1cf0:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    1cf7:	0f be d0             	movsbl %al,%edx
+    1cfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1cfd:	83 c0 61             	add    $0x61,%eax
+    1d00:	39 c2                	cmp    %eax,%edx
+    1d02:	75 14                	jne    1d18 <defragtest+0x246>
+    1d04:	0f b6 05 df 90 00 00 	movzbl 0x90df,%eax
+    1d0b:	0f be d0             	movsbl %al,%edx
+    1d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d11:	83 c0 61             	add    $0x61,%eax
+    1d14:	39 c2                	cmp    %eax,%edx
+    1d16:	74 1a                	je     1d32 <defragtest+0x260>
+      printf(1, "defrag: wrong data at block %d\n", i);
+    1d18:	83 ec 04             	sub    $0x4,%esp
+    1d1b:	ff 75 f4             	push   -0xc(%ebp)
+    1d1e:	68 90 6e 00 00       	push   $0x6e90
+    1d23:	6a 01                	push   $0x1
+    1d25:	e8 c9 43 00 00       	call   60f3 <printf>
+    1d2a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1d2d:	e8 c5 41 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 16; i++){
+    1d32:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1d36:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+    1d3a:	7e 91                	jle    1ccd <defragtest+0x1fb>
+    }
+  }
+  close(a);
+    1d3c:	83 ec 0c             	sub    $0xc,%esp
+    1d3f:	ff 75 f0             	push   -0x10(%ebp)
+    1d42:	e8 d8 41 00 00       	call   5f1f <close>
+    1d47:	83 c4 10             	add    $0x10,%esp
+  close(b);
+    1d4a:	83 ec 0c             	sub    $0xc,%esp
+    1d4d:	ff 75 ec             	push   -0x14(%ebp)
+    1d50:	e8 ca 41 00 00       	call   5f1f <close>
+    1d55:	83 c4 10             	add    $0x10,%esp
+  unlink("defraga");
+    1d58:	83 ec 0c             	sub    $0xc,%esp
+    1d5b:	68 ea 6d 00 00       	push   $0x6dea
+    1d60:	e8 e2 41 00 00       	call   5f47 <unlink>
+    1d65:	83 c4 10             	add    $0x10,%esp
+  unlink("defragb");
+    1d68:	83 ec 0c             	sub    $0xc,%esp
+    1d6b:	68 f2 6d 00 00       	push   $0x6df2
+    1d70:	e8 d2 41 00 00       	call   5f47 <unlink>
+    1d75:	83 c4 10             	add    $0x10,%esp
+  printf(1, "defrag test ok\n");
+    1d78:	83 ec 08             	sub    $0x8,%esp
+    1d7b:	68 b0 6e 00 00       	push   $0x6eb0
+    1d80:	6a 01                	push   $0x1
+    1d82:	e8 6c 43 00 00       	call   60f3 <printf>
+    1d87:	83 c4 10             	add    $0x10,%esp
+}
+    1d8a:	90                   	nop
+    1d8b:	c9                   	leave
+    1d8c:	c3                   	ret
+
+00001d8d <compresstest>:
+
+// A compressed file reads back the same, takes fewer blocks,
+// and can still be written and copied.
+void
+compresstest(void)
+{
+    1d8d:	55                   	push   %ebp
+    1d8e:	89 e5                	mov    %esp,%ebp
+    1d90:	53                   	push   %ebx
+    1d91:	83 ec 24             	sub    $0x24,%esp
+  struct extents e;
+  int a, b, i, n;
+  char *text;
+
+  printf(1, "compress test\n");
+    1d94:	83 ec 08             	sub    $0x8,%esp
+    1d97:	68 c0 6e 00 00       	push   $0x6ec0
+    1d9c:	6a 01                	push   $0x1
+    1d9e:	e8 50 43 00 00       	call   60f3 <printf>
+    1da3:	83 c4 10             	add    $0x10,%esp
+  a = open("compressa", O_CREATE|O_RDWR);
+    1da6:	83 ec 08             	sub    $0x8,%esp
+    1da9:	68 02 02 00 00       	push   $0x202
+    1dae:	68 cf 6e 00 00       	push   $0x6ecf
+    1db3:	e8 7f 41 00 00       	call   5f37 <open>
+    1db8:	83 c4 10             	add    $0x10,%esp
+    1dbb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  b = open("compressb", O_CREATE|O_RDWR);
+    1dbe:	83 ec 08             	sub    $0x8,%esp
+    1dc1:	68 02 02 00 00       	push   $0x202
+    1dc6:	68 d9 6e 00 00       	push   $0x6ed9
+    1dcb:	e8 67 41 00 00       	call   5f37 <open>
+    1dd0:	83 c4 10             	add    $0x10,%esp
+    1dd3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(a < 0 || b < 0){
+    1dd6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1dda:	78 06                	js     1de2 <compresstest+0x55>
+    1ddc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1de0:	79 17                	jns    1df9 <compresstest+0x6c>
+    printf(1, "compress: create failed\n");
+    1de2:	83 ec 08             	sub    $0x8,%esp
+    1de5:	68 e3 6e 00 00       	push   $0x6ee3
+    1dea:	6a 01                	push   $0x1
+    1dec:	e8 02 43 00 00       	call   60f3 <printf>
+    1df1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1df4:	e8 fe 40 00 00       	call   5ef7 <exit>
+  }
+  // 14 blocks of text and a partial one: four clusters.
+  text = "compressible ";
+    1df9:	c7 45 e8 fc 6e 00 00 	movl   $0x6efc,-0x18(%ebp)
+  n = 14*512 + 3;
+    1e00:	c7 45 e4 03 1c 00 00 	movl   $0x1c03,-0x1c(%ebp)
+  for(i = 0; i < 14*512; i++)
+    1e07:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1e0e:	eb 3c                	jmp    1e4c <compresstest+0xbf>
+    buf[i] = text[i%13];
+    1e10:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1e13:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    1e18:	89 c8                	mov    %ecx,%eax
+    1e1a:	f7 ea                	imul   %edx
+    1e1c:	c1 fa 02             	sar    $0x2,%edx
+    1e1f:	89 c8                	mov    %ecx,%eax
+    1e21:	c1 f8 1f             	sar    $0x1f,%eax
+    1e24:	29 c2                	sub    %eax,%edx
+    1e26:	89 d0                	mov    %edx,%eax
+    1e28:	01 c0                	add    %eax,%eax
+    1e2a:	01 d0                	add    %edx,%eax
+    1e2c:	c1 e0 02             	shl    $0x2,%eax
+    1e2f:	01 d0                	add    %edx,%eax
+    1e31:	29 c1                	sub    %eax,%ecx
+    1e33:	89 ca                	mov    %ecx,%edx
+    1e35:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1e38:	01 d0                	add    %edx,%eax
+    1e3a:	0f b6 00             	movzbl (%eax),%eax
+    1e3d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1e40:	81 c2 e0 8e 00 00    	add    $0x8ee0,%edx
+    1e46:	88 02                	mov    %al,(%edx)
+  for(i = 0; i < 14*512; i++)
+    1e48:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1e4c:	81 7d f4 ff 1b 00 00 	cmpl   $0x1bff,-0xc(%ebp)
+    1e53:	7e bb                	jle    1e10 <compresstest+0x83>
+  if(write(a, buf, 14*512) != 14*512 || write(a, "end", 3) != 3){
+    1e55:	83 ec 04             	sub    $0x4,%esp
+    1e58:	68 00 1c 00 00       	push   $0x1c00
+    1e5d:	68 e0 8e 00 00       	push   $0x8ee0
+    1e62:	ff 75 f0             	push   -0x10(%ebp)
+    1e65:	e8 ad 40 00 00       	call   5f17 <write>
+    1e6a:	83 c4 10             	add    $0x10,%esp
+    1e6d:	3d 00 1c 00 00       	cmp    $0x1c00,%eax
+    1e72:	75 1a                	jne    1e8e <compresstest+0x101>
+    1e74:	83 ec 04             	sub    $0x4,%esp
+    1e77:	6a 03                	push   $0x3
+    1e79:	68 14 6c 00 00       	push   $0x6c14
+    1e7e:	ff 75 f0             	push   -0x10(%ebp)
+    1e81:	e8 91 40 00 00       	call   5f17 <write>
+    1e86:	83 c4 10             	add    $0x10,%esp
+    1e89:	83 f8 03             	cmp    $0x3,%eax
+    1e8c:	74 17                	je     1ea5 <compresstest+0x118>
+    printf(1, "compress: write failed\n");
+    1e8e:	83 ec 08             	sub    $0x8,%esp
+    1e91:	68 0a 6f 00 00       	push   $0x6f0a
+    1e96:	6a 01                	push   $0x1
+    1e98:	e8 56 42 00 00       	call   60f3 <printf>
+    1e9d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1ea0:	e8 52 40 00 00       	call   5ef7 <exit>
+  }
+  if(fsctl(a, FS_COMPRESS, 0) != 4 || fsctl(a, FS_EXTENTS, &e) < 0 ||
+    1ea5:	83 ec 04             	sub    $0x4,%esp
+    1ea8:	6a 00                	push   $0x0
+    1eaa:	6a 03                	push   $0x3
+    1eac:	ff 75 f0             	push   -0x10(%ebp)
+    1eaf:	e8 63 41 00 00       	call   6017 <fsctl>
+    1eb4:	83 c4 10             	add    $0x10,%esp
+    1eb7:	83 f8 04             	cmp    $0x4,%eax
+    1eba:	75 20                	jne    1edc <compresstest+0x14f>
+    1ebc:	83 ec 04             	sub    $0x4,%esp
+    1ebf:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1ec2:	50                   	push   %eax
+    1ec3:	6a 01                	push   $0x1
+    1ec5:	ff 75 f0             	push   -0x10(%ebp)
+    1ec8:	e8 4a 41 00 00       	call   6017 <fsctl>
+    1ecd:	83 c4 10             	add    $0x10,%esp
+    1ed0:	85 c0                	test   %eax,%eax
+    1ed2:	78 08                	js     1edc <compresstest+0x14f>
+     e.nblocks >= 16){
+    1ed4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  if(fsctl(a, FS_COMPRESS, 0) != 4 || fsctl(a, FS_EXTENTS, &e) < 0 ||
+    1ed7:	83 f8 0f             	cmp    $0xf,%eax
+    1eda:	7e 17                	jle    1ef3 <compresstest+0x166>
+    printf(1, "compress: FS_COMPRESS failed\n");
+    1edc:	83 ec 08             	sub    $0x8,%esp
+    1edf:	68 22 6f 00 00       	push   $0x6f22
+    1ee4:	6a 01                	push   $0x1
+    1ee6:	e8 08 42 00 00       	call   60f3 <printf>
+    1eeb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1eee:	e8 04 40 00 00       	call   5ef7 <exit>
+  }
+  memset(buf, 0, sizeof(buf));
+    1ef3:	83 ec 04             	sub    $0x4,%esp
+    1ef6:	68 00 20 00 00       	push   $0x2000
+    1efb:	6a 00                	push   $0x0
+    1efd:	68 e0 8e 00 00       	push   $0x8ee0
+    1f02:	e8 17 3e 00 00       	call   5d1e <memset>
+    1f07:	83 c4 10             	add    $0x10,%esp
+  if(pread(a, buf, sizeof(buf), 0) != n || buf[n-3] != 'e' || buf[n-1] != 'd'){
+    1f0a:	6a 00                	push   $0x0
+    1f0c:	68 00 20 00 00       	push   $0x2000
+    1f11:	68 e0 8e 00 00       	push   $0x8ee0
+    1f16:	ff 75 f0             	push   -0x10(%ebp)
+    1f19:	e8 99 40 00 00       	call   5fb7 <pread>
+    1f1e:	83 c4 10             	add    $0x10,%esp
+    1f21:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    1f24:	75 22                	jne    1f48 <compresstest+0x1bb>
+    1f26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1f29:	83 e8 03             	sub    $0x3,%eax
+    1f2c:	0f b6 80 e0 8e 00 00 	movzbl 0x8ee0(%eax),%eax
+    1f33:	3c 65                	cmp    $0x65,%al
+    1f35:	75 11                	jne    1f48 <compresstest+0x1bb>
+    1f37:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1f3a:	83 e8 01             	sub    $0x1,%eax
+    1f3d:	0f b6 80 e0 8e 00 00 	movzbl 0x8ee0(%eax),%eax
+    1f44:	3c 64                	cmp    $0x64,%al
+    1f46:	74 17                	je     1f5f <compresstest+0x1d2>
+    printf(1, "compress: wrong data\n");
+    1f48:	83 ec 08             	sub    $0x8,%esp
+    1f4b:	68 40 6f 00 00       	push   $0x6f40
+    1f50:	6a 01                	push   $0x1
+    1f52:	e8 9c 41 00 00       	call   60f3 <printf>
+    1f57:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1f5a:	e8 98 3f 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < 14*512; i++){
+    1f5f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1f66:	eb 5a                	jmp    1fc2 <compresstest+0x235>
+    if(buf[i] != text[i%13]){
+    1f68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f6b:	05 e0 8e 00 00       	add    $0x8ee0,%eax
+    1f70:	0f b6 18             	movzbl (%eax),%ebx
+    1f73:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1f76:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    1f7b:	89 c8                	mov    %ecx,%eax
+    1f7d:	f7 ea                	imul   %edx
+    1f7f:	c1 fa 02             	sar    $0x2,%edx
+    1f82:	89 c8                	mov    %ecx,%eax
+    1f84:	c1 f8 1f             	sar    $0x1f,%eax
+    1f87:	29 c2                	sub    %eax,%edx
+    1f89:	89 d0                	mov    %edx,%eax
+    1f8b:	01 c0                	add    %eax,%eax
+    1f8d:	01 d0                	add    %edx,%eax
+    1f8f:	c1 e0 02             	shl    $0x2,%eax
+    1f92:	01 d0                	add    %edx,%eax
+    1f94:	29 c1                	sub    %eax,%ecx
+    1f96:	89 ca                	mov    %ecx,%edx
+    1f98:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1f9b:	01 d0                	add    %edx,%eax
+    1f9d:	0f b6 00             	movzbl (%eax),%eax
+    1fa0:	38 c3                	cmp    %al,%bl
+    1fa2:	74 1a                	je     1fbe <compresstest+0x231>
+      printf(1, "compress: wrong data at %d\n", i);
+    1fa4:	83 ec 04             	sub    $0x4,%esp
+    1fa7:	ff 75 f4             	push   -0xc(%ebp)
+    1faa:	68 56 6f 00 00       	push   $0x6f56
+    1faf:	6a 01                	push   $0x1
+    1fb1:	e8 3d 41 00 00       	call   60f3 <printf>
+    1fb6:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1fb9:	e8 39 3f 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 14*512; i++){
+    1fbe:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1fc2:	81 7d f4 ff 1b 00 00 	cmpl   $0x1bff,-0xc(%ebp)
+    1fc9:	7e 9d                	jle    1f68 <compresstest+0x1db>
+    }
+  }
+  // Write into the middle of a compressed cluster, and copy.
+  if(pwrite(a, "X", 1, 5*512 + 3) != 1 || copyfilerange(a, 0, b, 0, n) != n){
+    1fcb:	68 03 0a 00 00       	push   $0xa03
+    1fd0:	6a 01                	push   $0x1
+    1fd2:	68 72 6f 00 00       	push   $0x6f72
+    1fd7:	ff 75 f0             	push   -0x10(%ebp)
+    1fda:	e8 20 40 00 00       	call   5fff <pwrite>
+    1fdf:	83 c4 10             	add    $0x10,%esp
+    1fe2:	83 f8 01             	cmp    $0x1,%eax
+    1fe5:	75 1d                	jne    2004 <compresstest+0x277>
+    1fe7:	83 ec 0c             	sub    $0xc,%esp
+    1fea:	ff 75 e4             	push   -0x1c(%ebp)
+    1fed:	6a 00                	push   $0x0
+    1fef:	ff 75 ec             	push   -0x14(%ebp)
+    1ff2:	6a 00                	push   $0x0
+    1ff4:	ff 75 f0             	push   -0x10(%ebp)
+    1ff7:	e8 13 40 00 00       	call   600f <copyfilerange>
+    1ffc:	83 c4 20             	add    $0x20,%esp
+    1fff:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    2002:	74 17                	je     201b <compresstest+0x28e>
+    printf(1, "compress: pwrite or copyfilerange failed\n");
+    2004:	83 ec 08             	sub    $0x8,%esp
+    2007:	68 74 6f 00 00       	push   $0x6f74
+    200c:	6a 01                	push   $0x1
+    200e:	e8 e0 40 00 00       	call   60f3 <printf>
+    2013:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2016:	e8 dc 3e 00 00       	call   5ef7 <exit>
+  }
+  memset(buf, 0, sizeof(buf));
+    201b:	83 ec 04             	sub    $0x4,%esp
+    201e:	68 00 20 00 00       	push   $0x2000
+    2023:	6a 00                	push   $0x0
+    2025:	68 e0 8e 00 00       	push   $0x8ee0
+    202a:	e8 ef 3c 00 00       	call   5d1e <memset>
+    202f:	83 c4 10             	add    $0x10,%esp
+  if(pread(b, buf, sizeof(buf), 0) != n || buf[n-1] != 'd'){
+    2032:	6a 00                	push   $0x0
+    2034:	68 00 20 00 00       	push   $0x2000
+    2039:	68 e0 8e 00 00       	push   $0x8ee0
+    203e:	ff 75 ec             	push   -0x14(%ebp)
+    2041:	e8 71 3f 00 00       	call   5fb7 <pread>
+    2046:	83 c4 10             	add    $0x10,%esp
+    2049:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    204c:	75 11                	jne    205f <compresstest+0x2d2>
+    204e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2051:	83 e8 01             	sub    $0x1,%eax
+    2054:	0f b6 80 e0 8e 00 00 	movzbl 0x8ee0(%eax),%eax
+    205b:	3c 64                	cmp    $0x64,%al
+    205d:	74 17                	je     2076 <compresstest+0x2e9>
+    printf(1, "compress: wrong data in copy\n");
+    205f:	83 ec 08             	sub    $0x8,%esp
+    2062:	68 9e 6f 00 00       	push   $0x6f9e
+    2067:	6a 01                	push   $0x1
+    2069:	e8 85 40 00 00       	call   60f3 <printf>
+    206e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2071:	e8 81 3e 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < 14*512; i++){
+    2076:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    207d:	eb 70                	jmp    20ef <compresstest+0x362>
+    if(buf[i] != (i == 5*512 + 3 ? 'X' : text[i%13])){
+    207f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2082:	05 e0 8e 00 00       	add    $0x8ee0,%eax
+    2087:	0f b6 00             	movzbl (%eax),%eax
+    208a:	0f be d8             	movsbl %al,%ebx
+    208d:	81 7d f4 03 0a 00 00 	cmpl   $0xa03,-0xc(%ebp)
+    2094:	74 32                	je     20c8 <compresstest+0x33b>
+    2096:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    2099:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    209e:	89 c8                	mov    %ecx,%eax
+    20a0:	f7 ea                	imul   %edx
+    20a2:	c1 fa 02             	sar    $0x2,%edx
+    20a5:	89 c8                	mov    %ecx,%eax
+    20a7:	c1 f8 1f             	sar    $0x1f,%eax
+    20aa:	29 c2                	sub    %eax,%edx
+    20ac:	89 d0                	mov    %edx,%eax
+    20ae:	01 c0                	add    %eax,%eax
+    20b0:	01 d0                	add    %edx,%eax
+    20b2:	c1 e0 02             	shl    $0x2,%eax
+    20b5:	01 d0                	add    %edx,%eax
+    20b7:	29 c1                	sub    %eax,%ecx
+    20b9:	89 ca                	mov    %ecx,%edx
+    20bb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    20be:	01 d0                	add    %edx,%eax
+    20c0:	0f b6 00             	movzbl (%eax),%eax
+    20c3:	0f be c0             	movsbl %al,%eax
+    20c6:	eb 05                	jmp    20cd <compresstest+0x340>
+    20c8:	b8 58 00 00 00       	mov    $0x58,%eax
+    20cd:	39 d8                	cmp    %ebx,%eax
+    20cf:	74 1a                	je     20eb <compresstest+0x35e>
+      printf(1, "compress: wrong data in copy at %d\n", i);
+    20d1:	83 ec 04             	sub    $0x4,%esp
+    20d4:	ff 75 f4             	push   -0xc(%ebp)
+    20d7:	68 bc 6f 00 00       	push   $0x6fbc
+    20dc:	6a 01                	push   $0x1
+    20de:	e8 10 40 00 00       	call   60f3 <printf>
+    20e3:	83 c4 10             	add    $0x10,%esp
+      exit();
+    20e6:	e8 0c 3e 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 14*512; i++){
+    20eb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    20ef:	81 7d f4 ff 1b 00 00 	cmpl   $0x1bff,-0xc(%ebp)
+    20f6:	7e 87                	jle    207f <compresstest+0x2f2>
+    }
+  }
+  close(a);
+    20f8:	83 ec 0c             	sub    $0xc,%esp
+    20fb:	ff 75 f0             	push   -0x10(%ebp)
+    20fe:	e8 1c 3e 00 00       	call   5f1f <close>
+    2103:	83 c4 10             	add    $0x10,%esp
+  close(b);
+    2106:	83 ec 0c             	sub    $0xc,%esp
+    2109:	ff 75 ec             	push   -0x14(%ebp)
+    210c:	e8 0e 3e 00 00       	call   5f1f <close>
+    2111:	83 c4 10             	add    $0x10,%esp
+  unlink("compressa");
+    2114:	83 ec 0c             	sub    $0xc,%esp
+    2117:	68 cf 6e 00 00       	push   $0x6ecf
+    211c:	e8 26 3e 00 00       	call   5f47 <unlink>
+    2121:	83 c4 10             	add    $0x10,%esp
+  unlink("compressb");
+    2124:	83 ec 0c             	sub    $0xc,%esp
+    2127:	68 d9 6e 00 00       	push   $0x6ed9
+    212c:	e8 16 3e 00 00       	call   5f47 <unlink>
+    2131:	83 c4 10             	add    $0x10,%esp
+  printf(1, "compress test ok\n");
+    2134:	83 ec 08             	sub    $0x8,%esp
+    2137:	68 e0 6f 00 00       	push   $0x6fe0
+    213c:	6a 01                	push   $0x1
+    213e:	e8 b0 3f 00 00       	call   60f3 <printf>
+    2143:	83 c4 10             	add    $0x10,%esp
+}
+    2146:	90                   	nop
+    2147:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    214a:	c9                   	leave
+    214b:	c3                   	ret
+
+0000214c <fdtabletest>:
+
+// A process can have more than NOFILE descriptors, is always
+// given the lowest free one, and passes them all on in fork().
+void
+fdtabletest(void)
+{
+    214c:	55                   	push   %ebp
+    214d:	89 e5                	mov    %esp,%ebp
+    214f:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+  int fd, fds[40], i, pid;
+  char c;
+
+  printf(1, "fd table test\n");
+    2155:	83 ec 08             	sub    $0x8,%esp
+    2158:	68 f2 6f 00 00       	push   $0x6ff2
+    215d:	6a 01                	push   $0x1
+    215f:	e8 8f 3f 00 00       	call   60f3 <printf>
+    2164:	83 c4 10             	add    $0x10,%esp
+  fd = open("fdtable", O_CREATE|O_RDWR);
+    2167:	83 ec 08             	sub    $0x8,%esp
+    216a:	68 02 02 00 00       	push   $0x202
+    216f:	68 01 70 00 00       	push   $0x7001
+    2174:	e8 be 3d 00 00       	call   5f37 <open>
+    2179:	83 c4 10             	add    $0x10,%esp
+    217c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0 || write(fd, "x", 1) != 1){
+    217f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2183:	78 1a                	js     219f <fdtabletest+0x53>
+    2185:	83 ec 04             	sub    $0x4,%esp
+    2188:	6a 01                	push   $0x1
+    218a:	68 bb 69 00 00       	push   $0x69bb
+    218f:	ff 75 f0             	push   -0x10(%ebp)
+    2192:	e8 80 3d 00 00       	call   5f17 <write>
+    2197:	83 c4 10             	add    $0x10,%esp
+    219a:	83 f8 01             	cmp    $0x1,%eax
+    219d:	74 17                	je     21b6 <fdtabletest+0x6a>
+    printf(1, "fdtable: create failed\n");
+    219f:	83 ec 08             	sub    $0x8,%esp
+    21a2:	68 09 70 00 00       	push   $0x7009
+    21a7:	6a 01                	push   $0x1
+    21a9:	e8 45 3f 00 00       	call   60f3 <printf>
+    21ae:	83 c4 10             	add    $0x10,%esp
+    exit();
+    21b1:	e8 41 3d 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < 40; i++){
+    21b6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    21bd:	eb 44                	jmp    2203 <fdtabletest+0xb7>
+    if((fds[i] = dup(fd)) < 0){
+    21bf:	83 ec 0c             	sub    $0xc,%esp
+    21c2:	ff 75 f0             	push   -0x10(%ebp)
+    21c5:	e8 a5 3d 00 00       	call   5f6f <dup>
+    21ca:	83 c4 10             	add    $0x10,%esp
+    21cd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    21d0:	89 84 95 4c ff ff ff 	mov    %eax,-0xb4(%ebp,%edx,4)
+    21d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    21da:	8b 84 85 4c ff ff ff 	mov    -0xb4(%ebp,%eax,4),%eax
+    21e1:	85 c0                	test   %eax,%eax
+    21e3:	79 1a                	jns    21ff <fdtabletest+0xb3>
+      printf(1, "fdtable: dup %d failed\n", i);
+    21e5:	83 ec 04             	sub    $0x4,%esp
+    21e8:	ff 75 f4             	push   -0xc(%ebp)
+    21eb:	68 21 70 00 00       	push   $0x7021
+    21f0:	6a 01                	push   $0x1
+    21f2:	e8 fc 3e 00 00       	call   60f3 <printf>
+    21f7:	83 c4 10             	add    $0x10,%esp
+      exit();
+    21fa:	e8 f8 3c 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 40; i++){
+    21ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2203:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    2207:	7e b6                	jle    21bf <fdtabletest+0x73>
+    }
+  }
+  close(fds[5]);
+    2209:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+    220f:	83 ec 0c             	sub    $0xc,%esp
+    2212:	50                   	push   %eax
+    2213:	e8 07 3d 00 00       	call   5f1f <close>
+    2218:	83 c4 10             	add    $0x10,%esp
+  close(fds[30]);
+    221b:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    221e:	83 ec 0c             	sub    $0xc,%esp
+    2221:	50                   	push   %eax
+    2222:	e8 f8 3c 00 00       	call   5f1f <close>
+    2227:	83 c4 10             	add    $0x10,%esp
+  if(dup(fd) != fds[5] || dup(fd) != fds[30]){
+    222a:	83 ec 0c             	sub    $0xc,%esp
+    222d:	ff 75 f0             	push   -0x10(%ebp)
+    2230:	e8 3a 3d 00 00       	call   5f6f <dup>
+    2235:	83 c4 10             	add    $0x10,%esp
+    2238:	89 c2                	mov    %eax,%edx
+    223a:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+    2240:	39 c2                	cmp    %eax,%edx
+    2242:	75 17                	jne    225b <fdtabletest+0x10f>
+    2244:	83 ec 0c             	sub    $0xc,%esp
+    2247:	ff 75 f0             	push   -0x10(%ebp)
+    224a:	e8 20 3d 00 00       	call   5f6f <dup>
+    224f:	83 c4 10             	add    $0x10,%esp
+    2252:	89 c2                	mov    %eax,%edx
+    2254:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    2257:	39 c2                	cmp    %eax,%edx
+    2259:	74 17                	je     2272 <fdtabletest+0x126>
+    printf(1, "fdtable: not the lowest free descriptor\n");
+    225b:	83 ec 08             	sub    $0x8,%esp
+    225e:	68 3c 70 00 00       	push   $0x703c
+    2263:	6a 01                	push   $0x1
+    2265:	e8 89 3e 00 00       	call   60f3 <printf>
+    226a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    226d:	e8 85 3c 00 00       	call   5ef7 <exit>
+  }
+  pid = fork();
+    2272:	e8 78 3c 00 00       	call   5eef <fork>
+    2277:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    227a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    227e:	79 17                	jns    2297 <fdtabletest+0x14b>
+    printf(1, "fdtable: fork failed\n");
+    2280:	83 ec 08             	sub    $0x8,%esp
+    2283:	68 65 70 00 00       	push   $0x7065
+    2288:	6a 01                	push   $0x1
+    228a:	e8 64 3e 00 00       	call   60f3 <printf>
+    228f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2292:	e8 60 3c 00 00       	call   5ef7 <exit>
+  }
+  if(pid == 0){
+    2297:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    229b:	75 6c                	jne    2309 <fdtabletest+0x1bd>
+    if(pread(fds[39], &c, 1, 0) != 1 || c != 'x'){
+    229d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    22a0:	6a 00                	push   $0x0
+    22a2:	6a 01                	push   $0x1
+    22a4:	8d 95 4b ff ff ff    	lea    -0xb5(%ebp),%edx
+    22aa:	52                   	push   %edx
+    22ab:	50                   	push   %eax
+    22ac:	e8 06 3d 00 00       	call   5fb7 <pread>
+    22b1:	83 c4 10             	add    $0x10,%esp
+    22b4:	83 f8 01             	cmp    $0x1,%eax
+    22b7:	75 0b                	jne    22c4 <fdtabletest+0x178>
+    22b9:	0f b6 85 4b ff ff ff 	movzbl -0xb5(%ebp),%eax
+    22c0:	3c 78                	cmp    $0x78,%al
+    22c2:	74 17                	je     22db <fdtabletest+0x18f>
+      printf(1, "fdtable: descriptor lost in fork\n");
+    22c4:	83 ec 08             	sub    $0x8,%esp
+    22c7:	68 7c 70 00 00       	push   $0x707c
+    22cc:	6a 01                	push   $0x1
+    22ce:	e8 20 3e 00 00       	call   60f3 <printf>
+    22d3:	83 c4 10             	add    $0x10,%esp
+      exit();
+    22d6:	e8 1c 3c 00 00       	call   5ef7 <exit>
+    }
+    for(i = 0; i < 40; i++)
+    22db:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    22e2:	eb 1a                	jmp    22fe <fdtabletest+0x1b2>
+      close(fds[i]);
+    22e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    22e7:	8b 84 85 4c ff ff ff 	mov    -0xb4(%ebp,%eax,4),%eax
+    22ee:	83 ec 0c             	sub    $0xc,%esp
+    22f1:	50                   	push   %eax
+    22f2:	e8 28 3c 00 00       	call   5f1f <close>
+    22f7:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 40; i++)
+    22fa:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    22fe:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    2302:	7e e0                	jle    22e4 <fdtabletest+0x198>
+    exit();
+    2304:	e8 ee 3b 00 00       	call   5ef7 <exit>
+  }
+  wait();
+    2309:	e8 f1 3b 00 00       	call   5eff <wait>
+  for(i = 0; i < 40; i++)
+    230e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2315:	eb 1a                	jmp    2331 <fdtabletest+0x1e5>
+    close(fds[i]);
+    2317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    231a:	8b 84 85 4c ff ff ff 	mov    -0xb4(%ebp,%eax,4),%eax
+    2321:	83 ec 0c             	sub    $0xc,%esp
+    2324:	50                   	push   %eax
+    2325:	e8 f5 3b 00 00       	call   5f1f <close>
+    232a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 40; i++)
+    232d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2331:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    2335:	7e e0                	jle    2317 <fdtabletest+0x1cb>
+  close(fd);
+    2337:	83 ec 0c             	sub    $0xc,%esp
+    233a:	ff 75 f0             	push   -0x10(%ebp)
+    233d:	e8 dd 3b 00 00       	call   5f1f <close>
+    2342:	83 c4 10             	add    $0x10,%esp
+  unlink("fdtable");
+    2345:	83 ec 0c             	sub    $0xc,%esp
+    2348:	68 01 70 00 00       	push   $0x7001
+    234d:	e8 f5 3b 00 00       	call   5f47 <unlink>
+    2352:	83 c4 10             	add    $0x10,%esp
+  printf(1, "fd table test ok\n");
+    2355:	83 ec 08             	sub    $0x8,%esp
+    2358:	68 9e 70 00 00       	push   $0x709e
+    235d:	6a 01                	push   $0x1
+    235f:	e8 8f 3d 00 00       	call   60f3 <printf>
+    2364:	83 c4 10             	add    $0x10,%esp
+}
+    2367:	90                   	nop
+    2368:	c9                   	leave
+    2369:	c3                   	ret
+
+0000236a <attest>:
+
+// *at() calls resolve relative paths from a directory fd.
+void
+attest(void)
+{
+    236a:	55                   	push   %ebp
+    236b:	89 e5                	mov    %esp,%ebp
+    236d:	83 ec 28             	sub    $0x28,%esp
+  int dfd, fd;
+  struct stat st;
+
+  printf(1, "at test\n");
+    2370:	83 ec 08             	sub    $0x8,%esp
+    2373:	68 b0 70 00 00       	push   $0x70b0
+    2378:	6a 01                	push   $0x1
+    237a:	e8 74 3d 00 00       	call   60f3 <printf>
+    237f:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("atdir") < 0 || (dfd = open("atdir", O_RDONLY)) < 0){
+    2382:	83 ec 0c             	sub    $0xc,%esp
+    2385:	68 b9 70 00 00       	push   $0x70b9
+    238a:	e8 d0 3b 00 00       	call   5f5f <mkdir>
+    238f:	83 c4 10             	add    $0x10,%esp
+    2392:	85 c0                	test   %eax,%eax
+    2394:	78 1b                	js     23b1 <attest+0x47>
+    2396:	83 ec 08             	sub    $0x8,%esp
+    2399:	6a 00                	push   $0x0
+    239b:	68 b9 70 00 00       	push   $0x70b9
+    23a0:	e8 92 3b 00 00       	call   5f37 <open>
+    23a5:	83 c4 10             	add    $0x10,%esp
+    23a8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    23ab:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    23af:	79 17                	jns    23c8 <attest+0x5e>
+    printf(1, "at: mkdir/open atdir failed\n");
+    23b1:	83 ec 08             	sub    $0x8,%esp
+    23b4:	68 bf 70 00 00       	push   $0x70bf
+    23b9:	6a 01                	push   $0x1
+    23bb:	e8 33 3d 00 00       	call   60f3 <printf>
+    23c0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    23c3:	e8 2f 3b 00 00       	call   5ef7 <exit>
+  }
+  if(mkdirat(dfd, "sub") < 0 ||
+    23c8:	83 ec 08             	sub    $0x8,%esp
+    23cb:	68 dc 70 00 00       	push   $0x70dc
+    23d0:	ff 75 f4             	push   -0xc(%ebp)
+    23d3:	e8 07 3c 00 00       	call   5fdf <mkdirat>
+    23d8:	83 c4 10             	add    $0x10,%esp
+    23db:	85 c0                	test   %eax,%eax
+    23dd:	78 3b                	js     241a <attest+0xb0>
+     (fd = openat(dfd, "sub/f", O_CREATE|O_RDWR)) < 0 ||
+    23df:	83 ec 04             	sub    $0x4,%esp
+    23e2:	68 02 02 00 00       	push   $0x202
+    23e7:	68 e0 70 00 00       	push   $0x70e0
+    23ec:	ff 75 f4             	push   -0xc(%ebp)
+    23ef:	e8 db 3b 00 00       	call   5fcf <openat>
+    23f4:	83 c4 10             	add    $0x10,%esp
+    23f7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(mkdirat(dfd, "sub") < 0 ||
+    23fa:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    23fe:	78 1a                	js     241a <attest+0xb0>
+     write(fd, "hi", 2) != 2){
+    2400:	83 ec 04             	sub    $0x4,%esp
+    2403:	6a 02                	push   $0x2
+    2405:	68 e6 70 00 00       	push   $0x70e6
+    240a:	ff 75 f0             	push   -0x10(%ebp)
+    240d:	e8 05 3b 00 00       	call   5f17 <write>
+    2412:	83 c4 10             	add    $0x10,%esp
+     (fd = openat(dfd, "sub/f", O_CREATE|O_RDWR)) < 0 ||
+    2415:	83 f8 02             	cmp    $0x2,%eax
+    2418:	74 17                	je     2431 <attest+0xc7>
+    printf(1, "at: create failed\n");
+    241a:	83 ec 08             	sub    $0x8,%esp
+    241d:	68 e9 70 00 00       	push   $0x70e9
+    2422:	6a 01                	push   $0x1
+    2424:	e8 ca 3c 00 00       	call   60f3 <printf>
+    2429:	83 c4 10             	add    $0x10,%esp
+    exit();
+    242c:	e8 c6 3a 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    2431:	83 ec 0c             	sub    $0xc,%esp
+    2434:	ff 75 f0             	push   -0x10(%ebp)
+    2437:	e8 e3 3a 00 00       	call   5f1f <close>
+    243c:	83 c4 10             	add    $0x10,%esp
+  if(linkat(dfd, "sub/f", AT_FDCWD, "atlink") < 0 ||
+    243f:	68 fc 70 00 00       	push   $0x70fc
+    2444:	6a 9c                	push   $0xffffff9c
+    2446:	68 e0 70 00 00       	push   $0x70e0
+    244b:	ff 75 f4             	push   -0xc(%ebp)
+    244e:	e8 94 3b 00 00       	call   5fe7 <linkat>
+    2453:	83 c4 10             	add    $0x10,%esp
+    2456:	85 c0                	test   %eax,%eax
+    2458:	78 47                	js     24a1 <attest+0x137>
+     fstatat(AT_FDCWD, "atdir/sub/f", &st) < 0 || st.nlink != 2 ||
+    245a:	83 ec 04             	sub    $0x4,%esp
+    245d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    2460:	50                   	push   %eax
+    2461:	68 03 71 00 00       	push   $0x7103
+    2466:	6a 9c                	push   $0xffffff9c
+    2468:	e8 5a 3b 00 00       	call   5fc7 <fstatat>
+    246d:	83 c4 10             	add    $0x10,%esp
+  if(linkat(dfd, "sub/f", AT_FDCWD, "atlink") < 0 ||
+    2470:	85 c0                	test   %eax,%eax
+    2472:	78 2d                	js     24a1 <attest+0x137>
+     fstatat(AT_FDCWD, "atdir/sub/f", &st) < 0 || st.nlink != 2 ||
+    2474:	0f b7 45 e8          	movzwl -0x18(%ebp),%eax
+    2478:	66 83 f8 02          	cmp    $0x2,%ax
+    247c:	75 23                	jne    24a1 <attest+0x137>
+     fstatat(dfd, "../atlink", &st) < 0 || st.size != 2){
+    247e:	83 ec 04             	sub    $0x4,%esp
+    2481:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    2484:	50                   	push   %eax
+    2485:	68 0f 71 00 00       	push   $0x710f
+    248a:	ff 75 f4             	push   -0xc(%ebp)
+    248d:	e8 35 3b 00 00       	call   5fc7 <fstatat>
+    2492:	83 c4 10             	add    $0x10,%esp
+     fstatat(AT_FDCWD, "atdir/sub/f", &st) < 0 || st.nlink != 2 ||
+    2495:	85 c0                	test   %eax,%eax
+    2497:	78 08                	js     24a1 <attest+0x137>
+     fstatat(dfd, "../atlink", &st) < 0 || st.size != 2){
+    2499:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    249c:	83 f8 02             	cmp    $0x2,%eax
+    249f:	74 17                	je     24b8 <attest+0x14e>
+    printf(1, "at: link failed\n");
+    24a1:	83 ec 08             	sub    $0x8,%esp
+    24a4:	68 19 71 00 00       	push   $0x7119
+    24a9:	6a 01                	push   $0x1
+    24ab:	e8 43 3c 00 00       	call   60f3 <printf>
+    24b0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24b3:	e8 3f 3a 00 00       	call   5ef7 <exit>
+  }
+  if(unlinkat(dfd, "sub") == 0 ||
+    24b8:	83 ec 08             	sub    $0x8,%esp
+    24bb:	68 dc 70 00 00       	push   $0x70dc
+    24c0:	ff 75 f4             	push   -0xc(%ebp)
+    24c3:	e8 0f 3b 00 00       	call   5fd7 <unlinkat>
+    24c8:	83 c4 10             	add    $0x10,%esp
+    24cb:	85 c0                	test   %eax,%eax
+    24cd:	74 47                	je     2516 <attest+0x1ac>
+     unlinkat(dfd, "sub/f") < 0 || unlinkat(dfd, "sub") < 0 ||
+    24cf:	83 ec 08             	sub    $0x8,%esp
+    24d2:	68 e0 70 00 00       	push   $0x70e0
+    24d7:	ff 75 f4             	push   -0xc(%ebp)
+    24da:	e8 f8 3a 00 00       	call   5fd7 <unlinkat>
+    24df:	83 c4 10             	add    $0x10,%esp
+  if(unlinkat(dfd, "sub") == 0 ||
+    24e2:	85 c0                	test   %eax,%eax
+    24e4:	78 30                	js     2516 <attest+0x1ac>
+     unlinkat(dfd, "sub/f") < 0 || unlinkat(dfd, "sub") < 0 ||
+    24e6:	83 ec 08             	sub    $0x8,%esp
+    24e9:	68 dc 70 00 00       	push   $0x70dc
+    24ee:	ff 75 f4             	push   -0xc(%ebp)
+    24f1:	e8 e1 3a 00 00       	call   5fd7 <unlinkat>
+    24f6:	83 c4 10             	add    $0x10,%esp
+    24f9:	85 c0                	test   %eax,%eax
+    24fb:	78 19                	js     2516 <attest+0x1ac>
+     openat(dfd, "sub/f", O_RDONLY) >= 0){
+    24fd:	83 ec 04             	sub    $0x4,%esp
+    2500:	6a 00                	push   $0x0
+    2502:	68 e0 70 00 00       	push   $0x70e0
+    2507:	ff 75 f4             	push   -0xc(%ebp)
+    250a:	e8 c0 3a 00 00       	call   5fcf <openat>
+    250f:	83 c4 10             	add    $0x10,%esp
+     unlinkat(dfd, "sub/f") < 0 || unlinkat(dfd, "sub") < 0 ||
+    2512:	85 c0                	test   %eax,%eax
+    2514:	78 17                	js     252d <attest+0x1c3>
+    printf(1, "at: unlink failed\n");
+    2516:	83 ec 08             	sub    $0x8,%esp
+    2519:	68 2a 71 00 00       	push   $0x712a
+    251e:	6a 01                	push   $0x1
+    2520:	e8 ce 3b 00 00       	call   60f3 <printf>
+    2525:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2528:	e8 ca 39 00 00       	call   5ef7 <exit>
+  }
+  close(dfd);
+    252d:	83 ec 0c             	sub    $0xc,%esp
+    2530:	ff 75 f4             	push   -0xc(%ebp)
+    2533:	e8 e7 39 00 00       	call   5f1f <close>
+    2538:	83 c4 10             	add    $0x10,%esp
+  if(unlink("atlink") < 0 || unlink("atdir") < 0){
+    253b:	83 ec 0c             	sub    $0xc,%esp
+    253e:	68 fc 70 00 00       	push   $0x70fc
+    2543:	e8 ff 39 00 00       	call   5f47 <unlink>
+    2548:	83 c4 10             	add    $0x10,%esp
+    254b:	85 c0                	test   %eax,%eax
+    254d:	78 14                	js     2563 <attest+0x1f9>
+    254f:	83 ec 0c             	sub    $0xc,%esp
+    2552:	68 b9 70 00 00       	push   $0x70b9
+    2557:	e8 eb 39 00 00       	call   5f47 <unlink>
+    255c:	83 c4 10             	add    $0x10,%esp
+    255f:	85 c0                	test   %eax,%eax
+    2561:	79 17                	jns    257a <attest+0x210>
+    printf(1, "at: cleanup failed\n");
+    2563:	83 ec 08             	sub    $0x8,%esp
+    2566:	68 3d 71 00 00       	push   $0x713d
+    256b:	6a 01                	push   $0x1
+    256d:	e8 81 3b 00 00       	call   60f3 <printf>
+    2572:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2575:	e8 7d 39 00 00       	call   5ef7 <exit>
+  }
+  printf(1, "at test ok\n");
+    257a:	83 ec 08             	sub    $0x8,%esp
+    257d:	68 51 71 00 00       	push   $0x7151
+    2582:	6a 01                	push   $0x1
+    2584:	e8 6a 3b 00 00       	call   60f3 <printf>
+    2589:	83 c4 10             	add    $0x10,%esp
+}
+    258c:	90                   	nop
+    258d:	c9                   	leave
+    258e:	c3                   	ret
+
+0000258f <getdentstest>:
+// small the buffer, skipping the slots of removed files, and
+// fstatat finds each of them from the directory fd and from
+// the current directory.
+void
+getdentstest(void)
+{
+    258f:	55                   	push   %ebp
+    2590:	89 e5                	mov    %esp,%ebp
+    2592:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  struct dirent de[3];
+  struct stat st;
+  char name[DIRSIZ+1], path[32];
+  int dfd, fd, i, j, n, seen;
+
+  printf(1, "getdents test\n");
+    2598:	83 ec 08             	sub    $0x8,%esp
+    259b:	68 5d 71 00 00       	push   $0x715d
+    25a0:	6a 01                	push   $0x1
+    25a2:	e8 4c 3b 00 00       	call   60f3 <printf>
+    25a7:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("gddir") < 0 || (dfd = open("gddir", O_RDONLY)) < 0){
+    25aa:	83 ec 0c             	sub    $0xc,%esp
+    25ad:	68 6c 71 00 00       	push   $0x716c
+    25b2:	e8 a8 39 00 00       	call   5f5f <mkdir>
+    25b7:	83 c4 10             	add    $0x10,%esp
+    25ba:	85 c0                	test   %eax,%eax
+    25bc:	78 1b                	js     25d9 <getdentstest+0x4a>
+    25be:	83 ec 08             	sub    $0x8,%esp
+    25c1:	6a 00                	push   $0x0
+    25c3:	68 6c 71 00 00       	push   $0x716c
+    25c8:	e8 6a 39 00 00       	call   5f37 <open>
+    25cd:	83 c4 10             	add    $0x10,%esp
+    25d0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    25d3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    25d7:	79 17                	jns    25f0 <getdentstest+0x61>
+    printf(1, "getdents: mkdir/open gddir failed\n");
+    25d9:	83 ec 08             	sub    $0x8,%esp
+    25dc:	68 74 71 00 00       	push   $0x7174
+    25e1:	6a 01                	push   $0x1
+    25e3:	e8 0b 3b 00 00       	call   60f3 <printf>
+    25e8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    25eb:	e8 07 39 00 00       	call   5ef7 <exit>
+  }
+  name[0] = 'f';
+    25f0:	c6 45 8d 66          	movb   $0x66,-0x73(%ebp)
+  name[2] = 0;
+    25f4:	c6 45 8f 00          	movb   $0x0,-0x71(%ebp)
+  for(i = 0; i < 10; i++){
+    25f8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    25ff:	eb 52                	jmp    2653 <getdentstest+0xc4>
+    name[1] = '0' + i;
+    2601:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2604:	83 c0 30             	add    $0x30,%eax
+    2607:	88 45 8e             	mov    %al,-0x72(%ebp)
+    if((fd = openat(dfd, name, O_CREATE|O_RDWR)) < 0){
+    260a:	83 ec 04             	sub    $0x4,%esp
+    260d:	68 02 02 00 00       	push   $0x202
+    2612:	8d 45 8d             	lea    -0x73(%ebp),%eax
+    2615:	50                   	push   %eax
+    2616:	ff 75 e8             	push   -0x18(%ebp)
+    2619:	e8 b1 39 00 00       	call   5fcf <openat>
+    261e:	83 c4 10             	add    $0x10,%esp
+    2621:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    2624:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    2628:	79 17                	jns    2641 <getdentstest+0xb2>
+      printf(1, "getdents: create failed\n");
+    262a:	83 ec 08             	sub    $0x8,%esp
+    262d:	68 97 71 00 00       	push   $0x7197
+    2632:	6a 01                	push   $0x1
+    2634:	e8 ba 3a 00 00       	call   60f3 <printf>
+    2639:	83 c4 10             	add    $0x10,%esp
+      exit();
+    263c:	e8 b6 38 00 00       	call   5ef7 <exit>
+    }
+    close(fd);
+    2641:	83 ec 0c             	sub    $0xc,%esp
+    2644:	ff 75 e0             	push   -0x20(%ebp)
+    2647:	e8 d3 38 00 00       	call   5f1f <close>
+    264c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 10; i++){
+    264f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2653:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    2657:	7e a8                	jle    2601 <getdentstest+0x72>
+  }
+  // Leave empty slots at f1, f4 and f7.
+  if(unlinkat(dfd, "f1") < 0 || unlinkat(dfd, "f4") < 0 ||
+    2659:	83 ec 08             	sub    $0x8,%esp
+    265c:	68 b0 71 00 00       	push   $0x71b0
+    2661:	ff 75 e8             	push   -0x18(%ebp)
+    2664:	e8 6e 39 00 00       	call   5fd7 <unlinkat>
+    2669:	83 c4 10             	add    $0x10,%esp
+    266c:	85 c0                	test   %eax,%eax
+    266e:	78 2e                	js     269e <getdentstest+0x10f>
+    2670:	83 ec 08             	sub    $0x8,%esp
+    2673:	68 b3 71 00 00       	push   $0x71b3
+    2678:	ff 75 e8             	push   -0x18(%ebp)
+    267b:	e8 57 39 00 00       	call   5fd7 <unlinkat>
+    2680:	83 c4 10             	add    $0x10,%esp
+    2683:	85 c0                	test   %eax,%eax
+    2685:	78 17                	js     269e <getdentstest+0x10f>
+     unlinkat(dfd, "f7") < 0){
+    2687:	83 ec 08             	sub    $0x8,%esp
+    268a:	68 b6 71 00 00       	push   $0x71b6
+    268f:	ff 75 e8             	push   -0x18(%ebp)
+    2692:	e8 40 39 00 00       	call   5fd7 <unlinkat>
+    2697:	83 c4 10             	add    $0x10,%esp
+  if(unlinkat(dfd, "f1") < 0 || unlinkat(dfd, "f4") < 0 ||
+    269a:	85 c0                	test   %eax,%eax
+    269c:	79 17                	jns    26b5 <getdentstest+0x126>
+    printf(1, "getdents: unlink failed\n");
+    269e:	83 ec 08             	sub    $0x8,%esp
+    26a1:	68 b9 71 00 00       	push   $0x71b9
+    26a6:	6a 01                	push   $0x1
+    26a8:	e8 46 3a 00 00       	call   60f3 <printf>
+    26ad:	83 c4 10             	add    $0x10,%esp
+    exit();
+    26b0:	e8 42 38 00 00       	call   5ef7 <exit>
+  }
+
+  // Read the directory up to three entries at a time.
+  seen = 0;
+    26b5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  while((n = getdents(dfd, de, sizeof(de))) > 0){
+    26bc:	e9 18 02 00 00       	jmp    28d9 <getdentstest+0x34a>
+    if(n % sizeof(de[0]) != 0){
+    26c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    26c4:	83 e0 0f             	and    $0xf,%eax
+    26c7:	85 c0                	test   %eax,%eax
+    26c9:	74 17                	je     26e2 <getdentstest+0x153>
+      printf(1, "getdents: partial entry\n");
+    26cb:	83 ec 08             	sub    $0x8,%esp
+    26ce:	68 d2 71 00 00       	push   $0x71d2
+    26d3:	6a 01                	push   $0x1
+    26d5:	e8 19 3a 00 00       	call   60f3 <printf>
+    26da:	83 c4 10             	add    $0x10,%esp
+      exit();
+    26dd:	e8 15 38 00 00       	call   5ef7 <exit>
+    }
+    for(j = 0; j < n/sizeof(de[0]); j++){
+    26e2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    26e9:	e9 da 01 00 00       	jmp    28c8 <getdentstest+0x339>
+      if(de[j].inum == 0){
+    26ee:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    26f1:	c1 e0 04             	shl    $0x4,%eax
+    26f4:	8d 40 f8             	lea    -0x8(%eax),%eax
+    26f7:	01 e8                	add    %ebp,%eax
+    26f9:	83 e8 48             	sub    $0x48,%eax
+    26fc:	0f b7 00             	movzwl (%eax),%eax
+    26ff:	66 85 c0             	test   %ax,%ax
+    2702:	75 17                	jne    271b <getdentstest+0x18c>
+        printf(1, "getdents: empty slot returned\n");
+    2704:	83 ec 08             	sub    $0x8,%esp
+    2707:	68 ec 71 00 00       	push   $0x71ec
+    270c:	6a 01                	push   $0x1
+    270e:	e8 e0 39 00 00       	call   60f3 <printf>
+    2713:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2716:	e8 dc 37 00 00       	call   5ef7 <exit>
+      }
+      memmove(name, de[j].name, DIRSIZ);
+    271b:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    271e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    2721:	c1 e2 04             	shl    $0x4,%edx
+    2724:	01 d0                	add    %edx,%eax
+    2726:	83 c0 02             	add    $0x2,%eax
+    2729:	83 ec 04             	sub    $0x4,%esp
+    272c:	6a 0e                	push   $0xe
+    272e:	50                   	push   %eax
+    272f:	8d 45 8d             	lea    -0x73(%ebp),%eax
+    2732:	50                   	push   %eax
+    2733:	e8 3c 37 00 00       	call   5e74 <memmove>
+    2738:	83 c4 10             	add    $0x10,%esp
+      name[DIRSIZ] = 0;
+    273b:	c6 45 9b 00          	movb   $0x0,-0x65(%ebp)
+      if(strcmp(name, ".") == 0 || strcmp(name, "..") == 0)
+    273f:	83 ec 08             	sub    $0x8,%esp
+    2742:	68 0b 72 00 00       	push   $0x720b
+    2747:	8d 45 8d             	lea    -0x73(%ebp),%eax
+    274a:	50                   	push   %eax
+    274b:	e8 68 35 00 00       	call   5cb8 <strcmp>
+    2750:	83 c4 10             	add    $0x10,%esp
+    2753:	85 c0                	test   %eax,%eax
+    2755:	0f 84 68 01 00 00    	je     28c3 <getdentstest+0x334>
+    275b:	83 ec 08             	sub    $0x8,%esp
+    275e:	68 ca 68 00 00       	push   $0x68ca
+    2763:	8d 45 8d             	lea    -0x73(%ebp),%eax
+    2766:	50                   	push   %eax
+    2767:	e8 4c 35 00 00       	call   5cb8 <strcmp>
+    276c:	83 c4 10             	add    $0x10,%esp
+    276f:	85 c0                	test   %eax,%eax
+    2771:	0f 84 4c 01 00 00    	je     28c3 <getdentstest+0x334>
+        continue;
+      if(name[0] != 'f' || name[1] < '0' || name[1] > '9' || name[2] != 0 ||
+    2777:	0f b6 45 8d          	movzbl -0x73(%ebp),%eax
+    277b:	3c 66                	cmp    $0x66,%al
+    277d:	75 32                	jne    27b1 <getdentstest+0x222>
+    277f:	0f b6 45 8e          	movzbl -0x72(%ebp),%eax
+    2783:	3c 2f                	cmp    $0x2f,%al
+    2785:	7e 2a                	jle    27b1 <getdentstest+0x222>
+    2787:	0f b6 45 8e          	movzbl -0x72(%ebp),%eax
+    278b:	3c 39                	cmp    $0x39,%al
+    278d:	7f 22                	jg     27b1 <getdentstest+0x222>
+    278f:	0f b6 45 8f          	movzbl -0x71(%ebp),%eax
+    2793:	84 c0                	test   %al,%al
+    2795:	75 1a                	jne    27b1 <getdentstest+0x222>
+         (seen & (1 << (name[1]-'0')))){
+    2797:	0f b6 45 8e          	movzbl -0x72(%ebp),%eax
+    279b:	0f be c0             	movsbl %al,%eax
+    279e:	83 e8 30             	sub    $0x30,%eax
+      if(name[0] != 'f' || name[1] < '0' || name[1] > '9' || name[2] != 0 ||
+    27a1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    27a4:	89 c1                	mov    %eax,%ecx
+    27a6:	d3 fa                	sar    %cl,%edx
+    27a8:	89 d0                	mov    %edx,%eax
+    27aa:	83 e0 01             	and    $0x1,%eax
+    27ad:	85 c0                	test   %eax,%eax
+    27af:	74 1b                	je     27cc <getdentstest+0x23d>
+        printf(1, "getdents: unexpected entry %s\n", name);
+    27b1:	83 ec 04             	sub    $0x4,%esp
+    27b4:	8d 45 8d             	lea    -0x73(%ebp),%eax
+    27b7:	50                   	push   %eax
+    27b8:	68 10 72 00 00       	push   $0x7210
+    27bd:	6a 01                	push   $0x1
+    27bf:	e8 2f 39 00 00       	call   60f3 <printf>
+    27c4:	83 c4 10             	add    $0x10,%esp
+        exit();
+    27c7:	e8 2b 37 00 00       	call   5ef7 <exit>
+      }
+      seen |= 1 << (name[1]-'0');
+    27cc:	0f b6 45 8e          	movzbl -0x72(%ebp),%eax
+    27d0:	0f be c0             	movsbl %al,%eax
+    27d3:	83 e8 30             	sub    $0x30,%eax
+    27d6:	ba 01 00 00 00       	mov    $0x1,%edx
+    27db:	89 c1                	mov    %eax,%ecx
+    27dd:	d3 e2                	shl    %cl,%edx
+    27df:	89 d0                	mov    %edx,%eax
+    27e1:	09 45 ec             	or     %eax,-0x14(%ebp)
+      if(fstatat(dfd, name, &st) < 0 || st.ino != de[j].inum ||
+    27e4:	83 ec 04             	sub    $0x4,%esp
+    27e7:	8d 45 9c             	lea    -0x64(%ebp),%eax
+    27ea:	50                   	push   %eax
+    27eb:	8d 45 8d             	lea    -0x73(%ebp),%eax
+    27ee:	50                   	push   %eax
+    27ef:	ff 75 e8             	push   -0x18(%ebp)
+    27f2:	e8 d0 37 00 00       	call   5fc7 <fstatat>
+    27f7:	83 c4 10             	add    $0x10,%esp
+    27fa:	85 c0                	test   %eax,%eax
+    27fc:	78 25                	js     2823 <getdentstest+0x294>
+    27fe:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+    2801:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2804:	c1 e0 04             	shl    $0x4,%eax
+    2807:	8d 40 f8             	lea    -0x8(%eax),%eax
+    280a:	01 e8                	add    %ebp,%eax
+    280c:	83 e8 48             	sub    $0x48,%eax
+    280f:	0f b7 00             	movzwl (%eax),%eax
+    2812:	0f b7 c0             	movzwl %ax,%eax
+    2815:	39 c2                	cmp    %eax,%edx
+    2817:	75 0a                	jne    2823 <getdentstest+0x294>
+         st.type != T_FILE){
+    2819:	0f b7 45 9c          	movzwl -0x64(%ebp),%eax
+      if(fstatat(dfd, name, &st) < 0 || st.ino != de[j].inum ||
+    281d:	66 83 f8 02          	cmp    $0x2,%ax
+    2821:	74 1b                	je     283e <getdentstest+0x2af>
+        printf(1, "getdents: fstatat %s failed\n", name);
+    2823:	83 ec 04             	sub    $0x4,%esp
+    2826:	8d 45 8d             	lea    -0x73(%ebp),%eax
+    2829:	50                   	push   %eax
+    282a:	68 2f 72 00 00       	push   $0x722f
+    282f:	6a 01                	push   $0x1
+    2831:	e8 bd 38 00 00       	call   60f3 <printf>
+    2836:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2839:	e8 b9 36 00 00       	call   5ef7 <exit>
+      }
+      strcpy(path, "gddir/");
+    283e:	83 ec 08             	sub    $0x8,%esp
+    2841:	68 4c 72 00 00       	push   $0x724c
+    2846:	8d 85 6d ff ff ff    	lea    -0x93(%ebp),%eax
+    284c:	50                   	push   %eax
+    284d:	e8 36 34 00 00       	call   5c88 <strcpy>
+    2852:	83 c4 10             	add    $0x10,%esp
+      strcpy(path + 6, name);
+    2855:	8d 85 6d ff ff ff    	lea    -0x93(%ebp),%eax
+    285b:	83 c0 06             	add    $0x6,%eax
+    285e:	83 ec 08             	sub    $0x8,%esp
+    2861:	8d 55 8d             	lea    -0x73(%ebp),%edx
+    2864:	52                   	push   %edx
+    2865:	50                   	push   %eax
+    2866:	e8 1d 34 00 00       	call   5c88 <strcpy>
+    286b:	83 c4 10             	add    $0x10,%esp
+      if(fstatat(AT_FDCWD, path, &st) < 0 || st.ino != de[j].inum){
+    286e:	83 ec 04             	sub    $0x4,%esp
+    2871:	8d 45 9c             	lea    -0x64(%ebp),%eax
+    2874:	50                   	push   %eax
+    2875:	8d 85 6d ff ff ff    	lea    -0x93(%ebp),%eax
+    287b:	50                   	push   %eax
+    287c:	6a 9c                	push   $0xffffff9c
+    287e:	e8 44 37 00 00       	call   5fc7 <fstatat>
+    2883:	83 c4 10             	add    $0x10,%esp
+    2886:	85 c0                	test   %eax,%eax
+    2888:	78 1b                	js     28a5 <getdentstest+0x316>
+    288a:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+    288d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2890:	c1 e0 04             	shl    $0x4,%eax
+    2893:	8d 40 f8             	lea    -0x8(%eax),%eax
+    2896:	01 e8                	add    %ebp,%eax
+    2898:	83 e8 48             	sub    $0x48,%eax
+    289b:	0f b7 00             	movzwl (%eax),%eax
+    289e:	0f b7 c0             	movzwl %ax,%eax
+    28a1:	39 c2                	cmp    %eax,%edx
+    28a3:	74 1f                	je     28c4 <getdentstest+0x335>
+        printf(1, "getdents: fstatat %s failed\n", path);
+    28a5:	83 ec 04             	sub    $0x4,%esp
+    28a8:	8d 85 6d ff ff ff    	lea    -0x93(%ebp),%eax
+    28ae:	50                   	push   %eax
+    28af:	68 2f 72 00 00       	push   $0x722f
+    28b4:	6a 01                	push   $0x1
+    28b6:	e8 38 38 00 00       	call   60f3 <printf>
+    28bb:	83 c4 10             	add    $0x10,%esp
+        exit();
+    28be:	e8 34 36 00 00       	call   5ef7 <exit>
+        continue;
+    28c3:	90                   	nop
+    for(j = 0; j < n/sizeof(de[0]); j++){
+    28c4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    28c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    28cb:	c1 e8 04             	shr    $0x4,%eax
+    28ce:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    28d1:	39 c2                	cmp    %eax,%edx
+    28d3:	0f 82 15 fe ff ff    	jb     26ee <getdentstest+0x15f>
+  while((n = getdents(dfd, de, sizeof(de))) > 0){
+    28d9:	83 ec 04             	sub    $0x4,%esp
+    28dc:	6a 30                	push   $0x30
+    28de:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    28e1:	50                   	push   %eax
+    28e2:	ff 75 e8             	push   -0x18(%ebp)
+    28e5:	e8 d5 36 00 00       	call   5fbf <getdents>
+    28ea:	83 c4 10             	add    $0x10,%esp
+    28ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    28f0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    28f4:	0f 8f c7 fd ff ff    	jg     26c1 <getdentstest+0x132>
+      }
+    }
+  }
+  if(n < 0 || seen != (0x3ff & ~(1<<1 | 1<<4 | 1<<7))){
+    28fa:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    28fe:	78 09                	js     2909 <getdentstest+0x37a>
+    2900:	81 7d ec 6d 03 00 00 	cmpl   $0x36d,-0x14(%ebp)
+    2907:	74 1a                	je     2923 <getdentstest+0x394>
+    printf(1, "getdents: wrong entries %x\n", seen);
+    2909:	83 ec 04             	sub    $0x4,%esp
+    290c:	ff 75 ec             	push   -0x14(%ebp)
+    290f:	68 53 72 00 00       	push   $0x7253
+    2914:	6a 01                	push   $0x1
+    2916:	e8 d8 37 00 00       	call   60f3 <printf>
+    291b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    291e:	e8 d4 35 00 00       	call   5ef7 <exit>
+  }
+  if(getdents(dfd, de, sizeof(de)) != 0){
+    2923:	83 ec 04             	sub    $0x4,%esp
+    2926:	6a 30                	push   $0x30
+    2928:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    292b:	50                   	push   %eax
+    292c:	ff 75 e8             	push   -0x18(%ebp)
+    292f:	e8 8b 36 00 00       	call   5fbf <getdents>
+    2934:	83 c4 10             	add    $0x10,%esp
+    2937:	85 c0                	test   %eax,%eax
+    2939:	74 17                	je     2952 <getdentstest+0x3c3>
+    printf(1, "getdents: read past end\n");
+    293b:	83 ec 08             	sub    $0x8,%esp
+    293e:	68 6f 72 00 00       	push   $0x726f
+    2943:	6a 01                	push   $0x1
+    2945:	e8 a9 37 00 00       	call   60f3 <printf>
+    294a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    294d:	e8 a5 35 00 00       	call   5ef7 <exit>
+  }
+  if(fstatat(dfd, "f4", &st) == 0){
+    2952:	83 ec 04             	sub    $0x4,%esp
+    2955:	8d 45 9c             	lea    -0x64(%ebp),%eax
+    2958:	50                   	push   %eax
+    2959:	68 b3 71 00 00       	push   $0x71b3
+    295e:	ff 75 e8             	push   -0x18(%ebp)
+    2961:	e8 61 36 00 00       	call   5fc7 <fstatat>
+    2966:	83 c4 10             	add    $0x10,%esp
+    2969:	85 c0                	test   %eax,%eax
+    296b:	75 17                	jne    2984 <getdentstest+0x3f5>
+    printf(1, "getdents: fstatat found removed f4\n");
+    296d:	83 ec 08             	sub    $0x8,%esp
+    2970:	68 88 72 00 00       	push   $0x7288
+    2975:	6a 01                	push   $0x1
+    2977:	e8 77 37 00 00       	call   60f3 <printf>
+    297c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    297f:	e8 73 35 00 00       	call   5ef7 <exit>
+  }
+  close(dfd);
+    2984:	83 ec 0c             	sub    $0xc,%esp
+    2987:	ff 75 e8             	push   -0x18(%ebp)
+    298a:	e8 90 35 00 00       	call   5f1f <close>
+    298f:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 10; i++){
+    2992:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2999:	eb 66                	jmp    2a01 <getdentstest+0x472>
+    strcpy(path, "gddir/f0");
+    299b:	83 ec 08             	sub    $0x8,%esp
+    299e:	68 ac 72 00 00       	push   $0x72ac
+    29a3:	8d 85 6d ff ff ff    	lea    -0x93(%ebp),%eax
+    29a9:	50                   	push   %eax
+    29aa:	e8 d9 32 00 00       	call   5c88 <strcpy>
+    29af:	83 c4 10             	add    $0x10,%esp
+    path[7] = '0' + i;
+    29b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    29b5:	83 c0 30             	add    $0x30,%eax
+    29b8:	88 85 74 ff ff ff    	mov    %al,-0x8c(%ebp)
+    if(i != 1 && i != 4 && i != 7 && unlink(path) < 0){
+    29be:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    29c2:	74 39                	je     29fd <getdentstest+0x46e>
+    29c4:	83 7d f4 04          	cmpl   $0x4,-0xc(%ebp)
+    29c8:	74 33                	je     29fd <getdentstest+0x46e>
+    29ca:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+    29ce:	74 2d                	je     29fd <getdentstest+0x46e>
+    29d0:	83 ec 0c             	sub    $0xc,%esp
+    29d3:	8d 85 6d ff ff ff    	lea    -0x93(%ebp),%eax
+    29d9:	50                   	push   %eax
+    29da:	e8 68 35 00 00       	call   5f47 <unlink>
+    29df:	83 c4 10             	add    $0x10,%esp
+    29e2:	85 c0                	test   %eax,%eax
+    29e4:	79 17                	jns    29fd <getdentstest+0x46e>
+      printf(1, "getdents: cleanup failed\n");
+    29e6:	83 ec 08             	sub    $0x8,%esp
+    29e9:	68 b5 72 00 00       	push   $0x72b5
+    29ee:	6a 01                	push   $0x1
+    29f0:	e8 fe 36 00 00       	call   60f3 <printf>
+    29f5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    29f8:	e8 fa 34 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 10; i++){
+    29fd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2a01:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    2a05:	7e 94                	jle    299b <getdentstest+0x40c>
+    }
+  }
+  if(unlink("gddir") < 0){
+    2a07:	83 ec 0c             	sub    $0xc,%esp
+    2a0a:	68 6c 71 00 00       	push   $0x716c
+    2a0f:	e8 33 35 00 00       	call   5f47 <unlink>
+    2a14:	83 c4 10             	add    $0x10,%esp
+    2a17:	85 c0                	test   %eax,%eax
+    2a19:	79 17                	jns    2a32 <getdentstest+0x4a3>
+    printf(1, "getdents: cleanup failed\n");
+    2a1b:	83 ec 08             	sub    $0x8,%esp
+    2a1e:	68 b5 72 00 00       	push   $0x72b5
+    2a23:	6a 01                	push   $0x1
+    2a25:	e8 c9 36 00 00       	call   60f3 <printf>
+    2a2a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a2d:	e8 c5 34 00 00       	call   5ef7 <exit>
+  }
+  printf(1, "getdents test ok\n");
+    2a32:	83 ec 08             	sub    $0x8,%esp
+    2a35:	68 cf 72 00 00       	push   $0x72cf
+    2a3a:	6a 01                	push   $0x1
+    2a3c:	e8 b2 36 00 00       	call   60f3 <printf>
+    2a41:	83 c4 10             	add    $0x10,%esp
+}
+    2a44:	90                   	nop
+    2a45:	c9                   	leave
+    2a46:	c3                   	ret
+
+00002a47 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+    2a47:	55                   	push   %ebp
+    2a48:	89 e5                	mov    %esp,%ebp
+    2a4a:	83 ec 28             	sub    $0x28,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+    2a4d:	83 ec 08             	sub    $0x8,%esp
+    2a50:	68 e1 72 00 00       	push   $0x72e1
+    2a55:	6a 01                	push   $0x1
+    2a57:	e8 97 36 00 00       	call   60f3 <printf>
+    2a5c:	83 c4 10             	add    $0x10,%esp
+  pid1 = fork();
+    2a5f:	e8 8b 34 00 00       	call   5eef <fork>
+    2a64:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid1 == 0)
+    2a67:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2a6b:	75 03                	jne    2a70 <preempt+0x29>
+    for(;;)
+    2a6d:	90                   	nop
+    2a6e:	eb fd                	jmp    2a6d <preempt+0x26>
+      ;
+
+  pid2 = fork();
+    2a70:	e8 7a 34 00 00       	call   5eef <fork>
+    2a75:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid2 == 0)
+    2a78:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2a7c:	75 03                	jne    2a81 <preempt+0x3a>
+    for(;;)
+    2a7e:	90                   	nop
+    2a7f:	eb fd                	jmp    2a7e <preempt+0x37>
+      ;
+
+  pipe(pfds);
+    2a81:	83 ec 0c             	sub    $0xc,%esp
+    2a84:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    2a87:	50                   	push   %eax
+    2a88:	e8 7a 34 00 00       	call   5f07 <pipe>
+    2a8d:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    2a90:	e8 5a 34 00 00       	call   5eef <fork>
+    2a95:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid3 == 0){
+    2a98:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2a9c:	75 4e                	jne    2aec <preempt+0xa5>
+    close(pfds[0]);
+    2a9e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2aa1:	83 ec 0c             	sub    $0xc,%esp
+    2aa4:	50                   	push   %eax
+    2aa5:	e8 75 34 00 00       	call   5f1f <close>
+    2aaa:	83 c4 10             	add    $0x10,%esp
+    if(write(pfds[1], "x", 1) != 1)
+    2aad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2ab0:	83 ec 04             	sub    $0x4,%esp
+    2ab3:	6a 01                	push   $0x1
+    2ab5:	68 bb 69 00 00       	push   $0x69bb
+    2aba:	50                   	push   %eax
+    2abb:	e8 57 34 00 00       	call   5f17 <write>
+    2ac0:	83 c4 10             	add    $0x10,%esp
+    2ac3:	83 f8 01             	cmp    $0x1,%eax
+    2ac6:	74 12                	je     2ada <preempt+0x93>
+      printf(1, "preempt write error");
+    2ac8:	83 ec 08             	sub    $0x8,%esp
+    2acb:	68 eb 72 00 00       	push   $0x72eb
+    2ad0:	6a 01                	push   $0x1
+    2ad2:	e8 1c 36 00 00       	call   60f3 <printf>
+    2ad7:	83 c4 10             	add    $0x10,%esp
+    close(pfds[1]);
+    2ada:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2add:	83 ec 0c             	sub    $0xc,%esp
+    2ae0:	50                   	push   %eax
+    2ae1:	e8 39 34 00 00       	call   5f1f <close>
+    2ae6:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    2ae9:	90                   	nop
+    2aea:	eb fd                	jmp    2ae9 <preempt+0xa2>
+      ;
+  }
+
+  close(pfds[1]);
+    2aec:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2aef:	83 ec 0c             	sub    $0xc,%esp
+    2af2:	50                   	push   %eax
+    2af3:	e8 27 34 00 00       	call   5f1f <close>
+    2af8:	83 c4 10             	add    $0x10,%esp
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    2afb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2afe:	83 ec 04             	sub    $0x4,%esp
+    2b01:	68 00 20 00 00       	push   $0x2000
+    2b06:	68 e0 8e 00 00       	push   $0x8ee0
+    2b0b:	50                   	push   %eax
+    2b0c:	e8 fe 33 00 00       	call   5f0f <read>
+    2b11:	83 c4 10             	add    $0x10,%esp
+    2b14:	83 f8 01             	cmp    $0x1,%eax
+    2b17:	74 14                	je     2b2d <preempt+0xe6>
+    printf(1, "preempt read error");
+    2b19:	83 ec 08             	sub    $0x8,%esp
+    2b1c:	68 ff 72 00 00       	push   $0x72ff
+    2b21:	6a 01                	push   $0x1
+    2b23:	e8 cb 35 00 00       	call   60f3 <printf>
+    2b28:	83 c4 10             	add    $0x10,%esp
+    2b2b:	eb 7e                	jmp    2bab <preempt+0x164>
+    return;
+  }
+  close(pfds[0]);
+    2b2d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    2b30:	83 ec 0c             	sub    $0xc,%esp
+    2b33:	50                   	push   %eax
+    2b34:	e8 e6 33 00 00       	call   5f1f <close>
+    2b39:	83 c4 10             	add    $0x10,%esp
+  printf(1, "kill... ");
+    2b3c:	83 ec 08             	sub    $0x8,%esp
+    2b3f:	68 12 73 00 00       	push   $0x7312
+    2b44:	6a 01                	push   $0x1
+    2b46:	e8 a8 35 00 00       	call   60f3 <printf>
+    2b4b:	83 c4 10             	add    $0x10,%esp
+  kill(pid1);
+    2b4e:	83 ec 0c             	sub    $0xc,%esp
+    2b51:	ff 75 f4             	push   -0xc(%ebp)
+    2b54:	e8 ce 33 00 00       	call   5f27 <kill>
+    2b59:	83 c4 10             	add    $0x10,%esp
+  kill(pid2);
+    2b5c:	83 ec 0c             	sub    $0xc,%esp
+    2b5f:	ff 75 f0             	push   -0x10(%ebp)
+    2b62:	e8 c0 33 00 00       	call   5f27 <kill>
+    2b67:	83 c4 10             	add    $0x10,%esp
+  kill(pid3);
+    2b6a:	83 ec 0c             	sub    $0xc,%esp
+    2b6d:	ff 75 ec             	push   -0x14(%ebp)
+    2b70:	e8 b2 33 00 00       	call   5f27 <kill>
+    2b75:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+    2b78:	83 ec 08             	sub    $0x8,%esp
+    2b7b:	68 1b 73 00 00       	push   $0x731b
+    2b80:	6a 01                	push   $0x1
+    2b82:	e8 6c 35 00 00       	call   60f3 <printf>
+    2b87:	83 c4 10             	add    $0x10,%esp
+  wait();
+    2b8a:	e8 70 33 00 00       	call   5eff <wait>
+  wait();
+    2b8f:	e8 6b 33 00 00       	call   5eff <wait>
+  wait();
+    2b94:	e8 66 33 00 00       	call   5eff <wait>
+  printf(1, "preempt ok\n");
+    2b99:	83 ec 08             	sub    $0x8,%esp
+    2b9c:	68 24 73 00 00       	push   $0x7324
+    2ba1:	6a 01                	push   $0x1
+    2ba3:	e8 4b 35 00 00       	call   60f3 <printf>
+    2ba8:	83 c4 10             	add    $0x10,%esp
+}
+    2bab:	c9                   	leave
+    2bac:	c3                   	ret
+
+00002bad <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+    2bad:	55                   	push   %ebp
+    2bae:	89 e5                	mov    %esp,%ebp
+    2bb0:	83 ec 18             	sub    $0x18,%esp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+    2bb3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2bba:	eb 4f                	jmp    2c0b <exitwait+0x5e>
+    pid = fork();
+    2bbc:	e8 2e 33 00 00       	call   5eef <fork>
+    2bc1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+    2bc4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2bc8:	79 14                	jns    2bde <exitwait+0x31>
+      printf(1, "fork failed\n");
+    2bca:	83 ec 08             	sub    $0x8,%esp
+    2bcd:	68 4d 65 00 00       	push   $0x654d
+    2bd2:	6a 01                	push   $0x1
+    2bd4:	e8 1a 35 00 00       	call   60f3 <printf>
+    2bd9:	83 c4 10             	add    $0x10,%esp
+      return;
+    2bdc:	eb 45                	jmp    2c23 <exitwait+0x76>
+    }
+    if(pid){
+    2bde:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2be2:	74 1e                	je     2c02 <exitwait+0x55>
+      if(wait() != pid){
+    2be4:	e8 16 33 00 00       	call   5eff <wait>
+    2be9:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    2bec:	74 19                	je     2c07 <exitwait+0x5a>
+        printf(1, "wait wrong pid\n");
+    2bee:	83 ec 08             	sub    $0x8,%esp
+    2bf1:	68 30 73 00 00       	push   $0x7330
+    2bf6:	6a 01                	push   $0x1
+    2bf8:	e8 f6 34 00 00       	call   60f3 <printf>
+    2bfd:	83 c4 10             	add    $0x10,%esp
+        return;
+    2c00:	eb 21                	jmp    2c23 <exitwait+0x76>
+      }
+    } else {
+      exit();
+    2c02:	e8 f0 32 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 100; i++){
+    2c07:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2c0b:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    2c0f:	7e ab                	jle    2bbc <exitwait+0xf>
+    }
+  }
+  printf(1, "exitwait ok\n");
+    2c11:	83 ec 08             	sub    $0x8,%esp
+    2c14:	68 40 73 00 00       	push   $0x7340
+    2c19:	6a 01                	push   $0x1
+    2c1b:	e8 d3 34 00 00       	call   60f3 <printf>
+    2c20:	83 c4 10             	add    $0x10,%esp
+}
+    2c23:	c9                   	leave
+    2c24:	c3                   	ret
+
+00002c25 <exitstatus>:
+
+// waitstatus() returns what the child passed to exits(),
+// 0 after exit() and -1 if the child was killed.
+void
+exitstatus(void)
+{
+    2c25:	55                   	push   %ebp
+    2c26:	89 e5                	mov    %esp,%ebp
+    2c28:	83 ec 18             	sub    $0x18,%esp
+  int pid, st;
+
+  if((pid = fork()) == 0)
+    2c2b:	e8 bf 32 00 00       	call   5eef <fork>
+    2c30:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    2c33:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2c37:	75 0a                	jne    2c43 <exitstatus+0x1e>
+    exits(42);
+    2c39:	83 ec 0c             	sub    $0xc,%esp
+    2c3c:	6a 2a                	push   $0x2a
+    2c3e:	e8 ac 33 00 00       	call   5fef <exits>
+  if(waitstatus(&st) != pid || st != 42){
+    2c43:	83 ec 0c             	sub    $0xc,%esp
+    2c46:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    2c49:	50                   	push   %eax
+    2c4a:	e8 a8 33 00 00       	call   5ff7 <waitstatus>
+    2c4f:	83 c4 10             	add    $0x10,%esp
+    2c52:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    2c55:	75 08                	jne    2c5f <exitstatus+0x3a>
+    2c57:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2c5a:	83 f8 2a             	cmp    $0x2a,%eax
+    2c5d:	74 1b                	je     2c7a <exitstatus+0x55>
+    printf(1, "exitstatus: got %d\n", st);
+    2c5f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2c62:	83 ec 04             	sub    $0x4,%esp
+    2c65:	50                   	push   %eax
+    2c66:	68 4d 73 00 00       	push   $0x734d
+    2c6b:	6a 01                	push   $0x1
+    2c6d:	e8 81 34 00 00       	call   60f3 <printf>
+    2c72:	83 c4 10             	add    $0x10,%esp
+    return;
+    2c75:	e9 b7 00 00 00       	jmp    2d31 <exitstatus+0x10c>
+  }
+  if((pid = fork()) == 0)
+    2c7a:	e8 70 32 00 00       	call   5eef <fork>
+    2c7f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    2c82:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2c86:	75 05                	jne    2c8d <exitstatus+0x68>
+    exit();
+    2c88:	e8 6a 32 00 00       	call   5ef7 <exit>
+  if(waitstatus(&st) != pid || st != 0){
+    2c8d:	83 ec 0c             	sub    $0xc,%esp
+    2c90:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    2c93:	50                   	push   %eax
+    2c94:	e8 5e 33 00 00       	call   5ff7 <waitstatus>
+    2c99:	83 c4 10             	add    $0x10,%esp
+    2c9c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    2c9f:	75 07                	jne    2ca8 <exitstatus+0x83>
+    2ca1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2ca4:	85 c0                	test   %eax,%eax
+    2ca6:	74 18                	je     2cc0 <exitstatus+0x9b>
+    printf(1, "exitstatus: exit() gave %d\n", st);
+    2ca8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2cab:	83 ec 04             	sub    $0x4,%esp
+    2cae:	50                   	push   %eax
+    2caf:	68 61 73 00 00       	push   $0x7361
+    2cb4:	6a 01                	push   $0x1
+    2cb6:	e8 38 34 00 00       	call   60f3 <printf>
+    2cbb:	83 c4 10             	add    $0x10,%esp
+    return;
+    2cbe:	eb 71                	jmp    2d31 <exitstatus+0x10c>
+  }
+  if((pid = fork()) == 0)
+    2cc0:	e8 2a 32 00 00       	call   5eef <fork>
+    2cc5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    2cc8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2ccc:	75 0f                	jne    2cdd <exitstatus+0xb8>
+    for(;;)
+      sleep(1);
+    2cce:	83 ec 0c             	sub    $0xc,%esp
+    2cd1:	6a 01                	push   $0x1
+    2cd3:	e8 af 32 00 00       	call   5f87 <sleep>
+    2cd8:	83 c4 10             	add    $0x10,%esp
+    2cdb:	eb f1                	jmp    2cce <exitstatus+0xa9>
+  kill(pid);
+    2cdd:	83 ec 0c             	sub    $0xc,%esp
+    2ce0:	ff 75 f4             	push   -0xc(%ebp)
+    2ce3:	e8 3f 32 00 00       	call   5f27 <kill>
+    2ce8:	83 c4 10             	add    $0x10,%esp
+  if(waitstatus(&st) != pid || st != -1){
+    2ceb:	83 ec 0c             	sub    $0xc,%esp
+    2cee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    2cf1:	50                   	push   %eax
+    2cf2:	e8 00 33 00 00       	call   5ff7 <waitstatus>
+    2cf7:	83 c4 10             	add    $0x10,%esp
+    2cfa:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    2cfd:	75 08                	jne    2d07 <exitstatus+0xe2>
+    2cff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2d02:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2d05:	74 18                	je     2d1f <exitstatus+0xfa>
+    printf(1, "exitstatus: killed gave %d\n", st);
+    2d07:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2d0a:	83 ec 04             	sub    $0x4,%esp
+    2d0d:	50                   	push   %eax
+    2d0e:	68 7d 73 00 00       	push   $0x737d
+    2d13:	6a 01                	push   $0x1
+    2d15:	e8 d9 33 00 00       	call   60f3 <printf>
+    2d1a:	83 c4 10             	add    $0x10,%esp
+    return;
+    2d1d:	eb 12                	jmp    2d31 <exitstatus+0x10c>
+  }
+  printf(1, "exitstatus ok\n");
+    2d1f:	83 ec 08             	sub    $0x8,%esp
+    2d22:	68 99 73 00 00       	push   $0x7399
+    2d27:	6a 01                	push   $0x1
+    2d29:	e8 c5 33 00 00       	call   60f3 <printf>
+    2d2e:	83 c4 10             	add    $0x10,%esp
+}
+    2d31:	c9                   	leave
+    2d32:	c3                   	ret
+
+00002d33 <mem>:
+
+void
+mem(void)
+{
+    2d33:	55                   	push   %ebp
+    2d34:	89 e5                	mov    %esp,%ebp
+    2d36:	83 ec 18             	sub    $0x18,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+    2d39:	83 ec 08             	sub    $0x8,%esp
+    2d3c:	68 a8 73 00 00       	push   $0x73a8
+    2d41:	6a 01                	push   $0x1
+    2d43:	e8 ab 33 00 00       	call   60f3 <printf>
+    2d48:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+    2d4b:	e8 27 32 00 00       	call   5f77 <getpid>
+    2d50:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((pid = fork()) == 0){
+    2d53:	e8 97 31 00 00       	call   5eef <fork>
+    2d58:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    2d5b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2d5f:	0f 85 b7 00 00 00    	jne    2e1c <mem+0xe9>
+    m1 = 0;
+    2d65:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    2d6c:	eb 0e                	jmp    2d7c <mem+0x49>
+      *(char**)m2 = m1;
+    2d6e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2d71:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2d74:	89 10                	mov    %edx,(%eax)
+      m1 = m2;
+    2d76:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2d79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    2d7c:	83 ec 0c             	sub    $0xc,%esp
+    2d7f:	68 11 27 00 00       	push   $0x2711
+    2d84:	e8 3e 36 00 00       	call   63c7 <malloc>
+    2d89:	83 c4 10             	add    $0x10,%esp
+    2d8c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    2d8f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2d93:	75 d9                	jne    2d6e <mem+0x3b>
+    }
+    while(m1){
+    2d95:	eb 1c                	jmp    2db3 <mem+0x80>
+      m2 = *(char**)m1;
+    2d97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2d9a:	8b 00                	mov    (%eax),%eax
+    2d9c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      free(m1);
+    2d9f:	83 ec 0c             	sub    $0xc,%esp
+    2da2:	ff 75 f4             	push   -0xc(%ebp)
+    2da5:	e8 db 34 00 00       	call   6285 <free>
+    2daa:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    2dad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2db0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(m1){
+    2db3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2db7:	75 de                	jne    2d97 <mem+0x64>
+    }
+    m1 = malloc(1024*20);
+    2db9:	83 ec 0c             	sub    $0xc,%esp
+    2dbc:	68 00 50 00 00       	push   $0x5000
+    2dc1:	e8 01 36 00 00       	call   63c7 <malloc>
+    2dc6:	83 c4 10             	add    $0x10,%esp
+    2dc9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m1 == 0){
+    2dcc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2dd0:	75 25                	jne    2df7 <mem+0xc4>
+      printf(1, "couldn't allocate mem?!!\n");
+    2dd2:	83 ec 08             	sub    $0x8,%esp
+    2dd5:	68 b2 73 00 00       	push   $0x73b2
+    2dda:	6a 01                	push   $0x1
+    2ddc:	e8 12 33 00 00       	call   60f3 <printf>
+    2de1:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    2de4:	83 ec 0c             	sub    $0xc,%esp
+    2de7:	ff 75 f0             	push   -0x10(%ebp)
+    2dea:	e8 38 31 00 00       	call   5f27 <kill>
+    2def:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2df2:	e8 00 31 00 00       	call   5ef7 <exit>
+    }
+    free(m1);
+    2df7:	83 ec 0c             	sub    $0xc,%esp
+    2dfa:	ff 75 f4             	push   -0xc(%ebp)
+    2dfd:	e8 83 34 00 00       	call   6285 <free>
+    2e02:	83 c4 10             	add    $0x10,%esp
+    printf(1, "mem ok\n");
+    2e05:	83 ec 08             	sub    $0x8,%esp
+    2e08:	68 cc 73 00 00       	push   $0x73cc
+    2e0d:	6a 01                	push   $0x1
+    2e0f:	e8 df 32 00 00       	call   60f3 <printf>
+    2e14:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e17:	e8 db 30 00 00       	call   5ef7 <exit>
+  } else {
+    wait();
+    2e1c:	e8 de 30 00 00       	call   5eff <wait>
+  }
+}
+    2e21:	90                   	nop
+    2e22:	c9                   	leave
+    2e23:	c3                   	ret
+
+00002e24 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    2e24:	55                   	push   %ebp
+    2e25:	89 e5                	mov    %esp,%ebp
+    2e27:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+    2e2a:	83 ec 08             	sub    $0x8,%esp
+    2e2d:	68 d4 73 00 00       	push   $0x73d4
+    2e32:	6a 01                	push   $0x1
+    2e34:	e8 ba 32 00 00       	call   60f3 <printf>
+    2e39:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedfd");
+    2e3c:	83 ec 0c             	sub    $0xc,%esp
+    2e3f:	68 e3 73 00 00       	push   $0x73e3
+    2e44:	e8 fe 30 00 00       	call   5f47 <unlink>
+    2e49:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    2e4c:	83 ec 08             	sub    $0x8,%esp
+    2e4f:	68 02 02 00 00       	push   $0x202
+    2e54:	68 e3 73 00 00       	push   $0x73e3
+    2e59:	e8 d9 30 00 00       	call   5f37 <open>
+    2e5e:	83 c4 10             	add    $0x10,%esp
+    2e61:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    2e64:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2e68:	79 17                	jns    2e81 <sharedfd+0x5d>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    2e6a:	83 ec 08             	sub    $0x8,%esp
+    2e6d:	68 ec 73 00 00       	push   $0x73ec
+    2e72:	6a 01                	push   $0x1
+    2e74:	e8 7a 32 00 00       	call   60f3 <printf>
+    2e79:	83 c4 10             	add    $0x10,%esp
+    return;
+    2e7c:	e9 84 01 00 00       	jmp    3005 <sharedfd+0x1e1>
+  }
+  pid = fork();
+    2e81:	e8 69 30 00 00       	call   5eef <fork>
+    2e86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    2e89:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    2e8d:	75 07                	jne    2e96 <sharedfd+0x72>
+    2e8f:	b8 63 00 00 00       	mov    $0x63,%eax
+    2e94:	eb 05                	jmp    2e9b <sharedfd+0x77>
+    2e96:	b8 70 00 00 00       	mov    $0x70,%eax
+    2e9b:	83 ec 04             	sub    $0x4,%esp
+    2e9e:	6a 0a                	push   $0xa
+    2ea0:	50                   	push   %eax
+    2ea1:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    2ea4:	50                   	push   %eax
+    2ea5:	e8 74 2e 00 00       	call   5d1e <memset>
+    2eaa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+    2ead:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2eb4:	eb 31                	jmp    2ee7 <sharedfd+0xc3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    2eb6:	83 ec 04             	sub    $0x4,%esp
+    2eb9:	6a 0a                	push   $0xa
+    2ebb:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    2ebe:	50                   	push   %eax
+    2ebf:	ff 75 e8             	push   -0x18(%ebp)
+    2ec2:	e8 50 30 00 00       	call   5f17 <write>
+    2ec7:	83 c4 10             	add    $0x10,%esp
+    2eca:	83 f8 0a             	cmp    $0xa,%eax
+    2ecd:	74 14                	je     2ee3 <sharedfd+0xbf>
+      printf(1, "fstests: write sharedfd failed\n");
+    2ecf:	83 ec 08             	sub    $0x8,%esp
+    2ed2:	68 18 74 00 00       	push   $0x7418
+    2ed7:	6a 01                	push   $0x1
+    2ed9:	e8 15 32 00 00       	call   60f3 <printf>
+    2ede:	83 c4 10             	add    $0x10,%esp
+      break;
+    2ee1:	eb 0d                	jmp    2ef0 <sharedfd+0xcc>
+  for(i = 0; i < 1000; i++){
+    2ee3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2ee7:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    2eee:	7e c6                	jle    2eb6 <sharedfd+0x92>
+    }
+  }
+  if(pid == 0)
+    2ef0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    2ef4:	75 05                	jne    2efb <sharedfd+0xd7>
+    exit();
+    2ef6:	e8 fc 2f 00 00       	call   5ef7 <exit>
+  else
+    wait();
+    2efb:	e8 ff 2f 00 00       	call   5eff <wait>
+  close(fd);
+    2f00:	83 ec 0c             	sub    $0xc,%esp
+    2f03:	ff 75 e8             	push   -0x18(%ebp)
+    2f06:	e8 14 30 00 00       	call   5f1f <close>
+    2f0b:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", 0);
+    2f0e:	83 ec 08             	sub    $0x8,%esp
+    2f11:	6a 00                	push   $0x0
+    2f13:	68 e3 73 00 00       	push   $0x73e3
+    2f18:	e8 1a 30 00 00       	call   5f37 <open>
+    2f1d:	83 c4 10             	add    $0x10,%esp
+    2f20:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    2f23:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2f27:	79 17                	jns    2f40 <sharedfd+0x11c>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    2f29:	83 ec 08             	sub    $0x8,%esp
+    2f2c:	68 38 74 00 00       	push   $0x7438
+    2f31:	6a 01                	push   $0x1
+    2f33:	e8 bb 31 00 00       	call   60f3 <printf>
+    2f38:	83 c4 10             	add    $0x10,%esp
+    return;
+    2f3b:	e9 c5 00 00 00       	jmp    3005 <sharedfd+0x1e1>
+  }
+  nc = np = 0;
+    2f40:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    2f47:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    2f4a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    2f4d:	eb 3b                	jmp    2f8a <sharedfd+0x166>
+    for(i = 0; i < sizeof(buf); i++){
+    2f4f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2f56:	eb 2a                	jmp    2f82 <sharedfd+0x15e>
+      if(buf[i] == 'c')
+    2f58:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    2f5b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2f5e:	01 d0                	add    %edx,%eax
+    2f60:	0f b6 00             	movzbl (%eax),%eax
+    2f63:	3c 63                	cmp    $0x63,%al
+    2f65:	75 04                	jne    2f6b <sharedfd+0x147>
+        nc++;
+    2f67:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(buf[i] == 'p')
+    2f6b:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    2f6e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2f71:	01 d0                	add    %edx,%eax
+    2f73:	0f b6 00             	movzbl (%eax),%eax
+    2f76:	3c 70                	cmp    $0x70,%al
+    2f78:	75 04                	jne    2f7e <sharedfd+0x15a>
+        np++;
+    2f7a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < sizeof(buf); i++){
+    2f7e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2f82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2f85:	83 f8 09             	cmp    $0x9,%eax
+    2f88:	76 ce                	jbe    2f58 <sharedfd+0x134>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    2f8a:	83 ec 04             	sub    $0x4,%esp
+    2f8d:	6a 0a                	push   $0xa
+    2f8f:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    2f92:	50                   	push   %eax
+    2f93:	ff 75 e8             	push   -0x18(%ebp)
+    2f96:	e8 74 2f 00 00       	call   5f0f <read>
+    2f9b:	83 c4 10             	add    $0x10,%esp
+    2f9e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    2fa1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    2fa5:	7f a8                	jg     2f4f <sharedfd+0x12b>
+    }
+  }
+  close(fd);
+    2fa7:	83 ec 0c             	sub    $0xc,%esp
+    2faa:	ff 75 e8             	push   -0x18(%ebp)
+    2fad:	e8 6d 2f 00 00       	call   5f1f <close>
+    2fb2:	83 c4 10             	add    $0x10,%esp
+  unlink("sharedfd");
+    2fb5:	83 ec 0c             	sub    $0xc,%esp
+    2fb8:	68 e3 73 00 00       	push   $0x73e3
+    2fbd:	e8 85 2f 00 00       	call   5f47 <unlink>
+    2fc2:	83 c4 10             	add    $0x10,%esp
+  if(nc == 10000 && np == 10000){
+    2fc5:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    2fcc:	75 1d                	jne    2feb <sharedfd+0x1c7>
+    2fce:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    2fd5:	75 14                	jne    2feb <sharedfd+0x1c7>
+    printf(1, "sharedfd ok\n");
+    2fd7:	83 ec 08             	sub    $0x8,%esp
+    2fda:	68 63 74 00 00       	push   $0x7463
+    2fdf:	6a 01                	push   $0x1
+    2fe1:	e8 0d 31 00 00       	call   60f3 <printf>
+    2fe6:	83 c4 10             	add    $0x10,%esp
+    2fe9:	eb 1a                	jmp    3005 <sharedfd+0x1e1>
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    2feb:	ff 75 ec             	push   -0x14(%ebp)
+    2fee:	ff 75 f0             	push   -0x10(%ebp)
+    2ff1:	68 70 74 00 00       	push   $0x7470
+    2ff6:	6a 01                	push   $0x1
+    2ff8:	e8 f6 30 00 00       	call   60f3 <printf>
+    2ffd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3000:	e8 f2 2e 00 00       	call   5ef7 <exit>
+  }
+}
+    3005:	c9                   	leave
+    3006:	c3                   	ret
+
+00003007 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    3007:	55                   	push   %ebp
+    3008:	89 e5                	mov    %esp,%ebp
+    300a:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    300d:	c7 45 c8 85 74 00 00 	movl   $0x7485,-0x38(%ebp)
+    3014:	c7 45 cc b0 71 00 00 	movl   $0x71b0,-0x34(%ebp)
+    301b:	c7 45 d0 88 74 00 00 	movl   $0x7488,-0x30(%ebp)
+    3022:	c7 45 d4 8b 74 00 00 	movl   $0x748b,-0x2c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    3029:	83 ec 08             	sub    $0x8,%esp
+    302c:	68 8e 74 00 00       	push   $0x748e
+    3031:	6a 01                	push   $0x1
+    3033:	e8 bb 30 00 00       	call   60f3 <printf>
+    3038:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    303b:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    3042:	e9 f0 00 00 00       	jmp    3137 <fourfiles+0x130>
+    fname = names[pi];
+    3047:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    304a:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    304e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    unlink(fname);
+    3051:	83 ec 0c             	sub    $0xc,%esp
+    3054:	ff 75 e4             	push   -0x1c(%ebp)
+    3057:	e8 eb 2e 00 00       	call   5f47 <unlink>
+    305c:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+    305f:	e8 8b 2e 00 00       	call   5eef <fork>
+    3064:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(pid < 0){
+    3067:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    306b:	79 17                	jns    3084 <fourfiles+0x7d>
+      printf(1, "fork failed\n");
+    306d:	83 ec 08             	sub    $0x8,%esp
+    3070:	68 4d 65 00 00       	push   $0x654d
+    3075:	6a 01                	push   $0x1
+    3077:	e8 77 30 00 00       	call   60f3 <printf>
+    307c:	83 c4 10             	add    $0x10,%esp
+      exit();
+    307f:	e8 73 2e 00 00       	call   5ef7 <exit>
+    }
+
+    if(pid == 0){
+    3084:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    3088:	0f 85 a5 00 00 00    	jne    3133 <fourfiles+0x12c>
+      fd = open(fname, O_CREATE | O_RDWR);
+    308e:	83 ec 08             	sub    $0x8,%esp
+    3091:	68 02 02 00 00       	push   $0x202
+    3096:	ff 75 e4             	push   -0x1c(%ebp)
+    3099:	e8 99 2e 00 00       	call   5f37 <open>
+    309e:	83 c4 10             	add    $0x10,%esp
+    30a1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      if(fd < 0){
+    30a4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    30a8:	79 17                	jns    30c1 <fourfiles+0xba>
+        printf(1, "create failed\n");
+    30aa:	83 ec 08             	sub    $0x8,%esp
+    30ad:	68 9e 74 00 00       	push   $0x749e
+    30b2:	6a 01                	push   $0x1
+    30b4:	e8 3a 30 00 00       	call   60f3 <printf>
+    30b9:	83 c4 10             	add    $0x10,%esp
+        exit();
+    30bc:	e8 36 2e 00 00       	call   5ef7 <exit>
+      }
+      
+      memset(buf, '0'+pi, 512);
+    30c1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    30c4:	83 c0 30             	add    $0x30,%eax
+    30c7:	83 ec 04             	sub    $0x4,%esp
+    30ca:	68 00 02 00 00       	push   $0x200
+    30cf:	50                   	push   %eax
+    30d0:	68 e0 8e 00 00       	push   $0x8ee0
+    30d5:	e8 44 2c 00 00       	call   5d1e <memset>
+    30da:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < 12; i++){
+    30dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    30e4:	eb 42                	jmp    3128 <fourfiles+0x121>
+        if((n = write(fd, buf, 500)) != 500){
+    30e6:	83 ec 04             	sub    $0x4,%esp
+    30e9:	68 f4 01 00 00       	push   $0x1f4
+    30ee:	68 e0 8e 00 00       	push   $0x8ee0
+    30f3:	ff 75 e0             	push   -0x20(%ebp)
+    30f6:	e8 1c 2e 00 00       	call   5f17 <write>
+    30fb:	83 c4 10             	add    $0x10,%esp
+    30fe:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    3101:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    3108:	74 1a                	je     3124 <fourfiles+0x11d>
+          printf(1, "write failed %d\n", n);
+    310a:	83 ec 04             	sub    $0x4,%esp
+    310d:	ff 75 dc             	push   -0x24(%ebp)
+    3110:	68 ad 74 00 00       	push   $0x74ad
+    3115:	6a 01                	push   $0x1
+    3117:	e8 d7 2f 00 00       	call   60f3 <printf>
+    311c:	83 c4 10             	add    $0x10,%esp
+          exit();
+    311f:	e8 d3 2d 00 00       	call   5ef7 <exit>
+      for(i = 0; i < 12; i++){
+    3124:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3128:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    312c:	7e b8                	jle    30e6 <fourfiles+0xdf>
+        }
+      }
+      exit();
+    312e:	e8 c4 2d 00 00       	call   5ef7 <exit>
+  for(pi = 0; pi < 4; pi++){
+    3133:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    3137:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    313b:	0f 8e 06 ff ff ff    	jle    3047 <fourfiles+0x40>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    3141:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    3148:	eb 09                	jmp    3153 <fourfiles+0x14c>
+    wait();
+    314a:	e8 b0 2d 00 00       	call   5eff <wait>
+  for(pi = 0; pi < 4; pi++){
+    314f:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    3153:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    3157:	7e f1                	jle    314a <fourfiles+0x143>
+  }
+
+  for(i = 0; i < 2; i++){
+    3159:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3160:	e9 d4 00 00 00       	jmp    3239 <fourfiles+0x232>
+    fname = names[i];
+    3165:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3168:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    316c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    fd = open(fname, 0);
+    316f:	83 ec 08             	sub    $0x8,%esp
+    3172:	6a 00                	push   $0x0
+    3174:	ff 75 e4             	push   -0x1c(%ebp)
+    3177:	e8 bb 2d 00 00       	call   5f37 <open>
+    317c:	83 c4 10             	add    $0x10,%esp
+    317f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    total = 0;
+    3182:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    3189:	eb 4a                	jmp    31d5 <fourfiles+0x1ce>
+      for(j = 0; j < n; j++){
+    318b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3192:	eb 33                	jmp    31c7 <fourfiles+0x1c0>
+        if(buf[j] != '0'+i){
+    3194:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3197:	05 e0 8e 00 00       	add    $0x8ee0,%eax
+    319c:	0f b6 00             	movzbl (%eax),%eax
+    319f:	0f be d0             	movsbl %al,%edx
+    31a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    31a5:	83 c0 30             	add    $0x30,%eax
+    31a8:	39 c2                	cmp    %eax,%edx
+    31aa:	74 17                	je     31c3 <fourfiles+0x1bc>
+          printf(1, "wrong char\n");
+    31ac:	83 ec 08             	sub    $0x8,%esp
+    31af:	68 be 74 00 00       	push   $0x74be
+    31b4:	6a 01                	push   $0x1
+    31b6:	e8 38 2f 00 00       	call   60f3 <printf>
+    31bb:	83 c4 10             	add    $0x10,%esp
+          exit();
+    31be:	e8 34 2d 00 00       	call   5ef7 <exit>
+      for(j = 0; j < n; j++){
+    31c3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    31c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    31ca:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    31cd:	7c c5                	jl     3194 <fourfiles+0x18d>
+        }
+      }
+      total += n;
+    31cf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    31d2:	01 45 ec             	add    %eax,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    31d5:	83 ec 04             	sub    $0x4,%esp
+    31d8:	68 00 20 00 00       	push   $0x2000
+    31dd:	68 e0 8e 00 00       	push   $0x8ee0
+    31e2:	ff 75 e0             	push   -0x20(%ebp)
+    31e5:	e8 25 2d 00 00       	call   5f0f <read>
+    31ea:	83 c4 10             	add    $0x10,%esp
+    31ed:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    31f0:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    31f4:	7f 95                	jg     318b <fourfiles+0x184>
+    }
+    close(fd);
+    31f6:	83 ec 0c             	sub    $0xc,%esp
+    31f9:	ff 75 e0             	push   -0x20(%ebp)
+    31fc:	e8 1e 2d 00 00       	call   5f1f <close>
+    3201:	83 c4 10             	add    $0x10,%esp
+    if(total != 12*500){
+    3204:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    320b:	74 1a                	je     3227 <fourfiles+0x220>
+      printf(1, "wrong length %d\n", total);
+    320d:	83 ec 04             	sub    $0x4,%esp
+    3210:	ff 75 ec             	push   -0x14(%ebp)
+    3213:	68 ca 74 00 00       	push   $0x74ca
+    3218:	6a 01                	push   $0x1
+    321a:	e8 d4 2e 00 00       	call   60f3 <printf>
+    321f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3222:	e8 d0 2c 00 00       	call   5ef7 <exit>
+    }
+    unlink(fname);
+    3227:	83 ec 0c             	sub    $0xc,%esp
+    322a:	ff 75 e4             	push   -0x1c(%ebp)
+    322d:	e8 15 2d 00 00       	call   5f47 <unlink>
+    3232:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+    3235:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3239:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    323d:	0f 8e 22 ff ff ff    	jle    3165 <fourfiles+0x15e>
+  }
+
+  printf(1, "fourfiles ok\n");
+    3243:	83 ec 08             	sub    $0x8,%esp
+    3246:	68 db 74 00 00       	push   $0x74db
+    324b:	6a 01                	push   $0x1
+    324d:	e8 a1 2e 00 00       	call   60f3 <printf>
+    3252:	83 c4 10             	add    $0x10,%esp
+}
+    3255:	90                   	nop
+    3256:	c9                   	leave
+    3257:	c3                   	ret
+
+00003258 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    3258:	55                   	push   %ebp
+    3259:	89 e5                	mov    %esp,%ebp
+    325b:	83 ec 38             	sub    $0x38,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    325e:	83 ec 08             	sub    $0x8,%esp
+    3261:	68 e9 74 00 00       	push   $0x74e9
+    3266:	6a 01                	push   $0x1
+    3268:	e8 86 2e 00 00       	call   60f3 <printf>
+    326d:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    3270:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3277:	e9 f6 00 00 00       	jmp    3372 <createdelete+0x11a>
+    pid = fork();
+    327c:	e8 6e 2c 00 00       	call   5eef <fork>
+    3281:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    3284:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3288:	79 17                	jns    32a1 <createdelete+0x49>
+      printf(1, "fork failed\n");
+    328a:	83 ec 08             	sub    $0x8,%esp
+    328d:	68 4d 65 00 00       	push   $0x654d
+    3292:	6a 01                	push   $0x1
+    3294:	e8 5a 2e 00 00       	call   60f3 <printf>
+    3299:	83 c4 10             	add    $0x10,%esp
+      exit();
+    329c:	e8 56 2c 00 00       	call   5ef7 <exit>
+    }
+
+    if(pid == 0){
+    32a1:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    32a5:	0f 85 c3 00 00 00    	jne    336e <createdelete+0x116>
+      name[0] = 'p' + pi;
+    32ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    32ae:	83 c0 70             	add    $0x70,%eax
+    32b1:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    32b4:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+      for(i = 0; i < N; i++){
+    32b8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    32bf:	e9 9b 00 00 00       	jmp    335f <createdelete+0x107>
+        name[1] = '0' + i;
+    32c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    32c7:	83 c0 30             	add    $0x30,%eax
+    32ca:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    32cd:	83 ec 08             	sub    $0x8,%esp
+    32d0:	68 02 02 00 00       	push   $0x202
+    32d5:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    32d8:	50                   	push   %eax
+    32d9:	e8 59 2c 00 00       	call   5f37 <open>
+    32de:	83 c4 10             	add    $0x10,%esp
+    32e1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0){
+    32e4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    32e8:	79 17                	jns    3301 <createdelete+0xa9>
+          printf(1, "create failed\n");
+    32ea:	83 ec 08             	sub    $0x8,%esp
+    32ed:	68 9e 74 00 00       	push   $0x749e
+    32f2:	6a 01                	push   $0x1
+    32f4:	e8 fa 2d 00 00       	call   60f3 <printf>
+    32f9:	83 c4 10             	add    $0x10,%esp
+          exit();
+    32fc:	e8 f6 2b 00 00       	call   5ef7 <exit>
+        }
+        close(fd);
+    3301:	83 ec 0c             	sub    $0xc,%esp
+    3304:	ff 75 ec             	push   -0x14(%ebp)
+    3307:	e8 13 2c 00 00       	call   5f1f <close>
+    330c:	83 c4 10             	add    $0x10,%esp
+        if(i > 0 && (i % 2 ) == 0){
+    330f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3313:	7e 46                	jle    335b <createdelete+0x103>
+    3315:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3318:	83 e0 01             	and    $0x1,%eax
+    331b:	85 c0                	test   %eax,%eax
+    331d:	75 3c                	jne    335b <createdelete+0x103>
+          name[1] = '0' + (i / 2);
+    331f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3322:	89 c2                	mov    %eax,%edx
+    3324:	c1 ea 1f             	shr    $0x1f,%edx
+    3327:	01 d0                	add    %edx,%eax
+    3329:	d1 f8                	sar    %eax
+    332b:	83 c0 30             	add    $0x30,%eax
+    332e:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    3331:	83 ec 0c             	sub    $0xc,%esp
+    3334:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3337:	50                   	push   %eax
+    3338:	e8 0a 2c 00 00       	call   5f47 <unlink>
+    333d:	83 c4 10             	add    $0x10,%esp
+    3340:	85 c0                	test   %eax,%eax
+    3342:	79 17                	jns    335b <createdelete+0x103>
+            printf(1, "unlink failed\n");
+    3344:	83 ec 08             	sub    $0x8,%esp
+    3347:	68 d0 65 00 00       	push   $0x65d0
+    334c:	6a 01                	push   $0x1
+    334e:	e8 a0 2d 00 00       	call   60f3 <printf>
+    3353:	83 c4 10             	add    $0x10,%esp
+            exit();
+    3356:	e8 9c 2b 00 00       	call   5ef7 <exit>
+      for(i = 0; i < N; i++){
+    335b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    335f:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    3363:	0f 8e 5b ff ff ff    	jle    32c4 <createdelete+0x6c>
+          }
+        }
+      }
+      exit();
+    3369:	e8 89 2b 00 00       	call   5ef7 <exit>
+  for(pi = 0; pi < 4; pi++){
+    336e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3372:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    3376:	0f 8e 00 ff ff ff    	jle    327c <createdelete+0x24>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    337c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3383:	eb 09                	jmp    338e <createdelete+0x136>
+    wait();
+    3385:	e8 75 2b 00 00       	call   5eff <wait>
+  for(pi = 0; pi < 4; pi++){
+    338a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    338e:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    3392:	7e f1                	jle    3385 <createdelete+0x12d>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    3394:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    3398:	0f b6 45 ca          	movzbl -0x36(%ebp),%eax
+    339c:	88 45 c9             	mov    %al,-0x37(%ebp)
+    339f:	0f b6 45 c9          	movzbl -0x37(%ebp),%eax
+    33a3:	88 45 c8             	mov    %al,-0x38(%ebp)
+  for(i = 0; i < N; i++){
+    33a6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    33ad:	e9 b2 00 00 00       	jmp    3464 <createdelete+0x20c>
+    for(pi = 0; pi < 4; pi++){
+    33b2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    33b9:	e9 98 00 00 00       	jmp    3456 <createdelete+0x1fe>
+      name[0] = 'p' + pi;
+    33be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    33c1:	83 c0 70             	add    $0x70,%eax
+    33c4:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    33c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    33ca:	83 c0 30             	add    $0x30,%eax
+    33cd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    33d0:	83 ec 08             	sub    $0x8,%esp
+    33d3:	6a 00                	push   $0x0
+    33d5:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    33d8:	50                   	push   %eax
+    33d9:	e8 59 2b 00 00       	call   5f37 <open>
+    33de:	83 c4 10             	add    $0x10,%esp
+    33e1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    33e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    33e8:	74 06                	je     33f0 <createdelete+0x198>
+    33ea:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    33ee:	7e 21                	jle    3411 <createdelete+0x1b9>
+    33f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    33f4:	79 1b                	jns    3411 <createdelete+0x1b9>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    33f6:	83 ec 04             	sub    $0x4,%esp
+    33f9:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    33fc:	50                   	push   %eax
+    33fd:	68 fc 74 00 00       	push   $0x74fc
+    3402:	6a 01                	push   $0x1
+    3404:	e8 ea 2c 00 00       	call   60f3 <printf>
+    3409:	83 c4 10             	add    $0x10,%esp
+        exit();
+    340c:	e8 e6 2a 00 00       	call   5ef7 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    3411:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3415:	7e 27                	jle    343e <createdelete+0x1e6>
+    3417:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    341b:	7f 21                	jg     343e <createdelete+0x1e6>
+    341d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3421:	78 1b                	js     343e <createdelete+0x1e6>
+        printf(1, "oops createdelete %s did exist\n", name);
+    3423:	83 ec 04             	sub    $0x4,%esp
+    3426:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3429:	50                   	push   %eax
+    342a:	68 20 75 00 00       	push   $0x7520
+    342f:	6a 01                	push   $0x1
+    3431:	e8 bd 2c 00 00       	call   60f3 <printf>
+    3436:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3439:	e8 b9 2a 00 00       	call   5ef7 <exit>
+      }
+      if(fd >= 0)
+    343e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3442:	78 0e                	js     3452 <createdelete+0x1fa>
+        close(fd);
+    3444:	83 ec 0c             	sub    $0xc,%esp
+    3447:	ff 75 ec             	push   -0x14(%ebp)
+    344a:	e8 d0 2a 00 00       	call   5f1f <close>
+    344f:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    3452:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3456:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    345a:	0f 8e 5e ff ff ff    	jle    33be <createdelete+0x166>
+  for(i = 0; i < N; i++){
+    3460:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3464:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    3468:	0f 8e 44 ff ff ff    	jle    33b2 <createdelete+0x15a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    346e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3475:	eb 38                	jmp    34af <createdelete+0x257>
+    for(pi = 0; pi < 4; pi++){
+    3477:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    347e:	eb 25                	jmp    34a5 <createdelete+0x24d>
+      name[0] = 'p' + i;
+    3480:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3483:	83 c0 70             	add    $0x70,%eax
+    3486:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    3489:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    348c:	83 c0 30             	add    $0x30,%eax
+    348f:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    3492:	83 ec 0c             	sub    $0xc,%esp
+    3495:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3498:	50                   	push   %eax
+    3499:	e8 a9 2a 00 00       	call   5f47 <unlink>
+    349e:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    34a1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    34a5:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    34a9:	7e d5                	jle    3480 <createdelete+0x228>
+  for(i = 0; i < N; i++){
+    34ab:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    34af:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    34b3:	7e c2                	jle    3477 <createdelete+0x21f>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    34b5:	83 ec 08             	sub    $0x8,%esp
+    34b8:	68 40 75 00 00       	push   $0x7540
+    34bd:	6a 01                	push   $0x1
+    34bf:	e8 2f 2c 00 00       	call   60f3 <printf>
+    34c4:	83 c4 10             	add    $0x10,%esp
+}
+    34c7:	90                   	nop
+    34c8:	c9                   	leave
+    34c9:	c3                   	ret
+
+000034ca <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    34ca:	55                   	push   %ebp
+    34cb:	89 e5                	mov    %esp,%ebp
+    34cd:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    34d0:	83 ec 08             	sub    $0x8,%esp
+    34d3:	68 51 75 00 00       	push   $0x7551
+    34d8:	6a 01                	push   $0x1
+    34da:	e8 14 2c 00 00       	call   60f3 <printf>
+    34df:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    34e2:	83 ec 08             	sub    $0x8,%esp
+    34e5:	68 02 02 00 00       	push   $0x202
+    34ea:	68 62 75 00 00       	push   $0x7562
+    34ef:	e8 43 2a 00 00       	call   5f37 <open>
+    34f4:	83 c4 10             	add    $0x10,%esp
+    34f7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    34fa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    34fe:	79 17                	jns    3517 <unlinkread+0x4d>
+    printf(1, "create unlinkread failed\n");
+    3500:	83 ec 08             	sub    $0x8,%esp
+    3503:	68 6d 75 00 00       	push   $0x756d
+    3508:	6a 01                	push   $0x1
+    350a:	e8 e4 2b 00 00       	call   60f3 <printf>
+    350f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3512:	e8 e0 29 00 00       	call   5ef7 <exit>
+  }
+  write(fd, "hello", 5);
+    3517:	83 ec 04             	sub    $0x4,%esp
+    351a:	6a 05                	push   $0x5
+    351c:	68 87 75 00 00       	push   $0x7587
+    3521:	ff 75 f4             	push   -0xc(%ebp)
+    3524:	e8 ee 29 00 00       	call   5f17 <write>
+    3529:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    352c:	83 ec 0c             	sub    $0xc,%esp
+    352f:	ff 75 f4             	push   -0xc(%ebp)
+    3532:	e8 e8 29 00 00       	call   5f1f <close>
+    3537:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("unlinkread", O_RDWR);
+    353a:	83 ec 08             	sub    $0x8,%esp
+    353d:	6a 02                	push   $0x2
+    353f:	68 62 75 00 00       	push   $0x7562
+    3544:	e8 ee 29 00 00       	call   5f37 <open>
+    3549:	83 c4 10             	add    $0x10,%esp
+    354c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    354f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3553:	79 17                	jns    356c <unlinkread+0xa2>
+    printf(1, "open unlinkread failed\n");
+    3555:	83 ec 08             	sub    $0x8,%esp
+    3558:	68 8d 75 00 00       	push   $0x758d
+    355d:	6a 01                	push   $0x1
+    355f:	e8 8f 2b 00 00       	call   60f3 <printf>
+    3564:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3567:	e8 8b 29 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("unlinkread") != 0){
+    356c:	83 ec 0c             	sub    $0xc,%esp
+    356f:	68 62 75 00 00       	push   $0x7562
+    3574:	e8 ce 29 00 00       	call   5f47 <unlink>
+    3579:	83 c4 10             	add    $0x10,%esp
+    357c:	85 c0                	test   %eax,%eax
+    357e:	74 17                	je     3597 <unlinkread+0xcd>
+    printf(1, "unlink unlinkread failed\n");
+    3580:	83 ec 08             	sub    $0x8,%esp
+    3583:	68 a5 75 00 00       	push   $0x75a5
+    3588:	6a 01                	push   $0x1
+    358a:	e8 64 2b 00 00       	call   60f3 <printf>
+    358f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3592:	e8 60 29 00 00       	call   5ef7 <exit>
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    3597:	83 ec 08             	sub    $0x8,%esp
+    359a:	68 02 02 00 00       	push   $0x202
+    359f:	68 62 75 00 00       	push   $0x7562
+    35a4:	e8 8e 29 00 00       	call   5f37 <open>
+    35a9:	83 c4 10             	add    $0x10,%esp
+    35ac:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  write(fd1, "yyy", 3);
+    35af:	83 ec 04             	sub    $0x4,%esp
+    35b2:	6a 03                	push   $0x3
+    35b4:	68 bf 75 00 00       	push   $0x75bf
+    35b9:	ff 75 f0             	push   -0x10(%ebp)
+    35bc:	e8 56 29 00 00       	call   5f17 <write>
+    35c1:	83 c4 10             	add    $0x10,%esp
+  close(fd1);
+    35c4:	83 ec 0c             	sub    $0xc,%esp
+    35c7:	ff 75 f0             	push   -0x10(%ebp)
+    35ca:	e8 50 29 00 00       	call   5f1f <close>
+    35cf:	83 c4 10             	add    $0x10,%esp
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    35d2:	83 ec 04             	sub    $0x4,%esp
+    35d5:	68 00 20 00 00       	push   $0x2000
+    35da:	68 e0 8e 00 00       	push   $0x8ee0
+    35df:	ff 75 f4             	push   -0xc(%ebp)
+    35e2:	e8 28 29 00 00       	call   5f0f <read>
+    35e7:	83 c4 10             	add    $0x10,%esp
+    35ea:	83 f8 05             	cmp    $0x5,%eax
+    35ed:	74 17                	je     3606 <unlinkread+0x13c>
+    printf(1, "unlinkread read failed");
+    35ef:	83 ec 08             	sub    $0x8,%esp
+    35f2:	68 c3 75 00 00       	push   $0x75c3
+    35f7:	6a 01                	push   $0x1
+    35f9:	e8 f5 2a 00 00       	call   60f3 <printf>
+    35fe:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3601:	e8 f1 28 00 00       	call   5ef7 <exit>
+  }
+  if(buf[0] != 'h'){
+    3606:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    360d:	3c 68                	cmp    $0x68,%al
+    360f:	74 17                	je     3628 <unlinkread+0x15e>
+    printf(1, "unlinkread wrong data\n");
+    3611:	83 ec 08             	sub    $0x8,%esp
+    3614:	68 da 75 00 00       	push   $0x75da
+    3619:	6a 01                	push   $0x1
+    361b:	e8 d3 2a 00 00       	call   60f3 <printf>
+    3620:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3623:	e8 cf 28 00 00       	call   5ef7 <exit>
+  }
+  if(write(fd, buf, 10) != 10){
+    3628:	83 ec 04             	sub    $0x4,%esp
+    362b:	6a 0a                	push   $0xa
+    362d:	68 e0 8e 00 00       	push   $0x8ee0
+    3632:	ff 75 f4             	push   -0xc(%ebp)
+    3635:	e8 dd 28 00 00       	call   5f17 <write>
+    363a:	83 c4 10             	add    $0x10,%esp
+    363d:	83 f8 0a             	cmp    $0xa,%eax
+    3640:	74 17                	je     3659 <unlinkread+0x18f>
+    printf(1, "unlinkread write failed\n");
+    3642:	83 ec 08             	sub    $0x8,%esp
+    3645:	68 f1 75 00 00       	push   $0x75f1
+    364a:	6a 01                	push   $0x1
+    364c:	e8 a2 2a 00 00       	call   60f3 <printf>
+    3651:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3654:	e8 9e 28 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    3659:	83 ec 0c             	sub    $0xc,%esp
+    365c:	ff 75 f4             	push   -0xc(%ebp)
+    365f:	e8 bb 28 00 00       	call   5f1f <close>
+    3664:	83 c4 10             	add    $0x10,%esp
+  unlink("unlinkread");
+    3667:	83 ec 0c             	sub    $0xc,%esp
+    366a:	68 62 75 00 00       	push   $0x7562
+    366f:	e8 d3 28 00 00       	call   5f47 <unlink>
+    3674:	83 c4 10             	add    $0x10,%esp
+  printf(1, "unlinkread ok\n");
+    3677:	83 ec 08             	sub    $0x8,%esp
+    367a:	68 0a 76 00 00       	push   $0x760a
+    367f:	6a 01                	push   $0x1
+    3681:	e8 6d 2a 00 00       	call   60f3 <printf>
+    3686:	83 c4 10             	add    $0x10,%esp
+}
+    3689:	90                   	nop
+    368a:	c9                   	leave
+    368b:	c3                   	ret
+
+0000368c <linktest>:
+
+void
+linktest(void)
+{
+    368c:	55                   	push   %ebp
+    368d:	89 e5                	mov    %esp,%ebp
+    368f:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    3692:	83 ec 08             	sub    $0x8,%esp
+    3695:	68 19 76 00 00       	push   $0x7619
+    369a:	6a 01                	push   $0x1
+    369c:	e8 52 2a 00 00       	call   60f3 <printf>
+    36a1:	83 c4 10             	add    $0x10,%esp
+
+  unlink("lf1");
+    36a4:	83 ec 0c             	sub    $0xc,%esp
+    36a7:	68 23 76 00 00       	push   $0x7623
+    36ac:	e8 96 28 00 00       	call   5f47 <unlink>
+    36b1:	83 c4 10             	add    $0x10,%esp
+  unlink("lf2");
+    36b4:	83 ec 0c             	sub    $0xc,%esp
+    36b7:	68 27 76 00 00       	push   $0x7627
+    36bc:	e8 86 28 00 00       	call   5f47 <unlink>
+    36c1:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    36c4:	83 ec 08             	sub    $0x8,%esp
+    36c7:	68 02 02 00 00       	push   $0x202
+    36cc:	68 23 76 00 00       	push   $0x7623
+    36d1:	e8 61 28 00 00       	call   5f37 <open>
+    36d6:	83 c4 10             	add    $0x10,%esp
+    36d9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    36dc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    36e0:	79 17                	jns    36f9 <linktest+0x6d>
+    printf(1, "create lf1 failed\n");
+    36e2:	83 ec 08             	sub    $0x8,%esp
+    36e5:	68 2b 76 00 00       	push   $0x762b
+    36ea:	6a 01                	push   $0x1
+    36ec:	e8 02 2a 00 00       	call   60f3 <printf>
+    36f1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    36f4:	e8 fe 27 00 00       	call   5ef7 <exit>
+  }
+  if(write(fd, "hello", 5) != 5){
+    36f9:	83 ec 04             	sub    $0x4,%esp
+    36fc:	6a 05                	push   $0x5
+    36fe:	68 87 75 00 00       	push   $0x7587
+    3703:	ff 75 f4             	push   -0xc(%ebp)
+    3706:	e8 0c 28 00 00       	call   5f17 <write>
+    370b:	83 c4 10             	add    $0x10,%esp
+    370e:	83 f8 05             	cmp    $0x5,%eax
+    3711:	74 17                	je     372a <linktest+0x9e>
+    printf(1, "write lf1 failed\n");
+    3713:	83 ec 08             	sub    $0x8,%esp
+    3716:	68 3e 76 00 00       	push   $0x763e
+    371b:	6a 01                	push   $0x1
+    371d:	e8 d1 29 00 00       	call   60f3 <printf>
+    3722:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3725:	e8 cd 27 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    372a:	83 ec 0c             	sub    $0xc,%esp
+    372d:	ff 75 f4             	push   -0xc(%ebp)
+    3730:	e8 ea 27 00 00       	call   5f1f <close>
+    3735:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf1", "lf2") < 0){
+    3738:	83 ec 08             	sub    $0x8,%esp
+    373b:	68 27 76 00 00       	push   $0x7627
+    3740:	68 23 76 00 00       	push   $0x7623
+    3745:	e8 0d 28 00 00       	call   5f57 <link>
+    374a:	83 c4 10             	add    $0x10,%esp
+    374d:	85 c0                	test   %eax,%eax
+    374f:	79 17                	jns    3768 <linktest+0xdc>
+    printf(1, "link lf1 lf2 failed\n");
+    3751:	83 ec 08             	sub    $0x8,%esp
+    3754:	68 50 76 00 00       	push   $0x7650
+    3759:	6a 01                	push   $0x1
+    375b:	e8 93 29 00 00       	call   60f3 <printf>
+    3760:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3763:	e8 8f 27 00 00       	call   5ef7 <exit>
+  }
+  unlink("lf1");
+    3768:	83 ec 0c             	sub    $0xc,%esp
+    376b:	68 23 76 00 00       	push   $0x7623
+    3770:	e8 d2 27 00 00       	call   5f47 <unlink>
+    3775:	83 c4 10             	add    $0x10,%esp
+
+  if(open("lf1", 0) >= 0){
+    3778:	83 ec 08             	sub    $0x8,%esp
+    377b:	6a 00                	push   $0x0
+    377d:	68 23 76 00 00       	push   $0x7623
+    3782:	e8 b0 27 00 00       	call   5f37 <open>
+    3787:	83 c4 10             	add    $0x10,%esp
+    378a:	85 c0                	test   %eax,%eax
+    378c:	78 17                	js     37a5 <linktest+0x119>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    378e:	83 ec 08             	sub    $0x8,%esp
+    3791:	68 68 76 00 00       	push   $0x7668
+    3796:	6a 01                	push   $0x1
+    3798:	e8 56 29 00 00       	call   60f3 <printf>
+    379d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37a0:	e8 52 27 00 00       	call   5ef7 <exit>
+  }
+
+  fd = open("lf2", 0);
+    37a5:	83 ec 08             	sub    $0x8,%esp
+    37a8:	6a 00                	push   $0x0
+    37aa:	68 27 76 00 00       	push   $0x7627
+    37af:	e8 83 27 00 00       	call   5f37 <open>
+    37b4:	83 c4 10             	add    $0x10,%esp
+    37b7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    37ba:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    37be:	79 17                	jns    37d7 <linktest+0x14b>
+    printf(1, "open lf2 failed\n");
+    37c0:	83 ec 08             	sub    $0x8,%esp
+    37c3:	68 8d 76 00 00       	push   $0x768d
+    37c8:	6a 01                	push   $0x1
+    37ca:	e8 24 29 00 00       	call   60f3 <printf>
+    37cf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37d2:	e8 20 27 00 00       	call   5ef7 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    37d7:	83 ec 04             	sub    $0x4,%esp
+    37da:	68 00 20 00 00       	push   $0x2000
+    37df:	68 e0 8e 00 00       	push   $0x8ee0
+    37e4:	ff 75 f4             	push   -0xc(%ebp)
+    37e7:	e8 23 27 00 00       	call   5f0f <read>
+    37ec:	83 c4 10             	add    $0x10,%esp
+    37ef:	83 f8 05             	cmp    $0x5,%eax
+    37f2:	74 17                	je     380b <linktest+0x17f>
+    printf(1, "read lf2 failed\n");
+    37f4:	83 ec 08             	sub    $0x8,%esp
+    37f7:	68 9e 76 00 00       	push   $0x769e
+    37fc:	6a 01                	push   $0x1
+    37fe:	e8 f0 28 00 00       	call   60f3 <printf>
+    3803:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3806:	e8 ec 26 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    380b:	83 ec 0c             	sub    $0xc,%esp
+    380e:	ff 75 f4             	push   -0xc(%ebp)
+    3811:	e8 09 27 00 00       	call   5f1f <close>
+    3816:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf2", "lf2") >= 0){
+    3819:	83 ec 08             	sub    $0x8,%esp
+    381c:	68 27 76 00 00       	push   $0x7627
+    3821:	68 27 76 00 00       	push   $0x7627
+    3826:	e8 2c 27 00 00       	call   5f57 <link>
+    382b:	83 c4 10             	add    $0x10,%esp
+    382e:	85 c0                	test   %eax,%eax
+    3830:	78 17                	js     3849 <linktest+0x1bd>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    3832:	83 ec 08             	sub    $0x8,%esp
+    3835:	68 af 76 00 00       	push   $0x76af
+    383a:	6a 01                	push   $0x1
+    383c:	e8 b2 28 00 00       	call   60f3 <printf>
+    3841:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3844:	e8 ae 26 00 00       	call   5ef7 <exit>
+  }
+
+  unlink("lf2");
+    3849:	83 ec 0c             	sub    $0xc,%esp
+    384c:	68 27 76 00 00       	push   $0x7627
+    3851:	e8 f1 26 00 00       	call   5f47 <unlink>
+    3856:	83 c4 10             	add    $0x10,%esp
+  if(link("lf2", "lf1") >= 0){
+    3859:	83 ec 08             	sub    $0x8,%esp
+    385c:	68 23 76 00 00       	push   $0x7623
+    3861:	68 27 76 00 00       	push   $0x7627
+    3866:	e8 ec 26 00 00       	call   5f57 <link>
+    386b:	83 c4 10             	add    $0x10,%esp
+    386e:	85 c0                	test   %eax,%eax
+    3870:	78 17                	js     3889 <linktest+0x1fd>
+    printf(1, "link non-existant succeeded! oops\n");
+    3872:	83 ec 08             	sub    $0x8,%esp
+    3875:	68 d0 76 00 00       	push   $0x76d0
+    387a:	6a 01                	push   $0x1
+    387c:	e8 72 28 00 00       	call   60f3 <printf>
+    3881:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3884:	e8 6e 26 00 00       	call   5ef7 <exit>
+  }
+
+  if(link(".", "lf1") >= 0){
+    3889:	83 ec 08             	sub    $0x8,%esp
+    388c:	68 23 76 00 00       	push   $0x7623
+    3891:	68 0b 72 00 00       	push   $0x720b
+    3896:	e8 bc 26 00 00       	call   5f57 <link>
+    389b:	83 c4 10             	add    $0x10,%esp
+    389e:	85 c0                	test   %eax,%eax
+    38a0:	78 17                	js     38b9 <linktest+0x22d>
+    printf(1, "link . lf1 succeeded! oops\n");
+    38a2:	83 ec 08             	sub    $0x8,%esp
+    38a5:	68 f3 76 00 00       	push   $0x76f3
+    38aa:	6a 01                	push   $0x1
+    38ac:	e8 42 28 00 00       	call   60f3 <printf>
+    38b1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    38b4:	e8 3e 26 00 00       	call   5ef7 <exit>
+  }
+
+  printf(1, "linktest ok\n");
+    38b9:	83 ec 08             	sub    $0x8,%esp
+    38bc:	68 0f 77 00 00       	push   $0x770f
+    38c1:	6a 01                	push   $0x1
+    38c3:	e8 2b 28 00 00       	call   60f3 <printf>
+    38c8:	83 c4 10             	add    $0x10,%esp
+}
+    38cb:	90                   	nop
+    38cc:	c9                   	leave
+    38cd:	c3                   	ret
+
+000038ce <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    38ce:	55                   	push   %ebp
+    38cf:	89 e5                	mov    %esp,%ebp
+    38d1:	83 ec 58             	sub    $0x58,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    38d4:	83 ec 08             	sub    $0x8,%esp
+    38d7:	68 1c 77 00 00       	push   $0x771c
+    38dc:	6a 01                	push   $0x1
+    38de:	e8 10 28 00 00       	call   60f3 <printf>
+    38e3:	83 c4 10             	add    $0x10,%esp
+  file[0] = 'C';
+    38e6:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    38ea:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    38ee:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    38f5:	e9 fc 00 00 00       	jmp    39f6 <concreate+0x128>
+    file[1] = '0' + i;
+    38fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    38fd:	83 c0 30             	add    $0x30,%eax
+    3900:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    3903:	83 ec 0c             	sub    $0xc,%esp
+    3906:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3909:	50                   	push   %eax
+    390a:	e8 38 26 00 00       	call   5f47 <unlink>
+    390f:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    3912:	e8 d8 25 00 00       	call   5eef <fork>
+    3917:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid && (i % 3) == 1){
+    391a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    391e:	74 3b                	je     395b <concreate+0x8d>
+    3920:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3923:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    3928:	89 c8                	mov    %ecx,%eax
+    392a:	f7 ea                	imul   %edx
+    392c:	89 c8                	mov    %ecx,%eax
+    392e:	c1 f8 1f             	sar    $0x1f,%eax
+    3931:	29 c2                	sub    %eax,%edx
+    3933:	89 d0                	mov    %edx,%eax
+    3935:	01 c0                	add    %eax,%eax
+    3937:	01 d0                	add    %edx,%eax
+    3939:	29 c1                	sub    %eax,%ecx
+    393b:	89 ca                	mov    %ecx,%edx
+    393d:	83 fa 01             	cmp    $0x1,%edx
+    3940:	75 19                	jne    395b <concreate+0x8d>
+      link("C0", file);
+    3942:	83 ec 08             	sub    $0x8,%esp
+    3945:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3948:	50                   	push   %eax
+    3949:	68 2c 77 00 00       	push   $0x772c
+    394e:	e8 04 26 00 00       	call   5f57 <link>
+    3953:	83 c4 10             	add    $0x10,%esp
+    3956:	e9 87 00 00 00       	jmp    39e2 <concreate+0x114>
+    } else if(pid == 0 && (i % 5) == 1){
+    395b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    395f:	75 3b                	jne    399c <concreate+0xce>
+    3961:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3964:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    3969:	89 c8                	mov    %ecx,%eax
+    396b:	f7 ea                	imul   %edx
+    396d:	d1 fa                	sar    %edx
+    396f:	89 c8                	mov    %ecx,%eax
+    3971:	c1 f8 1f             	sar    $0x1f,%eax
+    3974:	29 c2                	sub    %eax,%edx
+    3976:	89 d0                	mov    %edx,%eax
+    3978:	c1 e0 02             	shl    $0x2,%eax
+    397b:	01 d0                	add    %edx,%eax
+    397d:	29 c1                	sub    %eax,%ecx
+    397f:	89 ca                	mov    %ecx,%edx
+    3981:	83 fa 01             	cmp    $0x1,%edx
+    3984:	75 16                	jne    399c <concreate+0xce>
+      link("C0", file);
+    3986:	83 ec 08             	sub    $0x8,%esp
+    3989:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    398c:	50                   	push   %eax
+    398d:	68 2c 77 00 00       	push   $0x772c
+    3992:	e8 c0 25 00 00       	call   5f57 <link>
+    3997:	83 c4 10             	add    $0x10,%esp
+    399a:	eb 46                	jmp    39e2 <concreate+0x114>
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    399c:	83 ec 08             	sub    $0x8,%esp
+    399f:	68 02 02 00 00       	push   $0x202
+    39a4:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    39a7:	50                   	push   %eax
+    39a8:	e8 8a 25 00 00       	call   5f37 <open>
+    39ad:	83 c4 10             	add    $0x10,%esp
+    39b0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0){
+    39b3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    39b7:	79 1b                	jns    39d4 <concreate+0x106>
+        printf(1, "concreate create %s failed\n", file);
+    39b9:	83 ec 04             	sub    $0x4,%esp
+    39bc:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    39bf:	50                   	push   %eax
+    39c0:	68 2f 77 00 00       	push   $0x772f
+    39c5:	6a 01                	push   $0x1
+    39c7:	e8 27 27 00 00       	call   60f3 <printf>
+    39cc:	83 c4 10             	add    $0x10,%esp
+        exit();
+    39cf:	e8 23 25 00 00       	call   5ef7 <exit>
+      }
+      close(fd);
+    39d4:	83 ec 0c             	sub    $0xc,%esp
+    39d7:	ff 75 ec             	push   -0x14(%ebp)
+    39da:	e8 40 25 00 00       	call   5f1f <close>
+    39df:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    39e2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    39e6:	75 05                	jne    39ed <concreate+0x11f>
+      exit();
+    39e8:	e8 0a 25 00 00       	call   5ef7 <exit>
+    else
+      wait();
+    39ed:	e8 0d 25 00 00       	call   5eff <wait>
+  for(i = 0; i < 40; i++){
+    39f2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    39f6:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    39fa:	0f 8e fa fe ff ff    	jle    38fa <concreate+0x2c>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    3a00:	83 ec 04             	sub    $0x4,%esp
+    3a03:	6a 28                	push   $0x28
+    3a05:	6a 00                	push   $0x0
+    3a07:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    3a0a:	50                   	push   %eax
+    3a0b:	e8 0e 23 00 00       	call   5d1e <memset>
+    3a10:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    3a13:	83 ec 08             	sub    $0x8,%esp
+    3a16:	6a 00                	push   $0x0
+    3a18:	68 0b 72 00 00       	push   $0x720b
+    3a1d:	e8 15 25 00 00       	call   5f37 <open>
+    3a22:	83 c4 10             	add    $0x10,%esp
+    3a25:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    3a28:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    3a2f:	e9 99 00 00 00       	jmp    3acd <concreate+0x1ff>
+    if(de.inum == 0)
+    3a34:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    3a38:	66 85 c0             	test   %ax,%ax
+    3a3b:	0f 84 8b 00 00 00    	je     3acc <concreate+0x1fe>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    3a41:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    3a45:	3c 43                	cmp    $0x43,%al
+    3a47:	0f 85 80 00 00 00    	jne    3acd <concreate+0x1ff>
+    3a4d:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    3a51:	84 c0                	test   %al,%al
+    3a53:	75 78                	jne    3acd <concreate+0x1ff>
+      i = de.name[1] - '0';
+    3a55:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    3a59:	0f be c0             	movsbl %al,%eax
+    3a5c:	83 e8 30             	sub    $0x30,%eax
+    3a5f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i < 0 || i >= sizeof(fa)){
+    3a62:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3a66:	78 08                	js     3a70 <concreate+0x1a2>
+    3a68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3a6b:	83 f8 27             	cmp    $0x27,%eax
+    3a6e:	76 1e                	jbe    3a8e <concreate+0x1c0>
+        printf(1, "concreate weird file %s\n", de.name);
+    3a70:	83 ec 04             	sub    $0x4,%esp
+    3a73:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    3a76:	83 c0 02             	add    $0x2,%eax
+    3a79:	50                   	push   %eax
+    3a7a:	68 4b 77 00 00       	push   $0x774b
+    3a7f:	6a 01                	push   $0x1
+    3a81:	e8 6d 26 00 00       	call   60f3 <printf>
+    3a86:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3a89:	e8 69 24 00 00       	call   5ef7 <exit>
+      }
+      if(fa[i]){
+    3a8e:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    3a91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3a94:	01 d0                	add    %edx,%eax
+    3a96:	0f b6 00             	movzbl (%eax),%eax
+    3a99:	84 c0                	test   %al,%al
+    3a9b:	74 1e                	je     3abb <concreate+0x1ed>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    3a9d:	83 ec 04             	sub    $0x4,%esp
+    3aa0:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    3aa3:	83 c0 02             	add    $0x2,%eax
+    3aa6:	50                   	push   %eax
+    3aa7:	68 64 77 00 00       	push   $0x7764
+    3aac:	6a 01                	push   $0x1
+    3aae:	e8 40 26 00 00       	call   60f3 <printf>
+    3ab3:	83 c4 10             	add    $0x10,%esp
+        exit();
+    3ab6:	e8 3c 24 00 00       	call   5ef7 <exit>
+      }
+      fa[i] = 1;
+    3abb:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    3abe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3ac1:	01 d0                	add    %edx,%eax
+    3ac3:	c6 00 01             	movb   $0x1,(%eax)
+      n++;
+    3ac6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3aca:	eb 01                	jmp    3acd <concreate+0x1ff>
+      continue;
+    3acc:	90                   	nop
+  while(read(fd, &de, sizeof(de)) > 0){
+    3acd:	83 ec 04             	sub    $0x4,%esp
+    3ad0:	6a 10                	push   $0x10
+    3ad2:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    3ad5:	50                   	push   %eax
+    3ad6:	ff 75 ec             	push   -0x14(%ebp)
+    3ad9:	e8 31 24 00 00       	call   5f0f <read>
+    3ade:	83 c4 10             	add    $0x10,%esp
+    3ae1:	85 c0                	test   %eax,%eax
+    3ae3:	0f 8f 4b ff ff ff    	jg     3a34 <concreate+0x166>
+    }
+  }
+  close(fd);
+    3ae9:	83 ec 0c             	sub    $0xc,%esp
+    3aec:	ff 75 ec             	push   -0x14(%ebp)
+    3aef:	e8 2b 24 00 00       	call   5f1f <close>
+    3af4:	83 c4 10             	add    $0x10,%esp
+
+  if(n != 40){
+    3af7:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    3afb:	74 17                	je     3b14 <concreate+0x246>
+    printf(1, "concreate not enough files in directory listing\n");
+    3afd:	83 ec 08             	sub    $0x8,%esp
+    3b00:	68 84 77 00 00       	push   $0x7784
+    3b05:	6a 01                	push   $0x1
+    3b07:	e8 e7 25 00 00       	call   60f3 <printf>
+    3b0c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b0f:	e8 e3 23 00 00       	call   5ef7 <exit>
+  }
+
+  for(i = 0; i < 40; i++){
+    3b14:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3b1b:	e9 43 01 00 00       	jmp    3c63 <concreate+0x395>
+    file[1] = '0' + i;
+    3b20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3b23:	83 c0 30             	add    $0x30,%eax
+    3b26:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    3b29:	e8 c1 23 00 00       	call   5eef <fork>
+    3b2e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    3b31:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3b35:	79 17                	jns    3b4e <concreate+0x280>
+      printf(1, "fork failed\n");
+    3b37:	83 ec 08             	sub    $0x8,%esp
+    3b3a:	68 4d 65 00 00       	push   $0x654d
+    3b3f:	6a 01                	push   $0x1
+    3b41:	e8 ad 25 00 00       	call   60f3 <printf>
+    3b46:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b49:	e8 a9 23 00 00       	call   5ef7 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+    3b4e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3b51:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    3b56:	89 c8                	mov    %ecx,%eax
+    3b58:	f7 ea                	imul   %edx
+    3b5a:	89 c8                	mov    %ecx,%eax
+    3b5c:	c1 f8 1f             	sar    $0x1f,%eax
+    3b5f:	29 c2                	sub    %eax,%edx
+    3b61:	89 d0                	mov    %edx,%eax
+    3b63:	01 c0                	add    %eax,%eax
+    3b65:	01 d0                	add    %edx,%eax
+    3b67:	29 c1                	sub    %eax,%ecx
+    3b69:	89 ca                	mov    %ecx,%edx
+    3b6b:	85 d2                	test   %edx,%edx
+    3b6d:	75 06                	jne    3b75 <concreate+0x2a7>
+    3b6f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3b73:	74 28                	je     3b9d <concreate+0x2cf>
+       ((i % 3) == 1 && pid != 0)){
+    3b75:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3b78:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    3b7d:	89 c8                	mov    %ecx,%eax
+    3b7f:	f7 ea                	imul   %edx
+    3b81:	89 c8                	mov    %ecx,%eax
+    3b83:	c1 f8 1f             	sar    $0x1f,%eax
+    3b86:	29 c2                	sub    %eax,%edx
+    3b88:	89 d0                	mov    %edx,%eax
+    3b8a:	01 c0                	add    %eax,%eax
+    3b8c:	01 d0                	add    %edx,%eax
+    3b8e:	29 c1                	sub    %eax,%ecx
+    3b90:	89 ca                	mov    %ecx,%edx
+    if(((i % 3) == 0 && pid == 0) ||
+    3b92:	83 fa 01             	cmp    $0x1,%edx
+    3b95:	75 7c                	jne    3c13 <concreate+0x345>
+       ((i % 3) == 1 && pid != 0)){
+    3b97:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3b9b:	74 76                	je     3c13 <concreate+0x345>
+      close(open(file, 0));
+    3b9d:	83 ec 08             	sub    $0x8,%esp
+    3ba0:	6a 00                	push   $0x0
+    3ba2:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3ba5:	50                   	push   %eax
+    3ba6:	e8 8c 23 00 00       	call   5f37 <open>
+    3bab:	83 c4 10             	add    $0x10,%esp
+    3bae:	83 ec 0c             	sub    $0xc,%esp
+    3bb1:	50                   	push   %eax
+    3bb2:	e8 68 23 00 00       	call   5f1f <close>
+    3bb7:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    3bba:	83 ec 08             	sub    $0x8,%esp
+    3bbd:	6a 00                	push   $0x0
+    3bbf:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3bc2:	50                   	push   %eax
+    3bc3:	e8 6f 23 00 00       	call   5f37 <open>
+    3bc8:	83 c4 10             	add    $0x10,%esp
+    3bcb:	83 ec 0c             	sub    $0xc,%esp
+    3bce:	50                   	push   %eax
+    3bcf:	e8 4b 23 00 00       	call   5f1f <close>
+    3bd4:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    3bd7:	83 ec 08             	sub    $0x8,%esp
+    3bda:	6a 00                	push   $0x0
+    3bdc:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3bdf:	50                   	push   %eax
+    3be0:	e8 52 23 00 00       	call   5f37 <open>
+    3be5:	83 c4 10             	add    $0x10,%esp
+    3be8:	83 ec 0c             	sub    $0xc,%esp
+    3beb:	50                   	push   %eax
+    3bec:	e8 2e 23 00 00       	call   5f1f <close>
+    3bf1:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    3bf4:	83 ec 08             	sub    $0x8,%esp
+    3bf7:	6a 00                	push   $0x0
+    3bf9:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3bfc:	50                   	push   %eax
+    3bfd:	e8 35 23 00 00       	call   5f37 <open>
+    3c02:	83 c4 10             	add    $0x10,%esp
+    3c05:	83 ec 0c             	sub    $0xc,%esp
+    3c08:	50                   	push   %eax
+    3c09:	e8 11 23 00 00       	call   5f1f <close>
+    3c0e:	83 c4 10             	add    $0x10,%esp
+    3c11:	eb 3c                	jmp    3c4f <concreate+0x381>
+    } else {
+      unlink(file);
+    3c13:	83 ec 0c             	sub    $0xc,%esp
+    3c16:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3c19:	50                   	push   %eax
+    3c1a:	e8 28 23 00 00       	call   5f47 <unlink>
+    3c1f:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    3c22:	83 ec 0c             	sub    $0xc,%esp
+    3c25:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3c28:	50                   	push   %eax
+    3c29:	e8 19 23 00 00       	call   5f47 <unlink>
+    3c2e:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    3c31:	83 ec 0c             	sub    $0xc,%esp
+    3c34:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3c37:	50                   	push   %eax
+    3c38:	e8 0a 23 00 00       	call   5f47 <unlink>
+    3c3d:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    3c40:	83 ec 0c             	sub    $0xc,%esp
+    3c43:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    3c46:	50                   	push   %eax
+    3c47:	e8 fb 22 00 00       	call   5f47 <unlink>
+    3c4c:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    3c4f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3c53:	75 05                	jne    3c5a <concreate+0x38c>
+      exit();
+    3c55:	e8 9d 22 00 00       	call   5ef7 <exit>
+    else
+      wait();
+    3c5a:	e8 a0 22 00 00       	call   5eff <wait>
+  for(i = 0; i < 40; i++){
+    3c5f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3c63:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    3c67:	0f 8e b3 fe ff ff    	jle    3b20 <concreate+0x252>
+  }
+
+  printf(1, "concreate ok\n");
+    3c6d:	83 ec 08             	sub    $0x8,%esp
+    3c70:	68 b5 77 00 00       	push   $0x77b5
+    3c75:	6a 01                	push   $0x1
+    3c77:	e8 77 24 00 00       	call   60f3 <printf>
+    3c7c:	83 c4 10             	add    $0x10,%esp
+}
+    3c7f:	90                   	nop
+    3c80:	c9                   	leave
+    3c81:	c3                   	ret
+
+00003c82 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    3c82:	55                   	push   %ebp
+    3c83:	89 e5                	mov    %esp,%ebp
+    3c85:	83 ec 18             	sub    $0x18,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    3c88:	83 ec 08             	sub    $0x8,%esp
+    3c8b:	68 c3 77 00 00       	push   $0x77c3
+    3c90:	6a 01                	push   $0x1
+    3c92:	e8 5c 24 00 00       	call   60f3 <printf>
+    3c97:	83 c4 10             	add    $0x10,%esp
+
+  unlink("x");
+    3c9a:	83 ec 0c             	sub    $0xc,%esp
+    3c9d:	68 bb 69 00 00       	push   $0x69bb
+    3ca2:	e8 a0 22 00 00       	call   5f47 <unlink>
+    3ca7:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3caa:	e8 40 22 00 00       	call   5eef <fork>
+    3caf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    3cb2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3cb6:	79 17                	jns    3ccf <linkunlink+0x4d>
+    printf(1, "fork failed\n");
+    3cb8:	83 ec 08             	sub    $0x8,%esp
+    3cbb:	68 4d 65 00 00       	push   $0x654d
+    3cc0:	6a 01                	push   $0x1
+    3cc2:	e8 2c 24 00 00       	call   60f3 <printf>
+    3cc7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3cca:	e8 28 22 00 00       	call   5ef7 <exit>
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    3ccf:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3cd3:	74 07                	je     3cdc <linkunlink+0x5a>
+    3cd5:	b8 01 00 00 00       	mov    $0x1,%eax
+    3cda:	eb 05                	jmp    3ce1 <linkunlink+0x5f>
+    3cdc:	b8 61 00 00 00       	mov    $0x61,%eax
+    3ce1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 100; i++){
+    3ce4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3ceb:	e9 98 00 00 00       	jmp    3d88 <linkunlink+0x106>
+    x = x * 1103515245 + 12345;
+    3cf0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3cf3:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    3cf9:	05 39 30 00 00       	add    $0x3039,%eax
+    3cfe:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((x % 3) == 0){
+    3d01:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    3d04:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    3d09:	89 c8                	mov    %ecx,%eax
+    3d0b:	f7 e2                	mul    %edx
+    3d0d:	d1 ea                	shr    %edx
+    3d0f:	89 d0                	mov    %edx,%eax
+    3d11:	01 c0                	add    %eax,%eax
+    3d13:	01 d0                	add    %edx,%eax
+    3d15:	29 c1                	sub    %eax,%ecx
+    3d17:	89 ca                	mov    %ecx,%edx
+    3d19:	85 d2                	test   %edx,%edx
+    3d1b:	75 23                	jne    3d40 <linkunlink+0xbe>
+      close(open("x", O_RDWR | O_CREATE));
+    3d1d:	83 ec 08             	sub    $0x8,%esp
+    3d20:	68 02 02 00 00       	push   $0x202
+    3d25:	68 bb 69 00 00       	push   $0x69bb
+    3d2a:	e8 08 22 00 00       	call   5f37 <open>
+    3d2f:	83 c4 10             	add    $0x10,%esp
+    3d32:	83 ec 0c             	sub    $0xc,%esp
+    3d35:	50                   	push   %eax
+    3d36:	e8 e4 21 00 00       	call   5f1f <close>
+    3d3b:	83 c4 10             	add    $0x10,%esp
+    3d3e:	eb 44                	jmp    3d84 <linkunlink+0x102>
+    } else if((x % 3) == 1){
+    3d40:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    3d43:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    3d48:	89 c8                	mov    %ecx,%eax
+    3d4a:	f7 e2                	mul    %edx
+    3d4c:	d1 ea                	shr    %edx
+    3d4e:	89 d0                	mov    %edx,%eax
+    3d50:	01 c0                	add    %eax,%eax
+    3d52:	01 d0                	add    %edx,%eax
+    3d54:	29 c1                	sub    %eax,%ecx
+    3d56:	89 ca                	mov    %ecx,%edx
+    3d58:	83 fa 01             	cmp    $0x1,%edx
+    3d5b:	75 17                	jne    3d74 <linkunlink+0xf2>
+      link("cat", "x");
+    3d5d:	83 ec 08             	sub    $0x8,%esp
+    3d60:	68 bb 69 00 00       	push   $0x69bb
+    3d65:	68 d4 77 00 00       	push   $0x77d4
+    3d6a:	e8 e8 21 00 00       	call   5f57 <link>
+    3d6f:	83 c4 10             	add    $0x10,%esp
+    3d72:	eb 10                	jmp    3d84 <linkunlink+0x102>
+    } else {
+      unlink("x");
+    3d74:	83 ec 0c             	sub    $0xc,%esp
+    3d77:	68 bb 69 00 00       	push   $0x69bb
+    3d7c:	e8 c6 21 00 00       	call   5f47 <unlink>
+    3d81:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    3d84:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3d88:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    3d8c:	0f 8e 5e ff ff ff    	jle    3cf0 <linkunlink+0x6e>
+    }
+  }
+
+  if(pid)
+    3d92:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3d96:	74 07                	je     3d9f <linkunlink+0x11d>
+    wait();
+    3d98:	e8 62 21 00 00       	call   5eff <wait>
+    3d9d:	eb 05                	jmp    3da4 <linkunlink+0x122>
+  else 
+    exit();
+    3d9f:	e8 53 21 00 00       	call   5ef7 <exit>
+
+  printf(1, "linkunlink ok\n");
+    3da4:	83 ec 08             	sub    $0x8,%esp
+    3da7:	68 d8 77 00 00       	push   $0x77d8
+    3dac:	6a 01                	push   $0x1
+    3dae:	e8 40 23 00 00       	call   60f3 <printf>
+    3db3:	83 c4 10             	add    $0x10,%esp
+}
+    3db6:	90                   	nop
+    3db7:	c9                   	leave
+    3db8:	c3                   	ret
+
+00003db9 <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    3db9:	55                   	push   %ebp
+    3dba:	89 e5                	mov    %esp,%ebp
+    3dbc:	83 ec 28             	sub    $0x28,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    3dbf:	83 ec 08             	sub    $0x8,%esp
+    3dc2:	68 e7 77 00 00       	push   $0x77e7
+    3dc7:	6a 01                	push   $0x1
+    3dc9:	e8 25 23 00 00       	call   60f3 <printf>
+    3dce:	83 c4 10             	add    $0x10,%esp
+  unlink("bd");
+    3dd1:	83 ec 0c             	sub    $0xc,%esp
+    3dd4:	68 f4 77 00 00       	push   $0x77f4
+    3dd9:	e8 69 21 00 00       	call   5f47 <unlink>
+    3dde:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bd", O_CREATE);
+    3de1:	83 ec 08             	sub    $0x8,%esp
+    3de4:	68 00 02 00 00       	push   $0x200
+    3de9:	68 f4 77 00 00       	push   $0x77f4
+    3dee:	e8 44 21 00 00       	call   5f37 <open>
+    3df3:	83 c4 10             	add    $0x10,%esp
+    3df6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    3df9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3dfd:	79 17                	jns    3e16 <bigdir+0x5d>
+    printf(1, "bigdir create failed\n");
+    3dff:	83 ec 08             	sub    $0x8,%esp
+    3e02:	68 f7 77 00 00       	push   $0x77f7
+    3e07:	6a 01                	push   $0x1
+    3e09:	e8 e5 22 00 00       	call   60f3 <printf>
+    3e0e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3e11:	e8 e1 20 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    3e16:	83 ec 0c             	sub    $0xc,%esp
+    3e19:	ff 75 f0             	push   -0x10(%ebp)
+    3e1c:	e8 fe 20 00 00       	call   5f1f <close>
+    3e21:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    3e24:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3e2b:	eb 69                	jmp    3e96 <bigdir+0xdd>
+    name[0] = 'x';
+    3e2d:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    3e31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e34:	8d 50 3f             	lea    0x3f(%eax),%edx
+    3e37:	85 c0                	test   %eax,%eax
+    3e39:	0f 48 c2             	cmovs  %edx,%eax
+    3e3c:	c1 f8 06             	sar    $0x6,%eax
+    3e3f:	83 c0 30             	add    $0x30,%eax
+    3e42:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    3e45:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3e48:	89 d0                	mov    %edx,%eax
+    3e4a:	c1 f8 1f             	sar    $0x1f,%eax
+    3e4d:	c1 e8 1a             	shr    $0x1a,%eax
+    3e50:	01 c2                	add    %eax,%edx
+    3e52:	83 e2 3f             	and    $0x3f,%edx
+    3e55:	29 c2                	sub    %eax,%edx
+    3e57:	89 d0                	mov    %edx,%eax
+    3e59:	83 c0 30             	add    $0x30,%eax
+    3e5c:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    3e5f:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(link("bd", name) != 0){
+    3e63:	83 ec 08             	sub    $0x8,%esp
+    3e66:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    3e69:	50                   	push   %eax
+    3e6a:	68 f4 77 00 00       	push   $0x77f4
+    3e6f:	e8 e3 20 00 00       	call   5f57 <link>
+    3e74:	83 c4 10             	add    $0x10,%esp
+    3e77:	85 c0                	test   %eax,%eax
+    3e79:	74 17                	je     3e92 <bigdir+0xd9>
+      printf(1, "bigdir link failed\n");
+    3e7b:	83 ec 08             	sub    $0x8,%esp
+    3e7e:	68 0d 78 00 00       	push   $0x780d
+    3e83:	6a 01                	push   $0x1
+    3e85:	e8 69 22 00 00       	call   60f3 <printf>
+    3e8a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3e8d:	e8 65 20 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 500; i++){
+    3e92:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3e96:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    3e9d:	7e 8e                	jle    3e2d <bigdir+0x74>
+    }
+  }
+
+  unlink("bd");
+    3e9f:	83 ec 0c             	sub    $0xc,%esp
+    3ea2:	68 f4 77 00 00       	push   $0x77f4
+    3ea7:	e8 9b 20 00 00       	call   5f47 <unlink>
+    3eac:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    3eaf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3eb6:	eb 64                	jmp    3f1c <bigdir+0x163>
+    name[0] = 'x';
+    3eb8:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    3ebc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3ebf:	8d 50 3f             	lea    0x3f(%eax),%edx
+    3ec2:	85 c0                	test   %eax,%eax
+    3ec4:	0f 48 c2             	cmovs  %edx,%eax
+    3ec7:	c1 f8 06             	sar    $0x6,%eax
+    3eca:	83 c0 30             	add    $0x30,%eax
+    3ecd:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    3ed0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3ed3:	89 d0                	mov    %edx,%eax
+    3ed5:	c1 f8 1f             	sar    $0x1f,%eax
+    3ed8:	c1 e8 1a             	shr    $0x1a,%eax
+    3edb:	01 c2                	add    %eax,%edx
+    3edd:	83 e2 3f             	and    $0x3f,%edx
+    3ee0:	29 c2                	sub    %eax,%edx
+    3ee2:	89 d0                	mov    %edx,%eax
+    3ee4:	83 c0 30             	add    $0x30,%eax
+    3ee7:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    3eea:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(unlink(name) != 0){
+    3eee:	83 ec 0c             	sub    $0xc,%esp
+    3ef1:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    3ef4:	50                   	push   %eax
+    3ef5:	e8 4d 20 00 00       	call   5f47 <unlink>
+    3efa:	83 c4 10             	add    $0x10,%esp
+    3efd:	85 c0                	test   %eax,%eax
+    3eff:	74 17                	je     3f18 <bigdir+0x15f>
+      printf(1, "bigdir unlink failed");
+    3f01:	83 ec 08             	sub    $0x8,%esp
+    3f04:	68 21 78 00 00       	push   $0x7821
+    3f09:	6a 01                	push   $0x1
+    3f0b:	e8 e3 21 00 00       	call   60f3 <printf>
+    3f10:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3f13:	e8 df 1f 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 500; i++){
+    3f18:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3f1c:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    3f23:	7e 93                	jle    3eb8 <bigdir+0xff>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    3f25:	83 ec 08             	sub    $0x8,%esp
+    3f28:	68 36 78 00 00       	push   $0x7836
+    3f2d:	6a 01                	push   $0x1
+    3f2f:	e8 bf 21 00 00       	call   60f3 <printf>
+    3f34:	83 c4 10             	add    $0x10,%esp
+}
+    3f37:	90                   	nop
+    3f38:	c9                   	leave
+    3f39:	c3                   	ret
+
+00003f3a <subdir>:
+
+void
+subdir(void)
+{
+    3f3a:	55                   	push   %ebp
+    3f3b:	89 e5                	mov    %esp,%ebp
+    3f3d:	83 ec 18             	sub    $0x18,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    3f40:	83 ec 08             	sub    $0x8,%esp
+    3f43:	68 41 78 00 00       	push   $0x7841
+    3f48:	6a 01                	push   $0x1
+    3f4a:	e8 a4 21 00 00       	call   60f3 <printf>
+    3f4f:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ff");
+    3f52:	83 ec 0c             	sub    $0xc,%esp
+    3f55:	68 4e 78 00 00       	push   $0x784e
+    3f5a:	e8 e8 1f 00 00       	call   5f47 <unlink>
+    3f5f:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dd") != 0){
+    3f62:	83 ec 0c             	sub    $0xc,%esp
+    3f65:	68 51 78 00 00       	push   $0x7851
+    3f6a:	e8 f0 1f 00 00       	call   5f5f <mkdir>
+    3f6f:	83 c4 10             	add    $0x10,%esp
+    3f72:	85 c0                	test   %eax,%eax
+    3f74:	74 17                	je     3f8d <subdir+0x53>
+    printf(1, "subdir mkdir dd failed\n");
+    3f76:	83 ec 08             	sub    $0x8,%esp
+    3f79:	68 54 78 00 00       	push   $0x7854
+    3f7e:	6a 01                	push   $0x1
+    3f80:	e8 6e 21 00 00       	call   60f3 <printf>
+    3f85:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f88:	e8 6a 1f 00 00       	call   5ef7 <exit>
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    3f8d:	83 ec 08             	sub    $0x8,%esp
+    3f90:	68 02 02 00 00       	push   $0x202
+    3f95:	68 6c 78 00 00       	push   $0x786c
+    3f9a:	e8 98 1f 00 00       	call   5f37 <open>
+    3f9f:	83 c4 10             	add    $0x10,%esp
+    3fa2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    3fa5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3fa9:	79 17                	jns    3fc2 <subdir+0x88>
+    printf(1, "create dd/ff failed\n");
+    3fab:	83 ec 08             	sub    $0x8,%esp
+    3fae:	68 72 78 00 00       	push   $0x7872
+    3fb3:	6a 01                	push   $0x1
+    3fb5:	e8 39 21 00 00       	call   60f3 <printf>
+    3fba:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3fbd:	e8 35 1f 00 00       	call   5ef7 <exit>
+  }
+  write(fd, "ff", 2);
+    3fc2:	83 ec 04             	sub    $0x4,%esp
+    3fc5:	6a 02                	push   $0x2
+    3fc7:	68 4e 78 00 00       	push   $0x784e
+    3fcc:	ff 75 f4             	push   -0xc(%ebp)
+    3fcf:	e8 43 1f 00 00       	call   5f17 <write>
+    3fd4:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    3fd7:	83 ec 0c             	sub    $0xc,%esp
+    3fda:	ff 75 f4             	push   -0xc(%ebp)
+    3fdd:	e8 3d 1f 00 00       	call   5f1f <close>
+    3fe2:	83 c4 10             	add    $0x10,%esp
+  
+  if(unlink("dd") >= 0){
+    3fe5:	83 ec 0c             	sub    $0xc,%esp
+    3fe8:	68 51 78 00 00       	push   $0x7851
+    3fed:	e8 55 1f 00 00       	call   5f47 <unlink>
+    3ff2:	83 c4 10             	add    $0x10,%esp
+    3ff5:	85 c0                	test   %eax,%eax
+    3ff7:	78 17                	js     4010 <subdir+0xd6>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    3ff9:	83 ec 08             	sub    $0x8,%esp
+    3ffc:	68 88 78 00 00       	push   $0x7888
+    4001:	6a 01                	push   $0x1
+    4003:	e8 eb 20 00 00       	call   60f3 <printf>
+    4008:	83 c4 10             	add    $0x10,%esp
+    exit();
+    400b:	e8 e7 1e 00 00       	call   5ef7 <exit>
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    4010:	83 ec 0c             	sub    $0xc,%esp
+    4013:	68 ae 78 00 00       	push   $0x78ae
+    4018:	e8 42 1f 00 00       	call   5f5f <mkdir>
+    401d:	83 c4 10             	add    $0x10,%esp
+    4020:	85 c0                	test   %eax,%eax
+    4022:	74 17                	je     403b <subdir+0x101>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    4024:	83 ec 08             	sub    $0x8,%esp
+    4027:	68 b5 78 00 00       	push   $0x78b5
+    402c:	6a 01                	push   $0x1
+    402e:	e8 c0 20 00 00       	call   60f3 <printf>
+    4033:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4036:	e8 bc 1e 00 00       	call   5ef7 <exit>
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    403b:	83 ec 08             	sub    $0x8,%esp
+    403e:	68 02 02 00 00       	push   $0x202
+    4043:	68 d0 78 00 00       	push   $0x78d0
+    4048:	e8 ea 1e 00 00       	call   5f37 <open>
+    404d:	83 c4 10             	add    $0x10,%esp
+    4050:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    4053:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4057:	79 17                	jns    4070 <subdir+0x136>
+    printf(1, "create dd/dd/ff failed\n");
+    4059:	83 ec 08             	sub    $0x8,%esp
+    405c:	68 d9 78 00 00       	push   $0x78d9
+    4061:	6a 01                	push   $0x1
+    4063:	e8 8b 20 00 00       	call   60f3 <printf>
+    4068:	83 c4 10             	add    $0x10,%esp
+    exit();
+    406b:	e8 87 1e 00 00       	call   5ef7 <exit>
+  }
+  write(fd, "FF", 2);
+    4070:	83 ec 04             	sub    $0x4,%esp
+    4073:	6a 02                	push   $0x2
+    4075:	68 f1 78 00 00       	push   $0x78f1
+    407a:	ff 75 f4             	push   -0xc(%ebp)
+    407d:	e8 95 1e 00 00       	call   5f17 <write>
+    4082:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    4085:	83 ec 0c             	sub    $0xc,%esp
+    4088:	ff 75 f4             	push   -0xc(%ebp)
+    408b:	e8 8f 1e 00 00       	call   5f1f <close>
+    4090:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dd/dd/../ff", 0);
+    4093:	83 ec 08             	sub    $0x8,%esp
+    4096:	6a 00                	push   $0x0
+    4098:	68 f4 78 00 00       	push   $0x78f4
+    409d:	e8 95 1e 00 00       	call   5f37 <open>
+    40a2:	83 c4 10             	add    $0x10,%esp
+    40a5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    40a8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    40ac:	79 17                	jns    40c5 <subdir+0x18b>
+    printf(1, "open dd/dd/../ff failed\n");
+    40ae:	83 ec 08             	sub    $0x8,%esp
+    40b1:	68 00 79 00 00       	push   $0x7900
+    40b6:	6a 01                	push   $0x1
+    40b8:	e8 36 20 00 00       	call   60f3 <printf>
+    40bd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    40c0:	e8 32 1e 00 00       	call   5ef7 <exit>
+  }
+  cc = read(fd, buf, sizeof(buf));
+    40c5:	83 ec 04             	sub    $0x4,%esp
+    40c8:	68 00 20 00 00       	push   $0x2000
+    40cd:	68 e0 8e 00 00       	push   $0x8ee0
+    40d2:	ff 75 f4             	push   -0xc(%ebp)
+    40d5:	e8 35 1e 00 00       	call   5f0f <read>
+    40da:	83 c4 10             	add    $0x10,%esp
+    40dd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(cc != 2 || buf[0] != 'f'){
+    40e0:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    40e4:	75 0b                	jne    40f1 <subdir+0x1b7>
+    40e6:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    40ed:	3c 66                	cmp    $0x66,%al
+    40ef:	74 17                	je     4108 <subdir+0x1ce>
+    printf(1, "dd/dd/../ff wrong content\n");
+    40f1:	83 ec 08             	sub    $0x8,%esp
+    40f4:	68 19 79 00 00       	push   $0x7919
+    40f9:	6a 01                	push   $0x1
+    40fb:	e8 f3 1f 00 00       	call   60f3 <printf>
+    4100:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4103:	e8 ef 1d 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    4108:	83 ec 0c             	sub    $0xc,%esp
+    410b:	ff 75 f4             	push   -0xc(%ebp)
+    410e:	e8 0c 1e 00 00       	call   5f1f <close>
+    4113:	83 c4 10             	add    $0x10,%esp
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    4116:	83 ec 08             	sub    $0x8,%esp
+    4119:	68 34 79 00 00       	push   $0x7934
+    411e:	68 d0 78 00 00       	push   $0x78d0
+    4123:	e8 2f 1e 00 00       	call   5f57 <link>
+    4128:	83 c4 10             	add    $0x10,%esp
+    412b:	85 c0                	test   %eax,%eax
+    412d:	74 17                	je     4146 <subdir+0x20c>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    412f:	83 ec 08             	sub    $0x8,%esp
+    4132:	68 40 79 00 00       	push   $0x7940
+    4137:	6a 01                	push   $0x1
+    4139:	e8 b5 1f 00 00       	call   60f3 <printf>
+    413e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4141:	e8 b1 1d 00 00       	call   5ef7 <exit>
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    4146:	83 ec 0c             	sub    $0xc,%esp
+    4149:	68 d0 78 00 00       	push   $0x78d0
+    414e:	e8 f4 1d 00 00       	call   5f47 <unlink>
+    4153:	83 c4 10             	add    $0x10,%esp
+    4156:	85 c0                	test   %eax,%eax
+    4158:	74 17                	je     4171 <subdir+0x237>
+    printf(1, "unlink dd/dd/ff failed\n");
+    415a:	83 ec 08             	sub    $0x8,%esp
+    415d:	68 61 79 00 00       	push   $0x7961
+    4162:	6a 01                	push   $0x1
+    4164:	e8 8a 1f 00 00       	call   60f3 <printf>
+    4169:	83 c4 10             	add    $0x10,%esp
+    exit();
+    416c:	e8 86 1d 00 00       	call   5ef7 <exit>
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    4171:	83 ec 08             	sub    $0x8,%esp
+    4174:	6a 00                	push   $0x0
+    4176:	68 d0 78 00 00       	push   $0x78d0
+    417b:	e8 b7 1d 00 00       	call   5f37 <open>
+    4180:	83 c4 10             	add    $0x10,%esp
+    4183:	85 c0                	test   %eax,%eax
+    4185:	78 17                	js     419e <subdir+0x264>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    4187:	83 ec 08             	sub    $0x8,%esp
+    418a:	68 7c 79 00 00       	push   $0x797c
+    418f:	6a 01                	push   $0x1
+    4191:	e8 5d 1f 00 00       	call   60f3 <printf>
+    4196:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4199:	e8 59 1d 00 00       	call   5ef7 <exit>
+  }
+
+  if(chdir("dd") != 0){
+    419e:	83 ec 0c             	sub    $0xc,%esp
+    41a1:	68 51 78 00 00       	push   $0x7851
+    41a6:	e8 bc 1d 00 00       	call   5f67 <chdir>
+    41ab:	83 c4 10             	add    $0x10,%esp
+    41ae:	85 c0                	test   %eax,%eax
+    41b0:	74 17                	je     41c9 <subdir+0x28f>
+    printf(1, "chdir dd failed\n");
+    41b2:	83 ec 08             	sub    $0x8,%esp
+    41b5:	68 a0 79 00 00       	push   $0x79a0
+    41ba:	6a 01                	push   $0x1
+    41bc:	e8 32 1f 00 00       	call   60f3 <printf>
+    41c1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    41c4:	e8 2e 1d 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("dd/../../dd") != 0){
+    41c9:	83 ec 0c             	sub    $0xc,%esp
+    41cc:	68 b1 79 00 00       	push   $0x79b1
+    41d1:	e8 91 1d 00 00       	call   5f67 <chdir>
+    41d6:	83 c4 10             	add    $0x10,%esp
+    41d9:	85 c0                	test   %eax,%eax
+    41db:	74 17                	je     41f4 <subdir+0x2ba>
+    printf(1, "chdir dd/../../dd failed\n");
+    41dd:	83 ec 08             	sub    $0x8,%esp
+    41e0:	68 bd 79 00 00       	push   $0x79bd
+    41e5:	6a 01                	push   $0x1
+    41e7:	e8 07 1f 00 00       	call   60f3 <printf>
+    41ec:	83 c4 10             	add    $0x10,%esp
+    exit();
+    41ef:	e8 03 1d 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("dd/../../../dd") != 0){
+    41f4:	83 ec 0c             	sub    $0xc,%esp
+    41f7:	68 d7 79 00 00       	push   $0x79d7
+    41fc:	e8 66 1d 00 00       	call   5f67 <chdir>
+    4201:	83 c4 10             	add    $0x10,%esp
+    4204:	85 c0                	test   %eax,%eax
+    4206:	74 17                	je     421f <subdir+0x2e5>
+    printf(1, "chdir dd/../../dd failed\n");
+    4208:	83 ec 08             	sub    $0x8,%esp
+    420b:	68 bd 79 00 00       	push   $0x79bd
+    4210:	6a 01                	push   $0x1
+    4212:	e8 dc 1e 00 00       	call   60f3 <printf>
+    4217:	83 c4 10             	add    $0x10,%esp
+    exit();
+    421a:	e8 d8 1c 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("./..") != 0){
+    421f:	83 ec 0c             	sub    $0xc,%esp
+    4222:	68 e6 79 00 00       	push   $0x79e6
+    4227:	e8 3b 1d 00 00       	call   5f67 <chdir>
+    422c:	83 c4 10             	add    $0x10,%esp
+    422f:	85 c0                	test   %eax,%eax
+    4231:	74 17                	je     424a <subdir+0x310>
+    printf(1, "chdir ./.. failed\n");
+    4233:	83 ec 08             	sub    $0x8,%esp
+    4236:	68 eb 79 00 00       	push   $0x79eb
+    423b:	6a 01                	push   $0x1
+    423d:	e8 b1 1e 00 00       	call   60f3 <printf>
+    4242:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4245:	e8 ad 1c 00 00       	call   5ef7 <exit>
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    424a:	83 ec 08             	sub    $0x8,%esp
+    424d:	6a 00                	push   $0x0
+    424f:	68 34 79 00 00       	push   $0x7934
+    4254:	e8 de 1c 00 00       	call   5f37 <open>
+    4259:	83 c4 10             	add    $0x10,%esp
+    425c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    425f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4263:	79 17                	jns    427c <subdir+0x342>
+    printf(1, "open dd/dd/ffff failed\n");
+    4265:	83 ec 08             	sub    $0x8,%esp
+    4268:	68 fe 79 00 00       	push   $0x79fe
+    426d:	6a 01                	push   $0x1
+    426f:	e8 7f 1e 00 00       	call   60f3 <printf>
+    4274:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4277:	e8 7b 1c 00 00       	call   5ef7 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    427c:	83 ec 04             	sub    $0x4,%esp
+    427f:	68 00 20 00 00       	push   $0x2000
+    4284:	68 e0 8e 00 00       	push   $0x8ee0
+    4289:	ff 75 f4             	push   -0xc(%ebp)
+    428c:	e8 7e 1c 00 00       	call   5f0f <read>
+    4291:	83 c4 10             	add    $0x10,%esp
+    4294:	83 f8 02             	cmp    $0x2,%eax
+    4297:	74 17                	je     42b0 <subdir+0x376>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    4299:	83 ec 08             	sub    $0x8,%esp
+    429c:	68 16 7a 00 00       	push   $0x7a16
+    42a1:	6a 01                	push   $0x1
+    42a3:	e8 4b 1e 00 00       	call   60f3 <printf>
+    42a8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    42ab:	e8 47 1c 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    42b0:	83 ec 0c             	sub    $0xc,%esp
+    42b3:	ff 75 f4             	push   -0xc(%ebp)
+    42b6:	e8 64 1c 00 00       	call   5f1f <close>
+    42bb:	83 c4 10             	add    $0x10,%esp
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    42be:	83 ec 08             	sub    $0x8,%esp
+    42c1:	6a 00                	push   $0x0
+    42c3:	68 d0 78 00 00       	push   $0x78d0
+    42c8:	e8 6a 1c 00 00       	call   5f37 <open>
+    42cd:	83 c4 10             	add    $0x10,%esp
+    42d0:	85 c0                	test   %eax,%eax
+    42d2:	78 17                	js     42eb <subdir+0x3b1>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    42d4:	83 ec 08             	sub    $0x8,%esp
+    42d7:	68 34 7a 00 00       	push   $0x7a34
+    42dc:	6a 01                	push   $0x1
+    42de:	e8 10 1e 00 00       	call   60f3 <printf>
+    42e3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    42e6:	e8 0c 1c 00 00       	call   5ef7 <exit>
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    42eb:	83 ec 08             	sub    $0x8,%esp
+    42ee:	68 02 02 00 00       	push   $0x202
+    42f3:	68 59 7a 00 00       	push   $0x7a59
+    42f8:	e8 3a 1c 00 00       	call   5f37 <open>
+    42fd:	83 c4 10             	add    $0x10,%esp
+    4300:	85 c0                	test   %eax,%eax
+    4302:	78 17                	js     431b <subdir+0x3e1>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    4304:	83 ec 08             	sub    $0x8,%esp
+    4307:	68 62 7a 00 00       	push   $0x7a62
+    430c:	6a 01                	push   $0x1
+    430e:	e8 e0 1d 00 00       	call   60f3 <printf>
+    4313:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4316:	e8 dc 1b 00 00       	call   5ef7 <exit>
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    431b:	83 ec 08             	sub    $0x8,%esp
+    431e:	68 02 02 00 00       	push   $0x202
+    4323:	68 7e 7a 00 00       	push   $0x7a7e
+    4328:	e8 0a 1c 00 00       	call   5f37 <open>
+    432d:	83 c4 10             	add    $0x10,%esp
+    4330:	85 c0                	test   %eax,%eax
+    4332:	78 17                	js     434b <subdir+0x411>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    4334:	83 ec 08             	sub    $0x8,%esp
+    4337:	68 87 7a 00 00       	push   $0x7a87
+    433c:	6a 01                	push   $0x1
+    433e:	e8 b0 1d 00 00       	call   60f3 <printf>
+    4343:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4346:	e8 ac 1b 00 00       	call   5ef7 <exit>
+  }
+  if(open("dd", O_CREATE) >= 0){
+    434b:	83 ec 08             	sub    $0x8,%esp
+    434e:	68 00 02 00 00       	push   $0x200
+    4353:	68 51 78 00 00       	push   $0x7851
+    4358:	e8 da 1b 00 00       	call   5f37 <open>
+    435d:	83 c4 10             	add    $0x10,%esp
+    4360:	85 c0                	test   %eax,%eax
+    4362:	78 17                	js     437b <subdir+0x441>
+    printf(1, "create dd succeeded!\n");
+    4364:	83 ec 08             	sub    $0x8,%esp
+    4367:	68 a3 7a 00 00       	push   $0x7aa3
+    436c:	6a 01                	push   $0x1
+    436e:	e8 80 1d 00 00       	call   60f3 <printf>
+    4373:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4376:	e8 7c 1b 00 00       	call   5ef7 <exit>
+  }
+  if(open("dd", O_RDWR) >= 0){
+    437b:	83 ec 08             	sub    $0x8,%esp
+    437e:	6a 02                	push   $0x2
+    4380:	68 51 78 00 00       	push   $0x7851
+    4385:	e8 ad 1b 00 00       	call   5f37 <open>
+    438a:	83 c4 10             	add    $0x10,%esp
+    438d:	85 c0                	test   %eax,%eax
+    438f:	78 17                	js     43a8 <subdir+0x46e>
+    printf(1, "open dd rdwr succeeded!\n");
+    4391:	83 ec 08             	sub    $0x8,%esp
+    4394:	68 b9 7a 00 00       	push   $0x7ab9
+    4399:	6a 01                	push   $0x1
+    439b:	e8 53 1d 00 00       	call   60f3 <printf>
+    43a0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    43a3:	e8 4f 1b 00 00       	call   5ef7 <exit>
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    43a8:	83 ec 08             	sub    $0x8,%esp
+    43ab:	6a 01                	push   $0x1
+    43ad:	68 51 78 00 00       	push   $0x7851
+    43b2:	e8 80 1b 00 00       	call   5f37 <open>
+    43b7:	83 c4 10             	add    $0x10,%esp
+    43ba:	85 c0                	test   %eax,%eax
+    43bc:	78 17                	js     43d5 <subdir+0x49b>
+    printf(1, "open dd wronly succeeded!\n");
+    43be:	83 ec 08             	sub    $0x8,%esp
+    43c1:	68 d2 7a 00 00       	push   $0x7ad2
+    43c6:	6a 01                	push   $0x1
+    43c8:	e8 26 1d 00 00       	call   60f3 <printf>
+    43cd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    43d0:	e8 22 1b 00 00       	call   5ef7 <exit>
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    43d5:	83 ec 08             	sub    $0x8,%esp
+    43d8:	68 ed 7a 00 00       	push   $0x7aed
+    43dd:	68 59 7a 00 00       	push   $0x7a59
+    43e2:	e8 70 1b 00 00       	call   5f57 <link>
+    43e7:	83 c4 10             	add    $0x10,%esp
+    43ea:	85 c0                	test   %eax,%eax
+    43ec:	75 17                	jne    4405 <subdir+0x4cb>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    43ee:	83 ec 08             	sub    $0x8,%esp
+    43f1:	68 f8 7a 00 00       	push   $0x7af8
+    43f6:	6a 01                	push   $0x1
+    43f8:	e8 f6 1c 00 00       	call   60f3 <printf>
+    43fd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4400:	e8 f2 1a 00 00       	call   5ef7 <exit>
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    4405:	83 ec 08             	sub    $0x8,%esp
+    4408:	68 ed 7a 00 00       	push   $0x7aed
+    440d:	68 7e 7a 00 00       	push   $0x7a7e
+    4412:	e8 40 1b 00 00       	call   5f57 <link>
+    4417:	83 c4 10             	add    $0x10,%esp
+    441a:	85 c0                	test   %eax,%eax
+    441c:	75 17                	jne    4435 <subdir+0x4fb>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    441e:	83 ec 08             	sub    $0x8,%esp
+    4421:	68 1c 7b 00 00       	push   $0x7b1c
+    4426:	6a 01                	push   $0x1
+    4428:	e8 c6 1c 00 00       	call   60f3 <printf>
+    442d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4430:	e8 c2 1a 00 00       	call   5ef7 <exit>
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    4435:	83 ec 08             	sub    $0x8,%esp
+    4438:	68 34 79 00 00       	push   $0x7934
+    443d:	68 6c 78 00 00       	push   $0x786c
+    4442:	e8 10 1b 00 00       	call   5f57 <link>
+    4447:	83 c4 10             	add    $0x10,%esp
+    444a:	85 c0                	test   %eax,%eax
+    444c:	75 17                	jne    4465 <subdir+0x52b>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    444e:	83 ec 08             	sub    $0x8,%esp
+    4451:	68 40 7b 00 00       	push   $0x7b40
+    4456:	6a 01                	push   $0x1
+    4458:	e8 96 1c 00 00       	call   60f3 <printf>
+    445d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4460:	e8 92 1a 00 00       	call   5ef7 <exit>
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    4465:	83 ec 0c             	sub    $0xc,%esp
+    4468:	68 59 7a 00 00       	push   $0x7a59
+    446d:	e8 ed 1a 00 00       	call   5f5f <mkdir>
+    4472:	83 c4 10             	add    $0x10,%esp
+    4475:	85 c0                	test   %eax,%eax
+    4477:	75 17                	jne    4490 <subdir+0x556>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    4479:	83 ec 08             	sub    $0x8,%esp
+    447c:	68 62 7b 00 00       	push   $0x7b62
+    4481:	6a 01                	push   $0x1
+    4483:	e8 6b 1c 00 00       	call   60f3 <printf>
+    4488:	83 c4 10             	add    $0x10,%esp
+    exit();
+    448b:	e8 67 1a 00 00       	call   5ef7 <exit>
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    4490:	83 ec 0c             	sub    $0xc,%esp
+    4493:	68 7e 7a 00 00       	push   $0x7a7e
+    4498:	e8 c2 1a 00 00       	call   5f5f <mkdir>
+    449d:	83 c4 10             	add    $0x10,%esp
+    44a0:	85 c0                	test   %eax,%eax
+    44a2:	75 17                	jne    44bb <subdir+0x581>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    44a4:	83 ec 08             	sub    $0x8,%esp
+    44a7:	68 7d 7b 00 00       	push   $0x7b7d
+    44ac:	6a 01                	push   $0x1
+    44ae:	e8 40 1c 00 00       	call   60f3 <printf>
+    44b3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    44b6:	e8 3c 1a 00 00       	call   5ef7 <exit>
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    44bb:	83 ec 0c             	sub    $0xc,%esp
+    44be:	68 34 79 00 00       	push   $0x7934
+    44c3:	e8 97 1a 00 00       	call   5f5f <mkdir>
+    44c8:	83 c4 10             	add    $0x10,%esp
+    44cb:	85 c0                	test   %eax,%eax
+    44cd:	75 17                	jne    44e6 <subdir+0x5ac>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    44cf:	83 ec 08             	sub    $0x8,%esp
+    44d2:	68 98 7b 00 00       	push   $0x7b98
+    44d7:	6a 01                	push   $0x1
+    44d9:	e8 15 1c 00 00       	call   60f3 <printf>
+    44de:	83 c4 10             	add    $0x10,%esp
+    exit();
+    44e1:	e8 11 1a 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dd/xx/ff") == 0){
+    44e6:	83 ec 0c             	sub    $0xc,%esp
+    44e9:	68 7e 7a 00 00       	push   $0x7a7e
+    44ee:	e8 54 1a 00 00       	call   5f47 <unlink>
+    44f3:	83 c4 10             	add    $0x10,%esp
+    44f6:	85 c0                	test   %eax,%eax
+    44f8:	75 17                	jne    4511 <subdir+0x5d7>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    44fa:	83 ec 08             	sub    $0x8,%esp
+    44fd:	68 b5 7b 00 00       	push   $0x7bb5
+    4502:	6a 01                	push   $0x1
+    4504:	e8 ea 1b 00 00       	call   60f3 <printf>
+    4509:	83 c4 10             	add    $0x10,%esp
+    exit();
+    450c:	e8 e6 19 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dd/ff/ff") == 0){
+    4511:	83 ec 0c             	sub    $0xc,%esp
+    4514:	68 59 7a 00 00       	push   $0x7a59
+    4519:	e8 29 1a 00 00       	call   5f47 <unlink>
+    451e:	83 c4 10             	add    $0x10,%esp
+    4521:	85 c0                	test   %eax,%eax
+    4523:	75 17                	jne    453c <subdir+0x602>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    4525:	83 ec 08             	sub    $0x8,%esp
+    4528:	68 d1 7b 00 00       	push   $0x7bd1
+    452d:	6a 01                	push   $0x1
+    452f:	e8 bf 1b 00 00       	call   60f3 <printf>
+    4534:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4537:	e8 bb 19 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("dd/ff") == 0){
+    453c:	83 ec 0c             	sub    $0xc,%esp
+    453f:	68 6c 78 00 00       	push   $0x786c
+    4544:	e8 1e 1a 00 00       	call   5f67 <chdir>
+    4549:	83 c4 10             	add    $0x10,%esp
+    454c:	85 c0                	test   %eax,%eax
+    454e:	75 17                	jne    4567 <subdir+0x62d>
+    printf(1, "chdir dd/ff succeeded!\n");
+    4550:	83 ec 08             	sub    $0x8,%esp
+    4553:	68 ed 7b 00 00       	push   $0x7bed
+    4558:	6a 01                	push   $0x1
+    455a:	e8 94 1b 00 00       	call   60f3 <printf>
+    455f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4562:	e8 90 19 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("dd/xx") == 0){
+    4567:	83 ec 0c             	sub    $0xc,%esp
+    456a:	68 05 7c 00 00       	push   $0x7c05
+    456f:	e8 f3 19 00 00       	call   5f67 <chdir>
+    4574:	83 c4 10             	add    $0x10,%esp
+    4577:	85 c0                	test   %eax,%eax
+    4579:	75 17                	jne    4592 <subdir+0x658>
+    printf(1, "chdir dd/xx succeeded!\n");
+    457b:	83 ec 08             	sub    $0x8,%esp
+    457e:	68 0b 7c 00 00       	push   $0x7c0b
+    4583:	6a 01                	push   $0x1
+    4585:	e8 69 1b 00 00       	call   60f3 <printf>
+    458a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    458d:	e8 65 19 00 00       	call   5ef7 <exit>
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    4592:	83 ec 0c             	sub    $0xc,%esp
+    4595:	68 34 79 00 00       	push   $0x7934
+    459a:	e8 a8 19 00 00       	call   5f47 <unlink>
+    459f:	83 c4 10             	add    $0x10,%esp
+    45a2:	85 c0                	test   %eax,%eax
+    45a4:	74 17                	je     45bd <subdir+0x683>
+    printf(1, "unlink dd/dd/ff failed\n");
+    45a6:	83 ec 08             	sub    $0x8,%esp
+    45a9:	68 61 79 00 00       	push   $0x7961
+    45ae:	6a 01                	push   $0x1
+    45b0:	e8 3e 1b 00 00       	call   60f3 <printf>
+    45b5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    45b8:	e8 3a 19 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dd/ff") != 0){
+    45bd:	83 ec 0c             	sub    $0xc,%esp
+    45c0:	68 6c 78 00 00       	push   $0x786c
+    45c5:	e8 7d 19 00 00       	call   5f47 <unlink>
+    45ca:	83 c4 10             	add    $0x10,%esp
+    45cd:	85 c0                	test   %eax,%eax
+    45cf:	74 17                	je     45e8 <subdir+0x6ae>
+    printf(1, "unlink dd/ff failed\n");
+    45d1:	83 ec 08             	sub    $0x8,%esp
+    45d4:	68 23 7c 00 00       	push   $0x7c23
+    45d9:	6a 01                	push   $0x1
+    45db:	e8 13 1b 00 00       	call   60f3 <printf>
+    45e0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    45e3:	e8 0f 19 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dd") == 0){
+    45e8:	83 ec 0c             	sub    $0xc,%esp
+    45eb:	68 51 78 00 00       	push   $0x7851
+    45f0:	e8 52 19 00 00       	call   5f47 <unlink>
+    45f5:	83 c4 10             	add    $0x10,%esp
+    45f8:	85 c0                	test   %eax,%eax
+    45fa:	75 17                	jne    4613 <subdir+0x6d9>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    45fc:	83 ec 08             	sub    $0x8,%esp
+    45ff:	68 38 7c 00 00       	push   $0x7c38
+    4604:	6a 01                	push   $0x1
+    4606:	e8 e8 1a 00 00       	call   60f3 <printf>
+    460b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    460e:	e8 e4 18 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dd/dd") < 0){
+    4613:	83 ec 0c             	sub    $0xc,%esp
+    4616:	68 58 7c 00 00       	push   $0x7c58
+    461b:	e8 27 19 00 00       	call   5f47 <unlink>
+    4620:	83 c4 10             	add    $0x10,%esp
+    4623:	85 c0                	test   %eax,%eax
+    4625:	79 17                	jns    463e <subdir+0x704>
+    printf(1, "unlink dd/dd failed\n");
+    4627:	83 ec 08             	sub    $0x8,%esp
+    462a:	68 5e 7c 00 00       	push   $0x7c5e
+    462f:	6a 01                	push   $0x1
+    4631:	e8 bd 1a 00 00       	call   60f3 <printf>
+    4636:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4639:	e8 b9 18 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dd") < 0){
+    463e:	83 ec 0c             	sub    $0xc,%esp
+    4641:	68 51 78 00 00       	push   $0x7851
+    4646:	e8 fc 18 00 00       	call   5f47 <unlink>
+    464b:	83 c4 10             	add    $0x10,%esp
+    464e:	85 c0                	test   %eax,%eax
+    4650:	79 17                	jns    4669 <subdir+0x72f>
+    printf(1, "unlink dd failed\n");
+    4652:	83 ec 08             	sub    $0x8,%esp
+    4655:	68 73 7c 00 00       	push   $0x7c73
+    465a:	6a 01                	push   $0x1
+    465c:	e8 92 1a 00 00       	call   60f3 <printf>
+    4661:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4664:	e8 8e 18 00 00       	call   5ef7 <exit>
+  }
+
+  printf(1, "subdir ok\n");
+    4669:	83 ec 08             	sub    $0x8,%esp
+    466c:	68 85 7c 00 00       	push   $0x7c85
+    4671:	6a 01                	push   $0x1
+    4673:	e8 7b 1a 00 00       	call   60f3 <printf>
+    4678:	83 c4 10             	add    $0x10,%esp
+}
+    467b:	90                   	nop
+    467c:	c9                   	leave
+    467d:	c3                   	ret
+
+0000467e <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    467e:	55                   	push   %ebp
+    467f:	89 e5                	mov    %esp,%ebp
+    4681:	83 ec 18             	sub    $0x18,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    4684:	83 ec 08             	sub    $0x8,%esp
+    4687:	68 90 7c 00 00       	push   $0x7c90
+    468c:	6a 01                	push   $0x1
+    468e:	e8 60 1a 00 00       	call   60f3 <printf>
+    4693:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigwrite");
+    4696:	83 ec 0c             	sub    $0xc,%esp
+    4699:	68 9f 7c 00 00       	push   $0x7c9f
+    469e:	e8 a4 18 00 00       	call   5f47 <unlink>
+    46a3:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    46a6:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    46ad:	e9 a8 00 00 00       	jmp    475a <bigwrite+0xdc>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    46b2:	83 ec 08             	sub    $0x8,%esp
+    46b5:	68 02 02 00 00       	push   $0x202
+    46ba:	68 9f 7c 00 00       	push   $0x7c9f
+    46bf:	e8 73 18 00 00       	call   5f37 <open>
+    46c4:	83 c4 10             	add    $0x10,%esp
+    46c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    46ca:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    46ce:	79 17                	jns    46e7 <bigwrite+0x69>
+      printf(1, "cannot create bigwrite\n");
+    46d0:	83 ec 08             	sub    $0x8,%esp
+    46d3:	68 a8 7c 00 00       	push   $0x7ca8
+    46d8:	6a 01                	push   $0x1
+    46da:	e8 14 1a 00 00       	call   60f3 <printf>
+    46df:	83 c4 10             	add    $0x10,%esp
+      exit();
+    46e2:	e8 10 18 00 00       	call   5ef7 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+    46e7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    46ee:	eb 3f                	jmp    472f <bigwrite+0xb1>
+      int cc = write(fd, buf, sz);
+    46f0:	83 ec 04             	sub    $0x4,%esp
+    46f3:	ff 75 f4             	push   -0xc(%ebp)
+    46f6:	68 e0 8e 00 00       	push   $0x8ee0
+    46fb:	ff 75 ec             	push   -0x14(%ebp)
+    46fe:	e8 14 18 00 00       	call   5f17 <write>
+    4703:	83 c4 10             	add    $0x10,%esp
+    4706:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(cc != sz){
+    4709:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    470c:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    470f:	74 1a                	je     472b <bigwrite+0xad>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    4711:	ff 75 e8             	push   -0x18(%ebp)
+    4714:	ff 75 f4             	push   -0xc(%ebp)
+    4717:	68 c0 7c 00 00       	push   $0x7cc0
+    471c:	6a 01                	push   $0x1
+    471e:	e8 d0 19 00 00       	call   60f3 <printf>
+    4723:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4726:	e8 cc 17 00 00       	call   5ef7 <exit>
+    for(i = 0; i < 2; i++){
+    472b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    472f:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    4733:	7e bb                	jle    46f0 <bigwrite+0x72>
+      }
+    }
+    close(fd);
+    4735:	83 ec 0c             	sub    $0xc,%esp
+    4738:	ff 75 ec             	push   -0x14(%ebp)
+    473b:	e8 df 17 00 00       	call   5f1f <close>
+    4740:	83 c4 10             	add    $0x10,%esp
+    unlink("bigwrite");
+    4743:	83 ec 0c             	sub    $0xc,%esp
+    4746:	68 9f 7c 00 00       	push   $0x7c9f
+    474b:	e8 f7 17 00 00       	call   5f47 <unlink>
+    4750:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    4753:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    475a:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    4761:	0f 8e 4b ff ff ff    	jle    46b2 <bigwrite+0x34>
+  }
+
+  printf(1, "bigwrite ok\n");
+    4767:	83 ec 08             	sub    $0x8,%esp
+    476a:	68 d2 7c 00 00       	push   $0x7cd2
+    476f:	6a 01                	push   $0x1
+    4771:	e8 7d 19 00 00       	call   60f3 <printf>
+    4776:	83 c4 10             	add    $0x10,%esp
+}
+    4779:	90                   	nop
+    477a:	c9                   	leave
+    477b:	c3                   	ret
+
+0000477c <bigfile>:
+
+void
+bigfile(void)
+{
+    477c:	55                   	push   %ebp
+    477d:	89 e5                	mov    %esp,%ebp
+    477f:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    4782:	83 ec 08             	sub    $0x8,%esp
+    4785:	68 df 7c 00 00       	push   $0x7cdf
+    478a:	6a 01                	push   $0x1
+    478c:	e8 62 19 00 00       	call   60f3 <printf>
+    4791:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigfile");
+    4794:	83 ec 0c             	sub    $0xc,%esp
+    4797:	68 ed 7c 00 00       	push   $0x7ced
+    479c:	e8 a6 17 00 00       	call   5f47 <unlink>
+    47a1:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    47a4:	83 ec 08             	sub    $0x8,%esp
+    47a7:	68 02 02 00 00       	push   $0x202
+    47ac:	68 ed 7c 00 00       	push   $0x7ced
+    47b1:	e8 81 17 00 00       	call   5f37 <open>
+    47b6:	83 c4 10             	add    $0x10,%esp
+    47b9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    47bc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    47c0:	79 17                	jns    47d9 <bigfile+0x5d>
+    printf(1, "cannot create bigfile");
+    47c2:	83 ec 08             	sub    $0x8,%esp
+    47c5:	68 f5 7c 00 00       	push   $0x7cf5
+    47ca:	6a 01                	push   $0x1
+    47cc:	e8 22 19 00 00       	call   60f3 <printf>
+    47d1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    47d4:	e8 1e 17 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < 20; i++){
+    47d9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    47e0:	eb 52                	jmp    4834 <bigfile+0xb8>
+    memset(buf, i, 600);
+    47e2:	83 ec 04             	sub    $0x4,%esp
+    47e5:	68 58 02 00 00       	push   $0x258
+    47ea:	ff 75 f4             	push   -0xc(%ebp)
+    47ed:	68 e0 8e 00 00       	push   $0x8ee0
+    47f2:	e8 27 15 00 00       	call   5d1e <memset>
+    47f7:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 600) != 600){
+    47fa:	83 ec 04             	sub    $0x4,%esp
+    47fd:	68 58 02 00 00       	push   $0x258
+    4802:	68 e0 8e 00 00       	push   $0x8ee0
+    4807:	ff 75 ec             	push   -0x14(%ebp)
+    480a:	e8 08 17 00 00       	call   5f17 <write>
+    480f:	83 c4 10             	add    $0x10,%esp
+    4812:	3d 58 02 00 00       	cmp    $0x258,%eax
+    4817:	74 17                	je     4830 <bigfile+0xb4>
+      printf(1, "write bigfile failed\n");
+    4819:	83 ec 08             	sub    $0x8,%esp
+    481c:	68 0b 7d 00 00       	push   $0x7d0b
+    4821:	6a 01                	push   $0x1
+    4823:	e8 cb 18 00 00       	call   60f3 <printf>
+    4828:	83 c4 10             	add    $0x10,%esp
+      exit();
+    482b:	e8 c7 16 00 00       	call   5ef7 <exit>
+  for(i = 0; i < 20; i++){
+    4830:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4834:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    4838:	7e a8                	jle    47e2 <bigfile+0x66>
+    }
+  }
+  close(fd);
+    483a:	83 ec 0c             	sub    $0xc,%esp
+    483d:	ff 75 ec             	push   -0x14(%ebp)
+    4840:	e8 da 16 00 00       	call   5f1f <close>
+    4845:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bigfile", 0);
+    4848:	83 ec 08             	sub    $0x8,%esp
+    484b:	6a 00                	push   $0x0
+    484d:	68 ed 7c 00 00       	push   $0x7ced
+    4852:	e8 e0 16 00 00       	call   5f37 <open>
+    4857:	83 c4 10             	add    $0x10,%esp
+    485a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    485d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4861:	79 17                	jns    487a <bigfile+0xfe>
+    printf(1, "cannot open bigfile\n");
+    4863:	83 ec 08             	sub    $0x8,%esp
+    4866:	68 21 7d 00 00       	push   $0x7d21
+    486b:	6a 01                	push   $0x1
+    486d:	e8 81 18 00 00       	call   60f3 <printf>
+    4872:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4875:	e8 7d 16 00 00       	call   5ef7 <exit>
+  }
+  total = 0;
+    487a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; ; i++){
+    4881:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    4888:	83 ec 04             	sub    $0x4,%esp
+    488b:	68 2c 01 00 00       	push   $0x12c
+    4890:	68 e0 8e 00 00       	push   $0x8ee0
+    4895:	ff 75 ec             	push   -0x14(%ebp)
+    4898:	e8 72 16 00 00       	call   5f0f <read>
+    489d:	83 c4 10             	add    $0x10,%esp
+    48a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(cc < 0){
+    48a3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    48a7:	79 17                	jns    48c0 <bigfile+0x144>
+      printf(1, "read bigfile failed\n");
+    48a9:	83 ec 08             	sub    $0x8,%esp
+    48ac:	68 36 7d 00 00       	push   $0x7d36
+    48b1:	6a 01                	push   $0x1
+    48b3:	e8 3b 18 00 00       	call   60f3 <printf>
+    48b8:	83 c4 10             	add    $0x10,%esp
+      exit();
+    48bb:	e8 37 16 00 00       	call   5ef7 <exit>
+    }
+    if(cc == 0)
+    48c0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    48c4:	74 7a                	je     4940 <bigfile+0x1c4>
+      break;
+    if(cc != 300){
+    48c6:	81 7d e8 2c 01 00 00 	cmpl   $0x12c,-0x18(%ebp)
+    48cd:	74 17                	je     48e6 <bigfile+0x16a>
+      printf(1, "short read bigfile\n");
+    48cf:	83 ec 08             	sub    $0x8,%esp
+    48d2:	68 4b 7d 00 00       	push   $0x7d4b
+    48d7:	6a 01                	push   $0x1
+    48d9:	e8 15 18 00 00       	call   60f3 <printf>
+    48de:	83 c4 10             	add    $0x10,%esp
+      exit();
+    48e1:	e8 11 16 00 00       	call   5ef7 <exit>
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    48e6:	0f b6 05 e0 8e 00 00 	movzbl 0x8ee0,%eax
+    48ed:	0f be d0             	movsbl %al,%edx
+    48f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    48f3:	89 c1                	mov    %eax,%ecx
+    48f5:	c1 e9 1f             	shr    $0x1f,%ecx
+    48f8:	01 c8                	add    %ecx,%eax
+    48fa:	d1 f8                	sar    %eax
+    48fc:	39 c2                	cmp    %eax,%edx
+    48fe:	75 1a                	jne    491a <bigfile+0x19e>
+    4900:	0f b6 05 0b 90 00 00 	movzbl 0x900b,%eax
+    4907:	0f be d0             	movsbl %al,%edx
+    490a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    490d:	89 c1                	mov    %eax,%ecx
+    490f:	c1 e9 1f             	shr    $0x1f,%ecx
+    4912:	01 c8                	add    %ecx,%eax
+    4914:	d1 f8                	sar    %eax
+    4916:	39 c2                	cmp    %eax,%edx
+    4918:	74 17                	je     4931 <bigfile+0x1b5>
+      printf(1, "read bigfile wrong data\n");
+    491a:	83 ec 08             	sub    $0x8,%esp
+    491d:	68 5f 7d 00 00       	push   $0x7d5f
+    4922:	6a 01                	push   $0x1
+    4924:	e8 ca 17 00 00       	call   60f3 <printf>
+    4929:	83 c4 10             	add    $0x10,%esp
+      exit();
+    492c:	e8 c6 15 00 00       	call   5ef7 <exit>
+    }
+    total += cc;
+    4931:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4934:	01 45 f0             	add    %eax,-0x10(%ebp)
+  for(i = 0; ; i++){
+    4937:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    493b:	e9 48 ff ff ff       	jmp    4888 <bigfile+0x10c>
+      break;
+    4940:	90                   	nop
+  }
+  close(fd);
+    4941:	83 ec 0c             	sub    $0xc,%esp
+    4944:	ff 75 ec             	push   -0x14(%ebp)
+    4947:	e8 d3 15 00 00       	call   5f1f <close>
+    494c:	83 c4 10             	add    $0x10,%esp
+  if(total != 20*600){
+    494f:	81 7d f0 e0 2e 00 00 	cmpl   $0x2ee0,-0x10(%ebp)
+    4956:	74 17                	je     496f <bigfile+0x1f3>
+    printf(1, "read bigfile wrong total\n");
+    4958:	83 ec 08             	sub    $0x8,%esp
+    495b:	68 78 7d 00 00       	push   $0x7d78
+    4960:	6a 01                	push   $0x1
+    4962:	e8 8c 17 00 00       	call   60f3 <printf>
+    4967:	83 c4 10             	add    $0x10,%esp
+    exit();
+    496a:	e8 88 15 00 00       	call   5ef7 <exit>
+  }
+  unlink("bigfile");
+    496f:	83 ec 0c             	sub    $0xc,%esp
+    4972:	68 ed 7c 00 00       	push   $0x7ced
+    4977:	e8 cb 15 00 00       	call   5f47 <unlink>
+    497c:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "bigfile test ok\n");
+    497f:	83 ec 08             	sub    $0x8,%esp
+    4982:	68 92 7d 00 00       	push   $0x7d92
+    4987:	6a 01                	push   $0x1
+    4989:	e8 65 17 00 00       	call   60f3 <printf>
+    498e:	83 c4 10             	add    $0x10,%esp
+}
+    4991:	90                   	nop
+    4992:	c9                   	leave
+    4993:	c3                   	ret
+
+00004994 <fourteen>:
+
+void
+fourteen(void)
+{
+    4994:	55                   	push   %ebp
+    4995:	89 e5                	mov    %esp,%ebp
+    4997:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    499a:	83 ec 08             	sub    $0x8,%esp
+    499d:	68 a3 7d 00 00       	push   $0x7da3
+    49a2:	6a 01                	push   $0x1
+    49a4:	e8 4a 17 00 00       	call   60f3 <printf>
+    49a9:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234") != 0){
+    49ac:	83 ec 0c             	sub    $0xc,%esp
+    49af:	68 b2 7d 00 00       	push   $0x7db2
+    49b4:	e8 a6 15 00 00       	call   5f5f <mkdir>
+    49b9:	83 c4 10             	add    $0x10,%esp
+    49bc:	85 c0                	test   %eax,%eax
+    49be:	74 17                	je     49d7 <fourteen+0x43>
+    printf(1, "mkdir 12345678901234 failed\n");
+    49c0:	83 ec 08             	sub    $0x8,%esp
+    49c3:	68 c1 7d 00 00       	push   $0x7dc1
+    49c8:	6a 01                	push   $0x1
+    49ca:	e8 24 17 00 00       	call   60f3 <printf>
+    49cf:	83 c4 10             	add    $0x10,%esp
+    exit();
+    49d2:	e8 20 15 00 00       	call   5ef7 <exit>
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    49d7:	83 ec 0c             	sub    $0xc,%esp
+    49da:	68 e0 7d 00 00       	push   $0x7de0
+    49df:	e8 7b 15 00 00       	call   5f5f <mkdir>
+    49e4:	83 c4 10             	add    $0x10,%esp
+    49e7:	85 c0                	test   %eax,%eax
+    49e9:	74 17                	je     4a02 <fourteen+0x6e>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    49eb:	83 ec 08             	sub    $0x8,%esp
+    49ee:	68 00 7e 00 00       	push   $0x7e00
+    49f3:	6a 01                	push   $0x1
+    49f5:	e8 f9 16 00 00       	call   60f3 <printf>
+    49fa:	83 c4 10             	add    $0x10,%esp
+    exit();
+    49fd:	e8 f5 14 00 00       	call   5ef7 <exit>
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    4a02:	83 ec 08             	sub    $0x8,%esp
+    4a05:	68 00 02 00 00       	push   $0x200
+    4a0a:	68 30 7e 00 00       	push   $0x7e30
+    4a0f:	e8 23 15 00 00       	call   5f37 <open>
+    4a14:	83 c4 10             	add    $0x10,%esp
+    4a17:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    4a1a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4a1e:	79 17                	jns    4a37 <fourteen+0xa3>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    4a20:	83 ec 08             	sub    $0x8,%esp
+    4a23:	68 60 7e 00 00       	push   $0x7e60
+    4a28:	6a 01                	push   $0x1
+    4a2a:	e8 c4 16 00 00       	call   60f3 <printf>
+    4a2f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a32:	e8 c0 14 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    4a37:	83 ec 0c             	sub    $0xc,%esp
+    4a3a:	ff 75 f4             	push   -0xc(%ebp)
+    4a3d:	e8 dd 14 00 00       	call   5f1f <close>
+    4a42:	83 c4 10             	add    $0x10,%esp
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    4a45:	83 ec 08             	sub    $0x8,%esp
+    4a48:	6a 00                	push   $0x0
+    4a4a:	68 a0 7e 00 00       	push   $0x7ea0
+    4a4f:	e8 e3 14 00 00       	call   5f37 <open>
+    4a54:	83 c4 10             	add    $0x10,%esp
+    4a57:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    4a5a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4a5e:	79 17                	jns    4a77 <fourteen+0xe3>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    4a60:	83 ec 08             	sub    $0x8,%esp
+    4a63:	68 d0 7e 00 00       	push   $0x7ed0
+    4a68:	6a 01                	push   $0x1
+    4a6a:	e8 84 16 00 00       	call   60f3 <printf>
+    4a6f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4a72:	e8 80 14 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    4a77:	83 ec 0c             	sub    $0xc,%esp
+    4a7a:	ff 75 f4             	push   -0xc(%ebp)
+    4a7d:	e8 9d 14 00 00       	call   5f1f <close>
+    4a82:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    4a85:	83 ec 0c             	sub    $0xc,%esp
+    4a88:	68 0a 7f 00 00       	push   $0x7f0a
+    4a8d:	e8 cd 14 00 00       	call   5f5f <mkdir>
+    4a92:	83 c4 10             	add    $0x10,%esp
+    4a95:	85 c0                	test   %eax,%eax
+    4a97:	75 17                	jne    4ab0 <fourteen+0x11c>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    4a99:	83 ec 08             	sub    $0x8,%esp
+    4a9c:	68 28 7f 00 00       	push   $0x7f28
+    4aa1:	6a 01                	push   $0x1
+    4aa3:	e8 4b 16 00 00       	call   60f3 <printf>
+    4aa8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4aab:	e8 47 14 00 00       	call   5ef7 <exit>
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    4ab0:	83 ec 0c             	sub    $0xc,%esp
+    4ab3:	68 58 7f 00 00       	push   $0x7f58
+    4ab8:	e8 a2 14 00 00       	call   5f5f <mkdir>
+    4abd:	83 c4 10             	add    $0x10,%esp
+    4ac0:	85 c0                	test   %eax,%eax
+    4ac2:	75 17                	jne    4adb <fourteen+0x147>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    4ac4:	83 ec 08             	sub    $0x8,%esp
+    4ac7:	68 78 7f 00 00       	push   $0x7f78
+    4acc:	6a 01                	push   $0x1
+    4ace:	e8 20 16 00 00       	call   60f3 <printf>
+    4ad3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4ad6:	e8 1c 14 00 00       	call   5ef7 <exit>
+  }
+
+  printf(1, "fourteen ok\n");
+    4adb:	83 ec 08             	sub    $0x8,%esp
+    4ade:	68 a9 7f 00 00       	push   $0x7fa9
+    4ae3:	6a 01                	push   $0x1
+    4ae5:	e8 09 16 00 00       	call   60f3 <printf>
+    4aea:	83 c4 10             	add    $0x10,%esp
+}
+    4aed:	90                   	nop
+    4aee:	c9                   	leave
+    4aef:	c3                   	ret
+
+00004af0 <rmdot>:
+
+void
+rmdot(void)
+{
+    4af0:	55                   	push   %ebp
+    4af1:	89 e5                	mov    %esp,%ebp
+    4af3:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "rmdot test\n");
+    4af6:	83 ec 08             	sub    $0x8,%esp
+    4af9:	68 b6 7f 00 00       	push   $0x7fb6
+    4afe:	6a 01                	push   $0x1
+    4b00:	e8 ee 15 00 00       	call   60f3 <printf>
+    4b05:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dots") != 0){
+    4b08:	83 ec 0c             	sub    $0xc,%esp
+    4b0b:	68 c2 7f 00 00       	push   $0x7fc2
+    4b10:	e8 4a 14 00 00       	call   5f5f <mkdir>
+    4b15:	83 c4 10             	add    $0x10,%esp
+    4b18:	85 c0                	test   %eax,%eax
+    4b1a:	74 17                	je     4b33 <rmdot+0x43>
+    printf(1, "mkdir dots failed\n");
+    4b1c:	83 ec 08             	sub    $0x8,%esp
+    4b1f:	68 c7 7f 00 00       	push   $0x7fc7
+    4b24:	6a 01                	push   $0x1
+    4b26:	e8 c8 15 00 00       	call   60f3 <printf>
+    4b2b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b2e:	e8 c4 13 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("dots") != 0){
+    4b33:	83 ec 0c             	sub    $0xc,%esp
+    4b36:	68 c2 7f 00 00       	push   $0x7fc2
+    4b3b:	e8 27 14 00 00       	call   5f67 <chdir>
+    4b40:	83 c4 10             	add    $0x10,%esp
+    4b43:	85 c0                	test   %eax,%eax
+    4b45:	74 17                	je     4b5e <rmdot+0x6e>
+    printf(1, "chdir dots failed\n");
+    4b47:	83 ec 08             	sub    $0x8,%esp
+    4b4a:	68 da 7f 00 00       	push   $0x7fda
+    4b4f:	6a 01                	push   $0x1
+    4b51:	e8 9d 15 00 00       	call   60f3 <printf>
+    4b56:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b59:	e8 99 13 00 00       	call   5ef7 <exit>
+  }
+  if(unlink(".") == 0){
+    4b5e:	83 ec 0c             	sub    $0xc,%esp
+    4b61:	68 0b 72 00 00       	push   $0x720b
+    4b66:	e8 dc 13 00 00       	call   5f47 <unlink>
+    4b6b:	83 c4 10             	add    $0x10,%esp
+    4b6e:	85 c0                	test   %eax,%eax
+    4b70:	75 17                	jne    4b89 <rmdot+0x99>
+    printf(1, "rm . worked!\n");
+    4b72:	83 ec 08             	sub    $0x8,%esp
+    4b75:	68 ed 7f 00 00       	push   $0x7fed
+    4b7a:	6a 01                	push   $0x1
+    4b7c:	e8 72 15 00 00       	call   60f3 <printf>
+    4b81:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4b84:	e8 6e 13 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("..") == 0){
+    4b89:	83 ec 0c             	sub    $0xc,%esp
+    4b8c:	68 ca 68 00 00       	push   $0x68ca
+    4b91:	e8 b1 13 00 00       	call   5f47 <unlink>
+    4b96:	83 c4 10             	add    $0x10,%esp
+    4b99:	85 c0                	test   %eax,%eax
+    4b9b:	75 17                	jne    4bb4 <rmdot+0xc4>
+    printf(1, "rm .. worked!\n");
+    4b9d:	83 ec 08             	sub    $0x8,%esp
+    4ba0:	68 fb 7f 00 00       	push   $0x7ffb
+    4ba5:	6a 01                	push   $0x1
+    4ba7:	e8 47 15 00 00       	call   60f3 <printf>
+    4bac:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4baf:	e8 43 13 00 00       	call   5ef7 <exit>
+  }
+  if(chdir("/") != 0){
+    4bb4:	83 ec 0c             	sub    $0xc,%esp
+    4bb7:	68 1e 65 00 00       	push   $0x651e
+    4bbc:	e8 a6 13 00 00       	call   5f67 <chdir>
+    4bc1:	83 c4 10             	add    $0x10,%esp
+    4bc4:	85 c0                	test   %eax,%eax
+    4bc6:	74 17                	je     4bdf <rmdot+0xef>
+    printf(1, "chdir / failed\n");
+    4bc8:	83 ec 08             	sub    $0x8,%esp
+    4bcb:	68 20 65 00 00       	push   $0x6520
+    4bd0:	6a 01                	push   $0x1
+    4bd2:	e8 1c 15 00 00       	call   60f3 <printf>
+    4bd7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4bda:	e8 18 13 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dots/.") == 0){
+    4bdf:	83 ec 0c             	sub    $0xc,%esp
+    4be2:	68 0a 80 00 00       	push   $0x800a
+    4be7:	e8 5b 13 00 00       	call   5f47 <unlink>
+    4bec:	83 c4 10             	add    $0x10,%esp
+    4bef:	85 c0                	test   %eax,%eax
+    4bf1:	75 17                	jne    4c0a <rmdot+0x11a>
+    printf(1, "unlink dots/. worked!\n");
+    4bf3:	83 ec 08             	sub    $0x8,%esp
+    4bf6:	68 11 80 00 00       	push   $0x8011
+    4bfb:	6a 01                	push   $0x1
+    4bfd:	e8 f1 14 00 00       	call   60f3 <printf>
+    4c02:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c05:	e8 ed 12 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dots/..") == 0){
+    4c0a:	83 ec 0c             	sub    $0xc,%esp
+    4c0d:	68 28 80 00 00       	push   $0x8028
+    4c12:	e8 30 13 00 00       	call   5f47 <unlink>
+    4c17:	83 c4 10             	add    $0x10,%esp
+    4c1a:	85 c0                	test   %eax,%eax
+    4c1c:	75 17                	jne    4c35 <rmdot+0x145>
+    printf(1, "unlink dots/.. worked!\n");
+    4c1e:	83 ec 08             	sub    $0x8,%esp
+    4c21:	68 30 80 00 00       	push   $0x8030
+    4c26:	6a 01                	push   $0x1
+    4c28:	e8 c6 14 00 00       	call   60f3 <printf>
+    4c2d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c30:	e8 c2 12 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dots") != 0){
+    4c35:	83 ec 0c             	sub    $0xc,%esp
+    4c38:	68 c2 7f 00 00       	push   $0x7fc2
+    4c3d:	e8 05 13 00 00       	call   5f47 <unlink>
+    4c42:	83 c4 10             	add    $0x10,%esp
+    4c45:	85 c0                	test   %eax,%eax
+    4c47:	74 17                	je     4c60 <rmdot+0x170>
+    printf(1, "unlink dots failed!\n");
+    4c49:	83 ec 08             	sub    $0x8,%esp
+    4c4c:	68 48 80 00 00       	push   $0x8048
+    4c51:	6a 01                	push   $0x1
+    4c53:	e8 9b 14 00 00       	call   60f3 <printf>
+    4c58:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4c5b:	e8 97 12 00 00       	call   5ef7 <exit>
+  }
+  printf(1, "rmdot ok\n");
+    4c60:	83 ec 08             	sub    $0x8,%esp
+    4c63:	68 5d 80 00 00       	push   $0x805d
+    4c68:	6a 01                	push   $0x1
+    4c6a:	e8 84 14 00 00       	call   60f3 <printf>
+    4c6f:	83 c4 10             	add    $0x10,%esp
+}
+    4c72:	90                   	nop
+    4c73:	c9                   	leave
+    4c74:	c3                   	ret
+
+00004c75 <dirfile>:
+
+void
+dirfile(void)
+{
+    4c75:	55                   	push   %ebp
+    4c76:	89 e5                	mov    %esp,%ebp
+    4c78:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    4c7b:	83 ec 08             	sub    $0x8,%esp
+    4c7e:	68 67 80 00 00       	push   $0x8067
+    4c83:	6a 01                	push   $0x1
+    4c85:	e8 69 14 00 00       	call   60f3 <printf>
+    4c8a:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dirfile", O_CREATE);
+    4c8d:	83 ec 08             	sub    $0x8,%esp
+    4c90:	68 00 02 00 00       	push   $0x200
+    4c95:	68 74 80 00 00       	push   $0x8074
+    4c9a:	e8 98 12 00 00       	call   5f37 <open>
+    4c9f:	83 c4 10             	add    $0x10,%esp
+    4ca2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    4ca5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4ca9:	79 17                	jns    4cc2 <dirfile+0x4d>
+    printf(1, "create dirfile failed\n");
+    4cab:	83 ec 08             	sub    $0x8,%esp
+    4cae:	68 7c 80 00 00       	push   $0x807c
+    4cb3:	6a 01                	push   $0x1
+    4cb5:	e8 39 14 00 00       	call   60f3 <printf>
+    4cba:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4cbd:	e8 35 12 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    4cc2:	83 ec 0c             	sub    $0xc,%esp
+    4cc5:	ff 75 f4             	push   -0xc(%ebp)
+    4cc8:	e8 52 12 00 00       	call   5f1f <close>
+    4ccd:	83 c4 10             	add    $0x10,%esp
+  if(chdir("dirfile") == 0){
+    4cd0:	83 ec 0c             	sub    $0xc,%esp
+    4cd3:	68 74 80 00 00       	push   $0x8074
+    4cd8:	e8 8a 12 00 00       	call   5f67 <chdir>
+    4cdd:	83 c4 10             	add    $0x10,%esp
+    4ce0:	85 c0                	test   %eax,%eax
+    4ce2:	75 17                	jne    4cfb <dirfile+0x86>
+    printf(1, "chdir dirfile succeeded!\n");
+    4ce4:	83 ec 08             	sub    $0x8,%esp
+    4ce7:	68 93 80 00 00       	push   $0x8093
+    4cec:	6a 01                	push   $0x1
+    4cee:	e8 00 14 00 00       	call   60f3 <printf>
+    4cf3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4cf6:	e8 fc 11 00 00       	call   5ef7 <exit>
+  }
+  fd = open("dirfile/xx", 0);
+    4cfb:	83 ec 08             	sub    $0x8,%esp
+    4cfe:	6a 00                	push   $0x0
+    4d00:	68 ad 80 00 00       	push   $0x80ad
+    4d05:	e8 2d 12 00 00       	call   5f37 <open>
+    4d0a:	83 c4 10             	add    $0x10,%esp
+    4d0d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    4d10:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4d14:	78 17                	js     4d2d <dirfile+0xb8>
+    printf(1, "create dirfile/xx succeeded!\n");
+    4d16:	83 ec 08             	sub    $0x8,%esp
+    4d19:	68 b8 80 00 00       	push   $0x80b8
+    4d1e:	6a 01                	push   $0x1
+    4d20:	e8 ce 13 00 00       	call   60f3 <printf>
+    4d25:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d28:	e8 ca 11 00 00       	call   5ef7 <exit>
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    4d2d:	83 ec 08             	sub    $0x8,%esp
+    4d30:	68 00 02 00 00       	push   $0x200
+    4d35:	68 ad 80 00 00       	push   $0x80ad
+    4d3a:	e8 f8 11 00 00       	call   5f37 <open>
+    4d3f:	83 c4 10             	add    $0x10,%esp
+    4d42:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    4d45:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4d49:	78 17                	js     4d62 <dirfile+0xed>
+    printf(1, "create dirfile/xx succeeded!\n");
+    4d4b:	83 ec 08             	sub    $0x8,%esp
+    4d4e:	68 b8 80 00 00       	push   $0x80b8
+    4d53:	6a 01                	push   $0x1
+    4d55:	e8 99 13 00 00       	call   60f3 <printf>
+    4d5a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d5d:	e8 95 11 00 00       	call   5ef7 <exit>
+  }
+  if(mkdir("dirfile/xx") == 0){
+    4d62:	83 ec 0c             	sub    $0xc,%esp
+    4d65:	68 ad 80 00 00       	push   $0x80ad
+    4d6a:	e8 f0 11 00 00       	call   5f5f <mkdir>
+    4d6f:	83 c4 10             	add    $0x10,%esp
+    4d72:	85 c0                	test   %eax,%eax
+    4d74:	75 17                	jne    4d8d <dirfile+0x118>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    4d76:	83 ec 08             	sub    $0x8,%esp
+    4d79:	68 d6 80 00 00       	push   $0x80d6
+    4d7e:	6a 01                	push   $0x1
+    4d80:	e8 6e 13 00 00       	call   60f3 <printf>
+    4d85:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4d88:	e8 6a 11 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dirfile/xx") == 0){
+    4d8d:	83 ec 0c             	sub    $0xc,%esp
+    4d90:	68 ad 80 00 00       	push   $0x80ad
+    4d95:	e8 ad 11 00 00       	call   5f47 <unlink>
+    4d9a:	83 c4 10             	add    $0x10,%esp
+    4d9d:	85 c0                	test   %eax,%eax
+    4d9f:	75 17                	jne    4db8 <dirfile+0x143>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    4da1:	83 ec 08             	sub    $0x8,%esp
+    4da4:	68 f3 80 00 00       	push   $0x80f3
+    4da9:	6a 01                	push   $0x1
+    4dab:	e8 43 13 00 00       	call   60f3 <printf>
+    4db0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4db3:	e8 3f 11 00 00       	call   5ef7 <exit>
+  }
+  if(link("README", "dirfile/xx") == 0){
+    4db8:	83 ec 08             	sub    $0x8,%esp
+    4dbb:	68 ad 80 00 00       	push   $0x80ad
+    4dc0:	68 11 81 00 00       	push   $0x8111
+    4dc5:	e8 8d 11 00 00       	call   5f57 <link>
+    4dca:	83 c4 10             	add    $0x10,%esp
+    4dcd:	85 c0                	test   %eax,%eax
+    4dcf:	75 17                	jne    4de8 <dirfile+0x173>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    4dd1:	83 ec 08             	sub    $0x8,%esp
+    4dd4:	68 18 81 00 00       	push   $0x8118
+    4dd9:	6a 01                	push   $0x1
+    4ddb:	e8 13 13 00 00       	call   60f3 <printf>
+    4de0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4de3:	e8 0f 11 00 00       	call   5ef7 <exit>
+  }
+  if(unlink("dirfile") != 0){
+    4de8:	83 ec 0c             	sub    $0xc,%esp
+    4deb:	68 74 80 00 00       	push   $0x8074
+    4df0:	e8 52 11 00 00       	call   5f47 <unlink>
+    4df5:	83 c4 10             	add    $0x10,%esp
+    4df8:	85 c0                	test   %eax,%eax
+    4dfa:	74 17                	je     4e13 <dirfile+0x19e>
+    printf(1, "unlink dirfile failed!\n");
+    4dfc:	83 ec 08             	sub    $0x8,%esp
+    4dff:	68 37 81 00 00       	push   $0x8137
+    4e04:	6a 01                	push   $0x1
+    4e06:	e8 e8 12 00 00       	call   60f3 <printf>
+    4e0b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4e0e:	e8 e4 10 00 00       	call   5ef7 <exit>
+  }
+
+  fd = open(".", O_RDWR);
+    4e13:	83 ec 08             	sub    $0x8,%esp
+    4e16:	6a 02                	push   $0x2
+    4e18:	68 0b 72 00 00       	push   $0x720b
+    4e1d:	e8 15 11 00 00       	call   5f37 <open>
+    4e22:	83 c4 10             	add    $0x10,%esp
+    4e25:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    4e28:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4e2c:	78 17                	js     4e45 <dirfile+0x1d0>
+    printf(1, "open . for writing succeeded!\n");
+    4e2e:	83 ec 08             	sub    $0x8,%esp
+    4e31:	68 50 81 00 00       	push   $0x8150
+    4e36:	6a 01                	push   $0x1
+    4e38:	e8 b6 12 00 00       	call   60f3 <printf>
+    4e3d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4e40:	e8 b2 10 00 00       	call   5ef7 <exit>
+  }
+  fd = open(".", 0);
+    4e45:	83 ec 08             	sub    $0x8,%esp
+    4e48:	6a 00                	push   $0x0
+    4e4a:	68 0b 72 00 00       	push   $0x720b
+    4e4f:	e8 e3 10 00 00       	call   5f37 <open>
+    4e54:	83 c4 10             	add    $0x10,%esp
+    4e57:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(write(fd, "x", 1) > 0){
+    4e5a:	83 ec 04             	sub    $0x4,%esp
+    4e5d:	6a 01                	push   $0x1
+    4e5f:	68 bb 69 00 00       	push   $0x69bb
+    4e64:	ff 75 f4             	push   -0xc(%ebp)
+    4e67:	e8 ab 10 00 00       	call   5f17 <write>
+    4e6c:	83 c4 10             	add    $0x10,%esp
+    4e6f:	85 c0                	test   %eax,%eax
+    4e71:	7e 17                	jle    4e8a <dirfile+0x215>
+    printf(1, "write . succeeded!\n");
+    4e73:	83 ec 08             	sub    $0x8,%esp
+    4e76:	68 6f 81 00 00       	push   $0x816f
+    4e7b:	6a 01                	push   $0x1
+    4e7d:	e8 71 12 00 00       	call   60f3 <printf>
+    4e82:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4e85:	e8 6d 10 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    4e8a:	83 ec 0c             	sub    $0xc,%esp
+    4e8d:	ff 75 f4             	push   -0xc(%ebp)
+    4e90:	e8 8a 10 00 00       	call   5f1f <close>
+    4e95:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "dir vs file OK\n");
+    4e98:	83 ec 08             	sub    $0x8,%esp
+    4e9b:	68 83 81 00 00       	push   $0x8183
+    4ea0:	6a 01                	push   $0x1
+    4ea2:	e8 4c 12 00 00       	call   60f3 <printf>
+    4ea7:	83 c4 10             	add    $0x10,%esp
+}
+    4eaa:	90                   	nop
+    4eab:	c9                   	leave
+    4eac:	c3                   	ret
+
+00004ead <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    4ead:	55                   	push   %ebp
+    4eae:	89 e5                	mov    %esp,%ebp
+    4eb0:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    4eb3:	83 ec 08             	sub    $0x8,%esp
+    4eb6:	68 93 81 00 00       	push   $0x8193
+    4ebb:	6a 01                	push   $0x1
+    4ebd:	e8 31 12 00 00       	call   60f3 <printf>
+    4ec2:	83 c4 10             	add    $0x10,%esp
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    4ec5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4ecc:	e9 e7 00 00 00       	jmp    4fb8 <iref+0x10b>
+    if(mkdir("irefd") != 0){
+    4ed1:	83 ec 0c             	sub    $0xc,%esp
+    4ed4:	68 a4 81 00 00       	push   $0x81a4
+    4ed9:	e8 81 10 00 00       	call   5f5f <mkdir>
+    4ede:	83 c4 10             	add    $0x10,%esp
+    4ee1:	85 c0                	test   %eax,%eax
+    4ee3:	74 17                	je     4efc <iref+0x4f>
+      printf(1, "mkdir irefd failed\n");
+    4ee5:	83 ec 08             	sub    $0x8,%esp
+    4ee8:	68 aa 81 00 00       	push   $0x81aa
+    4eed:	6a 01                	push   $0x1
+    4eef:	e8 ff 11 00 00       	call   60f3 <printf>
+    4ef4:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4ef7:	e8 fb 0f 00 00       	call   5ef7 <exit>
+    }
+    if(chdir("irefd") != 0){
+    4efc:	83 ec 0c             	sub    $0xc,%esp
+    4eff:	68 a4 81 00 00       	push   $0x81a4
+    4f04:	e8 5e 10 00 00       	call   5f67 <chdir>
+    4f09:	83 c4 10             	add    $0x10,%esp
+    4f0c:	85 c0                	test   %eax,%eax
+    4f0e:	74 17                	je     4f27 <iref+0x7a>
+      printf(1, "chdir irefd failed\n");
+    4f10:	83 ec 08             	sub    $0x8,%esp
+    4f13:	68 be 81 00 00       	push   $0x81be
+    4f18:	6a 01                	push   $0x1
+    4f1a:	e8 d4 11 00 00       	call   60f3 <printf>
+    4f1f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4f22:	e8 d0 0f 00 00       	call   5ef7 <exit>
+    }
+
+    mkdir("");
+    4f27:	83 ec 0c             	sub    $0xc,%esp
+    4f2a:	68 d2 81 00 00       	push   $0x81d2
+    4f2f:	e8 2b 10 00 00       	call   5f5f <mkdir>
+    4f34:	83 c4 10             	add    $0x10,%esp
+    link("README", "");
+    4f37:	83 ec 08             	sub    $0x8,%esp
+    4f3a:	68 d2 81 00 00       	push   $0x81d2
+    4f3f:	68 11 81 00 00       	push   $0x8111
+    4f44:	e8 0e 10 00 00       	call   5f57 <link>
+    4f49:	83 c4 10             	add    $0x10,%esp
+    fd = open("", O_CREATE);
+    4f4c:	83 ec 08             	sub    $0x8,%esp
+    4f4f:	68 00 02 00 00       	push   $0x200
+    4f54:	68 d2 81 00 00       	push   $0x81d2
+    4f59:	e8 d9 0f 00 00       	call   5f37 <open>
+    4f5e:	83 c4 10             	add    $0x10,%esp
+    4f61:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    4f64:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4f68:	78 0e                	js     4f78 <iref+0xcb>
+      close(fd);
+    4f6a:	83 ec 0c             	sub    $0xc,%esp
+    4f6d:	ff 75 f0             	push   -0x10(%ebp)
+    4f70:	e8 aa 0f 00 00       	call   5f1f <close>
+    4f75:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    4f78:	83 ec 08             	sub    $0x8,%esp
+    4f7b:	68 00 02 00 00       	push   $0x200
+    4f80:	68 d3 81 00 00       	push   $0x81d3
+    4f85:	e8 ad 0f 00 00       	call   5f37 <open>
+    4f8a:	83 c4 10             	add    $0x10,%esp
+    4f8d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    4f90:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4f94:	78 0e                	js     4fa4 <iref+0xf7>
+      close(fd);
+    4f96:	83 ec 0c             	sub    $0xc,%esp
+    4f99:	ff 75 f0             	push   -0x10(%ebp)
+    4f9c:	e8 7e 0f 00 00       	call   5f1f <close>
+    4fa1:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    4fa4:	83 ec 0c             	sub    $0xc,%esp
+    4fa7:	68 d3 81 00 00       	push   $0x81d3
+    4fac:	e8 96 0f 00 00       	call   5f47 <unlink>
+    4fb1:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 50 + 1; i++){
+    4fb4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4fb8:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    4fbc:	0f 8e 0f ff ff ff    	jle    4ed1 <iref+0x24>
+  }
+
+  chdir("/");
+    4fc2:	83 ec 0c             	sub    $0xc,%esp
+    4fc5:	68 1e 65 00 00       	push   $0x651e
+    4fca:	e8 98 0f 00 00       	call   5f67 <chdir>
+    4fcf:	83 c4 10             	add    $0x10,%esp
+  printf(1, "empty file name OK\n");
+    4fd2:	83 ec 08             	sub    $0x8,%esp
+    4fd5:	68 d6 81 00 00       	push   $0x81d6
+    4fda:	6a 01                	push   $0x1
+    4fdc:	e8 12 11 00 00       	call   60f3 <printf>
+    4fe1:	83 c4 10             	add    $0x10,%esp
+}
+    4fe4:	90                   	nop
+    4fe5:	c9                   	leave
+    4fe6:	c3                   	ret
+
+00004fe7 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    4fe7:	55                   	push   %ebp
+    4fe8:	89 e5                	mov    %esp,%ebp
+    4fea:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    4fed:	83 ec 08             	sub    $0x8,%esp
+    4ff0:	68 ea 81 00 00       	push   $0x81ea
+    4ff5:	6a 01                	push   $0x1
+    4ff7:	e8 f7 10 00 00       	call   60f3 <printf>
+    4ffc:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    4fff:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5006:	eb 1d                	jmp    5025 <forktest+0x3e>
+    pid = fork();
+    5008:	e8 e2 0e 00 00       	call   5eef <fork>
+    500d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+    5010:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5014:	78 1a                	js     5030 <forktest+0x49>
+      break;
+    if(pid == 0)
+    5016:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    501a:	75 05                	jne    5021 <forktest+0x3a>
+      exit();
+    501c:	e8 d6 0e 00 00       	call   5ef7 <exit>
+  for(n=0; n<1000; n++){
+    5021:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    5025:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    502c:	7e da                	jle    5008 <forktest+0x21>
+    502e:	eb 01                	jmp    5031 <forktest+0x4a>
+      break;
+    5030:	90                   	nop
+  }
+  
+  if(n == 1000){
+    5031:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+    5038:	75 3b                	jne    5075 <forktest+0x8e>
+    printf(1, "fork claimed to work 1000 times!\n");
+    503a:	83 ec 08             	sub    $0x8,%esp
+    503d:	68 f8 81 00 00       	push   $0x81f8
+    5042:	6a 01                	push   $0x1
+    5044:	e8 aa 10 00 00       	call   60f3 <printf>
+    5049:	83 c4 10             	add    $0x10,%esp
+    exit();
+    504c:	e8 a6 0e 00 00       	call   5ef7 <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+    5051:	e8 a9 0e 00 00       	call   5eff <wait>
+    5056:	85 c0                	test   %eax,%eax
+    5058:	79 17                	jns    5071 <forktest+0x8a>
+      printf(1, "wait stopped early\n");
+    505a:	83 ec 08             	sub    $0x8,%esp
+    505d:	68 1a 82 00 00       	push   $0x821a
+    5062:	6a 01                	push   $0x1
+    5064:	e8 8a 10 00 00       	call   60f3 <printf>
+    5069:	83 c4 10             	add    $0x10,%esp
+      exit();
+    506c:	e8 86 0e 00 00       	call   5ef7 <exit>
+  for(; n > 0; n--){
+    5071:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    5075:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5079:	7f d6                	jg     5051 <forktest+0x6a>
+    }
+  }
+  
+  if(wait() != -1){
+    507b:	e8 7f 0e 00 00       	call   5eff <wait>
+    5080:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5083:	74 17                	je     509c <forktest+0xb5>
+    printf(1, "wait got too many\n");
+    5085:	83 ec 08             	sub    $0x8,%esp
+    5088:	68 2e 82 00 00       	push   $0x822e
+    508d:	6a 01                	push   $0x1
+    508f:	e8 5f 10 00 00       	call   60f3 <printf>
+    5094:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5097:	e8 5b 0e 00 00       	call   5ef7 <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+    509c:	83 ec 08             	sub    $0x8,%esp
+    509f:	68 41 82 00 00       	push   $0x8241
+    50a4:	6a 01                	push   $0x1
+    50a6:	e8 48 10 00 00       	call   60f3 <printf>
+    50ab:	83 c4 10             	add    $0x10,%esp
+}
+    50ae:	90                   	nop
+    50af:	c9                   	leave
+    50b0:	c3                   	ret
+
+000050b1 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    50b1:	55                   	push   %ebp
+    50b2:	89 e5                	mov    %esp,%ebp
+    50b4:	83 ec 68             	sub    $0x68,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    50b7:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    50bc:	83 ec 08             	sub    $0x8,%esp
+    50bf:	68 4f 82 00 00       	push   $0x824f
+    50c4:	50                   	push   %eax
+    50c5:	e8 29 10 00 00       	call   60f3 <printf>
+    50ca:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    50cd:	83 ec 0c             	sub    $0xc,%esp
+    50d0:	6a 00                	push   $0x0
+    50d2:	e8 a8 0e 00 00       	call   5f7f <sbrk>
+    50d7:	83 c4 10             	add    $0x10,%esp
+    50da:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    50dd:	83 ec 0c             	sub    $0xc,%esp
+    50e0:	6a 00                	push   $0x0
+    50e2:	e8 98 0e 00 00       	call   5f7f <sbrk>
+    50e7:	83 c4 10             	add    $0x10,%esp
+    50ea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  int i;
+  for(i = 0; i < 5000; i++){ 
+    50ed:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    50f4:	eb 4f                	jmp    5145 <sbrktest+0x94>
+    b = sbrk(1);
+    50f6:	83 ec 0c             	sub    $0xc,%esp
+    50f9:	6a 01                	push   $0x1
+    50fb:	e8 7f 0e 00 00       	call   5f7f <sbrk>
+    5100:	83 c4 10             	add    $0x10,%esp
+    5103:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(b != a){
+    5106:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    5109:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    510c:	74 24                	je     5132 <sbrktest+0x81>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    510e:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    5113:	83 ec 0c             	sub    $0xc,%esp
+    5116:	ff 75 d0             	push   -0x30(%ebp)
+    5119:	ff 75 f4             	push   -0xc(%ebp)
+    511c:	ff 75 f0             	push   -0x10(%ebp)
+    511f:	68 5a 82 00 00       	push   $0x825a
+    5124:	50                   	push   %eax
+    5125:	e8 c9 0f 00 00       	call   60f3 <printf>
+    512a:	83 c4 20             	add    $0x20,%esp
+      exit();
+    512d:	e8 c5 0d 00 00       	call   5ef7 <exit>
+    }
+    *b = 1;
+    5132:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    5135:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    5138:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    513b:	83 c0 01             	add    $0x1,%eax
+    513e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < 5000; i++){ 
+    5141:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    5145:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    514c:	7e a8                	jle    50f6 <sbrktest+0x45>
+  }
+  pid = fork();
+    514e:	e8 9c 0d 00 00       	call   5eef <fork>
+    5153:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    5156:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    515a:	79 1b                	jns    5177 <sbrktest+0xc6>
+    printf(stdout, "sbrk test fork failed\n");
+    515c:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    5161:	83 ec 08             	sub    $0x8,%esp
+    5164:	68 75 82 00 00       	push   $0x8275
+    5169:	50                   	push   %eax
+    516a:	e8 84 0f 00 00       	call   60f3 <printf>
+    516f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5172:	e8 80 0d 00 00       	call   5ef7 <exit>
+  }
+  c = sbrk(1);
+    5177:	83 ec 0c             	sub    $0xc,%esp
+    517a:	6a 01                	push   $0x1
+    517c:	e8 fe 0d 00 00       	call   5f7f <sbrk>
+    5181:	83 c4 10             	add    $0x10,%esp
+    5184:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c = sbrk(1);
+    5187:	83 ec 0c             	sub    $0xc,%esp
+    518a:	6a 01                	push   $0x1
+    518c:	e8 ee 0d 00 00       	call   5f7f <sbrk>
+    5191:	83 c4 10             	add    $0x10,%esp
+    5194:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a + 1){
+    5197:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    519a:	83 c0 01             	add    $0x1,%eax
+    519d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    51a0:	74 1b                	je     51bd <sbrktest+0x10c>
+    printf(stdout, "sbrk test failed post-fork\n");
+    51a2:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    51a7:	83 ec 08             	sub    $0x8,%esp
+    51aa:	68 8c 82 00 00       	push   $0x828c
+    51af:	50                   	push   %eax
+    51b0:	e8 3e 0f 00 00       	call   60f3 <printf>
+    51b5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    51b8:	e8 3a 0d 00 00       	call   5ef7 <exit>
+  }
+  if(pid == 0)
+    51bd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    51c1:	75 05                	jne    51c8 <sbrktest+0x117>
+    exit();
+    51c3:	e8 2f 0d 00 00       	call   5ef7 <exit>
+  wait();
+    51c8:	e8 32 0d 00 00       	call   5eff <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    51cd:	83 ec 0c             	sub    $0xc,%esp
+    51d0:	6a 00                	push   $0x0
+    51d2:	e8 a8 0d 00 00       	call   5f7f <sbrk>
+    51d7:	83 c4 10             	add    $0x10,%esp
+    51da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  amt = (BIG) - (uint)a;
+    51dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    51e0:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    51e5:	29 c2                	sub    %eax,%edx
+    51e7:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  p = sbrk(amt);
+    51ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    51ed:	83 ec 0c             	sub    $0xc,%esp
+    51f0:	50                   	push   %eax
+    51f1:	e8 89 0d 00 00       	call   5f7f <sbrk>
+    51f6:	83 c4 10             	add    $0x10,%esp
+    51f9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if (p != a) { 
+    51fc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    51ff:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    5202:	74 1b                	je     521f <sbrktest+0x16e>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    5204:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    5209:	83 ec 08             	sub    $0x8,%esp
+    520c:	68 a8 82 00 00       	push   $0x82a8
+    5211:	50                   	push   %eax
+    5212:	e8 dc 0e 00 00       	call   60f3 <printf>
+    5217:	83 c4 10             	add    $0x10,%esp
+    exit();
+    521a:	e8 d8 0c 00 00       	call   5ef7 <exit>
+  }
+  lastaddr = (char*) (BIG-1);
+    521f:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+  *lastaddr = 99;
+    5226:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    5229:	c6 00 63             	movb   $0x63,(%eax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+    522c:	83 ec 0c             	sub    $0xc,%esp
+    522f:	6a 00                	push   $0x0
+    5231:	e8 49 0d 00 00       	call   5f7f <sbrk>
+    5236:	83 c4 10             	add    $0x10,%esp
+    5239:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-4096);
+    523c:	83 ec 0c             	sub    $0xc,%esp
+    523f:	68 00 f0 ff ff       	push   $0xfffff000
+    5244:	e8 36 0d 00 00       	call   5f7f <sbrk>
+    5249:	83 c4 10             	add    $0x10,%esp
+    524c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c == (char*)0xffffffff){
+    524f:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    5253:	75 1b                	jne    5270 <sbrktest+0x1bf>
+    printf(stdout, "sbrk could not deallocate\n");
+    5255:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    525a:	83 ec 08             	sub    $0x8,%esp
+    525d:	68 e6 82 00 00       	push   $0x82e6
+    5262:	50                   	push   %eax
+    5263:	e8 8b 0e 00 00       	call   60f3 <printf>
+    5268:	83 c4 10             	add    $0x10,%esp
+    exit();
+    526b:	e8 87 0c 00 00       	call   5ef7 <exit>
+  }
+  c = sbrk(0);
+    5270:	83 ec 0c             	sub    $0xc,%esp
+    5273:	6a 00                	push   $0x0
+    5275:	e8 05 0d 00 00       	call   5f7f <sbrk>
+    527a:	83 c4 10             	add    $0x10,%esp
+    527d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a - 4096){
+    5280:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5283:	2d 00 10 00 00       	sub    $0x1000,%eax
+    5288:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    528b:	74 1e                	je     52ab <sbrktest+0x1fa>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    528d:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    5292:	ff 75 e4             	push   -0x1c(%ebp)
+    5295:	ff 75 f4             	push   -0xc(%ebp)
+    5298:	68 04 83 00 00       	push   $0x8304
+    529d:	50                   	push   %eax
+    529e:	e8 50 0e 00 00       	call   60f3 <printf>
+    52a3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    52a6:	e8 4c 0c 00 00       	call   5ef7 <exit>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    52ab:	83 ec 0c             	sub    $0xc,%esp
+    52ae:	6a 00                	push   $0x0
+    52b0:	e8 ca 0c 00 00       	call   5f7f <sbrk>
+    52b5:	83 c4 10             	add    $0x10,%esp
+    52b8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(4096);
+    52bb:	83 ec 0c             	sub    $0xc,%esp
+    52be:	68 00 10 00 00       	push   $0x1000
+    52c3:	e8 b7 0c 00 00       	call   5f7f <sbrk>
+    52c8:	83 c4 10             	add    $0x10,%esp
+    52cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a || sbrk(0) != a + 4096){
+    52ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    52d1:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    52d4:	75 1a                	jne    52f0 <sbrktest+0x23f>
+    52d6:	83 ec 0c             	sub    $0xc,%esp
+    52d9:	6a 00                	push   $0x0
+    52db:	e8 9f 0c 00 00       	call   5f7f <sbrk>
+    52e0:	83 c4 10             	add    $0x10,%esp
+    52e3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    52e6:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    52ec:	39 d0                	cmp    %edx,%eax
+    52ee:	74 1e                	je     530e <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    52f0:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    52f5:	ff 75 e4             	push   -0x1c(%ebp)
+    52f8:	ff 75 f4             	push   -0xc(%ebp)
+    52fb:	68 3c 83 00 00       	push   $0x833c
+    5300:	50                   	push   %eax
+    5301:	e8 ed 0d 00 00       	call   60f3 <printf>
+    5306:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5309:	e8 e9 0b 00 00       	call   5ef7 <exit>
+  }
+  if(*lastaddr == 99){
+    530e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    5311:	0f b6 00             	movzbl (%eax),%eax
+    5314:	3c 63                	cmp    $0x63,%al
+    5316:	75 1b                	jne    5333 <sbrktest+0x282>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    5318:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    531d:	83 ec 08             	sub    $0x8,%esp
+    5320:	68 64 83 00 00       	push   $0x8364
+    5325:	50                   	push   %eax
+    5326:	e8 c8 0d 00 00       	call   60f3 <printf>
+    532b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    532e:	e8 c4 0b 00 00       	call   5ef7 <exit>
+  }
+
+  a = sbrk(0);
+    5333:	83 ec 0c             	sub    $0xc,%esp
+    5336:	6a 00                	push   $0x0
+    5338:	e8 42 0c 00 00       	call   5f7f <sbrk>
+    533d:	83 c4 10             	add    $0x10,%esp
+    5340:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+    5343:	83 ec 0c             	sub    $0xc,%esp
+    5346:	6a 00                	push   $0x0
+    5348:	e8 32 0c 00 00       	call   5f7f <sbrk>
+    534d:	83 c4 10             	add    $0x10,%esp
+    5350:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    5353:	29 c2                	sub    %eax,%edx
+    5355:	83 ec 0c             	sub    $0xc,%esp
+    5358:	52                   	push   %edx
+    5359:	e8 21 0c 00 00       	call   5f7f <sbrk>
+    535e:	83 c4 10             	add    $0x10,%esp
+    5361:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a){
+    5364:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5367:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    536a:	74 1e                	je     538a <sbrktest+0x2d9>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    536c:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    5371:	ff 75 e4             	push   -0x1c(%ebp)
+    5374:	ff 75 f4             	push   -0xc(%ebp)
+    5377:	68 94 83 00 00       	push   $0x8394
+    537c:	50                   	push   %eax
+    537d:	e8 71 0d 00 00       	call   60f3 <printf>
+    5382:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5385:	e8 6d 0b 00 00       	call   5ef7 <exit>
+  }
+  
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    538a:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    5391:	eb 76                	jmp    5409 <sbrktest+0x358>
+    ppid = getpid();
+    5393:	e8 df 0b 00 00       	call   5f77 <getpid>
+    5398:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    pid = fork();
+    539b:	e8 4f 0b 00 00       	call   5eef <fork>
+    53a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    53a3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    53a7:	79 1b                	jns    53c4 <sbrktest+0x313>
+      printf(stdout, "fork failed\n");
+    53a9:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    53ae:	83 ec 08             	sub    $0x8,%esp
+    53b1:	68 4d 65 00 00       	push   $0x654d
+    53b6:	50                   	push   %eax
+    53b7:	e8 37 0d 00 00       	call   60f3 <printf>
+    53bc:	83 c4 10             	add    $0x10,%esp
+      exit();
+    53bf:	e8 33 0b 00 00       	call   5ef7 <exit>
+    }
+    if(pid == 0){
+    53c4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    53c8:	75 33                	jne    53fd <sbrktest+0x34c>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    53ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    53cd:	0f b6 00             	movzbl (%eax),%eax
+    53d0:	0f be d0             	movsbl %al,%edx
+    53d3:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    53d8:	52                   	push   %edx
+    53d9:	ff 75 f4             	push   -0xc(%ebp)
+    53dc:	68 b5 83 00 00       	push   $0x83b5
+    53e1:	50                   	push   %eax
+    53e2:	e8 0c 0d 00 00       	call   60f3 <printf>
+    53e7:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    53ea:	83 ec 0c             	sub    $0xc,%esp
+    53ed:	ff 75 d4             	push   -0x2c(%ebp)
+    53f0:	e8 32 0b 00 00       	call   5f27 <kill>
+    53f5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    53f8:	e8 fa 0a 00 00       	call   5ef7 <exit>
+    }
+    wait();
+    53fd:	e8 fd 0a 00 00       	call   5eff <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    5402:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    5409:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    5410:	76 81                	jbe    5393 <sbrktest+0x2e2>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    5412:	83 ec 0c             	sub    $0xc,%esp
+    5415:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    5418:	50                   	push   %eax
+    5419:	e8 e9 0a 00 00       	call   5f07 <pipe>
+    541e:	83 c4 10             	add    $0x10,%esp
+    5421:	85 c0                	test   %eax,%eax
+    5423:	74 17                	je     543c <sbrktest+0x38b>
+    printf(1, "pipe() failed\n");
+    5425:	83 ec 08             	sub    $0x8,%esp
+    5428:	68 1e 69 00 00       	push   $0x691e
+    542d:	6a 01                	push   $0x1
+    542f:	e8 bf 0c 00 00       	call   60f3 <printf>
+    5434:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5437:	e8 bb 0a 00 00       	call   5ef7 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    543c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    5443:	e9 86 00 00 00       	jmp    54ce <sbrktest+0x41d>
+    if((pids[i] = fork()) == 0){
+    5448:	e8 a2 0a 00 00       	call   5eef <fork>
+    544d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    5450:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    5454:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5457:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    545b:	85 c0                	test   %eax,%eax
+    545d:	75 4a                	jne    54a9 <sbrktest+0x3f8>
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    545f:	83 ec 0c             	sub    $0xc,%esp
+    5462:	6a 00                	push   $0x0
+    5464:	e8 16 0b 00 00       	call   5f7f <sbrk>
+    5469:	83 c4 10             	add    $0x10,%esp
+    546c:	89 c2                	mov    %eax,%edx
+    546e:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    5473:	29 d0                	sub    %edx,%eax
+    5475:	83 ec 0c             	sub    $0xc,%esp
+    5478:	50                   	push   %eax
+    5479:	e8 01 0b 00 00       	call   5f7f <sbrk>
+    547e:	83 c4 10             	add    $0x10,%esp
+      write(fds[1], "x", 1);
+    5481:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    5484:	83 ec 04             	sub    $0x4,%esp
+    5487:	6a 01                	push   $0x1
+    5489:	68 bb 69 00 00       	push   $0x69bb
+    548e:	50                   	push   %eax
+    548f:	e8 83 0a 00 00       	call   5f17 <write>
+    5494:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    5497:	83 ec 0c             	sub    $0xc,%esp
+    549a:	68 e8 03 00 00       	push   $0x3e8
+    549f:	e8 e3 0a 00 00       	call   5f87 <sleep>
+    54a4:	83 c4 10             	add    $0x10,%esp
+    54a7:	eb ee                	jmp    5497 <sbrktest+0x3e6>
+    }
+    if(pids[i] != -1)
+    54a9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    54ac:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    54b0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    54b3:	74 15                	je     54ca <sbrktest+0x419>
+      read(fds[0], &scratch, 1);
+    54b5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    54b8:	83 ec 04             	sub    $0x4,%esp
+    54bb:	6a 01                	push   $0x1
+    54bd:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    54c0:	52                   	push   %edx
+    54c1:	50                   	push   %eax
+    54c2:	e8 48 0a 00 00       	call   5f0f <read>
+    54c7:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    54ca:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    54ce:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    54d1:	83 f8 09             	cmp    $0x9,%eax
+    54d4:	0f 86 6e ff ff ff    	jbe    5448 <sbrktest+0x397>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    54da:	83 ec 0c             	sub    $0xc,%esp
+    54dd:	68 00 10 00 00       	push   $0x1000
+    54e2:	e8 98 0a 00 00       	call   5f7f <sbrk>
+    54e7:	83 c4 10             	add    $0x10,%esp
+    54ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    54ed:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    54f4:	eb 2b                	jmp    5521 <sbrktest+0x470>
+    if(pids[i] == -1)
+    54f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    54f9:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    54fd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5500:	74 1a                	je     551c <sbrktest+0x46b>
+      continue;
+    kill(pids[i]);
+    5502:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5505:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    5509:	83 ec 0c             	sub    $0xc,%esp
+    550c:	50                   	push   %eax
+    550d:	e8 15 0a 00 00       	call   5f27 <kill>
+    5512:	83 c4 10             	add    $0x10,%esp
+    wait();
+    5515:	e8 e5 09 00 00       	call   5eff <wait>
+    551a:	eb 01                	jmp    551d <sbrktest+0x46c>
+      continue;
+    551c:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    551d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    5521:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5524:	83 f8 09             	cmp    $0x9,%eax
+    5527:	76 cd                	jbe    54f6 <sbrktest+0x445>
+  }
+  if(c == (char*)0xffffffff){
+    5529:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    552d:	75 1b                	jne    554a <sbrktest+0x499>
+    printf(stdout, "failed sbrk leaked memory\n");
+    552f:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    5534:	83 ec 08             	sub    $0x8,%esp
+    5537:	68 ce 83 00 00       	push   $0x83ce
+    553c:	50                   	push   %eax
+    553d:	e8 b1 0b 00 00       	call   60f3 <printf>
+    5542:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5545:	e8 ad 09 00 00       	call   5ef7 <exit>
+  }
+
+  if(sbrk(0) > oldbrk)
+    554a:	83 ec 0c             	sub    $0xc,%esp
+    554d:	6a 00                	push   $0x0
+    554f:	e8 2b 0a 00 00       	call   5f7f <sbrk>
+    5554:	83 c4 10             	add    $0x10,%esp
+    5557:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    555a:	73 1e                	jae    557a <sbrktest+0x4c9>
+    sbrk(-(sbrk(0) - oldbrk));
+    555c:	83 ec 0c             	sub    $0xc,%esp
+    555f:	6a 00                	push   $0x0
+    5561:	e8 19 0a 00 00       	call   5f7f <sbrk>
+    5566:	83 c4 10             	add    $0x10,%esp
+    5569:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    556c:	29 c2                	sub    %eax,%edx
+    556e:	83 ec 0c             	sub    $0xc,%esp
+    5571:	52                   	push   %edx
+    5572:	e8 08 0a 00 00       	call   5f7f <sbrk>
+    5577:	83 c4 10             	add    $0x10,%esp
+
+  printf(stdout, "sbrk test OK\n");
+    557a:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    557f:	83 ec 08             	sub    $0x8,%esp
+    5582:	68 e9 83 00 00       	push   $0x83e9
+    5587:	50                   	push   %eax
+    5588:	e8 66 0b 00 00       	call   60f3 <printf>
+    558d:	83 c4 10             	add    $0x10,%esp
+}
+    5590:	90                   	nop
+    5591:	c9                   	leave
+    5592:	c3                   	ret
+
+00005593 <validateint>:
+
+void
+validateint(int *p)
+{
+    5593:	55                   	push   %ebp
+    5594:	89 e5                	mov    %esp,%ebp
+    5596:	53                   	push   %ebx
+    5597:	83 ec 10             	sub    $0x10,%esp
+  int res;
+  asm("mov %%esp, %%ebx\n\t"
+    559a:	b8 0d 00 00 00       	mov    $0xd,%eax
+    559f:	8b 55 08             	mov    0x8(%ebp),%edx
+    55a2:	89 d1                	mov    %edx,%ecx
+    55a4:	89 e3                	mov    %esp,%ebx
+    55a6:	89 cc                	mov    %ecx,%esp
+    55a8:	cd 40                	int    $0x40
+    55aa:	89 dc                	mov    %ebx,%esp
+    55ac:	89 45 f8             	mov    %eax,-0x8(%ebp)
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    55af:	90                   	nop
+    55b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    55b3:	c9                   	leave
+    55b4:	c3                   	ret
+
+000055b5 <validatetest>:
+
+void
+validatetest(void)
+{
+    55b5:	55                   	push   %ebp
+    55b6:	89 e5                	mov    %esp,%ebp
+    55b8:	83 ec 18             	sub    $0x18,%esp
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    55bb:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    55c0:	83 ec 08             	sub    $0x8,%esp
+    55c3:	68 f7 83 00 00       	push   $0x83f7
+    55c8:	50                   	push   %eax
+    55c9:	e8 25 0b 00 00       	call   60f3 <printf>
+    55ce:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+    55d1:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    55d8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    55df:	e9 8a 00 00 00       	jmp    566e <validatetest+0xb9>
+    if((pid = fork()) == 0){
+    55e4:	e8 06 09 00 00       	call   5eef <fork>
+    55e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    55ec:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    55f0:	75 14                	jne    5606 <validatetest+0x51>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+    55f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    55f5:	83 ec 0c             	sub    $0xc,%esp
+    55f8:	50                   	push   %eax
+    55f9:	e8 95 ff ff ff       	call   5593 <validateint>
+    55fe:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5601:	e8 f1 08 00 00       	call   5ef7 <exit>
+    }
+    sleep(0);
+    5606:	83 ec 0c             	sub    $0xc,%esp
+    5609:	6a 00                	push   $0x0
+    560b:	e8 77 09 00 00       	call   5f87 <sleep>
+    5610:	83 c4 10             	add    $0x10,%esp
+    sleep(0);
+    5613:	83 ec 0c             	sub    $0xc,%esp
+    5616:	6a 00                	push   $0x0
+    5618:	e8 6a 09 00 00       	call   5f87 <sleep>
+    561d:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+    5620:	83 ec 0c             	sub    $0xc,%esp
+    5623:	ff 75 ec             	push   -0x14(%ebp)
+    5626:	e8 fc 08 00 00       	call   5f27 <kill>
+    562b:	83 c4 10             	add    $0x10,%esp
+    wait();
+    562e:	e8 cc 08 00 00       	call   5eff <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    5633:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5636:	83 ec 08             	sub    $0x8,%esp
+    5639:	50                   	push   %eax
+    563a:	68 06 84 00 00       	push   $0x8406
+    563f:	e8 13 09 00 00       	call   5f57 <link>
+    5644:	83 c4 10             	add    $0x10,%esp
+    5647:	83 f8 ff             	cmp    $0xffffffff,%eax
+    564a:	74 1b                	je     5667 <validatetest+0xb2>
+      printf(stdout, "link should not succeed\n");
+    564c:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    5651:	83 ec 08             	sub    $0x8,%esp
+    5654:	68 11 84 00 00       	push   $0x8411
+    5659:	50                   	push   %eax
+    565a:	e8 94 0a 00 00       	call   60f3 <printf>
+    565f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    5662:	e8 90 08 00 00       	call   5ef7 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    5667:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    566e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5671:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    5674:	0f 83 6a ff ff ff    	jae    55e4 <validatetest+0x2f>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    567a:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    567f:	83 ec 08             	sub    $0x8,%esp
+    5682:	68 2a 84 00 00       	push   $0x842a
+    5687:	50                   	push   %eax
+    5688:	e8 66 0a 00 00       	call   60f3 <printf>
+    568d:	83 c4 10             	add    $0x10,%esp
+}
+    5690:	90                   	nop
+    5691:	c9                   	leave
+    5692:	c3                   	ret
+
+00005693 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    5693:	55                   	push   %ebp
+    5694:	89 e5                	mov    %esp,%ebp
+    5696:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    5699:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    569e:	83 ec 08             	sub    $0x8,%esp
+    56a1:	68 37 84 00 00       	push   $0x8437
+    56a6:	50                   	push   %eax
+    56a7:	e8 47 0a 00 00       	call   60f3 <printf>
+    56ac:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    56af:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    56b6:	eb 2e                	jmp    56e6 <bsstest+0x53>
+    if(uninit[i] != '\0'){
+    56b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    56bb:	05 00 af 00 00       	add    $0xaf00,%eax
+    56c0:	0f b6 00             	movzbl (%eax),%eax
+    56c3:	84 c0                	test   %al,%al
+    56c5:	74 1b                	je     56e2 <bsstest+0x4f>
+      printf(stdout, "bss test failed\n");
+    56c7:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    56cc:	83 ec 08             	sub    $0x8,%esp
+    56cf:	68 41 84 00 00       	push   $0x8441
+    56d4:	50                   	push   %eax
+    56d5:	e8 19 0a 00 00       	call   60f3 <printf>
+    56da:	83 c4 10             	add    $0x10,%esp
+      exit();
+    56dd:	e8 15 08 00 00       	call   5ef7 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    56e2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    56e6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    56e9:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    56ee:	76 c8                	jbe    56b8 <bsstest+0x25>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    56f0:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    56f5:	83 ec 08             	sub    $0x8,%esp
+    56f8:	68 52 84 00 00       	push   $0x8452
+    56fd:	50                   	push   %eax
+    56fe:	e8 f0 09 00 00       	call   60f3 <printf>
+    5703:	83 c4 10             	add    $0x10,%esp
+}
+    5706:	90                   	nop
+    5707:	c9                   	leave
+    5708:	c3                   	ret
+
+00005709 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    5709:	55                   	push   %ebp
+    570a:	89 e5                	mov    %esp,%ebp
+    570c:	83 ec 18             	sub    $0x18,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    570f:	83 ec 0c             	sub    $0xc,%esp
+    5712:	68 5f 84 00 00       	push   $0x845f
+    5717:	e8 2b 08 00 00       	call   5f47 <unlink>
+    571c:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    571f:	e8 cb 07 00 00       	call   5eef <fork>
+    5724:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    5727:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    572b:	0f 85 97 00 00 00    	jne    57c8 <bigargtest+0xbf>
+    static char *args[MAXARG];
+    int i;
+    for(i = 0; i < MAXARG-1; i++)
+    5731:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5738:	eb 12                	jmp    574c <bigargtest+0x43>
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    573a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    573d:	c7 04 85 20 d6 00 00 	movl   $0x846c,0xd620(,%eax,4)
+    5744:	6c 84 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    5748:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    574c:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    5750:	7e e8                	jle    573a <bigargtest+0x31>
+    args[MAXARG-1] = 0;
+    5752:	c7 05 9c d6 00 00 00 	movl   $0x0,0xd69c
+    5759:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    575c:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    5761:	83 ec 08             	sub    $0x8,%esp
+    5764:	68 49 85 00 00       	push   $0x8549
+    5769:	50                   	push   %eax
+    576a:	e8 84 09 00 00       	call   60f3 <printf>
+    576f:	83 c4 10             	add    $0x10,%esp
+    exec("echo", args);
+    5772:	83 ec 08             	sub    $0x8,%esp
+    5775:	68 20 d6 00 00       	push   $0xd620
+    577a:	68 ac 64 00 00       	push   $0x64ac
+    577f:	e8 ab 07 00 00       	call   5f2f <exec>
+    5784:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "bigarg test ok\n");
+    5787:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    578c:	83 ec 08             	sub    $0x8,%esp
+    578f:	68 56 85 00 00       	push   $0x8556
+    5794:	50                   	push   %eax
+    5795:	e8 59 09 00 00       	call   60f3 <printf>
+    579a:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigarg-ok", O_CREATE);
+    579d:	83 ec 08             	sub    $0x8,%esp
+    57a0:	68 00 02 00 00       	push   $0x200
+    57a5:	68 5f 84 00 00       	push   $0x845f
+    57aa:	e8 88 07 00 00       	call   5f37 <open>
+    57af:	83 c4 10             	add    $0x10,%esp
+    57b2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    close(fd);
+    57b5:	83 ec 0c             	sub    $0xc,%esp
+    57b8:	ff 75 ec             	push   -0x14(%ebp)
+    57bb:	e8 5f 07 00 00       	call   5f1f <close>
+    57c0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    57c3:	e8 2f 07 00 00       	call   5ef7 <exit>
+  } else if(pid < 0){
+    57c8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    57cc:	79 1b                	jns    57e9 <bigargtest+0xe0>
+    printf(stdout, "bigargtest: fork failed\n");
+    57ce:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    57d3:	83 ec 08             	sub    $0x8,%esp
+    57d6:	68 66 85 00 00       	push   $0x8566
+    57db:	50                   	push   %eax
+    57dc:	e8 12 09 00 00       	call   60f3 <printf>
+    57e1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    57e4:	e8 0e 07 00 00       	call   5ef7 <exit>
+  }
+  wait();
+    57e9:	e8 11 07 00 00       	call   5eff <wait>
+  fd = open("bigarg-ok", 0);
+    57ee:	83 ec 08             	sub    $0x8,%esp
+    57f1:	6a 00                	push   $0x0
+    57f3:	68 5f 84 00 00       	push   $0x845f
+    57f8:	e8 3a 07 00 00       	call   5f37 <open>
+    57fd:	83 c4 10             	add    $0x10,%esp
+    5800:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    5803:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    5807:	79 1b                	jns    5824 <bigargtest+0x11b>
+    printf(stdout, "bigarg test failed!\n");
+    5809:	a1 c0 8e 00 00       	mov    0x8ec0,%eax
+    580e:	83 ec 08             	sub    $0x8,%esp
+    5811:	68 7f 85 00 00       	push   $0x857f
+    5816:	50                   	push   %eax
+    5817:	e8 d7 08 00 00       	call   60f3 <printf>
+    581c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    581f:	e8 d3 06 00 00       	call   5ef7 <exit>
+  }
+  close(fd);
+    5824:	83 ec 0c             	sub    $0xc,%esp
+    5827:	ff 75 ec             	push   -0x14(%ebp)
+    582a:	e8 f0 06 00 00       	call   5f1f <close>
+    582f:	83 c4 10             	add    $0x10,%esp
+  unlink("bigarg-ok");
+    5832:	83 ec 0c             	sub    $0xc,%esp
+    5835:	68 5f 84 00 00       	push   $0x845f
+    583a:	e8 08 07 00 00       	call   5f47 <unlink>
+    583f:	83 c4 10             	add    $0x10,%esp
+}
+    5842:	90                   	nop
+    5843:	c9                   	leave
+    5844:	c3                   	ret
+
+00005845 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    5845:	55                   	push   %ebp
+    5846:	89 e5                	mov    %esp,%ebp
+    5848:	53                   	push   %ebx
+    5849:	83 ec 64             	sub    $0x64,%esp
+  int nfiles;
+  int fsblocks = 0;
+    584c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+  printf(1, "fsfull test\n");
+    5853:	83 ec 08             	sub    $0x8,%esp
+    5856:	68 94 85 00 00       	push   $0x8594
+    585b:	6a 01                	push   $0x1
+    585d:	e8 91 08 00 00       	call   60f3 <printf>
+    5862:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    5865:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    char name[64];
+    name[0] = 'f';
+    586c:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    5870:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    5873:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    5878:	89 c8                	mov    %ecx,%eax
+    587a:	f7 ea                	imul   %edx
+    587c:	c1 fa 06             	sar    $0x6,%edx
+    587f:	89 c8                	mov    %ecx,%eax
+    5881:	c1 f8 1f             	sar    $0x1f,%eax
+    5884:	29 c2                	sub    %eax,%edx
+    5886:	89 d0                	mov    %edx,%eax
+    5888:	83 c0 30             	add    $0x30,%eax
+    588b:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    588e:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    5891:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    5896:	89 d8                	mov    %ebx,%eax
+    5898:	f7 ea                	imul   %edx
+    589a:	c1 fa 06             	sar    $0x6,%edx
+    589d:	89 d8                	mov    %ebx,%eax
+    589f:	c1 f8 1f             	sar    $0x1f,%eax
+    58a2:	89 d1                	mov    %edx,%ecx
+    58a4:	29 c1                	sub    %eax,%ecx
+    58a6:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    58ac:	29 c3                	sub    %eax,%ebx
+    58ae:	89 d9                	mov    %ebx,%ecx
+    58b0:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    58b5:	89 c8                	mov    %ecx,%eax
+    58b7:	f7 ea                	imul   %edx
+    58b9:	c1 fa 05             	sar    $0x5,%edx
+    58bc:	89 c8                	mov    %ecx,%eax
+    58be:	c1 f8 1f             	sar    $0x1f,%eax
+    58c1:	29 c2                	sub    %eax,%edx
+    58c3:	89 d0                	mov    %edx,%eax
+    58c5:	83 c0 30             	add    $0x30,%eax
+    58c8:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    58cb:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    58ce:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    58d3:	89 d8                	mov    %ebx,%eax
+    58d5:	f7 ea                	imul   %edx
+    58d7:	c1 fa 05             	sar    $0x5,%edx
+    58da:	89 d8                	mov    %ebx,%eax
+    58dc:	c1 f8 1f             	sar    $0x1f,%eax
+    58df:	89 d1                	mov    %edx,%ecx
+    58e1:	29 c1                	sub    %eax,%ecx
+    58e3:	6b c1 64             	imul   $0x64,%ecx,%eax
+    58e6:	29 c3                	sub    %eax,%ebx
+    58e8:	89 d9                	mov    %ebx,%ecx
+    58ea:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    58ef:	89 c8                	mov    %ecx,%eax
+    58f1:	f7 ea                	imul   %edx
+    58f3:	c1 fa 02             	sar    $0x2,%edx
+    58f6:	89 c8                	mov    %ecx,%eax
+    58f8:	c1 f8 1f             	sar    $0x1f,%eax
+    58fb:	29 c2                	sub    %eax,%edx
+    58fd:	89 d0                	mov    %edx,%eax
+    58ff:	83 c0 30             	add    $0x30,%eax
+    5902:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    5905:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    5908:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    590d:	89 c8                	mov    %ecx,%eax
+    590f:	f7 ea                	imul   %edx
+    5911:	c1 fa 02             	sar    $0x2,%edx
+    5914:	89 c8                	mov    %ecx,%eax
+    5916:	c1 f8 1f             	sar    $0x1f,%eax
+    5919:	29 c2                	sub    %eax,%edx
+    591b:	89 d0                	mov    %edx,%eax
+    591d:	c1 e0 02             	shl    $0x2,%eax
+    5920:	01 d0                	add    %edx,%eax
+    5922:	01 c0                	add    %eax,%eax
+    5924:	29 c1                	sub    %eax,%ecx
+    5926:	89 ca                	mov    %ecx,%edx
+    5928:	89 d0                	mov    %edx,%eax
+    592a:	83 c0 30             	add    $0x30,%eax
+    592d:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    5930:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    printf(1, "writing %s\n", name);
+    5934:	83 ec 04             	sub    $0x4,%esp
+    5937:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    593a:	50                   	push   %eax
+    593b:	68 a1 85 00 00       	push   $0x85a1
+    5940:	6a 01                	push   $0x1
+    5942:	e8 ac 07 00 00       	call   60f3 <printf>
+    5947:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    594a:	83 ec 08             	sub    $0x8,%esp
+    594d:	68 02 02 00 00       	push   $0x202
+    5952:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    5955:	50                   	push   %eax
+    5956:	e8 dc 05 00 00       	call   5f37 <open>
+    595b:	83 c4 10             	add    $0x10,%esp
+    595e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    5961:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    5965:	79 18                	jns    597f <fsfull+0x13a>
+      printf(1, "open %s failed\n", name);
+    5967:	83 ec 04             	sub    $0x4,%esp
+    596a:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    596d:	50                   	push   %eax
+    596e:	68 ad 85 00 00       	push   $0x85ad
+    5973:	6a 01                	push   $0x1
+    5975:	e8 79 07 00 00       	call   60f3 <printf>
+    597a:	83 c4 10             	add    $0x10,%esp
+      break;
+    597d:	eb 6b                	jmp    59ea <fsfull+0x1a5>
+    }
+    int total = 0;
+    597f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while(1){
+      int cc = write(fd, buf, 512);
+    5986:	83 ec 04             	sub    $0x4,%esp
+    5989:	68 00 02 00 00       	push   $0x200
+    598e:	68 e0 8e 00 00       	push   $0x8ee0
+    5993:	ff 75 e8             	push   -0x18(%ebp)
+    5996:	e8 7c 05 00 00       	call   5f17 <write>
+    599b:	83 c4 10             	add    $0x10,%esp
+    599e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(cc < 512)
+    59a1:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    59a8:	7e 0c                	jle    59b6 <fsfull+0x171>
+        break;
+      total += cc;
+    59aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    59ad:	01 45 ec             	add    %eax,-0x14(%ebp)
+      fsblocks++;
+    59b0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(1){
+    59b4:	eb d0                	jmp    5986 <fsfull+0x141>
+        break;
+    59b6:	90                   	nop
+    }
+    printf(1, "wrote %d bytes\n", total);
+    59b7:	83 ec 04             	sub    $0x4,%esp
+    59ba:	ff 75 ec             	push   -0x14(%ebp)
+    59bd:	68 bd 85 00 00       	push   $0x85bd
+    59c2:	6a 01                	push   $0x1
+    59c4:	e8 2a 07 00 00       	call   60f3 <printf>
+    59c9:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    59cc:	83 ec 0c             	sub    $0xc,%esp
+    59cf:	ff 75 e8             	push   -0x18(%ebp)
+    59d2:	e8 48 05 00 00       	call   5f1f <close>
+    59d7:	83 c4 10             	add    $0x10,%esp
+    if(total == 0)
+    59da:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    59de:	74 09                	je     59e9 <fsfull+0x1a4>
+  for(nfiles = 0; ; nfiles++){
+    59e0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    59e4:	e9 83 fe ff ff       	jmp    586c <fsfull+0x27>
+      break;
+    59e9:	90                   	nop
+  }
+
+  while(nfiles >= 0){
+    59ea:	e9 db 00 00 00       	jmp    5aca <fsfull+0x285>
+    char name[64];
+    name[0] = 'f';
+    59ef:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    59f3:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    59f6:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    59fb:	89 c8                	mov    %ecx,%eax
+    59fd:	f7 ea                	imul   %edx
+    59ff:	c1 fa 06             	sar    $0x6,%edx
+    5a02:	89 c8                	mov    %ecx,%eax
+    5a04:	c1 f8 1f             	sar    $0x1f,%eax
+    5a07:	29 c2                	sub    %eax,%edx
+    5a09:	89 d0                	mov    %edx,%eax
+    5a0b:	83 c0 30             	add    $0x30,%eax
+    5a0e:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    5a11:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    5a14:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    5a19:	89 d8                	mov    %ebx,%eax
+    5a1b:	f7 ea                	imul   %edx
+    5a1d:	c1 fa 06             	sar    $0x6,%edx
+    5a20:	89 d8                	mov    %ebx,%eax
+    5a22:	c1 f8 1f             	sar    $0x1f,%eax
+    5a25:	89 d1                	mov    %edx,%ecx
+    5a27:	29 c1                	sub    %eax,%ecx
+    5a29:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    5a2f:	29 c3                	sub    %eax,%ebx
+    5a31:	89 d9                	mov    %ebx,%ecx
+    5a33:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5a38:	89 c8                	mov    %ecx,%eax
+    5a3a:	f7 ea                	imul   %edx
+    5a3c:	c1 fa 05             	sar    $0x5,%edx
+    5a3f:	89 c8                	mov    %ecx,%eax
+    5a41:	c1 f8 1f             	sar    $0x1f,%eax
+    5a44:	29 c2                	sub    %eax,%edx
+    5a46:	89 d0                	mov    %edx,%eax
+    5a48:	83 c0 30             	add    $0x30,%eax
+    5a4b:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    5a4e:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    5a51:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5a56:	89 d8                	mov    %ebx,%eax
+    5a58:	f7 ea                	imul   %edx
+    5a5a:	c1 fa 05             	sar    $0x5,%edx
+    5a5d:	89 d8                	mov    %ebx,%eax
+    5a5f:	c1 f8 1f             	sar    $0x1f,%eax
+    5a62:	89 d1                	mov    %edx,%ecx
+    5a64:	29 c1                	sub    %eax,%ecx
+    5a66:	6b c1 64             	imul   $0x64,%ecx,%eax
+    5a69:	29 c3                	sub    %eax,%ebx
+    5a6b:	89 d9                	mov    %ebx,%ecx
+    5a6d:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    5a72:	89 c8                	mov    %ecx,%eax
+    5a74:	f7 ea                	imul   %edx
+    5a76:	c1 fa 02             	sar    $0x2,%edx
+    5a79:	89 c8                	mov    %ecx,%eax
+    5a7b:	c1 f8 1f             	sar    $0x1f,%eax
+    5a7e:	29 c2                	sub    %eax,%edx
+    5a80:	89 d0                	mov    %edx,%eax
+    5a82:	83 c0 30             	add    $0x30,%eax
+    5a85:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    5a88:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    5a8b:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    5a90:	89 c8                	mov    %ecx,%eax
+    5a92:	f7 ea                	imul   %edx
+    5a94:	c1 fa 02             	sar    $0x2,%edx
+    5a97:	89 c8                	mov    %ecx,%eax
+    5a99:	c1 f8 1f             	sar    $0x1f,%eax
+    5a9c:	29 c2                	sub    %eax,%edx
+    5a9e:	89 d0                	mov    %edx,%eax
+    5aa0:	c1 e0 02             	shl    $0x2,%eax
+    5aa3:	01 d0                	add    %edx,%eax
+    5aa5:	01 c0                	add    %eax,%eax
+    5aa7:	29 c1                	sub    %eax,%ecx
+    5aa9:	89 ca                	mov    %ecx,%edx
+    5aab:	89 d0                	mov    %edx,%eax
+    5aad:	83 c0 30             	add    $0x30,%eax
+    5ab0:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    5ab3:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    unlink(name);
+    5ab7:	83 ec 0c             	sub    $0xc,%esp
+    5aba:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    5abd:	50                   	push   %eax
+    5abe:	e8 84 04 00 00       	call   5f47 <unlink>
+    5ac3:	83 c4 10             	add    $0x10,%esp
+    nfiles--;
+    5ac6:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  while(nfiles >= 0){
+    5aca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5ace:	0f 89 1b ff ff ff    	jns    59ef <fsfull+0x1aa>
+  }
+
+  printf(1, "fsfull test finished\n");
+    5ad4:	83 ec 08             	sub    $0x8,%esp
+    5ad7:	68 cd 85 00 00       	push   $0x85cd
+    5adc:	6a 01                	push   $0x1
+    5ade:	e8 10 06 00 00       	call   60f3 <printf>
+    5ae3:	83 c4 10             	add    $0x10,%esp
+}
+    5ae6:	90                   	nop
+    5ae7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    5aea:	c9                   	leave
+    5aeb:	c3                   	ret
+
+00005aec <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    5aec:	55                   	push   %ebp
+    5aed:	89 e5                	mov    %esp,%ebp
+  randstate = randstate * 1664525 + 1013904223;
+    5aef:	a1 c4 8e 00 00       	mov    0x8ec4,%eax
+    5af4:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    5afa:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    5aff:	a3 c4 8e 00 00       	mov    %eax,0x8ec4
+  return randstate;
+    5b04:	a1 c4 8e 00 00       	mov    0x8ec4,%eax
+}
+    5b09:	5d                   	pop    %ebp
+    5b0a:	c3                   	ret
+
+00005b0b <main>:
+
+int
+main(int argc, char *argv[])
+{
+    5b0b:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    5b0f:	83 e4 f0             	and    $0xfffffff0,%esp
+    5b12:	ff 71 fc             	push   -0x4(%ecx)
+    5b15:	55                   	push   %ebp
+    5b16:	89 e5                	mov    %esp,%ebp
+    5b18:	51                   	push   %ecx
+    5b19:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "usertests starting\n");
+    5b1c:	83 ec 08             	sub    $0x8,%esp
+    5b1f:	68 e3 85 00 00       	push   $0x85e3
+    5b24:	6a 01                	push   $0x1
+    5b26:	e8 c8 05 00 00       	call   60f3 <printf>
+    5b2b:	83 c4 10             	add    $0x10,%esp
+
+  if(open("usertests.ran", 0) >= 0){
+    5b2e:	83 ec 08             	sub    $0x8,%esp
+    5b31:	6a 00                	push   $0x0
+    5b33:	68 f7 85 00 00       	push   $0x85f7
+    5b38:	e8 fa 03 00 00       	call   5f37 <open>
+    5b3d:	83 c4 10             	add    $0x10,%esp
+    5b40:	85 c0                	test   %eax,%eax
+    5b42:	78 17                	js     5b5b <main+0x50>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    5b44:	83 ec 08             	sub    $0x8,%esp
+    5b47:	68 08 86 00 00       	push   $0x8608
+    5b4c:	6a 01                	push   $0x1
+    5b4e:	e8 a0 05 00 00       	call   60f3 <printf>
+    5b53:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5b56:	e8 9c 03 00 00       	call   5ef7 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    5b5b:	83 ec 08             	sub    $0x8,%esp
+    5b5e:	68 00 02 00 00       	push   $0x200
+    5b63:	68 f7 85 00 00       	push   $0x85f7
+    5b68:	e8 ca 03 00 00       	call   5f37 <open>
+    5b6d:	83 c4 10             	add    $0x10,%esp
+    5b70:	83 ec 0c             	sub    $0xc,%esp
+    5b73:	50                   	push   %eax
+    5b74:	e8 a6 03 00 00       	call   5f1f <close>
+    5b79:	83 c4 10             	add    $0x10,%esp
+
+  createdelete();
+    5b7c:	e8 d7 d6 ff ff       	call   3258 <createdelete>
+  linkunlink();
+    5b81:	e8 fc e0 ff ff       	call   3c82 <linkunlink>
+  concreate();
+    5b86:	e8 43 dd ff ff       	call   38ce <concreate>
+  fourfiles();
+    5b8b:	e8 77 d4 ff ff       	call   3007 <fourfiles>
+  sharedfd();
+    5b90:	e8 8f d2 ff ff       	call   2e24 <sharedfd>
+
+  bigargtest();
+    5b95:	e8 6f fb ff ff       	call   5709 <bigargtest>
+  bigwrite();
+    5b9a:	e8 df ea ff ff       	call   467e <bigwrite>
+  bigargtest();
+    5b9f:	e8 65 fb ff ff       	call   5709 <bigargtest>
+  bsstest();
+    5ba4:	e8 ea fa ff ff       	call   5693 <bsstest>
+  sbrktest();
+    5ba9:	e8 03 f5 ff ff       	call   50b1 <sbrktest>
+  validatetest();
+    5bae:	e8 02 fa ff ff       	call   55b5 <validatetest>
+
+  opentest();
+    5bb3:	e8 47 a7 ff ff       	call   2ff <opentest>
+  writetest();
+    5bb8:	e8 f1 a7 ff ff       	call   3ae <writetest>
+  writetest1();
+    5bbd:	e8 fc a9 ff ff       	call   5be <writetest1>
+  createtest();
+    5bc2:	e8 f3 ab ff ff       	call   7ba <createtest>
+
+  openiputtest();
+    5bc7:	e8 24 a6 ff ff       	call   1f0 <openiputtest>
+  exitiputtest();
+    5bcc:	e8 20 a5 ff ff       	call   f1 <exitiputtest>
+  iputtest();
+    5bd1:	e8 2a a4 ff ff       	call   0 <iputtest>
+
+  mem();
+    5bd6:	e8 58 d1 ff ff       	call   2d33 <mem>
+  pipe1();
+    5bdb:	e8 e1 ad ff ff       	call   9c1 <pipe1>
+  polltest();
+    5be0:	e8 c5 af ff ff       	call   baa <polltest>
+  pollfulltest();
+    5be5:	e8 47 b2 ff ff       	call   e31 <pollfulltest>
+  nonblocktest();
+    5bea:	e8 fc b3 ff ff       	call   feb <nonblocktest>
+  preadtest();
+    5bef:	e8 e5 b5 ff ff       	call   11d9 <preadtest>
+  sparsetest();
+    5bf4:	e8 18 b8 ff ff       	call   1411 <sparsetest>
+  copytest();
+    5bf9:	e8 d4 ba ff ff       	call   16d2 <copytest>
+  defragtest();
+    5bfe:	e8 cf be ff ff       	call   1ad2 <defragtest>
+  compresstest();
+    5c03:	e8 85 c1 ff ff       	call   1d8d <compresstest>
+  fdtabletest();
+    5c08:	e8 3f c5 ff ff       	call   214c <fdtabletest>
+  attest();
+    5c0d:	e8 58 c7 ff ff       	call   236a <attest>
+  getdentstest();
+    5c12:	e8 78 c9 ff ff       	call   258f <getdentstest>
+  preempt();
+    5c17:	e8 2b ce ff ff       	call   2a47 <preempt>
+  exitwait();
+    5c1c:	e8 8c cf ff ff       	call   2bad <exitwait>
+  exitstatus();
+    5c21:	e8 ff cf ff ff       	call   2c25 <exitstatus>
+
+  rmdot();
+    5c26:	e8 c5 ee ff ff       	call   4af0 <rmdot>
+  fourteen();
+    5c2b:	e8 64 ed ff ff       	call   4994 <fourteen>
+  bigfile();
+    5c30:	e8 47 eb ff ff       	call   477c <bigfile>
+  subdir();
+    5c35:	e8 00 e3 ff ff       	call   3f3a <subdir>
+  linktest();
+    5c3a:	e8 4d da ff ff       	call   368c <linktest>
+  unlinkread();
+    5c3f:	e8 86 d8 ff ff       	call   34ca <unlinkread>
+  dirfile();
+    5c44:	e8 2c f0 ff ff       	call   4c75 <dirfile>
+  iref();
+    5c49:	e8 5f f2 ff ff       	call   4ead <iref>
+  forktest();
+    5c4e:	e8 94 f3 ff ff       	call   4fe7 <forktest>
+  bigdir(); // slow
+    5c53:	e8 61 e1 ff ff       	call   3db9 <bigdir>
+  exectest();
+    5c58:	e8 11 ad ff ff       	call   96e <exectest>
+
+  exit();
+    5c5d:	e8 95 02 00 00       	call   5ef7 <exit>
+
+00005c62 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+    5c62:	55                   	push   %ebp
+    5c63:	89 e5                	mov    %esp,%ebp
+    5c65:	57                   	push   %edi
+    5c66:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+    5c67:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    5c6a:	8b 55 10             	mov    0x10(%ebp),%edx
+    5c6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5c70:	89 cb                	mov    %ecx,%ebx
+    5c72:	89 df                	mov    %ebx,%edi
+    5c74:	89 d1                	mov    %edx,%ecx
+    5c76:	fc                   	cld
+    5c77:	f3 aa                	rep stos %al,%es:(%edi)
+    5c79:	89 ca                	mov    %ecx,%edx
+    5c7b:	89 fb                	mov    %edi,%ebx
+    5c7d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    5c80:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    5c83:	90                   	nop
+    5c84:	5b                   	pop    %ebx
+    5c85:	5f                   	pop    %edi
+    5c86:	5d                   	pop    %ebp
+    5c87:	c3                   	ret
+
+00005c88 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    5c88:	55                   	push   %ebp
+    5c89:	89 e5                	mov    %esp,%ebp
+    5c8b:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+    5c8e:	8b 45 08             	mov    0x8(%ebp),%eax
+    5c91:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    5c94:	90                   	nop
+    5c95:	8b 55 0c             	mov    0xc(%ebp),%edx
+    5c98:	8d 42 01             	lea    0x1(%edx),%eax
+    5c9b:	89 45 0c             	mov    %eax,0xc(%ebp)
+    5c9e:	8b 45 08             	mov    0x8(%ebp),%eax
+    5ca1:	8d 48 01             	lea    0x1(%eax),%ecx
+    5ca4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    5ca7:	0f b6 12             	movzbl (%edx),%edx
+    5caa:	88 10                	mov    %dl,(%eax)
+    5cac:	0f b6 00             	movzbl (%eax),%eax
+    5caf:	84 c0                	test   %al,%al
+    5cb1:	75 e2                	jne    5c95 <strcpy+0xd>
+    ;
+  return os;
+    5cb3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    5cb6:	c9                   	leave
+    5cb7:	c3                   	ret
+
+00005cb8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    5cb8:	55                   	push   %ebp
+    5cb9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    5cbb:	eb 08                	jmp    5cc5 <strcmp+0xd>
+    p++, q++;
+    5cbd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    5cc1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    5cc5:	8b 45 08             	mov    0x8(%ebp),%eax
+    5cc8:	0f b6 00             	movzbl (%eax),%eax
+    5ccb:	84 c0                	test   %al,%al
+    5ccd:	74 10                	je     5cdf <strcmp+0x27>
+    5ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+    5cd2:	0f b6 10             	movzbl (%eax),%edx
+    5cd5:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5cd8:	0f b6 00             	movzbl (%eax),%eax
+    5cdb:	38 c2                	cmp    %al,%dl
+    5cdd:	74 de                	je     5cbd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    5cdf:	8b 45 08             	mov    0x8(%ebp),%eax
+    5ce2:	0f b6 00             	movzbl (%eax),%eax
+    5ce5:	0f b6 d0             	movzbl %al,%edx
+    5ce8:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5ceb:	0f b6 00             	movzbl (%eax),%eax
+    5cee:	0f b6 c0             	movzbl %al,%eax
+    5cf1:	29 c2                	sub    %eax,%edx
+    5cf3:	89 d0                	mov    %edx,%eax
+}
+    5cf5:	5d                   	pop    %ebp
+    5cf6:	c3                   	ret
+
+00005cf7 <strlen>:
+
+uint
+strlen(char *s)
+{
+    5cf7:	55                   	push   %ebp
+    5cf8:	89 e5                	mov    %esp,%ebp
+    5cfa:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+    5cfd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    5d04:	eb 04                	jmp    5d0a <strlen+0x13>
+    5d06:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    5d0a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    5d0d:	8b 45 08             	mov    0x8(%ebp),%eax
+    5d10:	01 d0                	add    %edx,%eax
+    5d12:	0f b6 00             	movzbl (%eax),%eax
+    5d15:	84 c0                	test   %al,%al
+    5d17:	75 ed                	jne    5d06 <strlen+0xf>
+    ;
+  return n;
+    5d19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    5d1c:	c9                   	leave
+    5d1d:	c3                   	ret
+
+00005d1e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    5d1e:	55                   	push   %ebp
+    5d1f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    5d21:	8b 45 10             	mov    0x10(%ebp),%eax
+    5d24:	50                   	push   %eax
+    5d25:	ff 75 0c             	push   0xc(%ebp)
+    5d28:	ff 75 08             	push   0x8(%ebp)
+    5d2b:	e8 32 ff ff ff       	call   5c62 <stosb>
+    5d30:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    5d33:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    5d36:	c9                   	leave
+    5d37:	c3                   	ret
+
+00005d38 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    5d38:	55                   	push   %ebp
+    5d39:	89 e5                	mov    %esp,%ebp
+    5d3b:	83 ec 04             	sub    $0x4,%esp
+    5d3e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5d41:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    5d44:	eb 14                	jmp    5d5a <strchr+0x22>
+    if(*s == c)
+    5d46:	8b 45 08             	mov    0x8(%ebp),%eax
+    5d49:	0f b6 00             	movzbl (%eax),%eax
+    5d4c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    5d4f:	75 05                	jne    5d56 <strchr+0x1e>
+      return (char*)s;
+    5d51:	8b 45 08             	mov    0x8(%ebp),%eax
+    5d54:	eb 13                	jmp    5d69 <strchr+0x31>
+  for(; *s; s++)
+    5d56:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    5d5a:	8b 45 08             	mov    0x8(%ebp),%eax
+    5d5d:	0f b6 00             	movzbl (%eax),%eax
+    5d60:	84 c0                	test   %al,%al
+    5d62:	75 e2                	jne    5d46 <strchr+0xe>
+  return 0;
+    5d64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    5d69:	c9                   	leave
+    5d6a:	c3                   	ret
+
+00005d6b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    5d6b:	55                   	push   %ebp
+    5d6c:	89 e5                	mov    %esp,%ebp
+    5d6e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    5d71:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5d78:	eb 42                	jmp    5dbc <gets+0x51>
+    cc = read(0, &c, 1);
+    5d7a:	83 ec 04             	sub    $0x4,%esp
+    5d7d:	6a 01                	push   $0x1
+    5d7f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    5d82:	50                   	push   %eax
+    5d83:	6a 00                	push   $0x0
+    5d85:	e8 85 01 00 00       	call   5f0f <read>
+    5d8a:	83 c4 10             	add    $0x10,%esp
+    5d8d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    5d90:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5d94:	7e 33                	jle    5dc9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+    5d96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5d99:	8d 50 01             	lea    0x1(%eax),%edx
+    5d9c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    5d9f:	89 c2                	mov    %eax,%edx
+    5da1:	8b 45 08             	mov    0x8(%ebp),%eax
+    5da4:	01 c2                	add    %eax,%edx
+    5da6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    5daa:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    5dac:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    5db0:	3c 0a                	cmp    $0xa,%al
+    5db2:	74 16                	je     5dca <gets+0x5f>
+    5db4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    5db8:	3c 0d                	cmp    $0xd,%al
+    5dba:	74 0e                	je     5dca <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    5dbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5dbf:	83 c0 01             	add    $0x1,%eax
+    5dc2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    5dc5:	7f b3                	jg     5d7a <gets+0xf>
+    5dc7:	eb 01                	jmp    5dca <gets+0x5f>
+      break;
+    5dc9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    5dca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    5dcd:	8b 45 08             	mov    0x8(%ebp),%eax
+    5dd0:	01 d0                	add    %edx,%eax
+    5dd2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    5dd5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    5dd8:	c9                   	leave
+    5dd9:	c3                   	ret
+
+00005dda <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    5dda:	55                   	push   %ebp
+    5ddb:	89 e5                	mov    %esp,%ebp
+    5ddd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    5de0:	83 ec 08             	sub    $0x8,%esp
+    5de3:	6a 00                	push   $0x0
+    5de5:	ff 75 08             	push   0x8(%ebp)
+    5de8:	e8 4a 01 00 00       	call   5f37 <open>
+    5ded:	83 c4 10             	add    $0x10,%esp
+    5df0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    5df3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5df7:	79 07                	jns    5e00 <stat+0x26>
+    return -1;
+    5df9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    5dfe:	eb 25                	jmp    5e25 <stat+0x4b>
+  r = fstat(fd, st);
+    5e00:	83 ec 08             	sub    $0x8,%esp
+    5e03:	ff 75 0c             	push   0xc(%ebp)
+    5e06:	ff 75 f4             	push   -0xc(%ebp)
+    5e09:	e8 41 01 00 00       	call   5f4f <fstat>
+    5e0e:	83 c4 10             	add    $0x10,%esp
+    5e11:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    5e14:	83 ec 0c             	sub    $0xc,%esp
+    5e17:	ff 75 f4             	push   -0xc(%ebp)
+    5e1a:	e8 00 01 00 00       	call   5f1f <close>
+    5e1f:	83 c4 10             	add    $0x10,%esp
+  return r;
+    5e22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    5e25:	c9                   	leave
+    5e26:	c3                   	ret
+
+00005e27 <atoi>:
+
+int
+atoi(const char *s)
+{
+    5e27:	55                   	push   %ebp
+    5e28:	89 e5                	mov    %esp,%ebp
+    5e2a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    5e2d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    5e34:	eb 25                	jmp    5e5b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    5e36:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    5e39:	89 d0                	mov    %edx,%eax
+    5e3b:	c1 e0 02             	shl    $0x2,%eax
+    5e3e:	01 d0                	add    %edx,%eax
+    5e40:	01 c0                	add    %eax,%eax
+    5e42:	89 c1                	mov    %eax,%ecx
+    5e44:	8b 45 08             	mov    0x8(%ebp),%eax
+    5e47:	8d 50 01             	lea    0x1(%eax),%edx
+    5e4a:	89 55 08             	mov    %edx,0x8(%ebp)
+    5e4d:	0f b6 00             	movzbl (%eax),%eax
+    5e50:	0f be c0             	movsbl %al,%eax
+    5e53:	01 c8                	add    %ecx,%eax
+    5e55:	83 e8 30             	sub    $0x30,%eax
+    5e58:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    5e5b:	8b 45 08             	mov    0x8(%ebp),%eax
+    5e5e:	0f b6 00             	movzbl (%eax),%eax
+    5e61:	3c 2f                	cmp    $0x2f,%al
+    5e63:	7e 0a                	jle    5e6f <atoi+0x48>
+    5e65:	8b 45 08             	mov    0x8(%ebp),%eax
+    5e68:	0f b6 00             	movzbl (%eax),%eax
+    5e6b:	3c 39                	cmp    $0x39,%al
+    5e6d:	7e c7                	jle    5e36 <atoi+0xf>
+  return n;
+    5e6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    5e72:	c9                   	leave
+    5e73:	c3                   	ret
+
+00005e74 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    5e74:	55                   	push   %ebp
+    5e75:	89 e5                	mov    %esp,%ebp
+    5e77:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+    5e7a:	8b 45 08             	mov    0x8(%ebp),%eax
+    5e7d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    5e80:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5e83:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    5e86:	eb 17                	jmp    5e9f <memmove+0x2b>
+    *dst++ = *src++;
+    5e88:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    5e8b:	8d 42 01             	lea    0x1(%edx),%eax
+    5e8e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    5e91:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5e94:	8d 48 01             	lea    0x1(%eax),%ecx
+    5e97:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    5e9a:	0f b6 12             	movzbl (%edx),%edx
+    5e9d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    5e9f:	8b 45 10             	mov    0x10(%ebp),%eax
+    5ea2:	8d 50 ff             	lea    -0x1(%eax),%edx
+    5ea5:	89 55 10             	mov    %edx,0x10(%ebp)
+    5ea8:	85 c0                	test   %eax,%eax
+    5eaa:	7f dc                	jg     5e88 <memmove+0x14>
+  return vdst;
+    5eac:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    5eaf:	c9                   	leave
+    5eb0:	c3                   	ret
+
+00005eb1 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+    5eb1:	55                   	push   %ebp
+    5eb2:	89 e5                	mov    %esp,%ebp
+    5eb4:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+    5eb7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    5ebe:	eb 04                	jmp    5ec4 <ncpus+0x13>
+    5ec0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    5ec4:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+    5ec8:	7f 16                	jg     5ee0 <ncpus+0x2f>
+    5eca:	83 ec 08             	sub    $0x8,%esp
+    5ecd:	8d 45 8c             	lea    -0x74(%ebp),%eax
+    5ed0:	50                   	push   %eax
+    5ed1:	ff 75 f4             	push   -0xc(%ebp)
+    5ed4:	e8 d6 00 00 00       	call   5faf <intrstat>
+    5ed9:	83 c4 10             	add    $0x10,%esp
+    5edc:	85 c0                	test   %eax,%eax
+    5ede:	74 e0                	je     5ec0 <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+    5ee0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5ee3:	ba 01 00 00 00       	mov    $0x1,%edx
+    5ee8:	85 c0                	test   %eax,%eax
+    5eea:	0f 4e c2             	cmovle %edx,%eax
+}
+    5eed:	c9                   	leave
+    5eee:	c3                   	ret
+
+00005eef <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+    5eef:	b8 01 00 00 00       	mov    $0x1,%eax
+    5ef4:	cd 40                	int    $0x40
+    5ef6:	c3                   	ret
+
+00005ef7 <exit>:
+SYSCALL(exit)
+    5ef7:	b8 02 00 00 00       	mov    $0x2,%eax
+    5efc:	cd 40                	int    $0x40
+    5efe:	c3                   	ret
+
+00005eff <wait>:
+SYSCALL(wait)
+    5eff:	b8 03 00 00 00       	mov    $0x3,%eax
+    5f04:	cd 40                	int    $0x40
+    5f06:	c3                   	ret
+
+00005f07 <pipe>:
+SYSCALL(pipe)
+    5f07:	b8 04 00 00 00       	mov    $0x4,%eax
+    5f0c:	cd 40                	int    $0x40
+    5f0e:	c3                   	ret
+
+00005f0f <read>:
+SYSCALL(read)
+    5f0f:	b8 05 00 00 00       	mov    $0x5,%eax
+    5f14:	cd 40                	int    $0x40
+    5f16:	c3                   	ret
+
+00005f17 <write>:
+SYSCALL(write)
+    5f17:	b8 10 00 00 00       	mov    $0x10,%eax
+    5f1c:	cd 40                	int    $0x40
+    5f1e:	c3                   	ret
+
+00005f1f <close>:
+SYSCALL(close)
+    5f1f:	b8 15 00 00 00       	mov    $0x15,%eax
+    5f24:	cd 40                	int    $0x40
+    5f26:	c3                   	ret
+
+00005f27 <kill>:
+SYSCALL(kill)
+    5f27:	b8 06 00 00 00       	mov    $0x6,%eax
+    5f2c:	cd 40                	int    $0x40
+    5f2e:	c3                   	ret
+
+00005f2f <exec>:
+SYSCALL(exec)
+    5f2f:	b8 07 00 00 00       	mov    $0x7,%eax
+    5f34:	cd 40                	int    $0x40
+    5f36:	c3                   	ret
+
+00005f37 <open>:
+SYSCALL(open)
+    5f37:	b8 0f 00 00 00       	mov    $0xf,%eax
+    5f3c:	cd 40                	int    $0x40
+    5f3e:	c3                   	ret
+
+00005f3f <mknod>:
+SYSCALL(mknod)
+    5f3f:	b8 11 00 00 00       	mov    $0x11,%eax
+    5f44:	cd 40                	int    $0x40
+    5f46:	c3                   	ret
+
+00005f47 <unlink>:
+SYSCALL(unlink)
+    5f47:	b8 12 00 00 00       	mov    $0x12,%eax
+    5f4c:	cd 40                	int    $0x40
+    5f4e:	c3                   	ret
+
+00005f4f <fstat>:
+SYSCALL(fstat)
+    5f4f:	b8 08 00 00 00       	mov    $0x8,%eax
+    5f54:	cd 40                	int    $0x40
+    5f56:	c3                   	ret
+
+00005f57 <link>:
+SYSCALL(link)
+    5f57:	b8 13 00 00 00       	mov    $0x13,%eax
+    5f5c:	cd 40                	int    $0x40
+    5f5e:	c3                   	ret
+
+00005f5f <mkdir>:
+SYSCALL(mkdir)
+    5f5f:	b8 14 00 00 00       	mov    $0x14,%eax
+    5f64:	cd 40                	int    $0x40
+    5f66:	c3                   	ret
+
+00005f67 <chdir>:
+SYSCALL(chdir)
+    5f67:	b8 09 00 00 00       	mov    $0x9,%eax
+    5f6c:	cd 40                	int    $0x40
+    5f6e:	c3                   	ret
+
+00005f6f <dup>:
+SYSCALL(dup)
+    5f6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+    5f74:	cd 40                	int    $0x40
+    5f76:	c3                   	ret
+
+00005f77 <getpid>:
+SYSCALL(getpid)
+    5f77:	b8 0b 00 00 00       	mov    $0xb,%eax
+    5f7c:	cd 40                	int    $0x40
+    5f7e:	c3                   	ret
+
+00005f7f <sbrk>:
+SYSCALL(sbrk)
+    5f7f:	b8 0c 00 00 00       	mov    $0xc,%eax
+    5f84:	cd 40                	int    $0x40
+    5f86:	c3                   	ret
+
+00005f87 <sleep>:
+SYSCALL(sleep)
+    5f87:	b8 0d 00 00 00       	mov    $0xd,%eax
+    5f8c:	cd 40                	int    $0x40
+    5f8e:	c3                   	ret
+
+00005f8f <uptime>:
+SYSCALL(uptime)
+    5f8f:	b8 0e 00 00 00       	mov    $0xe,%eax
+    5f94:	cd 40                	int    $0x40
+    5f96:	c3                   	ret
+
+00005f97 <poll>:
+SYSCALL(poll)
+    5f97:	b8 16 00 00 00       	mov    $0x16,%eax
+    5f9c:	cd 40                	int    $0x40
+    5f9e:	c3                   	ret
+
+00005f9f <fcntl>:
+SYSCALL(fcntl)
+    5f9f:	b8 17 00 00 00       	mov    $0x17,%eax
+    5fa4:	cd 40                	int    $0x40
+    5fa6:	c3                   	ret
+
+00005fa7 <irqroute>:
+SYSCALL(irqroute)
+    5fa7:	b8 18 00 00 00       	mov    $0x18,%eax
+    5fac:	cd 40                	int    $0x40
+    5fae:	c3                   	ret
+
+00005faf <intrstat>:
+SYSCALL(intrstat)
+    5faf:	b8 19 00 00 00       	mov    $0x19,%eax
+    5fb4:	cd 40                	int    $0x40
+    5fb6:	c3                   	ret
+
+00005fb7 <pread>:
+SYSCALL(pread)
+    5fb7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    5fbc:	cd 40                	int    $0x40
+    5fbe:	c3                   	ret
+
+00005fbf <getdents>:
+SYSCALL(getdents)
+    5fbf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    5fc4:	cd 40                	int    $0x40
+    5fc6:	c3                   	ret
+
+00005fc7 <fstatat>:
+SYSCALL(fstatat)
+    5fc7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    5fcc:	cd 40                	int    $0x40
+    5fce:	c3                   	ret
+
+00005fcf <openat>:
+SYSCALL(openat)
+    5fcf:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    5fd4:	cd 40                	int    $0x40
+    5fd6:	c3                   	ret
+
+00005fd7 <unlinkat>:
+SYSCALL(unlinkat)
+    5fd7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    5fdc:	cd 40                	int    $0x40
+    5fde:	c3                   	ret
+
+00005fdf <mkdirat>:
+SYSCALL(mkdirat)
+    5fdf:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    5fe4:	cd 40                	int    $0x40
+    5fe6:	c3                   	ret
+
+00005fe7 <linkat>:
+SYSCALL(linkat)
+    5fe7:	b8 20 00 00 00       	mov    $0x20,%eax
+    5fec:	cd 40                	int    $0x40
+    5fee:	c3                   	ret
+
+00005fef <exits>:
+SYSCALL(exits)
+    5fef:	b8 21 00 00 00       	mov    $0x21,%eax
+    5ff4:	cd 40                	int    $0x40
+    5ff6:	c3                   	ret
+
+00005ff7 <waitstatus>:
+SYSCALL(waitstatus)
+    5ff7:	b8 22 00 00 00       	mov    $0x22,%eax
+    5ffc:	cd 40                	int    $0x40
+    5ffe:	c3                   	ret
+
+00005fff <pwrite>:
+SYSCALL(pwrite)
+    5fff:	b8 23 00 00 00       	mov    $0x23,%eax
+    6004:	cd 40                	int    $0x40
+    6006:	c3                   	ret
+
+00006007 <lseek>:
+SYSCALL(lseek)
+    6007:	b8 24 00 00 00       	mov    $0x24,%eax
+    600c:	cd 40                	int    $0x40
+    600e:	c3                   	ret
+
+0000600f <copyfilerange>:
+SYSCALL(copyfilerange)
+    600f:	b8 25 00 00 00       	mov    $0x25,%eax
+    6014:	cd 40                	int    $0x40
+    6016:	c3                   	ret
+
+00006017 <fsctl>:
+SYSCALL(fsctl)
+    6017:	b8 26 00 00 00       	mov    $0x26,%eax
+    601c:	cd 40                	int    $0x40
+    601e:	c3                   	ret
+
+0000601f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    601f:	55                   	push   %ebp
+    6020:	89 e5                	mov    %esp,%ebp
+    6022:	83 ec 18             	sub    $0x18,%esp
+    6025:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6028:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    602b:	83 ec 04             	sub    $0x4,%esp
+    602e:	6a 01                	push   $0x1
+    6030:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    6033:	50                   	push   %eax
+    6034:	ff 75 08             	push   0x8(%ebp)
+    6037:	e8 db fe ff ff       	call   5f17 <write>
+    603c:	83 c4 10             	add    $0x10,%esp
+}
+    603f:	90                   	nop
+    6040:	c9                   	leave
+    6041:	c3                   	ret
+
+00006042 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    6042:	55                   	push   %ebp
+    6043:	89 e5                	mov    %esp,%ebp
+    6045:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    6048:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    604f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    6053:	74 17                	je     606c <printint+0x2a>
+    6055:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    6059:	79 11                	jns    606c <printint+0x2a>
+    neg = 1;
+    605b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    6062:	8b 45 0c             	mov    0xc(%ebp),%eax
+    6065:	f7 d8                	neg    %eax
+    6067:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    606a:	eb 06                	jmp    6072 <printint+0x30>
+  } else {
+    x = xx;
+    606c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    606f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    6072:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    6079:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    607c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    607f:	ba 00 00 00 00       	mov    $0x0,%edx
+    6084:	f7 f1                	div    %ecx
+    6086:	89 d1                	mov    %edx,%ecx
+    6088:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    608b:	8d 50 01             	lea    0x1(%eax),%edx
+    608e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    6091:	0f b6 91 c8 8e 00 00 	movzbl 0x8ec8(%ecx),%edx
+    6098:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    609c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    609f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    60a2:	ba 00 00 00 00       	mov    $0x0,%edx
+    60a7:	f7 f1                	div    %ecx
+    60a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    60ac:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    60b0:	75 c7                	jne    6079 <printint+0x37>
+  if(neg)
+    60b2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    60b6:	74 2d                	je     60e5 <printint+0xa3>
+    buf[i++] = '-';
+    60b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    60bb:	8d 50 01             	lea    0x1(%eax),%edx
+    60be:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    60c1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    60c6:	eb 1d                	jmp    60e5 <printint+0xa3>
+    putc(fd, buf[i]);
+    60c8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    60cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    60ce:	01 d0                	add    %edx,%eax
+    60d0:	0f b6 00             	movzbl (%eax),%eax
+    60d3:	0f be c0             	movsbl %al,%eax
+    60d6:	83 ec 08             	sub    $0x8,%esp
+    60d9:	50                   	push   %eax
+    60da:	ff 75 08             	push   0x8(%ebp)
+    60dd:	e8 3d ff ff ff       	call   601f <putc>
+    60e2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    60e5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    60e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    60ed:	79 d9                	jns    60c8 <printint+0x86>
+}
+    60ef:	90                   	nop
+    60f0:	90                   	nop
+    60f1:	c9                   	leave
+    60f2:	c3                   	ret
+
+000060f3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    60f3:	55                   	push   %ebp
+    60f4:	89 e5                	mov    %esp,%ebp
+    60f6:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    60f9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    6100:	8d 45 0c             	lea    0xc(%ebp),%eax
+    6103:	83 c0 04             	add    $0x4,%eax
+    6106:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    6109:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    6110:	e9 59 01 00 00       	jmp    626e <printf+0x17b>
+    c = fmt[i] & 0xff;
+    6115:	8b 55 0c             	mov    0xc(%ebp),%edx
+    6118:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    611b:	01 d0                	add    %edx,%eax
+    611d:	0f b6 00             	movzbl (%eax),%eax
+    6120:	0f be c0             	movsbl %al,%eax
+    6123:	25 ff 00 00 00       	and    $0xff,%eax
+    6128:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    612b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    612f:	75 2c                	jne    615d <printf+0x6a>
+      if(c == '%'){
+    6131:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    6135:	75 0c                	jne    6143 <printf+0x50>
+        state = '%';
+    6137:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    613e:	e9 27 01 00 00       	jmp    626a <printf+0x177>
+      } else {
+        putc(fd, c);
+    6143:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    6146:	0f be c0             	movsbl %al,%eax
+    6149:	83 ec 08             	sub    $0x8,%esp
+    614c:	50                   	push   %eax
+    614d:	ff 75 08             	push   0x8(%ebp)
+    6150:	e8 ca fe ff ff       	call   601f <putc>
+    6155:	83 c4 10             	add    $0x10,%esp
+    6158:	e9 0d 01 00 00       	jmp    626a <printf+0x177>
+      }
+    } else if(state == '%'){
+    615d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    6161:	0f 85 03 01 00 00    	jne    626a <printf+0x177>
+      if(c == 'd'){
+    6167:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    616b:	75 1e                	jne    618b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    616d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6170:	8b 00                	mov    (%eax),%eax
+    6172:	6a 01                	push   $0x1
+    6174:	6a 0a                	push   $0xa
+    6176:	50                   	push   %eax
+    6177:	ff 75 08             	push   0x8(%ebp)
+    617a:	e8 c3 fe ff ff       	call   6042 <printint>
+    617f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    6182:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    6186:	e9 d8 00 00 00       	jmp    6263 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    618b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    618f:	74 06                	je     6197 <printf+0xa4>
+    6191:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    6195:	75 1e                	jne    61b5 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    6197:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    619a:	8b 00                	mov    (%eax),%eax
+    619c:	6a 00                	push   $0x0
+    619e:	6a 10                	push   $0x10
+    61a0:	50                   	push   %eax
+    61a1:	ff 75 08             	push   0x8(%ebp)
+    61a4:	e8 99 fe ff ff       	call   6042 <printint>
+    61a9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    61ac:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    61b0:	e9 ae 00 00 00       	jmp    6263 <printf+0x170>
+      } else if(c == 's'){
+    61b5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    61b9:	75 43                	jne    61fe <printf+0x10b>
+        s = (char*)*ap;
+    61bb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    61be:	8b 00                	mov    (%eax),%eax
+    61c0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    61c3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    61c7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    61cb:	75 25                	jne    61f2 <printf+0xff>
+          s = "(null)";
+    61cd:	c7 45 f4 32 86 00 00 	movl   $0x8632,-0xc(%ebp)
+        while(*s != 0){
+    61d4:	eb 1c                	jmp    61f2 <printf+0xff>
+          putc(fd, *s);
+    61d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    61d9:	0f b6 00             	movzbl (%eax),%eax
+    61dc:	0f be c0             	movsbl %al,%eax
+    61df:	83 ec 08             	sub    $0x8,%esp
+    61e2:	50                   	push   %eax
+    61e3:	ff 75 08             	push   0x8(%ebp)
+    61e6:	e8 34 fe ff ff       	call   601f <putc>
+    61eb:	83 c4 10             	add    $0x10,%esp
+          s++;
+    61ee:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    61f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    61f5:	0f b6 00             	movzbl (%eax),%eax
+    61f8:	84 c0                	test   %al,%al
+    61fa:	75 da                	jne    61d6 <printf+0xe3>
+    61fc:	eb 65                	jmp    6263 <printf+0x170>
+        }
+      } else if(c == 'c'){
+    61fe:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    6202:	75 1d                	jne    6221 <printf+0x12e>
+        putc(fd, *ap);
+    6204:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    6207:	8b 00                	mov    (%eax),%eax
+    6209:	0f be c0             	movsbl %al,%eax
+    620c:	83 ec 08             	sub    $0x8,%esp
+    620f:	50                   	push   %eax
+    6210:	ff 75 08             	push   0x8(%ebp)
+    6213:	e8 07 fe ff ff       	call   601f <putc>
+    6218:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    621b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    621f:	eb 42                	jmp    6263 <printf+0x170>
+      } else if(c == '%'){
+    6221:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    6225:	75 17                	jne    623e <printf+0x14b>
+        putc(fd, c);
+    6227:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    622a:	0f be c0             	movsbl %al,%eax
+    622d:	83 ec 08             	sub    $0x8,%esp
+    6230:	50                   	push   %eax
+    6231:	ff 75 08             	push   0x8(%ebp)
+    6234:	e8 e6 fd ff ff       	call   601f <putc>
+    6239:	83 c4 10             	add    $0x10,%esp
+    623c:	eb 25                	jmp    6263 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    623e:	83 ec 08             	sub    $0x8,%esp
+    6241:	6a 25                	push   $0x25
+    6243:	ff 75 08             	push   0x8(%ebp)
+    6246:	e8 d4 fd ff ff       	call   601f <putc>
+    624b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    624e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    6251:	0f be c0             	movsbl %al,%eax
+    6254:	83 ec 08             	sub    $0x8,%esp
+    6257:	50                   	push   %eax
+    6258:	ff 75 08             	push   0x8(%ebp)
+    625b:	e8 bf fd ff ff       	call   601f <putc>
+    6260:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    6263:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    626a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    626e:	8b 55 0c             	mov    0xc(%ebp),%edx
+    6271:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6274:	01 d0                	add    %edx,%eax
+    6276:	0f b6 00             	movzbl (%eax),%eax
+    6279:	84 c0                	test   %al,%al
+    627b:	0f 85 94 fe ff ff    	jne    6115 <printf+0x22>
+    }
+  }
+}
+    6281:	90                   	nop
+    6282:	90                   	nop
+    6283:	c9                   	leave
+    6284:	c3                   	ret
+
+00006285 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    6285:	55                   	push   %ebp
+    6286:	89 e5                	mov    %esp,%ebp
+    6288:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    628b:	8b 45 08             	mov    0x8(%ebp),%eax
+    628e:	83 e8 08             	sub    $0x8,%eax
+    6291:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    6294:	a1 a8 d6 00 00       	mov    0xd6a8,%eax
+    6299:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    629c:	eb 24                	jmp    62c2 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    629e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    62a1:	8b 00                	mov    (%eax),%eax
+    62a3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    62a6:	72 12                	jb     62ba <free+0x35>
+    62a8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    62ab:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    62ae:	72 24                	jb     62d4 <free+0x4f>
+    62b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    62b3:	8b 00                	mov    (%eax),%eax
+    62b5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    62b8:	72 1a                	jb     62d4 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    62ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    62bd:	8b 00                	mov    (%eax),%eax
+    62bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    62c2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    62c5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    62c8:	73 d4                	jae    629e <free+0x19>
+    62ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    62cd:	8b 00                	mov    (%eax),%eax
+    62cf:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    62d2:	73 ca                	jae    629e <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    62d4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    62d7:	8b 40 04             	mov    0x4(%eax),%eax
+    62da:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    62e1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    62e4:	01 c2                	add    %eax,%edx
+    62e6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    62e9:	8b 00                	mov    (%eax),%eax
+    62eb:	39 c2                	cmp    %eax,%edx
+    62ed:	75 24                	jne    6313 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    62ef:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    62f2:	8b 50 04             	mov    0x4(%eax),%edx
+    62f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    62f8:	8b 00                	mov    (%eax),%eax
+    62fa:	8b 40 04             	mov    0x4(%eax),%eax
+    62fd:	01 c2                	add    %eax,%edx
+    62ff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    6302:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    6305:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6308:	8b 00                	mov    (%eax),%eax
+    630a:	8b 10                	mov    (%eax),%edx
+    630c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    630f:	89 10                	mov    %edx,(%eax)
+    6311:	eb 0a                	jmp    631d <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    6313:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6316:	8b 10                	mov    (%eax),%edx
+    6318:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    631b:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    631d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6320:	8b 40 04             	mov    0x4(%eax),%eax
+    6323:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    632a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    632d:	01 d0                	add    %edx,%eax
+    632f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    6332:	75 20                	jne    6354 <free+0xcf>
+    p->s.size += bp->s.size;
+    6334:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6337:	8b 50 04             	mov    0x4(%eax),%edx
+    633a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    633d:	8b 40 04             	mov    0x4(%eax),%eax
+    6340:	01 c2                	add    %eax,%edx
+    6342:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6345:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    6348:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    634b:	8b 10                	mov    (%eax),%edx
+    634d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6350:	89 10                	mov    %edx,(%eax)
+    6352:	eb 08                	jmp    635c <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    6354:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    6357:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    635a:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    635c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    635f:	a3 a8 d6 00 00       	mov    %eax,0xd6a8
+}
+    6364:	90                   	nop
+    6365:	c9                   	leave
+    6366:	c3                   	ret
+
+00006367 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    6367:	55                   	push   %ebp
+    6368:	89 e5                	mov    %esp,%ebp
+    636a:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    636d:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    6374:	77 07                	ja     637d <morecore+0x16>
+    nu = 4096;
+    6376:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    637d:	8b 45 08             	mov    0x8(%ebp),%eax
+    6380:	c1 e0 03             	shl    $0x3,%eax
+    6383:	83 ec 0c             	sub    $0xc,%esp
+    6386:	50                   	push   %eax
+    6387:	e8 f3 fb ff ff       	call   5f7f <sbrk>
+    638c:	83 c4 10             	add    $0x10,%esp
+    638f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    6392:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    6396:	75 07                	jne    639f <morecore+0x38>
+    return 0;
+    6398:	b8 00 00 00 00       	mov    $0x0,%eax
+    639d:	eb 26                	jmp    63c5 <morecore+0x5e>
+  hp = (Header*)p;
+    639f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    63a2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    63a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    63a8:	8b 55 08             	mov    0x8(%ebp),%edx
+    63ab:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    63ae:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    63b1:	83 c0 08             	add    $0x8,%eax
+    63b4:	83 ec 0c             	sub    $0xc,%esp
+    63b7:	50                   	push   %eax
+    63b8:	e8 c8 fe ff ff       	call   6285 <free>
+    63bd:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    63c0:	a1 a8 d6 00 00       	mov    0xd6a8,%eax
+}
+    63c5:	c9                   	leave
+    63c6:	c3                   	ret
+
+000063c7 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    63c7:	55                   	push   %ebp
+    63c8:	89 e5                	mov    %esp,%ebp
+    63ca:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    63cd:	8b 45 08             	mov    0x8(%ebp),%eax
+    63d0:	83 c0 07             	add    $0x7,%eax
+    63d3:	c1 e8 03             	shr    $0x3,%eax
+    63d6:	83 c0 01             	add    $0x1,%eax
+    63d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    63dc:	a1 a8 d6 00 00       	mov    0xd6a8,%eax
+    63e1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    63e4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    63e8:	75 23                	jne    640d <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    63ea:	c7 45 f0 a0 d6 00 00 	movl   $0xd6a0,-0x10(%ebp)
+    63f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    63f4:	a3 a8 d6 00 00       	mov    %eax,0xd6a8
+    63f9:	a1 a8 d6 00 00       	mov    0xd6a8,%eax
+    63fe:	a3 a0 d6 00 00       	mov    %eax,0xd6a0
+    base.s.size = 0;
+    6403:	c7 05 a4 d6 00 00 00 	movl   $0x0,0xd6a4
+    640a:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    640d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6410:	8b 00                	mov    (%eax),%eax
+    6412:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    6415:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6418:	8b 40 04             	mov    0x4(%eax),%eax
+    641b:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    641e:	72 4d                	jb     646d <malloc+0xa6>
+      if(p->s.size == nunits)
+    6420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6423:	8b 40 04             	mov    0x4(%eax),%eax
+    6426:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    6429:	75 0c                	jne    6437 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    642b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    642e:	8b 10                	mov    (%eax),%edx
+    6430:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6433:	89 10                	mov    %edx,(%eax)
+    6435:	eb 26                	jmp    645d <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    6437:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    643a:	8b 40 04             	mov    0x4(%eax),%eax
+    643d:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    6440:	89 c2                	mov    %eax,%edx
+    6442:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6445:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    6448:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    644b:	8b 40 04             	mov    0x4(%eax),%eax
+    644e:	c1 e0 03             	shl    $0x3,%eax
+    6451:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    6454:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6457:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    645a:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    645d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    6460:	a3 a8 d6 00 00       	mov    %eax,0xd6a8
+      return (void*)(p + 1);
+    6465:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6468:	83 c0 08             	add    $0x8,%eax
+    646b:	eb 3b                	jmp    64a8 <malloc+0xe1>
+    }
+    if(p == freep)
+    646d:	a1 a8 d6 00 00       	mov    0xd6a8,%eax
+    6472:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    6475:	75 1e                	jne    6495 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    6477:	83 ec 0c             	sub    $0xc,%esp
+    647a:	ff 75 ec             	push   -0x14(%ebp)
+    647d:	e8 e5 fe ff ff       	call   6367 <morecore>
+    6482:	83 c4 10             	add    $0x10,%esp
+    6485:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    6488:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    648c:	75 07                	jne    6495 <malloc+0xce>
+        return 0;
+    648e:	b8 00 00 00 00       	mov    $0x0,%eax
+    6493:	eb 13                	jmp    64a8 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    6495:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    6498:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    649b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    649e:	8b 00                	mov    (%eax),%eax
+    64a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    64a3:	e9 6d ff ff ff       	jmp    6415 <malloc+0x4e>
+  }
+}
+    64a8:	c9                   	leave
+    64a9:	c3                   	ret
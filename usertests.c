@@ -7,6 +7,8 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "poll.h"
+#include "fsctl.h"
 
 char buf[8192];
 char name[3];
@@ -354,6 +356,621 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// poll() over several pipes: readiness, EOF, and waking
+// a blocked poller from another process.
+void
+polltest(void)
+{
+  int p1[2], p2[2], pid;
+  struct pollfd pfd[2];
+  char c;
+
+  printf(1, "poll test\n");
+  if(pipe(p1) != 0 || pipe(p2) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pfd[0].fd = p1[0];
+  pfd[0].events = POLLIN;
+  pfd[1].fd = p2[0];
+  pfd[1].events = POLLIN;
+  if(poll(pfd, 2, 0) != 0){
+    printf(1, "poll: empty pipes ready\n");
+    exit();
+  }
+  if(poll(pfd, 2, 2) != 0){
+    printf(1, "poll: timeout returned ready\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    sleep(5);
+    write(p2[1], "x", 1);
+    exit();
+  }
+  if(poll(pfd, 2, -1) != 1 || pfd[0].revents != 0 || pfd[1].revents != POLLIN){
+    printf(1, "poll: wrong revents %d %d\n", pfd[0].revents, pfd[1].revents);
+    exit();
+  }
+  if(read(p2[0], &c, 1) != 1 || c != 'x'){
+    printf(1, "poll: read failed\n");
+    exit();
+  }
+  wait();
+
+  close(p1[1]);
+  if(poll(pfd, 2, 0) != 1 || pfd[0].revents != POLLHUP){
+    printf(1, "poll: no POLLHUP\n");
+    exit();
+  }
+  pfd[0].fd = p2[1];
+  pfd[0].events = POLLOUT;
+  pfd[1].fd = 99;
+  if(poll(pfd, 2, 0) != 2 || pfd[0].revents != POLLOUT || pfd[1].revents != POLLNVAL){
+    printf(1, "poll: bad POLLOUT/POLLNVAL\n");
+    exit();
+  }
+  close(p1[0]);
+  close(p2[0]);
+  close(p2[1]);
+  printf(1, "poll test ok\n");
+}
+
+// A writer blocked on a full pipe must still wake a poller on
+// the read end.
+void
+pollfulltest(void)
+{
+  int fds[2], pid, n, tot;
+  struct pollfd pfd;
+
+  printf(1, "poll full pipe test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    sleep(5);
+    memset(buf, 'p', 1000);
+    if(write(fds[1], buf, 1000) != 1000)
+      printf(1, "poll full: write failed\n");
+    exit();
+  }
+  close(fds[1]);
+  pfd.fd = fds[0];
+  pfd.events = POLLIN;
+  for(tot = 0; tot < 1000; tot += n){
+    if(poll(&pfd, 1, -1) != 1 || !(pfd.revents & POLLIN)){
+      printf(1, "poll full: wrong revents %d\n", pfd.revents);
+      exit();
+    }
+    if((n = read(fds[0], buf, 1000 - tot)) <= 0){
+      printf(1, "poll full: read failed\n");
+      exit();
+    }
+  }
+  wait();
+  close(fds[0]);
+  printf(1, "poll full pipe test ok\n");
+}
+
+// O_NONBLOCK pipe ends return -EAGAIN instead of sleeping.
+void
+nonblocktest(void)
+{
+  int fds[2], n, tot;
+  char c;
+
+  printf(1, "nonblock test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(fcntl(fds[0], F_SETFL, O_NONBLOCK) != 0 ||
+     fcntl(fds[1], F_SETFL, O_NONBLOCK) != 0 ||
+     fcntl(fds[0], F_GETFL, 0) != (O_RDONLY|O_NONBLOCK)){
+    printf(1, "fcntl failed\n");
+    exit();
+  }
+  if(read(fds[0], &c, 1) != -EAGAIN){
+    printf(1, "nonblock: empty read did not fail\n");
+    exit();
+  }
+  tot = 0;
+  memset(buf, 'n', 100);
+  while((n = write(fds[1], buf, 100)) > 0)
+    tot += n;
+  if(n != -EAGAIN || tot == 0){
+    printf(1, "nonblock: full write returned %d after %d\n", n, tot);
+    exit();
+  }
+  while((n = read(fds[0], buf, sizeof(buf))) > 0)
+    tot -= n;
+  if(n != -EAGAIN || tot != 0){
+    printf(1, "nonblock: drained wrong amount\n");
+    exit();
+  }
+  close(fds[1]);
+  if(read(fds[0], &c, 1) != 0){
+    printf(1, "nonblock: no EOF\n");
+    exit();
+  }
+  close(fds[0]);
+  printf(1, "nonblock test ok\n");
+}
+
+// pread reads at an offset and leaves the file offset alone.
+void
+preadtest(void)
+{
+  int fd, i;
+  char c;
+
+  printf(1, "pread test\n");
+  fd = open("preadfile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "pread: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++)
+    buf[i] = i;
+  if(write(fd, buf, 100) != 100){
+    printf(1, "pread: write failed\n");
+    exit();
+  }
+  if(pread(fd, &c, 1, 42) != 1 || c != 42 ||
+     pread(fd, buf, 10, 95) != 5 || buf[0] != 95 ||
+     pread(fd, &c, 1, 100) != 0){
+    printf(1, "pread: wrong data\n");
+    exit();
+  }
+  if(pwrite(fd, "xy", 2, 10) != 2 || pwrite(fd, "z", 1, 100) != 1 ||
+     pread(fd, buf, 3, 9) != 3 || buf[0] != 9 || buf[1] != 'x' ||
+     buf[2] != 'y' || pread(fd, &c, 1, 100) != 1 || c != 'z'){
+    printf(1, "pwrite: wrong data\n");
+    exit();
+  }
+  // Still at 100 from the write.
+  if(read(fd, &c, 1) != 1 || c != 'z' || read(fd, &c, 1) != 0){
+    printf(1, "pread: offset moved\n");
+    exit();
+  }
+  close(fd);
+  unlink("preadfile");
+  printf(1, "pread test ok\n");
+}
+
+// lseek past the end and write leaves a hole that reads as zeros.
+void
+sparsetest(void)
+{
+  int fd, i, off, fds[2];
+  struct stat st;
+
+  printf(1, "sparse test\n");
+  fd = open("sparsefile", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "sparse: create failed\n");
+    exit();
+  }
+  // Past the direct blocks, so the hole includes them.
+  off = 20*512 + 7;
+  if(lseek(fd, off, SEEK_SET) != off || write(fd, "end", 3) != 3 ||
+     lseek(fd, 0, SEEK_CUR) != off+3 || fstat(fd, &st) < 0 ||
+     st.size != off+3){
+    printf(1, "sparse: write past end failed\n");
+    exit();
+  }
+  if(lseek(fd, 0, SEEK_SET) != 0){
+    printf(1, "sparse: lseek failed\n");
+    exit();
+  }
+  for(i = 0; i < off; i += 512){
+    memset(buf, 'x', 512);
+    if(read(fd, buf, 512) != 512 || buf[0] != 0 || buf[511] != 0){
+      printf(1, "sparse: hole not zero\n");
+      exit();
+    }
+  }
+  if(pread(fd, buf, 10, off) != 3 || buf[0] != 'e' || buf[2] != 'd' ||
+     lseek(fd, 100, SEEK_END) != off+103 || read(fd, buf, 1) != 0 ||
+     lseek(fd, -1, SEEK_SET) != -1 || lseek(fd, 0, 3) != -1){
+    printf(1, "sparse: wrong data or offset\n");
+    exit();
+  }
+  close(fd);
+  unlink("sparsefile");
+  if(pipe(fds) < 0 || lseek(fds[0], 0, SEEK_SET) != -1){
+    printf(1, "sparse: lseek on a pipe worked\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  printf(1, "sparse test ok\n");
+}
+
+// copyfilerange shares aligned blocks; writes to either copy
+// must not show in the other.
+void
+copytest(void)
+{
+  int a, b, i, n;
+
+  printf(1, "copy test\n");
+  a = open("copya", O_CREATE|O_RDWR);
+  b = open("copyb", O_CREATE|O_RDWR);
+  if(a < 0 || b < 0){
+    printf(1, "copy: create failed\n");
+    exit();
+  }
+  // 20 blocks, past the direct ones, then a partial block.
+  for(i = 0; i < 20; i++){
+    memset(buf, 'a' + i, 512);
+    if(write(a, buf, 512) != 512){
+      printf(1, "copy: write failed\n");
+      exit();
+    }
+  }
+  if(write(a, "tail", 4) != 4){
+    printf(1, "copy: write failed\n");
+    exit();
+  }
+  n = 20*512 + 4;
+  if(copyfilerange(a, 0, b, 0, n + 100) != n){
+    printf(1, "copy: copyfilerange failed\n");
+    exit();
+  }
+  // Change a shared block in b, and a in a.
+  if(pwrite(b, "B", 1, 3*512 + 5) != 1 || pwrite(a, "A", 1, 15*512) != 1){
+    printf(1, "copy: pwrite failed\n");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    if(pread(b, buf, 512, i*512) != 512 || buf[0] != 'a' + i ||
+       buf[511] != 'a' + i || (i == 3 && buf[5] != 'B') || (i != 3 && buf[5] != 'a' + i)){
+      printf(1, "copy: wrong data in copy at block %d\n", i);
+      exit();
+    }
+    if(pread(a, buf, 512, i*512) != 512 || buf[5] != 'a' + i ||
+       buf[0] != (i == 15 ? 'A' : 'a' + i)){
+      printf(1, "copy: wrong data in original at block %d\n", i);
+      exit();
+    }
+  }
+  if(pread(b, buf, 10, 20*512) != 4 || buf[0] != 't' || buf[3] != 'l'){
+    printf(1, "copy: wrong tail\n");
+    exit();
+  }
+  // Unaligned: copied, not shared.
+  if(copyfilerange(a, 7, b, 100, 600) != 600 ||
+     pread(b, buf, 600, 100) != 600 || buf[0] != 'a' || buf[504] != 'a' ||
+     buf[505] != 'b' || buf[599] != 'b'){
+    printf(1, "copy: unaligned copy wrong\n");
+    exit();
+  }
+  // Overlapping ranges of one file are refused.
+  if(copyfilerange(a, 0, a, 512, 1024) != -1){
+    printf(1, "copy: overlapping copy worked\n");
+    exit();
+  }
+  close(a);
+  close(b);
+  unlink("copya");
+  unlink("copyb");
+  printf(1, "copy test ok\n");
+}
+
+// Writing two files a block at a time interleaves their blocks;
+// defragmenting one puts its blocks back in a single run.
+void
+defragtest(void)
+{
+  struct extents e;
+  int a, b, ro, i;
+
+  printf(1, "defrag test\n");
+  a = open("defraga", O_CREATE|O_RDWR);
+  b = open("defragb", O_CREATE|O_RDWR);
+  if(a < 0 || b < 0){
+    printf(1, "defrag: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 16; i++){
+    memset(buf, 'a' + i, 512);
+    if(write(a, buf, 512) != 512 || write(b, buf, 512) != 512){
+      printf(1, "defrag: write failed\n");
+      exit();
+    }
+  }
+  if(fsctl(a, FS_EXTENTS, &e) < 0 || e.nblocks != 17 || e.nextents < 2){
+    printf(1, "defrag: a is not fragmented\n");
+    exit();
+  }
+  // Moving blocks needs a descriptor open for writing.
+  if((ro = open("defraga", O_RDONLY)) < 0 || fsctl(ro, FS_DEFRAG, 0) != -1 ||
+     fsctl(ro, FS_COMPRESS, 0) != -1){
+    printf(1, "defrag: FS_DEFRAG on a read-only fd succeeded\n");
+    exit();
+  }
+  close(ro);
+  if(fsctl(a, FS_DEFRAG, 0) != 17 || fsctl(a, FS_EXTENTS, &e) < 0 ||
+     e.nblocks != 17 || e.nextents != 1){
+    printf(1, "defrag: FS_DEFRAG failed\n");
+    exit();
+  }
+  for(i = 0; i < 16; i++){
+    if(pread(a, buf, 512, i*512) != 512 || buf[0] != 'a' + i || buf[511] != 'a' + i){
+      printf(1, "defrag: wrong data at block %d\n", i);
+      exit();
+    }
+  }
+  close(a);
+  close(b);
+  unlink("defraga");
+  unlink("defragb");
+  printf(1, "defrag test ok\n");
+}
+
+// A compressed file reads back the same, takes fewer blocks,
+// and can still be written and copied.
+void
+compresstest(void)
+{
+  struct extents e;
+  int a, b, i, n;
+  char *text;
+
+  printf(1, "compress test\n");
+  a = open("compressa", O_CREATE|O_RDWR);
+  b = open("compressb", O_CREATE|O_RDWR);
+  if(a < 0 || b < 0){
+    printf(1, "compress: create failed\n");
+    exit();
+  }
+  // 14 blocks of text and a partial one: four clusters.
+  text = "compressible ";
+  n = 14*512 + 3;
+  for(i = 0; i < 14*512; i++)
+    buf[i] = text[i%13];
+  if(write(a, buf, 14*512) != 14*512 || write(a, "end", 3) != 3){
+    printf(1, "compress: write failed\n");
+    exit();
+  }
+  if(fsctl(a, FS_COMPRESS, 0) != 4 || fsctl(a, FS_EXTENTS, &e) < 0 ||
+     e.nblocks >= 16){
+    printf(1, "compress: FS_COMPRESS failed\n");
+    exit();
+  }
+  memset(buf, 0, sizeof(buf));
+  if(pread(a, buf, sizeof(buf), 0) != n || buf[n-3] != 'e' || buf[n-1] != 'd'){
+    printf(1, "compress: wrong data\n");
+    exit();
+  }
+  for(i = 0; i < 14*512; i++){
+    if(buf[i] != text[i%13]){
+      printf(1, "compress: wrong data at %d\n", i);
+      exit();
+    }
+  }
+  // Write into the middle of a compressed cluster, and copy.
+  if(pwrite(a, "X", 1, 5*512 + 3) != 1 || copyfilerange(a, 0, b, 0, n) != n){
+    printf(1, "compress: pwrite or copyfilerange failed\n");
+    exit();
+  }
+  memset(buf, 0, sizeof(buf));
+  if(pread(b, buf, sizeof(buf), 0) != n || buf[n-1] != 'd'){
+    printf(1, "compress: wrong data in copy\n");
+    exit();
+  }
+  for(i = 0; i < 14*512; i++){
+    if(buf[i] != (i == 5*512 + 3 ? 'X' : text[i%13])){
+      printf(1, "compress: wrong data in copy at %d\n", i);
+      exit();
+    }
+  }
+  close(a);
+  close(b);
+  unlink("compressa");
+  unlink("compressb");
+  printf(1, "compress test ok\n");
+}
+
+// A process can have more than NOFILE descriptors, is always
+// given the lowest free one, and passes them all on in fork().
+void
+fdtabletest(void)
+{
+  int fd, fds[40], i, pid;
+  char c;
+
+  printf(1, "fd table test\n");
+  fd = open("fdtable", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, "x", 1) != 1){
+    printf(1, "fdtable: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 40; i++){
+    if((fds[i] = dup(fd)) < 0){
+      printf(1, "fdtable: dup %d failed\n", i);
+      exit();
+    }
+  }
+  close(fds[5]);
+  close(fds[30]);
+  if(dup(fd) != fds[5] || dup(fd) != fds[30]){
+    printf(1, "fdtable: not the lowest free descriptor\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fdtable: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(pread(fds[39], &c, 1, 0) != 1 || c != 'x'){
+      printf(1, "fdtable: descriptor lost in fork\n");
+      exit();
+    }
+    for(i = 0; i < 40; i++)
+      close(fds[i]);
+    exit();
+  }
+  wait();
+  for(i = 0; i < 40; i++)
+    close(fds[i]);
+  close(fd);
+  unlink("fdtable");
+  printf(1, "fd table test ok\n");
+}
+
+// *at() calls resolve relative paths from a directory fd.
+void
+attest(void)
+{
+  int dfd, fd;
+  struct stat st;
+
+  printf(1, "at test\n");
+  if(mkdir("atdir") < 0 || (dfd = open("atdir", O_RDONLY)) < 0){
+    printf(1, "at: mkdir/open atdir failed\n");
+    exit();
+  }
+  if(mkdirat(dfd, "sub") < 0 ||
+     (fd = openat(dfd, "sub/f", O_CREATE|O_RDWR)) < 0 ||
+     write(fd, "hi", 2) != 2){
+    printf(1, "at: create failed\n");
+    exit();
+  }
+  close(fd);
+  if(linkat(dfd, "sub/f", AT_FDCWD, "atlink") < 0 ||
+     fstatat(AT_FDCWD, "atdir/sub/f", &st) < 0 || st.nlink != 2 ||
+     fstatat(dfd, "../atlink", &st) < 0 || st.size != 2){
+    printf(1, "at: link failed\n");
+    exit();
+  }
+  if(unlinkat(dfd, "sub") == 0 ||
+     unlinkat(dfd, "sub/f") < 0 || unlinkat(dfd, "sub") < 0 ||
+     openat(dfd, "sub/f", O_RDONLY) >= 0){
+    printf(1, "at: unlink failed\n");
+    exit();
+  }
+  close(dfd);
+  if(unlink("atlink") < 0 || unlink("atdir") < 0){
+    printf(1, "at: cleanup failed\n");
+    exit();
+  }
+  printf(1, "at test ok\n");
+}
+
+// getdents returns the in-use entries of a directory however
+// small the buffer, skipping the slots of removed files, and
+// fstatat finds each of them from the directory fd and from
+// the current directory.
+void
+getdentstest(void)
+{
+  struct dirent de[3];
+  struct stat st;
+  char name[DIRSIZ+1], path[32];
+  int dfd, fd, i, j, n, seen;
+
+  printf(1, "getdents test\n");
+  if(mkdir("gddir") < 0 || (dfd = open("gddir", O_RDONLY)) < 0){
+    printf(1, "getdents: mkdir/open gddir failed\n");
+    exit();
+  }
+  name[0] = 'f';
+  name[2] = 0;
+  for(i = 0; i < 10; i++){
+    name[1] = '0' + i;
+    if((fd = openat(dfd, name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "getdents: create failed\n");
+      exit();
+    }
+    close(fd);
+  }
+  // Leave empty slots at f1, f4 and f7.
+  if(unlinkat(dfd, "f1") < 0 || unlinkat(dfd, "f4") < 0 ||
+     unlinkat(dfd, "f7") < 0){
+    printf(1, "getdents: unlink failed\n");
+    exit();
+  }
+
+  // Read the directory up to three entries at a time.
+  seen = 0;
+  while((n = getdents(dfd, de, sizeof(de))) > 0){
+    if(n % sizeof(de[0]) != 0){
+      printf(1, "getdents: partial entry\n");
+      exit();
+    }
+    for(j = 0; j < n/sizeof(de[0]); j++){
+      if(de[j].inum == 0){
+        printf(1, "getdents: empty slot returned\n");
+        exit();
+      }
+      memmove(name, de[j].name, DIRSIZ);
+      name[DIRSIZ] = 0;
+      if(strcmp(name, ".") == 0 || strcmp(name, "..") == 0)
+        continue;
+      if(name[0] != 'f' || name[1] < '0' || name[1] > '9' || name[2] != 0 ||
+         (seen & (1 << (name[1]-'0')))){
+        printf(1, "getdents: unexpected entry %s\n", name);
+        exit();
+      }
+      seen |= 1 << (name[1]-'0');
+      if(fstatat(dfd, name, &st) < 0 || st.ino != de[j].inum ||
+         st.type != T_FILE){
+        printf(1, "getdents: fstatat %s failed\n", name);
+        exit();
+      }
+      strcpy(path, "gddir/");
+      strcpy(path + 6, name);
+      if(fstatat(AT_FDCWD, path, &st) < 0 || st.ino != de[j].inum){
+        printf(1, "getdents: fstatat %s failed\n", path);
+        exit();
+      }
+    }
+  }
+  if(n < 0 || seen != (0x3ff & ~(1<<1 | 1<<4 | 1<<7))){
+    printf(1, "getdents: wrong entries %x\n", seen);
+    exit();
+  }
+  if(getdents(dfd, de, sizeof(de)) != 0){
+    printf(1, "getdents: read past end\n");
+    exit();
+  }
+  if(fstatat(dfd, "f4", &st) == 0){
+    printf(1, "getdents: fstatat found removed f4\n");
+    exit();
+  }
+  close(dfd);
+
+  for(i = 0; i < 10; i++){
+    strcpy(path, "gddir/f0");
+    path[7] = '0' + i;
+    if(i != 1 && i != 4 && i != 7 && unlink(path) < 0){
+      printf(1, "getdents: cleanup failed\n");
+      exit();
+    }
+  }
+  if(unlink("gddir") < 0){
+    printf(1, "getdents: cleanup failed\n");
+    exit();
+  }
+  printf(1, "getdents test ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -424,6 +1041,36 @@ exitwait(void)
   printf(1, "exitwait ok\n");
 }
 
+// waitstatus() returns what the child passed to exits(),
+// 0 after exit() and -1 if the child was killed.
+void
+exitstatus(void)
+{
+  int pid, st;
+
+  if((pid = fork()) == 0)
+    exits(42);
+  if(waitstatus(&st) != pid || st != 42){
+    printf(1, "exitstatus: got %d\n", st);
+    return;
+  }
+  if((pid = fork()) == 0)
+    exit();
+  if(waitstatus(&st) != pid || st != 0){
+    printf(1, "exitstatus: exit() gave %d\n", st);
+    return;
+  }
+  if((pid = fork()) == 0)
+    for(;;)
+      sleep(1);
+  kill(pid);
+  if(waitstatus(&st) != pid || st != -1){
+    printf(1, "exitstatus: killed gave %d\n", st);
+    return;
+  }
+  printf(1, "exitstatus ok\n");
+}
+
 void
 mem(void)
 {
@@ -1738,8 +2385,20 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  polltest();
+  pollfulltest();
+  nonblocktest();
+  preadtest();
+  sparsetest();
+  copytest();
+  defragtest();
+  compresstest();
+  fdtabletest();
+  attest();
+  getdentstest();
   preempt();
   exitwait();
+  exitstatus();
 
   rmdot();
   fourteen();
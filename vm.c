@@ -173,6 +173,7 @@ switchuvm(struct proc *p)
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
   lcr3(v2p(p->pgdir));  // switch to new address space
+  cpu->pgdir = p->pgdir;
   popcli();
 }
 
@@ -272,6 +273,31 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Unmap up to n user pages from *va up to end, adding them to b
+// and storing their kernel addresses in pages[] for the caller
+// to free once b has been flushed.  Advances *va past the pages
+// looked at and returns the number unmapped.
+int
+unmapuvm(pde_t *pgdir, uint *va, uint end, char **pages, int n, struct tlbbatch *b)
+{
+  pte_t *pte;
+  int k;
+
+  for(k = 0; *va < end && k < n; *va += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)*va, 0);
+    if(!pte)  // no page table: go on at the next one
+      *va = PGADDR(PDX(*va) + 1, 0, 0) - PGSIZE;
+    else if((*pte & PTE_P) != 0){
+      if(PTE_ADDR(*pte) == 0)
+        panic("unmapuvm");
+      pages[k++] = p2v(PTE_ADDR(*pte));
+      *pte = 0;
+      tlbadd(b, *va);
+    }
+  }
+  return k;
+}
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
@@ -0,0 +1,1920 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <nlines>:
+};
+
+// Number of '\n' bytes in [p, p+n), four at a time.
+int
+nlines(char *p, int n)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+  uint x, y;
+  int l;
+
+  l = 0;
+   6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  for(; n > 0 && ((uint)p & 3) != 0; n--)
+   d:	eb 1b                	jmp    2a <nlines+0x2a>
+    l += *p++ == '\n';
+   f:	8b 45 08             	mov    0x8(%ebp),%eax
+  12:	8d 50 01             	lea    0x1(%eax),%edx
+  15:	89 55 08             	mov    %edx,0x8(%ebp)
+  18:	0f b6 00             	movzbl (%eax),%eax
+  1b:	3c 0a                	cmp    $0xa,%al
+  1d:	0f 94 c0             	sete   %al
+  20:	0f b6 c0             	movzbl %al,%eax
+  23:	01 45 fc             	add    %eax,-0x4(%ebp)
+  for(; n > 0 && ((uint)p & 3) != 0; n--)
+  26:	83 6d 0c 01          	subl   $0x1,0xc(%ebp)
+  2a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  2e:	7e 54                	jle    84 <nlines+0x84>
+  30:	8b 45 08             	mov    0x8(%ebp),%eax
+  33:	83 e0 03             	and    $0x3,%eax
+  36:	85 c0                	test   %eax,%eax
+  38:	75 d5                	jne    f <nlines+0xf>
+  for(; n >= 4; n -= 4, p += 4){
+  3a:	eb 48                	jmp    84 <nlines+0x84>
+    x = *(uint*)p ^ 0x0a0a0a0a;
+  3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  3f:	8b 00                	mov    (%eax),%eax
+  41:	35 0a 0a 0a 0a       	xor    $0xa0a0a0a,%eax
+  46:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    // 0x80 in each byte of y where x is zero.
+    y = ~(((x & 0x7f7f7f7f) + 0x7f7f7f7f) | x | 0x7f7f7f7f);
+  49:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  4c:	25 7f 7f 7f 7f       	and    $0x7f7f7f7f,%eax
+  51:	05 7f 7f 7f 7f       	add    $0x7f7f7f7f,%eax
+  56:	0b 45 f8             	or     -0x8(%ebp),%eax
+  59:	0d 7f 7f 7f 7f       	or     $0x7f7f7f7f,%eax
+  5e:	f7 d0                	not    %eax
+  60:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    l += (y >> 7) * 0x01010101 >> 24;
+  63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  66:	c1 e8 07             	shr    $0x7,%eax
+  69:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+  6f:	c1 e8 18             	shr    $0x18,%eax
+  72:	89 c2                	mov    %eax,%edx
+  74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  77:	01 d0                	add    %edx,%eax
+  79:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  for(; n >= 4; n -= 4, p += 4){
+  7c:	83 6d 0c 04          	subl   $0x4,0xc(%ebp)
+  80:	83 45 08 04          	addl   $0x4,0x8(%ebp)
+  84:	83 7d 0c 03          	cmpl   $0x3,0xc(%ebp)
+  88:	7f b2                	jg     3c <nlines+0x3c>
+  }
+  for(; n > 0; n--)
+  8a:	eb 1b                	jmp    a7 <nlines+0xa7>
+    l += *p++ == '\n';
+  8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  8f:	8d 50 01             	lea    0x1(%eax),%edx
+  92:	89 55 08             	mov    %edx,0x8(%ebp)
+  95:	0f b6 00             	movzbl (%eax),%eax
+  98:	3c 0a                	cmp    $0xa,%al
+  9a:	0f 94 c0             	sete   %al
+  9d:	0f b6 c0             	movzbl %al,%eax
+  a0:	01 45 fc             	add    %eax,-0x4(%ebp)
+  for(; n > 0; n--)
+  a3:	83 6d 0c 01          	subl   $0x1,0xc(%ebp)
+  a7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  ab:	7f df                	jg     8c <nlines+0x8c>
+  return l;
+  ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  b0:	c9                   	leave
+  b1:	c3                   	ret
+
+000000b2 <count>:
+
+// Add the counts for n bytes of buf to ct.  inword carries
+// across calls: was the byte before buf part of a word?
+void
+count(struct count *ct, int n, int *inword)
+{
+  b2:	55                   	push   %ebp
+  b3:	89 e5                	mov    %esp,%ebp
+  b5:	83 ec 10             	sub    $0x10,%esp
+  int i, in, w, sp;
+
+  ct->c += n;
+  b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  bb:	8b 50 08             	mov    0x8(%eax),%edx
+  be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  c1:	01 c2                	add    %eax,%edx
+  c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  c6:	89 50 08             	mov    %edx,0x8(%eax)
+  ct->l += nlines(buf, n);
+  c9:	ff 75 0c             	push   0xc(%ebp)
+  cc:	68 40 12 00 00       	push   $0x1240
+  d1:	e8 2a ff ff ff       	call   0 <nlines>
+  d6:	83 c4 08             	add    $0x8,%esp
+  d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  dc:	8b 12                	mov    (%edx),%edx
+  de:	01 c2                	add    %eax,%edx
+  e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  e3:	89 10                	mov    %edx,(%eax)
+  in = *inword;
+  e5:	8b 45 10             	mov    0x10(%ebp),%eax
+  e8:	8b 00                	mov    (%eax),%eax
+  ea:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  w = 0;
+  ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  for(i = 0; i < n; i++){
+  f4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  fb:	eb 3d                	jmp    13a <count+0x88>
+    sp = space[(uchar)buf[i]];
+  fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 100:	05 40 12 00 00       	add    $0x1240,%eax
+ 105:	0f b6 00             	movzbl (%eax),%eax
+ 108:	0f b6 c0             	movzbl %al,%eax
+ 10b:	0f b6 80 40 12 01 00 	movzbl 0x11240(%eax),%eax
+ 112:	0f be c0             	movsbl %al,%eax
+ 115:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    w += !sp & !in;
+ 118:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 11b:	0b 45 f8             	or     -0x8(%ebp),%eax
+ 11e:	85 c0                	test   %eax,%eax
+ 120:	0f 94 c0             	sete   %al
+ 123:	0f b6 c0             	movzbl %al,%eax
+ 126:	01 45 f4             	add    %eax,-0xc(%ebp)
+    in = !sp;
+ 129:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 12d:	0f 94 c0             	sete   %al
+ 130:	0f b6 c0             	movzbl %al,%eax
+ 133:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(i = 0; i < n; i++){
+ 136:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 13a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 13d:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 140:	7c bb                	jl     fd <count+0x4b>
+  }
+  ct->w += w;
+ 142:	8b 45 08             	mov    0x8(%ebp),%eax
+ 145:	8b 50 04             	mov    0x4(%eax),%edx
+ 148:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 14b:	01 c2                	add    %eax,%edx
+ 14d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 150:	89 50 04             	mov    %edx,0x4(%eax)
+  *inword = in;
+ 153:	8b 45 10             	mov    0x10(%ebp),%eax
+ 156:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 159:	89 10                	mov    %edx,(%eax)
+}
+ 15b:	90                   	nop
+ 15c:	c9                   	leave
+ 15d:	c3                   	ret
+
+0000015e <wc>:
+
+void
+wc(int fd, char *name)
+{
+ 15e:	55                   	push   %ebp
+ 15f:	89 e5                	mov    %esp,%ebp
+ 161:	83 ec 28             	sub    $0x28,%esp
+  int n, inword;
+  struct count ct;
+
+  ct.l = ct.w = ct.c = 0;
+ 164:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 16b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 16e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 171:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 174:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  inword = 0;
+ 177:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+ 17e:	eb 13                	jmp    193 <wc+0x35>
+    count(&ct, n, &inword);
+ 180:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 183:	50                   	push   %eax
+ 184:	ff 75 f4             	push   -0xc(%ebp)
+ 187:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 18a:	50                   	push   %eax
+ 18b:	e8 22 ff ff ff       	call   b2 <count>
+ 190:	83 c4 0c             	add    $0xc,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+ 193:	83 ec 04             	sub    $0x4,%esp
+ 196:	68 00 00 01 00       	push   $0x10000
+ 19b:	68 40 12 00 00       	push   $0x1240
+ 1a0:	ff 75 08             	push   0x8(%ebp)
+ 1a3:	e8 66 07 00 00       	call   90e <read>
+ 1a8:	83 c4 10             	add    $0x10,%esp
+ 1ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 1ae:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1b2:	7f cc                	jg     180 <wc+0x22>
+  if(n < 0){
+ 1b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1b8:	79 17                	jns    1d1 <wc+0x73>
+    printf(1, "wc: read error\n");
+ 1ba:	83 ec 08             	sub    $0x8,%esp
+ 1bd:	68 a9 0e 00 00       	push   $0xea9
+ 1c2:	6a 01                	push   $0x1
+ 1c4:	e8 29 09 00 00       	call   af2 <printf>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1cc:	e8 25 07 00 00       	call   8f6 <exit>
+  }
+  printf(1, "%d %d %d %s\n", ct.l, ct.w, ct.c, name);
+ 1d1:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 1d4:	8b 55 e8             	mov    -0x18(%ebp),%edx
+ 1d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1da:	83 ec 08             	sub    $0x8,%esp
+ 1dd:	ff 75 0c             	push   0xc(%ebp)
+ 1e0:	51                   	push   %ecx
+ 1e1:	52                   	push   %edx
+ 1e2:	50                   	push   %eax
+ 1e3:	68 b9 0e 00 00       	push   $0xeb9
+ 1e8:	6a 01                	push   $0x1
+ 1ea:	e8 03 09 00 00       	call   af2 <printf>
+ 1ef:	83 c4 20             	add    $0x20,%esp
+}
+ 1f2:	90                   	nop
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+
+000001f5 <wcrange>:
+// Count bytes [off, end) of fd with pread, so that children
+// sharing the open file do not disturb each other's offsets.
+// A word that straddles off is counted by the range before.
+void
+wcrange(int fd, int off, int end, struct count *ct)
+{
+ 1f5:	55                   	push   %ebp
+ 1f6:	89 e5                	mov    %esp,%ebp
+ 1f8:	83 ec 18             	sub    $0x18,%esp
+  int n, inword;
+  char c;
+
+  ct->l = ct->w = ct->c = 0;
+ 1fb:	8b 45 14             	mov    0x14(%ebp),%eax
+ 1fe:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+ 205:	8b 45 14             	mov    0x14(%ebp),%eax
+ 208:	8b 50 08             	mov    0x8(%eax),%edx
+ 20b:	8b 45 14             	mov    0x14(%ebp),%eax
+ 20e:	89 50 04             	mov    %edx,0x4(%eax)
+ 211:	8b 45 14             	mov    0x14(%ebp),%eax
+ 214:	8b 50 04             	mov    0x4(%eax),%edx
+ 217:	8b 45 14             	mov    0x14(%ebp),%eax
+ 21a:	89 10                	mov    %edx,(%eax)
+  inword = 0;
+ 21c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(off > 0 && pread(fd, &c, 1, off-1) == 1)
+ 223:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 227:	0f 8e 8c 00 00 00    	jle    2b9 <wcrange+0xc4>
+ 22d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 230:	83 e8 01             	sub    $0x1,%eax
+ 233:	50                   	push   %eax
+ 234:	6a 01                	push   $0x1
+ 236:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 239:	50                   	push   %eax
+ 23a:	ff 75 08             	push   0x8(%ebp)
+ 23d:	e8 74 07 00 00       	call   9b6 <pread>
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	83 f8 01             	cmp    $0x1,%eax
+ 248:	75 6f                	jne    2b9 <wcrange+0xc4>
+    inword = !space[(uchar)c];
+ 24a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 24e:	0f b6 c0             	movzbl %al,%eax
+ 251:	0f b6 80 40 12 01 00 	movzbl 0x11240(%eax),%eax
+ 258:	84 c0                	test   %al,%al
+ 25a:	0f 94 c0             	sete   %al
+ 25d:	0f b6 c0             	movzbl %al,%eax
+ 260:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(; off < end; off += n){
+ 263:	eb 54                	jmp    2b9 <wcrange+0xc4>
+    n = end - off;
+ 265:	8b 45 10             	mov    0x10(%ebp),%eax
+ 268:	2b 45 0c             	sub    0xc(%ebp),%eax
+ 26b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(n > sizeof(buf))
+ 26e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 271:	3d 00 00 01 00       	cmp    $0x10000,%eax
+ 276:	76 07                	jbe    27f <wcrange+0x8a>
+      n = sizeof(buf);
+ 278:	c7 45 f4 00 00 01 00 	movl   $0x10000,-0xc(%ebp)
+    if((n = pread(fd, buf, n, off)) <= 0)
+ 27f:	ff 75 0c             	push   0xc(%ebp)
+ 282:	ff 75 f4             	push   -0xc(%ebp)
+ 285:	68 40 12 00 00       	push   $0x1240
+ 28a:	ff 75 08             	push   0x8(%ebp)
+ 28d:	e8 24 07 00 00       	call   9b6 <pread>
+ 292:	83 c4 10             	add    $0x10,%esp
+ 295:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 298:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 29c:	7e 25                	jle    2c3 <wcrange+0xce>
+      break;
+    count(ct, n, &inword);
+ 29e:	83 ec 04             	sub    $0x4,%esp
+ 2a1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 2a4:	50                   	push   %eax
+ 2a5:	ff 75 f4             	push   -0xc(%ebp)
+ 2a8:	ff 75 14             	push   0x14(%ebp)
+ 2ab:	e8 02 fe ff ff       	call   b2 <count>
+ 2b0:	83 c4 10             	add    $0x10,%esp
+  for(; off < end; off += n){
+ 2b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2b6:	01 45 0c             	add    %eax,0xc(%ebp)
+ 2b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bc:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 2bf:	7c a4                	jl     265 <wcrange+0x70>
+  }
+}
+ 2c1:	eb 01                	jmp    2c4 <wcrange+0xcf>
+      break;
+ 2c3:	90                   	nop
+}
+ 2c4:	90                   	nop
+ 2c5:	c9                   	leave
+ 2c6:	c3                   	ret
+
+000002c7 <parwc>:
+
+void
+parwc(int fd, char *name, int nproc)
+{
+ 2c7:	55                   	push   %ebp
+ 2c8:	89 e5                	mov    %esp,%ebp
+ 2ca:	53                   	push   %ebx
+ 2cb:	83 ec 44             	sub    $0x44,%esp
+  struct stat st;
+  struct count ct, part;
+  int i, pfd[2], size;
+
+  if(fstat(fd, &st) < 0 || st.type != T_FILE){
+ 2ce:	83 ec 08             	sub    $0x8,%esp
+ 2d1:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 2d4:	50                   	push   %eax
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 71 06 00 00       	call   94e <fstat>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	78 0a                	js     2ee <parwc+0x27>
+ 2e4:	0f b7 45 dc          	movzwl -0x24(%ebp),%eax
+ 2e8:	66 83 f8 02          	cmp    $0x2,%ax
+ 2ec:	74 16                	je     304 <parwc+0x3d>
+    wc(fd, name);
+ 2ee:	83 ec 08             	sub    $0x8,%esp
+ 2f1:	ff 75 0c             	push   0xc(%ebp)
+ 2f4:	ff 75 08             	push   0x8(%ebp)
+ 2f7:	e8 62 fe ff ff       	call   15e <wc>
+ 2fc:	83 c4 10             	add    $0x10,%esp
+ 2ff:	e9 97 01 00 00       	jmp    49b <parwc+0x1d4>
+    return;
+  }
+  size = st.size;
+ 304:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 307:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(nproc > NCPU)
+ 30a:	83 7d 10 08          	cmpl   $0x8,0x10(%ebp)
+ 30e:	7e 07                	jle    317 <parwc+0x50>
+    nproc = NCPU;
+ 310:	c7 45 10 08 00 00 00 	movl   $0x8,0x10(%ebp)
+  if(pipe(pfd) < 0){
+ 317:	83 ec 0c             	sub    $0xc,%esp
+ 31a:	8d 45 bc             	lea    -0x44(%ebp),%eax
+ 31d:	50                   	push   %eax
+ 31e:	e8 e3 05 00 00       	call   906 <pipe>
+ 323:	83 c4 10             	add    $0x10,%esp
+ 326:	85 c0                	test   %eax,%eax
+ 328:	79 17                	jns    341 <parwc+0x7a>
+    printf(1, "wc: pipe failed\n");
+ 32a:	83 ec 08             	sub    $0x8,%esp
+ 32d:	68 c6 0e 00 00       	push   $0xec6
+ 332:	6a 01                	push   $0x1
+ 334:	e8 b9 07 00 00       	call   af2 <printf>
+ 339:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 33c:	e8 b5 05 00 00       	call   8f6 <exit>
+  }
+  for(i = 0; i < nproc; i++){
+ 341:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 348:	eb 76                	jmp    3c0 <parwc+0xf9>
+    if(fork() == 0){
+ 34a:	e8 9f 05 00 00       	call   8ee <fork>
+ 34f:	85 c0                	test   %eax,%eax
+ 351:	75 69                	jne    3bc <parwc+0xf5>
+      close(pfd[0]);
+ 353:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 356:	83 ec 0c             	sub    $0xc,%esp
+ 359:	50                   	push   %eax
+ 35a:	e8 bf 05 00 00       	call   91e <close>
+ 35f:	83 c4 10             	add    $0x10,%esp
+      wcrange(fd, (uint)size*i/nproc, (uint)size*(i+1)/nproc, &part);
+ 362:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 365:	83 c0 01             	add    $0x1,%eax
+ 368:	89 c2                	mov    %eax,%edx
+ 36a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 36d:	0f af c2             	imul   %edx,%eax
+ 370:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 373:	ba 00 00 00 00       	mov    $0x0,%edx
+ 378:	f7 f3                	div    %ebx
+ 37a:	89 c1                	mov    %eax,%ecx
+ 37c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 37f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 382:	0f af c2             	imul   %edx,%eax
+ 385:	8b 5d 10             	mov    0x10(%ebp),%ebx
+ 388:	ba 00 00 00 00       	mov    $0x0,%edx
+ 38d:	f7 f3                	div    %ebx
+ 38f:	89 c2                	mov    %eax,%edx
+ 391:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+ 394:	50                   	push   %eax
+ 395:	51                   	push   %ecx
+ 396:	52                   	push   %edx
+ 397:	ff 75 08             	push   0x8(%ebp)
+ 39a:	e8 56 fe ff ff       	call   1f5 <wcrange>
+ 39f:	83 c4 10             	add    $0x10,%esp
+      write(pfd[1], &part, sizeof(part));
+ 3a2:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 3a5:	83 ec 04             	sub    $0x4,%esp
+ 3a8:	6a 0c                	push   $0xc
+ 3aa:	8d 55 c4             	lea    -0x3c(%ebp),%edx
+ 3ad:	52                   	push   %edx
+ 3ae:	50                   	push   %eax
+ 3af:	e8 62 05 00 00       	call   916 <write>
+ 3b4:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 3b7:	e8 3a 05 00 00       	call   8f6 <exit>
+  for(i = 0; i < nproc; i++){
+ 3bc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 3c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c3:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 3c6:	7c 82                	jl     34a <parwc+0x83>
+    }
+  }
+  close(pfd[1]);
+ 3c8:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 3cb:	83 ec 0c             	sub    $0xc,%esp
+ 3ce:	50                   	push   %eax
+ 3cf:	e8 4a 05 00 00       	call   91e <close>
+ 3d4:	83 c4 10             	add    $0x10,%esp
+  ct.l = ct.w = ct.c = 0;
+ 3d7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+ 3de:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 3e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 3e4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 3e7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < nproc; i++){
+ 3ea:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3f1:	eb 56                	jmp    449 <parwc+0x182>
+    if(read(pfd[0], &part, sizeof(part)) != sizeof(part)){
+ 3f3:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 3f6:	83 ec 04             	sub    $0x4,%esp
+ 3f9:	6a 0c                	push   $0xc
+ 3fb:	8d 55 c4             	lea    -0x3c(%ebp),%edx
+ 3fe:	52                   	push   %edx
+ 3ff:	50                   	push   %eax
+ 400:	e8 09 05 00 00       	call   90e <read>
+ 405:	83 c4 10             	add    $0x10,%esp
+ 408:	83 f8 0c             	cmp    $0xc,%eax
+ 40b:	74 17                	je     424 <parwc+0x15d>
+      printf(1, "wc: worker failed\n");
+ 40d:	83 ec 08             	sub    $0x8,%esp
+ 410:	68 d7 0e 00 00       	push   $0xed7
+ 415:	6a 01                	push   $0x1
+ 417:	e8 d6 06 00 00       	call   af2 <printf>
+ 41c:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 41f:	e8 d2 04 00 00       	call   8f6 <exit>
+    }
+    ct.l += part.l;
+ 424:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 427:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 42a:	01 d0                	add    %edx,%eax
+ 42c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    ct.w += part.w;
+ 42f:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 432:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 435:	01 d0                	add    %edx,%eax
+ 437:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    ct.c += part.c;
+ 43a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 43d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 440:	01 d0                	add    %edx,%eax
+ 442:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for(i = 0; i < nproc; i++){
+ 445:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 449:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 44c:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 44f:	7c a2                	jl     3f3 <parwc+0x12c>
+  }
+  close(pfd[0]);
+ 451:	8b 45 bc             	mov    -0x44(%ebp),%eax
+ 454:	83 ec 0c             	sub    $0xc,%esp
+ 457:	50                   	push   %eax
+ 458:	e8 c1 04 00 00       	call   91e <close>
+ 45d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++)
+ 460:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 467:	eb 09                	jmp    472 <parwc+0x1ab>
+    wait();
+ 469:	e8 90 04 00 00       	call   8fe <wait>
+  for(i = 0; i < nproc; i++)
+ 46e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 472:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 475:	3b 45 10             	cmp    0x10(%ebp),%eax
+ 478:	7c ef                	jl     469 <parwc+0x1a2>
+  printf(1, "%d %d %d %s\n", ct.l, ct.w, ct.c, name);
+ 47a:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+ 47d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 480:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 483:	83 ec 08             	sub    $0x8,%esp
+ 486:	ff 75 0c             	push   0xc(%ebp)
+ 489:	51                   	push   %ecx
+ 48a:	52                   	push   %edx
+ 48b:	50                   	push   %eax
+ 48c:	68 b9 0e 00 00       	push   $0xeb9
+ 491:	6a 01                	push   $0x1
+ 493:	e8 5a 06 00 00       	call   af2 <printf>
+ 498:	83 c4 20             	add    $0x20,%esp
+}
+ 49b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 49e:	c9                   	leave
+ 49f:	c3                   	ret
+
+000004a0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 4a0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 4a4:	83 e4 f0             	and    $0xfffffff0,%esp
+ 4a7:	ff 71 fc             	push   -0x4(%ecx)
+ 4aa:	55                   	push   %ebp
+ 4ab:	89 e5                	mov    %esp,%ebp
+ 4ad:	53                   	push   %ebx
+ 4ae:	51                   	push   %ecx
+ 4af:	83 ec 10             	sub    $0x10,%esp
+ 4b2:	89 cb                	mov    %ecx,%ebx
+  int fd, i, nproc;
+  char *p;
+
+  for(p = " \r\t\n\v"; *p; p++)
+ 4b4:	c7 45 ec ea 0e 00 00 	movl   $0xeea,-0x14(%ebp)
+ 4bb:	eb 14                	jmp    4d1 <main+0x31>
+    space[(uchar)*p] = 1;
+ 4bd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4c0:	0f b6 00             	movzbl (%eax),%eax
+ 4c3:	0f b6 c0             	movzbl %al,%eax
+ 4c6:	c6 80 40 12 01 00 01 	movb   $0x1,0x11240(%eax)
+  for(p = " \r\t\n\v"; *p; p++)
+ 4cd:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+ 4d1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4d4:	0f b6 00             	movzbl (%eax),%eax
+ 4d7:	84 c0                	test   %al,%al
+ 4d9:	75 e2                	jne    4bd <main+0x1d>
+
+  nproc = 1;
+ 4db:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  for(i = 1; i < argc; i++){
+ 4e2:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 4e9:	e9 88 00 00 00       	jmp    576 <main+0xd6>
+    if(strcmp(argv[i], "-P") == 0)
+ 4ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4f1:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 4f8:	8b 43 04             	mov    0x4(%ebx),%eax
+ 4fb:	01 d0                	add    %edx,%eax
+ 4fd:	8b 00                	mov    (%eax),%eax
+ 4ff:	83 ec 08             	sub    $0x8,%esp
+ 502:	68 f0 0e 00 00       	push   $0xef0
+ 507:	50                   	push   %eax
+ 508:	e8 aa 01 00 00       	call   6b7 <strcmp>
+ 50d:	83 c4 10             	add    $0x10,%esp
+ 510:	85 c0                	test   %eax,%eax
+ 512:	75 0a                	jne    51e <main+0x7e>
+      nproc = ncpus();
+ 514:	e8 97 03 00 00       	call   8b0 <ncpus>
+ 519:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 51c:	eb 54                	jmp    572 <main+0xd2>
+    else if(strcmp(argv[i], "-j") == 0 && i+1 < argc)
+ 51e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 521:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 528:	8b 43 04             	mov    0x4(%ebx),%eax
+ 52b:	01 d0                	add    %edx,%eax
+ 52d:	8b 00                	mov    (%eax),%eax
+ 52f:	83 ec 08             	sub    $0x8,%esp
+ 532:	68 f3 0e 00 00       	push   $0xef3
+ 537:	50                   	push   %eax
+ 538:	e8 7a 01 00 00       	call   6b7 <strcmp>
+ 53d:	83 c4 10             	add    $0x10,%esp
+ 540:	85 c0                	test   %eax,%eax
+ 542:	75 3d                	jne    581 <main+0xe1>
+ 544:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 547:	83 c0 01             	add    $0x1,%eax
+ 54a:	39 03                	cmp    %eax,(%ebx)
+ 54c:	7e 33                	jle    581 <main+0xe1>
+      nproc = atoi(argv[++i]);
+ 54e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 552:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 555:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 55c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 55f:	01 d0                	add    %edx,%eax
+ 561:	8b 00                	mov    (%eax),%eax
+ 563:	83 ec 0c             	sub    $0xc,%esp
+ 566:	50                   	push   %eax
+ 567:	e8 ba 02 00 00       	call   826 <atoi>
+ 56c:	83 c4 10             	add    $0x10,%esp
+ 56f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 1; i < argc; i++){
+ 572:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 576:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 579:	3b 03                	cmp    (%ebx),%eax
+ 57b:	0f 8c 6d ff ff ff    	jl     4ee <main+0x4e>
+    else
+      break;
+  }
+
+  if(argc <= i){
+ 581:	8b 03                	mov    (%ebx),%eax
+ 583:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 586:	0f 8f c5 00 00 00    	jg     651 <main+0x1b1>
+    wc(0, "");
+ 58c:	83 ec 08             	sub    $0x8,%esp
+ 58f:	68 f6 0e 00 00       	push   $0xef6
+ 594:	6a 00                	push   $0x0
+ 596:	e8 c3 fb ff ff       	call   15e <wc>
+ 59b:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 59e:	e8 53 03 00 00       	call   8f6 <exit>
+  }
+
+  for(; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+ 5a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a6:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 5ad:	8b 43 04             	mov    0x4(%ebx),%eax
+ 5b0:	01 d0                	add    %edx,%eax
+ 5b2:	8b 00                	mov    (%eax),%eax
+ 5b4:	83 ec 08             	sub    $0x8,%esp
+ 5b7:	6a 00                	push   $0x0
+ 5b9:	50                   	push   %eax
+ 5ba:	e8 77 03 00 00       	call   936 <open>
+ 5bf:	83 c4 10             	add    $0x10,%esp
+ 5c2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 5c5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 5c9:	79 29                	jns    5f4 <main+0x154>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 5cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5ce:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 5d5:	8b 43 04             	mov    0x4(%ebx),%eax
+ 5d8:	01 d0                	add    %edx,%eax
+ 5da:	8b 00                	mov    (%eax),%eax
+ 5dc:	83 ec 04             	sub    $0x4,%esp
+ 5df:	50                   	push   %eax
+ 5e0:	68 f7 0e 00 00       	push   $0xef7
+ 5e5:	6a 01                	push   $0x1
+ 5e7:	e8 06 05 00 00       	call   af2 <printf>
+ 5ec:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 5ef:	e8 02 03 00 00       	call   8f6 <exit>
+    }
+    if(nproc > 1)
+ 5f4:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+ 5f8:	7e 25                	jle    61f <main+0x17f>
+      parwc(fd, argv[i], nproc);
+ 5fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5fd:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 604:	8b 43 04             	mov    0x4(%ebx),%eax
+ 607:	01 d0                	add    %edx,%eax
+ 609:	8b 00                	mov    (%eax),%eax
+ 60b:	83 ec 04             	sub    $0x4,%esp
+ 60e:	ff 75 f0             	push   -0x10(%ebp)
+ 611:	50                   	push   %eax
+ 612:	ff 75 e8             	push   -0x18(%ebp)
+ 615:	e8 ad fc ff ff       	call   2c7 <parwc>
+ 61a:	83 c4 10             	add    $0x10,%esp
+ 61d:	eb 20                	jmp    63f <main+0x19f>
+    else
+      wc(fd, argv[i]);
+ 61f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 622:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 629:	8b 43 04             	mov    0x4(%ebx),%eax
+ 62c:	01 d0                	add    %edx,%eax
+ 62e:	8b 00                	mov    (%eax),%eax
+ 630:	83 ec 08             	sub    $0x8,%esp
+ 633:	50                   	push   %eax
+ 634:	ff 75 e8             	push   -0x18(%ebp)
+ 637:	e8 22 fb ff ff       	call   15e <wc>
+ 63c:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 63f:	83 ec 0c             	sub    $0xc,%esp
+ 642:	ff 75 e8             	push   -0x18(%ebp)
+ 645:	e8 d4 02 00 00       	call   91e <close>
+ 64a:	83 c4 10             	add    $0x10,%esp
+  for(; i < argc; i++){
+ 64d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 651:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 654:	3b 03                	cmp    (%ebx),%eax
+ 656:	0f 8c 47 ff ff ff    	jl     5a3 <main+0x103>
+  }
+  exit();
+ 65c:	e8 95 02 00 00       	call   8f6 <exit>
+
+00000661 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 661:	55                   	push   %ebp
+ 662:	89 e5                	mov    %esp,%ebp
+ 664:	57                   	push   %edi
+ 665:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 666:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 669:	8b 55 10             	mov    0x10(%ebp),%edx
+ 66c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 66f:	89 cb                	mov    %ecx,%ebx
+ 671:	89 df                	mov    %ebx,%edi
+ 673:	89 d1                	mov    %edx,%ecx
+ 675:	fc                   	cld
+ 676:	f3 aa                	rep stos %al,%es:(%edi)
+ 678:	89 ca                	mov    %ecx,%edx
+ 67a:	89 fb                	mov    %edi,%ebx
+ 67c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 67f:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 682:	90                   	nop
+ 683:	5b                   	pop    %ebx
+ 684:	5f                   	pop    %edi
+ 685:	5d                   	pop    %ebp
+ 686:	c3                   	ret
+
+00000687 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 687:	55                   	push   %ebp
+ 688:	89 e5                	mov    %esp,%ebp
+ 68a:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 68d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 690:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 693:	90                   	nop
+ 694:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 697:	8d 42 01             	lea    0x1(%edx),%eax
+ 69a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 69d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 6a3:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 6a6:	0f b6 12             	movzbl (%edx),%edx
+ 6a9:	88 10                	mov    %dl,(%eax)
+ 6ab:	0f b6 00             	movzbl (%eax),%eax
+ 6ae:	84 c0                	test   %al,%al
+ 6b0:	75 e2                	jne    694 <strcpy+0xd>
+    ;
+  return os;
+ 6b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 6b5:	c9                   	leave
+ 6b6:	c3                   	ret
+
+000006b7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 6b7:	55                   	push   %ebp
+ 6b8:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 6ba:	eb 08                	jmp    6c4 <strcmp+0xd>
+    p++, q++;
+ 6bc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 6c0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 6c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c7:	0f b6 00             	movzbl (%eax),%eax
+ 6ca:	84 c0                	test   %al,%al
+ 6cc:	74 10                	je     6de <strcmp+0x27>
+ 6ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d1:	0f b6 10             	movzbl (%eax),%edx
+ 6d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6d7:	0f b6 00             	movzbl (%eax),%eax
+ 6da:	38 c2                	cmp    %al,%dl
+ 6dc:	74 de                	je     6bc <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 6de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e1:	0f b6 00             	movzbl (%eax),%eax
+ 6e4:	0f b6 d0             	movzbl %al,%edx
+ 6e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6ea:	0f b6 00             	movzbl (%eax),%eax
+ 6ed:	0f b6 c0             	movzbl %al,%eax
+ 6f0:	29 c2                	sub    %eax,%edx
+ 6f2:	89 d0                	mov    %edx,%eax
+}
+ 6f4:	5d                   	pop    %ebp
+ 6f5:	c3                   	ret
+
+000006f6 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 6f6:	55                   	push   %ebp
+ 6f7:	89 e5                	mov    %esp,%ebp
+ 6f9:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 6fc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 703:	eb 04                	jmp    709 <strlen+0x13>
+ 705:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 709:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 70c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70f:	01 d0                	add    %edx,%eax
+ 711:	0f b6 00             	movzbl (%eax),%eax
+ 714:	84 c0                	test   %al,%al
+ 716:	75 ed                	jne    705 <strlen+0xf>
+    ;
+  return n;
+ 718:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 71b:	c9                   	leave
+ 71c:	c3                   	ret
+
+0000071d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 71d:	55                   	push   %ebp
+ 71e:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 720:	8b 45 10             	mov    0x10(%ebp),%eax
+ 723:	50                   	push   %eax
+ 724:	ff 75 0c             	push   0xc(%ebp)
+ 727:	ff 75 08             	push   0x8(%ebp)
+ 72a:	e8 32 ff ff ff       	call   661 <stosb>
+ 72f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 732:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 735:	c9                   	leave
+ 736:	c3                   	ret
+
+00000737 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 737:	55                   	push   %ebp
+ 738:	89 e5                	mov    %esp,%ebp
+ 73a:	83 ec 04             	sub    $0x4,%esp
+ 73d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 740:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 743:	eb 14                	jmp    759 <strchr+0x22>
+    if(*s == c)
+ 745:	8b 45 08             	mov    0x8(%ebp),%eax
+ 748:	0f b6 00             	movzbl (%eax),%eax
+ 74b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 74e:	75 05                	jne    755 <strchr+0x1e>
+      return (char*)s;
+ 750:	8b 45 08             	mov    0x8(%ebp),%eax
+ 753:	eb 13                	jmp    768 <strchr+0x31>
+  for(; *s; s++)
+ 755:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 759:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75c:	0f b6 00             	movzbl (%eax),%eax
+ 75f:	84 c0                	test   %al,%al
+ 761:	75 e2                	jne    745 <strchr+0xe>
+  return 0;
+ 763:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 768:	c9                   	leave
+ 769:	c3                   	ret
+
+0000076a <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 76a:	55                   	push   %ebp
+ 76b:	89 e5                	mov    %esp,%ebp
+ 76d:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 770:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 777:	eb 42                	jmp    7bb <gets+0x51>
+    cc = read(0, &c, 1);
+ 779:	83 ec 04             	sub    $0x4,%esp
+ 77c:	6a 01                	push   $0x1
+ 77e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 781:	50                   	push   %eax
+ 782:	6a 00                	push   $0x0
+ 784:	e8 85 01 00 00       	call   90e <read>
+ 789:	83 c4 10             	add    $0x10,%esp
+ 78c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 78f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 793:	7e 33                	jle    7c8 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 798:	8d 50 01             	lea    0x1(%eax),%edx
+ 79b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 79e:	89 c2                	mov    %eax,%edx
+ 7a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a3:	01 c2                	add    %eax,%edx
+ 7a5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 7a9:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 7ab:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 7af:	3c 0a                	cmp    $0xa,%al
+ 7b1:	74 16                	je     7c9 <gets+0x5f>
+ 7b3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 7b7:	3c 0d                	cmp    $0xd,%al
+ 7b9:	74 0e                	je     7c9 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 7bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7be:	83 c0 01             	add    $0x1,%eax
+ 7c1:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 7c4:	7f b3                	jg     779 <gets+0xf>
+ 7c6:	eb 01                	jmp    7c9 <gets+0x5f>
+      break;
+ 7c8:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 7c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 7cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cf:	01 d0                	add    %edx,%eax
+ 7d1:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 7d4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 7d7:	c9                   	leave
+ 7d8:	c3                   	ret
+
+000007d9 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 7d9:	55                   	push   %ebp
+ 7da:	89 e5                	mov    %esp,%ebp
+ 7dc:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 7df:	83 ec 08             	sub    $0x8,%esp
+ 7e2:	6a 00                	push   $0x0
+ 7e4:	ff 75 08             	push   0x8(%ebp)
+ 7e7:	e8 4a 01 00 00       	call   936 <open>
+ 7ec:	83 c4 10             	add    $0x10,%esp
+ 7ef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 7f2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7f6:	79 07                	jns    7ff <stat+0x26>
+    return -1;
+ 7f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7fd:	eb 25                	jmp    824 <stat+0x4b>
+  r = fstat(fd, st);
+ 7ff:	83 ec 08             	sub    $0x8,%esp
+ 802:	ff 75 0c             	push   0xc(%ebp)
+ 805:	ff 75 f4             	push   -0xc(%ebp)
+ 808:	e8 41 01 00 00       	call   94e <fstat>
+ 80d:	83 c4 10             	add    $0x10,%esp
+ 810:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	ff 75 f4             	push   -0xc(%ebp)
+ 819:	e8 00 01 00 00       	call   91e <close>
+ 81e:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 821:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 824:	c9                   	leave
+ 825:	c3                   	ret
+
+00000826 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 826:	55                   	push   %ebp
+ 827:	89 e5                	mov    %esp,%ebp
+ 829:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 82c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 833:	eb 25                	jmp    85a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 835:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 838:	89 d0                	mov    %edx,%eax
+ 83a:	c1 e0 02             	shl    $0x2,%eax
+ 83d:	01 d0                	add    %edx,%eax
+ 83f:	01 c0                	add    %eax,%eax
+ 841:	89 c1                	mov    %eax,%ecx
+ 843:	8b 45 08             	mov    0x8(%ebp),%eax
+ 846:	8d 50 01             	lea    0x1(%eax),%edx
+ 849:	89 55 08             	mov    %edx,0x8(%ebp)
+ 84c:	0f b6 00             	movzbl (%eax),%eax
+ 84f:	0f be c0             	movsbl %al,%eax
+ 852:	01 c8                	add    %ecx,%eax
+ 854:	83 e8 30             	sub    $0x30,%eax
+ 857:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 85a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 85d:	0f b6 00             	movzbl (%eax),%eax
+ 860:	3c 2f                	cmp    $0x2f,%al
+ 862:	7e 0a                	jle    86e <atoi+0x48>
+ 864:	8b 45 08             	mov    0x8(%ebp),%eax
+ 867:	0f b6 00             	movzbl (%eax),%eax
+ 86a:	3c 39                	cmp    $0x39,%al
+ 86c:	7e c7                	jle    835 <atoi+0xf>
+  return n;
+ 86e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 871:	c9                   	leave
+ 872:	c3                   	ret
+
+00000873 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 873:	55                   	push   %ebp
+ 874:	89 e5                	mov    %esp,%ebp
+ 876:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 879:	8b 45 08             	mov    0x8(%ebp),%eax
+ 87c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 87f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 882:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 885:	eb 17                	jmp    89e <memmove+0x2b>
+    *dst++ = *src++;
+ 887:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 88a:	8d 42 01             	lea    0x1(%edx),%eax
+ 88d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 890:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 893:	8d 48 01             	lea    0x1(%eax),%ecx
+ 896:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 899:	0f b6 12             	movzbl (%edx),%edx
+ 89c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 89e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 8a1:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 8a4:	89 55 10             	mov    %edx,0x10(%ebp)
+ 8a7:	85 c0                	test   %eax,%eax
+ 8a9:	7f dc                	jg     887 <memmove+0x14>
+  return vdst;
+ 8ab:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 8ae:	c9                   	leave
+ 8af:	c3                   	ret
+
+000008b0 <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 8b6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 8bd:	eb 04                	jmp    8c3 <ncpus+0x13>
+ 8bf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 8c3:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 8c7:	7f 16                	jg     8df <ncpus+0x2f>
+ 8c9:	83 ec 08             	sub    $0x8,%esp
+ 8cc:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 8cf:	50                   	push   %eax
+ 8d0:	ff 75 f4             	push   -0xc(%ebp)
+ 8d3:	e8 d6 00 00 00       	call   9ae <intrstat>
+ 8d8:	83 c4 10             	add    $0x10,%esp
+ 8db:	85 c0                	test   %eax,%eax
+ 8dd:	74 e0                	je     8bf <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 8df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e2:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8e7:	85 c0                	test   %eax,%eax
+ 8e9:	0f 4e c2             	cmovle %edx,%eax
+}
+ 8ec:	c9                   	leave
+ 8ed:	c3                   	ret
+
+000008ee <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 8ee:	b8 01 00 00 00       	mov    $0x1,%eax
+ 8f3:	cd 40                	int    $0x40
+ 8f5:	c3                   	ret
+
+000008f6 <exit>:
+SYSCALL(exit)
+ 8f6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 8fb:	cd 40                	int    $0x40
+ 8fd:	c3                   	ret
+
+000008fe <wait>:
+SYSCALL(wait)
+ 8fe:	b8 03 00 00 00       	mov    $0x3,%eax
+ 903:	cd 40                	int    $0x40
+ 905:	c3                   	ret
+
+00000906 <pipe>:
+SYSCALL(pipe)
+ 906:	b8 04 00 00 00       	mov    $0x4,%eax
+ 90b:	cd 40                	int    $0x40
+ 90d:	c3                   	ret
+
+0000090e <read>:
+SYSCALL(read)
+ 90e:	b8 05 00 00 00       	mov    $0x5,%eax
+ 913:	cd 40                	int    $0x40
+ 915:	c3                   	ret
+
+00000916 <write>:
+SYSCALL(write)
+ 916:	b8 10 00 00 00       	mov    $0x10,%eax
+ 91b:	cd 40                	int    $0x40
+ 91d:	c3                   	ret
+
+0000091e <close>:
+SYSCALL(close)
+ 91e:	b8 15 00 00 00       	mov    $0x15,%eax
+ 923:	cd 40                	int    $0x40
+ 925:	c3                   	ret
+
+00000926 <kill>:
+SYSCALL(kill)
+ 926:	b8 06 00 00 00       	mov    $0x6,%eax
+ 92b:	cd 40                	int    $0x40
+ 92d:	c3                   	ret
+
+0000092e <exec>:
+SYSCALL(exec)
+ 92e:	b8 07 00 00 00       	mov    $0x7,%eax
+ 933:	cd 40                	int    $0x40
+ 935:	c3                   	ret
+
+00000936 <open>:
+SYSCALL(open)
+ 936:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 93b:	cd 40                	int    $0x40
+ 93d:	c3                   	ret
+
+0000093e <mknod>:
+SYSCALL(mknod)
+ 93e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 943:	cd 40                	int    $0x40
+ 945:	c3                   	ret
+
+00000946 <unlink>:
+SYSCALL(unlink)
+ 946:	b8 12 00 00 00       	mov    $0x12,%eax
+ 94b:	cd 40                	int    $0x40
+ 94d:	c3                   	ret
+
+0000094e <fstat>:
+SYSCALL(fstat)
+ 94e:	b8 08 00 00 00       	mov    $0x8,%eax
+ 953:	cd 40                	int    $0x40
+ 955:	c3                   	ret
+
+00000956 <link>:
+SYSCALL(link)
+ 956:	b8 13 00 00 00       	mov    $0x13,%eax
+ 95b:	cd 40                	int    $0x40
+ 95d:	c3                   	ret
+
+0000095e <mkdir>:
+SYSCALL(mkdir)
+ 95e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 963:	cd 40                	int    $0x40
+ 965:	c3                   	ret
+
+00000966 <chdir>:
+SYSCALL(chdir)
+ 966:	b8 09 00 00 00       	mov    $0x9,%eax
+ 96b:	cd 40                	int    $0x40
+ 96d:	c3                   	ret
+
+0000096e <dup>:
+SYSCALL(dup)
+ 96e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 973:	cd 40                	int    $0x40
+ 975:	c3                   	ret
+
+00000976 <getpid>:
+SYSCALL(getpid)
+ 976:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 97b:	cd 40                	int    $0x40
+ 97d:	c3                   	ret
+
+0000097e <sbrk>:
+SYSCALL(sbrk)
+ 97e:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 983:	cd 40                	int    $0x40
+ 985:	c3                   	ret
+
+00000986 <sleep>:
+SYSCALL(sleep)
+ 986:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 98b:	cd 40                	int    $0x40
+ 98d:	c3                   	ret
+
+0000098e <uptime>:
+SYSCALL(uptime)
+ 98e:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 993:	cd 40                	int    $0x40
+ 995:	c3                   	ret
+
+00000996 <poll>:
+SYSCALL(poll)
+ 996:	b8 16 00 00 00       	mov    $0x16,%eax
+ 99b:	cd 40                	int    $0x40
+ 99d:	c3                   	ret
+
+0000099e <fcntl>:
+SYSCALL(fcntl)
+ 99e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 9a3:	cd 40                	int    $0x40
+ 9a5:	c3                   	ret
+
+000009a6 <irqroute>:
+SYSCALL(irqroute)
+ 9a6:	b8 18 00 00 00       	mov    $0x18,%eax
+ 9ab:	cd 40                	int    $0x40
+ 9ad:	c3                   	ret
+
+000009ae <intrstat>:
+SYSCALL(intrstat)
+ 9ae:	b8 19 00 00 00       	mov    $0x19,%eax
+ 9b3:	cd 40                	int    $0x40
+ 9b5:	c3                   	ret
+
+000009b6 <pread>:
+SYSCALL(pread)
+ 9b6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 9bb:	cd 40                	int    $0x40
+ 9bd:	c3                   	ret
+
+000009be <getdents>:
+SYSCALL(getdents)
+ 9be:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 9c3:	cd 40                	int    $0x40
+ 9c5:	c3                   	ret
+
+000009c6 <fstatat>:
+SYSCALL(fstatat)
+ 9c6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 9cb:	cd 40                	int    $0x40
+ 9cd:	c3                   	ret
+
+000009ce <openat>:
+SYSCALL(openat)
+ 9ce:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 9d3:	cd 40                	int    $0x40
+ 9d5:	c3                   	ret
+
+000009d6 <unlinkat>:
+SYSCALL(unlinkat)
+ 9d6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 9db:	cd 40                	int    $0x40
+ 9dd:	c3                   	ret
+
+000009de <mkdirat>:
+SYSCALL(mkdirat)
+ 9de:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9e3:	cd 40                	int    $0x40
+ 9e5:	c3                   	ret
+
+000009e6 <linkat>:
+SYSCALL(linkat)
+ 9e6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9eb:	cd 40                	int    $0x40
+ 9ed:	c3                   	ret
+
+000009ee <exits>:
+SYSCALL(exits)
+ 9ee:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9f3:	cd 40                	int    $0x40
+ 9f5:	c3                   	ret
+
+000009f6 <waitstatus>:
+SYSCALL(waitstatus)
+ 9f6:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9fb:	cd 40                	int    $0x40
+ 9fd:	c3                   	ret
+
+000009fe <pwrite>:
+SYSCALL(pwrite)
+ 9fe:	b8 23 00 00 00       	mov    $0x23,%eax
+ a03:	cd 40                	int    $0x40
+ a05:	c3                   	ret
+
+00000a06 <lseek>:
+SYSCALL(lseek)
+ a06:	b8 24 00 00 00       	mov    $0x24,%eax
+ a0b:	cd 40                	int    $0x40
+ a0d:	c3                   	ret
+
+00000a0e <copyfilerange>:
+SYSCALL(copyfilerange)
+ a0e:	b8 25 00 00 00       	mov    $0x25,%eax
+ a13:	cd 40                	int    $0x40
+ a15:	c3                   	ret
+
+00000a16 <fsctl>:
+SYSCALL(fsctl)
+ a16:	b8 26 00 00 00       	mov    $0x26,%eax
+ a1b:	cd 40                	int    $0x40
+ a1d:	c3                   	ret
+
+00000a1e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ a1e:	55                   	push   %ebp
+ a1f:	89 e5                	mov    %esp,%ebp
+ a21:	83 ec 18             	sub    $0x18,%esp
+ a24:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a27:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ a2a:	83 ec 04             	sub    $0x4,%esp
+ a2d:	6a 01                	push   $0x1
+ a2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ a32:	50                   	push   %eax
+ a33:	ff 75 08             	push   0x8(%ebp)
+ a36:	e8 db fe ff ff       	call   916 <write>
+ a3b:	83 c4 10             	add    $0x10,%esp
+}
+ a3e:	90                   	nop
+ a3f:	c9                   	leave
+ a40:	c3                   	ret
+
+00000a41 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a41:	55                   	push   %ebp
+ a42:	89 e5                	mov    %esp,%ebp
+ a44:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ a47:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ a4e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ a52:	74 17                	je     a6b <printint+0x2a>
+ a54:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ a58:	79 11                	jns    a6b <printint+0x2a>
+    neg = 1;
+ a5a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ a61:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a64:	f7 d8                	neg    %eax
+ a66:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ a69:	eb 06                	jmp    a71 <printint+0x30>
+  } else {
+    x = xx;
+ a6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a6e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ a71:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ a78:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ a7b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ a7e:	ba 00 00 00 00       	mov    $0x0,%edx
+ a83:	f7 f1                	div    %ecx
+ a85:	89 d1                	mov    %edx,%ecx
+ a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a8a:	8d 50 01             	lea    0x1(%eax),%edx
+ a8d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ a90:	0f b6 91 20 12 00 00 	movzbl 0x1220(%ecx),%edx
+ a97:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ a9b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ a9e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ aa1:	ba 00 00 00 00       	mov    $0x0,%edx
+ aa6:	f7 f1                	div    %ecx
+ aa8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ aab:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ aaf:	75 c7                	jne    a78 <printint+0x37>
+  if(neg)
+ ab1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ab5:	74 2d                	je     ae4 <printint+0xa3>
+    buf[i++] = '-';
+ ab7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aba:	8d 50 01             	lea    0x1(%eax),%edx
+ abd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ ac0:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ ac5:	eb 1d                	jmp    ae4 <printint+0xa3>
+    putc(fd, buf[i]);
+ ac7:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ aca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ acd:	01 d0                	add    %edx,%eax
+ acf:	0f b6 00             	movzbl (%eax),%eax
+ ad2:	0f be c0             	movsbl %al,%eax
+ ad5:	83 ec 08             	sub    $0x8,%esp
+ ad8:	50                   	push   %eax
+ ad9:	ff 75 08             	push   0x8(%ebp)
+ adc:	e8 3d ff ff ff       	call   a1e <putc>
+ ae1:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ ae4:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ ae8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ aec:	79 d9                	jns    ac7 <printint+0x86>
+}
+ aee:	90                   	nop
+ aef:	90                   	nop
+ af0:	c9                   	leave
+ af1:	c3                   	ret
+
+00000af2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ af2:	55                   	push   %ebp
+ af3:	89 e5                	mov    %esp,%ebp
+ af5:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ af8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ aff:	8d 45 0c             	lea    0xc(%ebp),%eax
+ b02:	83 c0 04             	add    $0x4,%eax
+ b05:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b08:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ b0f:	e9 59 01 00 00       	jmp    c6d <printf+0x17b>
+    c = fmt[i] & 0xff;
+ b14:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b17:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b1a:	01 d0                	add    %edx,%eax
+ b1c:	0f b6 00             	movzbl (%eax),%eax
+ b1f:	0f be c0             	movsbl %al,%eax
+ b22:	25 ff 00 00 00       	and    $0xff,%eax
+ b27:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ b2a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b2e:	75 2c                	jne    b5c <printf+0x6a>
+      if(c == '%'){
+ b30:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b34:	75 0c                	jne    b42 <printf+0x50>
+        state = '%';
+ b36:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ b3d:	e9 27 01 00 00       	jmp    c69 <printf+0x177>
+      } else {
+        putc(fd, c);
+ b42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b45:	0f be c0             	movsbl %al,%eax
+ b48:	83 ec 08             	sub    $0x8,%esp
+ b4b:	50                   	push   %eax
+ b4c:	ff 75 08             	push   0x8(%ebp)
+ b4f:	e8 ca fe ff ff       	call   a1e <putc>
+ b54:	83 c4 10             	add    $0x10,%esp
+ b57:	e9 0d 01 00 00       	jmp    c69 <printf+0x177>
+      }
+    } else if(state == '%'){
+ b5c:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ b60:	0f 85 03 01 00 00    	jne    c69 <printf+0x177>
+      if(c == 'd'){
+ b66:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ b6a:	75 1e                	jne    b8a <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ b6c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b6f:	8b 00                	mov    (%eax),%eax
+ b71:	6a 01                	push   $0x1
+ b73:	6a 0a                	push   $0xa
+ b75:	50                   	push   %eax
+ b76:	ff 75 08             	push   0x8(%ebp)
+ b79:	e8 c3 fe ff ff       	call   a41 <printint>
+ b7e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ b81:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ b85:	e9 d8 00 00 00       	jmp    c62 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ b8a:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ b8e:	74 06                	je     b96 <printf+0xa4>
+ b90:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ b94:	75 1e                	jne    bb4 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ b96:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b99:	8b 00                	mov    (%eax),%eax
+ b9b:	6a 00                	push   $0x0
+ b9d:	6a 10                	push   $0x10
+ b9f:	50                   	push   %eax
+ ba0:	ff 75 08             	push   0x8(%ebp)
+ ba3:	e8 99 fe ff ff       	call   a41 <printint>
+ ba8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ bab:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ baf:	e9 ae 00 00 00       	jmp    c62 <printf+0x170>
+      } else if(c == 's'){
+ bb4:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ bb8:	75 43                	jne    bfd <printf+0x10b>
+        s = (char*)*ap;
+ bba:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bbd:	8b 00                	mov    (%eax),%eax
+ bbf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ bc2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ bc6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bca:	75 25                	jne    bf1 <printf+0xff>
+          s = "(null)";
+ bcc:	c7 45 f4 0b 0f 00 00 	movl   $0xf0b,-0xc(%ebp)
+        while(*s != 0){
+ bd3:	eb 1c                	jmp    bf1 <printf+0xff>
+          putc(fd, *s);
+ bd5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd8:	0f b6 00             	movzbl (%eax),%eax
+ bdb:	0f be c0             	movsbl %al,%eax
+ bde:	83 ec 08             	sub    $0x8,%esp
+ be1:	50                   	push   %eax
+ be2:	ff 75 08             	push   0x8(%ebp)
+ be5:	e8 34 fe ff ff       	call   a1e <putc>
+ bea:	83 c4 10             	add    $0x10,%esp
+          s++;
+ bed:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ bf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf4:	0f b6 00             	movzbl (%eax),%eax
+ bf7:	84 c0                	test   %al,%al
+ bf9:	75 da                	jne    bd5 <printf+0xe3>
+ bfb:	eb 65                	jmp    c62 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ bfd:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ c01:	75 1d                	jne    c20 <printf+0x12e>
+        putc(fd, *ap);
+ c03:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c06:	8b 00                	mov    (%eax),%eax
+ c08:	0f be c0             	movsbl %al,%eax
+ c0b:	83 ec 08             	sub    $0x8,%esp
+ c0e:	50                   	push   %eax
+ c0f:	ff 75 08             	push   0x8(%ebp)
+ c12:	e8 07 fe ff ff       	call   a1e <putc>
+ c17:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c1a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c1e:	eb 42                	jmp    c62 <printf+0x170>
+      } else if(c == '%'){
+ c20:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ c24:	75 17                	jne    c3d <printf+0x14b>
+        putc(fd, c);
+ c26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c29:	0f be c0             	movsbl %al,%eax
+ c2c:	83 ec 08             	sub    $0x8,%esp
+ c2f:	50                   	push   %eax
+ c30:	ff 75 08             	push   0x8(%ebp)
+ c33:	e8 e6 fd ff ff       	call   a1e <putc>
+ c38:	83 c4 10             	add    $0x10,%esp
+ c3b:	eb 25                	jmp    c62 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ c3d:	83 ec 08             	sub    $0x8,%esp
+ c40:	6a 25                	push   $0x25
+ c42:	ff 75 08             	push   0x8(%ebp)
+ c45:	e8 d4 fd ff ff       	call   a1e <putc>
+ c4a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ c4d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c50:	0f be c0             	movsbl %al,%eax
+ c53:	83 ec 08             	sub    $0x8,%esp
+ c56:	50                   	push   %eax
+ c57:	ff 75 08             	push   0x8(%ebp)
+ c5a:	e8 bf fd ff ff       	call   a1e <putc>
+ c5f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ c62:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ c69:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ c6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c70:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c73:	01 d0                	add    %edx,%eax
+ c75:	0f b6 00             	movzbl (%eax),%eax
+ c78:	84 c0                	test   %al,%al
+ c7a:	0f 85 94 fe ff ff    	jne    b14 <printf+0x22>
+    }
+  }
+}
+ c80:	90                   	nop
+ c81:	90                   	nop
+ c82:	c9                   	leave
+ c83:	c3                   	ret
+
+00000c84 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c84:	55                   	push   %ebp
+ c85:	89 e5                	mov    %esp,%ebp
+ c87:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ c8a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8d:	83 e8 08             	sub    $0x8,%eax
+ c90:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c93:	a1 48 13 01 00       	mov    0x11348,%eax
+ c98:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c9b:	eb 24                	jmp    cc1 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c9d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ca0:	8b 00                	mov    (%eax),%eax
+ ca2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ca5:	72 12                	jb     cb9 <free+0x35>
+ ca7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ caa:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ cad:	72 24                	jb     cd3 <free+0x4f>
+ caf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb2:	8b 00                	mov    (%eax),%eax
+ cb4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ cb7:	72 1a                	jb     cd3 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cb9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cbc:	8b 00                	mov    (%eax),%eax
+ cbe:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ cc1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cc4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ cc7:	73 d4                	jae    c9d <free+0x19>
+ cc9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ccc:	8b 00                	mov    (%eax),%eax
+ cce:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ cd1:	73 ca                	jae    c9d <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cd3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cd6:	8b 40 04             	mov    0x4(%eax),%eax
+ cd9:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ce0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ce3:	01 c2                	add    %eax,%edx
+ ce5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ce8:	8b 00                	mov    (%eax),%eax
+ cea:	39 c2                	cmp    %eax,%edx
+ cec:	75 24                	jne    d12 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ cee:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cf1:	8b 50 04             	mov    0x4(%eax),%edx
+ cf4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cf7:	8b 00                	mov    (%eax),%eax
+ cf9:	8b 40 04             	mov    0x4(%eax),%eax
+ cfc:	01 c2                	add    %eax,%edx
+ cfe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d01:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d04:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d07:	8b 00                	mov    (%eax),%eax
+ d09:	8b 10                	mov    (%eax),%edx
+ d0b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d0e:	89 10                	mov    %edx,(%eax)
+ d10:	eb 0a                	jmp    d1c <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ d12:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d15:	8b 10                	mov    (%eax),%edx
+ d17:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d1a:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ d1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d1f:	8b 40 04             	mov    0x4(%eax),%eax
+ d22:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d2c:	01 d0                	add    %edx,%eax
+ d2e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d31:	75 20                	jne    d53 <free+0xcf>
+    p->s.size += bp->s.size;
+ d33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d36:	8b 50 04             	mov    0x4(%eax),%edx
+ d39:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d3c:	8b 40 04             	mov    0x4(%eax),%eax
+ d3f:	01 c2                	add    %eax,%edx
+ d41:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d44:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ d47:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d4a:	8b 10                	mov    (%eax),%edx
+ d4c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d4f:	89 10                	mov    %edx,(%eax)
+ d51:	eb 08                	jmp    d5b <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ d53:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d56:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ d59:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ d5b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d5e:	a3 48 13 01 00       	mov    %eax,0x11348
+}
+ d63:	90                   	nop
+ d64:	c9                   	leave
+ d65:	c3                   	ret
+
+00000d66 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ d66:	55                   	push   %ebp
+ d67:	89 e5                	mov    %esp,%ebp
+ d69:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ d6c:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d73:	77 07                	ja     d7c <morecore+0x16>
+    nu = 4096;
+ d75:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d7f:	c1 e0 03             	shl    $0x3,%eax
+ d82:	83 ec 0c             	sub    $0xc,%esp
+ d85:	50                   	push   %eax
+ d86:	e8 f3 fb ff ff       	call   97e <sbrk>
+ d8b:	83 c4 10             	add    $0x10,%esp
+ d8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d91:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d95:	75 07                	jne    d9e <morecore+0x38>
+    return 0;
+ d97:	b8 00 00 00 00       	mov    $0x0,%eax
+ d9c:	eb 26                	jmp    dc4 <morecore+0x5e>
+  hp = (Header*)p;
+ d9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ da1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ da4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ da7:	8b 55 08             	mov    0x8(%ebp),%edx
+ daa:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ dad:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ db0:	83 c0 08             	add    $0x8,%eax
+ db3:	83 ec 0c             	sub    $0xc,%esp
+ db6:	50                   	push   %eax
+ db7:	e8 c8 fe ff ff       	call   c84 <free>
+ dbc:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ dbf:	a1 48 13 01 00       	mov    0x11348,%eax
+}
+ dc4:	c9                   	leave
+ dc5:	c3                   	ret
+
+00000dc6 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ dc6:	55                   	push   %ebp
+ dc7:	89 e5                	mov    %esp,%ebp
+ dc9:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+ dcf:	83 c0 07             	add    $0x7,%eax
+ dd2:	c1 e8 03             	shr    $0x3,%eax
+ dd5:	83 c0 01             	add    $0x1,%eax
+ dd8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ ddb:	a1 48 13 01 00       	mov    0x11348,%eax
+ de0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ de3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ de7:	75 23                	jne    e0c <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ de9:	c7 45 f0 40 13 01 00 	movl   $0x11340,-0x10(%ebp)
+ df0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ df3:	a3 48 13 01 00       	mov    %eax,0x11348
+ df8:	a1 48 13 01 00       	mov    0x11348,%eax
+ dfd:	a3 40 13 01 00       	mov    %eax,0x11340
+    base.s.size = 0;
+ e02:	c7 05 44 13 01 00 00 	movl   $0x0,0x11344
+ e09:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e0c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e0f:	8b 00                	mov    (%eax),%eax
+ e11:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e17:	8b 40 04             	mov    0x4(%eax),%eax
+ e1a:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ e1d:	72 4d                	jb     e6c <malloc+0xa6>
+      if(p->s.size == nunits)
+ e1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e22:	8b 40 04             	mov    0x4(%eax),%eax
+ e25:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ e28:	75 0c                	jne    e36 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ e2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e2d:	8b 10                	mov    (%eax),%edx
+ e2f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e32:	89 10                	mov    %edx,(%eax)
+ e34:	eb 26                	jmp    e5c <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ e36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e39:	8b 40 04             	mov    0x4(%eax),%eax
+ e3c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ e3f:	89 c2                	mov    %eax,%edx
+ e41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e44:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ e47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e4a:	8b 40 04             	mov    0x4(%eax),%eax
+ e4d:	c1 e0 03             	shl    $0x3,%eax
+ e50:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ e53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e56:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ e59:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ e5c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e5f:	a3 48 13 01 00       	mov    %eax,0x11348
+      return (void*)(p + 1);
+ e64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e67:	83 c0 08             	add    $0x8,%eax
+ e6a:	eb 3b                	jmp    ea7 <malloc+0xe1>
+    }
+    if(p == freep)
+ e6c:	a1 48 13 01 00       	mov    0x11348,%eax
+ e71:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e74:	75 1e                	jne    e94 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ e76:	83 ec 0c             	sub    $0xc,%esp
+ e79:	ff 75 ec             	push   -0x14(%ebp)
+ e7c:	e8 e5 fe ff ff       	call   d66 <morecore>
+ e81:	83 c4 10             	add    $0x10,%esp
+ e84:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e87:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e8b:	75 07                	jne    e94 <malloc+0xce>
+        return 0;
+ e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+ e92:	eb 13                	jmp    ea7 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e97:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e9d:	8b 00                	mov    (%eax),%eax
+ e9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ea2:	e9 6d ff ff ff       	jmp    e14 <malloc+0x4e>
+  }
+}
+ ea7:	c9                   	leave
+ ea8:	c3                   	ret
@@ -1,53 +1,179 @@
+// Count lines, words and bytes.
+//   wc [-j n | -P] [file ...]
+// -j n splits each file into n ranges counted by n child
+// processes; -P uses one per CPU.
+
 #include "types.h"
 #include "stat.h"
+#include "param.h"
 #include "user.h"
 
-char buf[512];
+char buf[64*1024];
+
+// space[c] is 1 for the characters that separate words.
+char space[256];
+
+struct count {
+  int l, w, c;
+};
+
+// Number of '\n' bytes in [p, p+n), four at a time.
+int
+nlines(char *p, int n)
+{
+  uint x, y;
+  int l;
+
+  l = 0;
+  for(; n > 0 && ((uint)p & 3) != 0; n--)
+    l += *p++ == '\n';
+  for(; n >= 4; n -= 4, p += 4){
+    x = *(uint*)p ^ 0x0a0a0a0a;
+    // 0x80 in each byte of y where x is zero.
+    y = ~(((x & 0x7f7f7f7f) + 0x7f7f7f7f) | x | 0x7f7f7f7f);
+    l += (y >> 7) * 0x01010101 >> 24;
+  }
+  for(; n > 0; n--)
+    l += *p++ == '\n';
+  return l;
+}
+
+// Add the counts for n bytes of buf to ct.  inword carries
+// across calls: was the byte before buf part of a word?
+void
+count(struct count *ct, int n, int *inword)
+{
+  int i, in, w, sp;
+
+  ct->c += n;
+  ct->l += nlines(buf, n);
+  in = *inword;
+  w = 0;
+  for(i = 0; i < n; i++){
+    sp = space[(uchar)buf[i]];
+    w += !sp & !in;
+    in = !sp;
+  }
+  ct->w += w;
+  *inword = in;
+}
 
 void
 wc(int fd, char *name)
 {
-  int i, n;
-  int l, w, c, inword;
+  int n, inword;
+  struct count ct;
 
-  l = w = c = 0;
+  ct.l = ct.w = ct.c = 0;
   inword = 0;
-  while((n = read(fd, buf, sizeof(buf))) > 0){
-    for(i=0; i<n; i++){
-      c++;
-      if(buf[i] == '\n')
-        l++;
-      if(strchr(" \r\t\n\v", buf[i]))
-        inword = 0;
-      else if(!inword){
-        w++;
-        inword = 1;
-      }
-    }
-  }
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    count(&ct, n, &inword);
   if(n < 0){
     printf(1, "wc: read error\n");
     exit();
   }
-  printf(1, "%d %d %d %s\n", l, w, c, name);
+  printf(1, "%d %d %d %s\n", ct.l, ct.w, ct.c, name);
+}
+
+// Count bytes [off, end) of fd with pread, so that children
+// sharing the open file do not disturb each other's offsets.
+// A word that straddles off is counted by the range before.
+void
+wcrange(int fd, int off, int end, struct count *ct)
+{
+  int n, inword;
+  char c;
+
+  ct->l = ct->w = ct->c = 0;
+  inword = 0;
+  if(off > 0 && pread(fd, &c, 1, off-1) == 1)
+    inword = !space[(uchar)c];
+  for(; off < end; off += n){
+    n = end - off;
+    if(n > sizeof(buf))
+      n = sizeof(buf);
+    if((n = pread(fd, buf, n, off)) <= 0)
+      break;
+    count(ct, n, &inword);
+  }
+}
+
+void
+parwc(int fd, char *name, int nproc)
+{
+  struct stat st;
+  struct count ct, part;
+  int i, pfd[2], size;
+
+  if(fstat(fd, &st) < 0 || st.type != T_FILE){
+    wc(fd, name);
+    return;
+  }
+  size = st.size;
+  if(nproc > NCPU)
+    nproc = NCPU;
+  if(pipe(pfd) < 0){
+    printf(1, "wc: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < nproc; i++){
+    if(fork() == 0){
+      close(pfd[0]);
+      wcrange(fd, (uint)size*i/nproc, (uint)size*(i+1)/nproc, &part);
+      write(pfd[1], &part, sizeof(part));
+      exit();
+    }
+  }
+  close(pfd[1]);
+  ct.l = ct.w = ct.c = 0;
+  for(i = 0; i < nproc; i++){
+    if(read(pfd[0], &part, sizeof(part)) != sizeof(part)){
+      printf(1, "wc: worker failed\n");
+      exit();
+    }
+    ct.l += part.l;
+    ct.w += part.w;
+    ct.c += part.c;
+  }
+  close(pfd[0]);
+  for(i = 0; i < nproc; i++)
+    wait();
+  printf(1, "%d %d %d %s\n", ct.l, ct.w, ct.c, name);
 }
 
 int
 main(int argc, char *argv[])
 {
-  int fd, i;
+  int fd, i, nproc;
+  char *p;
 
-  if(argc <= 1){
+  for(p = " \r\t\n\v"; *p; p++)
+    space[(uchar)*p] = 1;
+
+  nproc = 1;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-P") == 0)
+      nproc = ncpus();
+    else if(strcmp(argv[i], "-j") == 0 && i+1 < argc)
+      nproc = atoi(argv[++i]);
+    else
+      break;
+  }
+
+  if(argc <= i){
     wc(0, "");
     exit();
   }
 
-  for(i = 1; i < argc; i++){
+  for(; i < argc; i++){
     if((fd = open(argv[i], 0)) < 0){
       printf(1, "wc: cannot open %s\n", argv[i]);
       exit();
     }
-    wc(fd, argv[i]);
+    if(nproc > 1)
+      parwc(fd, argv[i], nproc);
+    else
+      wc(fd, argv[i]);
     close(fd);
   }
   exit();
@@ -108,6 +108,16 @@ readeflags(void)
   return eflags;
 }
 
+// Low 32 bits of the time-stamp counter.  Enough to time
+// intervals shorter than a second or so.
+static inline uint
+rdtsc(void)
+{
+  uint lo;
+  asm volatile("rdtsc" : "=a" (lo) : : "edx");
+  return lo;
+}
+
 static inline void
 loadgs(ushort v)
 {
@@ -131,6 +141,21 @@ sti(void)
   asm volatile("sti");
 }
 
+// Enable interrupts and wait for one.  sti takes effect only
+// after the following instruction, so an interrupt already
+// pending when interrupts were off still ends the hlt.
+static inline void
+stihlt(void)
+{
+  asm volatile("sti; hlt");
+}
+
+static inline void
+invlpg(void *va)
+{
+  asm volatile("invlpg (%0)" : : "r" (va) : "memory");
+}
+
 // "xchg src, dest"の場合にはsrcとdestを交換する
 // オペランドの1つがメモリアドレスの場合には、操作はLOCKプリフィックスが指定される(ここではすでに指定されているが...)のでパフォーマンス低下となる
 static inline uint
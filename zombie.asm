@@ -0,0 +1,1234 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 a3 02 00 00       	call   2b9 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 2d 03 00 00       	call   351 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 95 02 00 00       	call   2c1 <exit>
+
+0000002c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <strcpy>:
+#include "intr.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  58:	8b 45 08             	mov    0x8(%ebp),%eax
+  5b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  5e:	90                   	nop
+  5f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  62:	8d 42 01             	lea    0x1(%edx),%eax
+  65:	89 45 0c             	mov    %eax,0xc(%ebp)
+  68:	8b 45 08             	mov    0x8(%ebp),%eax
+  6b:	8d 48 01             	lea    0x1(%eax),%ecx
+  6e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  71:	0f b6 12             	movzbl (%edx),%edx
+  74:	88 10                	mov    %dl,(%eax)
+  76:	0f b6 00             	movzbl (%eax),%eax
+  79:	84 c0                	test   %al,%al
+  7b:	75 e2                	jne    5f <strcpy+0xd>
+    ;
+  return os;
+  7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  80:	c9                   	leave
+  81:	c3                   	ret
+
+00000082 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  82:	55                   	push   %ebp
+  83:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  85:	eb 08                	jmp    8f <strcmp+0xd>
+    p++, q++;
+  87:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  8b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  92:	0f b6 00             	movzbl (%eax),%eax
+  95:	84 c0                	test   %al,%al
+  97:	74 10                	je     a9 <strcmp+0x27>
+  99:	8b 45 08             	mov    0x8(%ebp),%eax
+  9c:	0f b6 10             	movzbl (%eax),%edx
+  9f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a2:	0f b6 00             	movzbl (%eax),%eax
+  a5:	38 c2                	cmp    %al,%dl
+  a7:	74 de                	je     87 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  ac:	0f b6 00             	movzbl (%eax),%eax
+  af:	0f b6 d0             	movzbl %al,%edx
+  b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b5:	0f b6 00             	movzbl (%eax),%eax
+  b8:	0f b6 c0             	movzbl %al,%eax
+  bb:	29 c2                	sub    %eax,%edx
+  bd:	89 d0                	mov    %edx,%eax
+}
+  bf:	5d                   	pop    %ebp
+  c0:	c3                   	ret
+
+000000c1 <strlen>:
+
+uint
+strlen(char *s)
+{
+  c1:	55                   	push   %ebp
+  c2:	89 e5                	mov    %esp,%ebp
+  c4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  ce:	eb 04                	jmp    d4 <strlen+0x13>
+  d0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  d4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  da:	01 d0                	add    %edx,%eax
+  dc:	0f b6 00             	movzbl (%eax),%eax
+  df:	84 c0                	test   %al,%al
+  e1:	75 ed                	jne    d0 <strlen+0xf>
+    ;
+  return n;
+  e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+000000e8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  e8:	55                   	push   %ebp
+  e9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+  eb:	8b 45 10             	mov    0x10(%ebp),%eax
+  ee:	50                   	push   %eax
+  ef:	ff 75 0c             	push   0xc(%ebp)
+  f2:	ff 75 08             	push   0x8(%ebp)
+  f5:	e8 32 ff ff ff       	call   2c <stosb>
+  fa:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+  fd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 100:	c9                   	leave
+ 101:	c3                   	ret
+
+00000102 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 102:	55                   	push   %ebp
+ 103:	89 e5                	mov    %esp,%ebp
+ 105:	83 ec 04             	sub    $0x4,%esp
+ 108:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10b:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 10e:	eb 14                	jmp    124 <strchr+0x22>
+    if(*s == c)
+ 110:	8b 45 08             	mov    0x8(%ebp),%eax
+ 113:	0f b6 00             	movzbl (%eax),%eax
+ 116:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 119:	75 05                	jne    120 <strchr+0x1e>
+      return (char*)s;
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	eb 13                	jmp    133 <strchr+0x31>
+  for(; *s; s++)
+ 120:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	0f b6 00             	movzbl (%eax),%eax
+ 12a:	84 c0                	test   %al,%al
+ 12c:	75 e2                	jne    110 <strchr+0xe>
+  return 0;
+ 12e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+
+00000135 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 13b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 142:	eb 42                	jmp    186 <gets+0x51>
+    cc = read(0, &c, 1);
+ 144:	83 ec 04             	sub    $0x4,%esp
+ 147:	6a 01                	push   $0x1
+ 149:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 14c:	50                   	push   %eax
+ 14d:	6a 00                	push   $0x0
+ 14f:	e8 85 01 00 00       	call   2d9 <read>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 15a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 15e:	7e 33                	jle    193 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 160:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 163:	8d 50 01             	lea    0x1(%eax),%edx
+ 166:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 169:	89 c2                	mov    %eax,%edx
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	01 c2                	add    %eax,%edx
+ 170:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 174:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 176:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 17a:	3c 0a                	cmp    $0xa,%al
+ 17c:	74 16                	je     194 <gets+0x5f>
+ 17e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 182:	3c 0d                	cmp    $0xd,%al
+ 184:	74 0e                	je     194 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 189:	83 c0 01             	add    $0x1,%eax
+ 18c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 18f:	7f b3                	jg     144 <gets+0xf>
+ 191:	eb 01                	jmp    194 <gets+0x5f>
+      break;
+ 193:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 194:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19a:	01 d0                	add    %edx,%eax
+ 19c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 19f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1a2:	c9                   	leave
+ 1a3:	c3                   	ret
+
+000001a4 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1a4:	55                   	push   %ebp
+ 1a5:	89 e5                	mov    %esp,%ebp
+ 1a7:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1aa:	83 ec 08             	sub    $0x8,%esp
+ 1ad:	6a 00                	push   $0x0
+ 1af:	ff 75 08             	push   0x8(%ebp)
+ 1b2:	e8 4a 01 00 00       	call   301 <open>
+ 1b7:	83 c4 10             	add    $0x10,%esp
+ 1ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 1bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 1c1:	79 07                	jns    1ca <stat+0x26>
+    return -1;
+ 1c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 1c8:	eb 25                	jmp    1ef <stat+0x4b>
+  r = fstat(fd, st);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	ff 75 0c             	push   0xc(%ebp)
+ 1d0:	ff 75 f4             	push   -0xc(%ebp)
+ 1d3:	e8 41 01 00 00       	call   319 <fstat>
+ 1d8:	83 c4 10             	add    $0x10,%esp
+ 1db:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 1de:	83 ec 0c             	sub    $0xc,%esp
+ 1e1:	ff 75 f4             	push   -0xc(%ebp)
+ 1e4:	e8 00 01 00 00       	call   2e9 <close>
+ 1e9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 1ec:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 1f7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 1fe:	eb 25                	jmp    225 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 200:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 203:	89 d0                	mov    %edx,%eax
+ 205:	c1 e0 02             	shl    $0x2,%eax
+ 208:	01 d0                	add    %edx,%eax
+ 20a:	01 c0                	add    %eax,%eax
+ 20c:	89 c1                	mov    %eax,%ecx
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	8d 50 01             	lea    0x1(%eax),%edx
+ 214:	89 55 08             	mov    %edx,0x8(%ebp)
+ 217:	0f b6 00             	movzbl (%eax),%eax
+ 21a:	0f be c0             	movsbl %al,%eax
+ 21d:	01 c8                	add    %ecx,%eax
+ 21f:	83 e8 30             	sub    $0x30,%eax
+ 222:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 225:	8b 45 08             	mov    0x8(%ebp),%eax
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	3c 2f                	cmp    $0x2f,%al
+ 22d:	7e 0a                	jle    239 <atoi+0x48>
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	0f b6 00             	movzbl (%eax),%eax
+ 235:	3c 39                	cmp    $0x39,%al
+ 237:	7e c7                	jle    200 <atoi+0xf>
+  return n;
+ 239:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 23c:	c9                   	leave
+ 23d:	c3                   	ret
+
+0000023e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 244:	8b 45 08             	mov    0x8(%ebp),%eax
+ 247:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 250:	eb 17                	jmp    269 <memmove+0x2b>
+    *dst++ = *src++;
+ 252:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 255:	8d 42 01             	lea    0x1(%edx),%eax
+ 258:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 25b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 25e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 261:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 264:	0f b6 12             	movzbl (%edx),%edx
+ 267:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 269:	8b 45 10             	mov    0x10(%ebp),%eax
+ 26c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 26f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 272:	85 c0                	test   %eax,%eax
+ 274:	7f dc                	jg     252 <memmove+0x14>
+  return vdst;
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 279:	c9                   	leave
+ 27a:	c3                   	ret
+
+0000027b <ncpus>:
+
+// Number of CPUs running, for programs that fork one worker
+// per CPU.
+int
+ncpus(void)
+{
+ 27b:	55                   	push   %ebp
+ 27c:	89 e5                	mov    %esp,%ebp
+ 27e:	83 ec 78             	sub    $0x78,%esp
+  struct intrstat st;
+  int n;
+
+  for(n = 0; n < NCPU && intrstat(n, &st) == 0; n++)
+ 281:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 288:	eb 04                	jmp    28e <ncpus+0x13>
+ 28a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 28e:	83 7d f4 07          	cmpl   $0x7,-0xc(%ebp)
+ 292:	7f 16                	jg     2aa <ncpus+0x2f>
+ 294:	83 ec 08             	sub    $0x8,%esp
+ 297:	8d 45 8c             	lea    -0x74(%ebp),%eax
+ 29a:	50                   	push   %eax
+ 29b:	ff 75 f4             	push   -0xc(%ebp)
+ 29e:	e8 d6 00 00 00       	call   379 <intrstat>
+ 2a3:	83 c4 10             	add    $0x10,%esp
+ 2a6:	85 c0                	test   %eax,%eax
+ 2a8:	74 e0                	je     28a <ncpus+0xf>
+    ;
+  return n > 0 ? n : 1;
+ 2aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2ad:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2b2:	85 c0                	test   %eax,%eax
+ 2b4:	0f 4e c2             	cmovle %edx,%eax
+}
+ 2b7:	c9                   	leave
+ 2b8:	c3                   	ret
+
+000002b9 <fork>:
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+# syscall.hに$SYS_fork, $SYS_exit等の番号は定義されている
+SYSCALL(fork)
+ 2b9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2be:	cd 40                	int    $0x40
+ 2c0:	c3                   	ret
+
+000002c1 <exit>:
+SYSCALL(exit)
+ 2c1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2c6:	cd 40                	int    $0x40
+ 2c8:	c3                   	ret
+
+000002c9 <wait>:
+SYSCALL(wait)
+ 2c9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 2ce:	cd 40                	int    $0x40
+ 2d0:	c3                   	ret
+
+000002d1 <pipe>:
+SYSCALL(pipe)
+ 2d1:	b8 04 00 00 00       	mov    $0x4,%eax
+ 2d6:	cd 40                	int    $0x40
+ 2d8:	c3                   	ret
+
+000002d9 <read>:
+SYSCALL(read)
+ 2d9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 2de:	cd 40                	int    $0x40
+ 2e0:	c3                   	ret
+
+000002e1 <write>:
+SYSCALL(write)
+ 2e1:	b8 10 00 00 00       	mov    $0x10,%eax
+ 2e6:	cd 40                	int    $0x40
+ 2e8:	c3                   	ret
+
+000002e9 <close>:
+SYSCALL(close)
+ 2e9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 2ee:	cd 40                	int    $0x40
+ 2f0:	c3                   	ret
+
+000002f1 <kill>:
+SYSCALL(kill)
+ 2f1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 2f6:	cd 40                	int    $0x40
+ 2f8:	c3                   	ret
+
+000002f9 <exec>:
+SYSCALL(exec)
+ 2f9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 2fe:	cd 40                	int    $0x40
+ 300:	c3                   	ret
+
+00000301 <open>:
+SYSCALL(open)
+ 301:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 306:	cd 40                	int    $0x40
+ 308:	c3                   	ret
+
+00000309 <mknod>:
+SYSCALL(mknod)
+ 309:	b8 11 00 00 00       	mov    $0x11,%eax
+ 30e:	cd 40                	int    $0x40
+ 310:	c3                   	ret
+
+00000311 <unlink>:
+SYSCALL(unlink)
+ 311:	b8 12 00 00 00       	mov    $0x12,%eax
+ 316:	cd 40                	int    $0x40
+ 318:	c3                   	ret
+
+00000319 <fstat>:
+SYSCALL(fstat)
+ 319:	b8 08 00 00 00       	mov    $0x8,%eax
+ 31e:	cd 40                	int    $0x40
+ 320:	c3                   	ret
+
+00000321 <link>:
+SYSCALL(link)
+ 321:	b8 13 00 00 00       	mov    $0x13,%eax
+ 326:	cd 40                	int    $0x40
+ 328:	c3                   	ret
+
+00000329 <mkdir>:
+SYSCALL(mkdir)
+ 329:	b8 14 00 00 00       	mov    $0x14,%eax
+ 32e:	cd 40                	int    $0x40
+ 330:	c3                   	ret
+
+00000331 <chdir>:
+SYSCALL(chdir)
+ 331:	b8 09 00 00 00       	mov    $0x9,%eax
+ 336:	cd 40                	int    $0x40
+ 338:	c3                   	ret
+
+00000339 <dup>:
+SYSCALL(dup)
+ 339:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 33e:	cd 40                	int    $0x40
+ 340:	c3                   	ret
+
+00000341 <getpid>:
+SYSCALL(getpid)
+ 341:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 346:	cd 40                	int    $0x40
+ 348:	c3                   	ret
+
+00000349 <sbrk>:
+SYSCALL(sbrk)
+ 349:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 34e:	cd 40                	int    $0x40
+ 350:	c3                   	ret
+
+00000351 <sleep>:
+SYSCALL(sleep)
+ 351:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 356:	cd 40                	int    $0x40
+ 358:	c3                   	ret
+
+00000359 <uptime>:
+SYSCALL(uptime)
+ 359:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 35e:	cd 40                	int    $0x40
+ 360:	c3                   	ret
+
+00000361 <poll>:
+SYSCALL(poll)
+ 361:	b8 16 00 00 00       	mov    $0x16,%eax
+ 366:	cd 40                	int    $0x40
+ 368:	c3                   	ret
+
+00000369 <fcntl>:
+SYSCALL(fcntl)
+ 369:	b8 17 00 00 00       	mov    $0x17,%eax
+ 36e:	cd 40                	int    $0x40
+ 370:	c3                   	ret
+
+00000371 <irqroute>:
+SYSCALL(irqroute)
+ 371:	b8 18 00 00 00       	mov    $0x18,%eax
+ 376:	cd 40                	int    $0x40
+ 378:	c3                   	ret
+
+00000379 <intrstat>:
+SYSCALL(intrstat)
+ 379:	b8 19 00 00 00       	mov    $0x19,%eax
+ 37e:	cd 40                	int    $0x40
+ 380:	c3                   	ret
+
+00000381 <pread>:
+SYSCALL(pread)
+ 381:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 386:	cd 40                	int    $0x40
+ 388:	c3                   	ret
+
+00000389 <getdents>:
+SYSCALL(getdents)
+ 389:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 38e:	cd 40                	int    $0x40
+ 390:	c3                   	ret
+
+00000391 <fstatat>:
+SYSCALL(fstatat)
+ 391:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 396:	cd 40                	int    $0x40
+ 398:	c3                   	ret
+
+00000399 <openat>:
+SYSCALL(openat)
+ 399:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 39e:	cd 40                	int    $0x40
+ 3a0:	c3                   	ret
+
+000003a1 <unlinkat>:
+SYSCALL(unlinkat)
+ 3a1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3a6:	cd 40                	int    $0x40
+ 3a8:	c3                   	ret
+
+000003a9 <mkdirat>:
+SYSCALL(mkdirat)
+ 3a9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3ae:	cd 40                	int    $0x40
+ 3b0:	c3                   	ret
+
+000003b1 <linkat>:
+SYSCALL(linkat)
+ 3b1:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3b6:	cd 40                	int    $0x40
+ 3b8:	c3                   	ret
+
+000003b9 <exits>:
+SYSCALL(exits)
+ 3b9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3be:	cd 40                	int    $0x40
+ 3c0:	c3                   	ret
+
+000003c1 <waitstatus>:
+SYSCALL(waitstatus)
+ 3c1:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3c6:	cd 40                	int    $0x40
+ 3c8:	c3                   	ret
+
+000003c9 <pwrite>:
+SYSCALL(pwrite)
+ 3c9:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3ce:	cd 40                	int    $0x40
+ 3d0:	c3                   	ret
+
+000003d1 <lseek>:
+SYSCALL(lseek)
+ 3d1:	b8 24 00 00 00       	mov    $0x24,%eax
+ 3d6:	cd 40                	int    $0x40
+ 3d8:	c3                   	ret
+
+000003d9 <copyfilerange>:
+SYSCALL(copyfilerange)
+ 3d9:	b8 25 00 00 00       	mov    $0x25,%eax
+ 3de:	cd 40                	int    $0x40
+ 3e0:	c3                   	ret
+
+000003e1 <fsctl>:
+SYSCALL(fsctl)
+ 3e1:	b8 26 00 00 00       	mov    $0x26,%eax
+ 3e6:	cd 40                	int    $0x40
+ 3e8:	c3                   	ret
+
+000003e9 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 3e9:	55                   	push   %ebp
+ 3ea:	89 e5                	mov    %esp,%ebp
+ 3ec:	83 ec 18             	sub    $0x18,%esp
+ 3ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3f2:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 3f5:	83 ec 04             	sub    $0x4,%esp
+ 3f8:	6a 01                	push   $0x1
+ 3fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 3fd:	50                   	push   %eax
+ 3fe:	ff 75 08             	push   0x8(%ebp)
+ 401:	e8 db fe ff ff       	call   2e1 <write>
+ 406:	83 c4 10             	add    $0x10,%esp
+}
+ 409:	90                   	nop
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+
+0000040c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 40c:	55                   	push   %ebp
+ 40d:	89 e5                	mov    %esp,%ebp
+ 40f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 412:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 419:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 41d:	74 17                	je     436 <printint+0x2a>
+ 41f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 423:	79 11                	jns    436 <printint+0x2a>
+    neg = 1;
+ 425:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 42c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 42f:	f7 d8                	neg    %eax
+ 431:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 434:	eb 06                	jmp    43c <printint+0x30>
+  } else {
+    x = xx;
+ 436:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 439:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 43c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 443:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 446:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 449:	ba 00 00 00 00       	mov    $0x0,%edx
+ 44e:	f7 f1                	div    %ecx
+ 450:	89 d1                	mov    %edx,%ecx
+ 452:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 455:	8d 50 01             	lea    0x1(%eax),%edx
+ 458:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 45b:	0f b6 91 e0 0a 00 00 	movzbl 0xae0(%ecx),%edx
+ 462:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 466:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 469:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 46c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 471:	f7 f1                	div    %ecx
+ 473:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 476:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 47a:	75 c7                	jne    443 <printint+0x37>
+  if(neg)
+ 47c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 480:	74 2d                	je     4af <printint+0xa3>
+    buf[i++] = '-';
+ 482:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 485:	8d 50 01             	lea    0x1(%eax),%edx
+ 488:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 48b:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 490:	eb 1d                	jmp    4af <printint+0xa3>
+    putc(fd, buf[i]);
+ 492:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 495:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 498:	01 d0                	add    %edx,%eax
+ 49a:	0f b6 00             	movzbl (%eax),%eax
+ 49d:	0f be c0             	movsbl %al,%eax
+ 4a0:	83 ec 08             	sub    $0x8,%esp
+ 4a3:	50                   	push   %eax
+ 4a4:	ff 75 08             	push   0x8(%ebp)
+ 4a7:	e8 3d ff ff ff       	call   3e9 <putc>
+ 4ac:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 4af:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4b3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4b7:	79 d9                	jns    492 <printint+0x86>
+}
+ 4b9:	90                   	nop
+ 4ba:	90                   	nop
+ 4bb:	c9                   	leave
+ 4bc:	c3                   	ret
+
+000004bd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4bd:	55                   	push   %ebp
+ 4be:	89 e5                	mov    %esp,%ebp
+ 4c0:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 4c3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 4ca:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 4cd:	83 c0 04             	add    $0x4,%eax
+ 4d0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 4d3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 4da:	e9 59 01 00 00       	jmp    638 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 4df:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 4e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4e5:	01 d0                	add    %edx,%eax
+ 4e7:	0f b6 00             	movzbl (%eax),%eax
+ 4ea:	0f be c0             	movsbl %al,%eax
+ 4ed:	25 ff 00 00 00       	and    $0xff,%eax
+ 4f2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 4f5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4f9:	75 2c                	jne    527 <printf+0x6a>
+      if(c == '%'){
+ 4fb:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 4ff:	75 0c                	jne    50d <printf+0x50>
+        state = '%';
+ 501:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 508:	e9 27 01 00 00       	jmp    634 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 50d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 510:	0f be c0             	movsbl %al,%eax
+ 513:	83 ec 08             	sub    $0x8,%esp
+ 516:	50                   	push   %eax
+ 517:	ff 75 08             	push   0x8(%ebp)
+ 51a:	e8 ca fe ff ff       	call   3e9 <putc>
+ 51f:	83 c4 10             	add    $0x10,%esp
+ 522:	e9 0d 01 00 00       	jmp    634 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 527:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 52b:	0f 85 03 01 00 00    	jne    634 <printf+0x177>
+      if(c == 'd'){
+ 531:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 535:	75 1e                	jne    555 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 537:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 53a:	8b 00                	mov    (%eax),%eax
+ 53c:	6a 01                	push   $0x1
+ 53e:	6a 0a                	push   $0xa
+ 540:	50                   	push   %eax
+ 541:	ff 75 08             	push   0x8(%ebp)
+ 544:	e8 c3 fe ff ff       	call   40c <printint>
+ 549:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 54c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 550:	e9 d8 00 00 00       	jmp    62d <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 555:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 559:	74 06                	je     561 <printf+0xa4>
+ 55b:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 55f:	75 1e                	jne    57f <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 561:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 564:	8b 00                	mov    (%eax),%eax
+ 566:	6a 00                	push   $0x0
+ 568:	6a 10                	push   $0x10
+ 56a:	50                   	push   %eax
+ 56b:	ff 75 08             	push   0x8(%ebp)
+ 56e:	e8 99 fe ff ff       	call   40c <printint>
+ 573:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 576:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 57a:	e9 ae 00 00 00       	jmp    62d <printf+0x170>
+      } else if(c == 's'){
+ 57f:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 583:	75 43                	jne    5c8 <printf+0x10b>
+        s = (char*)*ap;
+ 585:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 588:	8b 00                	mov    (%eax),%eax
+ 58a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 58d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 591:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 595:	75 25                	jne    5bc <printf+0xff>
+          s = "(null)";
+ 597:	c7 45 f4 74 08 00 00 	movl   $0x874,-0xc(%ebp)
+        while(*s != 0){
+ 59e:	eb 1c                	jmp    5bc <printf+0xff>
+          putc(fd, *s);
+ 5a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a3:	0f b6 00             	movzbl (%eax),%eax
+ 5a6:	0f be c0             	movsbl %al,%eax
+ 5a9:	83 ec 08             	sub    $0x8,%esp
+ 5ac:	50                   	push   %eax
+ 5ad:	ff 75 08             	push   0x8(%ebp)
+ 5b0:	e8 34 fe ff ff       	call   3e9 <putc>
+ 5b5:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 5b8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 5bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5bf:	0f b6 00             	movzbl (%eax),%eax
+ 5c2:	84 c0                	test   %al,%al
+ 5c4:	75 da                	jne    5a0 <printf+0xe3>
+ 5c6:	eb 65                	jmp    62d <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 5c8:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 5cc:	75 1d                	jne    5eb <printf+0x12e>
+        putc(fd, *ap);
+ 5ce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5d1:	8b 00                	mov    (%eax),%eax
+ 5d3:	0f be c0             	movsbl %al,%eax
+ 5d6:	83 ec 08             	sub    $0x8,%esp
+ 5d9:	50                   	push   %eax
+ 5da:	ff 75 08             	push   0x8(%ebp)
+ 5dd:	e8 07 fe ff ff       	call   3e9 <putc>
+ 5e2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5e5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5e9:	eb 42                	jmp    62d <printf+0x170>
+      } else if(c == '%'){
+ 5eb:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 5ef:	75 17                	jne    608 <printf+0x14b>
+        putc(fd, c);
+ 5f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 5f4:	0f be c0             	movsbl %al,%eax
+ 5f7:	83 ec 08             	sub    $0x8,%esp
+ 5fa:	50                   	push   %eax
+ 5fb:	ff 75 08             	push   0x8(%ebp)
+ 5fe:	e8 e6 fd ff ff       	call   3e9 <putc>
+ 603:	83 c4 10             	add    $0x10,%esp
+ 606:	eb 25                	jmp    62d <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 608:	83 ec 08             	sub    $0x8,%esp
+ 60b:	6a 25                	push   $0x25
+ 60d:	ff 75 08             	push   0x8(%ebp)
+ 610:	e8 d4 fd ff ff       	call   3e9 <putc>
+ 615:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 618:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 61b:	0f be c0             	movsbl %al,%eax
+ 61e:	83 ec 08             	sub    $0x8,%esp
+ 621:	50                   	push   %eax
+ 622:	ff 75 08             	push   0x8(%ebp)
+ 625:	e8 bf fd ff ff       	call   3e9 <putc>
+ 62a:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 62d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 634:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 638:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 63b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 63e:	01 d0                	add    %edx,%eax
+ 640:	0f b6 00             	movzbl (%eax),%eax
+ 643:	84 c0                	test   %al,%al
+ 645:	0f 85 94 fe ff ff    	jne    4df <printf+0x22>
+    }
+  }
+}
+ 64b:	90                   	nop
+ 64c:	90                   	nop
+ 64d:	c9                   	leave
+ 64e:	c3                   	ret
+
+0000064f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 64f:	55                   	push   %ebp
+ 650:	89 e5                	mov    %esp,%ebp
+ 652:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 655:	8b 45 08             	mov    0x8(%ebp),%eax
+ 658:	83 e8 08             	sub    $0x8,%eax
+ 65b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 65e:	a1 fc 0a 00 00       	mov    0xafc,%eax
+ 663:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 666:	eb 24                	jmp    68c <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 668:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 66b:	8b 00                	mov    (%eax),%eax
+ 66d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 670:	72 12                	jb     684 <free+0x35>
+ 672:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 675:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 678:	72 24                	jb     69e <free+0x4f>
+ 67a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 67d:	8b 00                	mov    (%eax),%eax
+ 67f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 682:	72 1a                	jb     69e <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 684:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 687:	8b 00                	mov    (%eax),%eax
+ 689:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 68c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 68f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 692:	73 d4                	jae    668 <free+0x19>
+ 694:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 697:	8b 00                	mov    (%eax),%eax
+ 699:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 69c:	73 ca                	jae    668 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 69e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6a1:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6ab:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6ae:	01 c2                	add    %eax,%edx
+ 6b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b3:	8b 00                	mov    (%eax),%eax
+ 6b5:	39 c2                	cmp    %eax,%edx
+ 6b7:	75 24                	jne    6dd <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ 6b9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6bc:	8b 50 04             	mov    0x4(%eax),%edx
+ 6bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c2:	8b 00                	mov    (%eax),%eax
+ 6c4:	8b 40 04             	mov    0x4(%eax),%eax
+ 6c7:	01 c2                	add    %eax,%edx
+ 6c9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6cc:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6d2:	8b 00                	mov    (%eax),%eax
+ 6d4:	8b 10                	mov    (%eax),%edx
+ 6d6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6d9:	89 10                	mov    %edx,(%eax)
+ 6db:	eb 0a                	jmp    6e7 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ 6dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e0:	8b 10                	mov    (%eax),%edx
+ 6e2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 6e5:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ 6e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ea:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ed:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ 6f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6f7:	01 d0                	add    %edx,%eax
+ 6f9:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ 6fc:	75 20                	jne    71e <free+0xcf>
+    p->s.size += bp->s.size;
+ 6fe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 701:	8b 50 04             	mov    0x4(%eax),%edx
+ 704:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 707:	8b 40 04             	mov    0x4(%eax),%eax
+ 70a:	01 c2                	add    %eax,%edx
+ 70c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 70f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ 712:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 715:	8b 10                	mov    (%eax),%edx
+ 717:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 71a:	89 10                	mov    %edx,(%eax)
+ 71c:	eb 08                	jmp    726 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ 71e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 721:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 724:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ 726:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 729:	a3 fc 0a 00 00       	mov    %eax,0xafc
+}
+ 72e:	90                   	nop
+ 72f:	c9                   	leave
+ 730:	c3                   	ret
+
+00000731 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ 731:	55                   	push   %ebp
+ 732:	89 e5                	mov    %esp,%ebp
+ 734:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ 737:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ 73e:	77 07                	ja     747 <morecore+0x16>
+    nu = 4096;
+ 740:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ 747:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74a:	c1 e0 03             	shl    $0x3,%eax
+ 74d:	83 ec 0c             	sub    $0xc,%esp
+ 750:	50                   	push   %eax
+ 751:	e8 f3 fb ff ff       	call   349 <sbrk>
+ 756:	83 c4 10             	add    $0x10,%esp
+ 759:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 75c:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 760:	75 07                	jne    769 <morecore+0x38>
+    return 0;
+ 762:	b8 00 00 00 00       	mov    $0x0,%eax
+ 767:	eb 26                	jmp    78f <morecore+0x5e>
+  hp = (Header*)p;
+ 769:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 76c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 76f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 772:	8b 55 08             	mov    0x8(%ebp),%edx
+ 775:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ 778:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 77b:	83 c0 08             	add    $0x8,%eax
+ 77e:	83 ec 0c             	sub    $0xc,%esp
+ 781:	50                   	push   %eax
+ 782:	e8 c8 fe ff ff       	call   64f <free>
+ 787:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 78a:	a1 fc 0a 00 00       	mov    0xafc,%eax
+}
+ 78f:	c9                   	leave
+ 790:	c3                   	ret
+
+00000791 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ 791:	55                   	push   %ebp
+ 792:	89 e5                	mov    %esp,%ebp
+ 794:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 797:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79a:	83 c0 07             	add    $0x7,%eax
+ 79d:	c1 e8 03             	shr    $0x3,%eax
+ 7a0:	83 c0 01             	add    $0x1,%eax
+ 7a3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 7a6:	a1 fc 0a 00 00       	mov    0xafc,%eax
+ 7ab:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 7ae:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7b2:	75 23                	jne    7d7 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 7b4:	c7 45 f0 f4 0a 00 00 	movl   $0xaf4,-0x10(%ebp)
+ 7bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7be:	a3 fc 0a 00 00       	mov    %eax,0xafc
+ 7c3:	a1 fc 0a 00 00       	mov    0xafc,%eax
+ 7c8:	a3 f4 0a 00 00       	mov    %eax,0xaf4
+    base.s.size = 0;
+ 7cd:	c7 05 f8 0a 00 00 00 	movl   $0x0,0xaf8
+ 7d4:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7d7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7da:	8b 00                	mov    (%eax),%eax
+ 7dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 7df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e2:	8b 40 04             	mov    0x4(%eax),%eax
+ 7e5:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 7e8:	72 4d                	jb     837 <malloc+0xa6>
+      if(p->s.size == nunits)
+ 7ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ed:	8b 40 04             	mov    0x4(%eax),%eax
+ 7f0:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 7f3:	75 0c                	jne    801 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 7f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f8:	8b 10                	mov    (%eax),%edx
+ 7fa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7fd:	89 10                	mov    %edx,(%eax)
+ 7ff:	eb 26                	jmp    827 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 801:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 804:	8b 40 04             	mov    0x4(%eax),%eax
+ 807:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 80a:	89 c2                	mov    %eax,%edx
+ 80c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 80f:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 812:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 815:	8b 40 04             	mov    0x4(%eax),%eax
+ 818:	c1 e0 03             	shl    $0x3,%eax
+ 81b:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 81e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 821:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 824:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 827:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 82a:	a3 fc 0a 00 00       	mov    %eax,0xafc
+      return (void*)(p + 1);
+ 82f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 832:	83 c0 08             	add    $0x8,%eax
+ 835:	eb 3b                	jmp    872 <malloc+0xe1>
+    }
+    if(p == freep)
+ 837:	a1 fc 0a 00 00       	mov    0xafc,%eax
+ 83c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 83f:	75 1e                	jne    85f <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 841:	83 ec 0c             	sub    $0xc,%esp
+ 844:	ff 75 ec             	push   -0x14(%ebp)
+ 847:	e8 e5 fe ff ff       	call   731 <morecore>
+ 84c:	83 c4 10             	add    $0x10,%esp
+ 84f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 852:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 856:	75 07                	jne    85f <malloc+0xce>
+        return 0;
+ 858:	b8 00 00 00 00       	mov    $0x0,%eax
+ 85d:	eb 13                	jmp    872 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 85f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 862:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 868:	8b 00                	mov    (%eax),%eax
+ 86a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 86d:	e9 6d ff ff ff       	jmp    7df <malloc+0x4e>
+  }
+}
+ 872:	c9                   	leave
+ 873:	c3                   	ret